@@ -0,0 +1,98 @@
+#pragma once
+/**
+ * @file BenchmarkSetup.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Sample operands and the timing loop shared by every benchmark.
+ *
+ * @details Each benchmark times one library call on operands the optimizer cannot see through:
+ *          operands are laundered through `benchmark::DoNotOptimize` on every iteration, so the call is neither
+ *          constant folded nor hoisted out of the loop, and the result is kept alive the same way.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+
+namespace benchutils
+{
+    /**************************************
+     *                                    *
+     *              OPERANDS              *
+     *                                    *
+     **************************************/
+
+    /**
+     * @brief Build a vector with small, distinct, non-zero components.
+     *
+     * @tparam Vec  Vector type exposing `dimension`, `value_type` and `operator[]`.
+     * @param  seed Offset that tells several sample operands apart.
+     *
+     * @return Vector `<seed + 1, seed + 2, ...>`.
+     */
+    template <typename Vec>
+    [[nodiscard]] Vec sampleVector(const int seed = 0)
+    {
+        using T = typename Vec::value_type;
+
+        Vec vec{};
+        for (std::size_t i = 0; i < Vec::dimension; ++i)
+            vec[i] = static_cast<T>(seed + static_cast<int>(i) + 1);
+        return vec;
+    }
+
+
+    /**
+     * @brief Build a diagonally dominant, and therefore invertible, matrix.
+     *
+     * @tparam Mat  Matrix type exposing `value_type` and `operator()(row, col)`.
+     * @tparam N    Number of rows and columns.
+     * @param  seed Offset that tells several sample operands apart.
+     *
+     * @return Matrix with `N * 2 + seed` on the diagonal and `(row + col) % 3 + 1` elsewhere.
+     */
+    template <typename Mat, std::size_t N>
+    [[nodiscard]] Mat sampleMatrix(const int seed = 0)
+    {
+        using T = typename Mat::value_type;
+
+        Mat mat{};
+        for (std::size_t row = 0; row < N; ++row)
+            for (std::size_t col = 0; col < N; ++col)
+                mat(row, col) = static_cast<T>(row == col ? static_cast<int>(N) * 2 + seed
+                                                          : static_cast<int>((row + col) % 3) + 1);
+        return mat;
+    }
+
+
+
+    /**************************************
+     *                                    *
+     *            TIMING LOOP             *
+     *                                    *
+     **************************************/
+
+    /**
+     * @brief Time `op(operands...)` once per iteration.
+     *
+     * @param[in,out] state    Benchmark state driving the loop.
+     * @param[in]     op       Callable under test.
+     * @param[in]     operands Arguments, copied so they can be laundered in place.
+     */
+    template <typename Op, typename... Operands>
+    void measure(benchmark::State& state, Op op, Operands... operands)
+    {
+        for (auto _ : state)
+        {
+            (benchmark::DoNotOptimize(operands), ...);
+            auto result = op(operands...);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+} // namespace benchutils
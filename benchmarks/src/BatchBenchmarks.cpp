@@ -0,0 +1,661 @@
+/**
+ * @file BatchBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times @ref fgm::Vec4Array batch operations, half precision buffer conversion and vector quantization
+ *        against the same loop over packed vectors.
+ *
+ * @note The packed loops follow the `FORCE_*` level of the executable, while @ref fgm::Vec4Array goes through the
+ *       runtime dispatched kernels; cap those with `FALCON_FORCE_SIMD` to compare tiers.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <algorithm>
+#include <common/Half.h>
+#include <cstdint>
+#include <matrix/Matrix4DBatch.h>
+#include <quaternion/QuaternionBatch.h>
+#include <vector/VectorReductions.h>
+#include <span>
+#include <vector/Quantization.h>
+#include <vector/Vec4Array.h>
+#include <vector>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/** @brief @p count distinct, non-zero vectors. */
+template <typename T>
+[[nodiscard]] std::vector<fgm::Vector4D<T>> sampleVectors(const std::size_t count, const int seed = 0)
+{
+    std::vector<fgm::Vector4D<T>> vectors;
+    vectors.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        vectors.push_back(sampleVector<fgm::Vector4D<T>>(seed + static_cast<int>(i % 64)));
+    return vectors;
+}
+
+
+/** @brief Report throughput in vectors per second. */
+void setProcessed(benchmark::State& state, const std::size_t count)
+{
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+
+
+/**************************************
+ *                                    *
+ *            DOT PRODUCT             *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Batch_Dot_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> lhs = sampleVectors<T>(count, 0);
+    const std::vector<fgm::Vector4D<T>> rhs = sampleVectors<T>(count, 4);
+    std::vector<T> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = lhs[i].dot(rhs[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_Dot_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> lhs(sampleVectors<T>(count, 0));
+    const fgm::Vec4Array<T> rhs(sampleVectors<T>(count, 4));
+    std::vector<T> out(count);
+
+    for (auto _ : state)
+    {
+        lhs.dot(rhs, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             MAGNITUDE              *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Batch_Mag_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+    std::vector<T> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = vectors[i].mag();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_Mag_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> vectors(sampleVectors<T>(count));
+    std::vector<T> out(count);
+
+    for (auto _ : state)
+    {
+        vectors.mag(out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *           NORMALIZATION            *
+ *                                    *
+ **************************************/
+
+template <typename T, fgm::Precision P = fgm::Precision::Exact>
+void Batch_Normalize_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+    std::vector<fgm::Vector4D<T>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = vectors[i].template normalize<P>();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+/** @note Includes allocating the result, which @ref fgm::Vec4Array::normalize always does. */
+template <typename T, fgm::Precision P = fgm::Precision::Exact>
+void Batch_Normalize_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> vectors(sampleVectors<T>(count));
+
+    for (auto _ : state)
+    {
+        fgm::Vec4Array<T> out = vectors.template normalize<P>();
+        benchmark::DoNotOptimize(out.x().data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *          MATRIX TRANSFORM          *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Batch_Transform_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto matrix = sampleMatrix<fgm::Matrix4D<T>, 4>();
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+    std::vector<fgm::Vector4D<T>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = matrix * vectors[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_Transform_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto matrix = sampleMatrix<fgm::Matrix4D<T>, 4>();
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+    std::vector<fgm::Vector4D<T>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::transform(matrix, vectors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_Transform_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto matrix = sampleMatrix<fgm::Matrix4D<T>, 4>();
+    const fgm::Vec4Array<T> vectors(sampleVectors<T>(count));
+    fgm::Vec4Array<T> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::transform(matrix, vectors, out);
+        benchmark::DoNotOptimize(out.x().data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             EQUALITY               *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Batch_AllEq_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> lhs = sampleVectors<T>(count, 0);
+    const std::vector<fgm::Vector4D<T>> rhs = sampleVectors<T>(count, 0); // All equal: no lane exits early
+    std::vector<std::uint64_t> out((count + 63) / 64);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t bit = std::uint64_t(lhs[i].allEq(rhs[i])) << (i % 64);
+            out[i / 64] = i % 64 == 0 ? bit : out[i / 64] | bit;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_AllEq_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> lhs(sampleVectors<T>(count, 0));
+    const fgm::Vec4Array<T> rhs(sampleVectors<T>(count, 0));
+    std::vector<std::uint64_t> out(lhs.bitsetWords());
+
+    for (auto _ : state)
+    {
+        lhs.allEq(rhs, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *               SLERP                *
+ *                                    *
+ **************************************/
+
+/** @brief @p count unit quaternions. */
+template <typename T>
+[[nodiscard]] std::vector<fgm::Vector4D<T>> sampleRotations(const std::size_t count, const int seed)
+{
+    std::vector<fgm::Vector4D<T>> rotations = sampleVectors<T>(count, seed);
+    for (auto& rotation : rotations)
+        rotation = rotation.normalize();
+    return rotations;
+}
+
+
+template <typename T>
+void Batch_Slerp_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> from = sampleRotations<T>(count, 0);
+    const std::vector<fgm::Vector4D<T>> to = sampleRotations<T>(count, 7);
+    std::vector<fgm::Quaternion<T>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::Quaternion<T>::slerp(fgm::Quaternion<T>(from[i]), fgm::Quaternion<T>(to[i]), T(0.3));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Batch_Slerp_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> from(sampleRotations<T>(count, 0));
+    const fgm::Vec4Array<T> to(sampleRotations<T>(count, 7));
+    fgm::Vec4Array<T> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::slerp(from, to, T(0.3), out);
+        benchmark::DoNotOptimize(out.x().data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *            REDUCTIONS              *
+ *                                    *
+ **************************************/
+
+/** @brief Bounds and sum of squared lengths in one scalar loop, as written without the reductions. */
+template <typename T>
+void Batch_BoundsSumDot_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+
+    for (auto _ : state)
+    {
+        fgm::Vector4D<T> low = vectors[0], high = vectors[0];
+        T squares = T(0);
+        for (const fgm::Vector4D<T>& vec : vectors)
+        {
+            for (std::size_t c = 0; c < 4; ++c)
+            {
+                low[c] = std::min(low[c], vec[c]);
+                high[c] = std::max(high[c], vec[c]);
+            }
+            squares += vec.dot(vec);
+        }
+        benchmark::DoNotOptimize(low);
+        benchmark::DoNotOptimize(high);
+        benchmark::DoNotOptimize(squares);
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T, fgm::Summation S = fgm::Summation::Plain>
+void Batch_BoundsSumDot_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::Vec4Array<T> vectors(sampleVectors<T>(count));
+    fgm::ReduceOptions options;
+    options.summation = S;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fgm::bounds(vectors, options));
+        benchmark::DoNotOptimize(fgm::sumDot(vectors, vectors, options));
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *          HALF PRECISION            *
+ *                                    *
+ **************************************/
+
+/** @brief Round vectors to half precision one component at a time. */
+void Batch_ToHalf_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<float>> vectors = sampleVectors<float>(count);
+    std::vector<fgm::Vector4D<fgm::half>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::Vector4D<fgm::half>(vectors[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+void Batch_ToHalf_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<float>> vectors = sampleVectors<float>(count);
+    std::vector<fgm::Vector4D<fgm::half>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::toHalf<fgm::Vector4D>(vectors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+/** @brief Widen half precision vectors one component at a time. */
+void Batch_ToFloat_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<fgm::Vector4D<fgm::half>> vectors(count);
+    fgm::toHalf<fgm::Vector4D>(sampleVectors<float>(count), vectors);
+    std::vector<fgm::Vector4D<float>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::Vector4D<float>(vectors[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+void Batch_ToFloat_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<fgm::Vector4D<fgm::half>> vectors(count);
+    fgm::toHalf<fgm::Vector4D>(sampleVectors<float>(count), vectors);
+    std::vector<fgm::Vector4D<float>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::toFloat<fgm::Vector4D>(vectors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *            QUANTIZATION            *
+ *                                    *
+ **************************************/
+
+/** @brief Directions of the sample vectors, which need not be unit length to encode. */
+std::vector<fgm::Vector3D<float>> sampleDirections(const std::size_t count)
+{
+    std::vector<fgm::Vector3D<float>> directions;
+    for (const fgm::Vector4D<float>& vec : sampleVectors<float>(count))
+        directions.emplace_back(vec.x, vec.y, vec.z);
+    return directions;
+}
+
+
+/** @brief Encode vectors to SNORM8 one at a time. */
+void Batch_EncodeSnorm8_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<float>> vectors = sampleVectors<float>(count);
+    std::vector<fgm::Vector4D<std::int8_t>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::encodeSnorm8(vectors[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+void Batch_EncodeSnorm8_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector4D<float>> vectors = sampleVectors<float>(count);
+    std::vector<fgm::Vector4D<std::int8_t>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::encodeSnorm8(vectors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+/** @brief Encode directions to octahedral pairs one at a time. */
+void Batch_EncodeOctahedral_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector3D<float>> directions = sampleDirections(count);
+    std::vector<fgm::Vector2D<std::int16_t>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::encodeOctahedral(directions[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+void Batch_EncodeOctahedral_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Vector3D<float>> directions = sampleDirections(count);
+    std::vector<fgm::Vector2D<std::int16_t>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::encodeOctahedral(directions, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+/** @brief Decode octahedral pairs to unit vectors one at a time. */
+void Batch_DecodeOctahedral_Loop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<fgm::Vector2D<std::int16_t>> encoded(count);
+    fgm::encodeOctahedral(sampleDirections(count), encoded);
+    std::vector<fgm::Vector3D<float>> out(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = fgm::decodeOctahedral(encoded[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+void Batch_DecodeOctahedral_Kernel(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<fgm::Vector2D<std::int16_t>> encoded(count);
+    fgm::encodeOctahedral(sampleDirections(count), encoded);
+    std::vector<fgm::Vector3D<float>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::decodeOctahedral(encoded, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+/**************************************
+ *                                    *
+ *            REGISTRATION            *
+ *                                    *
+ **************************************/
+
+// From a few cache lines up to well past L2.
+#define FALCON_BENCHMARK_BATCH(func, ...) BENCHMARK_TEMPLATE(func, __VA_ARGS__)->RangeMultiplier(8)->Range(64, 1 << 18)
+
+FALCON_BENCHMARK_BATCH(Batch_Dot_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_Dot_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_Dot_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_Dot_Vec4Array, double);
+
+FALCON_BENCHMARK_BATCH(Batch_Mag_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_Mag_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_Mag_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_Mag_Vec4Array, double);
+
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Vec4Array, double);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Packed, float, fgm::Precision::Refined);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Vec4Array, float, fgm::Precision::Refined);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Packed, float, fgm::Precision::Fast);
+FALCON_BENCHMARK_BATCH(Batch_Normalize_Vec4Array, float, fgm::Precision::Fast);
+
+FALCON_BENCHMARK_BATCH(Batch_Transform_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_Transform_Kernel, float);
+FALCON_BENCHMARK_BATCH(Batch_Transform_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_Transform_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_Transform_Kernel, double);
+FALCON_BENCHMARK_BATCH(Batch_Transform_Vec4Array, double);
+
+FALCON_BENCHMARK_BATCH(Batch_AllEq_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_AllEq_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_AllEq_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_AllEq_Vec4Array, double);
+
+FALCON_BENCHMARK_BATCH(Batch_Slerp_Packed, float);
+FALCON_BENCHMARK_BATCH(Batch_Slerp_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_Slerp_Packed, double);
+FALCON_BENCHMARK_BATCH(Batch_Slerp_Vec4Array, double);
+
+FALCON_BENCHMARK_BATCH(Batch_BoundsSumDot_Loop, float);
+FALCON_BENCHMARK_BATCH(Batch_BoundsSumDot_Vec4Array, float);
+FALCON_BENCHMARK_BATCH(Batch_BoundsSumDot_Loop, double);
+FALCON_BENCHMARK_BATCH(Batch_BoundsSumDot_Vec4Array, double);
+FALCON_BENCHMARK_BATCH(Batch_BoundsSumDot_Vec4Array, double, fgm::Summation::Compensated);
+
+BENCHMARK(Batch_ToHalf_Loop)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_ToHalf_Kernel)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_ToFloat_Loop)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_ToFloat_Kernel)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+BENCHMARK(Batch_EncodeSnorm8_Loop)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_EncodeSnorm8_Kernel)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_EncodeOctahedral_Loop)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_EncodeOctahedral_Kernel)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_DecodeOctahedral_Loop)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(Batch_DecodeOctahedral_Kernel)->RangeMultiplier(8)->Range(64, 1 << 18);
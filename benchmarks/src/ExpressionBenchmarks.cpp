@@ -0,0 +1,120 @@
+/**
+ * @file ExpressionBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times chained @ref fgm::Vector4D and @ref fgm::Matrix4D arithmetic eagerly and through @ref fgm::expr.
+ *
+ * @details Each pair computes the same chain: the eager version materializes one vector or matrix per operator, the
+ *          lazy version evaluates the whole chain in registers and contracts products into multiply-adds. The gap is
+ *          the saved intermediate loads and stores.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <expr/Expression.h>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *          VECTOR CHAINS             *
+ *                                    *
+ **************************************/
+
+/** @brief `a * s + b * t - c`. */
+template <typename T>
+void Expr_Combine_Eager(benchmark::State& state)
+{
+    using Vec = fgm::Vector4D<T>;
+    measure(
+        state, [](const Vec& a, const Vec& b, const Vec& c, const T s) { return a * s + b * (s + T(1)) - c; },
+        sampleVector<Vec>(0), sampleVector<Vec>(1), sampleVector<Vec>(2), T(3));
+}
+
+
+template <typename T>
+void Expr_Combine_Lazy(benchmark::State& state)
+{
+    using Vec = fgm::Vector4D<T>;
+    measure(
+        state,
+        [](const Vec& a, const Vec& b, const Vec& c, const T s)
+        { return Vec(fgm::expr::lazy(a) * s + fgm::expr::lazy(b) * (s + T(1)) - c); },
+        sampleVector<Vec>(0), sampleVector<Vec>(1), sampleVector<Vec>(2), T(3));
+}
+
+
+
+/**************************************
+ *                                    *
+ *          MATRIX CHAINS             *
+ *                                    *
+ **************************************/
+
+/** @brief `m * v + t`. */
+template <typename T>
+void Expr_TransformOffset_Eager(benchmark::State& state)
+{
+    using Vec = fgm::Vector4D<T>;
+    using Mat = fgm::Matrix4D<T>;
+    measure(
+        state, [](const Mat& m, const Vec& v, const Vec& t) { return m * v + t; }, sampleMatrix<Mat, 4>(),
+        sampleVector<Vec>(0), sampleVector<Vec>(1));
+}
+
+
+template <typename T>
+void Expr_TransformOffset_Lazy(benchmark::State& state)
+{
+    using Vec = fgm::Vector4D<T>;
+    using Mat = fgm::Matrix4D<T>;
+    measure(
+        state, [](const Mat& m, const Vec& v, const Vec& t) { return Vec(fgm::expr::lazy(m) * v + t); },
+        sampleMatrix<Mat, 4>(), sampleVector<Vec>(0), sampleVector<Vec>(1));
+}
+
+
+/** @brief `a * s + b - c`. */
+template <typename T>
+void Expr_MatrixCombine_Eager(benchmark::State& state)
+{
+    using Mat = fgm::Matrix4D<T>;
+    measure(
+        state, [](const Mat& a, const Mat& b, const Mat& c, const T s) { return a * s + b - c; },
+        sampleMatrix<Mat, 4>(0), sampleMatrix<Mat, 4>(1), sampleMatrix<Mat, 4>(2), T(3));
+}
+
+
+template <typename T>
+void Expr_MatrixCombine_Lazy(benchmark::State& state)
+{
+    using Mat = fgm::Matrix4D<T>;
+    measure(
+        state, [](const Mat& a, const Mat& b, const Mat& c, const T s) { return Mat(fgm::expr::lazy(a) * s + b - c); },
+        sampleMatrix<Mat, 4>(0), sampleMatrix<Mat, 4>(1), sampleMatrix<Mat, 4>(2), T(3));
+}
+
+
+
+/**************************************
+ *                                    *
+ *            REGISTRATION            *
+ *                                    *
+ **************************************/
+
+#define FALCON_BENCHMARK_EXPRESSIONS(T)                                                                                \
+    BENCHMARK_TEMPLATE(Expr_Combine_Eager, T);                                                                         \
+    BENCHMARK_TEMPLATE(Expr_Combine_Lazy, T);                                                                          \
+    BENCHMARK_TEMPLATE(Expr_TransformOffset_Eager, T);                                                                 \
+    BENCHMARK_TEMPLATE(Expr_TransformOffset_Lazy, T);                                                                  \
+    BENCHMARK_TEMPLATE(Expr_MatrixCombine_Eager, T);                                                                   \
+    BENCHMARK_TEMPLATE(Expr_MatrixCombine_Lazy, T)
+
+FALCON_BENCHMARK_EXPRESSIONS(float);
+FALCON_BENCHMARK_EXPRESSIONS(double);
@@ -0,0 +1,437 @@
+/**
+ * @file GeometryBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times ray intersection one @ref fgm::Ray at a time against the packet tests of @ref fgm::RayPacket, and
+ *        the build and queries of @ref fgm::BVH.
+ *
+ * @note Ray throughput is in ray-primitive tests per second: every ray of the batch is tested against every primitive
+ *       of a small mesh, keeping the closest hit. The scalar loops follow the `FORCE_*` level of the executable, while
+ *       @ref fgm::RayPacket goes through the runtime dispatched kernels; cap those with `FALCON_FORCE_SIMD` to
+ *       compare tiers. Hierarchy builds report triangles per second and queries rays per second.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <geometry/BVH.h>
+#include <geometry/Ray.h>
+#include <geometry/RayPacket.h>
+#include <limits>
+#include <parallel/ThreadPool.h>
+#include <random>
+#include <vector>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+namespace
+{
+    /** @brief Number of primitives every ray is tested against. */
+    constexpr std::size_t primitiveCount = 16;
+
+
+    /** @brief @p count rays fanning out from a grid in front of the primitives, about half of them hitting. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Ray<T>> sampleRays(const std::size_t count)
+    {
+        std::vector<fgm::Ray<T>> rays;
+        rays.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T x = static_cast<T>(static_cast<int>(i % 17) - 8) * T(0.25);
+            const T y = static_cast<T>(static_cast<int>(i % 13) - 6) * T(0.25);
+            rays.emplace_back(fgm::Vector3D<T>(x, y, T(10)), fgm::Vector3D<T>(x * T(0.05), y * T(0.05), T(-1)));
+        }
+        return rays;
+    }
+
+
+    /** @brief Vertices of @ref primitiveCount triangles stacked along `z`, three per triangle. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Vector3D<T>> sampleTriangles()
+    {
+        std::vector<fgm::Vector3D<T>> vertices;
+        for (std::size_t i = 0; i < primitiveCount; ++i)
+        {
+            const T z = static_cast<T>(i) * T(0.5);
+            const T shift = static_cast<T>(i % 4) * T(0.25);
+            vertices.emplace_back(T(-2) + shift, T(-2), z);
+            vertices.emplace_back(T(2), T(-1) + shift, z);
+            vertices.emplace_back(T(-1), T(2) - shift, z);
+        }
+        return vertices;
+    }
+
+
+    /** @brief @ref primitiveCount boxes stacked along `z`. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::AABB<T>> sampleBoxes()
+    {
+        std::vector<fgm::AABB<T>> boxes;
+        for (std::size_t i = 0; i < primitiveCount; ++i)
+        {
+            const T z = static_cast<T>(i) * T(0.5);
+            const T shift = static_cast<T>(i % 4) * T(0.25);
+            boxes.emplace_back(fgm::Vector3D<T>(T(-1.5) + shift, T(-1), z),
+                               fgm::Vector3D<T>(T(1) + shift, T(1.5), z + T(0.25)));
+        }
+        return boxes;
+    }
+
+
+    /** @brief @ref primitiveCount spheres stacked along `z`. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Sphere<T>> sampleSpheres()
+    {
+        std::vector<fgm::Sphere<T>> spheres;
+        for (std::size_t i = 0; i < primitiveCount; ++i)
+        {
+            const T shift = static_cast<T>(i % 4) * T(0.25);
+            spheres.emplace_back(fgm::Vector3D<T>(shift, -shift, static_cast<T>(i) * T(0.5)), T(1.25));
+        }
+        return spheres;
+    }
+
+
+    /** @brief Report throughput in ray-primitive tests per second. */
+    void setProcessed(benchmark::State& state, const std::size_t rays)
+    {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rays * primitiveCount));
+    }
+
+
+    /** @brief Vertices of @p count small triangles scattered through a cube of side 100, three per triangle. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Vector3D<T>> sampleSoup(const std::size_t count)
+    {
+        std::mt19937 engine(20261017u);
+        std::uniform_real_distribution<T> position(T(-50), T(50));
+        std::uniform_real_distribution<T> offset(T(-1), T(1));
+        std::vector<fgm::Vector3D<T>> vertices;
+        vertices.reserve(count * 3);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const fgm::Vector3D<T> center(position(engine), position(engine), position(engine));
+            for (int v = 0; v < 3; ++v)
+                vertices.push_back(center + fgm::Vector3D<T>(offset(engine), offset(engine), offset(engine)));
+        }
+        return vertices;
+    }
+
+
+    /** @brief @p count rays from in front of the cube of @ref sampleSoup towards points inside it. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Ray<T>> sampleSoupRays(const std::size_t count)
+    {
+        std::mt19937 engine(17u);
+        std::uniform_real_distribution<T> position(T(-50), T(50));
+        std::vector<fgm::Ray<T>> rays;
+        rays.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const fgm::Vector3D<T> origin(position(engine), position(engine), T(-80));
+            const fgm::Vector3D<T> target(position(engine), position(engine), position(engine));
+            rays.emplace_back(origin, target - origin);
+        }
+        return rays;
+    }
+
+
+    /** @brief Triangle counts of a hierarchy build, for every thread count up to the core count. */
+    void buildScaling(benchmark::internal::Benchmark* benchmark)
+    {
+        const auto cores = static_cast<std::int64_t>(fgm::parallel::ThreadPool::defaultThreadCount());
+        for (const std::int64_t count : { std::int64_t{ 1 } << 14, std::int64_t{ 1 } << 18 })
+        {
+            for (std::int64_t threads = 1; threads < cores; threads *= 2)
+                benchmark->Args({ count, threads });
+            benchmark->Args({ count, cores });
+        }
+    }
+} // namespace
+
+
+
+/**************************************
+ *                                    *
+ *           RAY - TRIANGLE           *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Ray_Triangle_Scalar(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Ray<T>> rays = sampleRays<T>(count);
+    const std::vector<fgm::Vector3D<T>> vertices = sampleTriangles<T>();
+    std::vector<T> distances(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t r = 0; r < count; ++r)
+        {
+            distances[r] = std::numeric_limits<T>::infinity();
+            for (std::size_t v = 0; v < vertices.size(); v += 3)
+                rays[r].intersects(vertices[v], vertices[v + 1], vertices[v + 2], distances[r]);
+        }
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Ray_Triangle_Packet(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::RayPacket<T> packet(sampleRays<T>(count));
+    const std::vector<fgm::Vector3D<T>> vertices = sampleTriangles<T>();
+    std::vector<T> distances(count);
+    std::vector<std::uint64_t> hits(packet.bitsetWords());
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<T>::infinity());
+        for (std::size_t v = 0; v < vertices.size(); v += 3)
+            packet.intersect(vertices[v], vertices[v + 1], vertices[v + 2], distances, hits);
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             RAY - BOX              *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Ray_Box_Scalar(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Ray<T>> rays = sampleRays<T>(count);
+    const std::vector<fgm::AABB<T>> boxes = sampleBoxes<T>();
+    std::vector<T> distances(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t r = 0; r < count; ++r)
+        {
+            distances[r] = std::numeric_limits<T>::infinity();
+            for (const fgm::AABB<T>& box : boxes)
+                rays[r].intersects(box, distances[r]);
+        }
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Ray_Box_Packet(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::RayPacket<T> packet(sampleRays<T>(count));
+    const std::vector<fgm::AABB<T>> boxes = sampleBoxes<T>();
+    std::vector<T> distances(count);
+    std::vector<std::uint64_t> hits(packet.bitsetWords());
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<T>::infinity());
+        for (const fgm::AABB<T>& box : boxes)
+            packet.intersect(box, distances, hits);
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *            RAY - SPHERE            *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Ray_Sphere_Scalar(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::Ray<T>> rays = sampleRays<T>(count);
+    const std::vector<fgm::Sphere<T>> spheres = sampleSpheres<T>();
+    std::vector<T> distances(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t r = 0; r < count; ++r)
+        {
+            distances[r] = std::numeric_limits<T>::infinity();
+            for (const fgm::Sphere<T>& sphere : spheres)
+                rays[r].intersects(sphere, distances[r]);
+        }
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+template <typename T>
+void Ray_Sphere_Packet(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const fgm::RayPacket<T> packet(sampleRays<T>(count));
+    const std::vector<fgm::Sphere<T>> spheres = sampleSpheres<T>();
+    std::vector<T> distances(count);
+    std::vector<std::uint64_t> hits(packet.bitsetWords());
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), std::numeric_limits<T>::infinity());
+        for (const fgm::Sphere<T>& sphere : spheres)
+            packet.intersect(sphere, distances, hits);
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *                BVH                 *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void BVH_Build(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    fgm::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+    const std::vector<fgm::AABB<T>> bounds = fgm::triangleBounds<T>(sampleSoup<T>(count));
+
+    for (auto _ : state)
+    {
+        fgm::BVH<T> bvh(bounds, { .pool = &pool });
+        benchmark::DoNotOptimize(bvh.nodes().data());
+    }
+    state.counters["threads"] = static_cast<double>(pool.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+
+template <typename T>
+void BVH_Refit(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<fgm::AABB<T>> bounds = fgm::triangleBounds<T>(sampleSoup<T>(count));
+    fgm::BVH<T> bvh(bounds);
+
+    for (auto _ : state)
+    {
+        bvh.refit(bounds);
+        benchmark::DoNotOptimize(bvh.nodes().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+
+template <typename T>
+void BVH_ClosestHit(benchmark::State& state)
+{
+    const std::vector<fgm::Vector3D<T>> vertices = sampleSoup<T>(static_cast<std::size_t>(state.range(0)));
+    const fgm::BVH<T> bvh(fgm::triangleBounds<T>(vertices));
+    const fgm::TriangleIntersector<T> triangles{ vertices };
+    const std::vector<fgm::Ray<T>> rays = sampleSoupRays<T>(1024);
+
+    for (auto _ : state)
+    {
+        for (const fgm::Ray<T>& ray : rays)
+        {
+            T distance = std::numeric_limits<T>::infinity();
+            std::uint32_t primitive = 0;
+            benchmark::DoNotOptimize(bvh.closestHit(ray, triangles, distance, primitive));
+            benchmark::DoNotOptimize(distance);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rays.size()));
+}
+
+
+template <typename T>
+void BVH_AnyHit(benchmark::State& state)
+{
+    const std::vector<fgm::Vector3D<T>> vertices = sampleSoup<T>(static_cast<std::size_t>(state.range(0)));
+    const fgm::BVH<T> bvh(fgm::triangleBounds<T>(vertices));
+    const fgm::TriangleIntersector<T> triangles{ vertices };
+    const std::vector<fgm::Ray<T>> rays = sampleSoupRays<T>(1024);
+
+    for (auto _ : state)
+        for (const fgm::Ray<T>& ray : rays)
+            benchmark::DoNotOptimize(bvh.anyHit(ray, triangles, std::numeric_limits<T>::infinity()));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rays.size()));
+}
+
+
+
+/**************************************
+ *                                    *
+ *           REGISTRATION             *
+ *                                    *
+ **************************************/
+
+#define FALCON_BENCHMARK_RAYS(func, ...) BENCHMARK_TEMPLATE(func, __VA_ARGS__)->RangeMultiplier(8)->Range(64, 1 << 15)
+
+FALCON_BENCHMARK_RAYS(Ray_Triangle_Scalar, float);
+FALCON_BENCHMARK_RAYS(Ray_Triangle_Packet, float);
+FALCON_BENCHMARK_RAYS(Ray_Triangle_Scalar, double);
+FALCON_BENCHMARK_RAYS(Ray_Triangle_Packet, double);
+
+FALCON_BENCHMARK_RAYS(Ray_Box_Scalar, float);
+FALCON_BENCHMARK_RAYS(Ray_Box_Packet, float);
+FALCON_BENCHMARK_RAYS(Ray_Box_Scalar, double);
+FALCON_BENCHMARK_RAYS(Ray_Box_Packet, double);
+
+FALCON_BENCHMARK_RAYS(Ray_Sphere_Scalar, float);
+FALCON_BENCHMARK_RAYS(Ray_Sphere_Packet, float);
+FALCON_BENCHMARK_RAYS(Ray_Sphere_Scalar, double);
+FALCON_BENCHMARK_RAYS(Ray_Sphere_Packet, double);
+
+#define FALCON_BENCHMARK_BVH_BUILD(func, ...)                                                                          \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__)->Apply(buildScaling)->UseRealTime()->ArgNames({ "count", "threads" })
+#define FALCON_BENCHMARK_BVH(func, ...)                                                                                \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__)->RangeMultiplier(16)->Range(1 << 10, 1 << 18)
+
+FALCON_BENCHMARK_BVH_BUILD(BVH_Build, float);
+FALCON_BENCHMARK_BVH_BUILD(BVH_Build, double);
+
+FALCON_BENCHMARK_BVH(BVH_Refit, float);
+FALCON_BENCHMARK_BVH(BVH_Refit, double);
+
+FALCON_BENCHMARK_BVH(BVH_ClosestHit, float);
+FALCON_BENCHMARK_BVH(BVH_ClosestHit, double);
+
+FALCON_BENCHMARK_BVH(BVH_AnyHit, float);
+FALCON_BENCHMARK_BVH(BVH_AnyHit, double);
@@ -0,0 +1,171 @@
+/**
+ * @file MatrixBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times single @ref fgm::Matrix2D, @ref fgm::Matrix3D and @ref fgm::Matrix4D operations.
+ *
+ * @note The matrices have no aliases, so they are timed for the element types of the vector aliases they are used
+ *       with most: `float`, `double` and `int`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <matrix/Matrix2D.h>
+#include <matrix/Matrix3D.h>
+#include <matrix/Matrix4D.h>
+#include <type_traits>
+#include <utility>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/** @brief Number of rows and columns of a matrix type. */
+template <typename Mat>
+inline constexpr std::size_t order = 0;
+
+template <typename T>
+inline constexpr std::size_t order<fgm::Matrix2D<T>> = 2;
+
+template <typename T>
+inline constexpr std::size_t order<fgm::Matrix3D<T>> = 3;
+
+template <typename T>
+inline constexpr std::size_t order<fgm::Matrix4D<T>> = 4;
+
+
+/** @brief Column vector type of a matrix type. */
+template <typename Mat>
+using ColumnOf = std::remove_cvref_t<decltype(std::declval<const Mat&>()[0])>;
+
+
+template <typename Mat>
+[[nodiscard]] Mat sample(const int seed = 0)
+{
+    return sampleMatrix<Mat, order<Mat>>(seed);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             ARITHMETIC             *
+ *                                    *
+ **************************************/
+
+template <typename Mat>
+void Matrix_Add(benchmark::State& state)
+{
+    measure(state, [](const Mat& lhs, const Mat& rhs) { return lhs + rhs; }, sample<Mat>(0), sample<Mat>(1));
+}
+
+
+template <typename Mat>
+void Matrix_Subtract(benchmark::State& state)
+{
+    measure(state, [](const Mat& lhs, const Mat& rhs) { return lhs - rhs; }, sample<Mat>(1), sample<Mat>(0));
+}
+
+
+template <typename Mat>
+void Matrix_Scale(benchmark::State& state)
+{
+    using T = typename Mat::value_type;
+    measure(state, [](const Mat& mat, const T scalar) { return mat * scalar; }, sample<Mat>(), T(3));
+}
+
+
+
+/**************************************
+ *                                    *
+ *              PRODUCTS              *
+ *                                    *
+ **************************************/
+
+template <typename Mat>
+void Matrix_MultiplyVector(benchmark::State& state)
+{
+    using Vec = ColumnOf<Mat>;
+    measure(state, [](const Mat& mat, const Vec& vec) { return mat * vec; }, sample<Mat>(), sampleVector<Vec>());
+}
+
+
+template <typename Mat>
+void Matrix_MultiplyMatrix(benchmark::State& state)
+{
+    measure(state, [](const Mat& lhs, const Mat& rhs) { return lhs * rhs; }, sample<Mat>(0), sample<Mat>(1));
+}
+
+
+
+/**************************************
+ *                                    *
+ *         MATRIX OPERATIONS          *
+ *                                    *
+ **************************************/
+
+template <typename Mat>
+void Matrix_Determinant(benchmark::State& state)
+{
+    measure(state, [](const Mat& mat) { return mat.determinant(); }, sample<Mat>());
+}
+
+
+template <typename Mat>
+void Matrix_Transpose(benchmark::State& state)
+{
+    measure(state, [](const Mat& mat) { return mat.transpose(); }, sample<Mat>());
+}
+
+
+template <typename Mat>
+void Matrix_Inverse(benchmark::State& state)
+{
+    measure(state, [](const Mat& mat) { return mat.inverse(); }, sample<Mat>());
+}
+
+
+
+/**************************************
+ *                                    *
+ *            REGISTRATION            *
+ *                                    *
+ **************************************/
+
+// Ops every matrix supports, registered for every element type.
+#define FALCON_BENCHMARK_MATRIX_OPS(Mat)                                                                               \
+    BENCHMARK_TEMPLATE(Matrix_Add, Mat);                                                                               \
+    BENCHMARK_TEMPLATE(Matrix_Subtract, Mat);                                                                          \
+    BENCHMARK_TEMPLATE(Matrix_Scale, Mat);                                                                             \
+    BENCHMARK_TEMPLATE(Matrix_MultiplyVector, Mat);                                                                    \
+    BENCHMARK_TEMPLATE(Matrix_MultiplyMatrix, Mat);                                                                    \
+    BENCHMARK_TEMPLATE(Matrix_Determinant, Mat);                                                                       \
+    BENCHMARK_TEMPLATE(Matrix_Transpose, Mat)
+
+// Inverses are only meaningful, and for Matrix4D only defined, on floating point matrices.
+#define FALCON_BENCHMARK_FLOATING_MATRIX_OPS(Mat)                                                                      \
+    FALCON_BENCHMARK_MATRIX_OPS(Mat);                                                                                  \
+    BENCHMARK_TEMPLATE(Matrix_Inverse, Mat)
+
+
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix2D<float>);
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix2D<double>);
+FALCON_BENCHMARK_MATRIX_OPS(fgm::Matrix2D<int>);
+
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix3D<float>);
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix3D<double>);
+FALCON_BENCHMARK_MATRIX_OPS(fgm::Matrix3D<int>);
+
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix4D<float>);
+FALCON_BENCHMARK_FLOATING_MATRIX_OPS(fgm::Matrix4D<double>);
+FALCON_BENCHMARK_MATRIX_OPS(fgm::Matrix4D<int>);
@@ -0,0 +1,165 @@
+/**
+ * @file ParallelBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times batch transforms and normalizations split by @ref fgm::parallel::for_each_chunk over 1 to N threads.
+ *
+ * @note The second argument is the thread count, doubling up to `std::thread::hardware_concurrency()`. One thread
+ *       runs the same chunks on the calling thread, so the ratio against it is the scaling of the pool alone. Inputs
+ *       are sized well past the last-level cache, where a single core no longer saturates memory bandwidth.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <cstdint>
+#include <matrix/Matrix4DBatch.h>
+#include <parallel/Parallel.h>
+#include <span>
+#include <thread>
+#include <vector/Vec4Array.h>
+#include <vector>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+namespace
+{
+    /** @brief @p count distinct, non-zero vectors. */
+    template <typename T>
+    [[nodiscard]] std::vector<fgm::Vector4D<T>> sampleVectors(const std::size_t count)
+    {
+        std::vector<fgm::Vector4D<T>> vectors;
+        vectors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            vectors.push_back(sampleVector<fgm::Vector4D<T>>(static_cast<int>(i % 64)));
+        return vectors;
+    }
+
+
+    /** @brief Chunking on @p pool, reported alongside the timings. */
+    fgm::parallel::ChunkOptions chunkOptions(benchmark::State& state, fgm::parallel::ThreadPool& pool)
+    {
+        state.counters["threads"] = static_cast<double>(pool.size());
+        fgm::parallel::ChunkOptions options;
+        options.pool = &pool;
+        return options;
+    }
+
+
+    /** @brief Vector counts from 1 MiB to 64 MiB of `float` vectors, for every thread count up to the core count. */
+    void threadScaling(benchmark::internal::Benchmark* benchmark)
+    {
+        const auto cores = static_cast<std::int64_t>(fgm::parallel::ThreadPool::defaultThreadCount());
+        for (const std::int64_t count : { std::int64_t{ 1 } << 16, std::int64_t{ 1 } << 22 })
+        {
+            for (std::int64_t threads = 1; threads < cores; threads *= 2)
+                benchmark->Args({ count, threads });
+            benchmark->Args({ count, cores });
+        }
+    }
+
+
+    /** @brief Report throughput in vectors per second. */
+    void setProcessed(benchmark::State& state, const std::size_t count)
+    {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+} // namespace
+
+
+
+/**************************************
+ *                                    *
+ *             TRANSFORM              *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Parallel_Transform_Packed(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    fgm::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+    const fgm::parallel::ChunkOptions options = chunkOptions(state, pool);
+
+    const auto matrix = sampleMatrix<fgm::Matrix4D<T>, 4>();
+    const std::vector<fgm::Vector4D<T>> vectors = sampleVectors<T>(count);
+    std::vector<fgm::Vector4D<T>> out(count);
+
+    for (auto _ : state)
+    {
+        fgm::parallel::for_each_chunk(
+            std::span<const fgm::Vector4D<T>>(vectors),
+            [&](const std::span<const fgm::Vector4D<T>> chunk, const fgm::parallel::ChunkRange& range)
+            { fgm::transform(matrix, chunk, std::span(out).subspan(range.begin, range.size())); },
+            options);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             NORMALIZE              *
+ *                                    *
+ **************************************/
+
+template <typename T>
+void Parallel_Normalize_Vec4Array(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    fgm::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+    const fgm::parallel::ChunkOptions options = chunkOptions(state, pool);
+
+    const fgm::Vec4Array<T> vectors(sampleVectors<T>(count));
+    fgm::Vec4Array<T> out(count);
+    const falcon::simd::Vec4Streams<T> outStreams = out.streams();
+    const auto& kernels = falcon::simd::batchKernels().get<T>().vec4;
+
+    for (auto _ : state)
+    {
+        fgm::parallel::for_each_chunk(
+            vectors.streams(), count,
+            [&](const falcon::simd::Vec4Streams<const T> chunk, const fgm::parallel::ChunkRange& range)
+            {
+                const std::size_t b = range.begin;
+                kernels.normalize(chunk, fgm::Precision::Exact,
+                                  { outStreams.x + b, outStreams.y + b, outStreams.z + b, outStreams.w + b },
+                                  range.size());
+            },
+            options);
+        benchmark::DoNotOptimize(out.x().data());
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, count);
+}
+
+
+
+/**************************************
+ *                                    *
+ *           REGISTRATION             *
+ *                                    *
+ **************************************/
+
+#define FALCON_BENCHMARK_PARALLEL(func, ...)                                                                           \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__)->Apply(threadScaling)->UseRealTime()->ArgNames({ "count", "threads" })
+
+FALCON_BENCHMARK_PARALLEL(Parallel_Transform_Packed, float);
+FALCON_BENCHMARK_PARALLEL(Parallel_Transform_Packed, double);
+
+FALCON_BENCHMARK_PARALLEL(Parallel_Normalize_Vec4Array, float);
+FALCON_BENCHMARK_PARALLEL(Parallel_Normalize_Vec4Array, double);
@@ -0,0 +1,143 @@
+/**
+ * @file VectorBenchmarks.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Times single @ref fgm::Vector2D, @ref fgm::Vector3D and @ref fgm::Vector4D operations for every alias.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BenchmarkSetup.h"
+
+#include <vector/Vector2D.h>
+#include <vector/Vector3D.h>
+#include <vector/Vector4D.h>
+
+
+using namespace benchutils;
+
+
+/**************************************
+ *                                    *
+ *             ARITHMETIC             *
+ *                                    *
+ **************************************/
+
+template <typename Vec>
+void Vector_Add(benchmark::State& state)
+{
+    measure(state, [](const Vec& lhs, const Vec& rhs) { return lhs + rhs; }, sampleVector<Vec>(0),
+            sampleVector<Vec>(4));
+}
+
+
+template <typename Vec>
+void Vector_Subtract(benchmark::State& state)
+{
+    measure(state, [](const Vec& lhs, const Vec& rhs) { return lhs - rhs; }, sampleVector<Vec>(4),
+            sampleVector<Vec>(0));
+}
+
+
+template <typename Vec>
+void Vector_Scale(benchmark::State& state)
+{
+    using T = typename Vec::value_type;
+    measure(state, [](const Vec& vec, const T scalar) { return vec * scalar; }, sampleVector<Vec>(), T(3));
+}
+
+
+template <typename Vec>
+void Vector_Divide(benchmark::State& state)
+{
+    using T = typename Vec::value_type;
+    measure(state, [](const Vec& vec, const T scalar) { return vec / scalar; }, sampleVector<Vec>(), T(2));
+}
+
+
+
+/**************************************
+ *                                    *
+ *              GEOMETRY              *
+ *                                    *
+ **************************************/
+
+template <typename Vec>
+void Vector_Dot(benchmark::State& state)
+{
+    measure(state, [](const Vec& lhs, const Vec& rhs) { return lhs.dot(rhs); }, sampleVector<Vec>(0),
+            sampleVector<Vec>(4));
+}
+
+
+template <typename Vec>
+void Vector_Cross(benchmark::State& state)
+{
+    measure(state, [](const Vec& lhs, const Vec& rhs) { return lhs.cross(rhs); }, sampleVector<Vec>(0),
+            sampleVector<Vec>(4));
+}
+
+
+template <typename Vec>
+void Vector_Mag(benchmark::State& state)
+{
+    measure(state, [](const Vec& vec) { return vec.mag(); }, sampleVector<Vec>());
+}
+
+
+template <typename Vec>
+void Vector_Normalize(benchmark::State& state)
+{
+    measure(state, [](const Vec& vec) { return vec.normalize(); }, sampleVector<Vec>());
+}
+
+
+template <typename Vec>
+void Vector_Project(benchmark::State& state)
+{
+    measure(state, [](const Vec& vec, const Vec& onto) { return vec.project(onto); }, sampleVector<Vec>(0),
+            sampleVector<Vec>(4));
+}
+
+
+
+/**************************************
+ *                                    *
+ *            REGISTRATION            *
+ *                                    *
+ **************************************/
+
+// Ops every vector supports, registered for every arithmetic alias.
+#define FALCON_BENCHMARK_VECTOR_OPS(Vec)                                                                               \
+    BENCHMARK_TEMPLATE(Vector_Add, Vec);                                                                               \
+    BENCHMARK_TEMPLATE(Vector_Subtract, Vec);                                                                          \
+    BENCHMARK_TEMPLATE(Vector_Scale, Vec);                                                                             \
+    BENCHMARK_TEMPLATE(Vector_Divide, Vec);                                                                            \
+    BENCHMARK_TEMPLATE(Vector_Dot, Vec);                                                                               \
+    BENCHMARK_TEMPLATE(Vector_Mag, Vec);                                                                               \
+    BENCHMARK_TEMPLATE(Vector_Normalize, Vec)
+
+// Ops that only make sense on floating point vectors.
+#define FALCON_BENCHMARK_FLOATING_VECTOR_OPS(Vec)                                                                      \
+    FALCON_BENCHMARK_VECTOR_OPS(Vec);                                                                                  \
+    BENCHMARK_TEMPLATE(Vector_Project, Vec)
+
+
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::vec2);
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::dvec2);
+BENCHMARK_TEMPLATE(Vector_Cross, fgm::vec2);
+BENCHMARK_TEMPLATE(Vector_Cross, fgm::dvec2);
+
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::vec3);
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::dvec3);
+BENCHMARK_TEMPLATE(Vector_Cross, fgm::vec3);
+BENCHMARK_TEMPLATE(Vector_Cross, fgm::dvec3);
+
+FALCON_BENCHMARK_VECTOR_OPS(fgm::iVec4);
+FALCON_BENCHMARK_VECTOR_OPS(fgm::uVec4);
+FALCON_BENCHMARK_VECTOR_OPS(fgm::lVec4);
+FALCON_BENCHMARK_VECTOR_OPS(fgm::ulVec4);
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::vec4);
+FALCON_BENCHMARK_FLOATING_VECTOR_OPS(fgm::dVec4);
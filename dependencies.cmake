@@ -8,17 +8,44 @@ FetchContent_Declare(
     GIT_TAG 52eb8108c5bdec04579160ae17225d66034bd723 # release-1.17.0
     SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/vendors/googletest"
     SYSTEM
+    FIND_PACKAGE_ARGS NAMES GTest # Prefer an installed GoogleTest (offline builds)
 )
 
 FetchContent_MakeAvailable(googletest)
 
 # Group google_test projects into a "Gtest" folder
-set_target_properties(
-    gtest gtest_main gmock gmock_main
-    PROPERTIES FOLDER "Google Test"
+if(TARGET gtest) # Only present when built from source
+    set_target_properties(
+        gtest gtest_main gmock gmock_main
+        PROPERTIES FOLDER "Google Test"
+    )
+
+    if(MSVC)
+        target_compile_options(gtest PRIVATE /WX- /W0)
+        target_compile_options(gtest_main PRIVATE /WX- /W0)
+    endif()
+endif()
+
+
+# Google Benchmark
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE) # Its own tests would pull in a second googletest
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG v1.9.1
+    SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/vendors/benchmark"
+    SYSTEM
+    FIND_PACKAGE_ARGS NAMES benchmark # Prefer an installed Google Benchmark (offline builds)
 )
 
-if(MSVC)
-    target_compile_options(gtest PRIVATE /WX- /W0)
-    target_compile_options(gtest_main PRIVATE /WX- /W0)
-endif()
\ No newline at end of file
+FetchContent_MakeAvailable(googlebenchmark)
+
+if(TARGET benchmark) # Only present when built from source
+    set_target_properties(
+        benchmark benchmark_main
+        PROPERTIES FOLDER "Google Benchmark"
+    )
+endif()
@@ -82,6 +82,7 @@
              *   @defgroup FGM_Vec4_Bitwise Boolean Bitwise Operations
              *   @defgroup FGM_Vec4_Equality Equality
              *   @defgroup FGM_Vec4_Comparison Comparisons
+             *   @defgroup FGM_Vec4_Mask Lane Masks
              *   @defgroup FGM_Vec4_Product Geometric Products
              *   @defgroup FGM_Vec4_Mag Scalar Magnitude and Normalization
              *   @defgroup FGM_Vec4_Proj Vector Projection and Rejection
@@ -91,8 +92,145 @@
              * @}
              */
 
+            /**
+             * @defgroup FGM_PVec3 Padded 3D Vectors
+             * @brief 3-dimensional vectors padded to four lanes for register loads, and tight stream conversion.
+             * @ingroup FGM_Vectors
+             * @{
+             *   @defgroup FGM_PVec3_Members Class Members
+             *   @defgroup FGM_PVec3_Init Accessors and Initializers
+             *   @defgroup FGM_PVec3_Arithmetic Arithmetic Operations
+             *   @defgroup FGM_PVec3_Product Geometric Products
+             *   @defgroup FGM_PVec3_Pack Packing and Unpacking
+             *   @defgroup FGM_PVec3_Alias Spatial Alias
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_Vec4Array 4D Vector Arrays
+             * @brief Structure-of-arrays containers of 4D vectors with runtime dispatched batch operations.
+             * @ingroup FGM_Vectors
+             * @{
+             *   @defgroup FGM_Vec4Array_Members Class Members
+             *   @defgroup FGM_Vec4Array_Init Accessors and Initializers
+             *   @defgroup FGM_Vec4Array_Arithmetic Arithmetic Operations
+             *   @defgroup FGM_Vec4Array_Geometry Geometric Operations
+             *   @defgroup FGM_Vec4Array_Equality Batched Equality
+             *   @defgroup FGM_Vec4Array_Alias Aliases
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_Vec_Reduce Vector Reductions
+             * @brief Bounds, sums, means and distance extremes of whole buffers of vectors, across threads.
+             * @ingroup FGM_Vectors
+             */
+
+            /**
+             * @defgroup FGM_Vec_Quantize Vector Quantization
+             * @brief SNORM, UNORM, 10:10:10:2 and octahedral encodings of vectors and of whole streams of them.
+             * @ingroup FGM_Vectors
+             */
+
         /** @} */ // FGM_Vectors
 
+        /**
+         * @defgroup FGM_Matrices Matrices
+         * @brief Square matrix implementations.
+         * @ingroup FGM_Math
+         * @{
+         */
+
+            /**
+             * @defgroup FGM_Mat4_Batch 4D Matrix Batch Transforms
+             * @brief Transform whole vector buffers by one 4x4 matrix with runtime dispatched kernels.
+             * @ingroup FGM_Matrices
+             */
+
+            /**
+             * @defgroup FGM_Affine3_Batch 3D Affine Batch Transforms
+             * @brief Transform whole vector buffers by one 3x4 affine transformation with runtime dispatched kernels.
+             * @ingroup FGM_Matrices
+             */
+
+        /** @} */ // FGM_Matrices
+
+        /**
+         * @defgroup FGM_Quaternions Quaternions
+         * @brief Rotation types.
+         * @ingroup FGM_Core
+         * @{
+         */
+
+            /**
+             * @defgroup FGM_Quat Quaternions
+             * @brief Unit quaternions representing 3D rotations, sharing the register layout of 4D vectors.
+             * @ingroup FGM_Quaternions
+             * @{
+             *   @defgroup FGM_Quat_Members Class Members
+             *   @defgroup FGM_Quat_Init Initializers and Conversions
+             *   @defgroup FGM_Quat_Access Accessors and Matrices
+             *   @defgroup FGM_Quat_Arithmetic Arithmetic Operations
+             *   @defgroup FGM_Quat_Rotation Rotation
+             *   @defgroup FGM_Quat_Interpolation Interpolation
+             *   @defgroup FGM_Quat_Alias Aliases
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_Quat_Batch Quaternion Batch Interpolation
+             * @brief Interpolate whole rotation buffers with runtime dispatched kernels.
+             * @ingroup FGM_Quaternions
+             */
+
+        /** @} */ // FGM_Quaternions
+
+        /**
+         * @defgroup FGM_Geometry Geometry
+         * @brief Planes, bounding volumes, view frustums, rays and bounding volume hierarchies.
+         * @ingroup FGM_Core
+         * @{
+         */
+
+            /**
+             * @defgroup FGM_Geometry_Primitives Planes and Bounding Volumes
+             * @brief Planes, axis-aligned boxes, spheres and the frustum of a view-projection matrix.
+             * @ingroup FGM_Geometry
+             */
+
+            /**
+             * @defgroup FGM_Geometry_Culling Frustum Culling
+             * @brief Cull whole structure-of-arrays buffers of spheres and boxes with runtime dispatched kernels.
+             * @ingroup FGM_Geometry
+             */
+
+            /**
+             * @defgroup FGM_Geometry_Rays Rays and Ray Packets
+             * @brief Ray intersection with triangles, boxes and spheres, one ray or a structure-of-arrays packet at a
+             *        time.
+             * @ingroup FGM_Geometry
+             */
+
+            /**
+             * @defgroup FGM_Geometry_BVH Bounding Volume Hierarchies
+             * @brief Four-wide bounding volume hierarchies with closest-hit and any-hit ray queries.
+             * @ingroup FGM_Geometry
+             */
+
+        /** @} */ // FGM_Geometry
+
+        /**
+         * @defgroup FGM_Expr Expression Templates
+         * @brief Lazy vector and matrix arithmetic evaluated in one fused pass.
+         * @ingroup FGM_Core
+         */
+
+        /**
+         * @defgroup FGM_Parallel Parallel Batches
+         * @brief Work-stealing thread pool and cache-sized chunking of batch operations across cores.
+         * @ingroup FGM_Core
+         */
+
     /** @} */ // End of FGM_Core
 
     /**
@@ -110,6 +248,18 @@
      * @ingroup FGM_Math
      */
 
+    /**
+     * @defgroup FGM_Math_Functions Constant-Evaluable Functions
+     * @brief Square roots, absolute values and NaN tests usable in constant expressions.
+     * @ingroup FGM_Math
+     */
+
+    /**
+     * @defgroup FGM_Half Half Precision
+     * @brief Half precision storage type computing in float, and bulk conversion of buffers with F16C.
+     * @ingroup FGM_Math
+     */
+
     /**
      * @defgroup FGM_Math_Constants Library Constants
      * @brief Constants defined in FGM.
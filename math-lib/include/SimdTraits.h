@@ -1,68 +1,99 @@
 #pragma once
+/**
+ * @file SimdTraits.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: March 07, 2026
+ *
+ * @brief Alignment and register traits mapping FGM vector types onto SIMD registers.
+ *
+ * @note `alignment` only depends on the byte size of the vector, so the memory layout of a type is identical in
+ *       SIMD, `FORCE_*` and `FORCE_SCALAR` builds. Only `reg_type` availability changes with the configuration.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <SIMD.h>
 #include <cstddef>
 
-namespace math
+
+namespace fgm
 {
 
-    // Dimension defines the dimension of the vector or matrix using SimdTrait,
-    // Eg, for Vec4 it is 4
+    /**
+     * @brief Layout-only traits shared by every @ref SimdTraits specialization.
+     *
+     * @tparam T         Type of the vector components.
+     * @tparam Dimension Number of components in the vector. E.g. 4 for @ref Vector4D.
+     */
     template <typename T, std::size_t Dimension>
-    struct SimdTraits
+    struct SimdLayout
     {
-        static constexpr std::size_t alignment = sizeof(T);
+        /** @brief Size of the packed vector in bytes. */
+        static constexpr std::size_t byteSize = sizeof(T) * Dimension;
+
+        /** @brief Alignment of the vector. Register-sized vectors (16 or 32 bytes) are aligned to their size. */
+        static constexpr std::size_t alignment = (byteSize == 16 || byteSize == 32) ? byteSize : alignof(T);
     };
 
-#ifndef FORCE_NO_SIMD
-    #include <emmintrin.h>
-    #include <immintrin.h>
-    #if defined(__AVX__) || defined(__AVX2__)
-        #include <xmmintrin.h>
-
-        #define AVX_SUPPORTED
-        #define SIMD_SUPPORTED
-    #elif defined(__SSE__) || defined(__SSE4_1__) || defined(_M_X64)
-        #define SSE_SUPPORTED
-        #define SIMD_SUPPORTED
-    #endif
 
-    #ifdef SIMD_SUPPORTED
+    /**
+     * @brief Maps a `Dimension`-wide vector of `T` onto the SIMD hardware.
+     * @details Specializations expose a `reg_type` alias when the vector fits a register of the enabled instruction
+     *          set. The primary template only describes the memory layout.
+     *
+     * @tparam T         Type of the vector components.
+     * @tparam Dimension Number of components in the vector. E.g. 4 for @ref Vector4D.
+     */
+    template <typename T, std::size_t Dimension>
+    struct SimdTraits: SimdLayout<T, Dimension>
+    {};
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+
     template <>
-    struct SimdTraits<float, 4>
+    struct SimdTraits<float, 4>: SimdLayout<float, 4>
     {
-        static constexpr std::size_t alignment = 16; // 16 bit aligned
         using reg_type = __m128;
     };
 
     template <>
-    struct SimdTraits<int, 4>
+    struct SimdTraits<int, 4>: SimdLayout<int, 4>
     {
-        static constexpr std::size_t alignment = 16; // 16 bit aligned
         using reg_type = __m128i;
     };
 
     template <>
-    struct SimdTraits<double, 4>
+    struct SimdTraits<double, 4>: SimdLayout<double, 4>
     {
-        #ifdef AVX_SUPPORTED
-        static constexpr std::size_t alignment = 32; // 32 bit aligned
+    #ifdef FALCON_AVX_SUPPORTED
         using reg_type = __m256d;
-        #else
-        static constexpr std::size_t alignment = 16; // 16 bit aligned
-        using reg_type = __m128d;
-        #endif
+    #else
+        using reg_type = __m128d; // Two registers per vector, see detail::Double4
+    #endif
     };
 
     template <>
-    struct SimdTraits<std::size_t, 4>
+    struct SimdTraits<long long, 4>: SimdLayout<long long, 4>
     {
-        #ifdef AVX_SUPPORTED
-        static constexpr std::size_t alignment = 32; // 32 bit aligned
+    #ifdef FALCON_AVX2_SUPPORTED
         using reg_type = __m256i;
-        #else
-        static constexpr std::size_t alignment = 16; // 16 bit aligned
-        using reg_type = __m128i;
-        #endif
+    #else
+        using reg_type = __m128i; // Two registers per vector, see detail::Long4
+    #endif
     };
+
+    template <>
+    struct SimdTraits<std::size_t, 4>: SimdLayout<std::size_t, 4>
+    {
+    #ifdef FALCON_AVX_SUPPORTED
+        using reg_type = __m256i;
+    #else
+        using reg_type = __m128i;
     #endif
+    };
+
 #endif
-} // namespace math
+
+} // namespace fgm
@@ -10,6 +10,10 @@
  */
 
 
+#include <Precision.h>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
 
 
 namespace fgm
@@ -65,8 +69,39 @@ namespace fgm
         template <typename T>
             requires std::floating_point<T>
         static constexpr T EPSILON_SQUARE = std::is_same_v<T, double> ? 1e-24 : 1e-10;
+
+
+
+        /**************************************
+         *                                    *
+         *           MEMORY TUNING            *
+         *                                    *
+         **************************************/
+
+        /**
+         * @brief Output size in bytes above which batch operations default to non-temporal stores.
+         * @details Roughly the last-level cache share of one core; larger outputs would evict their own inputs.
+         */
+        static constexpr std::size_t STREAMING_STORE_THRESHOLD = std::size_t(4) << 20;
+
+        /**
+         * @brief Input bytes per chunk of a parallel batch operation.
+         * @details Half of a typical per-core L2 cache, so a chunk's inputs and outputs stay in the cache of the core
+         *          running it.
+         */
+        static constexpr std::size_t PARALLEL_CHUNK_BYTES = std::size_t(64) << 10;
+
+        /** @brief Input size in bytes below which parallel batch operations run on the calling thread. */
+        static constexpr std::size_t PARALLEL_THRESHOLD = std::size_t(256) << 10;
     };
 
+
+    /** @brief Accuracy tier of normalization, with the error bounds documented on @ref falcon::simd::Precision. */
+    using falcon::simd::Precision;
+
+    /** @brief Accumulation of reductions, with the error growth documented on @ref falcon::simd::Summation. */
+    using falcon::simd::Summation;
+
     /** @} */
 
 } // namespace fgm
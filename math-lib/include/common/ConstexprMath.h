@@ -0,0 +1,222 @@
+#pragma once
+/**
+ * @file ConstexprMath.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Square roots, absolute values and NaN tests usable in constant expressions.
+ *
+ * @details `std::sqrt`, `std::abs` and `std::isnan` are not `constexpr` before C++23/26, which keeps lookup tables,
+ *          camera bases and constant transforms from being baked at compile time. The functions here take the
+ *          hardware path (`sqrtss`/`sqrtsd`, `rsqrtss`) at run time and switch to integer arithmetic only when
+ *          `std::is_constant_evaluated()` is true.
+ *
+ *          @ref fgm::sqrt is correctly rounded on both paths, so a value baked at compile time is bit-identical to the
+ *          one computed at run time. @ref fgm::rsqrt is as well at @ref Precision::Exact; its approximate tiers have no
+ *          hardware estimate to reproduce during constant evaluation and return the exact result there instead.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Config.h"
+#include "MathTraits.h"
+
+#include <SIMD.h>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Unsigned integer with the size of the floating point type `T`. */
+        template <std::floating_point T>
+        using FloatBits = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+
+        /**
+         * @brief Correctly rounded square root of a positive, finite, non-zero @p value, using integer arithmetic only.
+         * @details The significand is scaled to a radicand of `2 * digits + 1` or `2 * digits + 2` bits, leaving an
+         *          even exponent to halve. A restoring digit-by-digit root then produces `digits + 1` bits of the root,
+         *          one per step; the last bit rounds and the remainder breaks the tie, which yields the round to
+         *          nearest even result of an IEEE 754 square root.
+         *
+         * @tparam T `float` or `double`.
+         */
+        template <std::floating_point T>
+            requires(std::numeric_limits<T>::is_iec559 && sizeof(T) <= sizeof(std::uint64_t))
+        [[nodiscard]] constexpr T sqrtBits(const T value) noexcept
+        {
+            using Bits = FloatBits<T>;
+            constexpr int digits = std::numeric_limits<T>::digits; // Significand bits, including the hidden one
+            constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+            constexpr std::uint64_t hidden = std::uint64_t(1) << (digits - 1);
+
+            const Bits bits = std::bit_cast<Bits>(value);
+            const int field = static_cast<int>(bits >> (digits - 1)); // The sign bit is clear
+            std::uint64_t significand = bits & (hidden - 1);
+
+            // value = significand * 2^exponent, with the hidden bit of subnormals restored by normalizing.
+            int exponent = field - bias - (digits - 1);
+            if (field == 0)
+            {
+                exponent = 1 - bias - (digits - 1);
+                while (significand < hidden)
+                {
+                    significand <<= 1;
+                    --exponent;
+                }
+            }
+            else
+                significand |= hidden;
+
+            // radicand = significand * 2^shift lies in [2^(2 * digits), 2^(2 * digits + 2)), so its root has
+            // digits + 1 bits, and exponent - shift is even.
+            const int shift = (exponent - digits - 1) % 2 == 0 ? digits + 1 : digits + 2;
+
+            std::uint64_t root = 0;
+            std::uint64_t remainder = 0;
+            for (int pair = digits; pair >= 0; --pair)
+            {
+                // Bits 2 * pair + 1 and 2 * pair of the radicand; everything below the significand is zero.
+                const int low = 2 * pair - shift;
+                const std::uint64_t next = low >= 0 ? (significand >> low) & 3u
+                    : low == -1                     ? (significand << 1) & 3u
+                                                    : 0u;
+
+                remainder = (remainder << 2) | next;
+                const std::uint64_t trial = (root << 2) | 1u;
+                root <<= 1;
+                if (remainder >= trial)
+                {
+                    remainder -= trial;
+                    root |= 1u;
+                }
+            }
+
+            // Round to nearest even. A square root is never exactly halfway, but the tie is handled regardless.
+            std::uint64_t rounded = root >> 1;
+            if ((root & 1u) != 0 && (remainder != 0 || (rounded & 1u) != 0))
+                ++rounded;
+
+            int resultExponent = (exponent - shift) / 2 + 1;
+            if (rounded == hidden << 1)
+            {
+                rounded >>= 1;
+                ++resultExponent;
+            }
+
+            // The root of any positive finite value is a normal number.
+            const auto resultField = static_cast<Bits>(resultExponent + bias + (digits - 1));
+            return std::bit_cast<T>(static_cast<Bits>((resultField << (digits - 1)) | (rounded - hidden)));
+        }
+    } // namespace detail
+
+
+    /**
+     * @addtogroup FGM_Math_Functions
+     * @{
+     */
+
+    /**
+     * @brief `true` if @p value is NaN.
+     * @note Relies on NaN comparing unequal to itself, so it must not be compiled with `-ffast-math`.
+     */
+    template <std::floating_point T>
+    [[nodiscard]] constexpr bool isnan(const T value) noexcept
+    {
+        return value != value;
+    }
+
+
+    /** @brief Absolute value of @p value. `-0` maps to `+0` and NaN stays NaN. */
+    template <StrictArithmetic T>
+    [[nodiscard]] constexpr T abs(const T value) noexcept
+    {
+        if constexpr (std::is_unsigned_v<T>)
+            return value;
+        else
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                if (!std::is_constant_evaluated())
+                    return std::abs(value);
+            }
+            return value < T(0) ? T(-value) : value == T(0) ? T(0) : value;
+        }
+    }
+
+
+    /**
+     * @brief Correctly rounded square root of @p value.
+     * @details Runs `std::sqrt` at run time and @ref detail::sqrtBits during constant evaluation. Both round to
+     *          nearest even, so the two paths agree bit for bit, NaN, infinity and signed zero included.
+     *
+     * @param[in] value Radicand. Integers are widened to `double`, like `std::sqrt`.
+     *
+     * @return The root in @ref Magnitude of `T`, or NaN for a negative @p value.
+     */
+    template <StrictArithmetic T>
+    [[nodiscard]] constexpr Magnitude<T> sqrt(const T value) noexcept
+    {
+        using M = Magnitude<T>;
+        const M radicand = static_cast<M>(value);
+
+        if (!std::is_constant_evaluated())
+            return std::sqrt(radicand);
+
+        if (fgm::isnan(radicand) || radicand == M(0) || radicand == std::numeric_limits<M>::infinity())
+            return radicand;
+        if (radicand < M(0))
+            return std::numeric_limits<M>::quiet_NaN();
+        return detail::sqrtBits(radicand);
+    }
+
+
+    /**
+     * @brief Reciprocal square root of @p value, $ 1 / \sqrt{a} $, to the accuracy of @p P.
+     * @details @ref Precision::Exact divides one by @ref fgm::sqrt on every path. At run time the approximate tiers of
+     *          a `float` start from the `rsqrtss` estimate (`rsqrt14ss` with AVX-512), with one Newton-Raphson step
+     *          for @ref Precision::Refined, exactly like the lane-wise `rsqrt` kernel of @ref Vector4D. `double` has
+     *          no estimate below AVX-512 and, like that kernel, always divides.
+     *
+     * @tparam P Accuracy tier. Constant evaluation always computes the @ref Precision::Exact result.
+     */
+    template <Precision P = Precision::Exact, StrictArithmetic T>
+    [[nodiscard]] constexpr Magnitude<T> rsqrt(const T value) noexcept
+    {
+        using M = Magnitude<T>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (P != Precision::Exact && std::is_same_v<M, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const __m128 reg = _mm_set_ss(static_cast<float>(value));
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512VL__)
+                const __m128 estimate = _mm_rsqrt14_ss(reg, reg);
+#else
+                const __m128 estimate = _mm_rsqrt_ss(reg);
+#endif
+                if constexpr (P == Precision::Fast)
+                    return _mm_cvtss_f32(estimate);
+                else
+                {
+                    const __m128 halfSquare = _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), reg), estimate);
+                    const __m128 step = _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(halfSquare, estimate));
+                    return _mm_cvtss_f32(_mm_mul_ss(estimate, step));
+                }
+            }
+        }
+#endif
+        return M(1) / fgm::sqrt(value);
+    }
+
+    /** @} */
+
+} // namespace fgm
@@ -0,0 +1,183 @@
+#pragma once
+/**
+ * @file Half.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief IEEE 754 half precision storage type, and bulk conversion of buffers between `float` and half precision.
+ *
+ * @details @ref fgm::half stores 16 bits and computes nothing itself: it converts implicitly to and from `float`, so
+ *          arithmetic on it runs in `float` and rounds back on assignment. That makes it an @ref fgm::Arithmetic
+ *          component type, and @ref fgm::Vector4D "Vector4D<half>" or @ref fgm::Vector2D "Vector2D<half>" halve the
+ *          memory traffic of vertex and animation data while their operators compute in `float`. Mixing `half` with
+ *          another type yields the type `float` would (`std::common_type`), so `Vector4D<half> + Vector4D<float>` is
+ *          a `Vector4D<float>`.
+ *
+ *          Converting one value at a time costs a few integer operations; @ref fgm::toHalf and @ref fgm::toFloat
+ *          convert whole buffers with the runtime dispatched F16C kernels instead, eight or sixteen values per
+ *          instruction. Every path rounds to nearest even and gives identical bits.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <HalfFloat.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Half
+     * @{
+     */
+
+    /** @brief IEEE 754 binary16 number: 1 sign, 5 exponent and 10 mantissa bits, storage only. */
+    class half
+    {
+        public:
+        /** @brief Initialize to positive zero. */
+        constexpr half() noexcept = default;
+
+        /** @brief Round @p value to the nearest half, ties to even. See @ref falcon::simd::floatToHalf. */
+        constexpr half(float value) noexcept;
+
+        /** @brief Exact `float` value of the half. */
+        constexpr operator float() const noexcept;
+
+        /** @brief Half of bit pattern @p bits. */
+        [[nodiscard]] static constexpr half fromBits(std::uint16_t bits) noexcept;
+
+        /** @brief Bit pattern of the half. */
+        [[nodiscard]] constexpr std::uint16_t bits() const noexcept;
+
+
+        /**
+         * @name Compound assignment
+         * @brief Compute in `float`, then round the result back to half.
+         * @{
+         */
+        constexpr half& operator+=(float rhs) noexcept;
+        constexpr half& operator-=(float rhs) noexcept;
+        constexpr half& operator*=(float rhs) noexcept;
+        constexpr half& operator/=(float rhs) noexcept;
+        /** @} */
+
+        private:
+        std::uint16_t _bits = 0;
+    };
+
+    static_assert(sizeof(half) == 2 && std::is_trivially_copyable_v<half> && std::is_standard_layout_v<half>,
+                  "Buffers of half are converted as buffers of 16-bit patterns");
+
+
+    /**
+     * @brief Round every value of @p src to half precision into @p out.
+     * @warning @p src and @p out must hold as many values; checked with `assert`.
+     */
+    void toHalf(std::span<const float> src, std::span<half> out) noexcept;
+
+    /**
+     * @brief Widen every value of @p src to `float` into @p out.
+     * @warning @p src and @p out must hold as many values; checked with `assert`.
+     */
+    void toFloat(std::span<const half> src, std::span<float> out) noexcept;
+
+
+    /**
+     * @brief Round buffers of vectors or matrices to their half precision counterparts, e.g.
+     *        `toHalf<Vector4D>(positions, packedPositions)`.
+     *
+     * @tparam V Component-only template, such that `V<half>` is exactly half the size of `V<float>`.
+     */
+    template <template <typename> typename V>
+        requires(sizeof(V<float>) == 2 * sizeof(V<half>) && std::is_trivially_copyable_v<V<float>> &&
+                 std::is_trivially_copyable_v<V<half>>)
+    void toHalf(std::type_identity_t<std::span<const V<float>>> src,
+                std::type_identity_t<std::span<V<half>>> out) noexcept;
+
+    /**
+     * @brief Widen buffers of half precision vectors or matrices to `float`, e.g.
+     *        `toFloat<Vector4D>(packedPositions, positions)`.
+     *
+     * @tparam V Component-only template, such that `V<half>` is exactly half the size of `V<float>`.
+     */
+    template <template <typename> typename V>
+        requires(sizeof(V<float>) == 2 * sizeof(V<half>) && std::is_trivially_copyable_v<V<float>> &&
+                 std::is_trivially_copyable_v<V<half>>)
+    void toFloat(std::type_identity_t<std::span<const V<half>>> src,
+                 std::type_identity_t<std::span<V<float>>> out) noexcept;
+
+    /** @} */
+
+} // namespace fgm
+
+
+/** @brief Limits of @ref fgm::half, as for the IEEE 754 `float` and `double`. */
+template <>
+class std::numeric_limits<fgm::half>
+{
+    public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr std::float_denorm_style has_denorm = std::denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+    static constexpr bool is_iec559 = true;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int min_exponent10 = -4;
+    static constexpr int max_exponent = 16;
+    static constexpr int max_exponent10 = 4;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr fgm::half min() noexcept { return fgm::half::fromBits(0x0400); }
+    static constexpr fgm::half lowest() noexcept { return fgm::half::fromBits(0xFBFF); }
+    static constexpr fgm::half max() noexcept { return fgm::half::fromBits(0x7BFF); }
+    static constexpr fgm::half epsilon() noexcept { return fgm::half::fromBits(0x1400); }
+    static constexpr fgm::half round_error() noexcept { return fgm::half::fromBits(0x3800); }
+    static constexpr fgm::half infinity() noexcept { return fgm::half::fromBits(0x7C00); }
+    static constexpr fgm::half quiet_NaN() noexcept { return fgm::half::fromBits(0x7E00); }
+    static constexpr fgm::half signaling_NaN() noexcept { return fgm::half::fromBits(0x7D00); }
+    static constexpr fgm::half denorm_min() noexcept { return fgm::half::fromBits(0x0001); }
+};
+
+
+// `half` converts to and from every arithmetic type, which makes `cond ? half : float` ambiguous; mixed expressions
+// compute in float, so name the type float would give.
+template <>
+struct std::common_type<fgm::half, fgm::half>
+{
+    using type = fgm::half;
+};
+
+template <typename U>
+    requires std::is_arithmetic_v<U>
+struct std::common_type<fgm::half, U>
+{
+    using type = std::common_type_t<float, U>;
+};
+
+template <typename U>
+    requires std::is_arithmetic_v<U>
+struct std::common_type<U, fgm::half>
+{
+    using type = std::common_type_t<float, U>;
+};
+
+#include "Half.tpp"
@@ -0,0 +1,123 @@
+#pragma once
+/**
+ * @file Half.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::half implementation and bulk conversions.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Half.h"
+
+#include <Dispatch.h>
+#include <cassert>
+#include <cstdint>
+
+
+namespace fgm
+{
+    /*************************************
+     *                                   *
+     *              HALF                 *
+     *                                   *
+     *************************************/
+
+    constexpr half::half(const float value) noexcept: _bits(falcon::simd::floatToHalf(value))
+    {}
+
+
+    constexpr half::operator float() const noexcept
+    {
+        return falcon::simd::halfToFloat(_bits);
+    }
+
+
+    constexpr half half::fromBits(const std::uint16_t bits) noexcept
+    {
+        half result;
+        result._bits = bits;
+        return result;
+    }
+
+
+    constexpr std::uint16_t half::bits() const noexcept
+    {
+        return _bits;
+    }
+
+
+    constexpr half& half::operator+=(const float rhs) noexcept
+    {
+        return *this = float(*this) + rhs;
+    }
+
+
+    constexpr half& half::operator-=(const float rhs) noexcept
+    {
+        return *this = float(*this) - rhs;
+    }
+
+
+    constexpr half& half::operator*=(const float rhs) noexcept
+    {
+        return *this = float(*this) * rhs;
+    }
+
+
+    constexpr half& half::operator/=(const float rhs) noexcept
+    {
+        return *this = float(*this) / rhs;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *         BULK CONVERSIONS          *
+     *                                   *
+     *************************************/
+
+    inline void toHalf(const std::span<const float> src, const std::span<half> out) noexcept
+    {
+        assert(src.size() == out.size() && "Half conversion buffers must hold as many values");
+        falcon::simd::batchKernels().half.toHalf(src.data(), reinterpret_cast<std::uint16_t*>(out.data()), src.size());
+    }
+
+
+    inline void toFloat(const std::span<const half> src, const std::span<float> out) noexcept
+    {
+        assert(src.size() == out.size() && "Half conversion buffers must hold as many values");
+        falcon::simd::batchKernels().half.toFloat(reinterpret_cast<const std::uint16_t*>(src.data()), out.data(),
+                                                  src.size());
+    }
+
+
+    template <template <typename> typename V>
+        requires(sizeof(V<float>) == 2 * sizeof(V<half>) && std::is_trivially_copyable_v<V<float>> &&
+                 std::is_trivially_copyable_v<V<half>>)
+    void toHalf(const std::type_identity_t<std::span<const V<float>>> src,
+                const std::type_identity_t<std::span<V<half>>> out) noexcept
+    {
+        constexpr std::size_t components = sizeof(V<float>) / sizeof(float);
+        assert(src.size() == out.size() && "Half conversion buffers must hold as many values");
+        falcon::simd::batchKernels().half.toHalf(reinterpret_cast<const float*>(src.data()),
+                                                 reinterpret_cast<std::uint16_t*>(out.data()),
+                                                 src.size() * components);
+    }
+
+
+    template <template <typename> typename V>
+        requires(sizeof(V<float>) == 2 * sizeof(V<half>) && std::is_trivially_copyable_v<V<float>> &&
+                 std::is_trivially_copyable_v<V<half>>)
+    void toFloat(const std::type_identity_t<std::span<const V<half>>> src,
+                 const std::type_identity_t<std::span<V<float>>> out) noexcept
+    {
+        constexpr std::size_t components = sizeof(V<float>) / sizeof(float);
+        assert(src.size() == out.size() && "Half conversion buffers must hold as many values");
+        falcon::simd::batchKernels().half.toFloat(reinterpret_cast<const std::uint16_t*>(src.data()),
+                                                  reinterpret_cast<float*>(out.data()), src.size() * components);
+    }
+} // namespace fgm
@@ -10,6 +10,8 @@
  */
 
 
+#include "Half.h"
+
 #include <concepts>
 #include <cstddef>
 #include <type_traits>
@@ -29,9 +31,13 @@ namespace fgm
      *                                    *
      **************************************/
 
-    /** @brief Validates that a type is a standard numeric primitive (integral or floating-point). */
+    /**
+     * @brief Validates that a type is a standard numeric primitive (integral or floating-point), or @ref half.
+     * @details @ref half is admitted as a storage type: it converts to `float` for every operation, so components of
+     *          it compute in `float`.
+     */
     template <typename T>
-    concept Arithmetic = std::integral<T> || std::floating_point<T>;
+    concept Arithmetic = std::integral<T> || std::floating_point<T> || std::same_as<std::remove_cv_t<T>, half>;
 
     /**
      * @brief Validates that a type is a signed numeric primitive (integral or floating-point) suitable for linear algebra.
@@ -39,7 +45,9 @@ namespace fgm
      * @note Excludes `bool` type to ensure logical inversions remain separate from algebraic inversions.
      */
     template <typename T>
-    concept SignedStrictArithmetic = (std::signed_integral<T> || std::floating_point<T>) && !std::is_same_v<T, bool>;
+    concept SignedStrictArithmetic =
+        (std::signed_integral<T> || std::floating_point<T> || std::same_as<std::remove_cv_t<T>, half>) &&
+        !std::is_same_v<T, bool>;
 
 
     /**
@@ -59,6 +67,14 @@ namespace fgm
     concept WeakArithmetic = std::is_arithmetic_v<std::decay_t<T>>;
 
 
+    /**
+     * @brief Element types the runtime dispatched batch kernels are compiled for.
+     * @details Restricts structure-of-arrays containers such as @ref Vec4Array to `float` and `double`.
+     */
+    template <typename T>
+    concept BatchArithmetic = std::same_as<T, float> || std::same_as<T, double>;
+
+
 
 
     /**************************************
@@ -98,10 +114,11 @@ namespace fgm
     /**
      * @brief Determines the optimal high-precision type for length calculations.
      * @note Automatically promotes integral types to double to prevent precision loss during square root operations.
+     *       @ref half computes in `float`.
      */
     template <typename T>
         requires Arithmetic<T>
-    using Magnitude = std::conditional_t<std::is_same_v<T, float>, float, double>;
+    using Magnitude = std::conditional_t<std::is_same_v<T, float> || std::is_same_v<T, half>, float, double>;
 
     /** @} */
 
@@ -0,0 +1,537 @@
+#pragma once
+/**
+ * @file Expression.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Opt-in lazy arithmetic over @ref fgm::Vector4D and @ref fgm::Matrix4D.
+ *
+ * @details Every @ref Vector4D operator returns a fully materialized vector, promoted to `std::common_type_t` at every
+ *          step, so `a * s + b * t - c` stores and reloads two temporaries. Wrapping one operand with @ref expr::lazy
+ *          instead builds a tree of small nodes that is evaluated once, when it is converted to a vector or matrix or
+ *          passed to @ref expr::assign:
+ *          - On register backed types (`float`, `double` and `long long`) the whole tree runs in registers, and every
+ *            `x * s + y` and `matrix * v + y` is contracted into fused multiply-adds where the target has FMA.
+ *          - Other types, and constant evaluation of vector expressions, compute each component directly from the
+ *            operands without intermediate vectors.
+ *
+ *          @code
+ *          using namespace fgm;
+ *          position = expr::lazy(velocity) * dt + position;              // One multiply-add
+ *          expr::assign(out, expr::lazy(model) * (expr::lazy(v) * s) + offset);
+ *          @endcode
+ *
+ * @note All operands of one expression must share their component type; scalars are converted to it when the node is
+ *       built.
+ * @warning Nodes hold references to their operands. Evaluate an expression within the full expression that builds
+ *          it, or keep every operand alive until it is evaluated; do not store nodes in `auto` variables that outlive
+ *          temporaries.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "common/MathTraits.h"
+#include "matrix/Matrix4D.h"
+#include "vector/Vector4D.h"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace fgm::expr
+{
+    /**
+     * @addtogroup FGM_Expr
+     * @{
+     */
+
+    /*************************************
+     *                                   *
+     *            NODE BASES             *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Base of every lazy 4D vector expression.
+     *
+     * @tparam Derived Node type deriving from this base.
+     * @tparam T       Component type of the result.
+     */
+    template <typename Derived, StrictArithmetic T>
+    struct VectorNode
+    {
+        using value_type = T;
+
+        static constexpr std::size_t dimension = 4; ///< Components of the result.
+
+        /** @brief Evaluate the expression into a new vector. */
+        [[nodiscard]] constexpr Vector4D<T> eval() const noexcept;
+
+        /** @brief Evaluate the expression when it is used as a vector. */
+        constexpr operator Vector4D<T>() const noexcept;
+    };
+
+
+    /**
+     * @brief Base of every lazy 4x4 matrix expression.
+     * @details Matrix nodes are evaluated column by column, each column being a vector expression.
+     *
+     * @tparam Derived Node type deriving from this base.
+     * @tparam T       Component type of the result.
+     */
+    template <typename Derived, StrictArithmetic T>
+    struct MatrixNode
+    {
+        using value_type = T;
+
+        static constexpr std::size_t columns = 4; ///< Columns of the result.
+        static constexpr std::size_t rows = 4;    ///< Rows of the result.
+
+        /** @brief Evaluate the expression into a new matrix. */
+        [[nodiscard]] Matrix4D<T> eval() const noexcept;
+
+        /** @brief Evaluate the expression when it is used as a matrix. */
+        operator Matrix4D<T>() const noexcept;
+    };
+
+
+    /** @brief Satisfied by lazy vector expression nodes. */
+    template <typename E>
+    concept VectorExpression =
+        requires { typename E::value_type; } && std::derived_from<E, VectorNode<E, typename E::value_type>>;
+
+
+    /** @brief Satisfied by lazy matrix expression nodes. */
+    template <typename E>
+    concept MatrixExpression =
+        requires { typename E::value_type; } && std::derived_from<E, MatrixNode<E, typename E::value_type>>;
+
+
+    /** @brief Satisfied by anything that can appear as a vector in an expression: a node or a @ref Vector4D. */
+    template <typename E>
+    concept VectorOperand = VectorExpression<E> || (StrictArithmetic<typename E::value_type> &&
+                                                    std::same_as<E, Vector4D<typename E::value_type>>);
+
+
+    /** @brief Satisfied by anything that can appear as a matrix in an expression: a node or a @ref Matrix4D. */
+    template <typename E>
+    concept MatrixOperand = MatrixExpression<E> || (StrictArithmetic<typename E::value_type> &&
+                                                    std::same_as<E, Matrix4D<typename E::value_type>>);
+
+
+
+    /*************************************
+     *                                   *
+     *           VECTOR NODES            *
+     *                                   *
+     *************************************/
+
+    /** @brief Leaf referring to an existing vector. */
+    template <StrictArithmetic T>
+    class VectorRef: public VectorNode<VectorRef<T>, T>
+    {
+        public:
+        static constexpr bool contracts = false; ///< True if the node folds an addend into a multiply-add.
+
+        constexpr explicit VectorRef(const Vector4D<T>& vector) noexcept;
+
+        /** @brief Component @p i of the result, computed from the operands. */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @brief Result held in the register(s) of @ref Vector4D<T>. */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @brief `addend + result`, or `addend - result` when @p Negate, with as few operations as possible. */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        const Vector4D<T>& _vector;
+    };
+
+
+    /** @brief `lhs + rhs`. */
+    template <VectorExpression L, VectorExpression R>
+    class Sum: public VectorNode<Sum<L, R>, typename L::value_type>
+    {
+        public:
+        using T = typename L::value_type;
+
+        static constexpr bool contracts = L::contracts || R::contracts; ///< @copydoc VectorRef::contracts
+
+        constexpr Sum(const L& lhs, const R& rhs) noexcept;
+
+        /** @copydoc VectorRef::component */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @copydoc VectorRef::packet */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @copydoc VectorRef::accumulate */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        L _lhs;
+        R _rhs;
+    };
+
+
+    /** @brief `lhs - rhs`. */
+    template <VectorExpression L, VectorExpression R>
+    class Difference: public VectorNode<Difference<L, R>, typename L::value_type>
+    {
+        public:
+        using T = typename L::value_type;
+
+        static constexpr bool contracts = L::contracts || R::contracts; ///< @copydoc VectorRef::contracts
+
+        constexpr Difference(const L& lhs, const R& rhs) noexcept;
+
+        /** @copydoc VectorRef::component */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @copydoc VectorRef::packet */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @copydoc VectorRef::accumulate */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        L _lhs;
+        R _rhs;
+    };
+
+
+    /** @brief `-vector`. */
+    template <VectorExpression E>
+    class Negation: public VectorNode<Negation<E>, typename E::value_type>
+    {
+        public:
+        using T = typename E::value_type;
+
+        static constexpr bool contracts = E::contracts; ///< @copydoc VectorRef::contracts
+
+        constexpr explicit Negation(const E& vector) noexcept;
+
+        /** @copydoc VectorRef::component */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @copydoc VectorRef::packet */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @copydoc VectorRef::accumulate */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        E _vector;
+    };
+
+
+    /** @brief `vector * scalar`, folded into a multiply-add when it is added to another node. */
+    template <VectorExpression E>
+    class Scaled: public VectorNode<Scaled<E>, typename E::value_type>
+    {
+        public:
+        using T = typename E::value_type;
+
+        static constexpr bool contracts = true; ///< @copydoc VectorRef::contracts
+
+        constexpr Scaled(const E& vector, T scalar) noexcept;
+
+        /** @copydoc VectorRef::component */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @copydoc VectorRef::packet */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @copydoc VectorRef::accumulate */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        E _vector;
+        T _scalar;
+    };
+
+
+    /**
+     * @brief `matrix * vector`, computed as a combination of the matrix columns.
+     * @details The vector is evaluated once, then each column is accumulated with one multiply-add, starting from the
+     *          addend when the product is added to another node.
+     */
+    template <MatrixExpression M, VectorExpression V>
+    class Transformed: public VectorNode<Transformed<M, V>, typename V::value_type>
+    {
+        public:
+        using T = typename V::value_type;
+
+        static constexpr bool contracts = true; ///< @copydoc VectorRef::contracts
+
+        constexpr Transformed(const M& matrix, const V& vector) noexcept;
+
+        /** @copydoc VectorRef::component */
+        [[nodiscard]] constexpr T component(std::size_t i) const noexcept;
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @copydoc VectorRef::packet */
+        [[nodiscard]] auto packet() const noexcept;
+
+        /** @copydoc VectorRef::accumulate */
+        template <bool Negate, typename Reg>
+        [[nodiscard]] Reg accumulate(Reg addend) const noexcept;
+#endif
+
+        private:
+        M _matrix;
+        V _vector;
+    };
+
+
+
+    /*************************************
+     *                                   *
+     *           MATRIX NODES            *
+     *                                   *
+     *************************************/
+
+    /** @brief Leaf referring to an existing matrix. */
+    template <StrictArithmetic T>
+    class MatrixRef: public MatrixNode<MatrixRef<T>, T>
+    {
+        public:
+        explicit MatrixRef(const Matrix4D<T>& matrix) noexcept;
+
+        /** @brief Column @p j of the result, as a vector expression. */
+        [[nodiscard]] VectorRef<T> column(std::size_t j) const noexcept;
+
+        private:
+        const Matrix4D<T>& _matrix;
+    };
+
+
+    /** @brief `lhs + rhs`, column by column. */
+    template <MatrixExpression L, MatrixExpression R>
+    class MatrixSum: public MatrixNode<MatrixSum<L, R>, typename L::value_type>
+    {
+        public:
+        MatrixSum(const L& lhs, const R& rhs) noexcept;
+
+        /** @copydoc MatrixRef::column */
+        [[nodiscard]] auto column(std::size_t j) const noexcept;
+
+        private:
+        L _lhs;
+        R _rhs;
+    };
+
+
+    /** @brief `lhs - rhs`, column by column. */
+    template <MatrixExpression L, MatrixExpression R>
+    class MatrixDifference: public MatrixNode<MatrixDifference<L, R>, typename L::value_type>
+    {
+        public:
+        MatrixDifference(const L& lhs, const R& rhs) noexcept;
+
+        /** @copydoc MatrixRef::column */
+        [[nodiscard]] auto column(std::size_t j) const noexcept;
+
+        private:
+        L _lhs;
+        R _rhs;
+    };
+
+
+    /** @brief `matrix * scalar`, column by column. */
+    template <MatrixExpression E>
+    class MatrixScaled: public MatrixNode<MatrixScaled<E>, typename E::value_type>
+    {
+        public:
+        using T = typename E::value_type;
+
+        MatrixScaled(const E& matrix, T scalar) noexcept;
+
+        /** @copydoc MatrixRef::column */
+        [[nodiscard]] auto column(std::size_t j) const noexcept;
+
+        private:
+        E _matrix;
+        T _scalar;
+    };
+
+
+    /** @brief `lhs * rhs`, whose column `j` is `lhs` applied to column `j` of `rhs`. */
+    template <MatrixExpression L, MatrixExpression R>
+    class MatrixProduct: public MatrixNode<MatrixProduct<L, R>, typename L::value_type>
+    {
+        public:
+        MatrixProduct(const L& lhs, const R& rhs) noexcept;
+
+        /** @copydoc MatrixRef::column */
+        [[nodiscard]] auto column(std::size_t j) const noexcept;
+
+        private:
+        L _lhs;
+        R _rhs;
+    };
+
+
+
+    /*************************************
+     *                                   *
+     *      BUILDING AND EVALUATION      *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Start a lazy expression from @p vector.
+     *
+     * @param[in] vector Operand, which must outlive the expression.
+     *
+     * @return Leaf node referring to @p vector.
+     */
+    template <StrictArithmetic T>
+    [[nodiscard]] constexpr VectorRef<T> lazy(const Vector4D<T>& vector) noexcept;
+
+    /** @brief Temporaries would dangle before the expression is evaluated. */
+    template <StrictArithmetic T>
+    VectorRef<T> lazy(const Vector4D<T>&& vector) = delete;
+
+
+    /**
+     * @brief Start a lazy expression from @p matrix.
+     *
+     * @param[in] matrix Operand, which must outlive the expression.
+     *
+     * @return Leaf node referring to @p matrix.
+     */
+    template <StrictArithmetic T>
+    [[nodiscard]] MatrixRef<T> lazy(const Matrix4D<T>& matrix) noexcept;
+
+    /** @brief Temporaries would dangle before the expression is evaluated. */
+    template <StrictArithmetic T>
+    MatrixRef<T> lazy(const Matrix4D<T>&& matrix) = delete;
+
+
+    /**
+     * @brief Evaluate @p expression into @p dest in one pass.
+     * @details Every operand is read before @p dest is written, so @p dest may appear in @p expression.
+     *
+     * @param[out] dest       Destination.
+     * @param[in]  expression Expression to evaluate.
+     */
+    template <VectorExpression E>
+    constexpr void assign(Vector4D<typename E::value_type>& dest, const E& expression) noexcept;
+
+
+    /** @copydoc assign(Vector4D<typename E::value_type>&, const E&) */
+    template <MatrixExpression E>
+    void assign(Matrix4D<typename E::value_type>& dest, const E& expression) noexcept;
+
+
+
+    /*************************************
+     *                                   *
+     *             OPERATORS             *
+     *                                   *
+     *************************************/
+
+    /** @brief True if @p L and @p R can be combined into a vector node, at least one of them being a node already. */
+    template <typename L, typename R>
+    concept VectorOperands = VectorOperand<L> && VectorOperand<R> && (VectorExpression<L> || VectorExpression<R>) &&
+                             std::same_as<typename L::value_type, typename R::value_type>;
+
+
+    /** @brief True if @p L and @p R can be combined into a matrix node, at least one of them being a node already. */
+    template <typename L, typename R>
+    concept MatrixOperands = MatrixOperand<L> && MatrixOperand<R> && (MatrixExpression<L> || MatrixExpression<R>) &&
+                             std::same_as<typename L::value_type, typename R::value_type>;
+
+
+    /** @brief True if @p M can transform @p V lazily, at least one of them being a node already. */
+    template <typename M, typename V>
+    concept TransformOperands = MatrixOperand<M> && VectorOperand<V> &&
+                                (MatrixExpression<M> || VectorExpression<V>) &&
+                                std::same_as<typename M::value_type, typename V::value_type>;
+
+
+    /** @brief Lazy component-wise sum. */
+    template <typename L, typename R>
+        requires VectorOperands<L, R>
+    [[nodiscard]] constexpr auto operator+(const L& lhs, const R& rhs) noexcept;
+
+
+    /** @brief Lazy component-wise difference. */
+    template <typename L, typename R>
+        requires VectorOperands<L, R>
+    [[nodiscard]] constexpr auto operator-(const L& lhs, const R& rhs) noexcept;
+
+
+    /** @brief Lazy component-wise negation. */
+    template <VectorExpression E>
+        requires SignedStrictArithmetic<typename E::value_type>
+    [[nodiscard]] constexpr auto operator-(const E& vector) noexcept;
+
+
+    /** @brief Lazy scaling, converting @p scalar to the component type of @p vector. */
+    template <VectorExpression E, StrictArithmetic S>
+    [[nodiscard]] constexpr auto operator*(const E& vector, S scalar) noexcept;
+
+
+    /** @copydoc operator*(const E&, S) */
+    template <VectorExpression E, StrictArithmetic S>
+    [[nodiscard]] constexpr auto operator*(S scalar, const E& vector) noexcept;
+
+
+    /** @brief Lazy matrix-vector product. */
+    template <typename M, typename V>
+        requires TransformOperands<M, V>
+    [[nodiscard]] auto operator*(const M& matrix, const V& vector) noexcept;
+
+
+    /** @brief Lazy matrix sum. */
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    [[nodiscard]] auto operator+(const L& lhs, const R& rhs) noexcept;
+
+
+    /** @brief Lazy matrix difference. */
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    [[nodiscard]] auto operator-(const L& lhs, const R& rhs) noexcept;
+
+
+    /** @brief Lazy matrix product. */
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    [[nodiscard]] auto operator*(const L& lhs, const R& rhs) noexcept;
+
+
+    /** @brief Lazy matrix scaling, converting @p scalar to the component type of @p matrix. */
+    template <MatrixExpression E, StrictArithmetic S>
+    [[nodiscard]] auto operator*(const E& matrix, S scalar) noexcept;
+
+
+    /** @copydoc operator*(const E&, S) */
+    template <MatrixExpression E, StrictArithmetic S>
+    [[nodiscard]] auto operator*(S scalar, const E& matrix) noexcept;
+
+    /** @} */
+
+} // namespace fgm::expr
+
+#include "Expression.tpp"
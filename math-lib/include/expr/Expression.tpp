@@ -0,0 +1,511 @@
+#pragma once
+/**
+ * @file Expression.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::expr node and operator implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Expression.h"
+
+#include <type_traits>
+
+
+namespace fgm::expr
+{
+    namespace detail
+    {
+        /** @brief Leaf node for @p operand, or @p operand itself if it already is a node. */
+        template <typename E>
+        [[nodiscard]] constexpr auto operand(const E& operand) noexcept
+        {
+            if constexpr (VectorExpression<E> || MatrixExpression<E>)
+                return operand;
+            else
+                return lazy(operand);
+        }
+
+
+        /** @brief Node type @ref operand returns for `E`. */
+        template <typename E>
+        using OperandOf = decltype(operand(std::declval<const E&>()));
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *            NODE BASES             *
+     *                                   *
+     *************************************/
+
+    template <typename Derived, StrictArithmetic T>
+    constexpr Vector4D<T> VectorNode<Derived, T>::eval() const noexcept
+    {
+        Vector4D<T> result;
+        assign(result, static_cast<const Derived&>(*this));
+        return result;
+    }
+
+
+    template <typename Derived, StrictArithmetic T>
+    constexpr VectorNode<Derived, T>::operator Vector4D<T>() const noexcept
+    {
+        return eval();
+    }
+
+
+    template <typename Derived, StrictArithmetic T>
+    Matrix4D<T> MatrixNode<Derived, T>::eval() const noexcept
+    {
+        Matrix4D<T> result;
+        assign(result, static_cast<const Derived&>(*this));
+        return result;
+    }
+
+
+    template <typename Derived, StrictArithmetic T>
+    MatrixNode<Derived, T>::operator Matrix4D<T>() const noexcept
+    {
+        return eval();
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *           VECTOR NODES            *
+     *                                   *
+     *************************************/
+
+    template <StrictArithmetic T>
+    constexpr VectorRef<T>::VectorRef(const Vector4D<T>& vector) noexcept: _vector(vector)
+    {}
+
+
+    template <StrictArithmetic T>
+    constexpr T VectorRef<T>::component(const std::size_t i) const noexcept
+    {
+        // Named members instead of operator[], whose pointer arithmetic is not allowed in constant evaluation.
+        switch (i)
+        {
+            case 0:
+                return _vector.x;
+            case 1:
+                return _vector.y;
+            case 2:
+                return _vector.z;
+            default:
+                return _vector.w;
+        }
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    constexpr Sum<L, R>::Sum(const L& lhs, const R& rhs) noexcept: _lhs(lhs), _rhs(rhs)
+    {}
+
+
+    template <VectorExpression L, VectorExpression R>
+    constexpr auto Sum<L, R>::component(const std::size_t i) const noexcept -> T
+    {
+        return _lhs.component(i) + _rhs.component(i);
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    constexpr Difference<L, R>::Difference(const L& lhs, const R& rhs) noexcept: _lhs(lhs), _rhs(rhs)
+    {}
+
+
+    template <VectorExpression L, VectorExpression R>
+    constexpr auto Difference<L, R>::component(const std::size_t i) const noexcept -> T
+    {
+        return _lhs.component(i) - _rhs.component(i);
+    }
+
+
+    template <VectorExpression E>
+    constexpr Negation<E>::Negation(const E& vector) noexcept: _vector(vector)
+    {}
+
+
+    template <VectorExpression E>
+    constexpr auto Negation<E>::component(const std::size_t i) const noexcept -> T
+    {
+        return -_vector.component(i);
+    }
+
+
+    template <VectorExpression E>
+    constexpr Scaled<E>::Scaled(const E& vector, const T scalar) noexcept: _vector(vector), _scalar(scalar)
+    {}
+
+
+    template <VectorExpression E>
+    constexpr auto Scaled<E>::component(const std::size_t i) const noexcept -> T
+    {
+        return _vector.component(i) * _scalar;
+    }
+
+
+    template <MatrixExpression M, VectorExpression V>
+    constexpr Transformed<M, V>::Transformed(const M& matrix, const V& vector) noexcept:
+        _matrix(matrix), _vector(vector)
+    {}
+
+
+    template <MatrixExpression M, VectorExpression V>
+    constexpr auto Transformed<M, V>::component(const std::size_t i) const noexcept -> T
+    {
+        T result = _matrix.column(0).component(i) * _vector.component(0);
+        for (std::size_t j = 1; j < 4; ++j)
+            result += _matrix.column(j).component(i) * _vector.component(j);
+        return result;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *         REGISTER EVALUATION       *
+     *                                   *
+     *************************************/
+
+#ifdef FALCON_SIMD_SUPPORTED
+    // Every node evaluates either on its own (packet) or added to, or subtracted from, a register that is already
+    // computed (accumulate). Products accumulate through multiply-adds, so sums of products never round in between.
+
+    template <StrictArithmetic T>
+    auto VectorRef<T>::packet() const noexcept
+    {
+        return fgm::detail::load(_vector);
+    }
+
+
+    template <StrictArithmetic T>
+    template <bool Negate, typename Reg>
+    Reg VectorRef<T>::accumulate(const Reg addend) const noexcept
+    {
+        if constexpr (Negate)
+            return fgm::detail::sub(addend, packet());
+        else
+            return fgm::detail::add(addend, packet());
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    auto Sum<L, R>::packet() const noexcept
+    {
+        if constexpr (R::contracts)
+            return _rhs.template accumulate<false>(_lhs.packet());
+        else
+            return _lhs.template accumulate<false>(_rhs.packet());
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    template <bool Negate, typename Reg>
+    Reg Sum<L, R>::accumulate(const Reg addend) const noexcept
+    {
+        return _lhs.template accumulate<Negate>(_rhs.template accumulate<Negate>(addend));
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    auto Difference<L, R>::packet() const noexcept
+    {
+        if constexpr (R::contracts)
+            return _rhs.template accumulate<true>(_lhs.packet());
+        else
+            return fgm::detail::sub(_lhs.packet(), _rhs.packet());
+    }
+
+
+    template <VectorExpression L, VectorExpression R>
+    template <bool Negate, typename Reg>
+    Reg Difference<L, R>::accumulate(const Reg addend) const noexcept
+    {
+        return _lhs.template accumulate<Negate>(_rhs.template accumulate<!Negate>(addend));
+    }
+
+
+    template <VectorExpression E>
+    auto Negation<E>::packet() const noexcept
+    {
+        return fgm::detail::negate(_vector.packet());
+    }
+
+
+    template <VectorExpression E>
+    template <bool Negate, typename Reg>
+    Reg Negation<E>::accumulate(const Reg addend) const noexcept
+    {
+        return _vector.template accumulate<!Negate>(addend);
+    }
+
+
+    template <VectorExpression E>
+    auto Scaled<E>::packet() const noexcept
+    {
+        return fgm::detail::mul(_vector.packet(), fgm::detail::broadcast(_scalar));
+    }
+
+
+    template <VectorExpression E>
+    template <bool Negate, typename Reg>
+    Reg Scaled<E>::accumulate(const Reg addend) const noexcept
+    {
+        return fgm::detail::mulAdd(_vector.packet(), fgm::detail::broadcast(Negate ? T(-_scalar) : _scalar), addend);
+    }
+
+
+    template <MatrixExpression M, VectorExpression V>
+    auto Transformed<M, V>::packet() const noexcept
+    {
+        const Vector4D<T> weights = _vector.eval();
+        auto result = fgm::detail::mul(_matrix.column(0).packet(), fgm::detail::broadcast(weights.x));
+        result = fgm::detail::mulAdd(_matrix.column(1).packet(), fgm::detail::broadcast(weights.y), result);
+        result = fgm::detail::mulAdd(_matrix.column(2).packet(), fgm::detail::broadcast(weights.z), result);
+        return fgm::detail::mulAdd(_matrix.column(3).packet(), fgm::detail::broadcast(weights.w), result);
+    }
+
+
+    template <MatrixExpression M, VectorExpression V>
+    template <bool Negate, typename Reg>
+    Reg Transformed<M, V>::accumulate(const Reg addend) const noexcept
+    {
+        const Vector4D<T> weights = Negate ? Vector4D<T>(-_vector.eval()) : _vector.eval();
+        Reg result = fgm::detail::mulAdd(_matrix.column(0).packet(), fgm::detail::broadcast(weights.x), addend);
+        result = fgm::detail::mulAdd(_matrix.column(1).packet(), fgm::detail::broadcast(weights.y), result);
+        result = fgm::detail::mulAdd(_matrix.column(2).packet(), fgm::detail::broadcast(weights.z), result);
+        return fgm::detail::mulAdd(_matrix.column(3).packet(), fgm::detail::broadcast(weights.w), result);
+    }
+#endif
+
+
+
+    /*************************************
+     *                                   *
+     *           MATRIX NODES            *
+     *                                   *
+     *************************************/
+
+    template <StrictArithmetic T>
+    MatrixRef<T>::MatrixRef(const Matrix4D<T>& matrix) noexcept: _matrix(matrix)
+    {}
+
+
+    template <StrictArithmetic T>
+    VectorRef<T> MatrixRef<T>::column(const std::size_t j) const noexcept
+    {
+        return VectorRef<T>(_matrix.col_vectors[j]);
+    }
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    MatrixSum<L, R>::MatrixSum(const L& lhs, const R& rhs) noexcept: _lhs(lhs), _rhs(rhs)
+    {}
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    auto MatrixSum<L, R>::column(const std::size_t j) const noexcept
+    {
+        return Sum(_lhs.column(j), _rhs.column(j));
+    }
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    MatrixDifference<L, R>::MatrixDifference(const L& lhs, const R& rhs) noexcept: _lhs(lhs), _rhs(rhs)
+    {}
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    auto MatrixDifference<L, R>::column(const std::size_t j) const noexcept
+    {
+        return Difference(_lhs.column(j), _rhs.column(j));
+    }
+
+
+    template <MatrixExpression E>
+    MatrixScaled<E>::MatrixScaled(const E& matrix, const T scalar) noexcept: _matrix(matrix), _scalar(scalar)
+    {}
+
+
+    template <MatrixExpression E>
+    auto MatrixScaled<E>::column(const std::size_t j) const noexcept
+    {
+        return Scaled(_matrix.column(j), _scalar);
+    }
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    MatrixProduct<L, R>::MatrixProduct(const L& lhs, const R& rhs) noexcept: _lhs(lhs), _rhs(rhs)
+    {}
+
+
+    template <MatrixExpression L, MatrixExpression R>
+    auto MatrixProduct<L, R>::column(const std::size_t j) const noexcept
+    {
+        return Transformed(_lhs, _rhs.column(j));
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *      BUILDING AND EVALUATION      *
+     *                                   *
+     *************************************/
+
+    template <StrictArithmetic T>
+    constexpr VectorRef<T> lazy(const Vector4D<T>& vector) noexcept
+    {
+        return VectorRef<T>(vector);
+    }
+
+
+    template <StrictArithmetic T>
+    MatrixRef<T> lazy(const Matrix4D<T>& matrix) noexcept
+    {
+        return MatrixRef<T>(matrix);
+    }
+
+
+    template <VectorExpression E>
+    constexpr void assign(Vector4D<typename E::value_type>& dest, const E& expression) noexcept
+    {
+        using T = typename E::value_type;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (fgm::detail::hasVec4Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                fgm::detail::storeInto(dest, expression.packet());
+                return;
+            }
+        }
+#endif
+        dest = Vector4D<T>(expression.component(0), expression.component(1), expression.component(2),
+                           expression.component(3));
+    }
+
+
+    template <MatrixExpression E>
+    void assign(Matrix4D<typename E::value_type>& dest, const E& expression) noexcept
+    {
+        using T = typename E::value_type;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (fgm::detail::hasVec4Kernels<T>)
+        {
+            // Products read every column of their operands, so nothing is stored until all four are computed.
+            const auto col0 = expression.column(0).packet();
+            const auto col1 = expression.column(1).packet();
+            const auto col2 = expression.column(2).packet();
+            const auto col3 = expression.column(3).packet();
+            fgm::detail::storeInto(dest.col_vectors[0], col0);
+            fgm::detail::storeInto(dest.col_vectors[1], col1);
+            fgm::detail::storeInto(dest.col_vectors[2], col2);
+            fgm::detail::storeInto(dest.col_vectors[3], col3);
+            return;
+        }
+#endif
+        dest = Matrix4D<T>(expression.column(0).eval(), expression.column(1).eval(), expression.column(2).eval(),
+                           expression.column(3).eval());
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             OPERATORS             *
+     *                                   *
+     *************************************/
+
+    template <typename L, typename R>
+        requires VectorOperands<L, R>
+    constexpr auto operator+(const L& lhs, const R& rhs) noexcept
+    {
+        return Sum(detail::operand(lhs), detail::operand(rhs));
+    }
+
+
+    template <typename L, typename R>
+        requires VectorOperands<L, R>
+    constexpr auto operator-(const L& lhs, const R& rhs) noexcept
+    {
+        return Difference(detail::operand(lhs), detail::operand(rhs));
+    }
+
+
+    template <VectorExpression E>
+        requires SignedStrictArithmetic<typename E::value_type>
+    constexpr auto operator-(const E& vector) noexcept
+    {
+        return Negation(vector);
+    }
+
+
+    template <VectorExpression E, StrictArithmetic S>
+    constexpr auto operator*(const E& vector, const S scalar) noexcept
+    {
+        return Scaled(vector, static_cast<typename E::value_type>(scalar));
+    }
+
+
+    template <VectorExpression E, StrictArithmetic S>
+    constexpr auto operator*(const S scalar, const E& vector) noexcept
+    {
+        return Scaled(vector, static_cast<typename E::value_type>(scalar));
+    }
+
+
+    template <typename M, typename V>
+        requires TransformOperands<M, V>
+    auto operator*(const M& matrix, const V& vector) noexcept
+    {
+        return Transformed(detail::operand(matrix), detail::operand(vector));
+    }
+
+
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    auto operator+(const L& lhs, const R& rhs) noexcept
+    {
+        return MatrixSum(detail::operand(lhs), detail::operand(rhs));
+    }
+
+
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    auto operator-(const L& lhs, const R& rhs) noexcept
+    {
+        return MatrixDifference(detail::operand(lhs), detail::operand(rhs));
+    }
+
+
+    template <typename L, typename R>
+        requires MatrixOperands<L, R>
+    auto operator*(const L& lhs, const R& rhs) noexcept
+    {
+        return MatrixProduct(detail::operand(lhs), detail::operand(rhs));
+    }
+
+
+    template <MatrixExpression E, StrictArithmetic S>
+    auto operator*(const E& matrix, const S scalar) noexcept
+    {
+        return MatrixScaled(matrix, static_cast<typename E::value_type>(scalar));
+    }
+
+
+    template <MatrixExpression E, StrictArithmetic S>
+    auto operator*(const S scalar, const E& matrix) noexcept
+    {
+        return MatrixScaled(matrix, static_cast<typename E::value_type>(scalar));
+    }
+} // namespace fgm::expr
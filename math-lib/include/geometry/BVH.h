@@ -0,0 +1,227 @@
+#pragma once
+/**
+ * @file BVH.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Four-wide bounding volume hierarchy over the boxes of a primitive set, with ray queries.
+ *
+ * @details @ref fgm::BVH only sees one @ref fgm::AABB per primitive, so it serves triangles, spheres or any other
+ *          primitive the caller can intersect; @ref fgm::TriangleIntersector covers the usual triangle soup.
+ *          - The build splits with the binned surface area heuristic, @ref fgm::BVH::binCount bins per axis, and runs
+ *            the two halves of large splits on separate threads of a @ref fgm::parallel::ThreadPool. The tree does
+ *            not depend on the thread count.
+ *          - The binary tree of the build is flattened into nodes of up to four children, laid out depth first. A
+ *            node keeps the boxes of its children as six @ref fgm::Vector4D, one per bound and axis, so a ray is
+ *            tested against all four children with one register operation per step of the slab test.
+ *          - @ref fgm::BVH::closestHit visits the children nearest first and skips those past the closest hit so far;
+ *            @ref fgm::BVH::anyHit stops at the first hit, for shadow and occlusion rays.
+ *          - @ref fgm::BVH::refit recomputes every box bottom-up for primitives that moved, keeping the tree. Queries
+ *            stay exact, though a tree refit far from the shapes it was built for visits more nodes.
+ *
+ * @par Intersectors
+ * Queries call `intersect(primitive, ray, distance)` for the primitives of the leaves the ray reaches. It follows the
+ * @ref fgm::Ray::intersects contract: return `true` and overwrite `distance` on a hit no farther than `distance`,
+ * else return `false` and leave it alone.
+ *
+ * @note Bounds must be finite. Primitives are numbered by their index in the bounds of @ref fgm::BVH::BVH, and there
+ *       may be at most `2^32 - 1` of them.
+ *
+ * @tparam T Type of the components. Must be `float` or `double`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BoundingVolumes.h"
+#include "Ray.h"
+#include "common/MathTraits.h"
+#include "parallel/ThreadPool.h"
+#include "vector/Vector3D.h"
+#include "vector/Vector4D.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_BVH
+     * @{
+     */
+
+    /** @brief Tuning of the @ref BVH build. */
+    struct BVHBuildOptions
+    {
+        /** @brief Most primitives per leaf. Smaller leaves test fewer primitives per ray for a larger tree. */
+        std::size_t leafSize = 4;
+
+        /** @brief Primitives below which a subtree builds on the calling thread. */
+        std::size_t parallelThreshold = 4096;
+
+        /** @brief Pool running the subtrees. `nullptr` selects @ref parallel::ThreadPool::global. */
+        parallel::ThreadPool* pool = nullptr;
+    };
+
+
+    template <BatchArithmetic T>
+    class BVH
+    {
+        public:
+        using value_type = T;
+
+        /** @brief Most children per node, one per lane of a @ref Vector4D. */
+        static constexpr std::size_t width = 4;
+
+        /** @brief Bins per axis of the surface area heuristic. */
+        static constexpr std::size_t binCount = 16;
+
+        /**
+         * @brief Depth of the build tree past which ranges split at the median instead of by the heuristic.
+         * @details Skewed inputs can make the heuristic split off a few primitives at a time; median splits bound
+         *          the depth, and with it the traversal stack, by `maxSahDepth + 32`.
+         */
+        static constexpr std::size_t maxSahDepth = 48;
+
+
+        /**
+         * @brief Node of up to @ref width children, the used ones first.
+         * @details Lane `i` of the bounds holds child `i`. A leaf child owns the @ref count entries of
+         *          @ref primitiveIndices from @ref child on; an inner child, with a @ref count of `0`, is node
+         *          @ref child. Nodes follow their parent, so every node comes after every node above it.
+         */
+        struct Node
+        {
+            Vector4D<T> minX, minY, minZ; ///< Minimum corners of the children.
+            Vector4D<T> maxX, maxY, maxZ; ///< Maximum corners of the children.
+            std::uint32_t child[width];   ///< First primitive entry of a leaf, or node index of an inner child.
+            std::uint32_t count[width];   ///< Primitives of a leaf child, `0` for an inner child.
+            std::uint32_t childCount;     ///< Used lanes, from `1` to @ref width.
+
+            /** @brief Box of child @p lane. */
+            [[nodiscard]] AABB<T> bounds(std::size_t lane) const noexcept;
+
+            /** @brief Box around every used child. */
+            [[nodiscard]] AABB<T> bounds() const noexcept;
+
+            /** @brief Set the box of child @p lane to @p box. */
+            void setBounds(std::size_t lane, const AABB<T>& box) noexcept;
+        };
+
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize an empty hierarchy that no ray hits. */
+        BVH() noexcept = default;
+
+        /**
+         * @brief Build the hierarchy over @p bounds, primitive `i` bounded by `bounds[i]`.
+         *
+         * @param[in] bounds  Box of every primitive.
+         * @param[in] options Leaf size and threading of the build.
+         */
+        explicit BVH(std::span<const AABB<T>> bounds, const BVHBuildOptions& options = {});
+
+
+        /*************************************
+         *                                   *
+         *              ACCESS               *
+         *                                   *
+         *************************************/
+
+        /** @brief Number of primitives. */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /** @brief `true` if there are no primitives. */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /** @brief Box around every primitive, inverted if there are none. */
+        [[nodiscard]] AABB<T> bounds() const noexcept;
+
+        /** @brief Nodes, the root first. */
+        [[nodiscard]] std::span<const Node> nodes() const noexcept;
+
+        /** @brief Primitive of every leaf entry, the entries of each leaf contiguous. */
+        [[nodiscard]] std::span<const std::uint32_t> primitiveIndices() const noexcept;
+
+
+        /*************************************
+         *                                   *
+         *              QUERIES              *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Find the closest primitive @p ray hits.
+         *
+         * @param[in]     ray       Ray to trace.
+         * @param[in]     intersect Intersector, see @ref BVH.h.
+         * @param[in,out] distance  Farthest accepted distance; set to the closest hit distance on a hit.
+         * @param[out]    primitive Primitive hit closest, written only on a hit.
+         *
+         * @return `true` if @p ray hits a primitive no farther than @p distance.
+         */
+        template <typename F>
+        bool closestHit(const Ray<T>& ray, F&& intersect, T& distance, std::uint32_t& primitive) const;
+
+        /**
+         * @brief Check whether @p ray hits any primitive no farther than @p distance, stopping at the first found.
+         *
+         * @param[in] ray       Ray to trace.
+         * @param[in] intersect Intersector, see @ref BVH.h.
+         * @param[in] distance  Farthest accepted distance.
+         */
+        template <typename F>
+        [[nodiscard]] bool anyHit(const Ray<T>& ray, F&& intersect, T distance) const;
+
+
+        /*************************************
+         *                                   *
+         *              REFIT                *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Recompute every box from @p bounds, the new boxes of the primitives, keeping the tree.
+         * @warning @p bounds must hold exactly @ref size boxes; checked with `assert`.
+         */
+        void refit(std::span<const AABB<T>> bounds) noexcept;
+
+
+        private:
+        /** @brief Flatten node @p index of the binary build tree and its subtree, returning the index of its node. */
+        template <typename BuildNode>
+        std::uint32_t flatten(const std::vector<BuildNode>& tree, std::uint32_t index);
+
+        std::vector<Node> _nodes;
+        std::vector<std::uint32_t> _indices;
+    };
+
+
+    /** @brief Intersector of @ref BVH queries over a triangle soup, primitive `i` the triangle of vertices `3i` on. */
+    template <BatchArithmetic T>
+    struct TriangleIntersector
+    {
+        std::span<const Vector3D<T>> vertices; ///< Three vertices per triangle.
+
+        /** @brief @ref Ray::intersects of @p ray with triangle @p primitive. */
+        bool operator()(std::uint32_t primitive, const Ray<T>& ray, T& distance) const noexcept;
+    };
+
+
+    /** @brief Box of every triangle of a triangle soup, three vertices per triangle, to build or refit a @ref BVH. */
+    template <BatchArithmetic T>
+    [[nodiscard]] std::vector<AABB<T>> triangleBounds(std::span<const Vector3D<T>> vertices);
+
+    /** @} */
+
+} // namespace fgm
+
+#include "BVH.tpp"
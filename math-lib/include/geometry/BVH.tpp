@@ -0,0 +1,611 @@
+#pragma once
+/**
+ * @file BVH.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::BVH template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BVH.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Half the surface area of @p box, the only part of the area the heuristic compares. */
+        template <typename T>
+        [[nodiscard]] T halfArea(const AABB<T>& box) noexcept
+        {
+            const Vector3D<T> size = box.max - box.min;
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+
+
+        /** @brief Node of the binary tree a @ref BVH is built as before flattening. */
+        template <typename T>
+        struct BVHBuildNode
+        {
+            AABB<T> box;
+            std::uint32_t first = 0; ///< First primitive entry of a leaf.
+            std::uint32_t count = 0; ///< Primitives of a leaf, `0` for an inner node.
+            std::uint32_t left = 0;  ///< Left child of an inner node; the right child follows it.
+        };
+
+
+        /** @brief Binned surface area heuristic build of the binary tree, run by the @ref BVH constructor. */
+        template <typename T>
+        class BVHBuilder
+        {
+            public:
+            static constexpr std::size_t binCount = BVH<T>::binCount;
+
+            BVHBuilder(const std::span<const AABB<T>> bounds, std::vector<std::uint32_t>& indices,
+                       const BVHBuildOptions& options)
+                : _bounds(bounds), _indices(indices), _options(options),
+                  _pool(options.pool ? *options.pool : parallel::ThreadPool::global())
+            {
+                _centroids.reserve(bounds.size());
+                for (const AABB<T>& box : bounds)
+                    _centroids.push_back(box.center());
+            }
+
+
+            /** @brief Build the tree over every entry of the indices, reordering them leaf by leaf. */
+            [[nodiscard]] std::vector<BVHBuildNode<T>> build()
+            {
+                // A binary tree with non-empty leaves has at most 2n - 1 nodes; children are claimed in pairs.
+                _nodes.resize(2 * _indices.size() - 1);
+                _nodeCount.store(1, std::memory_order_relaxed);
+                split(0, 0, static_cast<std::uint32_t>(_indices.size()), 0);
+                _nodes.resize(_nodeCount.load(std::memory_order_relaxed));
+                return std::move(_nodes);
+            }
+
+
+            private:
+            /** @brief Make node @p node the root of the subtree over entries `[begin, end)`. */
+            void split(const std::uint32_t node, const std::uint32_t begin, const std::uint32_t end,
+                       const std::size_t depth)
+            {
+                AABB<T> box;
+                AABB<T> centroidBox;
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    box = box.merge(_bounds[_indices[i]]);
+                    centroidBox = centroidBox.merge(_centroids[_indices[i]]);
+                }
+                _nodes[node].box = box;
+
+                const std::size_t count = end - begin;
+                std::uint32_t middle = begin;
+                if (count > 1 && depth < BVH<T>::maxSahDepth)
+                    middle = binnedSplit(begin, end, box, centroidBox);
+                if (middle == begin && count > _options.leafSize)
+                    middle = medianSplit(begin, end, centroidBox);
+
+                if (middle == begin)
+                {
+                    _nodes[node].first = begin;
+                    _nodes[node].count = static_cast<std::uint32_t>(count);
+                    return;
+                }
+
+                const std::uint32_t left = _nodeCount.fetch_add(2, std::memory_order_relaxed);
+                _nodes[node].left = left;
+
+                // The halves own disjoint entries and nodes, so large ones build concurrently.
+                const auto buildHalf = [&](const std::size_t half)
+                {
+                    if (half == 0)
+                        split(left, begin, middle, depth + 1);
+                    else
+                        split(left + 1, middle, end, depth + 1);
+                };
+                if (count >= _options.parallelThreshold && _pool.size() > 1)
+                    _pool.run(2, buildHalf);
+                else
+                {
+                    buildHalf(0);
+                    buildHalf(1);
+                }
+            }
+
+
+            /**
+             * @brief Partition `[begin, end)` at the cheapest bin boundary of any axis.
+             * @return The first entry of the right half, or @p begin if a leaf is no more expensive.
+             */
+            std::uint32_t binnedSplit(const std::uint32_t begin, const std::uint32_t end, const AABB<T>& box,
+                                      const AABB<T>& centroidBox)
+            {
+                struct Bin
+                {
+                    AABB<T> box;
+                    std::uint32_t count = 0;
+                };
+
+                const Vector3D<T> extent = centroidBox.max - centroidBox.min;
+                std::array<T, 3> scale{};
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                    scale[axis] = extent[axis] > T(0) ? static_cast<T>(binCount) / extent[axis] : T(0);
+
+                const auto binOf = [&](const std::uint32_t primitive, const std::size_t axis)
+                {
+                    const T offset = (_centroids[primitive][axis] - centroidBox.min[axis]) * scale[axis];
+                    return std::min(static_cast<std::size_t>(offset), binCount - 1);
+                };
+
+                std::array<std::array<Bin, binCount>, 3> bins{};
+                for (std::uint32_t i = begin; i < end; ++i)
+                    for (std::size_t axis = 0; axis < 3; ++axis)
+                    {
+                        Bin& bin = bins[axis][binOf(_indices[i], axis)];
+                        bin.box = bin.box.merge(_bounds[_indices[i]]);
+                        ++bin.count;
+                    }
+
+                // Cost of the split before bin `b` is area * count of either side; sweep the right sides first.
+                const std::uint32_t count = end - begin;
+                T bestCost = std::numeric_limits<T>::infinity();
+                std::size_t bestAxis = 0;
+                std::size_t bestBin = 0;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    if (!(extent[axis] > T(0)))
+                        continue;
+
+                    std::array<T, binCount> rightCost{};
+                    AABB<T> right;
+                    std::uint32_t rightCount = 0;
+                    for (std::size_t b = binCount - 1; b > 0; --b)
+                    {
+                        right = right.merge(bins[axis][b].box);
+                        rightCount += bins[axis][b].count;
+                        rightCost[b] = rightCount > 0 ? halfArea(right) * static_cast<T>(rightCount) : T(0);
+                    }
+
+                    AABB<T> left;
+                    std::uint32_t leftCount = 0;
+                    for (std::size_t b = 1; b < binCount; ++b)
+                    {
+                        left = left.merge(bins[axis][b - 1].box);
+                        leftCount += bins[axis][b - 1].count;
+                        if (leftCount == 0 || leftCount == count)
+                            continue;
+
+                        const T cost = halfArea(left) * static_cast<T>(leftCount) + rightCost[b];
+                        if (cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestAxis = axis;
+                            bestBin = b;
+                        }
+                    }
+                }
+
+                if (bestCost == std::numeric_limits<T>::infinity())
+                    return begin;
+
+                // One traversal step costs as much as one primitive test. A flat box makes the ratio NaN, which
+                // keeps small ranges as leaves.
+                const T splitCost = T(1) + bestCost / halfArea(box);
+                if (count <= _options.leafSize && !(splitCost < static_cast<T>(count)))
+                    return begin;
+
+                const auto middle = std::partition(_indices.begin() + begin, _indices.begin() + end,
+                                                   [&](const std::uint32_t primitive)
+                                                   { return binOf(primitive, bestAxis) < bestBin; });
+                return static_cast<std::uint32_t>(middle - _indices.begin());
+            }
+
+
+            /** @brief Partition `[begin, end)` at its median centroid along the widest axis of @p centroidBox. */
+            std::uint32_t medianSplit(const std::uint32_t begin, const std::uint32_t end, const AABB<T>& centroidBox)
+            {
+                const Vector3D<T> extent = centroidBox.max - centroidBox.min;
+                const std::size_t axis = extent.x >= extent.y ? (extent.x >= extent.z ? 0 : 2)
+                                                              : (extent.y >= extent.z ? 1 : 2);
+                const std::uint32_t middle = begin + (end - begin) / 2;
+                std::nth_element(_indices.begin() + begin, _indices.begin() + middle, _indices.begin() + end,
+                                 [&](const std::uint32_t lhs, const std::uint32_t rhs)
+                                 { return _centroids[lhs][axis] < _centroids[rhs][axis]; });
+                return middle;
+            }
+
+
+            std::span<const AABB<T>> _bounds;
+            std::vector<Vector3D<T>> _centroids;
+            std::vector<std::uint32_t>& _indices;
+            const BVHBuildOptions& _options;
+            parallel::ThreadPool& _pool;
+
+            std::vector<BVHBuildNode<T>> _nodes;
+            std::atomic<std::uint32_t> _nodeCount{ 0 };
+        };
+
+
+
+        /** @brief Ray of a @ref BVH query, broadcast to the four lanes of a node. */
+        template <typename T>
+        struct BVHRay
+        {
+            Vector4D<T> originX, originY, originZ;
+            Vector4D<T> inverseX, inverseY, inverseZ; ///< Reciprocal direction, infinite along axes it is parallel to.
+
+            explicit BVHRay(const Ray<T>& ray) noexcept
+                : originX(ray.origin.x, ray.origin.x, ray.origin.x, ray.origin.x),
+                  originY(ray.origin.y, ray.origin.y, ray.origin.y, ray.origin.y),
+                  originZ(ray.origin.z, ray.origin.z, ray.origin.z, ray.origin.z)
+            {
+                const Vector3D<T> inverse(T(1) / ray.direction.x, T(1) / ray.direction.y, T(1) / ray.direction.z);
+                inverseX = Vector4D<T>(inverse.x, inverse.x, inverse.x, inverse.x);
+                inverseY = Vector4D<T>(inverse.y, inverse.y, inverse.y, inverse.y);
+                inverseZ = Vector4D<T>(inverse.z, inverse.z, inverse.z, inverse.z);
+            }
+        };
+
+
+        /** @brief Pending child of a @ref BVH traversal, with the distance the ray enters its box at. */
+        template <typename T>
+        struct BVHStackEntry
+        {
+            std::uint32_t child;
+            std::uint32_t count; ///< Primitives of a leaf, `0` for a node.
+            T entry;
+        };
+
+
+        /**
+         * @brief Slab test of @p ray against every child box of @p node, as @ref Ray::intersects tests one box.
+         *
+         * @param[in]  node     Node to test.
+         * @param[in]  ray      Broadcast ray.
+         * @param[in]  distance Farthest accepted distance.
+         * @param[out] entries  Distance the ray enters each child at.
+         *
+         * @return Bit `i` set if the ray hits child `i` no farther than @p distance.
+         */
+        template <typename T, typename Node>
+        [[nodiscard]] unsigned childHits(const Node& node, const BVHRay<T>& ray, const T distance,
+                                         Vector4D<T>& entries) noexcept
+        {
+            const unsigned used = (1u << node.childCount) - 1u;
+#ifdef FALCON_SIMD_SUPPORTED
+            auto entry = broadcast(T(0));
+            auto exit = broadcast(distance);
+            const auto slab = [&](const Vector4D<T>& low, const Vector4D<T>& high, const Vector4D<T>& origin,
+                                  const Vector4D<T>& inverse)
+            {
+                const auto first = mul(sub(load(low), load(origin)), load(inverse));
+                const auto second = mul(sub(load(high), load(origin)), load(inverse));
+                // min and max return their second operand for NaN lanes, as the scalar test keeps its running value.
+                entry = max(min(first, second), entry);
+                exit = min(max(first, second), exit);
+            };
+            slab(node.minX, node.maxX, ray.originX, ray.inverseX);
+            slab(node.minY, node.maxY, ray.originY, ray.inverseY);
+            slab(node.minZ, node.maxZ, ray.originZ, ray.inverseZ);
+
+            entries = store(entry);
+            return static_cast<unsigned>(compare<Compare::LessEqual>(entry, exit)) & used;
+#else
+            unsigned hits = 0;
+            for (std::size_t lane = 0; lane < 4; ++lane)
+            {
+                const T low[] = { node.minX[lane], node.minY[lane], node.minZ[lane] };
+                const T high[] = { node.maxX[lane], node.maxY[lane], node.maxZ[lane] };
+                const T origin[] = { ray.originX[lane], ray.originY[lane], ray.originZ[lane] };
+                const T inverse[] = { ray.inverseX[lane], ray.inverseY[lane], ray.inverseZ[lane] };
+
+                T entry = T(0);
+                T exit = distance;
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    const T first = (low[axis] - origin[axis]) * inverse[axis];
+                    const T second = (high[axis] - origin[axis]) * inverse[axis];
+                    const T nearer = first < second ? first : second;
+                    const T farther = first > second ? first : second;
+                    entry = nearer > entry ? nearer : entry;
+                    exit = farther < exit ? farther : exit;
+                }
+                entries[lane] = entry;
+                hits |= entry <= exit ? 1u << lane : 0u;
+            }
+            return hits & used;
+#endif
+        }
+    } // namespace detail
+
+
+
+    template <BatchArithmetic T>
+    AABB<T> BVH<T>::Node::bounds(const std::size_t lane) const noexcept
+    {
+        assert(lane < width && "BVH node lane out of range");
+        return { { minX[lane], minY[lane], minZ[lane] }, { maxX[lane], maxY[lane], maxZ[lane] } };
+    }
+
+
+    template <BatchArithmetic T>
+    AABB<T> BVH<T>::Node::bounds() const noexcept
+    {
+        AABB<T> box;
+        for (std::size_t lane = 0; lane < childCount; ++lane)
+            box = box.merge(bounds(lane));
+        return box;
+    }
+
+
+    template <BatchArithmetic T>
+    void BVH<T>::Node::setBounds(const std::size_t lane, const AABB<T>& box) noexcept
+    {
+        assert(lane < width && "BVH node lane out of range");
+        minX[lane] = box.min.x;
+        minY[lane] = box.min.y;
+        minZ[lane] = box.min.z;
+        maxX[lane] = box.max.x;
+        maxY[lane] = box.max.y;
+        maxZ[lane] = box.max.z;
+    }
+
+
+
+    template <BatchArithmetic T>
+    BVH<T>::BVH(const std::span<const AABB<T>> bounds, const BVHBuildOptions& options)
+    {
+        assert(bounds.size() < std::numeric_limits<std::uint32_t>::max() && "BVH primitives must fit 32-bit indices");
+        assert(options.leafSize > 0 && "BVH leaves must hold at least one primitive");
+        if (bounds.empty())
+            return;
+
+        _indices.resize(bounds.size());
+        std::iota(_indices.begin(), _indices.end(), std::uint32_t(0));
+
+        const std::vector<detail::BVHBuildNode<T>> tree = detail::BVHBuilder<T>(bounds, _indices, options).build();
+        _nodes.reserve(tree.size() / 2 + 1);
+        flatten(tree, 0);
+    }
+
+
+    template <BatchArithmetic T>
+    template <typename BuildNode>
+    std::uint32_t BVH<T>::flatten(const std::vector<BuildNode>& tree, const std::uint32_t index)
+    {
+        const auto nodeIndex = static_cast<std::uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+
+        // Open the inner child of largest area until the node is full: the children of a node are then as small as
+        // the tree allows, and a ray misses as many of them as it can.
+        std::array<std::uint32_t, width> children{ index };
+        std::size_t childCount = 1;
+        if (tree[index].count == 0)
+        {
+            children = { tree[index].left, tree[index].left + 1 };
+            childCount = 2;
+        }
+        while (childCount < width)
+        {
+            std::size_t widest = width;
+            T widestArea = T(-1);
+            for (std::size_t c = 0; c < childCount; ++c)
+                if (tree[children[c]].count == 0 && detail::halfArea(tree[children[c]].box) > widestArea)
+                {
+                    widest = c;
+                    widestArea = detail::halfArea(tree[children[c]].box);
+                }
+            if (widest == width)
+                break;
+
+            const std::uint32_t left = tree[children[widest]].left;
+            children[widest] = left;
+            children[childCount++] = left + 1;
+        }
+
+        // Flatten the inner children first: they append to the node array, which may move this node.
+        std::array<std::uint32_t, width> targets{};
+        for (std::size_t c = 0; c < childCount; ++c)
+        {
+            const BuildNode& child = tree[children[c]];
+            targets[c] = child.count > 0 ? child.first : flatten(tree, children[c]);
+        }
+
+        Node& node = _nodes[nodeIndex];
+        node.childCount = static_cast<std::uint32_t>(childCount);
+        for (std::size_t c = 0; c < childCount; ++c)
+        {
+            node.child[c] = targets[c];
+            node.count[c] = tree[children[c]].count;
+            node.setBounds(c, tree[children[c]].box);
+        }
+        return nodeIndex;
+    }
+
+
+
+    template <BatchArithmetic T>
+    std::size_t BVH<T>::size() const noexcept
+    {
+        return _indices.size();
+    }
+
+
+    template <BatchArithmetic T>
+    bool BVH<T>::empty() const noexcept
+    {
+        return _indices.empty();
+    }
+
+
+    template <BatchArithmetic T>
+    AABB<T> BVH<T>::bounds() const noexcept
+    {
+        return _nodes.empty() ? AABB<T>() : _nodes.front().bounds();
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const typename BVH<T>::Node> BVH<T>::nodes() const noexcept
+    {
+        return _nodes;
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const std::uint32_t> BVH<T>::primitiveIndices() const noexcept
+    {
+        return _indices;
+    }
+
+
+
+    template <BatchArithmetic T>
+    template <typename F>
+    bool BVH<T>::closestHit(const Ray<T>& ray, F&& intersect, T& distance, std::uint32_t& primitive) const
+    {
+        if (_nodes.empty())
+            return false;
+
+        // Every node pops one entry and pushes at most four, and the tree is at most maxSahDepth + 32 deep.
+        constexpr std::size_t stackSize = 3 * (maxSahDepth + 32) + 1;
+        const detail::BVHRay<T> slabs(ray);
+        std::array<detail::BVHStackEntry<T>, stackSize> stack;
+        std::size_t top = 0;
+        stack[top++] = { 0, 0, T(0) };
+
+        bool hit = false;
+        while (top > 0)
+        {
+            const detail::BVHStackEntry<T> current = stack[--top];
+            if (current.entry > distance)
+                continue; // A closer hit turned up after this child was pushed
+
+            if (current.count > 0)
+            {
+                for (std::uint32_t i = current.child; i < current.child + current.count; ++i)
+                    if (intersect(_indices[i], ray, distance))
+                    {
+                        hit = true;
+                        primitive = _indices[i];
+                    }
+                continue;
+            }
+
+            // Push the children hit farthest first, so the nearest one is visited next.
+            const Node& node = _nodes[current.child];
+            Vector4D<T> entries;
+            std::array<detail::BVHStackEntry<T>, width> children;
+            std::size_t childCount = 0;
+            for (unsigned lanes = detail::childHits(node, slabs, distance, entries); lanes != 0; lanes &= lanes - 1)
+            {
+                const auto lane = static_cast<std::size_t>(std::countr_zero(lanes));
+                children[childCount++] = { node.child[lane], node.count[lane], entries[lane] };
+            }
+            std::sort(children.begin(), children.begin() + childCount,
+                      [](const auto& lhs, const auto& rhs) { return lhs.entry > rhs.entry; });
+
+            assert(top + childCount <= stackSize && "BVH deeper than its build allows");
+            for (std::size_t c = 0; c < childCount; ++c)
+                stack[top++] = children[c];
+        }
+        return hit;
+    }
+
+
+    template <BatchArithmetic T>
+    template <typename F>
+    bool BVH<T>::anyHit(const Ray<T>& ray, F&& intersect, const T distance) const
+    {
+        if (_nodes.empty())
+            return false;
+
+        constexpr std::size_t stackSize = 3 * (maxSahDepth + 32) + 1;
+        const detail::BVHRay<T> slabs(ray);
+        std::array<std::uint32_t, stackSize> stack;
+        std::size_t top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const Node& node = _nodes[stack[--top]];
+            Vector4D<T> entries;
+            for (unsigned lanes = detail::childHits(node, slabs, distance, entries); lanes != 0; lanes &= lanes - 1)
+            {
+                const auto lane = static_cast<std::size_t>(std::countr_zero(lanes));
+                if (node.count[lane] == 0)
+                {
+                    assert(top < stackSize && "BVH deeper than its build allows");
+                    stack[top++] = node.child[lane];
+                    continue;
+                }
+
+                for (std::uint32_t i = node.child[lane]; i < node.child[lane] + node.count[lane]; ++i)
+                {
+                    T limit = distance;
+                    if (intersect(_indices[i], ray, limit))
+                        return true;
+                }
+            }
+        }
+        return false;
+    }
+
+
+
+    template <BatchArithmetic T>
+    void BVH<T>::refit(const std::span<const AABB<T>> bounds) noexcept
+    {
+        assert(bounds.size() == size() && "Refit bounds must match the primitive count");
+
+        // Children come after their parent, so walking the nodes backwards refits every child before its parent.
+        for (std::size_t n = _nodes.size(); n-- > 0;)
+        {
+            Node& node = _nodes[n];
+            for (std::size_t lane = 0; lane < node.childCount; ++lane)
+            {
+                AABB<T> box;
+                if (node.count[lane] > 0)
+                    for (std::uint32_t i = node.child[lane]; i < node.child[lane] + node.count[lane]; ++i)
+                        box = box.merge(bounds[_indices[i]]);
+                else
+                    box = _nodes[node.child[lane]].bounds();
+                node.setBounds(lane, box);
+            }
+        }
+    }
+
+
+
+    template <BatchArithmetic T>
+    bool TriangleIntersector<T>::operator()(const std::uint32_t primitive, const Ray<T>& ray,
+                                            T& distance) const noexcept
+    {
+        const std::size_t first = std::size_t(primitive) * 3;
+        assert(first + 2 < vertices.size() && "Triangle index out of range");
+        return ray.intersects(vertices[first], vertices[first + 1], vertices[first + 2], distance);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<AABB<T>> triangleBounds(const std::span<const Vector3D<T>> vertices)
+    {
+        assert(vertices.size() % 3 == 0 && "Triangle soups hold three vertices per triangle");
+        std::vector<AABB<T>> bounds;
+        bounds.reserve(vertices.size() / 3);
+        for (std::size_t v = 0; v + 2 < vertices.size(); v += 3)
+            bounds.push_back(AABB<T>().merge(vertices[v]).merge(vertices[v + 1]).merge(vertices[v + 2]));
+        return bounds;
+    }
+} // namespace fgm
@@ -0,0 +1,106 @@
+#pragma once
+/**
+ * @file BoundingVolumes.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Axis-aligned bounding boxes and bounding spheres.
+ *
+ * @details @ref fgm::AABB stores its corners and @ref fgm::Sphere its center and radius, the same layouts the batch
+ *          culling of @ref Culling.h reads from structure-of-arrays buffers. Touching volumes count as
+ *          intersecting, and points on a boundary as contained.
+ *
+ * @tparam T Type of the components. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "vector/Vector3D.h"
+
+#include <concepts>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Primitives
+     * @{
+     */
+
+    /**
+     * @brief Axis-aligned box spanning @ref min to @ref max.
+     * @details A default box is inverted, `min` at `+infinity` and `max` at `-infinity`, like the empty
+     *          @ref Bounds of the vector reductions: it contains nothing and @ref merge leaves any other box as it is.
+     */
+    template <std::floating_point T>
+    struct AABB
+    {
+        using value_type = T;
+
+        Vector3D<T> min; ///< Corner with the smallest components.
+        Vector3D<T> max; ///< Corner with the largest components.
+
+        /** @brief Initialize an empty, inverted box. */
+        constexpr AABB() noexcept;
+
+        /** @brief Initialize from the corners, `min` no larger than `max` in every component. */
+        constexpr AABB(const Vector3D<T>& min, const Vector3D<T>& max) noexcept;
+
+        /** @brief Box around @p center reaching @p extents, all non-negative, along each axis. */
+        [[nodiscard]] static constexpr AABB fromCenterExtents(const Vector3D<T>& center,
+                                                              const Vector3D<T>& extents) noexcept;
+
+        /** @brief Midpoint of the corners. */
+        [[nodiscard]] constexpr Vector3D<T> center() const noexcept;
+
+        /** @brief Half the size along each axis. */
+        [[nodiscard]] constexpr Vector3D<T> extents() const noexcept;
+
+        /** @brief `true` if @p point lies inside or on the box. */
+        [[nodiscard]] constexpr bool contains(const Vector3D<T>& point) const noexcept;
+
+        /** @brief `true` if the boxes overlap or touch. */
+        [[nodiscard]] constexpr bool intersects(const AABB& other) const noexcept;
+
+        /** @brief Smallest box holding both boxes. */
+        [[nodiscard]] constexpr AABB merge(const AABB& other) const noexcept;
+
+        /** @brief Smallest box holding this box and @p point. */
+        [[nodiscard]] constexpr AABB merge(const Vector3D<T>& point) const noexcept;
+    };
+
+
+    /** @brief Sphere around @ref center of @ref radius. */
+    template <std::floating_point T>
+    struct Sphere
+    {
+        using value_type = T;
+
+        Vector3D<T> center; ///< Center.
+        T radius;           ///< Radius, non-negative.
+
+        /** @brief Initialize a sphere of radius zero at the origin. */
+        constexpr Sphere() noexcept;
+
+        /** @brief Initialize from the center and the radius. */
+        constexpr Sphere(const Vector3D<T>& center, T radius) noexcept;
+
+        /** @brief Sphere through the corners of @p box, its radius rounded up so that the corners test as contained. */
+        explicit constexpr Sphere(const AABB<T>& box) noexcept;
+
+        /** @brief `true` if @p point lies inside or on the sphere. */
+        [[nodiscard]] constexpr bool contains(const Vector3D<T>& point) const noexcept;
+
+        /** @brief `true` if the spheres overlap or touch. */
+        [[nodiscard]] constexpr bool intersects(const Sphere& other) const noexcept;
+
+        /** @brief `true` if the point of @p box nearest the center lies inside or on the sphere. */
+        [[nodiscard]] constexpr bool intersects(const AABB<T>& box) const noexcept;
+    };
+
+    /** @} */
+
+} // namespace fgm
+
+#include "BoundingVolumes.tpp"
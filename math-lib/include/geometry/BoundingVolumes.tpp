@@ -0,0 +1,168 @@
+#pragma once
+/**
+ * @file BoundingVolumes.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::AABB and @ref fgm::Sphere template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BoundingVolumes.h"
+
+#include <limits>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        template <typename T>
+        [[nodiscard]] constexpr Vector3D<T> minComponents(const Vector3D<T>& lhs, const Vector3D<T>& rhs) noexcept
+        {
+            return { lhs.x < rhs.x ? lhs.x : rhs.x, lhs.y < rhs.y ? lhs.y : rhs.y, lhs.z < rhs.z ? lhs.z : rhs.z };
+        }
+
+
+        template <typename T>
+        [[nodiscard]] constexpr Vector3D<T> maxComponents(const Vector3D<T>& lhs, const Vector3D<T>& rhs) noexcept
+        {
+            return { lhs.x > rhs.x ? lhs.x : rhs.x, lhs.y > rhs.y ? lhs.y : rhs.y, lhs.z > rhs.z ? lhs.z : rhs.z };
+        }
+
+
+        /** @brief Length of @p extents, rounded up until its square is no smaller than the squared length. */
+        template <typename T>
+        [[nodiscard]] constexpr T enclosingRadius(const Vector3D<T>& extents) noexcept
+        {
+            const T squared = extents.dot(extents);
+            T radius = extents.mag();
+            // A correctly rounded root may square to just below the squared length, leaving the corners outside.
+            while (radius * radius < squared)
+                radius += radius * std::numeric_limits<T>::epsilon();
+            return radius;
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *                AABB               *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr AABB<T>::AABB() noexcept
+        : min(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(),
+              std::numeric_limits<T>::infinity()),
+          max(-std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+              -std::numeric_limits<T>::infinity())
+    {}
+
+
+    template <std::floating_point T>
+    constexpr AABB<T>::AABB(const Vector3D<T>& min, const Vector3D<T>& max) noexcept: min(min), max(max)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr AABB<T> AABB<T>::fromCenterExtents(const Vector3D<T>& center, const Vector3D<T>& extents) noexcept
+    {
+        return { center - extents, center + extents };
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector3D<T> AABB<T>::center() const noexcept
+    {
+        return (min + max) * T(0.5);
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector3D<T> AABB<T>::extents() const noexcept
+    {
+        return (max - min) * T(0.5);
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool AABB<T>::contains(const Vector3D<T>& point) const noexcept
+    {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y && point.z >= min.z &&
+            point.z <= max.z;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool AABB<T>::intersects(const AABB& other) const noexcept
+    {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y &&
+            min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+
+    template <std::floating_point T>
+    constexpr AABB<T> AABB<T>::merge(const AABB& other) const noexcept
+    {
+        return { detail::minComponents(min, other.min), detail::maxComponents(max, other.max) };
+    }
+
+
+    template <std::floating_point T>
+    constexpr AABB<T> AABB<T>::merge(const Vector3D<T>& point) const noexcept
+    {
+        return { detail::minComponents(min, point), detail::maxComponents(max, point) };
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *               SPHERE              *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr Sphere<T>::Sphere() noexcept: center(), radius(T(0))
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Sphere<T>::Sphere(const Vector3D<T>& center, const T radius) noexcept: center(center), radius(radius)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Sphere<T>::Sphere(const AABB<T>& box) noexcept
+        : center(box.center()), radius(detail::enclosingRadius(box.extents()))
+    {}
+
+
+    template <std::floating_point T>
+    constexpr bool Sphere<T>::contains(const Vector3D<T>& point) const noexcept
+    {
+        const Vector3D<T> offset = point - center;
+        return offset.dot(offset) <= radius * radius;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Sphere<T>::intersects(const Sphere& other) const noexcept
+    {
+        const Vector3D<T> offset = other.center - center;
+        const T reach = radius + other.radius;
+        return offset.dot(offset) <= reach * reach;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Sphere<T>::intersects(const AABB<T>& box) const noexcept
+    {
+        const Vector3D<T> nearest = detail::minComponents(detail::maxComponents(center, box.min), box.max);
+        return contains(nearest);
+    }
+} // namespace fgm
@@ -0,0 +1,102 @@
+#pragma once
+/**
+ * @file Culling.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Cull whole buffers of bounding spheres and boxes against a @ref fgm::Frustum.
+ *
+ * @details Volumes are read from structure-of-arrays @ref fgm::Vec4Array buffers: spheres with their centers in
+ *          `x`, `y` and `z` and their radii in `w`, boxes as one array of minimum and one of maximum corners. The cull
+ *          kernels bound by @ref falcon::simd::batchKernels test every plane against a whole register of volumes, 8
+ *          `float` volumes per instruction with AVX2 and 16 with AVX-512, and write one visibility bit per volume.
+ *          - Bit `i % 64` of word `i / 64` is set when volume `i` is kept, as in @ref fgm::Vec4Array::allEq; the
+ *            results are those of @ref fgm::Frustum::intersects, conservative near edges and corners.
+ *          - Inputs larger than @ref fgm::parallel::ChunkOptions::parallelThreshold are split into chunks of whole
+ *            64-bit words, so threads never share an output word.
+ *          - @ref fgm::visibleIndices compacts a visibility bitset into the list of kept indices.
+ *
+ * @note Input arrays of one call must hold the same number of volumes, and bitsets exactly
+ *       @ref fgm::Vec4Array::bitsetWords words; both are checked with `assert`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Frustum.h"
+#include "common/MathTraits.h"
+#include "parallel/Parallel.h"
+#include "vector/Vec4Array.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Culling
+     * @{
+     */
+
+    /**
+     * @brief Write the visibility of every sphere of @p spheres against @p frustum to @p visible.
+     *
+     * @param[in]  frustum Frustum to cull against.
+     * @param[in]  spheres Centers in `x`, `y` and `z`, radii in `w`.
+     * @param[out] visible Destination holding exactly `spheres.bitsetWords()` words.
+     * @param[in]  options Chunking across threads.
+     */
+    template <BatchArithmetic T>
+    void cullSpheres(const Frustum<T>& frustum, const Vec4Array<T>& spheres, std::span<std::uint64_t> visible,
+                     const parallel::ChunkOptions& options = {});
+
+
+    /** @brief Visibility bitset of the spheres of @p spheres against @p frustum, see @ref cullSpheres. */
+    template <BatchArithmetic T>
+    [[nodiscard]] std::vector<std::uint64_t> cullSpheres(const Frustum<T>& frustum, const Vec4Array<T>& spheres,
+                                                         const parallel::ChunkOptions& options = {});
+
+
+    /**
+     * @brief Write the visibility of every box spanning `min[i]` to `max[i]` against @p frustum to @p visible.
+     *
+     * @param[in]  frustum Frustum to cull against.
+     * @param[in]  min     Minimum corners in `x`, `y` and `z`; `w` is ignored.
+     * @param[in]  max     Maximum corners, as many as @p min.
+     * @param[out] visible Destination holding exactly `min.bitsetWords()` words.
+     * @param[in]  options Chunking across threads.
+     */
+    template <BatchArithmetic T>
+    void cullBoxes(const Frustum<T>& frustum, const Vec4Array<T>& min, const Vec4Array<T>& max,
+                   std::span<std::uint64_t> visible, const parallel::ChunkOptions& options = {});
+
+
+    /** @brief Visibility bitset of the boxes spanning @p min to @p max against @p frustum, see @ref cullBoxes. */
+    template <BatchArithmetic T>
+    [[nodiscard]] std::vector<std::uint64_t> cullBoxes(const Frustum<T>& frustum, const Vec4Array<T>& min,
+                                                       const Vec4Array<T>& max,
+                                                       const parallel::ChunkOptions& options = {});
+
+
+    /**
+     * @brief Write the indices of the set bits of @p visible to @p out in increasing order.
+     *
+     * @param[in]  visible Bitset such as the one written by @ref cullSpheres.
+     * @param[out] out     Destination with room for every set bit.
+     *
+     * @return Number of indices written.
+     */
+    std::size_t visibleIndices(std::span<const std::uint64_t> visible, std::span<std::size_t> out) noexcept;
+
+
+    /** @brief Indices of the set bits of @p visible in increasing order. */
+    [[nodiscard]] std::vector<std::size_t> visibleIndices(std::span<const std::uint64_t> visible);
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Culling.tpp"
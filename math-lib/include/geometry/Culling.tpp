@@ -0,0 +1,158 @@
+#pragma once
+/**
+ * @file Culling.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the batch frustum culling.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Culling.h"
+
+#include <Dispatch.h>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Cull kernels of the running CPU for `T`. */
+        template <typename T>
+        [[nodiscard]] const falcon::simd::CullKernels<T>& cullKernels() noexcept
+        {
+            return falcon::simd::batchKernels().get<T>().cull;
+        }
+
+
+        /** @brief The planes of @p frustum as the packed `{a, b, c, d}` quadruples the kernels read. */
+        template <typename T>
+        [[nodiscard]] const T* planeCoefficients(const Frustum<T>& frustum) noexcept
+        {
+            static_assert(sizeof(Plane<T>) == 4 * sizeof(T), "Plane must be packed to be read as 4 elements");
+            return &frustum.planes[0].normal.x;
+        }
+
+
+        /**
+         * @brief Call `cull(first, count, words)` for every chunk of whole 64-bit words of a bitset of @p count
+         *        volumes, concurrently across the pool.
+         *
+         * @param[in] count        Number of volumes.
+         * @param[in] volumeBytes  Input bytes per volume, across every stream.
+         * @param[in] visible      Bitset of `ceil(count / 64)` words.
+         * @param[in] cull         Callable taking the first volume, the number of volumes and their words.
+         * @param[in] options      Chunking options.
+         */
+        template <typename Cull>
+        void forEachBitsetChunk(const std::size_t count, const std::size_t volumeBytes,
+                                const std::span<std::uint64_t> visible, Cull&& cull,
+                                const parallel::ChunkOptions& options)
+        {
+            parallel::for_each_chunk(
+                visible.size(), 64 * volumeBytes,
+                [&](const parallel::ChunkRange& range)
+                {
+                    const std::size_t first = range.begin * 64;
+                    cull(first, std::min(range.end * 64, count) - first, visible.data() + range.begin);
+                },
+                options);
+        }
+    } // namespace detail
+
+
+
+    template <BatchArithmetic T>
+    void cullSpheres(const Frustum<T>& frustum, const Vec4Array<T>& spheres, const std::span<std::uint64_t> visible,
+                     const parallel::ChunkOptions& options)
+    {
+        assert(visible.size() == spheres.bitsetWords() && "Visibility bitset size must match the sphere count");
+
+        const falcon::simd::Vec4Streams<const T> streams = spheres.streams();
+        const T* planes = detail::planeCoefficients(frustum);
+        detail::forEachBitsetChunk(
+            spheres.size(), 4 * sizeof(T), visible,
+            [&](const std::size_t first, const std::size_t count, std::uint64_t* words)
+            {
+                detail::cullKernels<T>().spheres(parallel::detail::offsetStreams(streams, first), planes,
+                                                 Frustum<T>::planeCount, words, count);
+            },
+            options);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<std::uint64_t> cullSpheres(const Frustum<T>& frustum, const Vec4Array<T>& spheres,
+                                           const parallel::ChunkOptions& options)
+    {
+        std::vector<std::uint64_t> visible(spheres.bitsetWords());
+        cullSpheres(frustum, spheres, visible, options);
+        return visible;
+    }
+
+
+    template <BatchArithmetic T>
+    void cullBoxes(const Frustum<T>& frustum, const Vec4Array<T>& min, const Vec4Array<T>& max,
+                   const std::span<std::uint64_t> visible, const parallel::ChunkOptions& options)
+    {
+        assert(min.size() == max.size() && "Box corner arrays must be of equal size");
+        assert(visible.size() == min.bitsetWords() && "Visibility bitset size must match the box count");
+
+        const falcon::simd::Vec4Streams<const T> low = min.streams();
+        const falcon::simd::Vec4Streams<const T> high = max.streams();
+        const T* planes = detail::planeCoefficients(frustum);
+        detail::forEachBitsetChunk(
+            min.size(), 8 * sizeof(T), visible,
+            [&](const std::size_t first, const std::size_t count, std::uint64_t* words)
+            {
+                detail::cullKernels<T>().boxes(parallel::detail::offsetStreams(low, first),
+                                               parallel::detail::offsetStreams(high, first), planes,
+                                               Frustum<T>::planeCount, words, count);
+            },
+            options);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<std::uint64_t> cullBoxes(const Frustum<T>& frustum, const Vec4Array<T>& min, const Vec4Array<T>& max,
+                                         const parallel::ChunkOptions& options)
+    {
+        std::vector<std::uint64_t> visible(min.bitsetWords());
+        cullBoxes(frustum, min, max, visible, options);
+        return visible;
+    }
+
+
+    inline std::size_t visibleIndices(const std::span<const std::uint64_t> visible,
+                                      const std::span<std::size_t> out) noexcept
+    {
+        std::size_t written = 0;
+        for (std::size_t word = 0; word < visible.size(); ++word)
+        {
+            // Clearing the lowest set bit each step visits only the kept volumes.
+            for (std::uint64_t bits = visible[word]; bits != 0; bits &= bits - 1)
+            {
+                assert(written < out.size() && "Index list too small for the visible volumes");
+                out[written++] = word * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+            }
+        }
+        return written;
+    }
+
+
+    inline std::vector<std::size_t> visibleIndices(const std::span<const std::uint64_t> visible)
+    {
+        std::size_t total = 0;
+        for (const std::uint64_t bits : visible)
+            total += static_cast<std::size_t>(std::popcount(bits));
+
+        std::vector<std::size_t> indices(total);
+        visibleIndices(visible, indices);
+        return indices;
+    }
+} // namespace fgm
@@ -0,0 +1,98 @@
+#pragma once
+/**
+ * @file Frustum.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief View frustum as six inward facing planes, extracted from a view-projection matrix.
+ *
+ * @details @ref fgm::Frustum::fromMatrix reads the planes off the rows of the matrix (Gribb and Hartmann): a point
+ *          `p` is inside when every clip-space coordinate of `M * (p, 1)` lies within `[-w, w]`, or `[0, w]` for the
+ *          depth of @ref fgm::ClipDepth::ZeroToOne, and each of these bounds is one plane of row combinations. The
+ *          planes are normalized, so sphere tests compare true distances against radii.
+ *
+ *          Volume tests are conservative: a volume outside the frustum but not entirely outside any one plane, near
+ *          its edges and corners, is reported as intersecting. Culling only draws such volumes needlessly, it never
+ *          drops a visible one.
+ *
+ * @tparam T Type of the plane coefficients. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BoundingVolumes.h"
+#include "Plane.h"
+#include "matrix/Matrix4D.h"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Primitives
+     * @{
+     */
+
+    /** @brief Clip-space depth range of a projection matrix. */
+    enum class ClipDepth : std::uint8_t
+    {
+        NegativeOneToOne, ///< OpenGL convention, `-w <= z <= w`.
+        ZeroToOne         ///< Direct3D, Metal and Vulkan convention, `0 <= z <= w`.
+    };
+
+
+    /** @brief Index of each plane in @ref Frustum::planes. */
+    enum class FrustumPlane : std::uint8_t
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far
+    };
+
+
+    template <std::floating_point T>
+    struct Frustum
+    {
+        using value_type = T;
+
+        static constexpr std::size_t planeCount = 6;
+
+        /** @brief Unit-normal planes facing the inside, in @ref FrustumPlane order. */
+        Plane<T> planes[planeCount];
+
+        /**
+         * @brief Frustum of the view-projection matrix @p viewProjection, mapping world to clip space.
+         * @details With an infinite far plane, the far row combination has a zero normal and a positive constant
+         *          term. @ref Plane::normalize keeps it as it is, so it contains every point.
+         *
+         * @param[in] viewProjection Projection times view, acting on column vectors.
+         * @param[in] depth          Depth range the projection maps to.
+         */
+        [[nodiscard]] static constexpr Frustum fromMatrix(const Matrix4D<T>& viewProjection,
+                                                          ClipDepth depth = ClipDepth::NegativeOneToOne) noexcept;
+
+        /** @brief The plane at @p index. */
+        [[nodiscard]] constexpr const Plane<T>& plane(FrustumPlane index) const noexcept;
+
+        /** @brief `true` if @p point is inside or on every plane. */
+        [[nodiscard]] constexpr bool contains(const Vector3D<T>& point) const noexcept;
+
+        /** @brief `false` if @p sphere lies entirely outside one plane, conservatively `true` otherwise. */
+        [[nodiscard]] constexpr bool intersects(const Sphere<T>& sphere) const noexcept;
+
+        /** @brief `false` if @p box lies entirely outside one plane, conservatively `true` otherwise. */
+        [[nodiscard]] constexpr bool intersects(const AABB<T>& box) const noexcept;
+    };
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Frustum.tpp"
@@ -0,0 +1,81 @@
+#pragma once
+/**
+ * @file Frustum.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Frustum template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Frustum.h"
+#include "common/ConstexprMath.h"
+
+#include <cassert>
+
+
+namespace fgm
+{
+    template <std::floating_point T>
+    constexpr Frustum<T> Frustum<T>::fromMatrix(const Matrix4D<T>& viewProjection, const ClipDepth depth) noexcept
+    {
+        const auto row = [&viewProjection](const std::size_t r)
+        {
+            return Vector4D<T>(viewProjection(r, 0), viewProjection(r, 1), viewProjection(r, 2),
+                               viewProjection(r, 3));
+        };
+        const Vector4D<T> x = row(0), y = row(1), z = row(2), w = row(3);
+
+        // -w <= x <= w gives the planes w + x >= 0 and w - x >= 0, and likewise for y and z.
+        const Vector4D<T> nearRow = depth == ClipDepth::ZeroToOne ? z : w + z;
+        return { { Plane<T>(w + x).normalize(), Plane<T>(w - x).normalize(), Plane<T>(w + y).normalize(),
+                   Plane<T>(w - y).normalize(), Plane<T>(nearRow).normalize(), Plane<T>(w - z).normalize() } };
+    }
+
+
+    template <std::floating_point T>
+    constexpr const Plane<T>& Frustum<T>::plane(const FrustumPlane index) const noexcept
+    {
+        assert(static_cast<std::size_t>(index) < planeCount && "Frustum plane index out of range");
+        return planes[static_cast<std::size_t>(index)];
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Frustum<T>::contains(const Vector3D<T>& point) const noexcept
+    {
+        for (const Plane<T>& plane : planes)
+            if (plane.signedDistance(point) < T(0))
+                return false;
+        return true;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Frustum<T>::intersects(const Sphere<T>& sphere) const noexcept
+    {
+        for (const Plane<T>& plane : planes)
+            if (plane.signedDistance(sphere.center) < -sphere.radius)
+                return false;
+        return true;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Frustum<T>::intersects(const AABB<T>& box) const noexcept
+    {
+        const Vector3D<T> center = box.center();
+        const Vector3D<T> extents = box.extents();
+        for (const Plane<T>& plane : planes)
+        {
+            // Reach of the box along the normal, from its center to the corner farthest inside.
+            const T reach = fgm::abs(plane.normal.x) * extents.x + fgm::abs(plane.normal.y) * extents.y +
+                fgm::abs(plane.normal.z) * extents.z;
+            if (plane.signedDistance(center) < -reach)
+                return false;
+        }
+        return true;
+    }
+} // namespace fgm
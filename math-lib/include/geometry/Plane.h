@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file Plane.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Templated plane in 3D space, `normal.dot(p) + offset = 0`.
+ *
+ * @details @ref fgm::Plane stores its four coefficients `{a, b, c, d}` packed, so an array of planes can be handed to
+ *          the culling kernels of @ref Dispatch.h as is. The side the normal points to is the inside: points there
+ *          have a positive @ref fgm::Plane::signedDistance. Distances are only true distances for a unit normal; use
+ *          @ref fgm::Plane::normalize before measuring them.
+ *
+ * @tparam T Type of the coefficients. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "vector/Vector3D.h"
+#include "vector/Vector4D.h"
+
+#include <concepts>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Primitives
+     * @{
+     */
+
+    template <std::floating_point T>
+    struct Plane
+    {
+        using value_type = T;
+
+        Vector3D<T> normal; ///< Normal `{a, b, c}`, pointing to the inside.
+        T offset;           ///< Constant term `d`; with a unit normal, minus the distance of the plane from the origin.
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize the plane `z = 0`, with its inside towards `+z`. */
+        constexpr Plane() noexcept;
+
+        /** @brief Initialize from the normal `{a, b, c}` and the constant term `d`. */
+        constexpr Plane(const Vector3D<T>& normal, T offset) noexcept;
+
+        /** @brief Initialize from the coefficients `{a, b, c, d}`. */
+        explicit constexpr Plane(const Vector4D<T>& coefficients) noexcept;
+
+        /**
+         * @brief Plane through @p point, facing @p normal.
+         *
+         * @param[in] point  Any point on the plane.
+         * @param[in] normal Normal pointing to the inside, kept as it is.
+         */
+        [[nodiscard]] static constexpr Plane fromPointNormal(const Vector3D<T>& point,
+                                                             const Vector3D<T>& normal) noexcept;
+
+        /**
+         * @brief Plane through three points, with a unit normal facing the side they wind counter-clockwise around.
+         * @warning The points must not be collinear.
+         */
+        [[nodiscard]] static constexpr Plane fromPoints(const Vector3D<T>& a, const Vector3D<T>& b,
+                                                        const Vector3D<T>& c) noexcept;
+
+
+        /*************************************
+         *                                   *
+         *            OPERATIONS             *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief `normal.dot(point) + offset`, positive on the inside.
+         * @note A true distance only if the normal has unit length.
+         */
+        [[nodiscard]] constexpr T signedDistance(const Vector3D<T>& point) const noexcept;
+
+        /**
+         * @brief Plane scaled to a unit normal, so that @ref signedDistance measures distances.
+         * @details A plane with a zero normal has no orientation and is returned as it is.
+         */
+        [[nodiscard]] constexpr Plane normalize() const noexcept;
+
+        /** @brief The coefficients `{a, b, c, d}`. */
+        [[nodiscard]] constexpr Vector4D<T> coefficients() const noexcept;
+    };
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Plane.tpp"
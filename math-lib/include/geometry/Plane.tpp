@@ -0,0 +1,71 @@
+#pragma once
+/**
+ * @file Plane.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Plane template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Plane.h"
+#include "common/ConstexprMath.h"
+
+
+namespace fgm
+{
+    template <std::floating_point T>
+    constexpr Plane<T>::Plane() noexcept: normal(T(0), T(0), T(1)), offset(T(0))
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Plane<T>::Plane(const Vector3D<T>& normal, const T offset) noexcept: normal(normal), offset(offset)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Plane<T>::Plane(const Vector4D<T>& coefficients) noexcept
+        : normal(coefficients.x, coefficients.y, coefficients.z), offset(coefficients.w)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Plane<T> Plane<T>::fromPointNormal(const Vector3D<T>& point, const Vector3D<T>& normal) noexcept
+    {
+        return { normal, -normal.dot(point) };
+    }
+
+
+    template <std::floating_point T>
+    constexpr Plane<T> Plane<T>::fromPoints(const Vector3D<T>& a, const Vector3D<T>& b, const Vector3D<T>& c) noexcept
+    {
+        return fromPointNormal(a, (b - a).cross(c - a).normalize());
+    }
+
+
+    template <std::floating_point T>
+    constexpr T Plane<T>::signedDistance(const Vector3D<T>& point) const noexcept
+    {
+        return normal.dot(point) + offset;
+    }
+
+
+    template <std::floating_point T>
+    constexpr Plane<T> Plane<T>::normalize() const noexcept
+    {
+        const T length = fgm::sqrt(normal.dot(normal));
+        if (length == T(0))
+            return *this;
+        return { normal / length, offset / length };
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector4D<T> Plane<T>::coefficients() const noexcept
+    {
+        return { normal, offset };
+    }
+} // namespace fgm
@@ -0,0 +1,101 @@
+#pragma once
+/**
+ * @file Ray.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Ray from an origin along a direction, with triangle, box and sphere intersection tests.
+ *
+ * @details Distances are ray parameters: the point at distance `t` is `origin + t * direction`, a true distance only
+ *          for a unit direction. Every test takes the farthest distance it accepts a hit at and, on a hit, overwrites
+ *          it with the hit distance, so testing one ray against many primitives leaves the closest hit behind:
+ *
+ *          @code
+ *          float closest = std::numeric_limits<float>::infinity();
+ *          for (std::size_t i = 0; i + 2 < vertices.size(); i += 3)
+ *              if (ray.intersects(vertices[i], vertices[i + 1], vertices[i + 2], closest))
+ *                  hitTriangle = i / 3;
+ *          @endcode
+ *
+ *          The tests compute exactly what the packet tests of @ref RayPacket.h compute for one lane, apart from the
+ *          rounding of fused multiply-adds.
+ *
+ * @tparam T Type of the components. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BoundingVolumes.h"
+#include "vector/Vector3D.h"
+
+#include <concepts>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Rays
+     * @{
+     */
+
+    template <std::floating_point T>
+    struct Ray
+    {
+        using value_type = T;
+
+        Vector3D<T> origin;    ///< Start of the ray.
+        Vector3D<T> direction; ///< Direction, and the length of one distance unit along the ray.
+
+        /** @brief Initialize a ray from the origin along `+z`. */
+        constexpr Ray() noexcept;
+
+        /** @brief Initialize from the origin and the direction, which should not be zero. */
+        constexpr Ray(const Vector3D<T>& origin, const Vector3D<T>& direction) noexcept;
+
+        /** @brief Point at @p distance along the ray, `origin + distance * direction`. */
+        [[nodiscard]] constexpr Vector3D<T> at(T distance) const noexcept;
+
+
+        /**
+         * @brief Möller–Trumbore test against the triangle @p a, @p b, @p c.
+         * @details Both faces are hit; rays in the plane of the triangle and degenerate triangles are missed.
+         *
+         * @param[in]     a, b, c  Vertices of the triangle.
+         * @param[in,out] distance Farthest distance a hit is accepted at; set to the hit distance on a hit.
+         *
+         * @return `true` if the ray hits the triangle between distance `0` and @p distance.
+         */
+        constexpr bool intersects(const Vector3D<T>& a, const Vector3D<T>& b, const Vector3D<T>& c,
+                                  T& distance) const noexcept;
+
+        /**
+         * @brief Slab test against @p box.
+         * @details A ray starting inside the box hits at distance `0`. A ray with NaN components hits every box at
+         *          distance `0`, erring towards hitting as a traversal test should; a ray lying exactly in the plane of
+         *          a face may hit or miss.
+         *
+         * @param[in]     box      Box to test.
+         * @param[in,out] distance Farthest distance a hit is accepted at; set to the entry distance on a hit.
+         *
+         * @return `true` if the ray enters the box between distance `0` and @p distance.
+         */
+        constexpr bool intersects(const AABB<T>& box, T& distance) const noexcept;
+
+        /**
+         * @brief Test against @p sphere.
+         * @details A ray starting inside the sphere hits where it leaves it.
+         *
+         * @param[in]     sphere   Sphere to test.
+         * @param[in,out] distance Farthest distance a hit is accepted at; set to the hit distance on a hit.
+         *
+         * @return `true` if the ray hits the surface of the sphere between distance `0` and @p distance.
+         */
+        constexpr bool intersects(const Sphere<T>& sphere, T& distance) const noexcept;
+    };
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Ray.tpp"
@@ -0,0 +1,116 @@
+#pragma once
+/**
+ * @file Ray.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Ray template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Ray.h"
+#include "common/ConstexprMath.h"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+
+namespace fgm
+{
+    template <std::floating_point T>
+    constexpr Ray<T>::Ray() noexcept: origin(T(0), T(0), T(0)), direction(T(0), T(0), T(1))
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Ray<T>::Ray(const Vector3D<T>& origin, const Vector3D<T>& direction) noexcept
+        : origin(origin), direction(direction)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Vector3D<T> Ray<T>::at(const T distance) const noexcept
+    {
+        return origin + direction * distance;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Ray<T>::intersects(const Vector3D<T>& a, const Vector3D<T>& b, const Vector3D<T>& c,
+                                      T& distance) const noexcept
+    {
+        // Solve origin + t * direction = a + u * (b - a) + v * (c - a) by Cramer's rule. A zero determinant turns u into
+        // NaN or an infinity, which fails the barycentric tests below.
+        const Vector3D<T> edgeB = b - a;
+        const Vector3D<T> edgeC = c - a;
+        const Vector3D<T> p = direction.cross(edgeC);
+        const T determinant = edgeB.dot(p);
+        if (std::is_constant_evaluated() && determinant == T(0))
+            return false; // Division by zero is no constant expression; at run time the tests below miss anyway
+        const T inverseDeterminant = T(1) / determinant;
+
+        const Vector3D<T> s = origin - a;
+        const Vector3D<T> q = s.cross(edgeB);
+        const T u = s.dot(p) * inverseDeterminant;
+        const T v = direction.dot(q) * inverseDeterminant;
+        const T t = edgeC.dot(q) * inverseDeterminant;
+
+        if (!(T(0) <= u && T(0) <= v && u + v <= T(1) && T(0) <= t && t <= distance))
+            return false;
+        distance = t;
+        return true;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Ray<T>::intersects(const AABB<T>& box, T& distance) const noexcept
+    {
+        T entry = T(0);
+        T exit = distance;
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            // Division by zero is no constant expression. Its infinity scales both crossing distances alike, so
+            // its sign never changes the outcome.
+            const T inverse = std::is_constant_evaluated() && direction[axis] == T(0)
+                                  ? std::numeric_limits<T>::infinity()
+                                  : T(1) / direction[axis];
+            const T first = (box.min[axis] - origin[axis]) * inverse;
+            const T second = (box.max[axis] - origin[axis]) * inverse;
+
+            // Each comparison keeps the running value when the other side is NaN, as the packet min and max do.
+            const T nearer = first < second ? first : second;
+            const T farther = first > second ? first : second;
+            entry = nearer > entry ? nearer : entry;
+            exit = farther < exit ? farther : exit;
+        }
+
+        if (!(entry <= exit))
+            return false;
+        distance = entry;
+        return true;
+    }
+
+
+    template <std::floating_point T>
+    constexpr bool Ray<T>::intersects(const Sphere<T>& sphere, T& distance) const noexcept
+    {
+        const Vector3D<T> offset = origin - sphere.center;
+        const T a = direction.dot(direction);
+        const T b = offset.dot(direction);
+        const T c = offset.dot(offset) - sphere.radius * sphere.radius;
+
+        // A negative discriminant makes both roots NaN, which fails the range test.
+        const T root = fgm::sqrt(b * b - a * c);
+        const T entry = (-b - root) / a;
+        const T exit = (root - b) / a;
+        const T t = entry < T(0) ? exit : entry;
+
+        if (!(T(0) <= t && t <= distance))
+            return false;
+        distance = t;
+        return true;
+    }
+} // namespace fgm
@@ -0,0 +1,129 @@
+#pragma once
+/**
+ * @file RayPacket.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Structure-of-arrays packets of rays intersected with one primitive at a time.
+ *
+ * @details @ref fgm::RayPacket keeps its origins and directions in two @ref fgm::Vec4Array buffers, `w` unused. The
+ *          ray kernels bound by @ref falcon::simd::batchKernels test a whole register of rays against the primitive
+ *          at once, 8 `float` rays per instruction with AVX2 and 16 with AVX-512, and each lane computes what
+ *          @ref fgm::Ray::intersects computes for its ray.
+ *          - `distances[i]` is read and written as the `distance` of @ref fgm::Ray::intersects: the farthest
+ *            accepted hit on entry, the hit distance where ray `i` hits on return. Tracing a packet against many
+ *            primitives leaves the closest hits behind.
+ *          - Bit `i % 64` of word `i / 64` of the hit bitset is set when ray `i` hits this primitive, as in
+ *            @ref fgm::Vec4Array::allEq, so @ref fgm::visibleIndices lists the rays that hit.
+ *
+ * @note Distances must hold exactly @ref fgm::RayPacket::size elements and hit bitsets exactly
+ *       @ref fgm::RayPacket::bitsetWords words; both are checked with `assert`, as is that both buffers hold the same
+ *       number of rays.
+ *
+ * @tparam T Type of the components. Must be `float` or `double`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BoundingVolumes.h"
+#include "Ray.h"
+#include "common/MathTraits.h"
+#include "vector/Vec4Array.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Geometry_Rays
+     * @{
+     */
+
+    template <BatchArithmetic T>
+    struct RayPacket
+    {
+        using value_type = T;
+
+        Vec4Array<T> origins;    ///< Start of every ray in `x`, `y` and `z`.
+        Vec4Array<T> directions; ///< Direction of every ray in `x`, `y` and `z`, as many as @ref origins.
+
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize an empty packet. */
+        RayPacket() noexcept = default;
+
+        /** @brief Initialize from @p rays, in order. */
+        explicit RayPacket(std::span<const Ray<T>> rays);
+
+
+        /*************************************
+         *                                   *
+         *              ACCESS               *
+         *                                   *
+         *************************************/
+
+        /** @brief Number of rays. */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /** @brief Number of 64-bit words of a hit bitset, `ceil(size() / 64)`. */
+        [[nodiscard]] std::size_t bitsetWords() const noexcept;
+
+        /** @brief Append @p ray. */
+        void push_back(const Ray<T>& ray);
+
+        /**
+         * @brief Ray at index @p i.
+         * @warning @p i must be less than @ref size; checked with `assert`.
+         */
+        [[nodiscard]] Ray<T> operator[](std::size_t i) const noexcept;
+
+
+        /*************************************
+         *                                   *
+         *           INTERSECTION            *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Intersect every ray with the triangle @p a, @p b, @p c.
+         *
+         * @param[in]     a, b, c   Vertices of the triangle.
+         * @param[in,out] distances Farthest accepted distance per ray; set to the hit distance where a ray hits.
+         * @param[out]    hits      Bitset of the rays that hit.
+         */
+        void intersect(const Vector3D<T>& a, const Vector3D<T>& b, const Vector3D<T>& c, std::span<T> distances,
+                       std::span<std::uint64_t> hits) const noexcept;
+
+        /**
+         * @brief Intersect every ray with @p box, hitting at the entry distance.
+         *
+         * @param[in]     box       Box to test.
+         * @param[in,out] distances Farthest accepted distance per ray; set to the entry distance where a ray hits.
+         * @param[out]    hits      Bitset of the rays that hit.
+         */
+        void intersect(const AABB<T>& box, std::span<T> distances, std::span<std::uint64_t> hits) const noexcept;
+
+        /**
+         * @brief Intersect every ray with @p sphere.
+         *
+         * @param[in]     sphere    Sphere to test.
+         * @param[in,out] distances Farthest accepted distance per ray; set to the hit distance where a ray hits.
+         * @param[out]    hits      Bitset of the rays that hit.
+         */
+        void intersect(const Sphere<T>& sphere, std::span<T> distances, std::span<std::uint64_t> hits) const noexcept;
+    };
+
+    /** @} */
+
+} // namespace fgm
+
+#include "RayPacket.tpp"
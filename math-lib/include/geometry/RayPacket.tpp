@@ -0,0 +1,115 @@
+#pragma once
+/**
+ * @file RayPacket.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::RayPacket template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "RayPacket.h"
+
+#include <Dispatch.h>
+#include <cassert>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Ray kernels of the running CPU for `T`. */
+        template <typename T>
+        [[nodiscard]] const falcon::simd::RayKernels<T>& rayKernels() noexcept
+        {
+            return falcon::simd::batchKernels().get<T>().ray;
+        }
+    } // namespace detail
+
+
+
+    template <BatchArithmetic T>
+    RayPacket<T>::RayPacket(const std::span<const Ray<T>> rays)
+    {
+        origins.reserve(rays.size());
+        directions.reserve(rays.size());
+        for (const Ray<T>& ray : rays)
+            push_back(ray);
+    }
+
+
+    template <BatchArithmetic T>
+    std::size_t RayPacket<T>::size() const noexcept
+    {
+        return origins.size();
+    }
+
+
+    template <BatchArithmetic T>
+    std::size_t RayPacket<T>::bitsetWords() const noexcept
+    {
+        return origins.bitsetWords();
+    }
+
+
+    template <BatchArithmetic T>
+    void RayPacket<T>::push_back(const Ray<T>& ray)
+    {
+        origins.push_back({ ray.origin.x, ray.origin.y, ray.origin.z, T(0) });
+        directions.push_back({ ray.direction.x, ray.direction.y, ray.direction.z, T(0) });
+    }
+
+
+    template <BatchArithmetic T>
+    Ray<T> RayPacket<T>::operator[](const std::size_t i) const noexcept
+    {
+        assert(i < size() && "Ray index out of range");
+        const Vector4D<T> origin = origins[i];
+        const Vector4D<T> direction = directions[i];
+        return { { origin.x, origin.y, origin.z }, { direction.x, direction.y, direction.z } };
+    }
+
+
+    template <BatchArithmetic T>
+    void RayPacket<T>::intersect(const Vector3D<T>& a, const Vector3D<T>& b, const Vector3D<T>& c,
+                                 const std::span<T> distances, const std::span<std::uint64_t> hits) const noexcept
+    {
+        assert(origins.size() == directions.size() && "Ray origin and direction arrays must be of equal size");
+        assert(distances.size() == size() && "Distance count must match the ray count");
+        assert(hits.size() == bitsetWords() && "Hit bitset size must match the ray count");
+
+        const T triangle[] = { a.x, a.y, a.z, b.x, b.y, b.z, c.x, c.y, c.z };
+        detail::rayKernels<T>().triangle(origins.streams(), directions.streams(), triangle, distances.data(),
+                                         hits.data(), size());
+    }
+
+
+    template <BatchArithmetic T>
+    void RayPacket<T>::intersect(const AABB<T>& box, const std::span<T> distances,
+                                 const std::span<std::uint64_t> hits) const noexcept
+    {
+        assert(origins.size() == directions.size() && "Ray origin and direction arrays must be of equal size");
+        assert(distances.size() == size() && "Distance count must match the ray count");
+        assert(hits.size() == bitsetWords() && "Hit bitset size must match the ray count");
+
+        const T corners[] = { box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z };
+        detail::rayKernels<T>().box(origins.streams(), directions.streams(), corners, distances.data(), hits.data(),
+                                    size());
+    }
+
+
+    template <BatchArithmetic T>
+    void RayPacket<T>::intersect(const Sphere<T>& sphere, const std::span<T> distances,
+                                 const std::span<std::uint64_t> hits) const noexcept
+    {
+        assert(origins.size() == directions.size() && "Ray origin and direction arrays must be of equal size");
+        assert(distances.size() == size() && "Distance count must match the ray count");
+        assert(hits.size() == bitsetWords() && "Hit bitset size must match the ray count");
+
+        const T bounds[] = { sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius };
+        detail::rayKernels<T>().sphere(origins.streams(), directions.streams(), bounds, distances.data(), hits.data(),
+                                       size());
+    }
+} // namespace fgm
@@ -0,0 +1,177 @@
+#pragma once
+/**
+ * @file Affine3D.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Templated 3D affine transformation stored as a 3x4 matrix.
+ *
+ * @details @ref fgm::Affine3D keeps the three basis columns of its linear block and its translation, column-major, in
+ *          twelve elements; the implied bottom row `(0, 0, 0, 1)` of the matching @ref fgm::Matrix4D is never stored
+ *          or multiplied. Composition, inversion and the point and direction transforms follow from that structure:
+ *          a composition is a 3x3 product plus one transformed translation, and the inverse only inverts the 3x3
+ *          block, or transposes it for rigid transformations.
+ *
+ * @tparam T Type of the elements. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Matrix3D.h"
+#include "Matrix4D.h"
+#include "common/OperationStatus.h"
+#include "quaternion/Quaternion.h"
+#include "vector/Vector3D.h"
+#include "vector/Vector4D.h"
+
+#include <concepts>
+#include <cstddef>
+
+
+namespace fgm
+{
+    template <std::floating_point T>
+    struct Affine3D
+    {
+        using value_type = T;
+
+        static constexpr std::size_t columns = 4;
+        static constexpr std::size_t rows = 3;
+
+        /** @brief Basis columns 0 to 2 (the linear block) and the translation in column 3. */
+        union {
+            Vector3D<T> col_vectors[columns];
+            T elements[columns][rows];
+        };
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize the identity transformation. */
+        Affine3D() noexcept;
+
+        /** @brief Initialize from the three basis columns of the linear block and the translation. */
+        Affine3D(const Vector3D<T>& col0, const Vector3D<T>& col1, const Vector3D<T>& col2,
+                 const Vector3D<T>& translation) noexcept;
+
+        /** @brief Initialize from a linear block and a translation applied after it. */
+        explicit Affine3D(const Matrix3D<T>& linear, const Vector3D<T>& translation = Vector3D<T>()) noexcept;
+
+        /**
+         * @brief Initialize from the upper 3x4 block of @p matrix.
+         * @note The bottom row is dropped, so projective matrices lose their projection.
+         */
+        explicit Affine3D(const Matrix4D<T>& matrix) noexcept;
+
+        /**
+         * @brief Scale, then rotate, then translate, `T * R * S`.
+         *
+         * @param[in] translation Translation applied last.
+         * @param[in] rotation    Unit quaternion applied second.
+         * @param[in] scale       Per-axis scale applied first.
+         */
+        [[nodiscard]] static Affine3D fromTRS(const Vector3D<T>& translation, const Quaternion<T>& rotation,
+                                              const Vector3D<T>& scale = Vector3D<T>(T(1), T(1), T(1))) noexcept;
+
+
+        /*************************************
+         *                                   *
+         *            ACCESSORS              *
+         *                                   *
+         *************************************/
+
+        Vector3D<T>& operator[](std::size_t index);
+        const Vector3D<T>& operator[](std::size_t index) const;
+
+        T& operator()(std::size_t row, std::size_t col);
+        const T& operator()(std::size_t row, std::size_t col) const;
+
+        /** @brief Upper-left 3x3 block. */
+        [[nodiscard]] Matrix3D<T> linear() const;
+
+        /** @brief Translation column. */
+        [[nodiscard]] const Vector3D<T>& translation() const noexcept;
+
+        /** @brief Equivalent 4x4 matrix, with `(0, 0, 0, 1)` as its bottom row. */
+        [[nodiscard]] Matrix4D<T> toMatrix4D() const noexcept;
+
+        /** @brief @copybrief toMatrix4D */
+        [[nodiscard]] explicit operator Matrix4D<T>() const noexcept;
+
+
+        /*************************************
+         *                                   *
+         *          TRANSFORMATION           *
+         *                                   *
+         *************************************/
+
+        /** @brief Transform a point, `L * p + t`. */
+        [[nodiscard]] Vector3D<T> transformPoint(const Vector3D<T>& point) const noexcept;
+
+        /** @brief Transform a direction with the linear block only, `L * d`. */
+        [[nodiscard]] Vector3D<T> transformDirection(const Vector3D<T>& direction) const noexcept;
+
+        /**
+         * @brief Transform a homogeneous vector, `L * v.xyz + t * v.w`, keeping `w`.
+         * @details Matches @ref Matrix4D::operator* for the equivalent matrix without computing the bottom row.
+         */
+        [[nodiscard]] Vector4D<T> operator*(const Vector4D<T>& vec) const noexcept;
+
+        /**
+         * @brief Compose two transformations, `A * B` applies @p other first.
+         * @details Multiplies the 3x3 blocks and transforms the translation of @p other as a point, 36 multiplies
+         *          against the 64 of the equivalent @ref Matrix4D product.
+         */
+        [[nodiscard]] Affine3D operator*(const Affine3D& other) const noexcept;
+
+        /** @brief Compose with @p other on the right, `A = A * B`. */
+        Affine3D& operator*=(const Affine3D& other) noexcept;
+
+
+        /*************************************
+         *                                   *
+         *        MATRIX OPERATIONS          *
+         *                                   *
+         *************************************/
+
+        /** @brief Determinant of the linear block, which is also that of the equivalent 4x4 matrix. */
+        [[nodiscard]] T determinant() const noexcept;
+
+        /**
+         * @brief Invert a general affine transformation through the 3x3 inverse of its linear block.
+         *
+         * @return The inverse, or the identity if the determinant is within @ref Config::EPSILON of zero.
+         *
+         * @note Use @ref tryInverse to tell a singular transformation apart from an identity result.
+         */
+        [[nodiscard]] Affine3D inverse() const noexcept;
+
+        /**
+         * @brief Compute the inverse, reporting why it failed instead of returning a fallback.
+         *
+         * @param[out] out Receives the inverse on success; left untouched otherwise.
+         *
+         * @return @ref OperationStatus::SUCCESS, @ref OperationStatus::NANOPERAND if the determinant is NaN, or
+         *         @ref OperationStatus::DIVISIONBYZERO if the determinant is within @ref Config::EPSILON of zero.
+         */
+        [[nodiscard]] OperationStatus tryInverse(Affine3D& out) const noexcept;
+
+        /**
+         * @brief Invert a rigid transformation, `(R^T, -R^T t)`.
+         * @warning Only valid when the linear block is orthonormal (rotations and reflections); scaled or sheared
+         *          blocks must use @ref inverse.
+         */
+        [[nodiscard]] Affine3D inverseRigid() const noexcept;
+    };
+
+
+    using affine3 = Affine3D<float>;   ///< `float` affine transformation
+    using dAffine3 = Affine3D<double>; ///< `double` affine transformation
+
+} // namespace fgm
+
+#include "Affine3D.tpp"
@@ -0,0 +1,252 @@
+#pragma once
+/**
+ * @file Affine3D.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Affine3D template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Affine3D.h"
+#include "common/Config.h"
+
+#include <cassert>
+#include <cmath>
+
+
+namespace fgm
+{
+    /*************************************
+     *                                   *
+     *            INITIALIZERS           *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    Affine3D<T>::Affine3D() noexcept
+    {
+        col_vectors[0] = Vector3D<T>(T(1), T(0), T(0));
+        col_vectors[1] = Vector3D<T>(T(0), T(1), T(0));
+        col_vectors[2] = Vector3D<T>(T(0), T(0), T(1));
+        col_vectors[3] = Vector3D<T>(T(0), T(0), T(0));
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T>::Affine3D(const Vector3D<T>& col0, const Vector3D<T>& col1, const Vector3D<T>& col2,
+                          const Vector3D<T>& translation) noexcept
+    {
+        col_vectors[0] = col0;
+        col_vectors[1] = col1;
+        col_vectors[2] = col2;
+        col_vectors[3] = translation;
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T>::Affine3D(const Matrix3D<T>& linear, const Vector3D<T>& translation) noexcept
+    {
+        for (std::size_t col = 0; col < 3; ++col)
+            col_vectors[col] = Vector3D<T>(linear(0, col), linear(1, col), linear(2, col));
+        col_vectors[3] = translation;
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T>::Affine3D(const Matrix4D<T>& matrix) noexcept
+    {
+        for (std::size_t col = 0; col < columns; ++col)
+            col_vectors[col] = Vector3D<T>(matrix.elements[col][0], matrix.elements[col][1], matrix.elements[col][2]);
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T> Affine3D<T>::fromTRS(const Vector3D<T>& translation, const Quaternion<T>& rotation,
+                                     const Vector3D<T>& scale) noexcept
+    {
+        const Matrix3D<T> r = rotation.toMatrix3D();
+        return Affine3D(Vector3D<T>(r(0, 0), r(1, 0), r(2, 0)) * scale.x,
+                        Vector3D<T>(r(0, 1), r(1, 1), r(2, 1)) * scale.y,
+                        Vector3D<T>(r(0, 2), r(1, 2), r(2, 2)) * scale.z, translation);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ACCESSORS              *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    Vector3D<T>& Affine3D<T>::operator[](const std::size_t index)
+    {
+        assert(index < columns && "Affine3D column index out of range");
+        return col_vectors[index];
+    }
+
+
+    template <std::floating_point T>
+    const Vector3D<T>& Affine3D<T>::operator[](const std::size_t index) const
+    {
+        assert(index < columns && "Affine3D column index out of range");
+        return col_vectors[index];
+    }
+
+
+    template <std::floating_point T>
+    T& Affine3D<T>::operator()(const std::size_t row, const std::size_t col)
+    {
+        assert(row < rows && col < columns && "Affine3D element index out of range");
+        return elements[col][row];
+    }
+
+
+    template <std::floating_point T>
+    const T& Affine3D<T>::operator()(const std::size_t row, const std::size_t col) const
+    {
+        assert(row < rows && col < columns && "Affine3D element index out of range");
+        return elements[col][row];
+    }
+
+
+    template <std::floating_point T>
+    Matrix3D<T> Affine3D<T>::linear() const
+    {
+        return Matrix3D<T>(col_vectors[0], col_vectors[1], col_vectors[2]);
+    }
+
+
+    template <std::floating_point T>
+    const Vector3D<T>& Affine3D<T>::translation() const noexcept
+    {
+        return col_vectors[3];
+    }
+
+
+    template <std::floating_point T>
+    Matrix4D<T> Affine3D<T>::toMatrix4D() const noexcept
+    {
+        return Matrix4D<T>(Vector4D<T>(col_vectors[0], T(0)), Vector4D<T>(col_vectors[1], T(0)),
+                           Vector4D<T>(col_vectors[2], T(0)), Vector4D<T>(col_vectors[3], T(1)));
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T>::operator Matrix4D<T>() const noexcept
+    {
+        return toMatrix4D();
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *          TRANSFORMATION           *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    Vector3D<T> Affine3D<T>::transformPoint(const Vector3D<T>& point) const noexcept
+    {
+        return transformDirection(point) + col_vectors[3];
+    }
+
+
+    template <std::floating_point T>
+    Vector3D<T> Affine3D<T>::transformDirection(const Vector3D<T>& direction) const noexcept
+    {
+        return col_vectors[0] * direction.x + col_vectors[1] * direction.y + col_vectors[2] * direction.z;
+    }
+
+
+    template <std::floating_point T>
+    Vector4D<T> Affine3D<T>::operator*(const Vector4D<T>& vec) const noexcept
+    {
+        const Vector3D<T> xyz = transformDirection(Vector3D<T>(vec.x, vec.y, vec.z)) + col_vectors[3] * vec.w;
+        return Vector4D<T>(xyz, vec.w);
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T> Affine3D<T>::operator*(const Affine3D& other) const noexcept
+    {
+        return Affine3D(transformDirection(other.col_vectors[0]), transformDirection(other.col_vectors[1]),
+                        transformDirection(other.col_vectors[2]), transformPoint(other.col_vectors[3]));
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T>& Affine3D<T>::operator*=(const Affine3D& other) noexcept
+    {
+        return *this = *this * other;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *        MATRIX OPERATIONS          *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    T Affine3D<T>::determinant() const noexcept
+    {
+        return col_vectors[0].dot(col_vectors[1].cross(col_vectors[2]));
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T> Affine3D<T>::inverse() const noexcept
+    {
+        Affine3D result;
+        // Singular and NaN transformations fall back to the identity, like Matrix4D::inverse.
+        if (tryInverse(result) != OperationStatus::SUCCESS)
+            return Affine3D();
+        return result;
+    }
+
+
+    template <std::floating_point T>
+    OperationStatus Affine3D<T>::tryInverse(Affine3D& out) const noexcept
+    {
+        // Rows of the inverse linear block are the cross products of the other two columns over the determinant.
+        Vector3D<T> r0 = col_vectors[1].cross(col_vectors[2]);
+        Vector3D<T> r1 = col_vectors[2].cross(col_vectors[0]);
+        Vector3D<T> r2 = col_vectors[0].cross(col_vectors[1]);
+
+        const T det = col_vectors[0].dot(r0);
+        if (std::isnan(det))
+            return OperationStatus::NANOPERAND;
+        if (std::abs(det) <= Config::EPSILON<T>)
+            return OperationStatus::DIVISIONBYZERO;
+
+        const T invDet = T(1) / det;
+        r0 = r0 * invDet;
+        r1 = r1 * invDet;
+        r2 = r2 * invDet;
+
+        const Vector3D<T>& t = col_vectors[3];
+        out = Affine3D(Vector3D<T>(r0.x, r1.x, r2.x), Vector3D<T>(r0.y, r1.y, r2.y), Vector3D<T>(r0.z, r1.z, r2.z),
+                       Vector3D<T>(-r0.dot(t), -r1.dot(t), -r2.dot(t)));
+        return OperationStatus::SUCCESS;
+    }
+
+
+    template <std::floating_point T>
+    Affine3D<T> Affine3D<T>::inverseRigid() const noexcept
+    {
+        const Vector3D<T>& c0 = col_vectors[0];
+        const Vector3D<T>& c1 = col_vectors[1];
+        const Vector3D<T>& c2 = col_vectors[2];
+        const Vector3D<T>& t = col_vectors[3];
+
+        return Affine3D(Vector3D<T>(c0.x, c1.x, c2.x), Vector3D<T>(c0.y, c1.y, c2.y), Vector3D<T>(c0.z, c1.z, c2.z),
+                        Vector3D<T>(-c0.dot(t), -c1.dot(t), -c2.dot(t)));
+    }
+
+} // namespace fgm
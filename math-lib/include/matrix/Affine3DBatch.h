@@ -0,0 +1,89 @@
+#pragma once
+/**
+ * @file Affine3DBatch.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Transform whole buffers of vectors by one @ref fgm::Affine3D.
+ *
+ * @details Packed vectors reuse the @ref Matrix4DBatch.h kernels with the equivalent 4x4 matrix, whose bottom row
+ *          `(0, 0, 0, 1)` keeps every `w` exact. Structure-of-arrays vectors run a dedicated kernel that keeps only
+ *          the 12 elements of the 3x4 matrix in registers, computes `x`, `y` and `z`, and copies `w` through, so
+ *          points (`w == 1`) pick up the translation and directions (`w == 0`) do not.
+ *
+ *          Size and aliasing rules are those of @ref Matrix4DBatch.h.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Affine3D.h"
+#include "Matrix4DBatch.h"
+#include "common/MathTraits.h"
+#include "vector/Vec4Array.h"
+
+#include <span>
+#include <type_traits>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Affine3_Batch
+     * @{
+     */
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform every vector of @p src by @p affine, `out[i] = affine * src[i]`.
+     *
+     * @param[in]  affine Transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination holding exactly `src.size()` vectors. May be @p src itself.
+     * @param[in]  mode   Store policy.
+     */
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, std::type_identity_t<std::span<const Vector4D<T>>> src,
+                   std::type_identity_t<std::span<Vector4D<T>>> out, StoreMode mode = StoreMode::Auto) noexcept;
+
+
+    /** @brief Transform every vector of @p vectors by @p affine in place. */
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                   StoreMode mode = StoreMode::Auto) noexcept;
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform every vector of @p src by @p affine into @p out, resizing it to match.
+     *
+     * @param[in]  affine Transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination. May be @p src itself.
+     * @param[in]  mode   Store policy.
+     */
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, const Vec4Array<T>& src, Vec4Array<T>& out,
+                   StoreMode mode = StoreMode::Auto);
+
+
+    /** @brief Transform every vector of @p vectors by @p affine in place. */
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, Vec4Array<T>& vectors, StoreMode mode = StoreMode::Auto) noexcept;
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Affine3DBatch.tpp"
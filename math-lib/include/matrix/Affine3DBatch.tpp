@@ -0,0 +1,77 @@
+/**
+ * @file Affine3DBatch.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the batch transforms of @ref fgm::Affine3D.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <Dispatch.h>
+#include <cassert>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        template <typename T>
+        void transformStreams(const Affine3D<T>& affine, const Vec4Array<T>& src, Vec4Array<T>& out,
+                              const StoreMode mode) noexcept
+        {
+            static_assert(sizeof(Affine3D<T>) == 12 * sizeof(T), "Affine3D must be packed to be read as 12 elements");
+            assert(src.size() == out.size() && "Vec4Array sizes must match");
+
+            mat4Kernels<T>().transformStreamsAffine(&affine.elements[0][0], src.streams(),
+                                                    useStreamingStores<T>(mode, src.size()), out.streams(),
+                                                    src.size());
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, const std::type_identity_t<std::span<const Vector4D<T>>> src,
+                   const std::type_identity_t<std::span<Vector4D<T>>> out, const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, false>(affine.toMatrix4D(), src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, const std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                   const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, false>(affine.toMatrix4D(), vectors, vectors, mode);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, const Vec4Array<T>& src, Vec4Array<T>& out, const StoreMode mode)
+    {
+        out.resize(src.size());
+        detail::transformStreams<T>(affine, src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transform(const Affine3D<T>& affine, Vec4Array<T>& vectors, const StoreMode mode) noexcept
+    {
+        detail::transformStreams<T>(affine, vectors, vectors, mode);
+    }
+} // namespace fgm
@@ -1,13 +1,21 @@
 #pragma once
+#include "SimdTraits.h"
 #include "vector/Vector2D.h"
 
 #include <cstddef>
+#include <span>
 #include <type_traits>
 
 namespace fgm
 {
+    /**
+     * @note Aligned like a @ref Vector4D of the same type, so `float` and `double` matrices load into one register
+     *       (or register pair) and run on the @ref Matrix2DSimd.h kernels.
+     * @note Construction, access, arithmetic, transpose and inverse are `constexpr`; constant evaluation takes the
+     *       scalar path, so constant transforms can be computed at compile time.
+     */
     template <typename T>
-    struct Matrix2D
+    struct alignas(SimdTraits<T, 4>::alignment) Matrix2D
     {
         static_assert(std::is_arithmetic_v<T>,
                       "Matrix2D can only be instantiated with numbers like floats, integers, etc.");
@@ -21,37 +29,37 @@ namespace fgm
         };
 
         public:
-        Matrix2D();
-        Matrix2D(T v_0_0, T v_0_1, T v_1_0, T v_1_1);
-        Matrix2D(Vector2D<T> col0, Vector2D<T> col1);
+        constexpr Matrix2D();
+        constexpr Matrix2D(T v_0_0, T v_0_1, T v_1_0, T v_1_1);
+        constexpr Matrix2D(Vector2D<T> col0, Vector2D<T> col1);
 
         template <typename S, std::enable_if_t<std::is_arithmetic_v<S>>>
         Matrix2D(const Matrix2D& other);
 
-        Vector2D<T>& operator[](size_t index);
-        const Vector2D<T>& operator[](size_t index) const;
+        constexpr Vector2D<T>& operator[](size_t index);
+        constexpr const Vector2D<T>& operator[](size_t index) const;
 
-        T& operator()(size_t row, size_t col);
-        const T& operator()(size_t row, size_t col) const;
+        constexpr T& operator()(size_t row, size_t col);
+        constexpr const T& operator()(size_t row, size_t col) const;
 
         // Math Operators
-        Matrix2D operator+(const Matrix2D& other) const;
-        Matrix2D& operator+=(const Matrix2D& other);
+        constexpr Matrix2D operator+(const Matrix2D& other) const;
+        constexpr Matrix2D& operator+=(const Matrix2D& other);
 
-        Matrix2D operator-(const Matrix2D& other) const;
-        Matrix2D& operator-=(const Matrix2D& other);
+        constexpr Matrix2D operator-(const Matrix2D& other) const;
+        constexpr Matrix2D& operator-=(const Matrix2D& other);
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D operator*(const S& scalar) const;
+        constexpr Matrix2D operator*(const S& scalar) const;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D& operator*=(const S& scalar);
+        constexpr Matrix2D& operator*=(const S& scalar);
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Vector2D<T> operator*(const Vector2D<S>& vec) const;
+        constexpr Vector2D<T> operator*(const Vector2D<S>& vec) const;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D<T> operator*(const Matrix2D<S>& other) const;
+        constexpr Matrix2D<T> operator*(const Matrix2D<S>& other) const;
 
         /**
          * Multiplies a matrix by a matrix with *= operator.
@@ -60,33 +68,33 @@ namespace fgm
          * @return Matrix on which *= is called, but with new values
          */
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D& operator*=(const Matrix2D<S>& other);
+        constexpr Matrix2D& operator*=(const Matrix2D<S>& other);
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D operator/(const S& scalar) const;
+        constexpr Matrix2D operator/(const S& scalar) const;
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix2D& operator/=(const S& scalar);
+        constexpr Matrix2D& operator/=(const S& scalar);
 
         // Determinants
         // Calculates the determinant for the current Matrix2D.
-        T determinant() const;
+        constexpr T determinant() const;
 
         // Static wrapper for Matrix 3D determinants.
-        static T determinant(const Matrix2D<T>& matrix);
+        static constexpr T determinant(const Matrix2D<T>& matrix);
 
         // Transpose
-        Matrix2D transpose() const;
+        constexpr Matrix2D transpose() const;
 
-        static Matrix2D transpose(const Matrix2D& matrix);
+        static constexpr Matrix2D transpose(const Matrix2D& matrix);
 
         // Matrix Inverse
-        Matrix2D inverse() const;
+        constexpr Matrix2D inverse() const;
 
-        static Matrix2D inverse(const Matrix2D& matrix);
+        static constexpr Matrix2D inverse(const Matrix2D& matrix);
     };
 
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    Matrix2D<T> operator*(const S& scalar, const Matrix2D<T>& matrix);
+    constexpr Matrix2D<T> operator*(const S& scalar, const Matrix2D<T>& matrix);
 
     /**
      * Multiplies a Vector2D by a Matrix2D.
@@ -98,7 +106,7 @@ namespace fgm
      * @return a new Vector2D transposed(row major form)
      */
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    Vector2D<T> operator*(const Vector2D<S>& vec, const Matrix2D<T>& mat);
+    constexpr Vector2D<T> operator*(const Vector2D<S>& vec, const Matrix2D<T>& mat);
 
     /**
      * Multiplies a Vector2D by a Matrix2D.
@@ -112,7 +120,25 @@ namespace fgm
      * @return the passed in vector
      */
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    Vector2D<T> operator*=(Vector2D<S>& vec, const Matrix2D<T>& mat);
+    constexpr Vector2D<T> operator*=(Vector2D<S>& vec, const Matrix2D<T>& mat);
+
+    /**
+     * @brief Transform every vector of @p src by @p matrix, `out[i] = matrix * src[i]`.
+     * @details `float` and `double` vectors are transformed two per register, with one trailing vector on the scalar
+     *          path for odd sizes.
+     *
+     * @param[in]  matrix Transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination holding exactly `src.size()` vectors. May be @p src itself, but must not
+     *                    partially overlap it.
+     */
+    template <typename T>
+    void transform(const Matrix2D<T>& matrix, std::type_identity_t<std::span<const Vector2D<T>>> src,
+                   std::type_identity_t<std::span<Vector2D<T>>> out) noexcept;
+
+    /** @brief Transform every vector of @p vectors by @p matrix in place. */
+    template <typename T>
+    void transform(const Matrix2D<T>& matrix, std::type_identity_t<std::span<Vector2D<T>>> vectors) noexcept;
 
 
 } // namespace fgm
@@ -1,40 +1,26 @@
 #pragma once
 
+#include "Matrix2DSimd.h"
+#include "common/ConstexprMath.h"
+
+#include <cassert>
 #include <type_traits>
-#include <valarray>
 
 namespace fgm
 {
+    // Every constructor initializes the columns, the union member constant evaluation reads and writes.
     template <typename T>
-    Matrix2D<T>::Matrix2D()
-    {
-        // First Column
-        elements[0][0] = 1;
-        elements[0][1] = 0;
-
-        // Second Column
-        elements[1][0] = 0;
-        elements[1][1] = 1;
-    }
+    constexpr Matrix2D<T>::Matrix2D(): columns{ Vector2D<T>(T(1), T(0)), Vector2D<T>(T(0), T(1)) }
+    {}
 
     template <typename T>
-    Matrix2D<T>::Matrix2D(T v_0_0, T v_0_1, T v_1_0, T v_1_1)
-    {
-        // First Column
-        elements[0][0] = v_0_0;
-        elements[0][1] = v_1_0;
-
-        // Second Column
-        elements[1][0] = v_0_1;
-        elements[1][1] = v_1_1;
-    }
+    constexpr Matrix2D<T>::Matrix2D(T v_0_0, T v_0_1, T v_1_0, T v_1_1)
+        : columns{ Vector2D<T>(v_0_0, v_1_0), Vector2D<T>(v_0_1, v_1_1) }
+    {}
 
     template <typename T>
-    Matrix2D<T>::Matrix2D(Vector2D<T> col0, Vector2D<T> vec2)
-    {
-        columns[0] = col0;
-        columns[1] = vec2;
-    }
+    constexpr Matrix2D<T>::Matrix2D(Vector2D<T> col0, Vector2D<T> vec2): columns{ col0, vec2 }
+    {}
 
     template <typename T>
     template <typename S, std::enable_if_t<std::is_arithmetic_v<S>>>
@@ -44,112 +30,198 @@ namespace fgm
     }
 
     template <typename T>
-    Vector2D<T>& Matrix2D<T>::operator[](size_t index)
+    constexpr Vector2D<T>& Matrix2D<T>::operator[](size_t index)
     {
         return columns[index];
     }
 
     template <typename T>
-    const Vector2D<T>& Matrix2D<T>::operator[](size_t index) const
+    constexpr const Vector2D<T>& Matrix2D<T>::operator[](size_t index) const
     {
         return columns[index];
     }
 
     template <typename T>
-    T& Matrix2D<T>::operator()(size_t row, size_t col)
+    constexpr T& Matrix2D<T>::operator()(size_t row, size_t col)
     {
+        // The element array aliases the columns, which is only allowed at run time.
+        if (std::is_constant_evaluated())
+            return columns[col][row];
         return elements[col][row];
     }
 
     template <typename T>
-    const T& Matrix2D<T>::operator()(size_t row, size_t col) const
+    constexpr const T& Matrix2D<T>::operator()(size_t row, size_t col) const
     {
+        if (std::is_constant_evaluated())
+            return columns[col][row];
         return elements[col][row];
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::operator+(const Matrix2D& other) const
+    constexpr Matrix2D<T> Matrix2D<T>::operator+(const Matrix2D& other) const
     {
-        return Matrix2D(elements[0][0] + other(0, 0), elements[1][0] + other(0, 1), elements[0][1] + other(1, 0),
-                        elements[1][1] + other(1, 1));
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storeMat2<T>(detail::add(detail::load(*this), detail::load(other)));
+        }
+#endif
+        return Matrix2D(columns[0].x + other(0, 0), columns[1].x + other(0, 1), columns[0].y + other(1, 0),
+                        columns[1].y + other(1, 1));
     }
 
     template <typename T>
-    Matrix2D<T>& Matrix2D<T>::operator+=(const Matrix2D& other)
+    constexpr Matrix2D<T>& Matrix2D<T>::operator+=(const Matrix2D& other)
     {
-        elements[0][0] += other(0, 0);
-        elements[1][0] += other(0, 1);
-        elements[0][1] += other(1, 0);
-        elements[1][1] += other(1, 1);
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::add(detail::load(*this), detail::load(other)));
+                return *this;
+            }
+        }
+#endif
+        columns[0].x += other(0, 0);
+        columns[1].x += other(0, 1);
+        columns[0].y += other(1, 0);
+        columns[1].y += other(1, 1);
         return *this;
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::operator-(const Matrix2D& other) const
+    constexpr Matrix2D<T> Matrix2D<T>::operator-(const Matrix2D& other) const
     {
-        return Matrix2D(elements[0][0] - other(0, 0), elements[1][0] - other(0, 1), elements[0][1] - other(1, 0),
-                        elements[1][1] - other(1, 1));
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storeMat2<T>(detail::sub(detail::load(*this), detail::load(other)));
+        }
+#endif
+        return Matrix2D(columns[0].x - other(0, 0), columns[1].x - other(0, 1), columns[0].y - other(1, 0),
+                        columns[1].y - other(1, 1));
     }
 
     template <typename T>
-    Matrix2D<T>& Matrix2D<T>::operator-=(const Matrix2D& other)
+    constexpr Matrix2D<T>& Matrix2D<T>::operator-=(const Matrix2D& other)
     {
-        elements[0][0] -= other(0, 0);
-        elements[1][0] -= other(0, 1);
-        elements[0][1] -= other(1, 0);
-        elements[1][1] -= other(1, 1);
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::sub(detail::load(*this), detail::load(other)));
+                return *this;
+            }
+        }
+#endif
+        columns[0].x -= other(0, 0);
+        columns[1].x -= other(0, 1);
+        columns[0].y -= other(1, 0);
+        columns[1].y -= other(1, 1);
 
         return *this;
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T> Matrix2D<T>::operator*(const S& scalar) const
+    constexpr Matrix2D<T> Matrix2D<T>::operator*(const S& scalar) const
     {
-        return Matrix2D(elements[0][0] * scalar, elements[1][0] * scalar, elements[0][1] * scalar,
-                        elements[1][1] * scalar);
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdMat2<T, S>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storeMat2<T>(
+                    detail::mul(detail::load(*this), detail::broadcast(static_cast<T>(scalar))));
+        }
+#endif
+        return Matrix2D(columns[0].x * scalar, columns[1].x * scalar, columns[0].y * scalar,
+                        columns[1].y * scalar);
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T>& Matrix2D<T>::operator*=(const S& scalar)
+    constexpr Matrix2D<T>& Matrix2D<T>::operator*=(const S& scalar)
     {
-        elements[0][0] *= scalar;
-        elements[0][1] *= scalar;
-        elements[1][0] *= scalar;
-        elements[1][1] *= scalar;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdMat2<T, S>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::mul(detail::load(*this), detail::broadcast(static_cast<T>(scalar))));
+                return *this;
+            }
+        }
+#endif
+        columns[0].x *= scalar;
+        columns[0].y *= scalar;
+        columns[1].x *= scalar;
+        columns[1].y *= scalar;
         return *this;
     }
 
     template <typename T>
     template <typename S, typename>
-    Vector2D<T> Matrix2D<T>::operator*(const Vector2D<S>& vec) const
+    constexpr Vector2D<T> Matrix2D<T>::operator*(const Vector2D<S>& vec) const
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdMat2<T, S>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const T x = static_cast<T>(vec.x), y = static_cast<T>(vec.y);
+                const auto result = detail::transformPair(detail::load(*this), detail::load(Vector4D<T>(x, y, x, y)));
+                const Vector4D<T> lanes = detail::store(result);
+                return Vector2D<T>(lanes.x, lanes.y);
+            }
+        }
+#endif
         // 0_0 1_0     x
         //           *
         // 0_1 1_1     y
-        return Vector2D<T>(elements[0][0] * vec.x + elements[1][0] * vec.y,
-                           elements[0][1] * vec.x + elements[1][1] * vec.y);
+        return Vector2D<T>(columns[0].x * vec.x + columns[1].x * vec.y,
+                           columns[0].y * vec.x + columns[1].y * vec.y);
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T> Matrix2D<T>::operator*(const Matrix2D<S>& other) const
+    constexpr Matrix2D<T> Matrix2D<T>::operator*(const Matrix2D<S>& other) const
     {
-        return Matrix2D<T>(elements[0][0] * other(0, 0) + elements[1][0] * other(1, 0),
-                           elements[0][0] * other(0, 1) + elements[1][0] * other(1, 1),
-                           elements[0][1] * other(0, 0) + elements[1][1] * other(1, 0),
-                           elements[0][1] * other(0, 1) + elements[1][1] * other(1, 1));
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T> && std::is_same_v<S, T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storeMat2<T>(detail::transformPair(detail::load(*this), detail::load(other)));
+        }
+#endif
+        return Matrix2D<T>(columns[0].x * other(0, 0) + columns[1].x * other(1, 0),
+                           columns[0].x * other(0, 1) + columns[1].x * other(1, 1),
+                           columns[0].y * other(0, 0) + columns[1].y * other(1, 0),
+                           columns[0].y * other(0, 1) + columns[1].y * other(1, 1));
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T>& Matrix2D<T>::operator*=(const Matrix2D<S>& other)
+    constexpr Matrix2D<T>& Matrix2D<T>::operator*=(const Matrix2D<S>& other)
     {
-        Matrix2D&& temp = Matrix2D<T>(elements[0][0] * other(0, 0) + elements[1][0] * other(1, 0),
-                                      elements[0][0] * other(0, 1) + elements[1][0] * other(1, 1),
-                                      elements[0][1] * other(0, 0) + elements[1][1] * other(1, 0),
-                                      elements[0][1] * other(0, 1) + elements[1][1] * other(1, 1));
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T> && std::is_same_v<S, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::transformPair(detail::load(*this), detail::load(other)));
+                return *this;
+            }
+        }
+#endif
+        Matrix2D&& temp = Matrix2D<T>(columns[0].x * other(0, 0) + columns[1].x * other(1, 0),
+                                      columns[0].x * other(0, 1) + columns[1].x * other(1, 1),
+                                      columns[0].y * other(0, 0) + columns[1].y * other(1, 0),
+                                      columns[0].y * other(0, 1) + columns[1].y * other(1, 1));
 
         (*this) = temp;
 
@@ -158,7 +230,7 @@ namespace fgm
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T> Matrix2D<T>::operator/(const S& scalar) const
+    constexpr Matrix2D<T> Matrix2D<T>::operator/(const S& scalar) const
     {
         T factor = T(1) / static_cast<T>(scalar);
         return factor * (*this);
@@ -166,7 +238,7 @@ namespace fgm
 
     template <typename T>
     template <typename S, typename>
-    Matrix2D<T>& Matrix2D<T>::operator/=(const S& scalar)
+    constexpr Matrix2D<T>& Matrix2D<T>::operator/=(const S& scalar)
     {
         T factor = T(1) / static_cast<T>(scalar);
         (*this) *= factor;
@@ -174,66 +246,120 @@ namespace fgm
     }
 
     template <typename T>
-    T Matrix2D<T>::determinant() const
+    constexpr T Matrix2D<T>::determinant() const
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::first(detail::determinant2(detail::load(*this)));
+        }
+#endif
         // 0_0  1_0
         //	 \  /
         // 0_1  1_1
-        return elements[0][0] * elements[1][1] - elements[1][0] * elements[0][1];
+        return columns[0].x * columns[1].y - columns[1].x * columns[0].y;
     }
 
     template <typename T>
-    T Matrix2D<T>::determinant(const Matrix2D<T>& matrix)
+    constexpr T Matrix2D<T>::determinant(const Matrix2D<T>& matrix)
     {
         return matrix.determinant();
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::transpose() const
+    constexpr Matrix2D<T> Matrix2D<T>::transpose() const
     {
-        return Matrix2D<T>(elements[0][0], elements[0][1], elements[1][0], elements[1][1]);
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storeMat2<T>(detail::transpose2(detail::load(*this)));
+        }
+#endif
+        return Matrix2D<T>(columns[0].x, columns[0].y, columns[1].x, columns[1].y);
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::transpose(const Matrix2D& matrix)
+    constexpr Matrix2D<T> Matrix2D<T>::transpose(const Matrix2D& matrix)
     {
         return matrix.transpose();
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::inverse() const
+    constexpr Matrix2D<T> Matrix2D<T>::inverse() const
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // The determinant reuses the loaded register; the adjugate is one shuffle and one signed scale of it.
+                const auto mat = detail::load(*this);
+                const T det = detail::first(detail::determinant2(mat));
+                if (fgm::abs(det) <= 1e-6f)
+                    return Matrix2D(); // Identity Matrix
+                return detail::storeMat2<T>(detail::inverse2(mat, T(1) / det));
+            }
+        }
+#endif
         T det = determinant();
-        if (std::abs(det) <= 1e-6f)
+        if (fgm::abs(det) <= 1e-6f)
             return Matrix2D(); // Identity Matrix
 
         T factor = T(1) / det;
 
-        return factor * Matrix2D(elements[1][1], -elements[1][0], -elements[0][1], elements[0][0]);
+        return factor * Matrix2D(columns[1].y, -columns[1].x, -columns[0].y, columns[0].x);
     }
 
     template <typename T>
-    Matrix2D<T> Matrix2D<T>::inverse(const Matrix2D& matrix)
+    constexpr Matrix2D<T> Matrix2D<T>::inverse(const Matrix2D& matrix)
     {
         return matrix.inverse();
     }
 
     template <typename T, typename S, typename>
-    Matrix2D<T> operator*(const S& scalar, const Matrix2D<T>& matrix)
+    constexpr Matrix2D<T> operator*(const S& scalar, const Matrix2D<T>& matrix)
     {
         return matrix * scalar;
     }
 
     template <typename T, typename S, typename>
-    Vector2D<T> operator*(const Vector2D<S>& vec, const Matrix2D<T>& mat)
+    constexpr Vector2D<T> operator*(const Vector2D<S>& vec, const Matrix2D<T>& mat)
     {
         return Vector2D(vec.x * mat(0, 0) + vec.y * mat(1, 0), vec.x * mat(0, 1) + vec.y * mat(1, 1));
     }
 
     template <typename T, typename S, typename>
-    Vector2D<T> operator*=(Vector2D<S>& vec, const Matrix2D<T>& mat)
+    constexpr Vector2D<T> operator*=(Vector2D<S>& vec, const Matrix2D<T>& mat)
     {
         vec = Vector2D(vec.x * mat(0, 0) + vec.y * mat(1, 0), vec.x * mat(0, 1) + vec.y * mat(1, 1));
         return vec;
     }
+
+    template <typename T>
+    void transform(const Matrix2D<T>& matrix, const std::type_identity_t<std::span<const Vector2D<T>>> src,
+                   const std::type_identity_t<std::span<Vector2D<T>>> out) noexcept
+    {
+        assert(src.size() == out.size() && "Destination must hold exactly as many vectors as the source");
+
+        std::size_t i = 0;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat2Kernels<T>)
+        {
+            static_assert(sizeof(Vector2D<T>) == 2 * sizeof(T), "Vector2D must be packed to load two per register");
+            const auto mat = detail::load(matrix);
+            for (; i + 2 <= src.size(); i += 2)
+                detail::storePair(out.data() + i, detail::transformPair(mat, detail::loadPair(src.data() + i)));
+        }
+#endif
+        for (; i < src.size(); ++i)
+            out[i] = matrix * src[i];
+    }
+
+    template <typename T>
+    void transform(const Matrix2D<T>& matrix, const std::type_identity_t<std::span<Vector2D<T>>> vectors) noexcept
+    {
+        transform(matrix, std::span<const Vector2D<T>>(vectors), vectors);
+    }
 } // namespace fgm
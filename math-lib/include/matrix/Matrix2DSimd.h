@@ -0,0 +1,222 @@
+#pragma once
+/**
+ * @file Matrix2DSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register kernels backing the runtime path of @ref fgm::Matrix2D.
+ * @details A 2x2 matrix has exactly four elements, so the whole matrix lives in the register(s) of one
+ *          @ref fgm::Vector4D, column-major as `<m00, m10, m01, m11>`: one `__m128` for `float`, and one `__m256d`
+ *          for `double` with AVX (a register pair otherwise). Every operation is then a handful of shuffles on that
+ *          register and reuses the @ref Vector4DSimd.h kernels:
+ *          - Products transform two column vectors at once, so `A * B` and two `A * v` cost the same two
+ *            multiplies and one add.
+ *          - The determinant and adjugate come from one lane reversal and one sign flip.
+ *
+ * @note Only included from Matrix2D.tpp, once @ref fgm::Matrix2D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Matrix2D.h"
+#include "vector/Vector4D.h"
+#include "vector/Vector4DSimd.h"
+
+#include <type_traits>
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *              TRAITS               *
+     *                                   *
+     *************************************/
+
+    /** @brief True if @ref Matrix2D<T> runs on registers. */
+    template <typename T>
+    inline constexpr bool hasMat2Kernels = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+
+    /** @brief True if an operation between @ref Matrix2D<T> and an operand of type `S` can run on registers. */
+    template <typename T, typename S>
+    inline constexpr bool isSimdMat2 = hasMat2Kernels<T> && std::is_same_v<std::common_type_t<T, S>, T>;
+
+
+
+    /*************************************
+     *                                   *
+     *            LOAD / STORE           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Load a matrix into its register(s).
+     *
+     * @param[in] mat Matrix to load. Always register aligned via @ref SimdTraits.
+     *
+     * @return Register holding `<m00, m10, m01, m11>`.
+     */
+    [[nodiscard]] inline __m128 load(const Matrix2D<float>& mat) noexcept
+    {
+        return _mm_load_ps(&mat(0, 0));
+    }
+
+
+    /** @copydoc load(const Matrix2D<float>&) */
+    [[nodiscard]] inline Double4 load(const Matrix2D<double>& mat) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_load_pd(&mat(0, 0));
+#else
+        return { _mm_load_pd(&mat(0, 0)), _mm_load_pd(&mat(0, 1)) };
+#endif
+    }
+
+
+    /** @brief Write a register holding `<m00, m10, m01, m11>` into @p dest. */
+    inline void storeInto(Matrix2D<float>& dest, const __m128 reg) noexcept
+    {
+        _mm_store_ps(&dest(0, 0), reg);
+    }
+
+
+    /** @copydoc storeInto(Matrix2D<float>&, __m128) */
+    inline void storeInto(Matrix2D<double>& dest, const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        _mm256_store_pd(&dest(0, 0), reg);
+#else
+        _mm_store_pd(&dest(0, 0), reg.lo);
+        _mm_store_pd(&dest(0, 1), reg.hi);
+#endif
+    }
+
+
+    /**
+     * @brief Load two consecutive 2D vectors into one register.
+     *
+     * @param[in] vecs First of two packed vectors. Needs no particular alignment.
+     *
+     * @return Register holding `<x0, y0, x1, y1>`.
+     */
+    [[nodiscard]] inline __m128 loadPair(const Vector2D<float>* vecs) noexcept
+    {
+        return _mm_loadu_ps(&vecs->x);
+    }
+
+
+    /** @copydoc loadPair(const Vector2D<float>*) */
+    [[nodiscard]] inline Double4 loadPair(const Vector2D<double>* vecs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_loadu_pd(&vecs->x);
+#else
+        return { _mm_loadu_pd(&vecs[0].x), _mm_loadu_pd(&vecs[1].x) };
+#endif
+    }
+
+
+    /** @brief Write a register holding `<x0, y0, x1, y1>` to two consecutive 2D vectors. */
+    inline void storePair(Vector2D<float>* vecs, const __m128 reg) noexcept
+    {
+        _mm_storeu_ps(&vecs->x, reg);
+    }
+
+
+    /** @copydoc storePair(Vector2D<float>*, __m128) */
+    inline void storePair(Vector2D<double>* vecs, const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        _mm256_storeu_pd(&vecs->x, reg);
+#else
+        _mm_storeu_pd(&vecs[0].x, reg.lo);
+        _mm_storeu_pd(&vecs[1].x, reg.hi);
+#endif
+    }
+
+
+    /** @brief Matrix held by @p reg. */
+    template <typename T, typename Reg>
+    [[nodiscard]] Matrix2D<T> storeMat2(const Reg reg) noexcept
+    {
+        Matrix2D<T> result;
+        storeInto(result, reg);
+        return result;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             PRODUCTS              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform the two 2D column vectors packed in @p vecs by @p mat.
+     * @details Computes `col0 * v.x + col1 * v.y` for both vectors at once: each column is repeated across both
+     *          halves of a register and each component is copied across its vector's half. The products are rounded
+     *          before the sum, as on the scalar path, so results do not change with FMA support.
+     *
+     * @param[in] mat  Matrix register, `<m00, m10, m01, m11>`.
+     * @param[in] vecs Vectors register, `<x0, y0, x1, y1>`.
+     *
+     * @return Register holding `<mat * v0, mat * v1>`. With the columns of a matrix `B` in @p vecs, `mat * B`.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg transformPair(const Reg mat, const Reg vecs) noexcept
+    {
+        return add(mul(shuffle<0, 1, 0, 1>(mat), shuffle<0, 0, 2, 2>(vecs)),
+                   mul(shuffle<2, 3, 2, 3>(mat), shuffle<1, 1, 3, 3>(vecs)));
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *        MATRIX OPERATIONS          *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Determinant of a matrix register, `m00 * m11 - m01 * m10`.
+     *
+     * @return Register with the determinant in its first lane.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg determinant2(const Reg mat) noexcept
+    {
+        const Reg products = mul(mat, shuffle<3, 2, 1, 0>(mat)); // <m00 m11, m10 m01, m01 m10, m11 m00>
+        return sub(products, shuffle<1, 1, 1, 1>(products));
+    }
+
+
+    /** @brief Transpose of a matrix register, swapping `m10` and `m01`. */
+    template <typename Reg>
+    [[nodiscard]] Reg transpose2(const Reg mat) noexcept
+    {
+        return shuffle<0, 2, 1, 3>(mat);
+    }
+
+
+    /**
+     * @brief Adjugate of a matrix register scaled by @p invDet.
+     *
+     * @param[in] mat    Matrix register.
+     * @param[in] invDet Reciprocal of the determinant of @p mat.
+     *
+     * @return Register holding the inverse of @p mat.
+     */
+    template <typename Reg, typename T>
+    [[nodiscard]] Reg inverse2(const Reg mat, const T invDet) noexcept
+    {
+        // <m11, -m10, -m01, m00> / det
+        return mul(shuffle<3, 1, 2, 0>(mat), load(Vector4D<T>(invDet, -invDet, -invDet, invDet)));
+    }
+
+} // namespace fgm::detail
+#endif
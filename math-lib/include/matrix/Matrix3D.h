@@ -1,4 +1,5 @@
 #pragma once
+#include "../vector/PaddedVector3D.h"
 #include "../vector/Vector3D.h"
 
 #include <cstddef>
@@ -14,20 +15,25 @@ namespace fgm
         using value_type = T;
 
         private:
+        // Columns are padded to four lanes so each loads into one register; elements[c][3] is padding.
         union {
-            T elements[3][3];
-            Vector3D<T> columns[3];
+            T elements[3][4];
+            PaddedVector3D<T> columns[3];
         };
 
+        // Conversions and mixed-type operators read the columns of other instantiations.
+        template <typename>
+        friend struct Matrix3D;
+
         public:
-        Matrix3D();
-        Matrix3D(T v_0_0, T v_0_1, T v_0_2, T v_1_0, T v_1_1, T v_1_2, T v_2_0, T v_2_1, T v_2_2);
-        Matrix3D(Vector3D<T> col0, Vector3D<T> col1, Vector3D<T> col2);
+        constexpr Matrix3D();
+        constexpr Matrix3D(T v_0_0, T v_0_1, T v_0_2, T v_1_0, T v_1_1, T v_1_2, T v_2_0, T v_2_1, T v_2_2);
+        constexpr Matrix3D(Vector3D<T> col0, Vector3D<T> col1, Vector3D<T> col2);
 
         template <typename S,
                   typename = std::enable_if_t<std::is_arithmetic_v<S>, int>> // int added to solve compiler confusing
                                                                              // this with copy constructor
-        Matrix3D(const Matrix3D<S>& other);
+        constexpr Matrix3D(const Matrix3D<S>& other);
         // template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>> // Added 'typename' and ', int'
         // Matrix3D(const Matrix3D<S>& other)
         //{
@@ -37,41 +43,51 @@ namespace fgm
         // }
 
 
+        // Not constexpr: the returned Vector3D aliases a padded column, which constant evaluation cannot read through.
+        // Use operator() in constant expressions.
         Vector3D<T>& operator[](size_t index);
         const Vector3D<T>& operator[](size_t index) const;
 
-        T& operator()(size_t row, size_t col);
-        const T& operator()(size_t row, size_t col) const;
+        constexpr T& operator()(size_t row, size_t col);
+        constexpr const T& operator()(size_t row, size_t col) const;
 
 
         // Math Operators
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator+(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
+        constexpr auto operator+(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix3D& operator+=(const Matrix3D<S>& other);
+        constexpr Matrix3D& operator+=(const Matrix3D<S>& other);
 
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator-(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
+        constexpr auto operator-(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix3D& operator-=(const Matrix3D<S>& other);
+        constexpr Matrix3D& operator-=(const Matrix3D<S>& other);
 
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator*(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>;
+        constexpr auto operator*(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix3D& operator*=(const S& scalar);
+        constexpr Matrix3D& operator*=(const S& scalar);
 
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator*(const Vector3D<S>& vec) const -> Vector3D<std::common_type_t<T, S>>;
+        constexpr auto operator*(const Vector3D<S>& vec) const -> Vector3D<std::common_type_t<T, S>>;
+
+
+        /**
+         * Multiplies a matrix by a padded vector, keeping the result in registers for float and double.
+         * @param vec vector to be transformed.
+         * @return a new padded vector with the padding lane cleared.
+         */
+        constexpr PaddedVector3D<T> operator*(const PaddedVector3D<T>& vec) const;
 
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator*(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
+        constexpr auto operator*(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>;
 
         /**
          * Multiplies a matrix by a matrix with *= operator.
@@ -82,36 +98,36 @@ namespace fgm
          * @return Matrix on which *= is called, but with new values
          */
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix3D& operator*=(const Matrix3D<S>& other);
+        constexpr Matrix3D& operator*=(const Matrix3D<S>& other);
 
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        auto operator/(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>;
+        constexpr auto operator/(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>;
 
         template <typename S, typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-        Matrix3D& operator/=(const S& scalar);
+        constexpr Matrix3D& operator/=(const S& scalar);
 
         // Determinants
         // Calculates the determinant for the current Matrix3D.
-        T determinant() const;
+        constexpr T determinant() const;
 
         // Static wrapper for Matrix 3D determinants.
-        static T determinant(const Matrix3D& matrix);
+        static constexpr T determinant(const Matrix3D& matrix);
 
         // Transpose
-        Matrix3D transpose() const;
+        constexpr Matrix3D transpose() const;
 
-        static Matrix3D transpose(const Matrix3D& matrix);
+        static constexpr Matrix3D transpose(const Matrix3D& matrix);
 
         // Matrix Inverse
-        Matrix3D inverse() const;
+        constexpr Matrix3D inverse() const;
 
-        static Matrix3D inverse(const Matrix3D& matrix);
+        static constexpr Matrix3D inverse(const Matrix3D& matrix);
     };
 
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<T>>,
               typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    auto operator*(const S& scalar, const Matrix3D<T>& matrix) -> Matrix3D<std::common_type_t<T, S>>;
+    constexpr auto operator*(const S& scalar, const Matrix3D<T>& matrix) -> Matrix3D<std::common_type_t<T, S>>;
 
     /**
      * Multiplies a Vector3D by a Matrix3D.
@@ -124,7 +140,7 @@ namespace fgm
      */
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<T>>,
               typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    auto operator*(const Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>;
+    constexpr auto operator*(const Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>;
 
     /**
      * Multiplies a Vector3D by a Matrix3D.
@@ -139,7 +155,7 @@ namespace fgm
      */
     template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<T>>,
               typename = std::enable_if_t<std::is_arithmetic_v<S>>>
-    auto operator*=(Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>;
+    constexpr auto operator*=(Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>;
 
 
 }; // namespace fgm
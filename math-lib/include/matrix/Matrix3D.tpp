@@ -1,69 +1,41 @@
 #pragma once
 
+#include "Matrix3DSimd.h"
+#include "common/ConstexprMath.h"
+
 #include <type_traits>
-#include <valarray>
 
 // TODO: When supporting integer, check this to ensure that 2 * 2.5 = 5, not 4 ADD TEST
 
 namespace fgm
 {
 
+    // Constructors initialize the padded columns, the union member constant evaluation reads and writes. Members read
+    // other matrices through those columns too, since the Vector3D returned by operator[] aliases them.
     template <typename T>
-    Matrix3D<T>::Matrix3D()
-    {
-        // Column Major
-        // First Column
-        elements[0][0] = T(1);
-        elements[0][1] = T(0);
-        elements[0][2] = T(0);
-
-        // Second Column
-        elements[1][0] = T(0);
-        elements[1][1] = T(1);
-        elements[1][2] = T(0);
-
-        // Third Column
-        elements[2][0] = T(0);
-        elements[2][1] = T(0);
-        elements[2][2] = T(1);
-    }
+    constexpr Matrix3D<T>::Matrix3D()
+        : columns{ PaddedVector3D<T>(T(1), T(0), T(0)), PaddedVector3D<T>(T(0), T(1), T(0)),
+                   PaddedVector3D<T>(T(0), T(0), T(1)) } // Column Major
+    {}
 
     template <typename T>
-    Matrix3D<T>::Matrix3D(T v_0_0, T v_0_1, T v_0_2, T v_1_0, T v_1_1, T v_1_2, T v_2_0, T v_2_1, T v_2_2)
-    {
-        // Column Major
-        // First Column
-        elements[0][0] = v_0_0;
-        elements[0][1] = v_1_0;
-        elements[0][2] = v_2_0;
-
-        // Second Column
-        elements[1][0] = v_0_1;
-        elements[1][1] = v_1_1;
-        elements[1][2] = v_2_1;
-
-        // Third Column
-        elements[2][0] = v_0_2;
-        elements[2][1] = v_1_2;
-        elements[2][2] = v_2_2;
-    }
+    constexpr Matrix3D<T>::Matrix3D(T v_0_0, T v_0_1, T v_0_2, T v_1_0, T v_1_1, T v_1_2, T v_2_0, T v_2_1, T v_2_2)
+        : columns{ PaddedVector3D<T>(v_0_0, v_1_0, v_2_0), PaddedVector3D<T>(v_0_1, v_1_1, v_2_1),
+                   PaddedVector3D<T>(v_0_2, v_1_2, v_2_2) } // Column Major
+    {}
 
     template <typename T>
-    Matrix3D<T>::Matrix3D(Vector3D<T> col0, Vector3D<T> col1, Vector3D<T> col2)
-    {
-        columns[0] = col0;
-        columns[1] = col1;
-        columns[2] = col2;
-    }
+    constexpr Matrix3D<T>::Matrix3D(Vector3D<T> col0, Vector3D<T> col1, Vector3D<T> col2)
+        : columns{ PaddedVector3D<T>(col0), PaddedVector3D<T>(col1), PaddedVector3D<T>(col2) }
+    {}
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>::Matrix3D(const Matrix3D<S>& other)
-    {
-        columns[0] = Vector3D<T>(other[0]);
-        columns[1] = Vector3D<T>(other[1]);
-        columns[2] = Vector3D<T>(other[2]);
-    }
+    constexpr Matrix3D<T>::Matrix3D(const Matrix3D<S>& other)
+        : columns{ PaddedVector3D<T>(Vector3D<T>(other.columns[0].toVector3D())),
+                   PaddedVector3D<T>(Vector3D<T>(other.columns[1].toVector3D())),
+                   PaddedVector3D<T>(Vector3D<T>(other.columns[2].toVector3D())) }
+    {}
 
     /**
      * Stores a <Vector3D> instance to the specified column of the matrix.
@@ -73,7 +45,7 @@ namespace fgm
     template <typename T>
     Vector3D<T>& Matrix3D<T>::operator[](size_t index)
     {
-        return columns[index];
+        return columns[index].xyz;
     }
 
     /**
@@ -84,20 +56,25 @@ namespace fgm
     template <typename T>
     const Vector3D<T>& Matrix3D<T>::operator[](size_t index) const
     {
-        return columns[index];
+        return columns[index].xyz;
     }
 
     template <typename T>
-    T& Matrix3D<T>::operator()(size_t row, size_t col)
+    constexpr T& Matrix3D<T>::operator()(size_t row, size_t col)
     {
         // We swap the rows and columns since internally we use column major order.
+        // The element array aliases the columns, which is only allowed at run time.
+        if (std::is_constant_evaluated())
+            return columns[col][row];
         return elements[col][row];
     }
 
     template <typename T>
-    const T& Matrix3D<T>::operator()(size_t row, size_t col) const
+    constexpr const T& Matrix3D<T>::operator()(size_t row, size_t col) const
     {
         // We swap the rows and columns since internally we use column major order.
+        if (std::is_constant_evaluated())
+            return columns[col][row];
         return elements[col][row];
     }
 
@@ -109,7 +86,7 @@ namespace fgm
 
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator+(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator+(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
     {
         // Commented out for profiling
         // Since `this` elements[0] is the first column, we need to take the rows first (this[c][r]) and add them to the
@@ -122,14 +99,24 @@ namespace fgm
         //	elements[0][2] + other(2, 0), elements[1][2] + other(2, 1), elements[2][2] + other(2,2)
         //);
 
-        // Using Vector3D ops
+        // Using Vector3D ops, on the padded columns when both matrices share them
         using R = std::common_type_t<T, S>;
-        return Matrix3D<R>(columns[0] + other[0], columns[1] + other[1], columns[2] + other[2]);
+        if constexpr (std::is_same_v<T, S>)
+        {
+            Matrix3D result;
+            for (std::size_t i = 0; i < 3; ++i)
+                result.columns[i] = columns[i] + other.columns[i];
+            return result;
+        }
+        else
+            return Matrix3D<R>(columns[0].toVector3D() + other.columns[0].toVector3D(),
+                               columns[1].toVector3D() + other.columns[1].toVector3D(),
+                               columns[2].toVector3D() + other.columns[2].toVector3D());
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>& Matrix3D<T>::operator+=(const Matrix3D<S>& other)
+    constexpr Matrix3D<T>& Matrix3D<T>::operator+=(const Matrix3D<S>& other)
     {
         // NOTE: Commented out for profiling
         //// First Row
@@ -145,16 +132,23 @@ namespace fgm
         // elements[1][2] += other(2, 1);
         // elements[2][2] += other(2, 2);
 
-        columns[0] += other[0];
-        columns[1] += other[1];
-        columns[2] += other[2];
+        if constexpr (std::is_same_v<T, S>)
+        {
+            for (std::size_t i = 0; i < 3; ++i)
+                columns[i] += other.columns[i];
+        }
+        else
+        {
+            for (std::size_t i = 0; i < 3; ++i)
+                columns[i] += PaddedVector3D<T>(Vector3D<T>(other.columns[i].toVector3D()));
+        }
 
         return *this;
     }
 
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator-(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator-(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
     {
         // NOTE: Commented out for profiling
         // Since `this` elements[0] is the first column, we need to take the rows first (this[c][r]) and add them to the
@@ -166,14 +160,24 @@ namespace fgm
         //     // Third Row
         //     elements[0][2] - other(2, 0), elements[1][2] - other(2, 1), elements[2][2] - other(2, 2));
 
-        // Using Vector3D ops
+        // Using Vector3D ops, on the padded columns when both matrices share them
         using R = std::common_type_t<T, S>;
-        return Matrix3D<R>(columns[0] - other[0], columns[1] - other[1], columns[2] - other[2]);
+        if constexpr (std::is_same_v<T, S>)
+        {
+            Matrix3D result;
+            for (std::size_t i = 0; i < 3; ++i)
+                result.columns[i] = columns[i] - other.columns[i];
+            return result;
+        }
+        else
+            return Matrix3D<R>(columns[0].toVector3D() - other.columns[0].toVector3D(),
+                               columns[1].toVector3D() - other.columns[1].toVector3D(),
+                               columns[2].toVector3D() - other.columns[2].toVector3D());
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>& Matrix3D<T>::operator-=(const Matrix3D<S>& other)
+    constexpr Matrix3D<T>& Matrix3D<T>::operator-=(const Matrix3D<S>& other)
     {
         // NOTE: Commented out for profiling
         //// First Row
@@ -190,63 +194,113 @@ namespace fgm
         // elements[2][2] -= other(2, 2);
 
         // Using Vector3D ops
-        columns[0] -= other[0];
-        columns[1] -= other[1];
-        columns[2] -= other[2];
+        if constexpr (std::is_same_v<T, S>)
+        {
+            for (std::size_t i = 0; i < 3; ++i)
+                columns[i] -= other.columns[i];
+        }
+        else
+        {
+            for (std::size_t i = 0; i < 3; ++i)
+                columns[i] -= PaddedVector3D<T>(Vector3D<T>(other.columns[i].toVector3D()));
+        }
 
         return *this;
     }
 
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator*(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator*(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
-        return Matrix3D<R>(columns[0] * scalar, columns[1] * scalar, columns[2] * scalar);
+        if constexpr (std::is_same_v<R, T>)
+        {
+            Matrix3D result;
+            for (std::size_t i = 0; i < 3; ++i)
+                result.columns[i] = columns[i] * static_cast<T>(scalar);
+            return result;
+        }
+        else
+            return Matrix3D<R>(columns[0].toVector3D() * scalar, columns[1].toVector3D() * scalar,
+                               columns[2].toVector3D() * scalar);
     }
 
     template <typename T, typename S, typename, typename>
-    auto operator*(const S& scalar, const Matrix3D<T>& matrix) -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto operator*(const S& scalar, const Matrix3D<T>& matrix) -> Matrix3D<std::common_type_t<T, S>>
     {
-        return Matrix3D(matrix[0] * scalar, matrix[1] * scalar, matrix[2] * scalar);
+        return matrix * scalar;
     }
 
     template <typename T, typename S, typename, typename>
-    auto operator*(const Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto operator*(const Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>
     {
-        return Vector3D(Vector3D<T>::dot(vec, mat[0]), Vector3D<T>::dot(vec, mat[1]), Vector3D<T>::dot(vec, mat[2]));
+        // Each component is the dot product of the vector, in the matrix type, with a column.
+        const Vector3D<T> row(vec);
+        return Vector3D(row.x * mat(0, 0) + row.y * mat(1, 0) + row.z * mat(2, 0),
+                        row.x * mat(0, 1) + row.y * mat(1, 1) + row.z * mat(2, 1),
+                        row.x * mat(0, 2) + row.y * mat(1, 2) + row.z * mat(2, 2));
     }
 
     template <typename T, typename S, typename, typename>
-    auto operator*=(Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto operator*=(Vector3D<S>& vec, const Matrix3D<T>& mat) -> Vector3D<std::common_type_t<T, S>>
     {
-        vec = Vector3D(Vector3D<T>::dot(vec, mat[0]), Vector3D<T>::dot(vec, mat[1]), Vector3D<T>::dot(vec, mat[2]));
+        vec = vec * mat;
         return vec;
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>& Matrix3D<T>::operator*=(const S& scalar)
+    constexpr Matrix3D<T>& Matrix3D<T>::operator*=(const S& scalar)
     {
-        columns[0] = columns[0] * scalar;
-        columns[1] = columns[1] * scalar;
-        columns[2] = columns[2] * scalar;
+        for (std::size_t i = 0; i < 3; ++i)
+            columns[i] = PaddedVector3D<T>(Vector3D<T>(columns[i].toVector3D() * scalar));
         return *this;
     }
 
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator*(const Vector3D<S>& vec) const -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator*(const Vector3D<S>& vec) const -> Vector3D<std::common_type_t<T, S>>
     {
-        return Vector3D(elements[0][0] * vec.x + elements[1][0] * vec.y + elements[2][0] * vec.z, // First Row * Vec
-                        elements[0][1] * vec.x + elements[1][1] * vec.y + elements[2][1] * vec.z, // Second Row * Vec
-                        elements[0][2] * vec.x + elements[1][2] * vec.y + elements[2][2] * vec.z  // Third Row * Vec
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdMat3<T, S>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const PaddedVector3D<T> padded(static_cast<T>(vec.x), static_cast<T>(vec.y), static_cast<T>(vec.z));
+                return ((*this) * padded).xyz;
+            }
+        }
+#endif
+        return Vector3D(columns[0].x * vec.x + columns[1].x * vec.y + columns[2].x * vec.z, // First Row * Vec
+                        columns[0].y * vec.x + columns[1].y * vec.y + columns[2].y * vec.z, // Second Row * Vec
+                        columns[0].z * vec.x + columns[1].z * vec.y + columns[2].z * vec.z  // Third Row * Vec
         );
     }
 
+    template <typename T>
+    constexpr PaddedVector3D<T> Matrix3D<T>::operator*(const PaddedVector3D<T>& vec) const
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto col0 = detail::load(columns[0]);
+                const auto col1 = detail::load(columns[1]);
+                const auto col2 = detail::load(columns[2]);
+                // The padding lane of each column is zero, so the result's padding lane is zero as well.
+                return detail::storePadded<T>(detail::transform3(col0, col1, col2, detail::load(vec)));
+            }
+        }
+#endif
+        return PaddedVector3D<T>(columns[0].x * vec.x + columns[1].x * vec.y + columns[2].x * vec.z,
+                                 columns[0].y * vec.x + columns[1].y * vec.y + columns[2].y * vec.z,
+                                 columns[0].z * vec.x + columns[1].z * vec.y + columns[2].z * vec.z);
+    }
+
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator*(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator*(const Matrix3D<S>& other) const -> Matrix3D<std::common_type_t<T, S>>
     {
         // TODO: Profiling
         // return Matrix3D(
@@ -264,89 +318,111 @@ namespace fgm
         // elements[1][2] * other(1, 2) + elements[2][2] * other(2, 2)
         //);
         using R = std::common_type_t<T, S>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat3Kernels<T> && std::is_same_v<T, S>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto col0 = detail::load(columns[0]);
+                const auto col1 = detail::load(columns[1]);
+                const auto col2 = detail::load(columns[2]);
+
+                Matrix3D result;
+                for (std::size_t i = 0; i < 3; ++i)
+                    detail::storeInto(result.columns[i],
+                                      detail::transform3(col0, col1, col2, detail::load(other.columns[i])));
+                return result;
+            }
+        }
+#endif
         return Matrix3D<R>(
             // Matrix * First Column Vector
-            (*this) * other[0],
+            (*this) * other.columns[0].toVector3D(),
             // Matrix * Second Column Vector
-            (*this) * other[1],
+            (*this) * other.columns[1].toVector3D(),
             // Matrix * Third Column Vector
-            (*this) * other[2]);
+            (*this) * other.columns[2].toVector3D());
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>& Matrix3D<T>::operator*=(const Matrix3D<S>& other)
+    constexpr Matrix3D<T>& Matrix3D<T>::operator*=(const Matrix3D<S>& other)
     {
         return *this = (*this) * other;
     }
 
     template <typename T>
     template <typename S, typename>
-    auto Matrix3D<T>::operator/(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>
+    constexpr auto Matrix3D<T>::operator/(const S& scalar) const -> Matrix3D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / static_cast<R>(scalar);
-        return Matrix3D<R>(columns[0] * factor, columns[1] * factor, columns[2] * factor);
+        return Matrix3D<R>(columns[0].toVector3D() * factor, columns[1].toVector3D() * factor,
+                           columns[2].toVector3D() * factor);
     }
 
     template <typename T>
     template <typename S, typename>
-    Matrix3D<T>& Matrix3D<T>::operator/=(const S& scalar)
+    constexpr Matrix3D<T>& Matrix3D<T>::operator/=(const S& scalar)
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / static_cast<R>(scalar);
 
-        columns[0] *= factor;
-        columns[1] *= factor;
-        columns[2] *= factor;
+        for (std::size_t i = 0; i < 3; ++i)
+            columns[i] = PaddedVector3D<T>(Vector3D<T>(columns[i].toVector3D() * factor));
 
         return *this;
     }
 
     template <typename T>
-    T Matrix3D<T>::determinant() const
+    constexpr T Matrix3D<T>::determinant() const
     {
+        // Scalar triple product a . (b x c), on registers for float and double
+        if constexpr (std::is_floating_point_v<T>)
+            return columns[0].dot(columns[1].cross(columns[2]));
+
         // Evaluated along first column
-        return elements[0][0] * (elements[1][1] * elements[2][2] - elements[1][2] * elements[2][1]) -
-            elements[0][1] * (elements[1][0] * elements[2][2] - elements[1][2] * elements[2][0]) +
-            elements[0][2] * (elements[1][0] * elements[2][1] - elements[1][1] * elements[2][0]);
+        return columns[0].x * (columns[1].y * columns[2].z - columns[1].z * columns[2].y) -
+            columns[0].y * (columns[1].x * columns[2].z - columns[1].z * columns[2].x) +
+            columns[0].z * (columns[1].x * columns[2].y - columns[1].y * columns[2].x);
     }
 
     template <typename T>
-    T Matrix3D<T>::determinant(const Matrix3D<T>& matrix)
+    constexpr T Matrix3D<T>::determinant(const Matrix3D<T>& matrix)
     {
         return matrix.determinant();
     }
 
     template <typename T>
-    Matrix3D<T> Matrix3D<T>::transpose() const
+    constexpr Matrix3D<T> Matrix3D<T>::transpose() const
     {
-        return Matrix3D(elements[0][0], elements[0][1], elements[0][2], elements[1][0], elements[1][1], elements[1][2],
-                        elements[2][0], elements[2][1], elements[2][2]);
+        return Matrix3D(columns[0].x, columns[0].y, columns[0].z, // First Column as First Row
+                        columns[1].x, columns[1].y, columns[1].z, // Second Column as Second Row
+                        columns[2].x, columns[2].y, columns[2].z  // Third Column as Third Row
+        );
     }
 
     template <typename T>
-    Matrix3D<T> Matrix3D<T>::transpose(const Matrix3D<T>& matrix)
+    constexpr Matrix3D<T> Matrix3D<T>::transpose(const Matrix3D<T>& matrix)
     {
         return matrix.transpose();
     }
 
     template <typename T>
-    Matrix3D<T> Matrix3D<T>::inverse() const
+    constexpr Matrix3D<T> Matrix3D<T>::inverse() const
     {
-        const T det = this->determinant();
+        // 1 / det(M) * [b cross c, c cross a, a cross b]^T, where det(M) = a . (b cross c)
+        const PaddedVector3D<T> row0 = columns[1].cross(columns[2]);
+        const PaddedVector3D<T> row1 = columns[2].cross(columns[0]);
+        const PaddedVector3D<T> row2 = columns[0].cross(columns[1]);
+
+        const T det = columns[0].dot(row0);
         // Handle Non-Invertible Matrices
-        if (std::abs(det) <= 1e-6f)
+        if (fgm::abs(det) <= 1e-6f)
             return Matrix3D();
 
-        // 1 / det(M) * [b cross c, c cross a, a cross b]^T
         const T factor = T(1) / det;
-
-        const Vector3D<T> col1 = columns[1].cross(columns[2]);
-        const Vector3D<T> col2 = columns[2].cross(columns[0]);
-        const Vector3D<T> col3 = columns[0].cross(columns[1]);
-
-        return factor * Matrix3D(col1.x, col1.y, col1.z, col2.x, col2.y, col2.z, col3.x, col3.y, col3.z);
+        return factor * Matrix3D(row0.x, row0.y, row0.z, row1.x, row1.y, row1.z, row2.x, row2.y, row2.z);
 
         // NOTE: Left for profiling
         // return factor * Matrix3D<T>(
@@ -357,7 +433,7 @@ namespace fgm
     }
 
     template <typename T>
-    Matrix3D<T> Matrix3D<T>::inverse(const Matrix3D& matrix)
+    constexpr Matrix3D<T> Matrix3D<T>::inverse(const Matrix3D& matrix)
     {
         return matrix.inverse();
     }
@@ -0,0 +1,72 @@
+#pragma once
+/**
+ * @file Matrix3DSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register kernels backing the runtime path of @ref fgm::Matrix3D.
+ * @details @ref fgm::Matrix3D stores its columns as @ref fgm::PaddedVector3D, so each column loads into the
+ *          register(s) of one @ref fgm::Vector4D with one aligned load, and products and inverses reuse the
+ *          @ref Vector4DSimd.h kernels with the padding lane carried along and dropped on store.
+ *
+ * @note Only included from Matrix3D.tpp, once @ref fgm::Matrix3D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Matrix3D.h"
+#include "vector/PaddedVector3D.h"
+#include "vector/PaddedVector3DSimd.h"
+
+#include <type_traits>
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *              TRAITS               *
+     *                                   *
+     *************************************/
+
+    /** @brief True if @ref Matrix3D<T> runs on registers. */
+    template <typename T>
+    inline constexpr bool hasMat3Kernels = hasPaddedVec3Kernels<T>;
+
+
+    /** @brief True if an operation between @ref Matrix3D<T> and an operand of type `S` can run on registers. */
+    template <typename T, typename S>
+    inline constexpr bool isSimdMat3 = hasMat3Kernels<T> && std::is_same_v<std::common_type_t<T, S>, T>;
+
+
+
+    /*************************************
+     *                                   *
+     *             PRODUCTS              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform a vector register by three column registers, `col0 * v.x + col1 * v.y + col2 * v.z`.
+     * @details The products are rounded before the sums, in the order of the scalar path, so results do not change
+     *          with FMA support.
+     *
+     * @param[in] col0 First column register.
+     * @param[in] col1 Second column register.
+     * @param[in] col2 Third column register.
+     * @param[in] vec  Vector register, `<x, y, z, w>`. `w` is ignored.
+     *
+     * @return Register holding the transformed vector in its first three lanes.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg transform3(const Reg col0, const Reg col1, const Reg col2, const Reg vec) noexcept
+    {
+        return add(add(mul(col0, shuffle<0, 0, 0, 0>(vec)), mul(col1, shuffle<1, 1, 1, 1>(vec))),
+                   mul(col2, shuffle<2, 2, 2, 2>(vec)));
+    }
+
+} // namespace fgm::detail
+#endif
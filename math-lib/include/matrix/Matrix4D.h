@@ -1,8 +1,9 @@
 #pragma once
-
 #include "common/MathTraits.h"
+#include "common/OperationStatus.h"
 #include "vector/Vector4D.h"
 
+#include <concepts>
 #include <cstddef>
 
 namespace fgm
@@ -15,6 +16,7 @@ namespace fgm
         static constexpr std::size_t columns = 4;
         static constexpr std::size_t rows = 4;
 
+        // Constant evaluation goes through col_vectors only; elements aliases them at run time.
         union {
             Vector4D<T> col_vectors[columns];
             T elements[columns][rows];
@@ -26,15 +28,15 @@ namespace fgm
          *                                   *
          *************************************/
 
-        Matrix4D();
+        constexpr Matrix4D();
 
-        Matrix4D(T v_0_0, T v_0_1, T v_0_2, T v_0_3, T v_1_0, T v_1_1, T v_1_2, T v_1_3, T v_2_0, T v_2_1, T v_2_2,
-                 T v_2_3, T v_3_0, T v_3_1, T v_3_2, T v_3_3);
+        constexpr Matrix4D(T v_0_0, T v_0_1, T v_0_2, T v_0_3, T v_1_0, T v_1_1, T v_1_2, T v_1_3, T v_2_0, T v_2_1,
+                           T v_2_2, T v_2_3, T v_3_0, T v_3_1, T v_3_2, T v_3_3);
 
-        Matrix4D(Vector4D<T> col0, Vector4D<T> col1, Vector4D<T> col2, Vector4D<T> col3);
+        constexpr Matrix4D(Vector4D<T> col0, Vector4D<T> col1, Vector4D<T> col2, Vector4D<T> col3);
 
         template <StrictArithmetic U>
-        Matrix4D(const Matrix4D<U>& other);
+        constexpr Matrix4D(const Matrix4D<U>& other);
 
 
         /*************************************
@@ -43,11 +45,11 @@ namespace fgm
          *                                   *
          *************************************/
 
-        Vector4D<T>& operator[](std::size_t index);
-        const Vector4D<T>& operator[](std::size_t index) const;
+        constexpr Vector4D<T>& operator[](std::size_t index);
+        constexpr const Vector4D<T>& operator[](std::size_t index) const;
 
-        T& operator()(std::size_t row, std::size_t col);
-        const T& operator()(std::size_t row, std::size_t col) const;
+        constexpr T& operator()(std::size_t row, std::size_t col);
+        constexpr const T& operator()(std::size_t row, std::size_t col) const;
 
 
         /*************************************
@@ -56,12 +58,114 @@ namespace fgm
          *                                   *
          *************************************/
         template <StrictArithmetic U>
-        auto operator+(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>;
+        constexpr auto operator+(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>;
+
+        template <StrictArithmetic U>
+        constexpr Matrix4D& operator+=(const Matrix4D<U>& other);
 
         template <StrictArithmetic U>
-        Matrix4D& operator+=(const Matrix4D<U>& other);
+        constexpr auto operator-(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>;
+
+        template <StrictArithmetic U>
+        constexpr Matrix4D& operator-=(const Matrix4D<U>& other);
+
+        /** @brief Scale every element by @p scalar. */
+        template <StrictArithmetic S>
+        constexpr auto operator*(S scalar) const -> Matrix4D<std::common_type_t<T, S>>;
+
+        /** @brief Scale every element by @p scalar, keeping the element type. */
+        template <StrictArithmetic S>
+        constexpr Matrix4D& operator*=(S scalar);
+
+        /**
+         * @brief Divide every element by @p scalar.
+         * @note Multiplies by the reciprocal, like @ref Vector4D::operator/.
+         */
+        template <StrictArithmetic S>
+        constexpr auto operator/(S scalar) const -> Matrix4D<std::common_type_t<T, S>>;
+
+        /** @brief Divide every element by @p scalar, keeping the element type. */
+        template <StrictArithmetic S>
+        constexpr Matrix4D& operator/=(S scalar);
+
+        /**
+         * @brief Transform a column vector, `M * v`.
+         * @details Computed as `col0 * v.x + col1 * v.y + col2 * v.z + col3 * v.w`, which maps to one broadcast and
+         *          one fused multiply-add per column on registers.
+         */
+        template <StrictArithmetic U>
+        constexpr auto operator*(const Vector4D<U>& vec) const -> Vector4D<std::common_type_t<T, U>>;
+
+        /** @brief Multiply two matrices, `A * B`, transforming each column of @p other. */
+        template <StrictArithmetic U>
+        constexpr auto operator*(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>;
+
+        /** @brief Multiply by @p other on the right, `A = A * B`, keeping the element type. */
+        template <StrictArithmetic U>
+        constexpr Matrix4D& operator*=(const Matrix4D<U>& other);
+
+
+        /*************************************
+         *                                   *
+         *        MATRIX OPERATIONS          *
+         *                                   *
+         *************************************/
+
+        /** @brief Compute the determinant by expanding along 2x2 minors. */
+        constexpr T determinant() const;
+
+        /** @brief Static wrapper for @ref determinant. */
+        static constexpr T determinant(const Matrix4D& matrix);
+
+        /** @brief Swap rows and columns. */
+        constexpr Matrix4D transpose() const;
+
+        /** @brief Static wrapper for @ref transpose. */
+        static constexpr Matrix4D transpose(const Matrix4D& matrix);
+
+        /**
+         * @brief Compute the inverse from the cofactors of the 2x2 minor expansion.
+         *
+         * @return The inverse, or the identity matrix if the determinant is within @ref Config::EPSILON of zero.
+         *
+         * @note Use @ref tryInverse to tell a singular matrix apart from an identity result.
+         */
+        constexpr Matrix4D inverse() const
+            requires std::floating_point<T>;
+
+        /** @brief Static wrapper for @ref inverse. */
+        static constexpr Matrix4D inverse(const Matrix4D& matrix)
+            requires std::floating_point<T>;
+
+        /**
+         * @brief Compute the inverse, reporting why it failed instead of returning a fallback.
+         *
+         * @param[out] out Receives the inverse on success; left untouched otherwise.
+         *
+         * @return @ref OperationStatus::SUCCESS, @ref OperationStatus::NANOPERAND if the determinant is NaN (any NaN
+         *         element, or infinities that cancel), or @ref OperationStatus::DIVISIONBYZERO if the determinant is
+         *         within @ref Config::EPSILON of zero.
+         */
+        [[nodiscard]] constexpr OperationStatus tryInverse(Matrix4D& out) const noexcept
+            requires std::floating_point<T>;
     };
 
+
+    /** @brief Scale every element of @p matrix by @p scalar. */
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr auto operator*(S scalar, const Matrix4D<T>& matrix) -> Matrix4D<std::common_type_t<T, S>>;
+
+    /**
+     * @brief Multiply a row vector by a matrix, `v * M`.
+     * @note Treats @p vec as a 1x4 matrix, so each component is the dot product of @p vec with a column.
+     */
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr auto operator*(const Vector4D<S>& vec, const Matrix4D<T>& mat) -> Vector4D<std::common_type_t<T, S>>;
+
+    /** @brief Multiply a row vector by a matrix in place, `v = v * M`, keeping the component type. */
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr Vector4D<S>& operator*=(Vector4D<S>& vec, const Matrix4D<T>& mat);
+
 } // namespace fgm
 
-#include "Matrix4D.tpp"
\ No newline at end of file
+#include "Matrix4D.tpp"
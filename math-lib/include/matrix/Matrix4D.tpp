@@ -1,5 +1,11 @@
 #pragma once
 
+#include "Matrix4DSimd.h"
+#include "common/Config.h"
+#include "common/ConstexprMath.h"
+
+#include <cmath>
+
 namespace fgm
 {
     /*************************************
@@ -8,81 +14,31 @@ namespace fgm
      *                                   *
      *************************************/
 
+    // Every constructor initializes the columns, the union member constant evaluation reads and writes.
     template <StrictArithmetic T>
-    Matrix4D<T>::Matrix4D()
-    {
-        // First Column
-        elements[0][0] = 1;
-        elements[0][1] = 0;
-        elements[0][2] = 0;
-        elements[0][3] = 0;
-
-        // Second Column
-        elements[1][0] = 0;
-        elements[1][1] = 1;
-        elements[1][2] = 0;
-        elements[1][3] = 0;
-
-        // Third Column
-        elements[2][0] = 0;
-        elements[2][1] = 0;
-        elements[2][2] = 1;
-        elements[2][3] = 0;
-
-        // Fourth Column
-        elements[3][0] = 0;
-        elements[3][1] = 0;
-        elements[3][2] = 0;
-        elements[3][3] = 1;
-    }
+    constexpr Matrix4D<T>::Matrix4D()
+        : col_vectors{ Vector4D<T>(T(1), T(0), T(0), T(0)), Vector4D<T>(T(0), T(1), T(0), T(0)),
+                       Vector4D<T>(T(0), T(0), T(1), T(0)), Vector4D<T>(T(0), T(0), T(0), T(1)) }
+    {}
 
     template <StrictArithmetic T>
-    Matrix4D<T>::Matrix4D(T v_0_0, T v_0_1, T v_0_2, T v_0_3, T v_1_0, T v_1_1, T v_1_2, T v_1_3, T v_2_0, T v_2_1,
-                          T v_2_2, T v_2_3, T v_3_0, T v_3_1, T v_3_2, T v_3_3)
-    {
-        // First Column
-        elements[0][0] = v_0_0;
-        elements[0][1] = v_1_0;
-        elements[0][2] = v_2_0;
-        elements[0][3] = v_3_0;
-
-        // Second Column
-        elements[1][0] = v_0_1;
-        elements[1][1] = v_1_1;
-        elements[1][2] = v_2_1;
-        elements[1][3] = v_3_1;
-
-        // Third Column
-        elements[2][0] = v_0_2;
-        elements[2][1] = v_1_2;
-        elements[2][2] = v_2_2;
-        elements[2][3] = v_3_2;
-
-        // Fourth Column
-        elements[3][0] = v_0_3;
-        elements[3][1] = v_1_3;
-        elements[3][2] = v_2_3;
-        elements[3][3] = v_3_3;
-    }
+    constexpr Matrix4D<T>::Matrix4D(T v_0_0, T v_0_1, T v_0_2, T v_0_3, T v_1_0, T v_1_1, T v_1_2, T v_1_3, T v_2_0,
+                                    T v_2_1, T v_2_2, T v_2_3, T v_3_0, T v_3_1, T v_3_2, T v_3_3)
+        : col_vectors{ Vector4D<T>(v_0_0, v_1_0, v_2_0, v_3_0), Vector4D<T>(v_0_1, v_1_1, v_2_1, v_3_1),
+                       Vector4D<T>(v_0_2, v_1_2, v_2_2, v_3_2), Vector4D<T>(v_0_3, v_1_3, v_2_3, v_3_3) }
+    {}
 
     template <StrictArithmetic T>
-    Matrix4D<T>::Matrix4D(Vector4D<T> col0, Vector4D<T> col1, Vector4D<T> col2, Vector4D<T> col3)
-    {
-        col_vectors[0] = col0;
-        col_vectors[1] = col1;
-        col_vectors[2] = col2;
-        col_vectors[3] = col3;
-    }
+    constexpr Matrix4D<T>::Matrix4D(Vector4D<T> col0, Vector4D<T> col1, Vector4D<T> col2, Vector4D<T> col3)
+        : col_vectors{ col0, col1, col2, col3 }
+    {}
 
     template <StrictArithmetic T>
     template <StrictArithmetic U>
-    Matrix4D<T>::Matrix4D(const Matrix4D<U>& other)
-    {
-        col_vectors[0] = Vector4D<T>(other.col_vectors[0]);
-        col_vectors[1] = Vector4D<T>(other.col_vectors[1]);
-        col_vectors[2] = Vector4D<T>(other.col_vectors[2]);
-        col_vectors[3] = Vector4D<T>(other.col_vectors[3]);
-    }
+    constexpr Matrix4D<T>::Matrix4D(const Matrix4D<U>& other)
+        : col_vectors{ Vector4D<T>(other.col_vectors[0]), Vector4D<T>(other.col_vectors[1]),
+                       Vector4D<T>(other.col_vectors[2]), Vector4D<T>(other.col_vectors[3]) }
+    {}
 
 
     /*************************************
@@ -92,26 +48,31 @@ namespace fgm
      *************************************/
 
     template <StrictArithmetic T>
-    Vector4D<T>& Matrix4D<T>::operator[](std::size_t index)
+    constexpr Vector4D<T>& Matrix4D<T>::operator[](std::size_t index)
     {
         return col_vectors[index];
     }
 
     template <StrictArithmetic T>
-    const Vector4D<T>& Matrix4D<T>::operator[](std::size_t index) const
+    constexpr const Vector4D<T>& Matrix4D<T>::operator[](std::size_t index) const
     {
         return col_vectors[index];
     }
 
     template <StrictArithmetic T>
-    T& Matrix4D<T>::operator()(std::size_t row, std::size_t col)
+    constexpr T& Matrix4D<T>::operator()(std::size_t row, std::size_t col)
     {
+        // The element array aliases the columns, which is only allowed at run time.
+        if (std::is_constant_evaluated())
+            return col_vectors[col][row];
         return elements[col][row];
     }
 
     template <StrictArithmetic T>
-    const T& Matrix4D<T>::operator()(std::size_t row, std::size_t col) const
+    constexpr const T& Matrix4D<T>::operator()(std::size_t row, std::size_t col) const
     {
+        if (std::is_constant_evaluated())
+            return col_vectors[col][row];
         return elements[col][row];
     }
 
@@ -124,7 +85,7 @@ namespace fgm
 
     template <StrictArithmetic T>
     template <StrictArithmetic U>
-    auto Matrix4D<T>::operator+(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>
+    constexpr auto Matrix4D<T>::operator+(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>
     {
         using R = std::common_type_t<T, U>;
         return Matrix4D<R>(col_vectors[0] + other.col_vectors[0], col_vectors[1] + other.col_vectors[1],
@@ -133,7 +94,7 @@ namespace fgm
 
     template <StrictArithmetic T>
     template <StrictArithmetic U>
-    Matrix4D<T>& Matrix4D<T>::operator+=(const Matrix4D<U>& other)
+    constexpr Matrix4D<T>& Matrix4D<T>::operator+=(const Matrix4D<U>& other)
     {
         col_vectors[0] += other.col_vectors[0];
         col_vectors[1] += other.col_vectors[1];
@@ -142,4 +103,249 @@ namespace fgm
         return *this;
     }
 
+    template <StrictArithmetic T>
+    template <StrictArithmetic U>
+    constexpr auto Matrix4D<T>::operator-(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>
+    {
+        using R = std::common_type_t<T, U>;
+        return Matrix4D<R>(col_vectors[0] - other.col_vectors[0], col_vectors[1] - other.col_vectors[1],
+                           col_vectors[2] - other.col_vectors[2], col_vectors[3] - other.col_vectors[3]);
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic U>
+    constexpr Matrix4D<T>& Matrix4D<T>::operator-=(const Matrix4D<U>& other)
+    {
+        col_vectors[0] -= other.col_vectors[0];
+        col_vectors[1] -= other.col_vectors[1];
+        col_vectors[2] -= other.col_vectors[2];
+        col_vectors[3] -= other.col_vectors[3];
+        return *this;
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic S>
+    constexpr auto Matrix4D<T>::operator*(const S scalar) const -> Matrix4D<std::common_type_t<T, S>>
+    {
+        using R = std::common_type_t<T, S>;
+        return Matrix4D<R>(col_vectors[0] * scalar, col_vectors[1] * scalar, col_vectors[2] * scalar,
+                           col_vectors[3] * scalar);
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic S>
+    constexpr Matrix4D<T>& Matrix4D<T>::operator*=(const S scalar)
+    {
+        col_vectors[0] *= scalar;
+        col_vectors[1] *= scalar;
+        col_vectors[2] *= scalar;
+        col_vectors[3] *= scalar;
+        return *this;
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic S>
+    constexpr auto Matrix4D<T>::operator/(const S scalar) const -> Matrix4D<std::common_type_t<T, S>>
+    {
+        using R = std::common_type_t<T, S>;
+        return Matrix4D<R>(col_vectors[0] / scalar, col_vectors[1] / scalar, col_vectors[2] / scalar,
+                           col_vectors[3] / scalar);
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic S>
+    constexpr Matrix4D<T>& Matrix4D<T>::operator/=(const S scalar)
+    {
+        col_vectors[0] /= scalar;
+        col_vectors[1] /= scalar;
+        col_vectors[2] /= scalar;
+        col_vectors[3] /= scalar;
+        return *this;
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic U>
+    constexpr auto Matrix4D<T>::operator*(const Vector4D<U>& vec) const -> Vector4D<std::common_type_t<T, U>>
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::transform(*this, vec));
+        }
+#endif
+        return col_vectors[0] * vec.x + col_vectors[1] * vec.y + col_vectors[2] * vec.z + col_vectors[3] * vec.w;
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic U>
+    constexpr auto Matrix4D<T>::operator*(const Matrix4D<U>& other) const -> Matrix4D<std::common_type_t<T, U>>
+    {
+        using R = std::common_type_t<T, U>;
+        // Column j of the product is this matrix applied to column j of the other.
+        return Matrix4D<R>((*this) * other.col_vectors[0], (*this) * other.col_vectors[1],
+                           (*this) * other.col_vectors[2], (*this) * other.col_vectors[3]);
+    }
+
+    template <StrictArithmetic T>
+    template <StrictArithmetic U>
+    constexpr Matrix4D<T>& Matrix4D<T>::operator*=(const Matrix4D<U>& other)
+    {
+        return *this = Matrix4D<T>((*this) * other);
+    }
+
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr auto operator*(const S scalar, const Matrix4D<T>& matrix) -> Matrix4D<std::common_type_t<T, S>>
+    {
+        return matrix * scalar;
+    }
+
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr auto operator*(const Vector4D<S>& vec, const Matrix4D<T>& mat) -> Vector4D<std::common_type_t<T, S>>
+    {
+        using R = std::common_type_t<T, S>;
+        return Vector4D<R>(vec.dot(mat.col_vectors[0]), vec.dot(mat.col_vectors[1]), vec.dot(mat.col_vectors[2]),
+                           vec.dot(mat.col_vectors[3]));
+    }
+
+    template <StrictArithmetic T, StrictArithmetic S>
+    constexpr Vector4D<S>& operator*=(Vector4D<S>& vec, const Matrix4D<T>& mat)
+    {
+        return vec = Vector4D<S>(vec * mat);
+    }
+
+
+    /*************************************
+     *                                   *
+     *        MATRIX OPERATIONS          *
+     *                                   *
+     *************************************/
+
+    template <StrictArithmetic T>
+    constexpr T Matrix4D<T>::determinant() const
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::first(detail::determinant(detail::minors(*this)));
+        }
+#endif
+        // With a, b, c, d the upper 3D parts of the columns and x, y, z, w the bottom row:
+        // det = (a x b) . (w c - z d) + (c x d) . (y a - x b)
+        const Vector3D<T> a(col_vectors[0].x, col_vectors[0].y, col_vectors[0].z);
+        const Vector3D<T> b(col_vectors[1].x, col_vectors[1].y, col_vectors[1].z);
+        const Vector3D<T> c(col_vectors[2].x, col_vectors[2].y, col_vectors[2].z);
+        const Vector3D<T> d(col_vectors[3].x, col_vectors[3].y, col_vectors[3].z);
+        const T x = col_vectors[0].w, y = col_vectors[1].w, z = col_vectors[2].w, w = col_vectors[3].w;
+
+        return a.cross(b).dot(c * w - d * z) + c.cross(d).dot(a * y - b * x);
+    }
+
+    template <StrictArithmetic T>
+    constexpr T Matrix4D<T>::determinant(const Matrix4D& matrix)
+    {
+        return matrix.determinant();
+    }
+
+    template <StrictArithmetic T>
+    constexpr Matrix4D<T> Matrix4D<T>::transpose() const
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasMat4Transpose<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::transpose(*this);
+        }
+#endif
+        // Each column becomes a row.
+        const Vector4D<T>* cols = col_vectors;
+        return Matrix4D(cols[0].x, cols[0].y, cols[0].z, cols[0].w, //
+                        cols[1].x, cols[1].y, cols[1].z, cols[1].w, //
+                        cols[2].x, cols[2].y, cols[2].z, cols[2].w, //
+                        cols[3].x, cols[3].y, cols[3].z, cols[3].w);
+    }
+
+    template <StrictArithmetic T>
+    constexpr Matrix4D<T> Matrix4D<T>::transpose(const Matrix4D& matrix)
+    {
+        return matrix.transpose();
+    }
+
+    template <StrictArithmetic T>
+    constexpr Matrix4D<T> Matrix4D<T>::inverse() const
+        requires std::floating_point<T>
+    {
+        Matrix4D result;
+        // Singular and NaN matrices fall back to the identity, like Matrix3D::inverse.
+        if (tryInverse(result) != OperationStatus::SUCCESS)
+            return Matrix4D();
+        return result;
+    }
+
+    template <StrictArithmetic T>
+    constexpr Matrix4D<T> Matrix4D<T>::inverse(const Matrix4D& matrix)
+        requires std::floating_point<T>
+    {
+        return matrix.inverse();
+    }
+
+    template <StrictArithmetic T>
+    constexpr OperationStatus Matrix4D<T>::tryInverse(Matrix4D& out) const noexcept
+        requires std::floating_point<T>
+    {
+        // Every element takes part in the determinant, so a NaN anywhere shows up there without a separate scan.
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const detail::Mat4Minors minors = detail::minors(*this);
+                const __m128 det = detail::determinant(minors);
+                if (std::isnan(detail::first(det)))
+                    return OperationStatus::NANOPERAND;
+                if (std::abs(detail::first(det)) <= Config::EPSILON<T>)
+                    return OperationStatus::DIVISIONBYZERO;
+
+                out = detail::inverse(minors, det);
+                return OperationStatus::SUCCESS;
+            }
+        }
+#endif
+        // Rows of the inverse are built from the same minors as the determinant, see determinant().
+        const Vector3D<T> a(col_vectors[0].x, col_vectors[0].y, col_vectors[0].z);
+        const Vector3D<T> b(col_vectors[1].x, col_vectors[1].y, col_vectors[1].z);
+        const Vector3D<T> c(col_vectors[2].x, col_vectors[2].y, col_vectors[2].z);
+        const Vector3D<T> d(col_vectors[3].x, col_vectors[3].y, col_vectors[3].z);
+        const T x = col_vectors[0].w, y = col_vectors[1].w, z = col_vectors[2].w, w = col_vectors[3].w;
+
+        Vector3D<T> s = a.cross(b);
+        Vector3D<T> t = c.cross(d);
+        Vector3D<T> u = a * y - b * x;
+        Vector3D<T> v = c * w - d * z;
+
+        const T det = s.dot(v) + t.dot(u);
+        if (fgm::isnan(det))
+            return OperationStatus::NANOPERAND;
+        if (fgm::abs(det) <= Config::EPSILON<T>)
+            return OperationStatus::DIVISIONBYZERO;
+
+        const T invDet = T(1) / det;
+        s = s * invDet;
+        t = t * invDet;
+        u = u * invDet;
+        v = v * invDet;
+
+        const Vector3D<T> r0 = b.cross(v) + t * y;
+        const Vector3D<T> r1 = v.cross(a) - t * x;
+        const Vector3D<T> r2 = d.cross(u) + s * w;
+        const Vector3D<T> r3 = u.cross(c) - s * z;
+
+        out = Matrix4D(r0.x, r0.y, r0.z, -b.dot(t), //
+                       r1.x, r1.y, r1.z, a.dot(t),  //
+                       r2.x, r2.y, r2.z, -d.dot(s), //
+                       r3.x, r3.y, r3.z, c.dot(s));
+        return OperationStatus::SUCCESS;
+    }
+
 } // namespace fgm
@@ -0,0 +1,134 @@
+#pragma once
+/**
+ * @file Matrix4DBatch.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Transform whole buffers of vectors by one @ref fgm::Matrix4D.
+ *
+ * @details Every function runs on the kernels bound by @ref falcon::simd::batchKernels: the matrix columns are loaded
+ *          into registers once per call, and each register then transforms as many vectors as it holds (packed
+ *          vectors: 1 with SSE, 2 with AVX2 and 4 with AVX-512 for `float`; structure-of-arrays vectors: one per
+ *          lane) with one multiply-add per column.
+ *
+ *          Packed spans must hold exactly as many vectors as their source, which is checked with `assert`.
+ *          In-place overloads write over their input; an output span may also be the input span itself, but must
+ *          not partially overlap it.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Matrix4D.h"
+#include "common/MathTraits.h"
+#include "vector/Vec4Array.h"
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Mat4_Batch
+     * @{
+     */
+
+    /** @brief How batch transforms write their results. */
+    enum class StoreMode : std::uint8_t
+    {
+        Auto,     ///< @ref Streaming once the output is larger than @ref Config::STREAMING_STORE_THRESHOLD bytes.
+        Cached,   ///< Regular stores, for results that are read back soon.
+        Streaming ///< Non-temporal stores that bypass the cache, for results too large to stay in it.
+    };
+
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform every vector of @p src by @p matrix, `out[i] = matrix * src[i]`.
+     *
+     * @param[in]  matrix Transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination holding exactly `src.size()` vectors. May be @p src itself.
+     * @param[in]  mode   Store policy.
+     */
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, std::type_identity_t<std::span<const Vector4D<T>>> src,
+                   std::type_identity_t<std::span<Vector4D<T>>> out, StoreMode mode = StoreMode::Auto) noexcept;
+
+
+    /** @brief Transform every vector of @p vectors by @p matrix in place. */
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                   StoreMode mode = StoreMode::Auto) noexcept;
+
+
+    /**
+     * @brief Transform every vector of @p src by @p matrix and divide by the resulting `w`.
+     * @details The perspective divide of a projection: `x`, `y` and `z` become `x / w`, `y / w` and `z / w`, and `w`
+     *          becomes `1`. Vectors transformed to `w == 0` produce infinities or NaN.
+     *
+     * @param[in]  matrix Projective transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination holding exactly `src.size()` vectors. May be @p src itself.
+     * @param[in]  mode   Store policy.
+     */
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, std::type_identity_t<std::span<const Vector4D<T>>> src,
+                             std::type_identity_t<std::span<Vector4D<T>>> out,
+                             StoreMode mode = StoreMode::Auto) noexcept;
+
+
+    /** @brief Apply @ref transformProjective to every vector of @p vectors in place. */
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                             StoreMode mode = StoreMode::Auto) noexcept;
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform every vector of @p src by @p matrix into @p out, resizing it to match.
+     *
+     * @param[in]  matrix Transformation.
+     * @param[in]  src    Vectors to transform.
+     * @param[out] out    Destination. May be @p src itself.
+     * @param[in]  mode   Store policy.
+     */
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, const Vec4Array<T>& src, Vec4Array<T>& out,
+                   StoreMode mode = StoreMode::Auto);
+
+
+    /** @brief Transform every vector of @p vectors by @p matrix in place. */
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, Vec4Array<T>& vectors, StoreMode mode = StoreMode::Auto) noexcept;
+
+
+    /** @brief @ref transformProjective over structure-of-arrays vectors, resizing @p out to match @p src. */
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, const Vec4Array<T>& src, Vec4Array<T>& out,
+                             StoreMode mode = StoreMode::Auto);
+
+
+    /** @brief Apply @ref transformProjective to every vector of @p vectors in place. */
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, Vec4Array<T>& vectors,
+                             StoreMode mode = StoreMode::Auto) noexcept;
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Matrix4DBatch.tpp"
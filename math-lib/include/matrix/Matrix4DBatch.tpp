@@ -0,0 +1,143 @@
+/**
+ * @file Matrix4DBatch.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the batch transforms of @ref fgm::Matrix4D.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "common/Config.h"
+
+#include <Dispatch.h>
+#include <cassert>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Resolve @p mode for an output of @p count vectors of `T`. */
+        template <typename T>
+        [[nodiscard]] constexpr bool useStreamingStores(const StoreMode mode, const std::size_t count) noexcept
+        {
+            if (mode == StoreMode::Auto)
+                return count * sizeof(Vector4D<T>) > Config::STREAMING_STORE_THRESHOLD;
+            return mode == StoreMode::Streaming;
+        }
+
+
+        /** @brief Transform kernels of the running CPU for `T`. */
+        template <typename T>
+        [[nodiscard]] const falcon::simd::Mat4Kernels<T>& mat4Kernels() noexcept
+        {
+            return falcon::simd::batchKernels().get<T>().mat4;
+        }
+
+
+        template <typename T, bool Projective>
+        void transformPacked(const Matrix4D<T>& matrix, const std::span<const Vector4D<T>> src,
+                             const std::span<Vector4D<T>> out, const StoreMode mode) noexcept
+        {
+            static_assert(sizeof(Vector4D<T>) == 4 * sizeof(T), "Vector4D must be packed to be transformed in place");
+            assert(src.size() == out.size() && "Destination must hold exactly as many vectors as the source");
+
+            const auto& kernels = mat4Kernels<T>();
+            const auto kernel = Projective ? kernels.transformProjective : kernels.transform;
+            kernel(&matrix.elements[0][0], reinterpret_cast<const T*>(src.data()),
+                   useStreamingStores<T>(mode, src.size()), reinterpret_cast<T*>(out.data()), src.size());
+        }
+
+
+        template <typename T, bool Projective>
+        void transformStreams(const Matrix4D<T>& matrix, const Vec4Array<T>& src, Vec4Array<T>& out,
+                              const StoreMode mode) noexcept
+        {
+            assert(src.size() == out.size() && "Vec4Array sizes must match");
+
+            const auto& kernels = mat4Kernels<T>();
+            const auto kernel = Projective ? kernels.transformStreamsProjective : kernels.transformStreams;
+            kernel(&matrix.elements[0][0], src.streams(), useStreamingStores<T>(mode, src.size()), out.streams(),
+                   src.size());
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, const std::type_identity_t<std::span<const Vector4D<T>>> src,
+                   const std::type_identity_t<std::span<Vector4D<T>>> out, const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, false>(matrix, src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, const std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                   const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, false>(matrix, vectors, vectors, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, const std::type_identity_t<std::span<const Vector4D<T>>> src,
+                             const std::type_identity_t<std::span<Vector4D<T>>> out, const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, true>(matrix, src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, const std::type_identity_t<std::span<Vector4D<T>>> vectors,
+                             const StoreMode mode) noexcept
+    {
+        detail::transformPacked<T, true>(matrix, vectors, vectors, mode);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, const Vec4Array<T>& src, Vec4Array<T>& out, const StoreMode mode)
+    {
+        out.resize(src.size());
+        detail::transformStreams<T, false>(matrix, src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transform(const Matrix4D<T>& matrix, Vec4Array<T>& vectors, const StoreMode mode) noexcept
+    {
+        detail::transformStreams<T, false>(matrix, vectors, vectors, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, const Vec4Array<T>& src, Vec4Array<T>& out,
+                             const StoreMode mode)
+    {
+        out.resize(src.size());
+        detail::transformStreams<T, true>(matrix, src, out, mode);
+    }
+
+
+    template <BatchArithmetic T>
+    void transformProjective(const Matrix4D<T>& matrix, Vec4Array<T>& vectors, const StoreMode mode) noexcept
+    {
+        detail::transformStreams<T, true>(matrix, vectors, vectors, mode);
+    }
+} // namespace fgm
@@ -0,0 +1,267 @@
+#pragma once
+/**
+ * @file Matrix4DSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register kernels backing the runtime path of @ref fgm::Matrix4D.
+ * @details Builds on the @ref fgm::Vector4D kernels, so each column lives in the same register(s) as a vector:
+ *          - Products broadcast one component per column and accumulate with fused multiply-add where available.
+ *          - Transposes shuffle the four columns in registers instead of going through memory.
+ *          - The `float` inverse and determinant expand along 2x2 minors held in `__m128` lanes.
+ *
+ * @note Only included from Matrix4D.tpp, once @ref fgm::Matrix4D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Matrix4D.h"
+#include "vector/Vector4DSimd.h"
+
+#include <type_traits>
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *              TRAITS               *
+     *                                   *
+     *************************************/
+
+    /** @brief True if @ref Matrix4D<T> can be transposed in registers. */
+    template <typename T>
+    inline constexpr bool hasMat4Transpose = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+
+
+    /*************************************
+     *                                   *
+     *          MULTIPLY AND ADD         *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Compute `a * b + c` lane by lane, fused when the target has FMA.
+     *
+     * @param[in] a First factor.
+     * @param[in] b Second factor.
+     * @param[in] c Addend.
+     *
+     * @return Register holding `a * b + c`.
+     */
+    [[nodiscard]] inline __m128 mulAdd(const __m128 a, const __m128 b, const __m128 c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+
+    /** @copydoc mulAdd(__m128, __m128, __m128) */
+    [[nodiscard]] inline Double4 mulAdd(const Double4 a, const Double4 b, const Double4 c) noexcept
+    {
+#if defined(FALCON_AVX_SUPPORTED) && defined(__FMA__)
+        return _mm256_fmadd_pd(a, b, c);
+#else
+        return add(mul(a, b), c);
+#endif
+    }
+
+
+    /** @copydoc mulAdd(__m128, __m128, __m128) */
+    [[nodiscard]] inline Long4 mulAdd(const Long4 a, const Long4 b, const Long4 c) noexcept
+    {
+        return add(mul(a, b), c);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             PRODUCTS              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transform a vector by a matrix as a linear combination of its columns.
+     *
+     * @param[in] mat Matrix whose columns are combined.
+     * @param[in] vec Weights of the columns.
+     *
+     * @return Register holding `mat * vec`.
+     */
+    template <typename T>
+    [[nodiscard]] inline auto transform(const Matrix4D<T>& mat, const Vector4D<T>& vec) noexcept
+    {
+        auto result = mul(load(mat.col_vectors[0]), broadcast(vec.x));
+        result = mulAdd(load(mat.col_vectors[1]), broadcast(vec.y), result);
+        result = mulAdd(load(mat.col_vectors[2]), broadcast(vec.z), result);
+        return mulAdd(load(mat.col_vectors[3]), broadcast(vec.w), result);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             TRANSPOSE             *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Transpose a matrix in registers.
+     *
+     * @param[in] mat Matrix to transpose.
+     *
+     * @return Transposed matrix.
+     */
+    [[nodiscard]] inline Matrix4D<float> transpose(const Matrix4D<float>& mat) noexcept
+    {
+        __m128 c0 = load(mat.col_vectors[0]);
+        __m128 c1 = load(mat.col_vectors[1]);
+        __m128 c2 = load(mat.col_vectors[2]);
+        __m128 c3 = load(mat.col_vectors[3]);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        return { store(c0), store(c1), store(c2), store(c3) };
+    }
+
+
+    /** @copydoc transpose(const Matrix4D<float>&) */
+    [[nodiscard]] inline Matrix4D<double> transpose(const Matrix4D<double>& mat) noexcept
+    {
+        const Double4 c0 = load(mat.col_vectors[0]);
+        const Double4 c1 = load(mat.col_vectors[1]);
+        const Double4 c2 = load(mat.col_vectors[2]);
+        const Double4 c3 = load(mat.col_vectors[3]);
+#ifdef FALCON_AVX_SUPPORTED
+        // Interleave within 128-bit halves, then swap the halves across registers.
+        const __m256d t0 = _mm256_unpacklo_pd(c0, c1); // <c0.x, c1.x, c0.z, c1.z>
+        const __m256d t1 = _mm256_unpackhi_pd(c0, c1); // <c0.y, c1.y, c0.w, c1.w>
+        const __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+        const __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+        return { store(_mm256_permute2f128_pd(t0, t2, 0x20)), store(_mm256_permute2f128_pd(t1, t3, 0x20)),
+                 store(_mm256_permute2f128_pd(t0, t2, 0x31)), store(_mm256_permute2f128_pd(t1, t3, 0x31)) };
+#else
+        return { store(Double4{ _mm_unpacklo_pd(c0.lo, c1.lo), _mm_unpacklo_pd(c2.lo, c3.lo) }),
+                 store(Double4{ _mm_unpackhi_pd(c0.lo, c1.lo), _mm_unpackhi_pd(c2.lo, c3.lo) }),
+                 store(Double4{ _mm_unpacklo_pd(c0.hi, c1.hi), _mm_unpacklo_pd(c2.hi, c3.hi) }),
+                 store(Double4{ _mm_unpackhi_pd(c0.hi, c1.hi), _mm_unpackhi_pd(c2.hi, c3.hi) }) };
+#endif
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *        INVERSE / DETERMINANT      *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Intermediate products of the 2x2 minor expansion of a `float` matrix.
+     * @details With `a, b, c, d` the upper 3D parts of the columns and `x, y, z, w` the bottom row:
+     *          `s = a x b`, `t = c x d`, `u = y a - x b` and `v = w c - z d`, each with a zero `w` lane.
+     *          The determinant is `s . v + t . u`.
+     */
+    struct Mat4Minors
+    {
+        __m128 a, b, c, d; ///< Columns with the bottom row cleared.
+        __m128 x, y, z, w; ///< Bottom row entries, each broadcast to every lane.
+        __m128 s, t, u, v; ///< Minor vectors.
+    };
+
+
+    /** @brief Lane mask keeping `<x, y, z>` and clearing `w`. */
+    [[nodiscard]] inline __m128 xyzMask() noexcept
+    {
+        return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    }
+
+
+    /** @brief Cross product of the `<x, y, z>` lanes; the `w` lane is `0` for finite inputs. */
+    [[nodiscard]] inline __m128 cross3(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        const __m128 lhsYzx = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 rhsYzx = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 crossed = _mm_sub_ps(_mm_mul_ps(lhs, rhsYzx), _mm_mul_ps(lhsYzx, rhs)); // Lanes are <z, x, y>
+        return _mm_shuffle_ps(crossed, crossed, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+
+    /**
+     * @brief Compute the minor vectors of @p mat.
+     *
+     * @param[in] mat Matrix to expand.
+     *
+     * @return Columns, bottom row and minor vectors.
+     */
+    [[nodiscard]] inline Mat4Minors minors(const Matrix4D<float>& mat) noexcept
+    {
+        const __m128 mask = xyzMask();
+        const __m128 col0 = load(mat.col_vectors[0]);
+        const __m128 col1 = load(mat.col_vectors[1]);
+        const __m128 col2 = load(mat.col_vectors[2]);
+        const __m128 col3 = load(mat.col_vectors[3]);
+
+        Mat4Minors m{};
+        m.a = _mm_and_ps(col0, mask);
+        m.b = _mm_and_ps(col1, mask);
+        m.c = _mm_and_ps(col2, mask);
+        m.d = _mm_and_ps(col3, mask);
+        m.x = _mm_shuffle_ps(col0, col0, _MM_SHUFFLE(3, 3, 3, 3));
+        m.y = _mm_shuffle_ps(col1, col1, _MM_SHUFFLE(3, 3, 3, 3));
+        m.z = _mm_shuffle_ps(col2, col2, _MM_SHUFFLE(3, 3, 3, 3));
+        m.w = _mm_shuffle_ps(col3, col3, _MM_SHUFFLE(3, 3, 3, 3));
+
+        m.s = cross3(m.a, m.b);
+        m.t = cross3(m.c, m.d);
+        m.u = _mm_sub_ps(_mm_mul_ps(m.a, m.y), _mm_mul_ps(m.b, m.x));
+        m.v = _mm_sub_ps(_mm_mul_ps(m.c, m.w), _mm_mul_ps(m.d, m.z));
+        return m;
+    }
+
+
+    /** @brief Determinant of the matrix @p m was expanded from, broadcast to every lane. */
+    [[nodiscard]] inline __m128 determinant(const Mat4Minors& m) noexcept
+    {
+        return _mm_add_ps(dot(m.s, m.v), dot(m.t, m.u));
+    }
+
+
+    /**
+     * @brief Invert the matrix @p m was expanded from.
+     *
+     * @param[in] m           Minor expansion of the matrix.
+     * @param[in] determinant Determinant from @ref determinant(const Mat4Minors&), already checked to be non-zero.
+     *
+     * @return Inverse matrix.
+     */
+    [[nodiscard]] inline Matrix4D<float> inverse(const Mat4Minors& m, const __m128 determinant) noexcept
+    {
+        const __m128 mask = xyzMask();
+        const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+        const __m128 s = _mm_mul_ps(m.s, invDet);
+        const __m128 t = _mm_mul_ps(m.t, invDet);
+        const __m128 u = _mm_mul_ps(m.u, invDet);
+        const __m128 v = _mm_mul_ps(m.v, invDet);
+
+        // Rows of the inverse: the 3D part from the minors, the last entry from a dot product.
+        const auto row = [&](const __m128 xyz, const __m128 last)
+        { return _mm_or_ps(_mm_and_ps(mask, xyz), _mm_andnot_ps(mask, last)); };
+
+        __m128 r0 = row(_mm_add_ps(cross3(m.b, v), _mm_mul_ps(t, m.y)), negate(dot(m.b, t)));
+        __m128 r1 = row(_mm_sub_ps(cross3(v, m.a), _mm_mul_ps(t, m.x)), dot(m.a, t));
+        __m128 r2 = row(_mm_add_ps(cross3(m.d, u), _mm_mul_ps(s, m.w)), negate(dot(m.d, s)));
+        __m128 r3 = row(_mm_sub_ps(cross3(u, m.c), _mm_mul_ps(s, m.z)), dot(m.c, s));
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3); // Rows to columns
+        return { store(r0), store(r1), store(r2), store(r3) };
+    }
+
+} // namespace fgm::detail
+#endif
@@ -0,0 +1,178 @@
+#pragma once
+/**
+ * @file Parallel.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Split batch vector and matrix operations into cache-sized chunks run across cores.
+ *
+ * @details The batch kernels of @ref Dispatch.h saturate one core; @ref fgm::parallel::for_each_chunk spreads a job
+ *          over the threads of a @ref fgm::parallel::ThreadPool by handing each thread whole chunks:
+ *          - Chunks hold about @ref Config::PARALLEL_CHUNK_BYTES of input, rounded to whole registers with
+ *            @ref falcon::simd::calculatePackedSize, so every chunk but the last starts on a register boundary of an
+ *            aligned buffer and the kernels run without a scalar tail.
+ *          - Inputs smaller than @ref Config::PARALLEL_THRESHOLD run on the calling thread, chunk by chunk.
+ *
+ * @par Chunking modes
+ * @ref fgm::parallel::ChunkMode::Balanced shrinks chunks so every thread gets several, which balances uneven cores.
+ * @ref fgm::parallel::ChunkMode::Deterministic fixes the chunk boundaries from the element size alone, whatever the
+ * thread count or input size: reductions that combine one partial result per chunk in chunk order then give
+ * bit-identical results on every machine and thread count.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "ThreadPool.h"
+#include "common/Config.h"
+
+#include <Dispatch.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+namespace fgm::parallel
+{
+    /**
+     * @addtogroup FGM_Parallel
+     * @{
+     */
+
+    /** @brief How @ref for_each_chunk sizes its chunks. */
+    enum class ChunkMode : std::uint8_t
+    {
+        Balanced,     ///< At least four chunks per thread, no larger than @ref ChunkOptions::chunkBytes.
+        Deterministic ///< Chunks of @ref ChunkOptions::chunkBytes, independent of the input size and thread count.
+    };
+
+
+    /** @brief Tuning of @ref for_each_chunk. */
+    struct ChunkOptions
+    {
+        ChunkMode mode = ChunkMode::Balanced;
+
+        /** @brief Target input bytes per chunk, rounded to whole registers. */
+        std::size_t chunkBytes = Config::PARALLEL_CHUNK_BYTES;
+
+        /** @brief Input bytes below which every chunk runs on the calling thread. */
+        std::size_t parallelThreshold = Config::PARALLEL_THRESHOLD;
+
+        /** @brief Pool running the chunks. `nullptr` selects @ref ThreadPool::global. */
+        ThreadPool* pool = nullptr;
+    };
+
+
+    /** @brief Elements `[begin, end)` of the job, the `index`-th chunk in element order. */
+    struct ChunkRange
+    {
+        std::size_t index;
+        std::size_t begin;
+        std::size_t end;
+
+        /** @brief Number of elements in the chunk. */
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return end - begin;
+        }
+    };
+
+
+    /** @brief Chunking of one job, as computed by @ref planChunks. */
+    struct ChunkPlan
+    {
+        std::size_t chunkSize;  ///< Elements per chunk; the last chunk may be shorter.
+        std::size_t chunkCount; ///< Number of chunks, `0` for an empty job.
+        bool parallel;          ///< False if the chunks run on the calling thread.
+    };
+
+
+    /**
+     * @brief Chunking @ref for_each_chunk uses for @p count elements of @p elementBytes bytes.
+     * @details Reductions size their array of partial results with it.
+     *
+     * @param[in] count        Number of elements.
+     * @param[in] elementBytes Input bytes per element, across every stream for structure-of-arrays data.
+     * @param[in] options      Chunking options.
+     */
+    [[nodiscard]] ChunkPlan planChunks(std::size_t count, std::size_t elementBytes, const ChunkOptions& options = {});
+
+
+    /**
+     * @brief Call `fn(range)` for every chunk of @p count elements, concurrently across the pool.
+     *
+     * @param[in] count        Number of elements.
+     * @param[in] elementBytes Input bytes per element, which sets the chunk size.
+     * @param[in] fn           Callable taking a @ref ChunkRange. Must be safe to call concurrently.
+     * @param[in] options      Chunking options.
+     */
+    template <typename F>
+    void for_each_chunk(std::size_t count, std::size_t elementBytes, F&& fn, const ChunkOptions& options = {});
+
+
+    /**
+     * @brief Call `fn(chunk, range)` for every chunk of packed (array-of-structures) @p items.
+     *
+     * @param[in] items   Elements, such as @ref Vector4D or @ref Matrix4D.
+     * @param[in] fn      Callable taking `std::span<T>` over the chunk and its @ref ChunkRange.
+     * @param[in] options Chunking options.
+     */
+    template <typename T, typename F>
+    void for_each_chunk(std::span<T> items, F&& fn, const ChunkOptions& options = {});
+
+
+    /**
+     * @brief Call `fn(chunk, range)` for every chunk of structure-of-arrays vectors, such as @ref Vec4Array::streams.
+     * @details Chunks are planned as `planChunks(count, sizeof(T))` with a quarter of the byte budgets of @p options,
+     *          one stream's share, so every chunk starts on a register boundary of each stream.
+     *
+     * @param[in] streams Component streams of at least @p count elements each.
+     * @param[in] count   Number of vectors.
+     * @param[in] fn      Callable taking the streams offset to the chunk and its @ref ChunkRange.
+     * @param[in] options Chunking options.
+     */
+    template <typename T, typename F>
+    void for_each_chunk(falcon::simd::Vec4Streams<T> streams, std::size_t count, F&& fn,
+                        const ChunkOptions& options = {});
+
+
+
+    /**
+     * @brief Reduce every chunk of @p count elements to a partial result, then fold the partials into one.
+     * @details `map(range)` runs once per chunk, concurrently as in @ref for_each_chunk. The calling thread then folds
+     *          the partials with `combine(lower, upper)` in a balanced tree over chunk order: neighbouring chunks
+     *          first, then neighbouring pairs, and so on. The fold order only depends on the chunk count, so with
+     *          @ref ChunkMode::Deterministic the result is the same for every thread count, and the tree keeps the
+     *          rounding error of sums growing with the logarithm of the chunk count.
+     *
+     * @param[in] count        Number of elements.
+     * @param[in] elementBytes Input bytes per element, which sets the chunk size.
+     * @param[in] map          Callable taking a @ref ChunkRange, returning its `R`. Must be safe to call concurrently.
+     * @param[in] combine      Callable folding two `R`, the one of the lower chunks first.
+     * @param[in] identity     Result of an empty job.
+     * @param[in] options      Chunking options.
+     */
+    template <typename R, typename Map, typename Combine>
+    [[nodiscard]] R reduce_chunks(std::size_t count, std::size_t elementBytes, Map&& map, Combine&& combine, R identity,
+                                  const ChunkOptions& options = {});
+
+
+    /** @brief @ref reduce_chunks over chunks of packed @p items, `map` taking the chunk span and its range. */
+    template <typename R, typename T, typename Map, typename Combine>
+    [[nodiscard]] R reduce_chunks(std::span<T> items, Map&& map, Combine&& combine, R identity,
+                                  const ChunkOptions& options = {});
+
+
+    /**
+     * @brief @ref reduce_chunks over chunks of structure-of-arrays vectors, `map` taking the offset streams and the
+     *        range. Chunks are planned as in the streams overload of @ref for_each_chunk.
+     */
+    template <typename R, typename T, typename Map, typename Combine>
+    [[nodiscard]] R reduce_chunks(falcon::simd::Vec4Streams<T> streams, std::size_t count, Map&& map, Combine&& combine,
+                                  R identity, const ChunkOptions& options = {});
+
+    /** @} */
+
+} // namespace fgm::parallel
+
+#include "Parallel.tpp"
@@ -0,0 +1,166 @@
+#pragma once
+/**
+ * @file Parallel.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::parallel::for_each_chunk and @ref fgm::parallel::reduce_chunks template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Parallel.h"
+
+#include <AlignedMemory.h>
+#include <SIMDUtils.h>
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+namespace fgm::parallel
+{
+    namespace detail
+    {
+        /**
+         * @brief Options planning structure-of-arrays chunks over one stream, a quarter of the bytes, so each chunk
+         *        starts on a register boundary of every stream rather than of the vectors as a whole.
+         */
+        inline ChunkOptions streamOptions(ChunkOptions options) noexcept
+        {
+            options.chunkBytes /= 4;
+            options.parallelThreshold /= 4;
+            return options;
+        }
+
+
+        /** @brief @p streams advanced by @p offset vectors. */
+        template <typename T>
+        falcon::simd::Vec4Streams<T> offsetStreams(const falcon::simd::Vec4Streams<T>& streams,
+                                                   const std::size_t offset) noexcept
+        {
+            return { streams.x + offset, streams.y + offset, streams.z + offset, streams.w + offset };
+        }
+    } // namespace detail
+
+
+
+    inline ChunkPlan planChunks(const std::size_t count, const std::size_t elementBytes, const ChunkOptions& options)
+    {
+        assert(elementBytes > 0 && "Chunked elements must have a size");
+        if (count == 0)
+            return { 0, 0, false };
+
+        // The chunk budget as whole registers, then as the fewest elements that end on a register boundary.
+        const std::size_t width = falcon::simd::defaultAlignment;
+        const falcon::simd::PackingParams packing = falcon::simd::calculatePackedSize(options.chunkBytes, width);
+        const std::size_t budgetBytes = packing.registerCount * packing.packedRegisterWidth;
+        const std::size_t granularity = width / std::gcd(width, elementBytes);
+        const auto roundUp = [granularity](const std::size_t n)
+        { return (n + granularity - 1) / granularity * granularity; };
+
+        std::size_t chunkSize = std::max(budgetBytes / elementBytes / granularity, std::size_t(1)) * granularity;
+
+        ThreadPool& pool = options.pool ? *options.pool : ThreadPool::global();
+        const bool parallel = pool.size() > 1 && count > chunkSize / 2 &&
+            count * elementBytes >= options.parallelThreshold;
+
+        if (parallel && options.mode == ChunkMode::Balanced)
+        {
+            // Several chunks per thread let fast threads take over the chunks of slow ones, down to a sixteenth of
+            // the budget so the per-chunk overhead stays negligible.
+            const std::size_t target = pool.size() * 4;
+            const std::size_t minChunk = roundUp(std::max(budgetBytes / 16 / elementBytes, std::size_t(1)));
+            chunkSize = std::clamp(roundUp((count + target - 1) / target), minChunk, std::max(chunkSize, minChunk));
+        }
+
+        const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        return { chunkSize, chunkCount, parallel && chunkCount > 1 };
+    }
+
+
+    template <typename F>
+    void for_each_chunk(const std::size_t count, const std::size_t elementBytes, F&& fn, const ChunkOptions& options)
+    {
+        const ChunkPlan plan = planChunks(count, elementBytes, options);
+        const auto body = [&](const std::size_t index)
+        {
+            const std::size_t begin = index * plan.chunkSize;
+            fn(ChunkRange{ index, begin, std::min(begin + plan.chunkSize, count) });
+        };
+
+        if (!plan.parallel)
+        {
+            for (std::size_t i = 0; i < plan.chunkCount; ++i)
+                body(i);
+            return;
+        }
+
+        ThreadPool& pool = options.pool ? *options.pool : ThreadPool::global();
+        pool.run(plan.chunkCount, body);
+    }
+
+
+    template <typename T, typename F>
+    void for_each_chunk(const std::span<T> items, F&& fn, const ChunkOptions& options)
+    {
+        for_each_chunk(items.size(), sizeof(T),
+                       [&](const ChunkRange& range) { fn(items.subspan(range.begin, range.size()), range); },
+                       options);
+    }
+
+
+    template <typename T, typename F>
+    void for_each_chunk(const falcon::simd::Vec4Streams<T> streams, const std::size_t count, F&& fn,
+                        const ChunkOptions& options)
+    {
+        for_each_chunk(count, sizeof(T),
+                       [&](const ChunkRange& range) { fn(detail::offsetStreams(streams, range.begin), range); },
+                       detail::streamOptions(options));
+    }
+
+
+    template <typename R, typename Map, typename Combine>
+    R reduce_chunks(const std::size_t count, const std::size_t elementBytes, Map&& map, Combine&& combine,
+                    const R identity, const ChunkOptions& options)
+    {
+        std::vector<R> partials(planChunks(count, elementBytes, options).chunkCount, identity);
+        for_each_chunk(count, elementBytes, [&](const ChunkRange& range) { partials[range.index] = map(range); },
+                       options);
+
+        if (partials.empty())
+            return identity;
+
+        // Neighbours first, then pairs of pairs: the fold order depends only on the chunk count.
+        for (std::size_t step = 1; step < partials.size(); step *= 2)
+            for (std::size_t i = 0; i + step < partials.size(); i += 2 * step)
+                partials[i] = combine(partials[i], partials[i + step]);
+        return partials.front();
+    }
+
+
+    template <typename R, typename T, typename Map, typename Combine>
+    R reduce_chunks(const std::span<T> items, Map&& map, Combine&& combine, const R identity,
+                    const ChunkOptions& options)
+    {
+        return reduce_chunks(
+            items.size(), sizeof(T),
+            [&](const ChunkRange& range) { return map(items.subspan(range.begin, range.size()), range); },
+            std::forward<Combine>(combine), identity, options);
+    }
+
+
+    template <typename R, typename T, typename Map, typename Combine>
+    R reduce_chunks(const falcon::simd::Vec4Streams<T> streams, const std::size_t count, Map&& map,
+                    Combine&& combine, const R identity, const ChunkOptions& options)
+    {
+        return reduce_chunks(
+            count, sizeof(T),
+            [&](const ChunkRange& range) { return map(detail::offsetStreams(streams, range.begin), range); },
+            std::forward<Combine>(combine), identity, detail::streamOptions(options));
+    }
+
+} // namespace fgm::parallel
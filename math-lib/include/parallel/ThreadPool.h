@@ -0,0 +1,114 @@
+#pragma once
+/**
+ * @file ThreadPool.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Small work-stealing thread pool running the chunks of parallel batch operations.
+ *
+ * @details Every worker owns a task deque. Tasks of one @ref fgm::parallel::ThreadPool::run call are dealt round-robin
+ *          over the deques; a worker pops its own deque from the back and, once it runs dry, steals from the front of
+ *          the others, so a worker slowed down by a busy core hands its remaining chunks to the idle ones. The thread
+ *          calling @ref fgm::parallel::ThreadPool::run steals too instead of blocking, which also makes nested calls
+ *          from inside a task safe.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace fgm::parallel
+{
+    /**
+     * @addtogroup FGM_Parallel
+     * @{
+     */
+
+    class ThreadPool
+    {
+        public:
+        /**
+         * @brief Start `threads - 1` workers; the thread calling @ref run is the last one.
+         *
+         * @param[in] threads Threads running tasks. `0` and `1` run every task on the calling thread.
+         */
+        explicit ThreadPool(std::size_t threads = defaultThreadCount());
+
+        /** @brief Finish the queued tasks and join every worker. */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+
+        /** @brief Threads running the tasks of @ref run, the calling thread included. Never `0`. */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+
+        /**
+         * @brief Call `task(i)` for every `i` in `[0, count)` and return once every call has finished.
+         * @details Calls run concurrently and in no particular order. The calling thread runs tasks while it waits.
+         *
+         * @param[in] count Number of calls.
+         * @param[in] task  Callable taking the call index. Must be safe to call concurrently.
+         *
+         * @throw Rethrows the first exception thrown by a call, once every call has finished or been skipped.
+         *        If queueing a call fails, that exception is rethrown once the calls already queued have finished
+         *        or been skipped.
+         */
+        template <typename F>
+        void run(std::size_t count, F&& task);
+
+
+        /** @brief Hardware thread count, or `1` if it cannot be determined. */
+        [[nodiscard]] static std::size_t defaultThreadCount() noexcept;
+
+        /** @brief Process-wide pool of @ref defaultThreadCount threads, started on first use. */
+        [[nodiscard]] static ThreadPool& global();
+
+
+        private:
+        using Task = std::function<void()>;
+
+        /** @brief Deque of one worker, locked on every push, pop and steal. */
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /** @brief Append @p task to deque @p queue and count it as pending. */
+        void push(std::size_t queue, Task task);
+
+        /** @brief Release every worker waiting in @ref workerLoop. */
+        void wakeWorkers() noexcept;
+
+        /** @brief Run one task: the newest of deque @p home, else the oldest of another deque. */
+        bool tryRunOne(std::size_t home);
+
+        void workerLoop(std::size_t index);
+
+        std::vector<std::unique_ptr<Queue>> _queues;
+        std::vector<std::thread> _workers;
+
+        std::atomic<std::size_t> _pending{ 0 }; ///< Tasks sitting in a deque.
+        std::atomic<std::size_t> _nextQueue{ 0 };
+        std::atomic<std::uint32_t> _wake{ 0 }; ///< Bumped on new tasks or shutdown; idle workers wait on it.
+        std::atomic<bool> _stopping{ false };
+    };
+
+    /** @} */
+
+} // namespace fgm::parallel
+
+#include "ThreadPool.tpp"
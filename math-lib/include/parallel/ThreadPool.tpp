@@ -0,0 +1,221 @@
+#pragma once
+/**
+ * @file ThreadPool.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::parallel::ThreadPool implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+
+namespace fgm::parallel
+{
+    namespace detail
+    {
+        /** @brief Deque index of the calling thread in @ref workerPool, if it is a worker. */
+        inline thread_local const ThreadPool* workerPool = nullptr;
+        inline thread_local std::size_t workerIndex = 0;
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *            LIFETIME               *
+     *                                   *
+     *************************************/
+
+    inline ThreadPool::ThreadPool(const std::size_t threads)
+    {
+        const std::size_t workers = threads > 1 ? threads - 1 : 0;
+        for (std::size_t i = 0; i < workers; ++i)
+            _queues.push_back(std::make_unique<Queue>());
+
+        _workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i)
+            _workers.emplace_back([this, i] { workerLoop(i); });
+    }
+
+
+    inline ThreadPool::~ThreadPool()
+    {
+        _stopping.store(true, std::memory_order_release);
+        wakeWorkers();
+
+        for (std::thread& worker : _workers)
+            worker.join();
+    }
+
+
+    inline std::size_t ThreadPool::size() const noexcept
+    {
+        return _workers.size() + 1;
+    }
+
+
+    inline std::size_t ThreadPool::defaultThreadCount() noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+
+    inline ThreadPool& ThreadPool::global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            SCHEDULING             *
+     *                                   *
+     *************************************/
+
+    template <typename F>
+    void ThreadPool::run(const std::size_t count, F&& task)
+    {
+        if (_workers.empty() || count <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                task(i);
+            return;
+        }
+
+        struct State
+        {
+            std::atomic<std::size_t> remaining;
+            std::atomic<bool> failed{ false };
+            std::exception_ptr error;
+        } state{ count, false, {} };
+
+        const std::size_t home = detail::workerPool == this ? detail::workerIndex : 0;
+        const auto waitForQueued = [&]
+        {
+            while (state.remaining.load(std::memory_order_acquire) != 0)
+            {
+                if (!tryRunOne(home))
+                    std::this_thread::yield();
+            }
+        };
+
+        std::size_t queued = 0;
+        try
+        {
+            for (; queued < count; ++queued)
+            {
+                const std::size_t i = queued;
+                push(_nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size(), [&state, &task, i]
+                {
+                    // Once a call throws, the remaining ones are skipped rather than run against a failed job.
+                    if (!state.failed.load(std::memory_order_relaxed))
+                    {
+                        try
+                        {
+                            task(i);
+                        }
+                        catch (...)
+                        {
+                            if (!state.failed.exchange(true))
+                                state.error = std::current_exception();
+                        }
+                    }
+                    state.remaining.fetch_sub(1, std::memory_order_release);
+                });
+            }
+        }
+        catch (...)
+        {
+            // The queued tasks still reference state and task on this frame: skip them and wait before unwinding.
+            state.failed.store(true, std::memory_order_relaxed);
+            state.remaining.fetch_sub(count - queued, std::memory_order_release);
+            wakeWorkers();
+            waitForQueued();
+            throw;
+        }
+
+        wakeWorkers();
+        waitForQueued();
+
+        if (state.error)
+            std::rethrow_exception(state.error);
+    }
+
+
+    inline void ThreadPool::push(const std::size_t queue, Task task)
+    {
+        std::lock_guard lock(_queues[queue]->mutex);
+        _queues[queue]->tasks.push_back(std::move(task));
+        _pending.fetch_add(1, std::memory_order_release);
+    }
+
+
+    inline void ThreadPool::wakeWorkers() noexcept
+    {
+        _wake.fetch_add(1, std::memory_order_release);
+        _wake.notify_all();
+    }
+
+
+    inline bool ThreadPool::tryRunOne(const std::size_t home)
+    {
+        Task task;
+        for (std::size_t k = 0; k < _queues.size() && !task; ++k)
+        {
+            Queue& queue = *_queues[(home + k) % _queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+
+            // The owner takes its newest task, thieves the oldest, so both ends are rarely contended.
+            if (k == 0)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            _pending.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (!task)
+            return false;
+        task();
+        return true;
+    }
+
+
+    inline void ThreadPool::workerLoop(const std::size_t index)
+    {
+        detail::workerPool = this;
+        detail::workerIndex = index;
+
+        while (true)
+        {
+            if (tryRunOne(index))
+                continue;
+
+            // Read the counter before re-checking, so a wake between the check and the wait is not lost.
+            const std::uint32_t seen = _wake.load(std::memory_order_acquire);
+            if (_pending.load(std::memory_order_acquire) != 0)
+                continue;
+            if (_stopping.load(std::memory_order_acquire))
+                return;
+            _wake.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+} // namespace fgm::parallel
@@ -0,0 +1,369 @@
+#pragma once
+/**
+ * @file Quaternion.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Templated quaternion representing 3D rotations.
+ *
+ * @details @ref fgm::Quaternion stores its imaginary part in `x`, `y`, `z` and its real part in `w`, with the size
+ *          and alignment of a @ref fgm::Vector4D of the same type. It converts to and from that vector without
+ *          shuffling, so the Hamilton product, rotation, dot products and normalization load it straight into the
+ *          registers @ref fgm::Vector4D uses and reuse its kernels. Constant evaluation always uses the scalar path.
+ *
+ *          Rotations follow the matrices of this library: column vectors, right-handed, counter-clockwise for a
+ *          positive angle. `a * b` applies `b` first, then `a`, like `A * B` of the matching matrices.
+ *
+ * @tparam T Type of the components. Must be a floating point type.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SimdTraits.h"
+#include "common/Config.h"
+#include "matrix/Matrix3D.h"
+#include "matrix/Matrix4D.h"
+#include "vector/Vector3D.h"
+#include "vector/Vector4D.h"
+
+#include <concepts>
+#include <cstddef>
+
+
+namespace fgm
+{
+
+    template <std::floating_point T>
+    struct alignas(SimdTraits<T, 4>::alignment) Quaternion
+    {
+
+        /**
+         * @addtogroup FGM_Quat_Members
+         * @{
+         */
+
+        using value_type = T;
+
+        T x; ///< First imaginary component
+        T y; ///< Second imaginary component
+        T z; ///< Third imaginary component
+        T w; ///< Real component
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Quat_Init
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize the identity rotation, \f$ (0, 0, 0, 1) \f$. */
+        [[nodiscard]] constexpr Quaternion() noexcept;
+
+
+        /**
+         * @brief Initialize @ref fgm::Quaternion from its components.
+         *
+         * @param[in] x First imaginary component.
+         * @param[in] y Second imaginary component.
+         * @param[in] z Third imaginary component.
+         * @param[in] w Real component.
+         */
+        [[nodiscard]] constexpr Quaternion(T x, T y, T z, T w) noexcept;
+
+
+        /**
+         * @brief Initialize @ref fgm::Quaternion from its imaginary and real parts.
+         *
+         * @param[in] vector Imaginary part.
+         * @param[in] scalar Real part.
+         */
+        [[nodiscard]] constexpr Quaternion(const Vector3D<T>& vector, T scalar) noexcept;
+
+
+        /**
+         * @brief Reinterpret a @ref fgm::Vector4D as a quaternion, `x`, `y`, `z` being the imaginary part.
+         *
+         * @param[in] xyzw Components in storage order.
+         */
+        [[nodiscard]] constexpr explicit Quaternion(const Vector4D<T>& xyzw) noexcept;
+
+
+        /**
+         * @brief Initialize @ref fgm::Quaternion from a quaternion of another floating point type.
+         *
+         * @param[in] other Quaternion to convert.
+         */
+        template <std::floating_point U>
+        [[nodiscard]] constexpr explicit Quaternion(const Quaternion<U>& other) noexcept;
+
+
+        /**
+         * @brief Rotation of @p angle radians around @p axis.
+         *
+         * @param[in] axis  Unit rotation axis.
+         * @param[in] angle Counter-clockwise angle in radians.
+         *
+         * @return The unit quaternion \f$ (\sin\frac{\theta}{2} \mathbf{a}, \cos\frac{\theta}{2}) \f$.
+         */
+        [[nodiscard]] static Quaternion fromAxisAngle(const Vector3D<T>& axis, T angle) noexcept;
+
+
+        /**
+         * @brief Rotation of a rotation matrix.
+         * @details Uses the largest of the trace and the diagonal to pick the component computed with a square root,
+         *          so the result stays accurate near 180 degree rotations.
+         *
+         * @param[in] matrix Orthonormal rotation matrix.
+         *
+         * @return The unit quaternion of the rotation. Its sign is unspecified; both signs represent it.
+         */
+        [[nodiscard]] static Quaternion fromMatrix(const Matrix3D<T>& matrix) noexcept;
+
+
+        /**
+         * @brief @copybrief fromMatrix(const Matrix3D<T>&)
+         *
+         * @param[in] matrix Affine transformation whose upper-left 3x3 block is a rotation. Translation and the
+         *                   projective row are ignored.
+         *
+         * @return The unit quaternion of the rotation block.
+         */
+        [[nodiscard]] static Quaternion fromMatrix(const Matrix4D<T>& matrix) noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Quat_Access
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            ACCESSORS              *
+         *                                   *
+         *************************************/
+
+        /** @brief Imaginary part, \f$ (x, y, z) \f$. */
+        [[nodiscard]] constexpr Vector3D<T> vector() const noexcept;
+
+        /** @brief Real part, \f$ w \f$. */
+        [[nodiscard]] constexpr T scalar() const noexcept;
+
+        /** @brief Components in storage order as a @ref fgm::Vector4D. */
+        [[nodiscard]] constexpr Vector4D<T> toVector4D() const noexcept;
+
+
+        /**
+         * @brief Access a component in storage order.
+         *
+         * @param[in] i Component index, 0 to 3 for `x`, `y`, `z` and `w`.
+         */
+        [[nodiscard]] constexpr T& operator[](std::size_t i) noexcept;
+
+        /** @copydoc operator[](std::size_t) */
+        [[nodiscard]] constexpr const T& operator[](std::size_t i) const noexcept;
+
+
+        /** @brief Rotation matrix of a unit quaternion. */
+        [[nodiscard]] Matrix3D<T> toMatrix3D() const;
+
+        /** @brief Affine transformation rotating by a unit quaternion, without translation. */
+        [[nodiscard]] Matrix4D<T> toMatrix4D() const;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Quat_Arithmetic
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            ARITHMETIC             *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Compose two rotations with the Hamilton product.
+         *
+         * @param[in] rhs Rotation applied first.
+         *
+         * @return The rotation applying @p rhs, then this quaternion.
+         */
+        [[nodiscard]] constexpr Quaternion operator*(const Quaternion& rhs) const noexcept;
+
+
+        /**
+         * @brief Compose @p rhs into this quaternion, `*this = *this * rhs`.
+         *
+         * @param[in] rhs Rotation applied first.
+         *
+         * @return Reference to this quaternion.
+         */
+        constexpr Quaternion& operator*=(const Quaternion& rhs) noexcept;
+
+
+        /** @brief Component-wise sum. */
+        [[nodiscard]] constexpr Quaternion operator+(const Quaternion& rhs) const noexcept;
+
+        /** @brief Component-wise difference. */
+        [[nodiscard]] constexpr Quaternion operator-(const Quaternion& rhs) const noexcept;
+
+        /** @brief Negate every component. Represents the same rotation. */
+        [[nodiscard]] constexpr Quaternion operator-() const noexcept;
+
+        /** @brief Scale every component by @p scalar. */
+        [[nodiscard]] constexpr Quaternion operator*(T scalar) const noexcept;
+
+
+        /** @brief True if every component is exactly equal. */
+        [[nodiscard]] constexpr bool operator==(const Quaternion& rhs) const noexcept = default;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Quat_Rotation
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *             ROTATION              *
+         *                                   *
+         *************************************/
+
+        /** @brief Four dimensional dot product, the cosine of half the angle between two unit quaternions. */
+        [[nodiscard]] constexpr T dot(const Quaternion& rhs) const noexcept;
+
+        /** @brief Euclidean norm, \f$ \sqrt{x^2 + y^2 + z^2 + w^2} \f$. */
+        [[nodiscard]] constexpr T mag() const noexcept;
+
+
+        /**
+         * @brief Scale to unit length.
+         * @warning Does not check for a zero quaternion.
+         *
+         * @tparam P Accuracy tier, as in @ref Vector4D::normalize.
+         */
+        template <Precision P = Precision::Exact>
+        [[nodiscard]] constexpr Quaternion normalize() const noexcept;
+
+
+        /** @brief Negate the imaginary part. The inverse of a unit quaternion. */
+        [[nodiscard]] constexpr Quaternion conjugate() const noexcept;
+
+
+        /**
+         * @brief Multiplicative inverse, \f$ q^{*} / \|q\|^2 \f$.
+         * @warning Does not check for a zero quaternion. Use @ref conjugate for unit quaternions.
+         */
+        [[nodiscard]] constexpr Quaternion inverse() const noexcept;
+
+
+        /**
+         * @brief Rotate a vector by a unit quaternion.
+         *        Compute \f$ \mathbf{v}' = \mathbf{v} + 2w(\mathbf{q} \times \mathbf{v}) +
+         *        2\mathbf{q} \times (\mathbf{q} \times \mathbf{v}) \f$, which takes two cross products instead of two
+         *        Hamilton products.
+         *
+         * @param[in] vec Vector to rotate.
+         *
+         * @return The rotated vector.
+         */
+        [[nodiscard]] constexpr Vector3D<T> rotate(const Vector3D<T>& vec) const noexcept;
+
+
+        /**
+         * @brief Rotate the `x`, `y` and `z` components of @p vec, keeping its `w` component.
+         *
+         * @param[in] vec Point (`w == 1`) or direction (`w == 0`) to rotate.
+         *
+         * @return The rotated vector.
+         */
+        [[nodiscard]] constexpr Vector4D<T> rotate(const Vector4D<T>& vec) const noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Quat_Interpolation
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *           INTERPOLATION           *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Normalized linear interpolation along the shorter arc.
+         * @details Cheaper than @ref slerp and exact at both ends, but sweeps the arc at a varying rate.
+         *
+         * @param[in] from Unit rotation at `t == 0`.
+         * @param[in] to   Unit rotation at `t == 1`.
+         * @param[in] t    Interpolation factor.
+         *
+         * @return Unit quaternion between @p from and @p to.
+         */
+        [[nodiscard]] static constexpr Quaternion nlerp(const Quaternion& from, const Quaternion& to, T t) noexcept;
+
+
+        /**
+         * @brief Spherical linear interpolation along the shorter arc at a constant angular rate.
+         * @details Falls back to @ref nlerp once the quaternions are closer than @ref Config::EPSILON, where the
+         *          division by the sine of their angle loses precision.
+         *
+         * @param[in] from Unit rotation at `t == 0`.
+         * @param[in] to   Unit rotation at `t == 1`.
+         * @param[in] t    Interpolation factor.
+         *
+         * @return Unit quaternion between @p from and @p to.
+         */
+        [[nodiscard]] static Quaternion slerp(const Quaternion& from, const Quaternion& to, T t) noexcept;
+
+        /** @} */
+    };
+
+
+    /**
+     * @addtogroup FGM_Quat_Arithmetic
+     * @{
+     */
+
+    /** @brief Scale every component of @p quat by @p scalar. */
+    template <std::floating_point T>
+    [[nodiscard]] constexpr Quaternion<T> operator*(T scalar, const Quaternion<T>& quat) noexcept;
+
+    /** @} */
+
+
+    /**
+     * @addtogroup FGM_Quat_Alias
+     * @{
+     */
+
+    using quat = Quaternion<float>;   ///< `float` quaternion
+    using dQuat = Quaternion<double>; ///< `double` quaternion
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Quaternion.tpp"
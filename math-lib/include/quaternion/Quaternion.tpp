@@ -0,0 +1,352 @@
+#pragma once
+/**
+ * @file Quaternion.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Quaternion template implementation.
+ * @details This file contains the definitions of the template members declared in Quaternion.h
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Quaternion.h"
+#include "QuaternionSimd.h"
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /**
+         * @brief Quaternion of the rotation block of @p matrix with Shepperd's method.
+         * @details Takes the square root of the largest of `4w^2 - 1`, `4x^2 - 1`, `4y^2 - 1` and `4z^2 - 1`, read off
+         *          the trace and the diagonal, and derives the other components from sums and differences of the
+         *          off-diagonal elements, so the divisor never drops below `1`.
+         */
+        template <typename T, typename M>
+        [[nodiscard]] Quaternion<T> quaternionFromRotation(const M& matrix) noexcept
+        {
+            const T m00 = matrix(0, 0), m01 = matrix(0, 1), m02 = matrix(0, 2);
+            const T m10 = matrix(1, 0), m11 = matrix(1, 1), m12 = matrix(1, 2);
+            const T m20 = matrix(2, 0), m21 = matrix(2, 1), m22 = matrix(2, 2);
+            const T trace = m00 + m11 + m22;
+
+            if (trace > T(0))
+            {
+                const T s = std::sqrt(trace + T(1)) * T(2); // s = 4w
+                return { (m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, s / T(4) };
+            }
+            if (m00 > m11 && m00 > m22)
+            {
+                const T s = std::sqrt(T(1) + m00 - m11 - m22) * T(2); // s = 4x
+                return { s / T(4), (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s };
+            }
+            if (m11 > m22)
+            {
+                const T s = std::sqrt(T(1) + m11 - m00 - m22) * T(2); // s = 4y
+                return { (m01 + m10) / s, s / T(4), (m12 + m21) / s, (m02 - m20) / s };
+            }
+            const T s = std::sqrt(T(1) + m22 - m00 - m11) * T(2); // s = 4z
+            return { (m02 + m20) / s, (m12 + m21) / s, s / T(4), (m10 - m01) / s };
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *            INITIALIZERS           *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr Quaternion<T>::Quaternion() noexcept: x(T(0)), y(T(0)), z(T(0)), w(T(1))
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T>::Quaternion(const T x, const T y, const T z, const T w) noexcept: x(x), y(y), z(z), w(w)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T>::Quaternion(const Vector3D<T>& vector, const T scalar) noexcept:
+        x(vector.x), y(vector.y), z(vector.z), w(scalar)
+    {}
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T>::Quaternion(const Vector4D<T>& xyzw) noexcept: x(xyzw.x), y(xyzw.y), z(xyzw.z), w(xyzw.w)
+    {}
+
+
+    template <std::floating_point T>
+    template <std::floating_point U>
+    constexpr Quaternion<T>::Quaternion(const Quaternion<U>& other) noexcept:
+        x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)), w(static_cast<T>(other.w))
+    {}
+
+
+    template <std::floating_point T>
+    Quaternion<T> Quaternion<T>::fromAxisAngle(const Vector3D<T>& axis, const T angle) noexcept
+    {
+        const T half = angle * T(0.5);
+        const T s = std::sin(half);
+        return { axis.x * s, axis.y * s, axis.z * s, std::cos(half) };
+    }
+
+
+    template <std::floating_point T>
+    Quaternion<T> Quaternion<T>::fromMatrix(const Matrix3D<T>& matrix) noexcept
+    {
+        return detail::quaternionFromRotation<T>(matrix);
+    }
+
+
+    template <std::floating_point T>
+    Quaternion<T> Quaternion<T>::fromMatrix(const Matrix4D<T>& matrix) noexcept
+    {
+        return detail::quaternionFromRotation<T>(matrix);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ACCESSORS              *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr Vector3D<T> Quaternion<T>::vector() const noexcept
+    {
+        return Vector3D<T>(x, y, z);
+    }
+
+
+    template <std::floating_point T>
+    constexpr T Quaternion<T>::scalar() const noexcept
+    {
+        return w;
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector4D<T> Quaternion<T>::toVector4D() const noexcept
+    {
+        return Vector4D<T>(x, y, z, w);
+    }
+
+
+    template <std::floating_point T>
+    constexpr T& Quaternion<T>::operator[](const std::size_t i) noexcept
+    {
+        assert(i < 4 && "Quaternion component index out of range");
+        return i == 0 ? x : i == 1 ? y : i == 2 ? z : w;
+    }
+
+
+    template <std::floating_point T>
+    constexpr const T& Quaternion<T>::operator[](const std::size_t i) const noexcept
+    {
+        assert(i < 4 && "Quaternion component index out of range");
+        return i == 0 ? x : i == 1 ? y : i == 2 ? z : w;
+    }
+
+
+    template <std::floating_point T>
+    Matrix3D<T> Quaternion<T>::toMatrix3D() const
+    {
+        const T xx = x * x, yy = y * y, zz = z * z;
+        const T xy = x * y, xz = x * z, yz = y * z;
+        const T xw = x * w, yw = y * w, zw = z * w;
+
+        return Matrix3D<T>(T(1) - T(2) * (yy + zz), T(2) * (xy - zw), T(2) * (xz + yw),  // Row 0
+                           T(2) * (xy + zw), T(1) - T(2) * (xx + zz), T(2) * (yz - xw),  // Row 1
+                           T(2) * (xz - yw), T(2) * (yz + xw), T(1) - T(2) * (xx + yy)); // Row 2
+    }
+
+
+    template <std::floating_point T>
+    Matrix4D<T> Quaternion<T>::toMatrix4D() const
+    {
+        const Matrix3D<T> rotation = toMatrix3D();
+        return Matrix4D<T>(rotation(0, 0), rotation(0, 1), rotation(0, 2), T(0), // Row 0
+                           rotation(1, 0), rotation(1, 1), rotation(1, 2), T(0), // Row 1
+                           rotation(2, 0), rotation(2, 1), rotation(2, 2), T(0), // Row 2
+                           T(0), T(0), T(0), T(1));                              // Row 3
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ARITHMETIC             *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion& rhs) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<T, T>)
+        {
+            if (!std::is_constant_evaluated())
+                return Quaternion(detail::store(detail::hamilton(detail::load(*this), detail::load(rhs))));
+        }
+#endif
+        return { w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y, w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
+                 w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w, w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z };
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T>& Quaternion<T>::operator*=(const Quaternion& rhs) noexcept
+    {
+        return *this = *this * rhs;
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::operator+(const Quaternion& rhs) const noexcept
+    {
+        return Quaternion(toVector4D() + rhs.toVector4D());
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::operator-(const Quaternion& rhs) const noexcept
+    {
+        return Quaternion(toVector4D() - rhs.toVector4D());
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::operator-() const noexcept
+    {
+        return Quaternion(-toVector4D());
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::operator*(const T scalar) const noexcept
+    {
+        return Quaternion(toVector4D() * scalar);
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> operator*(const T scalar, const Quaternion<T>& quat) noexcept
+    {
+        return quat * scalar;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             ROTATION              *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr T Quaternion<T>::dot(const Quaternion& rhs) const noexcept
+    {
+        return toVector4D().dot(rhs.toVector4D());
+    }
+
+
+    template <std::floating_point T>
+    constexpr T Quaternion<T>::mag() const noexcept
+    {
+        return toVector4D().mag();
+    }
+
+
+    template <std::floating_point T>
+    template <Precision P>
+    constexpr Quaternion<T> Quaternion<T>::normalize() const noexcept
+    {
+        return Quaternion(toVector4D().template normalize<P>());
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::conjugate() const noexcept
+    {
+        return { -x, -y, -z, w };
+    }
+
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::inverse() const noexcept
+    {
+        return conjugate() * (T(1) / dot(*this));
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector3D<T> Quaternion<T>::rotate(const Vector3D<T>& vec) const noexcept
+    {
+        const Vector4D<T> rotated = rotate(Vector4D<T>(vec, T(0)));
+        return Vector3D<T>(rotated.x, rotated.y, rotated.z);
+    }
+
+
+    template <std::floating_point T>
+    constexpr Vector4D<T> Quaternion<T>::rotate(const Vector4D<T>& vec) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<T, T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::rotate(detail::load(*this), detail::load(vec)));
+        }
+#endif
+        // t = 2 (q x v), v' = v + w t + q x t
+        const T tx = T(2) * (y * vec.z - z * vec.y);
+        const T ty = T(2) * (z * vec.x - x * vec.z);
+        const T tz = T(2) * (x * vec.y - y * vec.x);
+
+        return Vector4D<T>(vec.x + w * tx + (y * tz - z * ty), vec.y + w * ty + (z * tx - x * tz),
+                           vec.z + w * tz + (x * ty - y * tx), vec.w);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *           INTERPOLATION           *
+     *                                   *
+     *************************************/
+
+    template <std::floating_point T>
+    constexpr Quaternion<T> Quaternion<T>::nlerp(const Quaternion& from, const Quaternion& to, const T t) noexcept
+    {
+        const Quaternion target = from.dot(to) < T(0) ? -to : to;
+        return (from + (target - from) * t).normalize();
+    }
+
+
+    template <std::floating_point T>
+    Quaternion<T> Quaternion<T>::slerp(const Quaternion& from, const Quaternion& to, const T t) noexcept
+    {
+        T cosAngle = from.dot(to);
+        const Quaternion target = cosAngle < T(0) ? -to : to;
+        cosAngle = std::abs(cosAngle);
+
+        if (cosAngle > T(1) - Config::EPSILON<T>)
+            return nlerp(from, target, t);
+
+        const T angle = std::acos(cosAngle);
+        const T sinAngle = std::sin(angle);
+        return from * (std::sin((T(1) - t) * angle) / sinAngle) + target * (std::sin(t * angle) / sinAngle);
+    }
+
+} // namespace fgm
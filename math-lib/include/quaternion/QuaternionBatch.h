@@ -0,0 +1,62 @@
+#pragma once
+/**
+ * @file QuaternionBatch.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Interpolate whole buffers of rotations, as animation blending does once per joint and frame.
+ *
+ * @details Rotations are held as structure-of-arrays @ref fgm::Vec4Array, `x`, `y` and `z` being the imaginary part
+ *          and `w` the real part of each unit quaternion, so every lane of a register interpolates one rotation.
+ *          Every function runs on the kernels bound by @ref falcon::simd::batchKernels and interpolates along the
+ *          shorter arc like @ref fgm::Quaternion::nlerp and @ref fgm::Quaternion::slerp.
+ *
+ *          Batch @ref slerp never calls a trigonometric function: it splits each arc at its midpoint and evaluates
+ *          the interpolation weights as polynomials, within a few units in the last place of the scalar result.
+ *
+ *          The sizes of both inputs must match, which is checked with `assert`. The output may be either input.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Quaternion.h"
+#include "common/MathTraits.h"
+#include "vector/Vec4Array.h"
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Quat_Batch
+     * @{
+     */
+
+    /**
+     * @brief Normalized linear interpolation of every rotation pair, resizing @p out to match.
+     *
+     * @param[in]  from Unit rotations at `t == 0`.
+     * @param[in]  to   Unit rotations at `t == 1`, as many as @p from.
+     * @param[in]  t    Interpolation factor shared by every pair.
+     * @param[out] out  Destination. May be @p from or @p to.
+     */
+    template <BatchArithmetic T>
+    void nlerp(const Vec4Array<T>& from, const Vec4Array<T>& to, T t, Vec4Array<T>& out);
+
+
+    /**
+     * @brief Spherical linear interpolation of every rotation pair, resizing @p out to match.
+     *
+     * @param[in]  from Unit rotations at `t == 0`.
+     * @param[in]  to   Unit rotations at `t == 1`, as many as @p from.
+     * @param[in]  t    Interpolation factor shared by every pair.
+     * @param[out] out  Destination. May be @p from or @p to.
+     */
+    template <BatchArithmetic T>
+    void slerp(const Vec4Array<T>& from, const Vec4Array<T>& to, T t, Vec4Array<T>& out);
+
+    /** @} */
+
+} // namespace fgm
+
+#include "QuaternionBatch.tpp"
@@ -0,0 +1,49 @@
+/**
+ * @file QuaternionBatch.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the batch interpolation of @ref fgm::Quaternion.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <Dispatch.h>
+#include <cassert>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Interpolation kernels of the running CPU for `T`. */
+        template <typename T>
+        [[nodiscard]] const falcon::simd::QuatKernels<T>& quatKernels() noexcept
+        {
+            return falcon::simd::batchKernels().get<T>().quat;
+        }
+    } // namespace detail
+
+
+
+    template <BatchArithmetic T>
+    void nlerp(const Vec4Array<T>& from, const Vec4Array<T>& to, const T t, Vec4Array<T>& out)
+    {
+        assert(from.size() == to.size() && "Vec4Array sizes must match");
+
+        out.resize(from.size());
+        detail::quatKernels<T>().nlerp(from.streams(), to.streams(), t, out.streams(), from.size());
+    }
+
+
+    template <BatchArithmetic T>
+    void slerp(const Vec4Array<T>& from, const Vec4Array<T>& to, const T t, Vec4Array<T>& out)
+    {
+        assert(from.size() == to.size() && "Vec4Array sizes must match");
+
+        out.resize(from.size());
+        detail::quatKernels<T>().slerp(from.streams(), to.streams(), t, out.streams(), from.size());
+    }
+
+} // namespace fgm
@@ -0,0 +1,124 @@
+#pragma once
+/**
+ * @file QuaternionSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register kernels backing the runtime path of @ref fgm::Quaternion.
+ * @details A quaternion loads into the same registers as a @ref fgm::Vector4D of its component type, so these kernels
+ *          only add loads, the Hamilton product and the rotation on top of the @ref Vector4DSimd.h kernels. Results
+ *          are stored through @ref store and converted with the @ref fgm::Vector4D constructor of the quaternion.
+ *
+ * @note Only included from Quaternion.tpp, once @ref fgm::Quaternion is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Quaternion.h"
+#include "vector/Vector4DSimd.h"
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *               LOAD                *
+     *                                   *
+     *************************************/
+
+    static_assert(sizeof(Quaternion<float>) == sizeof(Vector4D<float>) &&
+                      alignof(Quaternion<float>) == alignof(Vector4D<float>),
+                  "Quaternion must share the register layout of Vector4D");
+    static_assert(sizeof(Quaternion<double>) == sizeof(Vector4D<double>) &&
+                      alignof(Quaternion<double>) == alignof(Vector4D<double>),
+                  "Quaternion must share the register layout of Vector4D");
+
+
+    /**
+     * @brief Load a quaternion into its register(s).
+     *
+     * @param[in] quat Quaternion to load. Always register aligned via @ref SimdTraits.
+     *
+     * @return Register holding `<x, y, z, w>`.
+     */
+    [[nodiscard]] inline __m128 load(const Quaternion<float>& quat) noexcept
+    {
+        return _mm_load_ps(&quat.x);
+    }
+
+
+    /** @copydoc load(const Quaternion<float>&) */
+    [[nodiscard]] inline Double4 load(const Quaternion<double>& quat) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_load_pd(&quat.x);
+#else
+        return { _mm_load_pd(&quat.x), _mm_load_pd(&quat.z) };
+#endif
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ARITHMETIC             *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Register holding `<sx, sy, sz, sw>`.
+     * @details Built from a constant vector, which the compiler folds into a constant load.
+     */
+    template <typename T>
+    [[nodiscard]] auto signs(const T sx, const T sy, const T sz, const T sw) noexcept
+    {
+        return load(Vector4D<T>(sx, sy, sz, sw));
+    }
+
+
+    /**
+     * @brief Hamilton product of two quaternion registers.
+     * @details Each component of @p lhs is broadcast and multiplies a lane permutation of @p rhs with a fixed sign
+     *          pattern, so the sixteen products take four register multiplies and no scalar gathers.
+     *
+     * @param[in] lhs Rotation applied second.
+     * @param[in] rhs Rotation applied first.
+     *
+     * @return Register holding @p lhs * @p rhs.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg hamilton(const Reg lhs, const Reg rhs) noexcept
+    {
+        using S = decltype(first(lhs));
+
+        Reg result = mul(shuffle<3, 3, 3, 3>(lhs), rhs);
+        result = add(result, mul(mul(shuffle<0, 0, 0, 0>(lhs), shuffle<3, 2, 1, 0>(rhs)), signs<S>(1, -1, 1, -1)));
+        result = add(result, mul(mul(shuffle<1, 1, 1, 1>(lhs), shuffle<2, 3, 0, 1>(rhs)), signs<S>(1, 1, -1, -1)));
+        return add(result, mul(mul(shuffle<2, 2, 2, 2>(lhs), shuffle<1, 0, 3, 2>(rhs)), signs<S>(-1, 1, 1, -1)));
+    }
+
+
+    /**
+     * @brief Rotate the `x`, `y` and `z` lanes of @p vec by the unit quaternion in @p quat.
+     * @details Computes \f$ \mathbf{t} = 2\mathbf{q} \times \mathbf{v} \f$ and
+     *          \f$ \mathbf{v}' = \mathbf{v} + w\mathbf{t} + \mathbf{q} \times \mathbf{t} \f$. Both cross products leave
+     *          the `w` lane at `0`, so @p vec keeps its `w` component.
+     *
+     * @param[in] quat Unit quaternion register.
+     * @param[in] vec  Vector register.
+     *
+     * @return Register holding the rotated vector.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg rotate(const Reg quat, const Reg vec) noexcept
+    {
+        const Reg twice = cross(quat, vec);
+        const Reg t = add(twice, twice);
+        return add(add(vec, mul(shuffle<3, 3, 3, 3>(quat), t)), cross(quat, t));
+    }
+
+} // namespace fgm::detail
+#endif
@@ -0,0 +1,187 @@
+#pragma once
+/**
+ * @file Mask4.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Compact lane mask produced by @ref fgm::Vector4D comparisons.
+ *
+ * @details @ref fgm::Mask4 packs one bit per lane into a single byte, in the layout of an SSE `movemask` or an
+ *          AVX-512 `__mmask8`: bit `i` is set when the predicate holds for lane `i`. The comparison kernels produce it
+ *          directly from a register, so reducing it with @ref fgm::Mask4::all, @ref fgm::Mask4::any,
+ *          @ref fgm::Mask4::none or @ref fgm::Mask4::count is a single integer test instead of four branches.
+ *
+ *          @ref fgm::bVec4 remains the component-wise view: every mask converts to one implicitly, and
+ *          @ref fgm::Vector4D::mask packs one back.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "common/MathTraits.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace fgm
+{
+    template <Arithmetic T>
+    struct Vector4D;
+
+
+    /**
+     * @addtogroup FGM_Vec4_Mask
+     * @{
+     */
+
+    class Mask4
+    {
+        public:
+        static constexpr std::size_t dimension = 4;     ///< Lanes in the mask.
+        static constexpr std::uint8_t allLanes = 0b1111; ///< Bits of a mask with every lane set.
+
+
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize a mask with no lane set. */
+        constexpr Mask4() noexcept = default;
+
+
+        /**
+         * @brief Initialize a mask from its bits.
+         *
+         * @param[in] bits Bit `i` selects lane `i`. Bits above the fourth are ignored.
+         */
+        constexpr explicit Mask4(unsigned int bits) noexcept;
+
+
+        /**
+         * @brief Initialize a mask lane by lane.
+         *
+         * @param[in] x First lane.
+         * @param[in] y Second lane.
+         * @param[in] z Third lane.
+         * @param[in] w Fourth lane.
+         */
+        constexpr Mask4(bool x, bool y, bool z, bool w) noexcept;
+
+
+
+        /*************************************
+         *                                   *
+         *             ACCESSORS             *
+         *                                   *
+         *************************************/
+
+        /** @brief Bit `i` is set when lane `i` is. */
+        [[nodiscard]] constexpr std::uint8_t bits() const noexcept;
+
+
+        /**
+         * @brief Test a single lane.
+         *
+         * @param[in] i Lane index, less than @ref dimension.
+         *
+         * @return True if lane @p i is set.
+         */
+        [[nodiscard]] constexpr bool operator[](std::size_t i) const noexcept;
+
+
+        /** @brief Expand the mask into its component-wise @ref bVec4 view. */
+        constexpr operator Vector4D<bool>() const noexcept;
+
+
+
+        /*************************************
+         *                                   *
+         *            REDUCTIONS             *
+         *                                   *
+         *************************************/
+
+        /** @brief True if every lane is set. */
+        [[nodiscard]] constexpr bool all() const noexcept;
+
+        /** @brief True if at least one lane is set. */
+        [[nodiscard]] constexpr bool any() const noexcept;
+
+        /** @brief True if no lane is set. */
+        [[nodiscard]] constexpr bool none() const noexcept;
+
+        /** @brief Number of lanes set. */
+        [[nodiscard]] constexpr int count() const noexcept;
+
+
+
+        /*************************************
+         *                                   *
+         *         BITWISE OPERATORS         *
+         *                                   *
+         *************************************/
+
+        /** @brief Lanes set in both masks. */
+        [[nodiscard]] constexpr Mask4 operator&(Mask4 rhs) const noexcept;
+
+        /** @brief Lanes set in either mask. */
+        [[nodiscard]] constexpr Mask4 operator|(Mask4 rhs) const noexcept;
+
+        /** @brief Lanes set in exactly one mask. */
+        [[nodiscard]] constexpr Mask4 operator^(Mask4 rhs) const noexcept;
+
+        /** @brief Lanes not set in this mask. */
+        [[nodiscard]] constexpr Mask4 operator~() const noexcept;
+
+        /** @copydoc operator~ */
+        [[nodiscard]] constexpr Mask4 operator!() const noexcept;
+
+        /** @brief Keep only the lanes also set in @p rhs. */
+        constexpr Mask4& operator&=(Mask4 rhs) noexcept;
+
+        /** @brief Add the lanes set in @p rhs. */
+        constexpr Mask4& operator|=(Mask4 rhs) noexcept;
+
+        /** @brief Toggle the lanes set in @p rhs. */
+        constexpr Mask4& operator^=(Mask4 rhs) noexcept;
+
+        /** @brief True if both masks set the same lanes. */
+        [[nodiscard]] constexpr bool operator==(const Mask4& rhs) const noexcept = default;
+
+        private:
+        std::uint8_t _bits = 0;
+    };
+
+
+
+    /*************************************
+     *                                   *
+     *             BLENDING              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Blend two vectors lane by lane.
+     *        Compute `mask[i] ? onTrue[i] : onFalse[i]` for every lane without branching.
+     *
+     * @tparam T Component type. Must satisfy @ref Arithmetic.
+     *
+     * @param[in] mask    Lanes taken from @p onTrue.
+     * @param[in] onTrue  Vector supplying the set lanes.
+     * @param[in] onFalse Vector supplying the cleared lanes.
+     *
+     * @return The blended vector.
+     */
+    template <Arithmetic T>
+    [[nodiscard]] constexpr Vector4D<T> select(Mask4 mask, const Vector4D<T>& onTrue,
+                                               const Vector4D<T>& onFalse) noexcept;
+
+    /** @} */
+
+} // namespace fgm
+
+// Mask4 members that need a complete Vector4D are defined in Mask4.tpp, which Vector4D.tpp includes.
+#include "Vector4D.h"
@@ -0,0 +1,172 @@
+#pragma once
+/**
+ * @file Mask4.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::Mask4 implementation.
+ *
+ * @note Only included from Vector4D.tpp, once @ref fgm::Vector4D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Mask4.h"
+#include "Vector4DSimd.h"
+
+#include <bit>
+#include <type_traits>
+
+
+namespace fgm
+{
+
+    /*************************************
+     *                                   *
+     *            INITIALIZERS           *
+     *                                   *
+     *************************************/
+
+    constexpr Mask4::Mask4(const unsigned int bits) noexcept: _bits(static_cast<std::uint8_t>(bits & allLanes))
+    {}
+
+
+    constexpr Mask4::Mask4(const bool x, const bool y, const bool z, const bool w) noexcept:
+        _bits(static_cast<std::uint8_t>(unsigned(x) | unsigned(y) << 1 | unsigned(z) << 2 | unsigned(w) << 3))
+    {}
+
+
+
+    /*************************************
+     *                                   *
+     *             ACCESSORS             *
+     *                                   *
+     *************************************/
+
+    constexpr std::uint8_t Mask4::bits() const noexcept
+    {
+        return _bits;
+    }
+
+
+    constexpr bool Mask4::operator[](const std::size_t i) const noexcept
+    {
+        return (_bits >> i & 1u) != 0;
+    }
+
+
+    constexpr Mask4::operator Vector4D<bool>() const noexcept
+    {
+        return Vector4D<bool>((*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            REDUCTIONS             *
+     *                                   *
+     *************************************/
+
+    constexpr bool Mask4::all() const noexcept
+    {
+        return _bits == allLanes;
+    }
+
+
+    constexpr bool Mask4::any() const noexcept
+    {
+        return _bits != 0;
+    }
+
+
+    constexpr bool Mask4::none() const noexcept
+    {
+        return _bits == 0;
+    }
+
+
+    constexpr int Mask4::count() const noexcept
+    {
+        return std::popcount(_bits);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *         BITWISE OPERATORS         *
+     *                                   *
+     *************************************/
+
+    constexpr Mask4 Mask4::operator&(const Mask4 rhs) const noexcept
+    {
+        return Mask4(unsigned(_bits & rhs._bits));
+    }
+
+
+    constexpr Mask4 Mask4::operator|(const Mask4 rhs) const noexcept
+    {
+        return Mask4(unsigned(_bits | rhs._bits));
+    }
+
+
+    constexpr Mask4 Mask4::operator^(const Mask4 rhs) const noexcept
+    {
+        return Mask4(unsigned(_bits ^ rhs._bits));
+    }
+
+
+    constexpr Mask4 Mask4::operator~() const noexcept
+    {
+        return Mask4(~unsigned(_bits));
+    }
+
+
+    constexpr Mask4 Mask4::operator!() const noexcept
+    {
+        return ~(*this);
+    }
+
+
+    constexpr Mask4& Mask4::operator&=(const Mask4 rhs) noexcept
+    {
+        return *this = *this & rhs;
+    }
+
+
+    constexpr Mask4& Mask4::operator|=(const Mask4 rhs) noexcept
+    {
+        return *this = *this | rhs;
+    }
+
+
+    constexpr Mask4& Mask4::operator^=(const Mask4 rhs) noexcept
+    {
+        return *this = *this ^ rhs;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             BLENDING              *
+     *                                   *
+     *************************************/
+
+    template <Arithmetic T>
+    constexpr Vector4D<T> select(const Mask4 mask, const Vector4D<T>& onTrue, const Vector4D<T>& onFalse) noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<T, T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::select(mask.bits(), detail::load(onTrue), detail::load(onFalse)));
+        }
+#endif
+        return Vector4D<T>(mask[0] ? onTrue.x : onFalse.x, mask[1] ? onTrue.y : onFalse.y,
+                           mask[2] ? onTrue.z : onFalse.z, mask[3] ? onTrue.w : onFalse.w);
+    }
+
+} // namespace fgm
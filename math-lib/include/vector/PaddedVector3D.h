@@ -0,0 +1,221 @@
+#pragma once
+/**
+ * @file PaddedVector3D.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief 3D vector padded to four lanes, for register-aligned storage.
+ *
+ * @details @ref fgm::Vector3D packs `x`, `y` and `z` in 12 bytes for `float`, which is what vertex buffers and other
+ *          tight streams want, but no register load fits it without touching the neighbouring vector.
+ *          @ref fgm::PaddedVector3D opts into the layout of a @ref fgm::Vector4D instead: the same size and alignment,
+ *          with a fourth lane `w` that is not part of the value. Constructors set `w` to `0` so it never holds a NaN
+ *          or denormal, and no operation reads it into a result; `float` and `double` vectors then load with one
+ *          aligned load and run on the @ref Vector4DSimd.h kernels.
+ *
+ *          @ref fgm::pack and @ref fgm::unpack convert whole buffers between the two layouts.
+ *
+ * @tparam T Type of the components.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SimdTraits.h"
+#include "Vector3D.h"
+#include "common/MathTraits.h"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+
+namespace fgm
+{
+    template <Arithmetic T>
+    struct alignas(SimdTraits<T, 4>::alignment) PaddedVector3D
+    {
+        /**
+         * @addtogroup FGM_PVec3_Members
+         * @{
+         */
+
+        using value_type = T;
+
+        static constexpr std::size_t dimension = 3;
+
+        union {
+            struct
+            {
+                T x; ///< X-axis component
+                T y; ///< Y-axis component
+                T z; ///< Z-axis component
+                T w; ///< Padding lane. Not part of the value.
+            };
+
+            Vector3D<T> xyz; ///< The value as a tight @ref Vector3D, sharing the first three lanes.
+        };
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_PVec3_Init
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize the zero vector. */
+        [[nodiscard]] constexpr PaddedVector3D() noexcept;
+
+        /** @brief Initialize from three components. */
+        [[nodiscard]] constexpr PaddedVector3D(T x, T y, T z) noexcept;
+
+        /** @brief Initialize from a tight @ref Vector3D. */
+        [[nodiscard]] constexpr explicit PaddedVector3D(const Vector3D<T>& vec) noexcept;
+
+        /** @brief The value as a tight @ref Vector3D. */
+        [[nodiscard]] constexpr Vector3D<T> toVector3D() const noexcept;
+
+
+        /**
+         * @brief Access a component.
+         *
+         * @param[in] i Component index, 0 to 2.
+         */
+        [[nodiscard]] constexpr T& operator[](std::size_t i) noexcept;
+
+        /** @copydoc operator[](std::size_t) */
+        [[nodiscard]] constexpr const T& operator[](std::size_t i) const noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_PVec3_Arithmetic
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            ARITHMETIC             *
+         *                                   *
+         *************************************/
+
+        [[nodiscard]] constexpr PaddedVector3D operator+(const PaddedVector3D& rhs) const noexcept;
+        [[nodiscard]] constexpr PaddedVector3D operator-(const PaddedVector3D& rhs) const noexcept;
+        [[nodiscard]] constexpr PaddedVector3D operator-() const noexcept;
+        [[nodiscard]] constexpr PaddedVector3D operator*(T scalar) const noexcept;
+
+        constexpr PaddedVector3D& operator+=(const PaddedVector3D& rhs) noexcept;
+        constexpr PaddedVector3D& operator-=(const PaddedVector3D& rhs) noexcept;
+        constexpr PaddedVector3D& operator*=(T scalar) noexcept;
+
+        /** @brief True if `x`, `y` and `z` are exactly equal. `w` is ignored. */
+        [[nodiscard]] constexpr bool operator==(const PaddedVector3D& rhs) const noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_PVec3_Product
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *        GEOMETRIC PRODUCTS         *
+         *                                   *
+         *************************************/
+
+        /** @brief Dot product of `x`, `y` and `z`, rounded like @ref Vector3D::dot. */
+        [[nodiscard]] constexpr T dot(const PaddedVector3D& rhs) const noexcept;
+
+        /** @brief Cross product, with three lane shuffles and two multiplies on registers. */
+        [[nodiscard]] constexpr PaddedVector3D cross(const PaddedVector3D& rhs) const noexcept;
+
+        /** @brief Euclidean length. */
+        [[nodiscard]] constexpr T mag() const noexcept;
+
+        /**
+         * @brief Scale to unit length.
+         * @warning Does not check for the zero vector.
+         */
+        [[nodiscard]] constexpr PaddedVector3D normalize() const noexcept;
+
+        /** @} */
+    };
+
+
+    /**
+     * @addtogroup FGM_PVec3_Arithmetic
+     * @{
+     */
+
+    /** @brief Scale every component of @p vec by @p scalar. */
+    template <Arithmetic T>
+    [[nodiscard]] constexpr PaddedVector3D<T> operator*(T scalar, const PaddedVector3D<T>& vec) noexcept;
+
+    /** @} */
+
+
+    /**
+     * @addtogroup FGM_PVec3_Pack
+     * @{
+     */
+
+    /*************************************
+     *                                   *
+     *           PACK / UNPACK           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Copy padded vectors into a tight 12-byte (`float`) stream, dropping `w`.
+     * @details `float` and `double` vectors move one register per vector: each store writes one lane past its vector,
+     *          which the next store overwrites, and the last vector is written component by component.
+     *
+     * @param[in]  src Padded vectors.
+     * @param[out] out Destination holding exactly `src.size()` vectors. Must not overlap @p src.
+     */
+    template <Arithmetic T>
+    void pack(std::type_identity_t<std::span<const PaddedVector3D<T>>> src,
+              std::type_identity_t<std::span<Vector3D<T>>> out) noexcept;
+
+
+    /**
+     * @brief Copy a tight stream of vectors into padded vectors, setting `w` to `0`.
+     * @details `float` and `double` vectors move one register per vector: each load reads one lane past its vector,
+     *          which is cleared, and the last vector is read component by component so the source is never overrun.
+     *
+     * @param[in]  src Tight vectors, such as a vertex buffer.
+     * @param[out] out Destination holding exactly `src.size()` vectors. Must not overlap @p src.
+     */
+    template <Arithmetic T>
+    void unpack(std::type_identity_t<std::span<const Vector3D<T>>> src,
+                std::type_identity_t<std::span<PaddedVector3D<T>>> out) noexcept;
+
+    /** @} */
+
+
+    /**
+     * @addtogroup FGM_PVec3_Alias
+     * @{
+     */
+
+    using pvec3 = PaddedVector3D<float>;   ///< `float` padded 3D vector
+    using dpvec3 = PaddedVector3D<double>; ///< `double` padded 3D vector
+
+    /** @} */
+
+} // namespace fgm
+
+#include "PaddedVector3D.tpp"
@@ -0,0 +1,266 @@
+#pragma once
+/**
+ * @file PaddedVector3D.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref fgm::PaddedVector3D template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "PaddedVector3D.h"
+#include "PaddedVector3DSimd.h"
+#include "common/ConstexprMath.h"
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+
+namespace fgm
+{
+    /*************************************
+     *                                   *
+     *            INITIALIZERS           *
+     *                                   *
+     *************************************/
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>::PaddedVector3D() noexcept: x(T(0)), y(T(0)), z(T(0)), w(T(0))
+    {}
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>::PaddedVector3D(const T x, const T y, const T z) noexcept: x(x), y(y), z(z), w(T(0))
+    {}
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>::PaddedVector3D(const Vector3D<T>& vec) noexcept:
+        x(vec.x), y(vec.y), z(vec.z), w(T(0))
+    {}
+
+
+    template <Arithmetic T>
+    constexpr Vector3D<T> PaddedVector3D<T>::toVector3D() const noexcept
+    {
+        return Vector3D<T>(x, y, z);
+    }
+
+
+    template <Arithmetic T>
+    constexpr T& PaddedVector3D<T>::operator[](const std::size_t i) noexcept
+    {
+        assert(i < dimension && "PaddedVector3D component index out of range");
+        return i == 0 ? x : i == 1 ? y : z;
+    }
+
+
+    template <Arithmetic T>
+    constexpr const T& PaddedVector3D<T>::operator[](const std::size_t i) const noexcept
+    {
+        assert(i < dimension && "PaddedVector3D component index out of range");
+        return i == 0 ? x : i == 1 ? y : z;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ARITHMETIC             *
+     *                                   *
+     *************************************/
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::operator+(const PaddedVector3D& rhs) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storePadded<T>(detail::add(detail::load(*this), detail::load(rhs)));
+        }
+#endif
+        return { static_cast<T>(x + rhs.x), static_cast<T>(y + rhs.y), static_cast<T>(z + rhs.z) };
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::operator-(const PaddedVector3D& rhs) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storePadded<T>(detail::sub(detail::load(*this), detail::load(rhs)));
+        }
+#endif
+        return { static_cast<T>(x - rhs.x), static_cast<T>(y - rhs.y), static_cast<T>(z - rhs.z) };
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::operator-() const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storePadded<T>(detail::negate(detail::load(*this)));
+        }
+#endif
+        return { static_cast<T>(-x), static_cast<T>(-y), static_cast<T>(-z) };
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::operator*(const T scalar) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storePadded<T>(detail::mul(detail::load(*this), detail::broadcast(scalar)));
+        }
+#endif
+        return { static_cast<T>(x * scalar), static_cast<T>(y * scalar), static_cast<T>(z * scalar) };
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>& PaddedVector3D<T>::operator+=(const PaddedVector3D& rhs) noexcept
+    {
+        return *this = *this + rhs;
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>& PaddedVector3D<T>::operator-=(const PaddedVector3D& rhs) noexcept
+    {
+        return *this = *this - rhs;
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T>& PaddedVector3D<T>::operator*=(const T scalar) noexcept
+    {
+        return *this = *this * scalar;
+    }
+
+
+    template <Arithmetic T>
+    constexpr bool PaddedVector3D<T>::operator==(const PaddedVector3D& rhs) const noexcept
+    {
+        return x == rhs.x && y == rhs.y && z == rhs.z;
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> operator*(const T scalar, const PaddedVector3D<T>& vec) noexcept
+    {
+        return vec * scalar;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *        GEOMETRIC PRODUCTS         *
+     *                                   *
+     *************************************/
+
+    template <Arithmetic T>
+    constexpr T PaddedVector3D<T>::dot(const PaddedVector3D& rhs) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::first(detail::dot3(detail::load(*this), detail::load(rhs)));
+        }
+#endif
+        return x * rhs.x + y * rhs.y + z * rhs.z;
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::cross(const PaddedVector3D& rhs) const noexcept
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::storePadded<T>(detail::cross(detail::load(*this), detail::load(rhs)));
+        }
+#endif
+        return { static_cast<T>(y * rhs.z - z * rhs.y), static_cast<T>(z * rhs.x - x * rhs.z),
+                 static_cast<T>(x * rhs.y - y * rhs.x) };
+    }
+
+
+    template <Arithmetic T>
+    constexpr T PaddedVector3D<T>::mag() const noexcept
+    {
+        return static_cast<T>(fgm::sqrt(dot(*this)));
+    }
+
+
+    template <Arithmetic T>
+    constexpr PaddedVector3D<T> PaddedVector3D<T>::normalize() const noexcept
+    {
+        return *this * (T(1) / mag());
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *           PACK / UNPACK           *
+     *                                   *
+     *************************************/
+
+    template <Arithmetic T>
+    void pack(const std::type_identity_t<std::span<const PaddedVector3D<T>>> src,
+              const std::type_identity_t<std::span<Vector3D<T>>> out) noexcept
+    {
+        static_assert(sizeof(Vector3D<T>) == 3 * sizeof(T), "Vector3D must be tight to be packed");
+        assert(src.size() == out.size() && "Destination must hold exactly as many vectors as the source");
+
+        std::size_t i = 0;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            // The padding lane lands on the next vector's x, rewritten by the next store.
+            for (; i + 1 < src.size(); ++i)
+                detail::storeUnaligned4(&out[i].x, detail::load(src[i]));
+        }
+#endif
+        for (; i < src.size(); ++i)
+            out[i] = src[i].toVector3D();
+    }
+
+
+    template <Arithmetic T>
+    void unpack(const std::type_identity_t<std::span<const Vector3D<T>>> src,
+                const std::type_identity_t<std::span<PaddedVector3D<T>>> out) noexcept
+    {
+        static_assert(sizeof(Vector3D<T>) == 3 * sizeof(T), "Vector3D must be tight to be unpacked");
+        assert(src.size() == out.size() && "Destination must hold exactly as many vectors as the source");
+
+        std::size_t i = 0;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::hasPaddedVec3Kernels<T>)
+        {
+            // Each load also reads the next vector's x, which the mask clears out of the padding lane.
+            const auto mask = detail::xyzMask<T>();
+            for (; i + 1 < src.size(); ++i)
+                detail::storeInto(out[i], detail::clearW(detail::loadUnaligned4(&src[i].x), mask));
+        }
+#endif
+        for (; i < src.size(); ++i)
+            out[i] = PaddedVector3D<T>(src[i]);
+    }
+
+} // namespace fgm
@@ -0,0 +1,182 @@
+#pragma once
+/**
+ * @file PaddedVector3DSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register loads and stores backing the runtime path of @ref fgm::PaddedVector3D.
+ * @details A padded vector shares the size and alignment of a @ref fgm::Vector4D of its component type, so it loads
+ *          into the same registers and every operation reuses the @ref Vector4DSimd.h kernels, @ref dot3 and
+ *          @ref cross keeping the padding lane out of the result.
+ *
+ * @note Only included from PaddedVector3D.tpp, once @ref fgm::PaddedVector3D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "PaddedVector3D.h"
+#include "Vector4D.h"
+#include "Vector4DSimd.h"
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *              TRAITS               *
+     *                                   *
+     *************************************/
+
+    /** @brief True if @ref PaddedVector3D<T> runs on registers. */
+    template <typename T>
+    inline constexpr bool hasPaddedVec3Kernels = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+
+    static_assert(sizeof(PaddedVector3D<float>) == sizeof(Vector4D<float>) &&
+                      alignof(PaddedVector3D<float>) == alignof(Vector4D<float>),
+                  "PaddedVector3D must share the register layout of Vector4D");
+    static_assert(sizeof(PaddedVector3D<double>) == sizeof(Vector4D<double>) &&
+                      alignof(PaddedVector3D<double>) == alignof(Vector4D<double>),
+                  "PaddedVector3D must share the register layout of Vector4D");
+
+
+
+    /*************************************
+     *                                   *
+     *            LOAD / STORE           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Load a padded vector into its register(s).
+     *
+     * @param[in] vec Vector to load. Always register aligned via @ref SimdTraits.
+     *
+     * @return Register holding `<x, y, z, w>`.
+     */
+    [[nodiscard]] inline __m128 load(const PaddedVector3D<float>& vec) noexcept
+    {
+        return _mm_load_ps(&vec.x);
+    }
+
+
+    /** @copydoc load(const PaddedVector3D<float>&) */
+    [[nodiscard]] inline Double4 load(const PaddedVector3D<double>& vec) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_load_pd(&vec.x);
+#else
+        return { _mm_load_pd(&vec.x), _mm_load_pd(&vec.z) };
+#endif
+    }
+
+
+    /** @brief Write all four lanes of @p reg into @p dest. */
+    inline void storeInto(PaddedVector3D<float>& dest, const __m128 reg) noexcept
+    {
+        _mm_store_ps(&dest.x, reg);
+    }
+
+
+    /** @copydoc storeInto(PaddedVector3D<float>&, __m128) */
+    inline void storeInto(PaddedVector3D<double>& dest, const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        _mm256_store_pd(&dest.x, reg);
+#else
+        _mm_store_pd(&dest.x, reg.lo);
+        _mm_store_pd(&dest.z, reg.hi);
+#endif
+    }
+
+
+    /** @brief Padded vector held by @p reg. */
+    template <typename T, typename Reg>
+    [[nodiscard]] PaddedVector3D<T> storePadded(const Reg reg) noexcept
+    {
+        PaddedVector3D<T> result;
+        storeInto(result, reg);
+        return result;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *           PACK / UNPACK           *
+     *                                   *
+     *************************************/
+
+    /** @brief Register with every bit set in the `x`, `y` and `z` lanes and clear in `w`. */
+    template <typename T>
+    [[nodiscard]] auto xyzMask() noexcept
+    {
+        using Bits = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+        const T ones = std::bit_cast<T>(~Bits(0));
+        return load(Vector4D<T>(ones, ones, ones, T(0)));
+    }
+
+
+    /** @brief Clear the `w` lane of @p reg with the bit mask from @ref xyzMask. */
+    [[nodiscard]] inline __m128 clearW(const __m128 reg, const __m128 mask) noexcept
+    {
+        return _mm_and_ps(reg, mask);
+    }
+
+
+    /** @copydoc clearW(__m128, __m128) */
+    [[nodiscard]] inline Double4 clearW(const Double4 reg, const Double4 mask) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_and_pd(reg, mask);
+#else
+        return { reg.lo, _mm_and_pd(reg.hi, mask.hi) };
+#endif
+    }
+
+
+    /** @brief Load the four elements at @p src, which need no alignment. */
+    [[nodiscard]] inline __m128 loadUnaligned4(const float* src) noexcept
+    {
+        return _mm_loadu_ps(src);
+    }
+
+
+    /** @copydoc loadUnaligned4(const float*) */
+    [[nodiscard]] inline Double4 loadUnaligned4(const double* src) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_loadu_pd(src);
+#else
+        return { _mm_loadu_pd(src), _mm_loadu_pd(src + 2) };
+#endif
+    }
+
+
+    /** @brief Store the four lanes of @p reg at @p dest, which needs no alignment. */
+    inline void storeUnaligned4(float* dest, const __m128 reg) noexcept
+    {
+        _mm_storeu_ps(dest, reg);
+    }
+
+
+    /** @copydoc storeUnaligned4(float*, __m128) */
+    inline void storeUnaligned4(double* dest, const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        _mm256_storeu_pd(dest, reg);
+#else
+        _mm_storeu_pd(dest, reg.lo);
+        _mm_storeu_pd(dest + 2, reg.hi);
+#endif
+    }
+
+} // namespace fgm::detail
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+/**
+ * @file Quantization.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Compact integer encodings of vectors: SNORM and UNORM components, packed 10:10:10:2 values and octahedral
+ *        unit vectors, one at a time or over whole streams.
+ *
+ * @details Normals, tangents, colors and blend weights rarely need 32-bit floats. Encoding them shrinks vertex and
+ *          G-buffer streams by two to four times, and the GPU decodes SNORM, UNORM and 10:10:10:2 formats for free.
+ *          - **SNORM** clamps each component to `[-1, 1]` and stores `round(v * s)`, with `s` = 127 (8 bits),
+ *            32767 (16 bits) or 511 (10-bit fields). Decoding gives `max(q / s, -1)`, so `-1`, `0` and `1` round
+ *            trip exactly.
+ *          - **UNORM** clamps to `[0, 1]` and stores `round(v * s)`, with `s` = 255, 65535, 1023 or 3 (2-bit
+ *            field). Decoding gives `q / s`.
+ *          - **10:10:10:2** packs `x` into the low 10 bits, then `y`, `z`, and `w` into the top 2 bits, the layout of
+ *            `DXGI_FORMAT_R10G10B10A2` and `GL_INT_2_10_10_10_REV`. The signed form suits a tangent with its
+ *            handedness in `w`.
+ *          - **Octahedral** maps a unit vector onto the octahedron `|x| + |y| + |z| = 1`, unfolds that to the square
+ *            `[-1, 1]^2` and stores it as two 16-bit SNORM values: 4 bytes for a normal, a third of a `Vector3D`.
+ *
+ *          Rounding is to nearest even, and NaN components encode to `0` (a zero or NaN vector encodes to the `+z`
+ *          octahedral direction).
+ *
+ * @par Maximum error
+ * A decoded component differs from the clamped input by at most half a step, `0.5 / s`. For unit directions the
+ * angle between the input and the decoded vector is at most `asin(sqrt(3) * 0.5 / s)` when every component is
+ * quantized:
+ * | Encoding             | Bytes per direction | Maximum angular error |
+ * | -------------------- | ------------------- | --------------------- |
+ * | SNORM8 `xyz`         | 3 (4 with `w`)      | 0.391°                |
+ * | 10:10:10:2 SNORM     | 4                   | 0.0972°               |
+ * | SNORM16 `xyz`        | 6 (8 with `w`)      | 0.00152°              |
+ * | Octahedral 2 x 16    | 4                   | 0.005°                |
+ * The octahedral bound is measured rather than derived: the quantization grid is stretched unevenly over the sphere,
+ * and the largest error found over tens of millions of directions is 0.0037°. Octahedral decoding returns unit
+ * vectors; the others return the quantized components, whose length is within `sqrt(3) * 0.5 / s` of the input's.
+ *
+ * @par Streams
+ * The span overloads run the quantize kernels bound by @ref falcon::simd::batchKernels. They encode to exactly the
+ * integers of the single-vector functions, and decode SNORM, UNORM and 10:10:10:2 to exactly the same floats;
+ * octahedral decoding may differ in the last bit, where the normalization is contracted into fused multiply-adds.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector2D.h"
+#include "Vector3D.h"
+#include "Vector4D.h"
+
+#include <Quantize.h>
+#include <cstdint>
+#include <span>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Vec_Quantize
+     * @{
+     */
+
+    /*************************************
+     *                                   *
+     *           SINGLE VECTORS          *
+     *                                   *
+     *************************************/
+
+    /**
+     * @name Normalized components
+     * @brief Encode every component of a vector as an SNORM or UNORM integer, and decode it back.
+     * @{
+     */
+    [[nodiscard]] constexpr Vector4D<std::int8_t> encodeSnorm8(const Vector4D<float>& vec) noexcept;
+    [[nodiscard]] constexpr Vector4D<std::int16_t> encodeSnorm16(const Vector4D<float>& vec) noexcept;
+    [[nodiscard]] constexpr Vector4D<std::uint8_t> encodeUnorm8(const Vector4D<float>& vec) noexcept;
+    [[nodiscard]] constexpr Vector4D<std::uint16_t> encodeUnorm16(const Vector4D<float>& vec) noexcept;
+
+    [[nodiscard]] constexpr Vector4D<float> decodeSnorm8(const Vector4D<std::int8_t>& encoded) noexcept;
+    [[nodiscard]] constexpr Vector4D<float> decodeSnorm16(const Vector4D<std::int16_t>& encoded) noexcept;
+    [[nodiscard]] constexpr Vector4D<float> decodeUnorm8(const Vector4D<std::uint8_t>& encoded) noexcept;
+    [[nodiscard]] constexpr Vector4D<float> decodeUnorm16(const Vector4D<std::uint16_t>& encoded) noexcept;
+    /** @} */
+
+
+    /**
+     * @name 10:10:10:2
+     * @brief Pack a vector into 32 bits, 10 per `x`, `y` and `z` and 2 for `w`, and unpack it.
+     * @details The signed form stores `w` as `-1`, `0` or `1`; the unsigned form as a quarter step of `[0, 1]`.
+     * @{
+     */
+    [[nodiscard]] constexpr std::uint32_t encodeSnorm1010102(const Vector4D<float>& vec) noexcept;
+    [[nodiscard]] constexpr std::uint32_t encodeUnorm1010102(const Vector4D<float>& vec) noexcept;
+
+    [[nodiscard]] constexpr Vector4D<float> decodeSnorm1010102(std::uint32_t packed) noexcept;
+    [[nodiscard]] constexpr Vector4D<float> decodeUnorm1010102(std::uint32_t packed) noexcept;
+    /** @} */
+
+
+    /**
+     * @brief Octahedral encoding of the direction of @p vec, as two 16-bit SNORM coordinates.
+     * @details @p vec need not be normalized; only its direction is kept.
+     */
+    [[nodiscard]] constexpr Vector2D<std::int16_t> encodeOctahedral(const Vector3D<float>& vec) noexcept;
+
+    /** @brief Unit vector of the octahedral coordinates @p encoded. */
+    [[nodiscard]] Vector3D<float> decodeOctahedral(const Vector2D<std::int16_t>& encoded) noexcept;
+
+
+
+    /*************************************
+     *                                   *
+     *              STREAMS              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @name Normalized streams
+     * @brief Encode or decode every component of @p src into @p out, as flat component streams or as vectors.
+     * @warning @p src and @p out must hold as many elements; checked with `assert`.
+     * @{
+     */
+    void encodeSnorm8(std::span<const float> src, std::span<std::int8_t> out) noexcept;
+    void encodeSnorm16(std::span<const float> src, std::span<std::int16_t> out) noexcept;
+    void encodeUnorm8(std::span<const float> src, std::span<std::uint8_t> out) noexcept;
+    void encodeUnorm16(std::span<const float> src, std::span<std::uint16_t> out) noexcept;
+
+    void decodeSnorm8(std::span<const std::int8_t> src, std::span<float> out) noexcept;
+    void decodeSnorm16(std::span<const std::int16_t> src, std::span<float> out) noexcept;
+    void decodeUnorm8(std::span<const std::uint8_t> src, std::span<float> out) noexcept;
+    void decodeUnorm16(std::span<const std::uint16_t> src, std::span<float> out) noexcept;
+
+    void encodeSnorm8(std::span<const Vector4D<float>> src, std::span<Vector4D<std::int8_t>> out) noexcept;
+    void encodeSnorm16(std::span<const Vector4D<float>> src, std::span<Vector4D<std::int16_t>> out) noexcept;
+    void encodeUnorm8(std::span<const Vector4D<float>> src, std::span<Vector4D<std::uint8_t>> out) noexcept;
+    void encodeUnorm16(std::span<const Vector4D<float>> src, std::span<Vector4D<std::uint16_t>> out) noexcept;
+
+    void decodeSnorm8(std::span<const Vector4D<std::int8_t>> src, std::span<Vector4D<float>> out) noexcept;
+    void decodeSnorm16(std::span<const Vector4D<std::int16_t>> src, std::span<Vector4D<float>> out) noexcept;
+    void decodeUnorm8(std::span<const Vector4D<std::uint8_t>> src, std::span<Vector4D<float>> out) noexcept;
+    void decodeUnorm16(std::span<const Vector4D<std::uint16_t>> src, std::span<Vector4D<float>> out) noexcept;
+    /** @} */
+
+
+    /**
+     * @name Packed and octahedral streams
+     * @brief Encode or decode every vector of @p src into @p out.
+     * @warning @p src and @p out must hold as many elements; checked with `assert`.
+     * @{
+     */
+    void encodeSnorm1010102(std::span<const Vector4D<float>> src, std::span<std::uint32_t> out) noexcept;
+    void encodeUnorm1010102(std::span<const Vector4D<float>> src, std::span<std::uint32_t> out) noexcept;
+    void decodeSnorm1010102(std::span<const std::uint32_t> src, std::span<Vector4D<float>> out) noexcept;
+    void decodeUnorm1010102(std::span<const std::uint32_t> src, std::span<Vector4D<float>> out) noexcept;
+
+    void encodeOctahedral(std::span<const Vector3D<float>> src, std::span<Vector2D<std::int16_t>> out) noexcept;
+    void decodeOctahedral(std::span<const Vector2D<std::int16_t>> src, std::span<Vector3D<float>> out) noexcept;
+    /** @} */
+
+    /** @} */
+
+} // namespace fgm
+
+#include "Quantization.tpp"
@@ -0,0 +1,335 @@
+#pragma once
+/**
+ * @file Quantization.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the vector quantization.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Quantization.h"
+
+#include <Dispatch.h>
+#include <cassert>
+#include <type_traits>
+
+
+namespace fgm
+{
+    static_assert(sizeof(Vector4D<std::int8_t>) == 4 && sizeof(Vector4D<std::uint16_t>) == 8 &&
+                      sizeof(Vector3D<float>) == 12 && sizeof(Vector2D<std::int16_t>) == 4,
+                  "Streams of vectors are quantized as streams of their components");
+
+
+    namespace detail
+    {
+        /** @brief @p vec with every component encoded as the normalized integer `Q`, SNORM if `Q` is signed. */
+        template <typename Q>
+        [[nodiscard]] constexpr Vector4D<Q> encodeNormalized(const Vector4D<float>& vec) noexcept
+        {
+            const auto encode = [](const float value)
+            {
+                constexpr float scale = falcon::simd::normalizedScale<Q>;
+                return static_cast<Q>(std::is_signed_v<Q> ? falcon::simd::quantizeSnorm(value, scale)
+                                                          : falcon::simd::quantizeUnorm(value, scale));
+            };
+            return { encode(vec.x), encode(vec.y), encode(vec.z), encode(vec.w) };
+        }
+
+
+        /** @brief Values of the normalized integers of @p encoded. */
+        template <typename Q>
+        [[nodiscard]] constexpr Vector4D<float> decodeNormalized(const Vector4D<Q>& encoded) noexcept
+        {
+            const auto decode = [](const Q value)
+            {
+                constexpr float scale = falcon::simd::normalizedScale<Q>;
+                return std::is_signed_v<Q> ? falcon::simd::dequantizeSnorm(value, scale)
+                                           : falcon::simd::dequantizeUnorm(value, scale);
+            };
+            return { decode(encoded.x), decode(encoded.y), decode(encoded.z), decode(encoded.w) };
+        }
+
+
+        /**
+         * @brief Run the quantize @p kernel from @p src into @p out.
+         *
+         * @tparam Components Kernel values per element of the spans.
+         */
+        template <std::size_t Components, typename From, typename To, typename S, typename D>
+        void runQuantizeKernel(void (*kernel)(const From*, To*, std::size_t) noexcept, const std::span<const S> src,
+                               const std::span<D> out) noexcept
+        {
+            assert(src.size() == out.size() && "Quantization buffers must hold as many elements");
+            kernel(reinterpret_cast<const From*>(src.data()), reinterpret_cast<To*>(out.data()),
+                   Components * src.size());
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *           SINGLE VECTORS          *
+     *                                   *
+     *************************************/
+
+    constexpr Vector4D<std::int8_t> encodeSnorm8(const Vector4D<float>& vec) noexcept
+    {
+        return detail::encodeNormalized<std::int8_t>(vec);
+    }
+
+
+    constexpr Vector4D<std::int16_t> encodeSnorm16(const Vector4D<float>& vec) noexcept
+    {
+        return detail::encodeNormalized<std::int16_t>(vec);
+    }
+
+
+    constexpr Vector4D<std::uint8_t> encodeUnorm8(const Vector4D<float>& vec) noexcept
+    {
+        return detail::encodeNormalized<std::uint8_t>(vec);
+    }
+
+
+    constexpr Vector4D<std::uint16_t> encodeUnorm16(const Vector4D<float>& vec) noexcept
+    {
+        return detail::encodeNormalized<std::uint16_t>(vec);
+    }
+
+
+    constexpr Vector4D<float> decodeSnorm8(const Vector4D<std::int8_t>& encoded) noexcept
+    {
+        return detail::decodeNormalized(encoded);
+    }
+
+
+    constexpr Vector4D<float> decodeSnorm16(const Vector4D<std::int16_t>& encoded) noexcept
+    {
+        return detail::decodeNormalized(encoded);
+    }
+
+
+    constexpr Vector4D<float> decodeUnorm8(const Vector4D<std::uint8_t>& encoded) noexcept
+    {
+        return detail::decodeNormalized(encoded);
+    }
+
+
+    constexpr Vector4D<float> decodeUnorm16(const Vector4D<std::uint16_t>& encoded) noexcept
+    {
+        return detail::decodeNormalized(encoded);
+    }
+
+
+    constexpr std::uint32_t encodeSnorm1010102(const Vector4D<float>& vec) noexcept
+    {
+        using namespace falcon::simd;
+        return pack1010102(quantizeSnorm(vec.x, snorm10Scale), quantizeSnorm(vec.y, snorm10Scale),
+                           quantizeSnorm(vec.z, snorm10Scale), quantizeSnorm(vec.w, 1.0f));
+    }
+
+
+    constexpr std::uint32_t encodeUnorm1010102(const Vector4D<float>& vec) noexcept
+    {
+        using namespace falcon::simd;
+        return pack1010102(quantizeUnorm(vec.x, unorm10Scale), quantizeUnorm(vec.y, unorm10Scale),
+                           quantizeUnorm(vec.z, unorm10Scale), quantizeUnorm(vec.w, 3.0f));
+    }
+
+
+    constexpr Vector4D<float> decodeSnorm1010102(const std::uint32_t packed) noexcept
+    {
+        using namespace falcon::simd;
+        const auto fields = unpackSigned1010102(packed);
+        return { dequantizeSnorm(fields[0], snorm10Scale), dequantizeSnorm(fields[1], snorm10Scale),
+                 dequantizeSnorm(fields[2], snorm10Scale), dequantizeSnorm(fields[3], 1.0f) };
+    }
+
+
+    constexpr Vector4D<float> decodeUnorm1010102(const std::uint32_t packed) noexcept
+    {
+        using namespace falcon::simd;
+        const auto fields = unpackUnsigned1010102(packed);
+        return { dequantizeUnorm(fields[0], unorm10Scale), dequantizeUnorm(fields[1], unorm10Scale),
+                 dequantizeUnorm(fields[2], unorm10Scale), dequantizeUnorm(fields[3], 3.0f) };
+    }
+
+
+    constexpr Vector2D<std::int16_t> encodeOctahedral(const Vector3D<float>& vec) noexcept
+    {
+        using namespace falcon::simd;
+        constexpr float scale = normalizedScale<std::int16_t>;
+        float u = 0.0f, v = 0.0f;
+        toOctahedral(vec.x, vec.y, vec.z, u, v);
+        return { static_cast<std::int16_t>(quantizeSnorm(u, scale)),
+                 static_cast<std::int16_t>(quantizeSnorm(v, scale)) };
+    }
+
+
+    inline Vector3D<float> decodeOctahedral(const Vector2D<std::int16_t>& encoded) noexcept
+    {
+        using namespace falcon::simd;
+        constexpr float scale = normalizedScale<std::int16_t>;
+        Vector3D<float> result;
+        fromOctahedral(dequantizeSnorm(encoded.x, scale), dequantizeSnorm(encoded.y, scale), result.x, result.y,
+                       result.z);
+        return result;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *              STREAMS              *
+     *                                   *
+     *************************************/
+
+    inline void encodeSnorm8(const std::span<const float> src, const std::span<std::int8_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toSnorm8, src, out);
+    }
+
+
+    inline void encodeSnorm16(const std::span<const float> src, const std::span<std::int16_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toSnorm16, src, out);
+    }
+
+
+    inline void encodeUnorm8(const std::span<const float> src, const std::span<std::uint8_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toUnorm8, src, out);
+    }
+
+
+    inline void encodeUnorm16(const std::span<const float> src, const std::span<std::uint16_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toUnorm16, src, out);
+    }
+
+
+    inline void decodeSnorm8(const std::span<const std::int8_t> src, const std::span<float> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromSnorm8, src, out);
+    }
+
+
+    inline void decodeSnorm16(const std::span<const std::int16_t> src, const std::span<float> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromSnorm16, src, out);
+    }
+
+
+    inline void decodeUnorm8(const std::span<const std::uint8_t> src, const std::span<float> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromUnorm8, src, out);
+    }
+
+
+    inline void decodeUnorm16(const std::span<const std::uint16_t> src, const std::span<float> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromUnorm16, src, out);
+    }
+
+
+    inline void encodeSnorm8(const std::span<const Vector4D<float>> src,
+                             const std::span<Vector4D<std::int8_t>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.toSnorm8, src, out);
+    }
+
+
+    inline void encodeSnorm16(const std::span<const Vector4D<float>> src,
+                              const std::span<Vector4D<std::int16_t>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.toSnorm16, src, out);
+    }
+
+
+    inline void encodeUnorm8(const std::span<const Vector4D<float>> src,
+                             const std::span<Vector4D<std::uint8_t>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.toUnorm8, src, out);
+    }
+
+
+    inline void encodeUnorm16(const std::span<const Vector4D<float>> src,
+                              const std::span<Vector4D<std::uint16_t>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.toUnorm16, src, out);
+    }
+
+
+    inline void decodeSnorm8(const std::span<const Vector4D<std::int8_t>> src,
+                             const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.fromSnorm8, src, out);
+    }
+
+
+    inline void decodeSnorm16(const std::span<const Vector4D<std::int16_t>> src,
+                              const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.fromSnorm16, src, out);
+    }
+
+
+    inline void decodeUnorm8(const std::span<const Vector4D<std::uint8_t>> src,
+                             const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.fromUnorm8, src, out);
+    }
+
+
+    inline void decodeUnorm16(const std::span<const Vector4D<std::uint16_t>> src,
+                              const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<4>(falcon::simd::batchKernels().quantize.fromUnorm16, src, out);
+    }
+
+
+    inline void encodeSnorm1010102(const std::span<const Vector4D<float>> src,
+                                   const std::span<std::uint32_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toSnorm1010102, src, out);
+    }
+
+
+    inline void encodeUnorm1010102(const std::span<const Vector4D<float>> src,
+                                   const std::span<std::uint32_t> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toUnorm1010102, src, out);
+    }
+
+
+    inline void decodeSnorm1010102(const std::span<const std::uint32_t> src,
+                                   const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromSnorm1010102, src, out);
+    }
+
+
+    inline void decodeUnorm1010102(const std::span<const std::uint32_t> src,
+                                   const std::span<Vector4D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromUnorm1010102, src, out);
+    }
+
+
+    inline void encodeOctahedral(const std::span<const Vector3D<float>> src,
+                                 const std::span<Vector2D<std::int16_t>> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.toOctahedral, src, out);
+    }
+
+
+    inline void decodeOctahedral(const std::span<const Vector2D<std::int16_t>> src,
+                                 const std::span<Vector3D<float>> out) noexcept
+    {
+        detail::runQuantizeKernel<1>(falcon::simd::batchKernels().quantize.fromOctahedral, src, out);
+    }
+} // namespace fgm
@@ -0,0 +1,465 @@
+#pragma once
+/**
+ * @file Vec4Array.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Structure-of-arrays container of 4D vectors with batch arithmetic.
+ *
+ * @details @ref fgm::Vec4Array stores the x, y, z and w components in four separate streams inside one 64-byte
+ *          aligned allocation. Every batch operation runs on the kernels bound by @ref falcon::simd::batchKernels,
+ *          so one register holds the same component of 4 (SSE), 8 (AVX) or 16 (AVX-512) vectors and the tier is
+ *          picked from the running CPU, not the build machine.
+ *
+ * @tparam T Type of the components. Must satisfy @ref BatchArithmetic.
+ *
+ * @note Operations between two arrays require equal sizes; this is checked with `assert`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4D.h"
+#include "common/MathTraits.h"
+
+#include <Dispatch.h>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <vector>
+
+
+namespace fgm
+{
+
+    template <BatchArithmetic T>
+    class Vec4Array
+    {
+        public:
+        /**
+         * @addtogroup FGM_Vec4Array_Members
+         * @{
+         */
+
+        using value_type = T;
+        using vector_type = Vector4D<T>;
+
+        static constexpr std::size_t dimension = 4; ///< Components per vector, one stream each.
+        static constexpr std::size_t alignment = 64; ///< Alignment of every component stream in bytes.
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Vec4Array_Init
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *            INITIALIZERS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Initialize an empty array without allocating. */
+        Vec4Array() noexcept = default;
+
+
+        /**
+         * @brief Initialize @p count zero vectors.
+         *
+         * @param[in] count Number of vectors.
+         */
+        explicit Vec4Array(std::size_t count);
+
+
+        /**
+         * @brief Initialize @p count copies of @p value.
+         *
+         * @param[in] count Number of vectors.
+         * @param[in] value Vector to replicate.
+         */
+        Vec4Array(std::size_t count, const Vector4D<T>& value);
+
+
+        /**
+         * @brief Initialize from packed vectors, splitting them into component streams.
+         *
+         * @param[in] vectors Source vectors.
+         */
+        explicit Vec4Array(std::span<const Vector4D<T>> vectors);
+
+
+        /**
+         * @brief Initialize from a list of vectors.
+         *
+         * @param[in] vectors Source vectors.
+         */
+        Vec4Array(std::initializer_list<Vector4D<T>> vectors);
+
+
+        Vec4Array(const Vec4Array& other);
+        Vec4Array(Vec4Array&& other) noexcept;
+        Vec4Array& operator=(const Vec4Array& other);
+        Vec4Array& operator=(Vec4Array&& other) noexcept;
+        ~Vec4Array() = default;
+
+
+
+        /*************************************
+         *                                   *
+         *             CAPACITY              *
+         *                                   *
+         *************************************/
+
+        /** @brief Number of vectors stored. */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+
+        /** @brief Number of vectors each stream can hold before reallocating. */
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+
+        /** @brief True if no vectors are stored. */
+        [[nodiscard]] bool empty() const noexcept;
+
+
+        /**
+         * @brief Grow the streams to hold at least @p count vectors.
+         * @details Each stream is rounded up to whole @ref alignment sized cache lines, so every stream starts on an
+         *          @ref alignment boundary and wastes less than one line.
+         *
+         * @param[in] count Minimum capacity.
+         */
+        void reserve(std::size_t count);
+
+
+        /**
+         * @brief Change the number of vectors, zero-initializing any new ones.
+         *
+         * @param[in] count New size.
+         */
+        void resize(std::size_t count);
+
+
+        /** @brief Remove every vector, keeping the allocation. */
+        void clear() noexcept;
+
+
+        /**
+         * @brief Append @p vec.
+         * @details Grows the capacity geometrically, so appending `n` vectors reallocates `O(log n)` times.
+         *
+         * @param[in] vec Vector to append.
+         */
+        void push_back(const Vector4D<T>& vec);
+
+
+
+        /*************************************
+         *                                   *
+         *            ACCESSORS              *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Gather the vector at index @p i from the four streams.
+         *
+         * @param[in] i Index of the vector, must be below @ref size.
+         *
+         * @return A copy of the vector; write back with @ref set.
+         */
+        [[nodiscard]] Vector4D<T> operator[](std::size_t i) const noexcept;
+
+
+        /**
+         * @brief Scatter @p vec into the four streams at index @p i.
+         *
+         * @param[in] i   Index of the vector, must be below @ref size.
+         * @param[in] vec New value.
+         */
+        void set(std::size_t i, const Vector4D<T>& vec) noexcept;
+
+
+        /** @brief Stream of x components. */
+        [[nodiscard]] std::span<T> x() noexcept;
+        /** @copydoc x() */
+        [[nodiscard]] std::span<const T> x() const noexcept;
+
+        /** @brief Stream of y components. */
+        [[nodiscard]] std::span<T> y() noexcept;
+        /** @copydoc y() */
+        [[nodiscard]] std::span<const T> y() const noexcept;
+
+        /** @brief Stream of z components. */
+        [[nodiscard]] std::span<T> z() noexcept;
+        /** @copydoc z() */
+        [[nodiscard]] std::span<const T> z() const noexcept;
+
+        /** @brief Stream of w components. */
+        [[nodiscard]] std::span<T> w() noexcept;
+        /** @copydoc w() */
+        [[nodiscard]] std::span<const T> w() const noexcept;
+
+
+        /** @brief Pointers to the four streams, as taken by @ref falcon::simd::Vec4Kernels. */
+        [[nodiscard]] falcon::simd::Vec4Streams<T> streams() noexcept;
+        /** @copydoc streams() */
+        [[nodiscard]] falcon::simd::Vec4Streams<const T> streams() const noexcept;
+
+
+
+        /*************************************
+         *                                   *
+         *         LAYOUT CONVERSION         *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Replace the contents with @p vectors.
+         *
+         * @param[in] vectors Packed source vectors.
+         */
+        void assign(std::span<const Vector4D<T>> vectors);
+
+
+        /**
+         * @brief Pack the vectors into @p out.
+         *
+         * @param[out] out Destination holding exactly @ref size vectors.
+         */
+        void toVectors(std::span<Vector4D<T>> out) const noexcept;
+
+
+        /** @brief Pack the vectors into a new `std::vector`. */
+        [[nodiscard]] std::vector<Vector4D<T>> toVectors() const;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Vec4Array_Arithmetic
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *       ARITHMETIC OPERATIONS       *
+         *                                   *
+         *************************************/
+
+        /** @brief Add @p rhs vector by vector. */
+        [[nodiscard]] Vec4Array operator+(const Vec4Array& rhs) const;
+
+
+        /** @brief Add @p rhs vector by vector in place. */
+        Vec4Array& operator+=(const Vec4Array& rhs) noexcept;
+
+
+        /** @brief Subtract @p rhs vector by vector. */
+        [[nodiscard]] Vec4Array operator-(const Vec4Array& rhs) const;
+
+
+        /** @brief Subtract @p rhs vector by vector in place. */
+        Vec4Array& operator-=(const Vec4Array& rhs) noexcept;
+
+
+        /** @brief Negate every vector. */
+        [[nodiscard]] Vec4Array operator-() const;
+
+
+        /** @brief Scale every vector by @p scalar. */
+        [[nodiscard]] Vec4Array operator*(T scalar) const;
+
+
+        /** @brief Scale every vector by @p scalar in place. */
+        Vec4Array& operator*=(T scalar) noexcept;
+
+
+        /**
+         * @brief Divide every vector by @p scalar.
+         * @note Multiplies by the reciprocal like @ref Vector4D::operator/.
+         */
+        [[nodiscard]] Vec4Array operator/(T scalar) const;
+
+
+        /** @brief Divide every vector by @p scalar in place. */
+        Vec4Array& operator/=(T scalar) noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Vec4Array_Geometry
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *        GEOMETRIC OPERATIONS       *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Compute the dot product of every pair of vectors.
+         *
+         * @param[in]  rhs Second operand of each dot product.
+         * @param[out] out Destination holding exactly @ref size scalars.
+         */
+        void dot(const Vec4Array& rhs, std::span<T> out) const noexcept;
+
+
+        /** @copybrief dot(const Vec4Array&, std::span<T>) const */
+        [[nodiscard]] std::vector<T> dot(const Vec4Array& rhs) const;
+
+
+        /**
+         * @brief Compute the magnitude of every vector.
+         *
+         * @param[out] out Destination holding exactly @ref size scalars.
+         */
+        void mag(std::span<T> out) const noexcept;
+
+
+        /** @copybrief mag(std::span<T>) const */
+        [[nodiscard]] std::vector<T> mag() const;
+
+
+        /**
+         * @brief Normalize every vector.
+         * @details The default @ref Precision::Exact gives the same bits as per-vector normalization on every
+         *          dispatch tier.
+         * @warning Like @ref Vector4D::normalize, zero-length vectors produce NaN or infinity.
+         *
+         * @tparam P Accuracy tier, with the error bounds of @ref falcon::simd::Precision.
+         */
+        template <Precision P = Precision::Exact>
+        [[nodiscard]] Vec4Array normalize() const;
+
+
+        /**
+         * @brief Normalize every vector, writing zero vectors where @ref Vector4D::safeNormalize would.
+         * @details The default @ref Precision::Exact gives the same bits as per-vector normalization on every
+         *          dispatch tier.
+         *
+         * @tparam P Accuracy tier, with the error bounds of @ref falcon::simd::Precision.
+         */
+        template <Precision P = Precision::Exact>
+        [[nodiscard]] Vec4Array safeNormalize() const;
+
+
+        /**
+         * @brief Project every vector onto the matching vector of @p onto.
+         *
+         * @param[in] onto           Vectors to project onto.
+         * @param[in] ontoNormalized Optimization flag. Set to `true` if every vector of @p onto is a unit vector.
+         */
+        [[nodiscard]] Vec4Array project(const Vec4Array& onto, bool ontoNormalized = false) const;
+
+
+        /**
+         * @brief Reject every vector from the matching vector of @p from.
+         *
+         * @param[in] from           Vectors to reject from.
+         * @param[in] fromNormalized Optimization flag. Set to `true` if every vector of @p from is a unit vector.
+         */
+        [[nodiscard]] Vec4Array reject(const Vec4Array& from, bool fromNormalized = false) const;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup FGM_Vec4Array_Equality
+         * @{
+         */
+
+        /*************************************
+         *                                   *
+         *             EQUALITY              *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Compare every pair of vectors with the rule of @ref Vector4D::allEq.
+         * @details Bit `i % 64` of `out[i / 64]` is set when every component of vector `i` equals its counterpart in
+         *          @p rhs exactly or within @p epsilon. NaN components never match. Bits past @ref size are cleared.
+         *
+         * @param[in]  rhs     Vectors to compare against.
+         * @param[out] out     Destination holding exactly @ref bitsetWords words.
+         * @param[in]  epsilon Maximum allowable difference per component, in the precision of `T`.
+         */
+        void allEq(const Vec4Array& rhs, std::span<std::uint64_t> out, T epsilon = Config::EPSILON<T>) const noexcept;
+
+
+        /** @copybrief allEq(const Vec4Array&, std::span<std::uint64_t>, T) const */
+        [[nodiscard]] std::vector<std::uint64_t> allEq(const Vec4Array& rhs, T epsilon = Config::EPSILON<T>) const;
+
+
+        /** @brief Number of 64-bit words in the bitset written by @ref allEq, one bit per vector. */
+        [[nodiscard]] std::size_t bitsetWords() const noexcept;
+
+        /** @} */
+
+
+
+        private:
+        /** @brief Frees the streams with the aligned `operator delete[]` matching their allocation. */
+        struct AlignedDelete
+        {
+            void operator()(T* ptr) const noexcept;
+        };
+
+        /** @brief Tag selecting the constructor that leaves the streams uninitialized. */
+        struct Uninitialized
+        {};
+
+        Vec4Array(std::size_t count, Uninitialized);
+
+        /** @brief Reallocate to exactly @p newCapacity vectors per stream, keeping the first @ref size vectors. */
+        void reallocate(std::size_t newCapacity);
+
+        /** @brief Start of stream @p component (0 = x, 3 = w). */
+        [[nodiscard]] T* stream(std::size_t component) const noexcept;
+
+        /** @brief Kernels of the bound tier for `T`. */
+        [[nodiscard]] static const falcon::simd::TypedKernels<T>& kernels() noexcept;
+
+        std::unique_ptr<T[], AlignedDelete> _data;
+        std::size_t _size = 0;
+        std::size_t _capacity = 0;
+    };
+
+
+    /**
+     * @addtogroup FGM_Vec4Array_Arithmetic
+     * @{
+     */
+
+    /** @brief Scale every vector of @p array by @p scalar. */
+    template <BatchArithmetic T>
+    [[nodiscard]] Vec4Array<T> operator*(T scalar, const Vec4Array<T>& array);
+
+    /** @} */
+
+
+
+    /**
+     * @addtogroup FGM_Vec4Array_Alias
+     * @{
+     */
+
+    using vec4Array = Vec4Array<float>;   ///< `float` vector array
+    using dVec4Array = Vec4Array<double>; ///< `double` vector array
+
+    /** @} */
+
+} // namespace fgm
+
+
+#include "Vec4Array.tpp"
@@ -0,0 +1,547 @@
+/**
+ * @file Vec4Array.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation for structure-of-arrays 4D vector containers.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "common/Config.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+
+
+namespace fgm
+{
+    /*************************************
+     *                                   *
+     *            INITIALIZERS           *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const std::size_t count, Uninitialized)
+    {
+        reserve(count);
+        _size = count;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const std::size_t count) : Vec4Array(count, Vector4D<T>{})
+    {}
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const std::size_t count, const Vector4D<T>& value) : Vec4Array(count, Uninitialized{})
+    {
+        for (std::size_t c = 0; c < dimension; ++c)
+            std::fill_n(stream(c), count, value[c]);
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const std::span<const Vector4D<T>> vectors) : Vec4Array(vectors.size(), Uninitialized{})
+    {
+        static_assert(sizeof(Vector4D<T>) == dimension * sizeof(T), "Vector4D must be packed to be deinterleaved");
+        kernels().vec4.deinterleave(reinterpret_cast<const T*>(vectors.data()), streams(), vectors.size());
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const std::initializer_list<Vector4D<T>> vectors)
+        : Vec4Array(std::span<const Vector4D<T>>(vectors.begin(), vectors.size()))
+    {}
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(const Vec4Array& other) : Vec4Array(other._size, Uninitialized{})
+    {
+        for (std::size_t c = 0; c < dimension; ++c)
+            std::copy_n(other.stream(c), _size, stream(c));
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>::Vec4Array(Vec4Array&& other) noexcept
+        : _data(std::move(other._data)), _size(std::exchange(other._size, 0)),
+          _capacity(std::exchange(other._capacity, 0))
+    {}
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator=(const Vec4Array& other)
+    {
+        if (this == &other)
+            return *this;
+
+        _size = 0;
+        reserve(other._size);
+        for (std::size_t c = 0; c < dimension; ++c)
+            std::copy_n(other.stream(c), other._size, stream(c));
+        _size = other._size;
+        return *this;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator=(Vec4Array&& other) noexcept
+    {
+        _data = std::move(other._data);
+        _size = std::exchange(other._size, 0);
+        _capacity = std::exchange(other._capacity, 0);
+        return *this;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             CAPACITY              *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    std::size_t Vec4Array<T>::size() const noexcept
+    {
+        return _size;
+    }
+
+
+    template <BatchArithmetic T>
+    std::size_t Vec4Array<T>::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+
+    template <BatchArithmetic T>
+    bool Vec4Array<T>::empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::reserve(const std::size_t count)
+    {
+        if (count <= _capacity)
+            return;
+
+        /** @note Rounding each stream up to whole cache lines keeps every stream start aligned, without the up to
+         *        twice larger streams that rounding to a power of two would allocate for big arrays. */
+        constexpr std::size_t perLine = alignment / sizeof(T);
+        reallocate((count + perLine - 1) / perLine * perLine);
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::resize(const std::size_t count)
+    {
+        reserve(count);
+        if (count > _size)
+        {
+            for (std::size_t c = 0; c < dimension; ++c)
+                std::fill(stream(c) + _size, stream(c) + count, T(0));
+        }
+        _size = count;
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::clear() noexcept
+    {
+        _size = 0;
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::push_back(const Vector4D<T>& vec)
+    {
+        // reserve only rounds to a cache line, so doubling here keeps appends amortized constant.
+        if (_size == _capacity)
+            reserve(std::max(_size + 1, 2 * _capacity));
+        set(_size++, vec);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ACCESSORS              *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    Vector4D<T> Vec4Array<T>::operator[](const std::size_t i) const noexcept
+    {
+        assert(i < _size && "Vec4Array index out of range");
+        return { stream(0)[i], stream(1)[i], stream(2)[i], stream(3)[i] };
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::set(const std::size_t i, const Vector4D<T>& vec) noexcept
+    {
+        assert(i < _size && "Vec4Array index out of range");
+        for (std::size_t c = 0; c < dimension; ++c)
+            stream(c)[i] = vec[c];
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<T> Vec4Array<T>::x() noexcept
+    {
+        return { stream(0), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const T> Vec4Array<T>::x() const noexcept
+    {
+        return { stream(0), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<T> Vec4Array<T>::y() noexcept
+    {
+        return { stream(1), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const T> Vec4Array<T>::y() const noexcept
+    {
+        return { stream(1), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<T> Vec4Array<T>::z() noexcept
+    {
+        return { stream(2), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const T> Vec4Array<T>::z() const noexcept
+    {
+        return { stream(2), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<T> Vec4Array<T>::w() noexcept
+    {
+        return { stream(3), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    std::span<const T> Vec4Array<T>::w() const noexcept
+    {
+        return { stream(3), _size };
+    }
+
+
+    template <BatchArithmetic T>
+    falcon::simd::Vec4Streams<T> Vec4Array<T>::streams() noexcept
+    {
+        return { stream(0), stream(1), stream(2), stream(3) };
+    }
+
+
+    template <BatchArithmetic T>
+    falcon::simd::Vec4Streams<const T> Vec4Array<T>::streams() const noexcept
+    {
+        return { stream(0), stream(1), stream(2), stream(3) };
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *         LAYOUT CONVERSION         *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::assign(const std::span<const Vector4D<T>> vectors)
+    {
+        reserve(vectors.size());
+        _size = vectors.size();
+        kernels().vec4.deinterleave(reinterpret_cast<const T*>(vectors.data()), streams(), _size);
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::toVectors(const std::span<Vector4D<T>> out) const noexcept
+    {
+        assert(out.size() == _size && "Destination must hold exactly size() vectors");
+        kernels().vec4.interleave(streams(), reinterpret_cast<T*>(out.data()), _size);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<Vector4D<T>> Vec4Array<T>::toVectors() const
+    {
+        std::vector<Vector4D<T>> out(_size);
+        toVectors(out);
+        return out;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *       ARITHMETIC OPERATIONS       *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::operator+(const Vec4Array& rhs) const
+    {
+        Vec4Array result(*this);
+        return result += rhs;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator+=(const Vec4Array& rhs) noexcept
+    {
+        assert(_size == rhs._size && "Vec4Array sizes must match");
+        const auto& ops = kernels().stream;
+        for (std::size_t c = 0; c < dimension; ++c)
+            ops.add(stream(c), rhs.stream(c), stream(c), _size);
+        return *this;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::operator-(const Vec4Array& rhs) const
+    {
+        Vec4Array result(*this);
+        return result -= rhs;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator-=(const Vec4Array& rhs) noexcept
+    {
+        assert(_size == rhs._size && "Vec4Array sizes must match");
+        const auto& ops = kernels().stream;
+        for (std::size_t c = 0; c < dimension; ++c)
+            ops.subtract(stream(c), rhs.stream(c), stream(c), _size);
+        return *this;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::operator-() const
+    {
+        return *this * T(-1);
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::operator*(const T scalar) const
+    {
+        Vec4Array result(*this);
+        return result *= scalar;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator*=(const T scalar) noexcept
+    {
+        const auto& ops = kernels().stream;
+        for (std::size_t c = 0; c < dimension; ++c)
+            ops.scale(stream(c), scalar, stream(c), _size);
+        return *this;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::operator/(const T scalar) const
+    {
+        return *this * (T(1) / scalar);
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T>& Vec4Array<T>::operator/=(const T scalar) noexcept
+    {
+        return *this *= T(1) / scalar;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> operator*(const T scalar, const Vec4Array<T>& array)
+    {
+        return array * scalar;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *        GEOMETRIC OPERATIONS       *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::dot(const Vec4Array& rhs, const std::span<T> out) const noexcept
+    {
+        assert(_size == rhs._size && out.size() == _size && "Vec4Array sizes must match");
+        kernels().vec4.dot(streams(), rhs.streams(), out.data(), _size);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<T> Vec4Array<T>::dot(const Vec4Array& rhs) const
+    {
+        std::vector<T> out(_size);
+        dot(rhs, out);
+        return out;
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::mag(const std::span<T> out) const noexcept
+    {
+        assert(out.size() == _size && "Destination must hold exactly size() scalars");
+        kernels().vec4.mag(streams(), out.data(), _size);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<T> Vec4Array<T>::mag() const
+    {
+        std::vector<T> out(_size);
+        mag(out);
+        return out;
+    }
+
+
+    template <BatchArithmetic T>
+    template <Precision P>
+    Vec4Array<T> Vec4Array<T>::normalize() const
+    {
+        Vec4Array result(_size, Uninitialized{});
+        kernels().vec4.normalize(streams(), P, result.streams(), _size);
+        return result;
+    }
+
+
+    template <BatchArithmetic T>
+    template <Precision P>
+    Vec4Array<T> Vec4Array<T>::safeNormalize() const
+    {
+        Vec4Array result(_size, Uninitialized{});
+        kernels().vec4.safeNormalize(streams(), Config::EPSILON_SQUARE<T>, P, result.streams(), _size);
+        return result;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::project(const Vec4Array& onto, const bool ontoNormalized) const
+    {
+        assert(_size == onto._size && "Vec4Array sizes must match");
+        Vec4Array result(_size, Uninitialized{});
+        kernels().vec4.project(streams(), onto.streams(), ontoNormalized, result.streams(), _size);
+        return result;
+    }
+
+
+    template <BatchArithmetic T>
+    Vec4Array<T> Vec4Array<T>::reject(const Vec4Array& from, const bool fromNormalized) const
+    {
+        assert(_size == from._size && "Vec4Array sizes must match");
+        Vec4Array result(_size, Uninitialized{});
+        kernels().vec4.reject(streams(), from.streams(), fromNormalized, result.streams(), _size);
+        return result;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             EQUALITY              *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::allEq(const Vec4Array& rhs, const std::span<std::uint64_t> out, const T epsilon) const noexcept
+    {
+        assert(_size == rhs._size && out.size() == bitsetWords() && "Vec4Array sizes must match");
+        kernels().vec4.equal(streams(), rhs.streams(), epsilon, out.data(), _size);
+    }
+
+
+    template <BatchArithmetic T>
+    std::vector<std::uint64_t> Vec4Array<T>::allEq(const Vec4Array& rhs, const T epsilon) const
+    {
+        std::vector<std::uint64_t> out(bitsetWords());
+        allEq(rhs, out, epsilon);
+        return out;
+    }
+
+
+    template <BatchArithmetic T>
+    std::size_t Vec4Array<T>::bitsetWords() const noexcept
+    {
+        return (_size + 63) / 64;
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *              STORAGE              *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::AlignedDelete::operator()(T* ptr) const noexcept
+    {
+        ::operator delete[](ptr, std::align_val_t{ alignment });
+    }
+
+
+    template <BatchArithmetic T>
+    void Vec4Array<T>::reallocate(const std::size_t newCapacity)
+    {
+        if (newCapacity == 0)
+            return;
+
+        std::unique_ptr<T[], AlignedDelete> data(
+            static_cast<T*>(::operator new[](dimension * newCapacity * sizeof(T), std::align_val_t{ alignment })));
+
+        for (std::size_t c = 0; c < dimension && _data; ++c)
+            std::copy_n(stream(c), _size, data.get() + c * newCapacity);
+
+        _data = std::move(data);
+        _capacity = newCapacity;
+    }
+
+
+    template <BatchArithmetic T>
+    T* Vec4Array<T>::stream(const std::size_t component) const noexcept
+    {
+        return _data.get() + component * _capacity;
+    }
+
+
+    template <BatchArithmetic T>
+    const falcon::simd::TypedKernels<T>& Vec4Array<T>::kernels() noexcept
+    {
+        return falcon::simd::batchKernels().get<T>();
+    }
+} // namespace fgm
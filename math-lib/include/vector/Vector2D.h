@@ -49,8 +49,8 @@ namespace fgm
          *                                   *
          *************************************/
 
-        T& operator[](std::size_t i);
-        const T& operator[](std::size_t i) const;
+        constexpr T& operator[](std::size_t i);
+        constexpr const T& operator[](std::size_t i) const;
 
 
         /*************************************
@@ -59,28 +59,28 @@ namespace fgm
          *                                   *
          *************************************/
         template <Arithmetic U>
-        auto operator+(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<U, T>>;
+        constexpr auto operator+(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<U, T>>;
 
         template <Arithmetic U>
-        Vector2D& operator+=(const Vector2D<U>& other);
+        constexpr Vector2D& operator+=(const Vector2D<U>& other);
 
         template <Arithmetic U>
-        auto operator-(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<T, U>>;
+        constexpr auto operator-(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<T, U>>;
 
         template <Arithmetic U>
-        Vector2D& operator-=(const Vector2D<U>& other);
+        constexpr Vector2D& operator-=(const Vector2D<U>& other);
 
         template <Arithmetic S>
-        auto operator*(S scalar) const -> Vector2D<std::common_type_t<T, S>>;
+        constexpr auto operator*(S scalar) const -> Vector2D<std::common_type_t<T, S>>;
 
         template <Arithmetic S>
-        Vector2D& operator*=(S scalar);
+        constexpr Vector2D& operator*=(S scalar);
 
         template <Arithmetic S>
-        auto operator/(S scalar) const -> Vector2D<std::common_type_t<T, S>>;
+        constexpr auto operator/(S scalar) const -> Vector2D<std::common_type_t<T, S>>;
 
         template <Arithmetic S>
-        Vector2D& operator/=(S scalar);
+        constexpr Vector2D& operator/=(S scalar);
 
 
         /*************************************
@@ -89,10 +89,10 @@ namespace fgm
          *                                   *
          *************************************/
         template <Arithmetic U>
-        auto dot(const Vector2D<U>& other) const -> std::common_type_t<T, U>;
+        constexpr auto dot(const Vector2D<U>& other) const -> std::common_type_t<T, U>;
 
         template <Arithmetic U>
-        static auto dot(const Vector2D& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>;
+        static constexpr auto dot(const Vector2D& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>;
 
 
         /*************************************
@@ -101,10 +101,10 @@ namespace fgm
          *                                   *
          *************************************/
         template <Arithmetic U>
-        auto cross(const Vector2D<U>& other) const -> std::common_type_t<T, U>;
+        constexpr auto cross(const Vector2D<U>& other) const -> std::common_type_t<T, U>;
 
         template <Arithmetic U>
-        static auto cross(const Vector2D<T>& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>;
+        static constexpr auto cross(const Vector2D<T>& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>;
 
 
         /*************************************
@@ -112,7 +112,7 @@ namespace fgm
          *         VECTOR MAGNITUDE          *
          *                                   *
          *************************************/
-        T mag() const;
+        constexpr T mag() const;
 
 
         /*************************************
@@ -120,7 +120,7 @@ namespace fgm
          *       VECTOR NORMALIZATION        *
          *                                   *
          *************************************/
-        Vector2D normalize() const;
+        constexpr Vector2D normalize() const;
 
 
         /*************************************
@@ -138,7 +138,8 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        auto project(const Vector2D<U>& onto, bool ontoNormalized = false) const -> Vector2D<std::common_type_t<T, U>>;
+        constexpr auto project(const Vector2D<U>& onto, bool ontoNormalized = false) const
+            -> Vector2D<std::common_type_t<T, U>>;
 
         /**
          * Static wrapper for vector projection.
@@ -150,7 +151,7 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        static auto project(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized = false)
+        static constexpr auto project(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized = false)
             -> Vector2D<std::common_type_t<T, U>>;
 
 
@@ -169,7 +170,8 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        auto reject(const Vector2D<U>& onto, bool ontoNormalized = false) const -> Vector2D<std::common_type_t<T, U>>;
+        constexpr auto reject(const Vector2D<U>& onto, bool ontoNormalized = false) const
+            -> Vector2D<std::common_type_t<T, U>>;
 
         /**
          * Returns the perpendicular component for the current vector after projection to the `onto` vector.
@@ -181,7 +183,7 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        static auto reject(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized = false)
+        static constexpr auto reject(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized = false)
             -> Vector2D<std::common_type_t<T, U>>;
     };
 
@@ -193,7 +195,7 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T, Arithmetic S>
-    auto operator*(S scalar, const Vector2D<T>& vector) -> Vector2D<std::common_type_t<S, T>>;
+    constexpr auto operator*(S scalar, const Vector2D<T>& vector) -> Vector2D<std::common_type_t<S, T>>;
 
 
     /*************************************
@@ -2,6 +2,9 @@
 
 #include "Vector2D.h"
 
+#include "common/ConstexprMath.h"
+
+#include <cmath>
 #include <type_traits>
 
 namespace fgm
@@ -35,14 +38,19 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
-    T& Vector2D<T>::operator[](std::size_t i)
+    constexpr T& Vector2D<T>::operator[](std::size_t i)
     {
+        // Indexing past x is not a constant expression, so constant evaluation selects the member by name.
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : y;
         return (&x)[i];
     }
 
     template <Arithmetic T>
-    const T& Vector2D<T>::operator[](std::size_t i) const
+    constexpr const T& Vector2D<T>::operator[](std::size_t i) const
     {
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : y;
         return (&x)[i];
     }
 
@@ -55,7 +63,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector2D<T>::operator+(const Vector2D<S>& other) const -> Vector2D<std::common_type_t<S, T>>
+    constexpr auto Vector2D<T>::operator+(const Vector2D<S>& other) const -> Vector2D<std::common_type_t<S, T>>
     {
         using R = std::common_type_t<T, S>;
         return Vector2D<R>(x + other.x, y + other.y);
@@ -63,7 +71,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    Vector2D<T>& Vector2D<T>::operator+=(const Vector2D<U>& other)
+    constexpr Vector2D<T>& Vector2D<T>::operator+=(const Vector2D<U>& other)
     {
         x += static_cast<T>(other.x);
         y += static_cast<T>(other.y);
@@ -72,7 +80,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::operator-(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<T, U>>
+    constexpr auto Vector2D<T>::operator-(const Vector2D<U>& other) const -> Vector2D<std::common_type_t<T, U>>
     {
         using R = std::common_type_t<T, U>;
         return Vector2D<R>(x - other.x, y - other.y);
@@ -80,7 +88,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    Vector2D<T>& Vector2D<T>::operator-=(const Vector2D<U>& other)
+    constexpr Vector2D<T>& Vector2D<T>::operator-=(const Vector2D<U>& other)
     {
         x -= static_cast<T>(other.x);
         y -= static_cast<T>(other.y);
@@ -89,21 +97,21 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector2D<T>::operator*(S scalar) const -> Vector2D<std::common_type_t<T, S>>
+    constexpr auto Vector2D<T>::operator*(S scalar) const -> Vector2D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
         return Vector2D<R>(x * scalar, y * scalar);
     }
 
     template <Arithmetic T, Arithmetic S>
-    auto operator*(S scalar, const Vector2D<T>& vector) -> Vector2D<std::common_type_t<S, T>>
+    constexpr auto operator*(S scalar, const Vector2D<T>& vector) -> Vector2D<std::common_type_t<S, T>>
     {
         return vector * scalar;
     }
 
     template <Arithmetic T>
     template <Arithmetic S>
-    Vector2D<T>& Vector2D<T>::operator*=(S scalar)
+    constexpr Vector2D<T>& Vector2D<T>::operator*=(S scalar)
     {
         x = static_cast<T>(scalar * x);
         y = static_cast<T>(scalar * y);
@@ -112,7 +120,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector2D<T>::operator/(S scalar) const -> Vector2D<std::common_type_t<T, S>>
+    constexpr auto Vector2D<T>::operator/(S scalar) const -> Vector2D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / static_cast<R>(scalar);
@@ -121,7 +129,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    Vector2D<T>& Vector2D<T>::operator/=(S scalar)
+    constexpr Vector2D<T>& Vector2D<T>::operator/=(S scalar)
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / static_cast<R>(scalar);
@@ -140,14 +148,14 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector2D<T>::dot(const Vector2D<S>& other) const -> std::common_type_t<T, S>
+    constexpr auto Vector2D<T>::dot(const Vector2D<S>& other) const -> std::common_type_t<T, S>
     {
         return x * other.x + y * other.y;
     }
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::dot(const Vector2D& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>
+    constexpr auto Vector2D<T>::dot(const Vector2D& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>
     {
         return vectorA.dot(vectorB);
     }
@@ -161,14 +169,15 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::cross(const Vector2D<U>& other) const -> std::common_type_t<T, U>
+    constexpr auto Vector2D<T>::cross(const Vector2D<U>& other) const -> std::common_type_t<T, U>
     {
         return x * other.y - y * other.x;
     }
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::cross(const Vector2D<T>& vectorA, const Vector2D<U>& vectorB) -> std::common_type_t<T, U>
+    constexpr auto Vector2D<T>::cross(const Vector2D<T>& vectorA, const Vector2D<U>& vectorB)
+        -> std::common_type_t<T, U>
     {
         return vectorA.cross(vectorB);
     }
@@ -181,9 +190,9 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
-    T Vector2D<T>::mag() const
+    constexpr T Vector2D<T>::mag() const
     {
-        return sqrt(x * x + y * y);
+        return static_cast<T>(fgm::sqrt(x * x + y * y));
     }
 
 
@@ -194,7 +203,7 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
-    Vector2D<T> Vector2D<T>::normalize() const
+    constexpr Vector2D<T> Vector2D<T>::normalize() const
     {
         return (*this) / this->mag();
     }
@@ -208,7 +217,8 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::project(const Vector2D<U>& onto, bool ontoNormalized) const -> Vector2D<std::common_type_t<T, U>>
+    constexpr auto Vector2D<T>::project(const Vector2D<U>& onto, bool ontoNormalized) const
+        -> Vector2D<std::common_type_t<T, U>>
     {
         if (ontoNormalized)
         {
@@ -224,7 +234,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::project(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized)
+    constexpr auto Vector2D<T>::project(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized)
         -> Vector2D<std::common_type_t<T, U>>
     {
         return vector.project(onto, ontoNormalized);
@@ -239,14 +249,15 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::reject(const Vector2D<U>& onto, bool ontoNormalized) const -> Vector2D<std::common_type_t<T, U>>
+    constexpr auto Vector2D<T>::reject(const Vector2D<U>& onto, bool ontoNormalized) const
+        -> Vector2D<std::common_type_t<T, U>>
     {
         return *this - this->project(onto, ontoNormalized);
     }
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector2D<T>::reject(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized)
+    constexpr auto Vector2D<T>::reject(const Vector2D& vector, const Vector2D<U>& onto, bool ontoNormalized)
         -> Vector2D<std::common_type_t<T, U>>
     {
         return vector.reject(onto, ontoNormalized);
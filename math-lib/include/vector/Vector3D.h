@@ -73,8 +73,8 @@ namespace fgm
          *                                   *
          *************************************/
 
-        T& operator[](std::size_t i);
-        const T& operator[](std::size_t i) const;
+        constexpr T& operator[](std::size_t i);
+        constexpr const T& operator[](std::size_t i) const;
 
 
         /*************************************
@@ -84,28 +84,28 @@ namespace fgm
          *************************************/
 
         template <Arithmetic U>
-        auto operator+(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
+        constexpr auto operator+(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
 
         template <Arithmetic U>
-        Vector3D& operator+=(const Vector3D<U>& other);
+        constexpr Vector3D& operator+=(const Vector3D<U>& other);
 
         template <Arithmetic U>
-        auto operator-(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
+        constexpr auto operator-(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
 
         template <Arithmetic U>
-        Vector3D& operator-=(const Vector3D<U>& other);
+        constexpr Vector3D& operator-=(const Vector3D<U>& other);
 
         template <Arithmetic S>
-        auto operator*(S scalar) const -> Vector3D<std::common_type_t<T, S>>;
+        constexpr auto operator*(S scalar) const -> Vector3D<std::common_type_t<T, S>>;
 
         template <Arithmetic S>
-        Vector3D& operator*=(S scalar);
+        constexpr Vector3D& operator*=(S scalar);
 
         template <Arithmetic S>
-        auto operator/(S scalar) const -> Vector3D<std::common_type_t<T, S>>;
+        constexpr auto operator/(S scalar) const -> Vector3D<std::common_type_t<T, S>>;
 
         template <Arithmetic S>
-        Vector3D& operator/=(S scalar);
+        constexpr Vector3D& operator/=(S scalar);
 
 
         /*************************************
@@ -114,10 +114,10 @@ namespace fgm
          *                                   *
          *************************************/
         template <Arithmetic U>
-        auto dot(const Vector3D<U>& other) const -> std::common_type_t<T, U>;
+        constexpr auto dot(const Vector3D<U>& other) const -> std::common_type_t<T, U>;
 
         template <Arithmetic U>
-        static auto dot(const Vector3D& vecA, const Vector3D<U>& vecB) -> std::common_type_t<T, U>;
+        static constexpr auto dot(const Vector3D& vecA, const Vector3D<U>& vecB) -> std::common_type_t<T, U>;
 
 
         /*************************************
@@ -126,10 +126,11 @@ namespace fgm
          *                                   *
          *************************************/
         template <Arithmetic U>
-        auto cross(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
+        constexpr auto cross(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>;
 
         template <Arithmetic U>
-        static auto cross(const Vector3D& vecA, const Vector3D<U>& vecB) -> Vector3D<std::common_type_t<T, U>>;
+        static constexpr auto cross(const Vector3D& vecA, const Vector3D<U>& vecB)
+            -> Vector3D<std::common_type_t<T, U>>;
 
 
         /*************************************
@@ -137,7 +138,7 @@ namespace fgm
          *         VECTOR MAGNITUDE          *
          *                                   *
          *************************************/
-        T mag() const;
+        constexpr T mag() const;
 
 
         /*************************************
@@ -145,7 +146,7 @@ namespace fgm
          *       VECTOR NORMALIZATION        *
          *                                   *
          *************************************/
-        Vector3D normalize() const;
+        constexpr Vector3D normalize() const;
 
 
         /*************************************
@@ -163,7 +164,8 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        auto project(const Vector3D<U>& onto, bool ontoNormalized = false) const -> Vector3D<std::common_type_t<T, U>>;
+        constexpr auto project(const Vector3D<U>& onto, bool ontoNormalized = false) const
+            -> Vector3D<std::common_type_t<T, U>>;
 
         /**
          * Static wrapper for vector projection.
@@ -175,7 +177,7 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        static auto project(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized = false)
+        static constexpr auto project(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized = false)
             -> Vector3D<std::common_type_t<T, U>>;
 
 
@@ -194,7 +196,8 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        auto reject(const Vector3D<U>& onto, bool ontoNormalized = false) const -> Vector3D<std::common_type_t<T, U>>;
+        constexpr auto reject(const Vector3D<U>& onto, bool ontoNormalized = false) const
+            -> Vector3D<std::common_type_t<T, U>>;
 
         /**
          * Returns the perpendicular component for the current vector after projection to the `onto` vector.
@@ -206,7 +209,7 @@ namespace fgm
          * @return Projected vector.
          */
         template <Arithmetic U>
-        static auto reject(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized = false)
+        static constexpr auto reject(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized = false)
             -> Vector3D<std::common_type_t<T, U>>;
     };
 
@@ -216,7 +219,7 @@ namespace fgm
      *                                   *
      *************************************/
     template <Arithmetic T, Arithmetic S>
-    auto operator*(S scalar, const Vector3D<T>& vector) -> Vector3D<std::common_type_t<T, S>>;
+    constexpr auto operator*(S scalar, const Vector3D<T>& vector) -> Vector3D<std::common_type_t<T, S>>;
 
     /*************************************
      *                                   *
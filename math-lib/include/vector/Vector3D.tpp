@@ -10,6 +10,10 @@
  */
 
 
+#include "common/ConstexprMath.h"
+
+#include <cmath>
+
 // TODO: Enable strict types using `using R = std::common_type_t<T, U>`
 
 namespace fgm
@@ -48,15 +52,20 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
-    T& Vector3D<T>::operator[](std::size_t i)
+    constexpr T& Vector3D<T>::operator[](std::size_t i)
     {
-        return ((&x)[i]);
+        // Indexing past x is not a constant expression, so constant evaluation selects the member by name.
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : i == 1 ? y : z;
+        return (&x)[i];
     }
 
     template <Arithmetic T>
-    const T& Vector3D<T>::operator[](std::size_t i) const
+    constexpr const T& Vector3D<T>::operator[](std::size_t i) const
     {
-        return ((&x)[i]);
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : i == 1 ? y : z;
+        return (&x)[i];
     }
 
 
@@ -68,7 +77,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::operator+(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::operator+(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
     {
         using R = std::common_type_t<T, U>;
         return Vector3D<R>(x + other.x, y + other.y, z + other.z);
@@ -76,7 +85,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    Vector3D<T>& Vector3D<T>::operator+=(const Vector3D<U>& other)
+    constexpr Vector3D<T>& Vector3D<T>::operator+=(const Vector3D<U>& other)
     {
         x += static_cast<T>(other.x);
         y += static_cast<T>(other.y);
@@ -86,7 +95,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::operator-(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::operator-(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
     {
         using R = std::common_type_t<T, U>;
         return Vector3D<R>(x - other.x, y - other.y, z - other.z);
@@ -94,7 +103,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    Vector3D<T>& Vector3D<T>::operator-=(const Vector3D<U>& other)
+    constexpr Vector3D<T>& Vector3D<T>::operator-=(const Vector3D<U>& other)
     {
         x -= static_cast<T>(other.x);
         y -= static_cast<T>(other.y);
@@ -104,7 +113,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector3D<T>::operator*(S scalar) const -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto Vector3D<T>::operator*(S scalar) const -> Vector3D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
         return Vector3D<R>(x * scalar, y * scalar, z * scalar);
@@ -112,14 +121,14 @@ namespace fgm
 
 
     template <Arithmetic T, Arithmetic S>
-    auto operator*(S scalar, const Vector3D<T>& vector) -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto operator*(S scalar, const Vector3D<T>& vector) -> Vector3D<std::common_type_t<T, S>>
     {
         return vector * scalar;
     }
 
     template <Arithmetic T>
     template <Arithmetic S>
-    Vector3D<T>& Vector3D<T>::operator*=(S scalar)
+    constexpr Vector3D<T>& Vector3D<T>::operator*=(S scalar)
     {
         x = static_cast<T>(scalar * x);
         y = static_cast<T>(scalar * y);
@@ -129,7 +138,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    auto Vector3D<T>::operator/(S scalar) const -> Vector3D<std::common_type_t<T, S>>
+    constexpr auto Vector3D<T>::operator/(S scalar) const -> Vector3D<std::common_type_t<T, S>>
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / scalar;
@@ -138,7 +147,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic S>
-    Vector3D<T>& Vector3D<T>::operator/=(S scalar)
+    constexpr Vector3D<T>& Vector3D<T>::operator/=(S scalar)
     {
         using R = std::common_type_t<T, S>;
         R factor = R(1) / scalar;
@@ -156,9 +165,9 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
-    T Vector3D<T>::mag() const
+    constexpr T Vector3D<T>::mag() const
     {
-        return sqrt(x * x + y * y + z * z);
+        return static_cast<T>(fgm::sqrt(x * x + y * y + z * z));
     }
 
 
@@ -168,7 +177,7 @@ namespace fgm
      *                                   *
      *************************************/
     template <Arithmetic T>
-    Vector3D<T> Vector3D<T>::normalize() const
+    constexpr Vector3D<T> Vector3D<T>::normalize() const
     {
         return (*this) / mag();
     }
@@ -180,14 +189,14 @@ namespace fgm
      *************************************/
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::dot(const Vector3D<U>& other) const -> std::common_type_t<T, U>
+    constexpr auto Vector3D<T>::dot(const Vector3D<U>& other) const -> std::common_type_t<T, U>
     {
         return x * other.x + y * other.y + z * other.z;
     }
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::dot(const Vector3D& vecA, const Vector3D<U>& vecB) -> std::common_type_t<T, U>
+    constexpr auto Vector3D<T>::dot(const Vector3D& vecA, const Vector3D<U>& vecB) -> std::common_type_t<T, U>
     {
         return vecA.dot(vecB);
     }
@@ -201,7 +210,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::cross(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::cross(const Vector3D<U>& other) const -> Vector3D<std::common_type_t<T, U>>
     {
         using R = std::common_type_t<T, U>;
         return Vector3D<R>(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x);
@@ -209,7 +218,8 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::cross(const Vector3D& vecA, const Vector3D<U>& vecB) -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::cross(const Vector3D& vecA, const Vector3D<U>& vecB)
+        -> Vector3D<std::common_type_t<T, U>>
     {
         return vecA.cross(vecB);
     }
@@ -223,7 +233,8 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::project(const Vector3D<U>& onto, bool ontoNormalized) const -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::project(const Vector3D<U>& onto, bool ontoNormalized) const
+        -> Vector3D<std::common_type_t<T, U>>
     {
         if (ontoNormalized)
         {
@@ -239,7 +250,7 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::project(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized)
+    constexpr auto Vector3D<T>::project(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized)
         -> Vector3D<std::common_type_t<T, U>>
     {
         return vector.project(onto, ontoNormalized);
@@ -254,14 +265,15 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::reject(const Vector3D<U>& onto, bool ontoNormalized) const -> Vector3D<std::common_type_t<T, U>>
+    constexpr auto Vector3D<T>::reject(const Vector3D<U>& onto, bool ontoNormalized) const
+        -> Vector3D<std::common_type_t<T, U>>
     {
         return *this - this->project(onto, ontoNormalized);
     }
 
     template <Arithmetic T>
     template <Arithmetic U>
-    auto Vector3D<T>::reject(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized)
+    constexpr auto Vector3D<T>::reject(const Vector3D& vector, const Vector3D<U>& onto, bool ontoNormalized)
         -> Vector3D<std::common_type_t<T, U>>
     {
         return vector.reject(onto, ontoNormalized);
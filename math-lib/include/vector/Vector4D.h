@@ -6,8 +6,9 @@
  *
  * @brief Templated 4D Vector supporting integral, floating-point, and boolean types.
  *
- * @todo Provides a high-performance vector implementation with SIMD acceleration
- *       and support for component-wise operations.
+ * @details @ref vec4 is backed by a single 16-byte aligned SSE register. Arithmetic, dot products, magnitude,
+ *          normalization, projection, and rejection run on `__m128` whenever `FALCON_SIMD_SUPPORTED` is defined by
+ *          SIMD.h. Constant evaluation always uses the scalar path.
  *
  * @tparam T Type of @ref Vector4D components. Must satisfy @ref Arithmetic.
  *
@@ -21,10 +22,13 @@
  * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
  */
 
+#include "Mask4.h"
+#include "SimdTraits.h"
 #include "Vector2D.h"
 #include "Vector3D.h"
 #include "common/Config.h"
 #include "common/Constants.h"
+#include "common/ConstexprMath.h"
 #include "common/MathTraits.h"
 
 #include <cstddef>
@@ -38,7 +42,7 @@ namespace fgm
 {
 
     template <Arithmetic T>
-    struct Vector4D
+    struct alignas(SimdTraits<T, 4>::alignment) Vector4D
     {
 
         /**
@@ -385,6 +389,45 @@ namespace fgm
                                                               ? Config::DOUBLE_EPSILON
                                                               : Config::FLOAT_EPSILON) noexcept;
 
+
+
+        /**
+         * @brief Perform component-wise equality check into a packed lane mask.
+         *        Same predicate as @ref eq, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref Arithmetic.
+         *
+         * @param[in] rhs     The vector to compare against.
+         * @param[in] epsilon Maximum allowable difference for `std::floating_point` types.
+         *                    Defaults to @ref DOUBLE_EPSILON or @ref FLOAT_EPSILON based on type promotion.
+         *
+         * @return A @ref Mask4 with bit `i` set if component `i` is equivalent within @p epsilon.
+         */
+        template <Arithmetic U>
+        [[nodiscard]] constexpr Mask4 eqMask(const Vector4D<U>& rhs,
+                                             double epsilon = (std::is_same_v<T, double> || std::is_same_v<U, double>)
+                                                 ? Config::DOUBLE_EPSILON
+                                                 : Config::FLOAT_EPSILON) const noexcept;
+
+
+        /**
+         * @brief Perform component-wise inequality check into a packed lane mask.
+         *        Same predicate as @ref neq, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref Arithmetic.
+         *
+         * @param[in] rhs     The vector to compare against.
+         * @param[in] epsilon Maximum allowable difference for `std::floating_point` types.
+         *                    Defaults to @ref DOUBLE_EPSILON or @ref FLOAT_EPSILON based on type promotion.
+         *
+         * @return A @ref Mask4 with bit `i` set if component `i` is not equivalent within @p epsilon.
+         */
+        template <Arithmetic U>
+        [[nodiscard]] constexpr Mask4 neqMask(const Vector4D<U>& rhs,
+                                              double epsilon = (std::is_same_v<T, double> || std::is_same_v<U, double>)
+                                                  ? Config::DOUBLE_EPSILON
+                                                  : Config::FLOAT_EPSILON) const noexcept;
+
         /** @} */
 
 
@@ -532,6 +575,66 @@ namespace fgm
             requires StrictArithmetic<T>;
 
 
+        /**
+         * @brief Perform component-wise greater-than comparison into a packed lane mask.
+         *        Same predicate as @ref gt, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref StrictArithmetic.
+         *
+         * @param[in] rhs The vector to compare against.
+         *
+         * @return A @ref Mask4 with bit `i` set if the comparison holds for component `i`.
+         */
+        template <StrictArithmetic U>
+        [[nodiscard]] constexpr Mask4 gtMask(const Vector4D<U>& rhs) const noexcept
+            requires StrictArithmetic<T>;
+
+
+        /**
+         * @brief Perform component-wise greater-than-or-equal comparison into a packed lane mask.
+         *        Same predicate as @ref gte, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref StrictArithmetic.
+         *
+         * @param[in] rhs The vector to compare against.
+         *
+         * @return A @ref Mask4 with bit `i` set if the comparison holds for component `i`.
+         */
+        template <StrictArithmetic U>
+        [[nodiscard]] constexpr Mask4 gteMask(const Vector4D<U>& rhs) const noexcept
+            requires StrictArithmetic<T>;
+
+
+        /**
+         * @brief Perform component-wise less-than comparison into a packed lane mask.
+         *        Same predicate as @ref lt, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref StrictArithmetic.
+         *
+         * @param[in] rhs The vector to compare against.
+         *
+         * @return A @ref Mask4 with bit `i` set if the comparison holds for component `i`.
+         */
+        template <StrictArithmetic U>
+        [[nodiscard]] constexpr Mask4 ltMask(const Vector4D<U>& rhs) const noexcept
+            requires StrictArithmetic<T>;
+
+
+        /**
+         * @brief Perform component-wise less-than-or-equal comparison into a packed lane mask.
+         *        Same predicate as @ref lte, without expanding the result into a @ref bVec4.
+         *
+         * @tparam U Numeric type of the RHS vector. Must satisfy @ref StrictArithmetic.
+         *
+         * @param[in] rhs The vector to compare against.
+         *
+         * @return A @ref Mask4 with bit `i` set if the comparison holds for component `i`.
+         */
+        template <StrictArithmetic U>
+        [[nodiscard]] constexpr Mask4 lteMask(const Vector4D<U>& rhs) const noexcept
+            requires StrictArithmetic<T>;
+
+
 #ifdef ENABLE_FGM_SHADER_OPERATORS
 
         /**
@@ -646,6 +749,38 @@ namespace fgm
         [[nodiscard]] constexpr Vector4D<bool> operator!() const noexcept
             requires std::is_same_v<T, bool>;
 
+
+
+        /**
+         * @brief Pack the components into a @ref Mask4, one bit per lane.
+         *
+         * @note Only available for @ref bVec4 and vectors with `bool` value_type.
+         *
+         * @return A @ref Mask4 with bit `i` set if component `i` is true.
+         */
+        [[nodiscard]] constexpr Mask4 mask() const noexcept
+            requires std::is_same_v<T, bool>;
+
+
+        /** @brief True if every component is true. @note Only available for @ref bVec4. */
+        [[nodiscard]] constexpr bool all() const noexcept
+            requires std::is_same_v<T, bool>;
+
+
+        /** @brief True if at least one component is true. @note Only available for @ref bVec4. */
+        [[nodiscard]] constexpr bool any() const noexcept
+            requires std::is_same_v<T, bool>;
+
+
+        /** @brief True if no component is true. @note Only available for @ref bVec4. */
+        [[nodiscard]] constexpr bool none() const noexcept
+            requires std::is_same_v<T, bool>;
+
+
+        /** @brief Number of true components. @note Only available for @ref bVec4. */
+        [[nodiscard]] constexpr int count() const noexcept
+            requires std::is_same_v<T, bool>;
+
         /** @} */
 
 
@@ -928,6 +1063,7 @@ namespace fgm
          *
          * @note To avoid precision loss, integral types are promoted to their
          *       corresponding floating-point representation via @ref Magnitude.
+         * @note Usable in constant expressions through @ref fgm::sqrt, which rounds like the runtime square root.
          *
          * @return The scalar magnitude of the vector.
          */
@@ -965,8 +1101,13 @@ namespace fgm
          *       corresponding floating-point representation via @ref Magnitude.
          * @warning Does not check for zero-length vectors. @ref mag() must be non-zero.
          *
+         * @tparam P Accuracy tier. @ref Precision::Fast and @ref Precision::Refined multiply by an approximate
+         *           reciprocal magnitude instead of dividing; see @ref falcon::simd::Precision for their error bounds.
+         *           Constant evaluation and non-SIMD builds compute every tier with a correctly rounded reciprocal.
+         *
          * @return A new @ref Vector4D with a magnitude of 1.0.
          */
+        template <Precision P = Precision::Exact>
         [[nodiscard]] constexpr Vector4D<Magnitude<T>> normalize() const noexcept
             requires StrictArithmetic<T>;
 
@@ -978,9 +1119,12 @@ namespace fgm
          * @note To maintain precision, result components are promoted to their
          *       corresponding floating-point representation via @ref Magnitude.
          *
+         * @tparam P Accuracy tier, see @ref normalize() const.
+         *
          * @param[in] vec The vector to normalize.
          * @return A new @ref Vector4D with a magnitude of 1.0.
          */
+        template <Precision P = Precision::Exact>
         [[nodiscard]] constexpr static Vector4D<Magnitude<T>> normalize(const Vector4D& vec) noexcept
             requires StrictArithmetic<T>;
 
@@ -993,9 +1137,12 @@ namespace fgm
          * @note To maintain precision, result components are promoted to their
          *       corresponding floating-point representation via @ref Magnitude.
          *
-         * @return A @ref fgm::Vector4D with a magnitude of 1.0, or a zero-vector if the original magnitude is below the
-         * epsilon threshold.
+         * @tparam P Accuracy tier, see @ref normalize() const.
+         *
+         * @return A @ref fgm::Vector4D with a magnitude of 1.0, or a zero-vector if the squared magnitude is at or
+         * below @ref Config::EPSILON_SQUARE.
          */
+        template <Precision P = Precision::Exact>
         [[nodiscard]] constexpr Vector4D<Magnitude<T>> safeNormalize() const noexcept
             requires StrictArithmetic<T>;
 
@@ -1007,6 +1154,7 @@ namespace fgm
          *
          * @param[in] vec The vector to be normalized.
          */
+        template <Precision P = Precision::Exact>
         [[nodiscard]] constexpr static Vector4D<Magnitude<T>> safeNormalize(const Vector4D& vec) noexcept
             requires StrictArithmetic<T>;
 
@@ -1227,7 +1375,7 @@ namespace fgm
          *
          * @return A reference to the output stream @p os.
          */
-        [[nodiscard]] constexpr friend std::ostream& operator<<(std::ostream& os, const Vector4D& vector)
+        constexpr friend std::ostream& operator<<(std::ostream& os, const Vector4D& vector)
         {
             auto precision = Config::useFullPrecision
                 ? std::is_same_v<T, double> ? Config::DOUBLE_PRECISION : Config::FLOAT_PRECISION
@@ -1317,7 +1465,7 @@ namespace fgm
          * @note Only available for @ref fgm::StrictArithmetic types.
          */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> one = Vector4D<T>(T(1), T(1), T(1), T(1));
+        inline constexpr Vector4D<T> one = Vector4D<T>(T(1), T(1), T(1), T(1));
 
 
         /**
@@ -1326,7 +1474,7 @@ namespace fgm
          * @note Only available for @ref fgm::StrictArithmetic types.
          */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> zero =
+        inline constexpr Vector4D<T> zero =
             Vector4D<T>(T(0), T(0), T(0), T(0)); ///< 4D-Vector with all zero-components.
 
 
@@ -1337,7 +1485,7 @@ namespace fgm
          */
         template <StrictArithmetic T>
             requires std::floating_point<T>
-        [[nodiscard]] inline constexpr Vector4D<T> inf = Vector4D<T>(
+        inline constexpr Vector4D<T> inf = Vector4D<T>(
             T(constants::INFINITY_D), T(constants::INFINITY_D), T(constants::INFINITY_D), T(constants::INFINITY_D));
 
 
@@ -1348,7 +1496,7 @@ namespace fgm
          */
         template <StrictArithmetic T>
             requires std::floating_point<T>
-        [[nodiscard]] inline constexpr Vector4D<T> infN = Vector4D<T>(
+        inline constexpr Vector4D<T> infN = Vector4D<T>(
             T(-constants::INFINITY_D), T(-constants::INFINITY_D), T(-constants::INFINITY_D), T(-constants::INFINITY_D));
 
 
@@ -1359,27 +1507,27 @@ namespace fgm
          */
         template <StrictArithmetic T>
             requires std::floating_point<T>
-        [[nodiscard]] inline constexpr Vector4D<T> nan =
+        inline constexpr Vector4D<T> nan =
             Vector4D<T>(T(constants::NaN_D), T(constants::NaN_D), T(constants::NaN_D), T(constants::NaN_D));
 
 
         /** @brief A 4D unit vector aligned with the positive X-axis (1, 0, 0, 0). */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> x = Vector4D<T>(T(1), T(0), T(0), T(0));
+        inline constexpr Vector4D<T> x = Vector4D<T>(T(1), T(0), T(0), T(0));
 
 
         /** @brief A 4D unit vector aligned with the positive Y-axis (0, 1, 0, 0). */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> y = Vector4D<T>(T(0), T(1), T(0), T(0));
+        inline constexpr Vector4D<T> y = Vector4D<T>(T(0), T(1), T(0), T(0));
 
 
         /** @brief A 4D unit vector aligned with the positive Z-axis (0, 0, 1, 0). */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> z = Vector4D<T>(T(0), T(0), T(1), T(0));
+        inline constexpr Vector4D<T> z = Vector4D<T>(T(0), T(0), T(1), T(0));
 
         /** @brief A 4D unit vector aligned with the positive W-axis (0, 0, 0, 1). */
         template <StrictArithmetic T>
-        [[nodiscard]] inline constexpr Vector4D<T> w = Vector4D<T>(T(0), T(0), T(0), T(1));
+        inline constexpr Vector4D<T> w = Vector4D<T>(T(0), T(0), T(0), T(1));
 
 
     } // namespace vec4d
@@ -12,8 +12,10 @@
 
 
 #include "Vector4D.h"
+#include "Vector4DSimd.h"
 
 #include <cassert>
+#include <cmath>
 #include <type_traits>
 
 namespace fgm
@@ -69,12 +71,17 @@ namespace fgm
     template <Arithmetic T>
     constexpr T& Vector4D<T>::operator[](const std::size_t i) noexcept
     {
+        // Indexing past x is not a constant expression, so constant evaluation selects the member by name.
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : i == 1 ? y : i == 2 ? z : w;
         return (&x)[i];
     }
 
     template <Arithmetic T>
     constexpr const T& Vector4D<T>::operator[](const std::size_t i) const noexcept
     {
+        if (std::is_constant_evaluated())
+            return i == 0 ? x : i == 1 ? y : i == 2 ? z : w;
         return (&x)[i];
     }
 
@@ -91,13 +98,7 @@ namespace fgm
     template <Arithmetic U>
     constexpr bool Vector4D<T>::allEq(const Vector4D<U>& rhs, const double epsilon) const noexcept
     {
-
-        if constexpr (std::is_integral_v<T> && std::is_integral_v<U>)
-            return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
-        else
-            /** @note Direct equality check is required to handle @ref INFINITY cases, as Inf - Inf results in NAN_F. */
-            return (x == rhs.x || std::abs(x - rhs.x) <= epsilon) && (y == rhs.y || std::abs(y - rhs.y) <= epsilon) &&
-                (z == rhs.z || std::abs(z - rhs.z) <= epsilon) && (w == rhs.w || std::abs(w - rhs.w) <= epsilon);
+        return eqMask(rhs, epsilon).all();
     }
 
     template <Arithmetic T>
@@ -112,14 +113,7 @@ namespace fgm
     template <Arithmetic U>
     constexpr bool Vector4D<T>::allNeq(const Vector4D<U>& rhs, const double epsilon) const noexcept
     {
-
-        if constexpr (std::is_integral_v<T> && std::is_integral_v<U>)
-            return x != rhs.x || y != rhs.y || z != rhs.z || w != rhs.w;
-        else
-            /** @note Identity check and inverted logic handle NAN_F and INFINITY per IEEE 754. */
-            return (x != rhs.x && !(std::abs(x - rhs.x) <= epsilon)) ||
-                (y != rhs.y && !(std::abs(y - rhs.y) <= epsilon)) ||
-                (z != rhs.z && !(std::abs(z - rhs.z) <= epsilon)) || (w != rhs.w && !(std::abs(w - rhs.w) <= epsilon));
+        return neqMask(rhs, epsilon).any();
     }
 
 
@@ -148,15 +142,47 @@ namespace fgm
 
     template <Arithmetic T>
     template <Arithmetic U>
-    constexpr Vector4D<bool> Vector4D<T>::eq(const Vector4D<U>& rhs, const double epsilon) const noexcept
+    constexpr Mask4 Vector4D<T>::eqMask(const Vector4D<U>& rhs, const double epsilon) const noexcept
     {
         if constexpr (std::is_integral_v<T> && std::is_integral_v<U>)
-            return Vector4D(x == rhs.x, y == rhs.y, z == rhs.z, w == rhs.w);
+        {
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (detail::isSimdCompareVec4<T, U>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const int mask = detail::compare<detail::Compare::Equal>(detail::load(*this), detail::load(rhs));
+                    return Mask4(unsigned(mask));
+                }
+            }
+#endif
+            return Mask4(x == rhs.x, y == rhs.y, z == rhs.z, w == rhs.w);
+        }
         else
+        {
+            // Compare in the precision of the components, so float vectors never round-trip through double.
+            using R = Magnitude<std::common_type_t<T, U>>;
+            const R tolerance = static_cast<R>(epsilon);
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (detail::isSimdFloatVec4<T, U>)
+            {
+                if (!std::is_constant_evaluated())
+                    return Mask4(unsigned(detail::equal(detail::load(*this), detail::load(rhs), tolerance)));
+            }
+#endif
             /** @note Direct equality check is required to handle @ref INFINITY cases, as Inf - Inf results in NAN_F. */
-            return Vector4D(
-                (x == rhs.x || std::abs(x - rhs.x) <= epsilon), (y == rhs.y || std::abs(y - rhs.y) <= epsilon),
-                (z == rhs.z || std::abs(z - rhs.z) <= epsilon), (w == rhs.w || std::abs(w - rhs.w) <= epsilon));
+            return Mask4(
+                (x == rhs.x || fgm::abs(x - rhs.x) <= tolerance), (y == rhs.y || fgm::abs(y - rhs.y) <= tolerance),
+                (z == rhs.z || fgm::abs(z - rhs.z) <= tolerance), (w == rhs.w || fgm::abs(w - rhs.w) <= tolerance));
+        }
+    }
+
+
+    template <Arithmetic T>
+    template <Arithmetic U>
+    constexpr Vector4D<bool> Vector4D<T>::eq(const Vector4D<U>& rhs, const double epsilon) const noexcept
+    {
+        return eqMask(rhs, epsilon);
     }
 
 
@@ -168,17 +194,20 @@ namespace fgm
     }
 
 
+    template <Arithmetic T>
+    template <Arithmetic U>
+    constexpr Mask4 Vector4D<T>::neqMask(const Vector4D<U>& rhs, const double epsilon) const noexcept
+    {
+        /** @note Lanes are unequal exactly where they are not equal, so NaN lanes are always unequal. */
+        return ~eqMask(rhs, epsilon);
+    }
+
+
     template <Arithmetic T>
     template <Arithmetic U>
     constexpr Vector4D<bool> Vector4D<T>::neq(const Vector4D<U>& rhs, const double epsilon) const noexcept
     {
-        if constexpr (std::is_integral_v<T> && std::is_integral_v<U>)
-            return Vector4D(x != rhs.x, y != rhs.y, z != rhs.z, w != rhs.w);
-        else
-            /** @note Identity check and inverted logic handle NAN_F and INFINITY per IEEE 754. */
-            return Vector4D<bool>(
-                (x != rhs.x) && !(std::abs(x - rhs.x) <= epsilon), (y != rhs.y) && !(std::abs(y - rhs.y) <= epsilon),
-                (z != rhs.z) && !(std::abs(z - rhs.z) <= epsilon), (w != rhs.w) && !(std::abs(w - rhs.w) <= epsilon));
+        return neqMask(rhs, epsilon);
     }
 
 
@@ -199,12 +228,31 @@ namespace fgm
      *                                     *
      ***************************************/
 
+    template <Arithmetic T>
+    template <StrictArithmetic U>
+    constexpr Mask4 Vector4D<T>::gtMask(const Vector4D<U>& rhs) const noexcept
+        requires StrictArithmetic<T>
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdCompareVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const int mask = detail::compare<detail::Compare::Greater>(detail::load(*this), detail::load(rhs));
+                return Mask4(unsigned(mask));
+            }
+        }
+#endif
+        return Mask4(x > rhs.x, y > rhs.y, z > rhs.z, w > rhs.w);
+    }
+
+
     template <Arithmetic T>
     template <StrictArithmetic U>
     constexpr Vector4D<bool> Vector4D<T>::gt(const Vector4D<U>& rhs) const noexcept
         requires StrictArithmetic<T>
     {
-        return Vector4D(x > rhs.x, y > rhs.y, z > rhs.z, w > rhs.w);
+        return gtMask(rhs);
     }
 
 
@@ -217,12 +265,31 @@ namespace fgm
     }
 
 
+    template <Arithmetic T>
+    template <StrictArithmetic U>
+    constexpr Mask4 Vector4D<T>::gteMask(const Vector4D<U>& rhs) const noexcept
+        requires StrictArithmetic<T>
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdCompareVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const int mask = detail::compare<detail::Compare::GreaterEqual>(detail::load(*this), detail::load(rhs));
+                return Mask4(unsigned(mask));
+            }
+        }
+#endif
+        return Mask4(x >= rhs.x, y >= rhs.y, z >= rhs.z, w >= rhs.w);
+    }
+
+
     template <Arithmetic T>
     template <StrictArithmetic U>
     constexpr Vector4D<bool> Vector4D<T>::gte(const Vector4D<U>& rhs) const noexcept
         requires StrictArithmetic<T>
     {
-        return Vector4D(x >= rhs.x, y >= rhs.y, z >= rhs.z, w >= rhs.w);
+        return gteMask(rhs);
     }
 
 
@@ -235,12 +302,31 @@ namespace fgm
     }
 
 
+    template <Arithmetic T>
+    template <StrictArithmetic U>
+    constexpr Mask4 Vector4D<T>::ltMask(const Vector4D<U>& rhs) const noexcept
+        requires StrictArithmetic<T>
+    {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdCompareVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const int mask = detail::compare<detail::Compare::Less>(detail::load(*this), detail::load(rhs));
+                return Mask4(unsigned(mask));
+            }
+        }
+#endif
+        return Mask4(x < rhs.x, y < rhs.y, z < rhs.z, w < rhs.w);
+    }
+
+
     template <Arithmetic T>
     template <StrictArithmetic U>
     constexpr Vector4D<bool> Vector4D<T>::lt(const Vector4D<U>& rhs) const noexcept
         requires StrictArithmetic<T>
     {
-        return Vector4D(x < rhs.x, y < rhs.y, z < rhs.z, w < rhs.w);
+        return ltMask(rhs);
     }
 
 
@@ -255,12 +341,31 @@ namespace fgm
 
     template <Arithmetic T>
     template <StrictArithmetic U>
-    constexpr Vector4D<bool> Vector4D<T>::lte(const Vector4D<U>& rhs) const noexcept
+    constexpr Mask4 Vector4D<T>::lteMask(const Vector4D<U>& rhs) const noexcept
         requires StrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdCompareVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const int mask = detail::compare<detail::Compare::LessEqual>(detail::load(*this), detail::load(rhs));
+                return Mask4(unsigned(mask));
+            }
+        }
+#endif
         using R = Magnitude<std::common_type_t<T, U>>;
-        return Vector4D<bool>(static_cast<R>(x) <= static_cast<R>(rhs.x), static_cast<R>(y) <= static_cast<R>(rhs.y),
-                              static_cast<R>(z) <= static_cast<R>(rhs.z), static_cast<R>(w) <= static_cast<R>(rhs.w));
+        return Mask4(static_cast<R>(x) <= static_cast<R>(rhs.x), static_cast<R>(y) <= static_cast<R>(rhs.y),
+                     static_cast<R>(z) <= static_cast<R>(rhs.z), static_cast<R>(w) <= static_cast<R>(rhs.w));
+    }
+
+
+    template <Arithmetic T>
+    template <StrictArithmetic U>
+    constexpr Vector4D<bool> Vector4D<T>::lte(const Vector4D<U>& rhs) const noexcept
+        requires StrictArithmetic<T>
+    {
+        return lteMask(rhs);
     }
 
 
@@ -328,7 +433,8 @@ namespace fgm
     }
 
 
-    constexpr Vector4D<bool>& Vector4D<bool>::operator&=(const Vector4D<bool>& rhs) noexcept
+    template <Arithmetic T>
+    constexpr Vector4D<bool>& Vector4D<T>::operator&=(const Vector4D<bool>& rhs) noexcept
     {
         (*this) = (*this) & rhs;
         return *this;
@@ -346,7 +452,7 @@ namespace fgm
     template <Arithmetic T>
     constexpr Vector4D<bool>& Vector4D<T>::operator|=(const Vector4D<bool>& rhs) noexcept
     {
-        (*this) = (*this) & rhs;
+        (*this) = (*this) | rhs;
         return *this;
     }
 
@@ -359,6 +465,46 @@ namespace fgm
     }
 
 
+    template <Arithmetic T>
+    constexpr Mask4 Vector4D<T>::mask() const noexcept
+        requires std::is_same_v<T, bool>
+    {
+        return Mask4(x, y, z, w);
+    }
+
+
+    template <Arithmetic T>
+    constexpr bool Vector4D<T>::all() const noexcept
+        requires std::is_same_v<T, bool>
+    {
+        return mask().all();
+    }
+
+
+    template <Arithmetic T>
+    constexpr bool Vector4D<T>::any() const noexcept
+        requires std::is_same_v<T, bool>
+    {
+        return mask().any();
+    }
+
+
+    template <Arithmetic T>
+    constexpr bool Vector4D<T>::none() const noexcept
+        requires std::is_same_v<T, bool>
+    {
+        return mask().none();
+    }
+
+
+    template <Arithmetic T>
+    constexpr int Vector4D<T>::count() const noexcept
+        requires std::is_same_v<T, bool>
+    {
+        return mask().count();
+    }
+
+
 
     /*************************************
      *                                   *
@@ -372,6 +518,13 @@ namespace fgm
         requires StrictArithmetic<T>
     {
         using R = std::common_type_t<T, U>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::add(detail::load(*this), detail::load(rhs)));
+        }
+#endif
         return Vector4D<R>(x + rhs.x, y + rhs.y, z + rhs.z, w + rhs.w);
     }
 
@@ -381,6 +534,16 @@ namespace fgm
     constexpr Vector4D<T>& Vector4D<T>::operator+=(const Vector4D<U>& rhs) noexcept
         requires StrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::add(detail::load(*this), detail::load(rhs)));
+                return *this;
+            }
+        }
+#endif
         x += static_cast<T>(rhs.x);
         y += static_cast<T>(rhs.y);
         z += static_cast<T>(rhs.z);
@@ -395,6 +558,13 @@ namespace fgm
         requires StrictArithmetic<T>
     {
         using R = std::common_type_t<T, U>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::sub(detail::load(*this), detail::load(rhs)));
+        }
+#endif
         return Vector4D<R>(x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w);
     }
 
@@ -404,6 +574,16 @@ namespace fgm
     constexpr Vector4D<T>& Vector4D<T>::operator-=(const Vector4D<U>& rhs) noexcept
         requires StrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::sub(detail::load(*this), detail::load(rhs)));
+                return *this;
+            }
+        }
+#endif
         x -= static_cast<T>(rhs.x);
         y -= static_cast<T>(rhs.y);
         z -= static_cast<T>(rhs.z);
@@ -416,6 +596,13 @@ namespace fgm
     constexpr Vector4D<T> Vector4D<T>::operator-() const noexcept
         requires SignedStrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, T>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::negate(detail::load(*this)));
+        }
+#endif
         return Vector4D(-x, -y, -z, -w);
     }
 
@@ -426,6 +613,13 @@ namespace fgm
         requires StrictArithmetic<T>
     {
         using R = std::common_type_t<T, S>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, R>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::mul(detail::load(*this), detail::broadcast(static_cast<R>(scalar))));
+        }
+#endif
         return Vector4D<R>(x * scalar, y * scalar, z * scalar, w * scalar);
     }
 
@@ -443,6 +637,16 @@ namespace fgm
     constexpr Vector4D<T>& Vector4D<T>::operator*=(const S scalar) noexcept
         requires StrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, std::common_type_t<T, S>>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::storeInto(*this, detail::mul(detail::load(*this), detail::broadcast(static_cast<T>(scalar))));
+                return *this;
+            }
+        }
+#endif
 
         x = static_cast<T>(scalar * x);
         y = static_cast<T>(scalar * y);
@@ -461,6 +665,13 @@ namespace fgm
         if constexpr (std::is_floating_point_v<R>)
         {
             R factor = R(1) / static_cast<R>(scalar);
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (detail::isSimdFloatVec4<T, R>)
+            {
+                if (!std::is_constant_evaluated())
+                    return detail::store(detail::mul(detail::load(*this), detail::broadcast(factor)));
+            }
+#endif
             return Vector4D<R>(x * factor, y * factor, z * factor, w * factor);
         }
         else
@@ -481,6 +692,16 @@ namespace fgm
         if constexpr (std::is_floating_point_v<R>)
         {
             R factor = R(1) / static_cast<R>(scalar);
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (detail::isSimdFloatVec4<T, R>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    detail::storeInto(*this, detail::mul(detail::load(*this), detail::broadcast(factor)));
+                    return *this;
+                }
+            }
+#endif
 
             x = static_cast<T>(factor * x);
             y = static_cast<T>(factor * y);
@@ -509,7 +730,7 @@ namespace fgm
             if (scalar == 0)
                 return fgm::vec4d::zero<R>;
         if constexpr (std::is_floating_point_v<R>)
-            if (std::abs(scalar) <= std::numeric_limits<S>::epsilon())
+            if (fgm::abs(scalar) <= std::numeric_limits<S>::epsilon())
                 return fgm::vec4d::zero<R>;
 
         return (*this) / scalar;
@@ -538,7 +759,15 @@ namespace fgm
     constexpr auto Vector4D<T>::dot(const Vector4D<U>& rhs) const noexcept -> std::common_type_t<T, U>
         requires StrictArithmetic<T>
     {
-        return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::first(detail::dot(detail::load(*this), detail::load(rhs)));
+        }
+#endif
+        // Summed in pairs like the register dot product, so constant evaluation gives the same bits.
+        return (x * rhs.x + y * rhs.y) + (z * rhs.z + w * rhs.w);
     }
 
 
@@ -563,13 +792,24 @@ namespace fgm
         requires StrictArithmetic<T>
     {
         using M = Magnitude<T>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<M, M>)
+        {
+            /** @note Integral vectors are widened to their magnitude type once and reuse the floating point kernel. */
+            if (!std::is_constant_evaluated())
+            {
+                const auto vec = detail::load(Vector4D<M>(*this));
+                return detail::first(detail::sqrt(detail::dot(vec, vec)));
+            }
+        }
+#endif
 
         M tX = static_cast<M>(x);
         M tY = static_cast<M>(y);
         M tZ = static_cast<M>(z);
         M tW = static_cast<M>(w);
 
-        return sqrt(tX * tX + tY * tY + tZ * tZ + tW * tW);
+        return fgm::sqrt((tX * tX + tY * tY) + (tZ * tZ + tW * tW));
     }
 
 
@@ -589,40 +829,75 @@ namespace fgm
      *************************************/
 
     template <Arithmetic T>
+    template <Precision P>
     constexpr Vector4D<Magnitude<T>> Vector4D<T>::normalize() const noexcept
         requires StrictArithmetic<T>
     {
-        return *this / mag();
+        using R = Magnitude<T>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<R, R>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::normalize<P>(detail::load(Vector4D<R>(*this))));
+        }
+#endif
+        if constexpr (P == Precision::Exact)
+        {
+            // Divide each component, as the register path does; operator/ multiplies by the reciprocal.
+            const R length = mag();
+            return { static_cast<R>(x) / length, static_cast<R>(y) / length, static_cast<R>(z) / length,
+                     static_cast<R>(w) / length };
+        }
+        else
+            return *this * (R(1) / mag());
     }
 
 
     template <Arithmetic T>
+    template <Precision P>
     constexpr Vector4D<Magnitude<T>> Vector4D<T>::normalize(const Vector4D& vec) noexcept
         requires StrictArithmetic<T>
     {
-        return vec.normalize();
+        return vec.template normalize<P>();
     }
 
 
     template <Arithmetic T>
+    template <Precision P>
     constexpr Vector4D<Magnitude<T>> Vector4D<T>::safeNormalize() const noexcept
         requires StrictArithmetic<T>
     {
         using R = Magnitude<T>;
-        R magnitude = mag();
+        const Vector4D<R> vec(*this);
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<R, R>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::safeNormalize<P>(detail::load(vec), Config::EPSILON_SQUARE<R>));
+        }
+#endif
+        /** @note The squared magnitude is what @ref Config::EPSILON_SQUARE bounds, and skips a square root. */
+        const R lengthSquared = vec.dot(vec);
 
-        if (magnitude <= Config::EPSILON_SQUARE<R>)
+        if (lengthSquared <= Config::EPSILON_SQUARE<R>)
             return fgm::vec4d::zero<R>;
 
-        return *this / magnitude;
+        if constexpr (P == Precision::Exact)
+        {
+            const R length = fgm::sqrt(lengthSquared);
+            return { vec.x / length, vec.y / length, vec.z / length, vec.w / length };
+        }
+        else
+            return vec * fgm::rsqrt(lengthSquared);
     }
 
 
     template <Arithmetic T>
+    template <Precision P>
     constexpr Vector4D<Magnitude<T>> Vector4D<T>::safeNormalize(const Vector4D& vec) noexcept
         requires StrictArithmetic<T>
     {
-        return vec.safeNormalize();
+        return vec.template safeNormalize<P>();
     }
 
 
@@ -640,6 +915,13 @@ namespace fgm
         requires StrictArithmetic<T>
     {
         using R = std::common_type_t<T, U>;
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+                return detail::store(detail::project(detail::load(*this), detail::load(onto), ontoNormalized));
+        }
+#endif
         if (ontoNormalized)
             return this->dot(onto) * onto; // a.dot(b) * b
         /** @note Static cast ensures integral type dots don't lose much precision */
@@ -703,6 +985,16 @@ namespace fgm
         -> Vector4D<Magnitude<std::common_type_t<T, U>>>
         requires StrictArithmetic<T>
     {
+#ifdef FALCON_SIMD_SUPPORTED
+        if constexpr (detail::isSimdFloatVec4<T, U>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const auto vec = detail::load(*this);
+                return detail::store(detail::sub(vec, detail::project(vec, detail::load(from), fromNormalized)));
+            }
+        }
+#endif
         return *this - this->project(from, fromNormalized);
     }
 
@@ -739,3 +1031,5 @@ namespace fgm
     }
 
 } // namespace fgm
+
+#include "Mask4.tpp"
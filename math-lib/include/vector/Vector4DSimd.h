@@ -0,0 +1,954 @@
+#pragma once
+/**
+ * @file Vector4DSimd.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: April 05, 2026
+ *
+ * @brief Register kernels backing the runtime path of @ref fgm::Vector4D.
+ * @details Every kernel is overloaded on the register type, so @ref Vector4D.tpp can stay generic over the component
+ *          type:
+ *          - @ref fgm::vec4 lives in a single `__m128`.
+ *          - @ref fgm::dVec4 lives in a single `__m256d` with AVX and in a pair of `__m128d` with SSE2 only.
+ *          - @ref fgm::lVec4 lives in a single `__m256i` with AVX2 and in a pair of `__m128i` with SSE2 only.
+ *
+ * @note Only included from Vector4D.tpp, once @ref fgm::Vector4D is complete.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4D.h"
+
+#include <cstdint>
+#include <type_traits>
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+namespace fgm::detail
+{
+
+    /*************************************
+     *                                   *
+     *              TRAITS               *
+     *                                   *
+     *************************************/
+
+    /** @brief True if `T` has register kernels for add, subtract, multiply, negate and dot. */
+    template <typename T>
+    inline constexpr bool hasVec4Kernels =
+        std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, long long>;
+
+
+    /** @brief True if an operation between @ref Vector4D<T> and @ref Vector4D<U> can run on registers. */
+    template <typename T, typename U>
+    inline constexpr bool isSimdVec4 = std::is_same_v<T, U> && hasVec4Kernels<T>;
+
+
+    /** @brief True if @ref isSimdVec4 holds and the type also has division, square root and normalization kernels. */
+    template <typename T, typename U>
+    inline constexpr bool isSimdFloatVec4 = isSimdVec4<T, U> && std::is_floating_point_v<T>;
+
+
+    /** @brief True if 64-bit integer lanes can be compared, which needs `pcmpgtq` (SSE4.2) or AVX2. */
+#if defined(FALCON_AVX2_SUPPORTED) || defined(__SSE4_2__)
+    inline constexpr bool hasLong4Compare = true;
+#else
+    inline constexpr bool hasLong4Compare = false;
+#endif
+
+
+    /** @brief True if ordered comparisons between @ref Vector4D<T> and @ref Vector4D<U> can run on registers. */
+    template <typename T, typename U>
+    inline constexpr bool isSimdCompareVec4 =
+        isSimdFloatVec4<T, U> || (isSimdVec4<T, U> && std::is_same_v<T, long long> && hasLong4Compare);
+
+
+
+    /*************************************
+     *                                   *
+     *          REGISTER TYPES           *
+     *                                   *
+     *************************************/
+
+#ifdef FALCON_AVX_SUPPORTED
+    /** @brief Register holding the four lanes of a @ref dVec4. */
+    using Double4 = __m256d;
+#else
+    /** @brief Register pair holding the four lanes of a @ref dVec4, `lo = <x, y>` and `hi = <z, w>`. */
+    struct Double4
+    {
+        __m128d lo;
+        __m128d hi;
+    };
+#endif
+
+
+#ifdef FALCON_AVX2_SUPPORTED
+    /** @brief Register holding the four lanes of a @ref lVec4. */
+    using Long4 = __m256i;
+#else
+    /** @brief Register pair holding the four lanes of a @ref lVec4, `lo = <x, y>` and `hi = <z, w>`. */
+    struct Long4
+    {
+        __m128i lo;
+        __m128i hi;
+    };
+#endif
+
+
+
+    /*************************************
+     *                                   *
+     *           LOAD / STORE            *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Load a vector into its register(s).
+     *
+     * @param[in] vec Vector to load. Always register aligned via @ref SimdTraits.
+     *
+     * @return Register holding `<x, y, z, w>`.
+     */
+    [[nodiscard]] inline __m128 load(const Vector4D<float>& vec) noexcept
+    {
+        return _mm_load_ps(&vec.x);
+    }
+
+
+    /** @copydoc load(const Vector4D<float>&) */
+    [[nodiscard]] inline Double4 load(const Vector4D<double>& vec) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_load_pd(&vec.x);
+#else
+        return { _mm_load_pd(&vec.x), _mm_load_pd(&vec.z) };
+#endif
+    }
+
+
+    /** @copydoc load(const Vector4D<float>&) */
+    [[nodiscard]] inline Long4 load(const Vector4D<long long>& vec) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        return _mm256_load_si256(reinterpret_cast<const __m256i*>(&vec.x));
+#else
+        return { _mm_load_si128(reinterpret_cast<const __m128i*>(&vec.x)),
+                 _mm_load_si128(reinterpret_cast<const __m128i*>(&vec.z)) };
+#endif
+    }
+
+
+    /**
+     * @brief Store register lanes into an existing vector.
+     *
+     * @param[out] dest Vector receiving `<x, y, z, w>`.
+     * @param[in]  reg  Register holding the lanes.
+     */
+    inline void storeInto(Vector4D<float>& dest, const __m128 reg) noexcept
+    {
+        _mm_store_ps(&dest.x, reg);
+    }
+
+
+    /** @copydoc storeInto(Vector4D<float>&, __m128) */
+    inline void storeInto(Vector4D<double>& dest, const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        _mm256_store_pd(&dest.x, reg);
+#else
+        _mm_store_pd(&dest.x, reg.lo);
+        _mm_store_pd(&dest.z, reg.hi);
+#endif
+    }
+
+
+    /** @copydoc storeInto(Vector4D<float>&, __m128) */
+    inline void storeInto(Vector4D<long long>& dest, const Long4 reg) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&dest.x), reg);
+#else
+        _mm_store_si128(reinterpret_cast<__m128i*>(&dest.x), reg.lo);
+        _mm_store_si128(reinterpret_cast<__m128i*>(&dest.z), reg.hi);
+#endif
+    }
+
+
+    /**
+     * @brief Store register lanes into a new vector.
+     *
+     * @param[in] reg Register holding `<x, y, z, w>`.
+     *
+     * @return Vector containing the register lanes.
+     */
+    [[nodiscard]] inline Vector4D<float> store(const __m128 reg) noexcept
+    {
+        Vector4D<float> result;
+        storeInto(result, reg);
+        return result;
+    }
+
+
+    /** @copydoc store(__m128) */
+    [[nodiscard]] inline Vector4D<double> store(const Double4 reg) noexcept
+    {
+        Vector4D<double> result;
+        storeInto(result, reg);
+        return result;
+    }
+
+
+    /** @copydoc store(__m128) */
+    [[nodiscard]] inline Vector4D<long long> store(const Long4 reg) noexcept
+    {
+        Vector4D<long long> result;
+        storeInto(result, reg);
+        return result;
+    }
+
+
+    /**
+     * @brief Broadcast a scalar to every lane.
+     *
+     * @param[in] scalar Value to broadcast.
+     *
+     * @return Register with @p scalar in every lane.
+     */
+    [[nodiscard]] inline __m128 broadcast(const float scalar) noexcept
+    {
+        return _mm_set1_ps(scalar);
+    }
+
+
+    /** @copydoc broadcast(float) */
+    [[nodiscard]] inline Double4 broadcast(const double scalar) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_set1_pd(scalar);
+#else
+        const __m128d lanes = _mm_set1_pd(scalar);
+        return { lanes, lanes };
+#endif
+    }
+
+
+    /** @copydoc broadcast(float) */
+    [[nodiscard]] inline Long4 broadcast(const long long scalar) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        return _mm256_set1_epi64x(scalar);
+#else
+        const __m128i lanes = _mm_set1_epi64x(scalar);
+        return { lanes, lanes };
+#endif
+    }
+
+
+    /**
+     * @brief Extract the first lane.
+     *
+     * @param[in] reg Register to read.
+     *
+     * @return Value of the `x` lane.
+     */
+    [[nodiscard]] inline float first(const __m128 reg) noexcept
+    {
+        return _mm_cvtss_f32(reg);
+    }
+
+
+    /** @copydoc first(__m128) */
+    [[nodiscard]] inline double first(const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm_cvtsd_f64(_mm256_castpd256_pd128(reg));
+#else
+        return _mm_cvtsd_f64(reg.lo);
+#endif
+    }
+
+
+    /** @copydoc first(__m128) */
+    [[nodiscard]] inline long long first(const Long4 reg) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        return _mm_cvtsi128_si64(_mm256_castsi256_si128(reg));
+#else
+        return _mm_cvtsi128_si64(reg.lo);
+#endif
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            ARITHMETIC             *
+     *                                   *
+     *************************************/
+
+    /** @brief Lane-wise $ \mathbf{a} + \mathbf{b} $. */
+    [[nodiscard]] inline __m128 add(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_add_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc add(__m128, __m128) */
+    [[nodiscard]] inline Double4 add(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_add_pd(lhs, rhs);
+#else
+        return { _mm_add_pd(lhs.lo, rhs.lo), _mm_add_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @copydoc add(__m128, __m128) */
+    [[nodiscard]] inline Long4 add(const Long4 lhs, const Long4 rhs) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        return _mm256_add_epi64(lhs, rhs);
+#else
+        return { _mm_add_epi64(lhs.lo, rhs.lo), _mm_add_epi64(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise $ \mathbf{a} - \mathbf{b} $. */
+    [[nodiscard]] inline __m128 sub(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_sub_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc sub(__m128, __m128) */
+    [[nodiscard]] inline Double4 sub(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_sub_pd(lhs, rhs);
+#else
+        return { _mm_sub_pd(lhs.lo, rhs.lo), _mm_sub_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @copydoc sub(__m128, __m128) */
+    [[nodiscard]] inline Long4 sub(const Long4 lhs, const Long4 rhs) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        return _mm256_sub_epi64(lhs, rhs);
+#else
+        return { _mm_sub_epi64(lhs.lo, rhs.lo), _mm_sub_epi64(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise $ \mathbf{a} \odot \mathbf{b} $. */
+    [[nodiscard]] inline __m128 mul(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_mul_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc mul(__m128, __m128) */
+    [[nodiscard]] inline Double4 mul(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_mul_pd(lhs, rhs);
+#else
+        return { _mm_mul_pd(lhs.lo, rhs.lo), _mm_mul_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /**
+     * @copydoc mul(__m128, __m128)
+     * @note There is no 64-bit `mullo` below AVX-512DQ, so the low 64 bits of the product are assembled from three
+     *       32x32 multiplies: $ a_{lo} b_{lo} + ((a_{hi} b_{lo} + a_{lo} b_{hi}) \ll 32) $. Wraps like the scalar path.
+     */
+    [[nodiscard]] inline Long4 mul(const Long4 lhs, const Long4 rhs) noexcept
+    {
+#ifdef FALCON_AVX2_SUPPORTED
+        const __m256i low = _mm256_mul_epu32(lhs, rhs);
+        const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhs),
+                                               _mm256_mul_epu32(lhs, _mm256_srli_epi64(rhs, 32)));
+        return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+#else
+        const auto mullo = [](const __m128i a, const __m128i b)
+        {
+            const __m128i low = _mm_mul_epu32(a, b);
+            const __m128i cross =
+                _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+            return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+        };
+        return { mullo(lhs.lo, rhs.lo), mullo(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise $ \mathbf{a} \oslash \mathbf{b} $. */
+    [[nodiscard]] inline __m128 div(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_div_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc div(__m128, __m128) */
+    [[nodiscard]] inline Double4 div(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_div_pd(lhs, rhs);
+#else
+        return { _mm_div_pd(lhs.lo, rhs.lo), _mm_div_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise `lhs < rhs ? lhs : rhs`, @p rhs where either lane is `NaN`. */
+    [[nodiscard]] inline __m128 min(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_min_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc min(__m128, __m128) */
+    [[nodiscard]] inline Double4 min(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_min_pd(lhs, rhs);
+#else
+        return { _mm_min_pd(lhs.lo, rhs.lo), _mm_min_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise `lhs > rhs ? lhs : rhs`, @p rhs where either lane is `NaN`. */
+    [[nodiscard]] inline __m128 max(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        return _mm_max_ps(lhs, rhs);
+    }
+
+
+    /** @copydoc max(__m128, __m128) */
+    [[nodiscard]] inline Double4 max(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_max_pd(lhs, rhs);
+#else
+        return { _mm_max_pd(lhs.lo, rhs.lo), _mm_max_pd(lhs.hi, rhs.hi) };
+#endif
+    }
+
+
+    /** @brief Lane-wise $ -\mathbf{a} $. Floating point lanes flip the sign bit so `-0` and `NaN` match scalar. */
+    [[nodiscard]] inline __m128 negate(const __m128 reg) noexcept
+    {
+        return _mm_xor_ps(reg, _mm_set1_ps(-0.0f));
+    }
+
+
+    /** @copydoc negate(__m128) */
+    [[nodiscard]] inline Double4 negate(const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_xor_pd(reg, _mm256_set1_pd(-0.0));
+#else
+        const __m128d sign = _mm_set1_pd(-0.0);
+        return { _mm_xor_pd(reg.lo, sign), _mm_xor_pd(reg.hi, sign) };
+#endif
+    }
+
+
+    /** @copydoc negate(__m128) */
+    [[nodiscard]] inline Long4 negate(const Long4 reg) noexcept
+    {
+        return sub(broadcast(0LL), reg);
+    }
+
+
+    /** @brief Lane-wise $ \sqrt{\mathbf{a}} $. */
+    [[nodiscard]] inline __m128 sqrt(const __m128 reg) noexcept
+    {
+        return _mm_sqrt_ps(reg);
+    }
+
+
+    /** @copydoc sqrt(__m128) */
+    [[nodiscard]] inline Double4 sqrt(const Double4 reg) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_sqrt_pd(reg);
+#else
+        return { _mm_sqrt_pd(reg.lo), _mm_sqrt_pd(reg.hi) };
+#endif
+    }
+
+
+    /**
+     * @brief Lane-wise $ 1 / \sqrt{\mathbf{a}} $ to the accuracy of @p P.
+     * @details @ref Precision::Fast returns the `rsqrtps` estimate (`rsqrt14ps` with AVX-512VL) and
+     *          @ref Precision::Refined adds one Newton-Raphson step, $ y' = y (1.5 - 0.5 a y^2) $.
+     *          @ref Precision::Exact divides one by the correctly rounded square root.
+     */
+    template <Precision P>
+    [[nodiscard]] __m128 rsqrt(const __m128 reg) noexcept
+    {
+        if constexpr (P == Precision::Exact)
+            return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(reg));
+        else
+        {
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512VL__)
+            const __m128 estimate = _mm_rsqrt14_ps(reg);
+#else
+            const __m128 estimate = _mm_rsqrt_ps(reg);
+#endif
+            if constexpr (P == Precision::Fast)
+                return estimate;
+            else
+            {
+                const __m128 halfSquare = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), reg), estimate);
+                const __m128 step = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfSquare, estimate));
+                return _mm_mul_ps(estimate, step);
+            }
+        }
+    }
+
+
+    /**
+     * @copybrief rsqrt(__m128)
+     * @details There is no `double` estimate below AVX-512, so every tier divides one by the correctly rounded square
+     *          root.
+     */
+    template <Precision P>
+    [[nodiscard]] Double4 rsqrt(const Double4 reg) noexcept
+    {
+        return div(broadcast(1.0), sqrt(reg));
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             SWIZZLES              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Rearrange the lanes of a register.
+     *
+     * @tparam X Source lane of the first lane.
+     * @tparam Y Source lane of the second lane.
+     * @tparam Z Source lane of the third lane.
+     * @tparam W Source lane of the fourth lane.
+     *
+     * @param[in] reg Register to rearrange.
+     *
+     * @return Register holding `<reg[X], reg[Y], reg[Z], reg[W]>`.
+     */
+    template <int X, int Y, int Z, int W>
+    [[nodiscard]] __m128 shuffle(const __m128 reg) noexcept
+    {
+        return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+
+    /** @brief Pick lanes @p First and @p Second of the four lanes split across @p lo and @p hi. */
+    template <int First, int Second>
+    [[nodiscard]] __m128d shufflePair(const __m128d lo, const __m128d hi) noexcept
+    {
+        return _mm_shuffle_pd(First < 2 ? lo : hi, Second < 2 ? lo : hi, (First & 1) | (Second & 1) << 1);
+    }
+
+
+    /** @copydoc shuffle(__m128) */
+    template <int X, int Y, int Z, int W>
+    [[nodiscard]] Double4 shuffle(const Double4 reg) noexcept
+    {
+#if defined(FALCON_AVX2_SUPPORTED)
+        return _mm256_permute4x64_pd(reg, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(FALCON_AVX_SUPPORTED)
+        const __m128d lo = _mm256_castpd256_pd128(reg);
+        const __m128d hi = _mm256_extractf128_pd(reg, 1);
+        const __m128d lower = shufflePair<X, Y>(lo, hi);
+        const __m128d upper = shufflePair<Z, W>(lo, hi);
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(lower), upper, 1);
+#else
+        return { shufflePair<X, Y>(reg.lo, reg.hi), shufflePair<Z, W>(reg.lo, reg.hi) };
+#endif
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            REDUCTIONS             *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Compute the dot product of two registers and broadcast it to all four lanes.
+     *
+     * @param[in] lhs First operand.
+     * @param[in] rhs Second operand.
+     *
+     * @return Register with $ \mathbf{a} \cdot \mathbf{b} $ in every lane.
+     */
+    [[nodiscard]] inline __m128 dot(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        const __m128 product = _mm_mul_ps(lhs, rhs);
+        const __m128 pairs = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+
+    /** @copydoc dot(__m128, __m128) */
+    [[nodiscard]] inline Double4 dot(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        const __m256d product = _mm256_mul_pd(lhs, rhs);
+        const __m256d pairs = _mm256_hadd_pd(product, product); // <x+y, x+y, z+w, z+w>
+        return _mm256_add_pd(pairs, _mm256_permute2f128_pd(pairs, pairs, 0x01));
+#else
+        // Pair x with y and z with w, so the sum rounds as the AVX and float paths do.
+        const __m128d lo = _mm_mul_pd(lhs.lo, rhs.lo);
+        const __m128d hi = _mm_mul_pd(lhs.hi, rhs.hi);
+        const __m128d pairs = _mm_add_pd(_mm_unpacklo_pd(lo, hi), _mm_unpackhi_pd(lo, hi)); // <x+y, z+w>
+        const __m128d sum = _mm_add_pd(pairs, _mm_shuffle_pd(pairs, pairs, 0x01));
+        return { sum, sum };
+#endif
+    }
+
+
+    /** @copydoc dot(__m128, __m128) */
+    [[nodiscard]] inline Long4 dot(const Long4 lhs, const Long4 rhs) noexcept
+    {
+        const Long4 product = mul(lhs, rhs);
+#ifdef FALCON_AVX2_SUPPORTED
+        const __m256i halves = _mm256_add_epi64(product, _mm256_permute4x64_epi64(product, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm256_add_epi64(halves, _mm256_shuffle_epi32(halves, _MM_SHUFFLE(1, 0, 3, 2)));
+#else
+        const __m128i halves = _mm_add_epi64(product.lo, product.hi);
+        const __m128i sum = _mm_add_epi64(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(1, 0, 3, 2)));
+        return { sum, sum };
+#endif
+    }
+
+
+    /**
+     * @brief Dot product of the `x`, `y` and `z` lanes of two registers, ignoring `w`.
+     * @details Sums `x`, then `y`, then `z` like the scalar @ref Vector3D::dot, so both paths round alike.
+     *
+     * @return Register with $ \mathbf{a}_{xyz} \cdot \mathbf{b}_{xyz} $ in every lane.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg dot3(const Reg lhs, const Reg rhs) noexcept
+    {
+        const Reg product = mul(lhs, rhs);
+        return add(add(shuffle<0, 0, 0, 0>(product), shuffle<1, 1, 1, 1>(product)), shuffle<2, 2, 2, 2>(product));
+    }
+
+
+    /**
+     * @brief Cross product of the `x`, `y` and `z` lanes of two registers.
+     *
+     * @return Register holding `lhs.xyz x rhs.xyz`, with `0` in the `w` lane for finite inputs.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg cross(const Reg lhs, const Reg rhs) noexcept
+    {
+        return sub(mul(shuffle<1, 2, 0, 3>(lhs), shuffle<2, 0, 1, 3>(rhs)),
+                   mul(shuffle<2, 0, 1, 3>(lhs), shuffle<1, 2, 0, 3>(rhs)));
+    }
+
+
+    /**
+     * @brief Scale a register to unit length given its squared magnitude.
+     *
+     * @tparam P @ref Precision::Exact divides by the square root, the other tiers multiply by @ref rsqrt.
+     *
+     * @param[in] reg           Register to normalize.
+     * @param[in] lengthSquared $ \mathbf{a} \cdot \mathbf{a} $ in every lane.
+     *
+     * @return Unit length register.
+     */
+    template <Precision P, typename Reg>
+    [[nodiscard]] Reg toUnit(const Reg reg, const Reg lengthSquared) noexcept
+    {
+        if constexpr (P == Precision::Exact)
+            return div(reg, sqrt(lengthSquared));
+        else
+            return mul(reg, rsqrt<P>(lengthSquared));
+    }
+
+
+    /**
+     * @brief Normalize a register, scaling every lane by $ 1 / \|\mathbf{a}\| $.
+     *
+     * @tparam P Accuracy of the reciprocal magnitude.
+     *
+     * @param[in] reg Register to normalize.
+     *
+     * @return Unit length register, or `NaN`/`Inf` lanes for a zero vector, matching the scalar path.
+     */
+    template <Precision P, typename Reg>
+    [[nodiscard]] Reg normalize(const Reg reg) noexcept
+    {
+        return toUnit<P>(reg, dot(reg, reg));
+    }
+
+
+    /**
+     * @brief Project @p vec onto @p onto entirely in registers.
+     *
+     * @param[in] vec            Vector to project.
+     * @param[in] onto           Vector to project onto.
+     * @param[in] ontoNormalized Skip the division by $ \|\mathbf{b}\|^2 $ when @p onto is a unit vector.
+     *
+     * @return Register holding the projected vector.
+     */
+    template <typename Reg>
+    [[nodiscard]] Reg project(const Reg vec, const Reg onto, const bool ontoNormalized) noexcept
+    {
+        Reg scale = dot(vec, onto);
+        if (!ontoNormalized)
+            scale = div(scale, dot(onto, onto));
+        return mul(scale, onto);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *            COMPARISONS            *
+     *                                   *
+     *************************************/
+
+    /** @brief Lane predicates supported by @ref compare. Floating point predicates are ordered: `NaN` is false. */
+    enum class Compare
+    {
+        Greater,
+        GreaterEqual,
+        Less,
+        LessEqual,
+        Equal
+    };
+
+
+    /**
+     * @brief Compare two registers lane by lane.
+     *
+     * @tparam Op Predicate to evaluate.
+     *
+     * @param[in] lhs First operand.
+     * @param[in] rhs Second operand.
+     *
+     * @return Bitmask with bit `i` set when the predicate holds for lane `i`.
+     */
+    template <Compare Op>
+    [[nodiscard]] int compare(const __m128 lhs, const __m128 rhs) noexcept
+    {
+        if constexpr (Op == Compare::Greater)
+            return _mm_movemask_ps(_mm_cmpgt_ps(lhs, rhs));
+        else if constexpr (Op == Compare::GreaterEqual)
+            return _mm_movemask_ps(_mm_cmpge_ps(lhs, rhs));
+        else if constexpr (Op == Compare::Less)
+            return _mm_movemask_ps(_mm_cmplt_ps(lhs, rhs));
+        else if constexpr (Op == Compare::LessEqual)
+            return _mm_movemask_ps(_mm_cmple_ps(lhs, rhs));
+        else
+            return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs));
+    }
+
+
+    /** @copydoc compare(__m128, __m128) */
+    template <Compare Op>
+    [[nodiscard]] int compare(const Double4 lhs, const Double4 rhs) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        if constexpr (Op == Compare::Greater)
+            return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ));
+        else if constexpr (Op == Compare::GreaterEqual)
+            return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ));
+        else if constexpr (Op == Compare::Less)
+            return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ));
+        else if constexpr (Op == Compare::LessEqual)
+            return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ));
+        else
+            return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ));
+#else
+        const auto half = [](const __m128d a, const __m128d b)
+        {
+            if constexpr (Op == Compare::Greater)
+                return _mm_movemask_pd(_mm_cmpgt_pd(a, b));
+            else if constexpr (Op == Compare::GreaterEqual)
+                return _mm_movemask_pd(_mm_cmpge_pd(a, b));
+            else if constexpr (Op == Compare::Less)
+                return _mm_movemask_pd(_mm_cmplt_pd(a, b));
+            else if constexpr (Op == Compare::LessEqual)
+                return _mm_movemask_pd(_mm_cmple_pd(a, b));
+            else
+                return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+        };
+        return half(lhs.lo, rhs.lo) | (half(lhs.hi, rhs.hi) << 2);
+#endif
+    }
+
+
+#if defined(FALCON_AVX2_SUPPORTED) || defined(__SSE4_2__) // See hasLong4Compare
+    /**
+     * @copydoc compare(__m128, __m128)
+     * @note Integers only have `==` and `>`; the remaining predicates are derived by swapping and inverting.
+     */
+    template <Compare Op>
+    [[nodiscard]] int compare(const Long4 lhs, const Long4 rhs) noexcept
+    {
+        const auto greater = [](const Long4 a, const Long4 b)
+        {
+    #ifdef FALCON_AVX2_SUPPORTED
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+    #else
+            return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(a.lo, b.lo))) |
+                (_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(a.hi, b.hi))) << 2);
+    #endif
+        };
+
+        if constexpr (Op == Compare::Greater)
+            return greater(lhs, rhs);
+        else if constexpr (Op == Compare::GreaterEqual)
+            return ~greater(rhs, lhs) & 0xF;
+        else if constexpr (Op == Compare::Less)
+            return greater(rhs, lhs);
+        else if constexpr (Op == Compare::LessEqual)
+            return ~greater(lhs, rhs) & 0xF;
+        else
+        {
+    #ifdef FALCON_AVX2_SUPPORTED
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lhs, rhs)));
+    #else
+            return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(lhs.lo, rhs.lo))) |
+                (_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(lhs.hi, rhs.hi))) << 2);
+    #endif
+        }
+    }
+#endif
+
+
+    /**
+     * @brief Compare two registers for equality within a tolerance, lane by lane.
+     * @details A lane matches when `lhs == rhs` or `|lhs - rhs| <= epsilon`. The exact comparison covers equal
+     *          infinities, whose difference is NaN; NaN lanes fail both ordered comparisons and never match.
+     *
+     * @param[in] lhs     First register.
+     * @param[in] rhs     Second register.
+     * @param[in] epsilon Largest difference still treated as equal.
+     *
+     * @return Bitmask in the layout of @ref compare.
+     */
+    [[nodiscard]] inline int equal(const __m128 lhs, const __m128 rhs, const float epsilon) noexcept
+    {
+        const __m128 difference = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(lhs, rhs)); // Clear the sign bit
+        return _mm_movemask_ps(_mm_or_ps(_mm_cmpeq_ps(lhs, rhs), _mm_cmple_ps(difference, _mm_set1_ps(epsilon))));
+    }
+
+
+    /** @copydoc equal(__m128, __m128, float) */
+    [[nodiscard]] inline int equal(const Double4 lhs, const Double4 rhs, const double epsilon) noexcept
+    {
+#ifdef FALCON_AVX_SUPPORTED
+        const __m256d difference = _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(lhs, rhs));
+        return _mm256_movemask_pd(_mm256_or_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ),
+                                               _mm256_cmp_pd(difference, _mm256_set1_pd(epsilon), _CMP_LE_OQ)));
+#else
+        const auto half = [epsilon](const __m128d a, const __m128d b)
+        {
+            const __m128d difference = _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(a, b));
+            return _mm_movemask_pd(_mm_or_pd(_mm_cmpeq_pd(a, b), _mm_cmple_pd(difference, _mm_set1_pd(epsilon))));
+        };
+        return half(lhs.lo, rhs.lo) | (half(lhs.hi, rhs.hi) << 2);
+#endif
+    }
+
+
+    /**
+     * @brief Blend two registers lane by lane.
+     *
+     * @param[in] mask    Bitmask in the layout returned by @ref compare; bit `i` selects lane `i` of @p onTrue.
+     * @param[in] onTrue  Register supplying the set lanes.
+     * @param[in] onFalse Register supplying the cleared lanes.
+     *
+     * @return Register with lane `i` taken from @p onTrue if bit `i` of @p mask is set, otherwise from @p onFalse.
+     */
+    [[nodiscard]] inline __m128 select(const int mask, const __m128 onTrue, const __m128 onFalse) noexcept
+    {
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512VL__)
+        return _mm_mask_blend_ps(static_cast<__mmask8>(mask), onFalse, onTrue);
+#else
+        const __m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+        const __m128 blend = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(mask), lanes), lanes));
+        return _mm_or_ps(_mm_and_ps(blend, onTrue), _mm_andnot_ps(blend, onFalse));
+#endif
+    }
+
+
+    /** @copydoc select(int, __m128, __m128) */
+    [[nodiscard]] inline Double4 select(const int mask, const Double4 onTrue, const Double4 onFalse) noexcept
+    {
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512VL__)
+        return _mm256_mask_blend_pd(static_cast<__mmask8>(mask), onFalse, onTrue);
+#elif defined(FALCON_AVX_SUPPORTED)
+        // blendv only reads the sign bit of each lane, so shifting bit `i` into bit 63 of lane `i` is enough.
+        const __m256d blend = _mm256_castsi256_pd(_mm256_setr_epi64x(
+            std::int64_t(mask) << 63, std::int64_t(mask) << 62, std::int64_t(mask) << 61, std::int64_t(mask) << 60));
+        return _mm256_blendv_pd(onFalse, onTrue, blend);
+#else
+        const auto half = [](const int bits, const __m128d a, const __m128d b)
+        {
+            // Compare the low dword of each lane, then copy it over the high one.
+            const __m128i lanes = _mm_set_epi64x(2, 1);
+            const __m128i lowHit = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi64x(bits), lanes), lanes);
+            const __m128d blend = _mm_castsi128_pd(_mm_shuffle_epi32(lowHit, _MM_SHUFFLE(2, 2, 0, 0)));
+            return _mm_or_pd(_mm_and_pd(blend, a), _mm_andnot_pd(blend, b));
+        };
+        return { half(mask, onTrue.lo, onFalse.lo), half(mask >> 2, onTrue.hi, onFalse.hi) };
+#endif
+    }
+
+
+
+    /**
+     * @brief Normalize a register, zeroing the result when $ \|\mathbf{a}\|^2 \le $ @p epsilonSquare.
+     *
+     * @tparam P Accuracy of the reciprocal magnitude.
+     *
+     * @param[in] reg           Register to normalize.
+     * @param[in] epsilonSquare Squared magnitude at or below which the vector is treated as zero.
+     *
+     * @return Unit length register or the zero vector.
+     */
+    template <Precision P>
+    [[nodiscard]] __m128 safeNormalize(const __m128 reg, const float epsilonSquare) noexcept
+    {
+        const __m128 lengthSquared = dot(reg, reg);
+        const __m128 isZero = _mm_cmple_ps(lengthSquared, _mm_set1_ps(epsilonSquare));
+        return _mm_andnot_ps(isZero, toUnit<P>(reg, lengthSquared));
+    }
+
+
+    /** @copydoc safeNormalize(__m128, float) */
+    template <Precision P>
+    [[nodiscard]] Double4 safeNormalize(const Double4 reg, const double epsilonSquare) noexcept
+    {
+        const Double4 lengthSquared = dot(reg, reg);
+        const Double4 unit = toUnit<P>(reg, lengthSquared);
+#ifdef FALCON_AVX_SUPPORTED
+        return _mm256_andnot_pd(_mm256_cmp_pd(lengthSquared, _mm256_set1_pd(epsilonSquare), _CMP_LE_OQ), unit);
+#else
+        const __m128d isZero = _mm_cmple_pd(lengthSquared.lo, _mm_set1_pd(epsilonSquare)); // Both halves hold it
+        return { _mm_andnot_pd(isZero, unit.lo), _mm_andnot_pd(isZero, unit.hi) };
+#endif
+    }
+
+} // namespace fgm::detail
+#endif
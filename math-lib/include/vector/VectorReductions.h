@@ -0,0 +1,228 @@
+#pragma once
+/**
+ * @file VectorReductions.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Reduce whole buffers of vectors to bounds, sums, means and nearest or farthest elements.
+ *
+ * @details Every reduction takes packed spans of @ref fgm::Vector2D, @ref fgm::Vector3D or @ref fgm::Vector4D, and
+ *          has a @ref fgm::Vec4Array overload running on the reduce kernels bound by
+ *          @ref falcon::simd::batchKernels.
+ *          - Sums keep four independent running sums, so the adds of neighbouring elements do not wait on each
+ *            other, and accumulate as selected by @ref fgm::ReduceOptions::summation.
+ *          - Inputs larger than @ref fgm::parallel::ChunkOptions::parallelThreshold are split with
+ *            @ref fgm::parallel::reduce_chunks, one partial result per chunk folded in a balanced tree.
+ *            Chunking defaults to @ref fgm::parallel::ChunkMode::Deterministic, so a result does not depend on the
+ *            thread count.
+ *          - NaN components are skipped by @ref fgm::bounds, and vectors at a NaN distance by
+ *            @ref fgm::distanceExtremes.
+ *
+ * @note Components must be floating point. Operations over two spans or arrays require equal sizes; this is checked
+ *       with `assert`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vec4Array.h"
+#include "Vector2D.h"
+#include "Vector3D.h"
+#include "Vector4D.h"
+#include "common/Config.h"
+#include "parallel/Parallel.h"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+
+namespace fgm
+{
+    /**
+     * @addtogroup FGM_Vec_Reduce
+     * @{
+     */
+
+    namespace detail
+    {
+        /** @brief Component type and count of the vectors the reductions accept. */
+        template <typename V>
+        struct ReductionTraits;
+
+        template <typename T>
+        struct ReductionTraits<Vector2D<T>>
+        {
+            using component_type = T;
+            static constexpr std::size_t dimension = 2;
+        };
+
+        template <typename T>
+        struct ReductionTraits<Vector3D<T>>
+        {
+            using component_type = T;
+            static constexpr std::size_t dimension = 3;
+        };
+
+        template <typename T>
+        struct ReductionTraits<Vector4D<T>>
+        {
+            using component_type = T;
+            static constexpr std::size_t dimension = 4;
+        };
+    } // namespace detail
+
+
+    /** @brief A @ref Vector2D, @ref Vector3D or @ref Vector4D with floating point components. */
+    template <typename V>
+    concept ReducibleVector = std::floating_point<typename detail::ReductionTraits<V>::component_type>;
+
+
+    /** @brief Component type of the reducible vector `V`. */
+    template <ReducibleVector V>
+    using ComponentOf = typename detail::ReductionTraits<V>::component_type;
+
+
+    /** @brief Tuning of the reductions. */
+    struct ReduceOptions
+    {
+        /** @brief Accumulation of sums; see @ref falcon::simd::Summation. */
+        Summation summation = Summation::Plain;
+
+        /** @brief Chunking of large inputs, deterministic so results do not depend on the thread count. */
+        parallel::ChunkOptions chunking = { parallel::ChunkMode::Deterministic };
+    };
+
+
+    /**
+     * @brief Component-wise extremes of a set of vectors, an axis-aligned bounding box for positions.
+     * @details The bounds of an empty set are inverted, `min` at `+infinity` and `max` at `-infinity`, so merging them
+     *          with any other bounds leaves those unchanged.
+     */
+    template <typename V>
+    struct Bounds
+    {
+        V min; ///< Smallest value of every component.
+        V max; ///< Largest value of every component.
+    };
+
+
+    /** @brief Indices of the vectors nearest to and farthest from a point. */
+    struct DistanceExtremes
+    {
+        std::size_t nearest;  ///< Lowest index at the smallest distance, or the element count if there is none.
+        std::size_t farthest; ///< Lowest index at the largest distance, or the element count if there is none.
+    };
+
+
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Component-wise minimum and maximum of @p vectors.
+     *
+     * @param[in] vectors Vectors to bound. NaN components are skipped.
+     * @param[in] options Chunking; the summation mode is unused.
+     *
+     * @return Inverted bounds for an empty span, see @ref Bounds.
+     */
+    template <ReducibleVector V>
+    [[nodiscard]] Bounds<V> bounds(std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options = {});
+
+
+    /** @brief Component-wise sum of @p vectors, the zero vector for an empty span. */
+    template <ReducibleVector V>
+    [[nodiscard]] V sum(std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options = {});
+
+
+    /**
+     * @brief Centroid of @p vectors, their @ref sum divided by their count.
+     *
+     * @param[in] vectors At least one vector.
+     * @param[in] options Summation and chunking.
+     */
+    template <ReducibleVector V>
+    [[nodiscard]] V mean(std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options = {});
+
+
+    /**
+     * @brief Sum of `lhs[i].dot(rhs[i])`. Pass the same span twice for the sum of squared magnitudes.
+     *
+     * @param[in] lhs     First operands.
+     * @param[in] rhs     Second operands, as many as @p lhs.
+     * @param[in] options Summation and chunking.
+     */
+    template <ReducibleVector V>
+    [[nodiscard]] ComponentOf<V> sumDot(std::type_identity_t<std::span<const V>> lhs,
+                                        std::type_identity_t<std::span<const V>> rhs,
+                                        const ReduceOptions& options = {});
+
+
+    /** @brief Sum of `vectors[i].mag()`, such as the length of a polyline given its segments. */
+    template <ReducibleVector V>
+    [[nodiscard]] ComponentOf<V> sumMag(std::type_identity_t<std::span<const V>> vectors,
+                                        const ReduceOptions& options = {});
+
+
+    /**
+     * @brief Indices of the vectors nearest to and farthest from @p point, compared by squared distance.
+     *
+     * @param[in] vectors Candidates. Vectors at a NaN distance are skipped.
+     * @param[in] point   Reference point.
+     * @param[in] options Chunking; the summation mode is unused.
+     *
+     * @return `vectors.size()` for both indices when there is no candidate.
+     */
+    template <ReducibleVector V>
+    [[nodiscard]] DistanceExtremes distanceExtremes(std::type_identity_t<std::span<const V>> vectors,
+                                                    const std::type_identity_t<V>& point,
+                                                    const ReduceOptions& options = {});
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    /** @brief @ref bounds of every vector of @p vectors, one stream at a time. */
+    template <BatchArithmetic T>
+    [[nodiscard]] Bounds<Vector4D<T>> bounds(const Vec4Array<T>& vectors, const ReduceOptions& options = {});
+
+
+    /** @brief @ref sum of every vector of @p vectors, one stream at a time. */
+    template <BatchArithmetic T>
+    [[nodiscard]] Vector4D<T> sum(const Vec4Array<T>& vectors, const ReduceOptions& options = {});
+
+
+    /** @brief @ref mean of the non-empty @p vectors. */
+    template <BatchArithmetic T>
+    [[nodiscard]] Vector4D<T> mean(const Vec4Array<T>& vectors, const ReduceOptions& options = {});
+
+
+    /** @brief @ref sumDot of the vectors of two arrays of equal size. */
+    template <BatchArithmetic T>
+    [[nodiscard]] T sumDot(const Vec4Array<T>& lhs, const Vec4Array<T>& rhs, const ReduceOptions& options = {});
+
+
+    /** @brief @ref sumMag of the vectors of @p vectors. */
+    template <BatchArithmetic T>
+    [[nodiscard]] T sumMag(const Vec4Array<T>& vectors, const ReduceOptions& options = {});
+
+
+    /** @brief @ref distanceExtremes of the vectors of @p vectors from @p point. */
+    template <BatchArithmetic T>
+    [[nodiscard]] DistanceExtremes distanceExtremes(const Vec4Array<T>& vectors,
+                                                    const std::type_identity_t<Vector4D<T>>& point,
+                                                    const ReduceOptions& options = {});
+
+    /** @} */
+
+} // namespace fgm
+
+#include "VectorReductions.tpp"
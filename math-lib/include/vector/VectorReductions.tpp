@@ -0,0 +1,415 @@
+#pragma once
+/**
+ * @file VectorReductions.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Implementation of the vector reductions.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "VectorReductions.h"
+
+#include <Dispatch.h>
+#include <cassert>
+#include <limits>
+
+
+namespace fgm
+{
+    namespace detail
+    {
+        /** @brief Independent running sums of the packed reductions. */
+        inline constexpr std::size_t reduceAccumulators = 4;
+
+        /** @brief Terms summed plainly per leaf of @ref pairwiseSum. */
+        inline constexpr std::size_t pairwiseLeafTerms = 128;
+
+
+        /**
+         * @brief Sum `term(i)` over `[begin, end)` in @ref reduceAccumulators running sums.
+         *
+         * @tparam R Result type, a vector or a component, value-initialized to zero.
+         */
+        template <typename R, typename Term>
+        [[nodiscard]] R plainSum(const std::size_t begin, const std::size_t end, const Term& term)
+        {
+            R sums[reduceAccumulators] = {};
+
+            std::size_t i = begin;
+            for (; end - i >= reduceAccumulators; i += reduceAccumulators)
+                for (std::size_t k = 0; k < reduceAccumulators; ++k)
+                    sums[k] += term(i + k);
+            for (std::size_t k = 0; i < end; ++i, ++k)
+                sums[k] += term(i);
+
+            return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+        }
+
+
+        /** @brief As @ref plainSum, halving the range down to leaves of @ref pairwiseLeafTerms terms. */
+        template <typename R, typename Term>
+        [[nodiscard]] R pairwiseSum(const std::size_t begin, const std::size_t end, const Term& term)
+        {
+            if (end - begin <= pairwiseLeafTerms)
+                return plainSum<R>(begin, end, term);
+
+            const std::size_t middle = begin + (end - begin) / 2;
+            return pairwiseSum<R>(begin, middle, term) + pairwiseSum<R>(middle, end, term);
+        }
+
+
+        /** @brief As @ref plainSum, with a Kahan compensation per running sum and in their final fold. */
+        template <typename R, typename Term>
+        [[nodiscard]] R compensatedSum(const std::size_t begin, const std::size_t end, const Term& term)
+        {
+            R sums[reduceAccumulators] = {};
+            R carries[reduceAccumulators] = {};
+            const auto add = [&](const std::size_t k, const R& value)
+            {
+                const R corrected = value - carries[k];
+                const R total = sums[k] + corrected;
+                carries[k] = (total - sums[k]) - corrected;
+                sums[k] = total;
+            };
+
+            std::size_t i = begin;
+            for (; end - i >= reduceAccumulators; i += reduceAccumulators)
+                for (std::size_t k = 0; k < reduceAccumulators; ++k)
+                    add(k, term(i + k));
+            for (std::size_t k = 0; i < end; ++i, ++k)
+                add(k, term(i));
+
+            for (std::size_t k = 1; k < reduceAccumulators; ++k)
+            {
+                add(0, sums[k]);
+                add(0, R{} - carries[k]);
+            }
+            return sums[0] - carries[0];
+        }
+
+
+        /** @brief Sum `term(i)` over `[0, count)` with the accumulation selected by @p summation. */
+        template <typename R, typename Term>
+        [[nodiscard]] R sumTerms(const Summation summation, const std::size_t count, const Term& term)
+        {
+            switch (summation)
+            {
+                case Summation::Pairwise:
+                    return pairwiseSum<R>(0, count, term);
+                case Summation::Compensated:
+                    return compensatedSum<R>(0, count, term);
+                case Summation::Plain:
+                default:
+                    return plainSum<R>(0, count, term);
+            }
+        }
+
+
+        /** @brief Fold of two partial sums. */
+        inline constexpr auto addPartials = [](const auto& lower, const auto& upper) { return lower + upper; };
+
+
+        /** @brief @ref Bounds of nothing, every component of `min` at `+infinity` and of `max` at `-infinity`. */
+        template <ReducibleVector V>
+        [[nodiscard]] Bounds<V> emptyBounds() noexcept
+        {
+            constexpr ComponentOf<V> infinity = std::numeric_limits<ComponentOf<V>>::infinity();
+            Bounds<V> result;
+            for (std::size_t c = 0; c < ReductionTraits<V>::dimension; ++c)
+            {
+                result.min[c] = infinity;
+                result.max[c] = -infinity;
+            }
+            return result;
+        }
+
+
+        /** @brief Widen @p bounds to @p value component by component, comparing the new value first to skip NaN. */
+        template <ReducibleVector V>
+        void expandBounds(Bounds<V>& bounds, const V& value) noexcept
+        {
+            for (std::size_t c = 0; c < ReductionTraits<V>::dimension; ++c)
+            {
+                bounds.min[c] = value[c] < bounds.min[c] ? value[c] : bounds.min[c];
+                bounds.max[c] = value[c] > bounds.max[c] ? value[c] : bounds.max[c];
+            }
+        }
+
+
+        /** @brief Component-wise union of two bounds. */
+        template <ReducibleVector V>
+        [[nodiscard]] Bounds<V> mergeBounds(Bounds<V> lower, const Bounds<V>& upper) noexcept
+        {
+            expandBounds(lower, upper.min);
+            expandBounds(lower, upper.max);
+            return lower;
+        }
+
+
+        /** @brief Nearest and farthest candidates of one chunk with their squared distances. */
+        template <typename T>
+        struct DistancePartial
+        {
+            T nearestDistance = std::numeric_limits<T>::infinity();
+            std::size_t nearest = std::numeric_limits<std::size_t>::max();
+            T farthestDistance = -std::numeric_limits<T>::infinity();
+            std::size_t farthest = std::numeric_limits<std::size_t>::max();
+
+            /** @brief Take candidate @p index at squared distance @p distance where it is strictly better. */
+            void offer(const std::size_t index, const T distance) noexcept
+            {
+                if (distance < nearestDistance)
+                {
+                    nearestDistance = distance;
+                    nearest = index;
+                }
+                if (distance > farthestDistance)
+                {
+                    farthestDistance = distance;
+                    farthest = index;
+                }
+            }
+
+            /** @brief Fold of two chunks, the lower one winning ties. */
+            [[nodiscard]] static DistancePartial merge(DistancePartial lower, const DistancePartial& upper) noexcept
+            {
+                if (upper.nearest != std::numeric_limits<std::size_t>::max())
+                    lower.offer(upper.nearest, upper.nearestDistance);
+                if (upper.farthest != std::numeric_limits<std::size_t>::max())
+                    lower.offer(upper.farthest, upper.farthestDistance);
+                return lower;
+            }
+
+            /** @brief Indices of the whole job of @p count elements. */
+            [[nodiscard]] DistanceExtremes result(const std::size_t count) const noexcept
+            {
+                constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+                return { nearest == none ? count : nearest, farthest == none ? count : farthest };
+            }
+        };
+
+
+        /** @brief Reduce kernels of the running CPU for `T`. */
+        template <typename T>
+        [[nodiscard]] const falcon::simd::ReduceKernels<T>& reduceKernels() noexcept
+        {
+            return falcon::simd::batchKernels().get<T>().reduce;
+        }
+    } // namespace detail
+
+
+
+    /*************************************
+     *                                   *
+     *          PACKED VECTORS           *
+     *                                   *
+     *************************************/
+
+    template <ReducibleVector V>
+    Bounds<V> bounds(const std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options)
+    {
+        return parallel::reduce_chunks(
+            vectors,
+            [](const std::span<const V> chunk, const parallel::ChunkRange&)
+            {
+                Bounds<V> result = detail::emptyBounds<V>();
+                for (const V& vec : chunk)
+                    detail::expandBounds(result, vec);
+                return result;
+            },
+            [](const Bounds<V>& lower, const Bounds<V>& upper) { return detail::mergeBounds(lower, upper); },
+            detail::emptyBounds<V>(), options.chunking);
+    }
+
+
+    template <ReducibleVector V>
+    V sum(const std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options)
+    {
+        return parallel::reduce_chunks(
+            vectors,
+            [&options](const std::span<const V> chunk, const parallel::ChunkRange&)
+            {
+                return detail::sumTerms<V>(options.summation, chunk.size(),
+                                           [chunk](const std::size_t i) -> const V& { return chunk[i]; });
+            },
+            detail::addPartials, V{}, options.chunking);
+    }
+
+
+    template <ReducibleVector V>
+    V mean(const std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options)
+    {
+        assert(!vectors.empty() && "The mean of no vectors is undefined");
+        return sum<V>(vectors, options) / static_cast<ComponentOf<V>>(vectors.size());
+    }
+
+
+    template <ReducibleVector V>
+    ComponentOf<V> sumDot(const std::type_identity_t<std::span<const V>> lhs,
+                          const std::type_identity_t<std::span<const V>> rhs, const ReduceOptions& options)
+    {
+        using T = ComponentOf<V>;
+        assert(lhs.size() == rhs.size() && "Summed dot products need as many vectors on both sides");
+
+        return parallel::reduce_chunks(
+            lhs.size(), 2 * sizeof(V),
+            [&](const parallel::ChunkRange& range)
+            {
+                return detail::sumTerms<T>(options.summation, range.size(), [&](const std::size_t i)
+                                           { return lhs[range.begin + i].dot(rhs[range.begin + i]); });
+            },
+            detail::addPartials, T(0), options.chunking);
+    }
+
+
+    template <ReducibleVector V>
+    ComponentOf<V> sumMag(const std::type_identity_t<std::span<const V>> vectors, const ReduceOptions& options)
+    {
+        using T = ComponentOf<V>;
+        return parallel::reduce_chunks(
+            vectors,
+            [&options](const std::span<const V> chunk, const parallel::ChunkRange&)
+            {
+                return detail::sumTerms<T>(options.summation, chunk.size(),
+                                           [chunk](const std::size_t i) { return static_cast<T>(chunk[i].mag()); });
+            },
+            detail::addPartials, T(0), options.chunking);
+    }
+
+
+    template <ReducibleVector V>
+    DistanceExtremes distanceExtremes(const std::type_identity_t<std::span<const V>> vectors,
+                                      const std::type_identity_t<V>& point, const ReduceOptions& options)
+    {
+        using Partial = detail::DistancePartial<ComponentOf<V>>;
+        return parallel::reduce_chunks(
+                   vectors,
+                   [&point](const std::span<const V> chunk, const parallel::ChunkRange& range)
+                   {
+                       Partial partial;
+                       for (std::size_t i = 0; i < chunk.size(); ++i)
+                       {
+                           const V offset = chunk[i] - point;
+                           partial.offer(range.begin + i, offset.dot(offset));
+                       }
+                       return partial;
+                   },
+                   &Partial::merge, Partial{}, options.chunking)
+            .result(vectors.size());
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *     STRUCTURE-OF-ARRAYS VECTORS   *
+     *                                   *
+     *************************************/
+
+    template <BatchArithmetic T>
+    Bounds<Vector4D<T>> bounds(const Vec4Array<T>& vectors, const ReduceOptions& options)
+    {
+        using V = Vector4D<T>;
+        return parallel::reduce_chunks(
+            vectors.streams(), vectors.size(),
+            [](const falcon::simd::Vec4Streams<const T> chunk, const parallel::ChunkRange& range)
+            {
+                const auto& kernels = detail::reduceKernels<T>();
+                Bounds<V> result;
+                const T* streams[] = { chunk.x, chunk.y, chunk.z, chunk.w };
+                for (std::size_t c = 0; c < 4; ++c)
+                    kernels.minMax(streams[c], &result.min[c], &result.max[c], range.size());
+                return result;
+            },
+            [](const Bounds<V>& lower, const Bounds<V>& upper) { return detail::mergeBounds(lower, upper); },
+            detail::emptyBounds<V>(), options.chunking);
+    }
+
+
+    template <BatchArithmetic T>
+    Vector4D<T> sum(const Vec4Array<T>& vectors, const ReduceOptions& options)
+    {
+        return parallel::reduce_chunks(
+            vectors.streams(), vectors.size(),
+            [&options](const falcon::simd::Vec4Streams<const T> chunk, const parallel::ChunkRange& range)
+            {
+                const auto& kernels = detail::reduceKernels<T>();
+                const Summation summation = options.summation;
+                return Vector4D<T>(kernels.sum(chunk.x, summation, range.size()),
+                                   kernels.sum(chunk.y, summation, range.size()),
+                                   kernels.sum(chunk.z, summation, range.size()),
+                                   kernels.sum(chunk.w, summation, range.size()));
+            },
+            detail::addPartials, Vector4D<T>(), options.chunking);
+    }
+
+
+    template <BatchArithmetic T>
+    Vector4D<T> mean(const Vec4Array<T>& vectors, const ReduceOptions& options)
+    {
+        assert(vectors.size() != 0 && "The mean of no vectors is undefined");
+        return sum(vectors, options) / static_cast<T>(vectors.size());
+    }
+
+
+    template <BatchArithmetic T>
+    T sumDot(const Vec4Array<T>& lhs, const Vec4Array<T>& rhs, const ReduceOptions& options)
+    {
+        assert(lhs.size() == rhs.size() && "Summed dot products need arrays of equal size");
+
+        const falcon::simd::Vec4Streams<const T> right = rhs.streams();
+        return parallel::reduce_chunks(
+            lhs.streams(), lhs.size(),
+            [&](const falcon::simd::Vec4Streams<const T> chunk, const parallel::ChunkRange& range)
+            {
+                return detail::reduceKernels<T>().sumDot(chunk, parallel::detail::offsetStreams(right, range.begin),
+                                                         options.summation, range.size());
+            },
+            detail::addPartials, T(0), options.chunking);
+    }
+
+
+    template <BatchArithmetic T>
+    T sumMag(const Vec4Array<T>& vectors, const ReduceOptions& options)
+    {
+        return parallel::reduce_chunks(
+            vectors.streams(), vectors.size(),
+            [&options](const falcon::simd::Vec4Streams<const T> chunk, const parallel::ChunkRange& range)
+            { return detail::reduceKernels<T>().sumMag(chunk, options.summation, range.size()); },
+            detail::addPartials, T(0), options.chunking);
+    }
+
+
+    template <BatchArithmetic T>
+    DistanceExtremes distanceExtremes(const Vec4Array<T>& vectors, const std::type_identity_t<Vector4D<T>>& point,
+                                      const ReduceOptions& options)
+    {
+        using Partial = detail::DistancePartial<T>;
+        const T origin[] = { point.x, point.y, point.z, point.w };
+
+        return parallel::reduce_chunks(
+                   vectors.streams(), vectors.size(),
+                   [&](const falcon::simd::Vec4Streams<const T> chunk, const parallel::ChunkRange& range)
+                   {
+                       std::size_t nearest = 0, farthest = 0;
+                       detail::reduceKernels<T>().extremeDistances(chunk, origin, &nearest, &farthest, range.size());
+
+                       // The chunk's winners are offered again with their distances, so chunks compare on values.
+                       Partial partial;
+                       for (const std::size_t i : { nearest, farthest })
+                       {
+                           if (i == range.size())
+                               continue;
+                           const Vector4D<T> offset =
+                               Vector4D<T>(chunk.x[i], chunk.y[i], chunk.z[i], chunk.w[i]) - point;
+                           partial.offer(range.begin + i, offset.dot(offset));
+                       }
+                       return partial;
+                   },
+                   &Partial::merge, Partial{}, options.chunking)
+            .result(vectors.size());
+    }
+} // namespace fgm
@@ -0,0 +1,243 @@
+#pragma once
+/**
+ * @file AlignedMemory.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Register-aligned allocation for buffers fed to SIMD loads.
+ * @details `std::allocator` only guarantees `alignof(std::max_align_t)`, so a `std::vector` of plain floats, or of a
+ *          type whose alignment is weaker than a register, can start anywhere a 16-byte boundary allows and an aligned
+ *          load from it faults or splits across cache lines.
+ *          - @ref falcon::simd::AlignedAllocator aligns every allocation of a standard container to `Align` bytes.
+ *          - @ref falcon::simd::Buffer also rounds its capacity up to whole registers and keeps the elements past its
+ *            size zeroed, so a kernel can run full-width loads over the last register without a scalar tail.
+ *
+ * @par Alignment
+ * Both default to @ref falcon::simd::defaultAlignment, the widest register of the translation unit's instruction set,
+ * or to the alignment of `T` if that is stronger.
+ * Pass an explicit `Align` (such as 64, the AVX-512 width and the cache line size) for buffers shared with runtime
+ * dispatched kernels, which may use wider registers than the code that allocates the buffer.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMD.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <type_traits>
+
+
+namespace falcon::simd::inline FALCON_SIMD_ISA
+{
+    /**
+     * @addtogroup SIMD_Memory
+     * @{
+     */
+
+    /**
+     * @brief Default alignment of @ref AlignedAllocator and @ref Buffer: @ref maxHardwareAlignment, or the alignment
+     *        of `std::max_align_t` when that is larger (such as in scalar builds).
+     */
+    inline constexpr std::size_t defaultAlignment = std::max(maxHardwareAlignment, alignof(std::max_align_t));
+
+
+
+    /*************************************
+     *                                   *
+     *             ALLOCATOR             *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Standard allocator returning storage aligned to `Align` bytes.
+     * @details Allocates through the aligned `operator new`, so it works with every standard container:
+     *          `std::vector<float, AlignedAllocator<float>>` starts on a register boundary.
+     *
+     * @tparam T     Type of the allocated elements.
+     * @tparam Align Alignment in bytes. Must be a power of two no weaker than `alignof(T)`. Defaults to
+     *               @ref defaultAlignment, or `alignof(T)` for over-aligned types such as `double` 4D vectors.
+     */
+    template <typename T, std::size_t Align = std::max(defaultAlignment, alignof(T))>
+    struct AlignedAllocator
+    {
+        static_assert(std::has_single_bit(Align), "AlignedAllocator alignment must be a power of two");
+        static_assert(Align >= alignof(T), "AlignedAllocator alignment must not be weaker than that of T");
+
+        using value_type = T;
+
+        /** @brief Alignment of every allocation in bytes. */
+        static constexpr std::size_t alignment = Align;
+
+        /** @brief The same allocator for another element type, as required with a non-type template parameter. */
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Align>;
+        };
+
+
+        constexpr AlignedAllocator() noexcept = default;
+
+        /** @brief Rebinding copy. The allocator is stateless. */
+        template <typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept
+        {}
+
+
+        /**
+         * @brief Allocate uninitialized storage for @p count elements.
+         *
+         * @param[in] count Number of elements.
+         *
+         * @return Storage aligned to `Align` bytes.
+         *
+         * @throw std::bad_array_new_length If `count * sizeof(T)` overflows.
+         * @throw std::bad_alloc            If the allocation fails.
+         */
+        [[nodiscard]] T* allocate(std::size_t count);
+
+
+        /**
+         * @brief Release storage returned by @ref allocate.
+         *
+         * @param[in] ptr   Storage to release.
+         * @param[in] count Number of elements passed to @ref allocate.
+         */
+        void deallocate(T* ptr, std::size_t count) noexcept;
+
+
+        /** @brief Every instance can release the storage of every other, so allocators always compare equal. */
+        template <typename U>
+        [[nodiscard]] constexpr bool operator==(const AlignedAllocator<U, Align>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+
+
+    /*************************************
+     *                                   *
+     *               BUFFER              *
+     *                                   *
+     *************************************/
+
+    /**
+     * @brief Contiguous, register-aligned array whose capacity ends on a register boundary.
+     * @details Capacities are rounded up to the smallest element count whose byte size is a multiple of `Align`, so the
+     *          storage is made of whole registers. The elements between @ref size and @ref capacity, the padded tail,
+     *          are kept value-initialized (zero for arithmetic and vector types): a kernel may load and compute on
+     *          @ref padded without a scalar tail loop, and only has to ignore the results past @ref size.
+     *
+     * @tparam T     Type of the elements. Must be trivially copyable and trivially destructible.
+     * @tparam Align Alignment of the storage in bytes. See @ref AlignedAllocator.
+     */
+    template <typename T, std::size_t Align = std::max(defaultAlignment, alignof(T))>
+    class Buffer
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "Buffer elements are copied and released without running constructors or destructors");
+
+        public:
+        using value_type = T;
+        using allocator_type = AlignedAllocator<T, Align>;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        /** @brief Alignment of the storage in bytes. */
+        static constexpr std::size_t alignment = Align;
+
+        /** @brief Capacities are multiples of this many elements, the fewest that fill whole registers. */
+        static constexpr std::size_t granularity = Align / std::gcd(Align, sizeof(T));
+
+
+        /** @brief Initialize an empty buffer without allocating. */
+        Buffer() noexcept = default;
+
+        /** @brief Initialize @p count value-initialized elements. */
+        explicit Buffer(std::size_t count);
+
+        /** @brief Initialize a copy of @p values. */
+        explicit Buffer(std::span<const T> values);
+
+        Buffer(const Buffer& other);
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(const Buffer& other);
+        Buffer& operator=(Buffer&& other) noexcept;
+        ~Buffer();
+
+
+        /** @brief Number of elements. */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /** @brief Number of elements the storage holds, a multiple of @ref granularity. */
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        [[nodiscard]] bool empty() const noexcept;
+
+        /** @brief Start of the storage, aligned to `Align` bytes. `nullptr` before the first allocation. */
+        [[nodiscard]] T* data() noexcept;
+
+        /** @copydoc data() */
+        [[nodiscard]] const T* data() const noexcept;
+
+        [[nodiscard]] T& operator[](std::size_t index) noexcept;
+        [[nodiscard]] const T& operator[](std::size_t index) const noexcept;
+
+        [[nodiscard]] iterator begin() noexcept;
+        [[nodiscard]] iterator end() noexcept;
+        [[nodiscard]] const_iterator begin() const noexcept;
+        [[nodiscard]] const_iterator end() const noexcept;
+
+        /** @brief The @ref size elements. */
+        [[nodiscard]] std::span<T> span() noexcept;
+
+        /** @copydoc span() */
+        [[nodiscard]] std::span<const T> span() const noexcept;
+
+        /** @brief The elements followed by the zeroed tail, @ref capacity elements in whole registers. */
+        [[nodiscard]] std::span<T> padded() noexcept;
+
+        /** @copydoc padded() */
+        [[nodiscard]] std::span<const T> padded() const noexcept;
+
+
+        /** @brief Grow the storage to hold at least @p count elements, keeping the elements. */
+        void reserve(std::size_t count);
+
+        /**
+         * @brief Change the number of elements.
+         * @details New elements are value-initialized. Dropped elements are reset so the tail stays zeroed.
+         */
+        void resize(std::size_t count);
+
+        /** @brief Append @p value, growing the storage geometrically when it is full. */
+        void push_back(const T& value);
+
+        /** @brief Remove every element, keeping the storage. */
+        void clear() noexcept;
+
+
+        private:
+        /** @brief @p count rounded up to a multiple of @ref granularity. */
+        [[nodiscard]] static constexpr std::size_t roundCapacity(std::size_t count) noexcept;
+
+        /** @brief Move the elements into storage for exactly @p newCapacity elements, zeroing the rest. */
+        void reallocate(std::size_t newCapacity);
+
+        T* _data = nullptr;
+        std::size_t _size = 0;
+        std::size_t _capacity = 0;
+    };
+
+    /** @} */
+
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
+
+
+#include "AlignedMemory.tpp"
@@ -0,0 +1,293 @@
+#pragma once
+/**
+ * @file AlignedMemory.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief @ref falcon::simd::AlignedAllocator and @ref falcon::simd::Buffer template implementation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "AlignedMemory.h"
+
+#include <cassert>
+#include <limits>
+#include <new>
+#include <utility>
+
+
+namespace falcon::simd::inline FALCON_SIMD_ISA
+{
+
+    /*************************************
+     *                                   *
+     *             ALLOCATOR             *
+     *                                   *
+     *************************************/
+
+    template <typename T, std::size_t Align>
+    T* AlignedAllocator<T, Align>::allocate(const std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Align }));
+    }
+
+
+    template <typename T, std::size_t Align>
+    void AlignedAllocator<T, Align>::deallocate(T* ptr, const std::size_t count) noexcept
+    {
+        ::operator delete(ptr, count * sizeof(T), std::align_val_t{ Align });
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *           INITIALIZERS            *
+     *                                   *
+     *************************************/
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>::Buffer(const std::size_t count)
+    {
+        resize(count);
+    }
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>::Buffer(const std::span<const T> values)
+    {
+        reserve(values.size());
+        std::copy(values.begin(), values.end(), _data);
+        _size = values.size();
+    }
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>::Buffer(const Buffer& other): Buffer(other.span())
+    {}
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>::Buffer(Buffer&& other) noexcept:
+        _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+        _capacity(std::exchange(other._capacity, 0))
+    {}
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>& Buffer<T, Align>::operator=(const Buffer& other)
+    {
+        if (this != &other)
+            *this = Buffer(other);
+        return *this;
+    }
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>& Buffer<T, Align>::operator=(Buffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            allocator_type().deallocate(_data, _capacity);
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, 0);
+        }
+        return *this;
+    }
+
+
+    template <typename T, std::size_t Align>
+    Buffer<T, Align>::~Buffer()
+    {
+        allocator_type().deallocate(_data, _capacity);
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             ACCESSORS             *
+     *                                   *
+     *************************************/
+
+    template <typename T, std::size_t Align>
+    std::size_t Buffer<T, Align>::size() const noexcept
+    {
+        return _size;
+    }
+
+
+    template <typename T, std::size_t Align>
+    std::size_t Buffer<T, Align>::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+
+    template <typename T, std::size_t Align>
+    bool Buffer<T, Align>::empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+
+    template <typename T, std::size_t Align>
+    T* Buffer<T, Align>::data() noexcept
+    {
+        return _data;
+    }
+
+
+    template <typename T, std::size_t Align>
+    const T* Buffer<T, Align>::data() const noexcept
+    {
+        return _data;
+    }
+
+
+    template <typename T, std::size_t Align>
+    T& Buffer<T, Align>::operator[](const std::size_t index) noexcept
+    {
+        assert(index < _size && "Buffer index out of range");
+        return _data[index];
+    }
+
+
+    template <typename T, std::size_t Align>
+    const T& Buffer<T, Align>::operator[](const std::size_t index) const noexcept
+    {
+        assert(index < _size && "Buffer index out of range");
+        return _data[index];
+    }
+
+
+    template <typename T, std::size_t Align>
+    typename Buffer<T, Align>::iterator Buffer<T, Align>::begin() noexcept
+    {
+        return _data;
+    }
+
+
+    template <typename T, std::size_t Align>
+    typename Buffer<T, Align>::iterator Buffer<T, Align>::end() noexcept
+    {
+        return _data + _size;
+    }
+
+
+    template <typename T, std::size_t Align>
+    typename Buffer<T, Align>::const_iterator Buffer<T, Align>::begin() const noexcept
+    {
+        return _data;
+    }
+
+
+    template <typename T, std::size_t Align>
+    typename Buffer<T, Align>::const_iterator Buffer<T, Align>::end() const noexcept
+    {
+        return _data + _size;
+    }
+
+
+    template <typename T, std::size_t Align>
+    std::span<T> Buffer<T, Align>::span() noexcept
+    {
+        return { _data, _size };
+    }
+
+
+    template <typename T, std::size_t Align>
+    std::span<const T> Buffer<T, Align>::span() const noexcept
+    {
+        return { _data, _size };
+    }
+
+
+    template <typename T, std::size_t Align>
+    std::span<T> Buffer<T, Align>::padded() noexcept
+    {
+        return { _data, _capacity };
+    }
+
+
+    template <typename T, std::size_t Align>
+    std::span<const T> Buffer<T, Align>::padded() const noexcept
+    {
+        return { _data, _capacity };
+    }
+
+
+
+    /*************************************
+     *                                   *
+     *             MUTATORS              *
+     *                                   *
+     *************************************/
+
+    template <typename T, std::size_t Align>
+    void Buffer<T, Align>::reserve(const std::size_t count)
+    {
+        if (count > _capacity)
+            reallocate(roundCapacity(count));
+    }
+
+
+    template <typename T, std::size_t Align>
+    void Buffer<T, Align>::resize(const std::size_t count)
+    {
+        reserve(count);
+        // Elements past the size are already value-initialized; only shrinking has elements to reset.
+        if (count < _size)
+            std::fill(_data + count, _data + _size, T{});
+        _size = count;
+    }
+
+
+    template <typename T, std::size_t Align>
+    void Buffer<T, Align>::push_back(const T& value)
+    {
+        if (_size == _capacity)
+        {
+            // value may be one of our own elements, which reallocating frees.
+            const T copy = value;
+            reallocate(roundCapacity(std::max(_capacity * 2, std::size_t(1))));
+            _data[_size++] = copy;
+            return;
+        }
+        _data[_size++] = value;
+    }
+
+
+    template <typename T, std::size_t Align>
+    void Buffer<T, Align>::clear() noexcept
+    {
+        resize(0);
+    }
+
+
+    template <typename T, std::size_t Align>
+    constexpr std::size_t Buffer<T, Align>::roundCapacity(const std::size_t count) noexcept
+    {
+        return (count + granularity - 1) / granularity * granularity;
+    }
+
+
+    template <typename T, std::size_t Align>
+    void Buffer<T, Align>::reallocate(const std::size_t newCapacity)
+    {
+        allocator_type allocator;
+        T* data = allocator.allocate(newCapacity);
+        std::copy(_data, _data + _size, data);
+        std::fill(data + _size, data + newCapacity, T{});
+
+        allocator.deallocate(_data, _capacity);
+        _data = data;
+        _capacity = newCapacity;
+    }
+
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
@@ -0,0 +1,438 @@
+#pragma once
+/**
+ * @file Dispatch.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Runtime instruction set detection and dispatch of batch kernels.
+ * @details Batch kernels are compiled once per instruction set tier into the `FalconDispatch` library. The first call
+ *          to @ref falcon::simd::batchKernels reads CPUID and binds the table of the newest tier the running CPU
+ *          and operating system support, so a binary built on one machine neither faults with SIGILL on an older
+ *          CPU nor leaves AVX-512 unused on a newer one.
+ *
+ * @par Environment override
+ * Set `FALCON_FORCE_SIMD` to `SCALAR`, `SSE`, `AVX2` or `AVX512` to cap the bound tier, mirroring the `FORCE_*`
+ * macros of SIMD.h. The override can only lower the tier; requesting more than the CPU supports falls back to the
+ * detected tier.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "HalfFloat.h"
+#include "Precision.h"
+#include "Quantize.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+
+namespace falcon::simd
+{
+    /**
+     * @addtogroup SIMD_Dispatch
+     * @{
+     */
+
+    /** @brief Instruction set tiers the batch kernels are compiled for, ordered from oldest to newest. */
+    enum class ISA : std::uint8_t
+    {
+        Scalar, ///< Portable C++ loops.
+        SSE42,  ///< SSE4.2, 128-bit registers.
+        AVX2,   ///< AVX2, FMA and F16C, 256-bit registers.
+        AVX512  ///< AVX-512 F, BW, DQ and VL, 512-bit registers.
+    };
+
+
+    /**
+     * @brief Streaming kernels over contiguous arrays of `T`.
+     * @details Every kernel processes @p count elements, handles any tail shorter than a register, accepts unaligned
+     *          pointers, and allows the output to alias any of its inputs.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct StreamKernels
+    {
+        using Binary = void (*)(const T* lhs, const T* rhs, T* out, std::size_t count) noexcept;
+        using ScalarOp = void (*)(const T* src, T scalar, T* out, std::size_t count) noexcept;
+        using Ternary = void (*)(const T* a, const T* b, const T* c, T* out, std::size_t count) noexcept;
+
+        Binary add;          ///< `out[i] = lhs[i] + rhs[i]`
+        Binary subtract;     ///< `out[i] = lhs[i] - rhs[i]`
+        Binary multiply;     ///< `out[i] = lhs[i] * rhs[i]`
+        Binary divide;       ///< `out[i] = lhs[i] / rhs[i]`
+        ScalarOp scale;      ///< `out[i] = src[i] * scalar`
+        Ternary multiplyAdd; ///< `out[i] = a[i] * b[i] + c[i]`, fused where the tier has FMA.
+    };
+
+
+    /**
+     * @brief Structure-of-arrays view of 4-component vectors, one pointer per component stream.
+     *
+     * @tparam T Element type, `const` qualified for inputs.
+     */
+    template <typename T>
+    struct Vec4Streams
+    {
+        T* x; ///< X components.
+        T* y; ///< Y components.
+        T* z; ///< Z components.
+        T* w; ///< W components.
+    };
+
+
+    /**
+     * @brief Kernels over structure-of-arrays 4-component vectors.
+     * @details Each lane of a register holds one vector, so a kernel processes as many vectors per instruction as the
+     *          tier has lanes. Vector outputs may alias the matching input streams.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct Vec4Kernels
+    {
+        using In = Vec4Streams<const T>;
+        using Out = Vec4Streams<T>;
+
+        /** `out[i] = dot(lhs[i], rhs[i])` */
+        void (*dot)(In lhs, In rhs, T* out, std::size_t count) noexcept;
+        /** `out[i] = |src[i]|` */
+        void (*mag)(In src, T* out, std::size_t count) noexcept;
+        /** `out[i] = src[i] / |src[i]|`, multiplying by a reciprocal magnitude of the given @ref Precision. */
+        void (*normalize)(In src, Precision precision, Out out, std::size_t count) noexcept;
+        /** As @ref normalize, but writes a zero vector wherever `dot(src[i], src[i]) <= thresholdSquared`. */
+        void (*safeNormalize)(In src, T thresholdSquared, Precision precision, Out out, std::size_t count) noexcept;
+        /** Orthogonal projection of `src[i]` onto `onto[i]`. */
+        void (*project)(In src, In onto, bool ontoNormalized, Out out, std::size_t count) noexcept;
+        /** `out[i] = src[i] - project(src[i], from[i])` */
+        void (*reject)(In src, In from, bool fromNormalized, Out out, std::size_t count) noexcept;
+        /** Split @p count packed `{x, y, z, w}` vectors at @p aos into @p out. */
+        void (*deinterleave)(const T* aos, Out out, std::size_t count) noexcept;
+        /** Pack @p count vectors of @p soa into `{x, y, z, w}` quadruples at @p aos. */
+        void (*interleave)(In soa, T* aos, std::size_t count) noexcept;
+        /**
+         * Set bit `i % 64` of `out[i / 64]` when every component pair of `lhs[i]` and `rhs[i]` is exactly equal or
+         * differs by at most @p epsilon, and clear it otherwise, so NaN components never match. Bits past @p count in
+         * the last word are cleared; @p out holds `ceil(count / 64)` words.
+         */
+        void (*equal)(In lhs, In rhs, T epsilon, std::uint64_t* out, std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels transforming many 4-component vectors by one 4x4 matrix.
+     * @details @p matrix points at 16 column-major elements, which stay in registers for the whole batch. Outputs may
+     *          be the very same memory as the inputs, but must not otherwise overlap them. With @p streaming set, full
+     *          registers are written with non-temporal stores and fenced before returning; use it for outputs larger
+     *          than the cache that are not read back right away.
+     *
+     *          The projective variants divide `x`, `y` and `z` by the transformed `w` and set `w` to `1`.
+     *          The affine variant reads a 3x4 matrix instead and skips the bottom row.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct Mat4Kernels
+    {
+        using In = Vec4Streams<const T>;
+        using Out = Vec4Streams<T>;
+
+        /** `out[i] = matrix * src[i]` over @p count packed `{x, y, z, w}` vectors. */
+        void (*transform)(const T* matrix, const T* src, bool streaming, T* out, std::size_t count) noexcept;
+        /** As @ref transform, followed by the divide by `w`. */
+        void (*transformProjective)(const T* matrix, const T* src, bool streaming, T* out, std::size_t count) noexcept;
+        /** `out[i] = matrix * src[i]` over structure-of-arrays vectors. */
+        void (*transformStreams)(const T* matrix, In src, bool streaming, Out out, std::size_t count) noexcept;
+        /** As @ref transformStreams, followed by the divide by `w`. */
+        void (*transformStreamsProjective)(const T* matrix, In src, bool streaming, Out out,
+                                           std::size_t count) noexcept;
+        /**
+         * `out[i] = affine * src[i]` over structure-of-arrays vectors, @p affine holding the 12 column-major elements
+         * of a 3x4 affine matrix. Only `x`, `y` and `z` are computed; `w` is copied through.
+         */
+        void (*transformStreamsAffine)(const T* affine, In src, bool streaming, Out out, std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels interpolating structure-of-arrays unit quaternions, `x`, `y` and `z` being the imaginary part.
+     * @details Both kernels blend @p from towards @p to by the same factor @p t, take the shorter arc by negating
+     *          `to[i]` wherever `dot(from[i], to[i]) < 0`, and may write over either input.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct QuatKernels
+    {
+        using In = Vec4Streams<const T>;
+        using Out = Vec4Streams<T>;
+
+        /** Normalized linear interpolation, `out[i] = normalize(from[i] + t * (to[i] - from[i]))`. */
+        void (*nlerp)(In from, In to, T t, Out out, std::size_t count) noexcept;
+        /**
+         * Spherical linear interpolation. Branch free: the arc is split at its midpoint and the weights
+         * $ \sin(s\theta) / \sin\theta $ of the half holding @p t are evaluated as a polynomial in $ \cos\theta $,
+         * accurate to a few units in the last place without any trigonometric call.
+         */
+        void (*slerp)(In from, In to, T t, Out out, std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels reducing a stream or structure-of-arrays vectors to a few values.
+     * @details Sums keep four registers of running sums and add their lanes in a fixed order at the end, so a given
+     *          tier returns the same result for the same input on every call, while different tiers may differ in
+     *          the last bits. Lanes past @p count never contribute.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct ReduceKernels
+    {
+        using In = Vec4Streams<const T>;
+
+        /** `src[0] + ... + src[count - 1]`, `0` for an empty stream. */
+        T (*sum)(const T* src, Summation summation, std::size_t count) noexcept;
+        /**
+         * Smallest and largest element, skipping NaN. An empty or all-NaN stream yields `+infinity` and `-infinity`,
+         * an inverted range.
+         */
+        void (*minMax)(const T* src, T* min, T* max, std::size_t count) noexcept;
+        /** Sum of `dot(lhs[i], rhs[i])`, the sum of squared magnitudes when both are the same vectors. */
+        T (*sumDot)(In lhs, In rhs, Summation summation, std::size_t count) noexcept;
+        /** Sum of `|src[i]|` */
+        T (*sumMag)(In src, Summation summation, std::size_t count) noexcept;
+        /**
+         * Indices of the vectors nearest to and farthest from the 4 elements at @p point, the lowest index on ties.
+         * Vectors at a NaN distance are skipped; both indices are @p count if every vector is.
+         */
+        void (*extremeDistances)(In src, const T* point, std::size_t* nearest, std::size_t* farthest,
+                                 std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels testing structure-of-arrays bounding volumes against a convex set of planes.
+     * @details @p planes points at @p planeCount planes of 4 elements `{a, b, c, d}` each, the inside of a plane
+     *          being where `a * x + b * y + c * z + d >= 0`; sphere tests need unit normals. Every plane is tested
+     *          against a whole register of volumes at once. A volume is kept unless it lies entirely outside one
+     *          plane, so the test is conservative: volumes straddling two planes outside a corner are kept, and so
+     *          are volumes with NaN components.
+     *
+     *          Results are written as in @ref Vec4Kernels::equal: bit `i % 64` of `out[i / 64]` is set when volume
+     *          `i` is kept, bits past @p count in the last word are cleared, and @p out holds `ceil(count / 64)`
+     *          words. With no planes every volume is kept.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct CullKernels
+    {
+        using In = Vec4Streams<const T>;
+
+        /** Spheres with their centers in `x`, `y` and `z` and their radii in `w`. */
+        void (*spheres)(In spheres, const T* planes, std::size_t planeCount, std::uint64_t* out,
+                        std::size_t count) noexcept;
+        /** Axis-aligned boxes spanning @p min to @p max in `x`, `y` and `z`; `w` is ignored. */
+        void (*boxes)(In min, In max, const T* planes, std::size_t planeCount, std::uint64_t* out,
+                      std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels intersecting structure-of-arrays rays with one primitive.
+     * @details Ray `i` starts at `origins[i]` and runs along `directions[i]` in `x`, `y` and `z`; `w` is ignored.
+     *          Distances are ray parameters, the hit point being `origin + distance * direction`, so they are true
+     *          distances only for unit directions. Each register of rays is tested against the primitive at once.
+     *
+     *          @p distances is read and written: on entry `distances[i]` is the farthest distance a hit of ray `i` is
+     *          accepted at, on return it is the hit distance where the ray hits and unchanged where it misses.
+     *          Tracing one ray set against many primitives this way leaves the closest hits behind. Hits are written
+     *          as in @ref Vec4Kernels::equal: bit `i % 64` of `hits[i / 64]` is set when ray `i` hits, bits past
+     *          @p count in the last word are cleared, and @p hits holds `ceil(count / 64)` words.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    struct RayKernels
+    {
+        using In = Vec4Streams<const T>;
+
+        /**
+         * Möller–Trumbore test against the triangle of the 9 elements at @p triangle, its vertices `{x, y, z}` in
+         * order. Both faces are hit; rays in the plane of the triangle and degenerate triangles are missed.
+         */
+        void (*triangle)(In origins, In directions, const T* triangle, T* distances, std::uint64_t* hits,
+                         std::size_t count) noexcept;
+        /**
+         * Slab test against the box spanning the 6 elements at @p box, its minimum corner `{x, y, z}` then its maximum
+         * corner. Rays starting inside hit at distance `0`. Rays with NaN components hit every box at distance `0`,
+         * erring towards hitting as a traversal test should; a ray lying exactly in the plane of a face may hit or
+         * miss.
+         */
+        void (*box)(In origins, In directions, const T* box, T* distances, std::uint64_t* hits,
+                    std::size_t count) noexcept;
+        /**
+         * Test against the sphere of the 4 elements at @p sphere, its center `{x, y, z}` then its radius. Rays starting
+         * inside hit where they leave the sphere.
+         */
+        void (*sphere)(In origins, In directions, const T* sphere, T* distances, std::uint64_t* hits,
+                       std::size_t count) noexcept;
+    };
+
+
+    /** @brief Every kernel compiled for one element type. */
+    template <typename T>
+    struct TypedKernels
+    {
+        StreamKernels<T> stream; ///< Element-wise kernels over flat streams.
+        Vec4Kernels<T> vec4;     ///< Kernels over structure-of-arrays vectors.
+        Mat4Kernels<T> mat4;     ///< Kernels transforming vectors by a matrix.
+        QuatKernels<T> quat;     ///< Kernels interpolating quaternions.
+        ReduceKernels<T> reduce; ///< Kernels reducing streams and vectors.
+        CullKernels<T> cull;     ///< Kernels culling bounding volumes against planes.
+        RayKernels<T> ray;       ///< Kernels intersecting rays with primitives.
+    };
+
+
+    /**
+     * @brief Kernels converting contiguous arrays between `float` and half precision bit patterns.
+     * @details Tiers with F16C (AVX2 and up) convert a register at a time with `vcvtps2ph` and `vcvtph2ps`; the others
+     *          run @ref floatToHalf and @ref halfToFloat, which give the same bits. Both kernels round to nearest
+     *          even and accept unaligned pointers.
+     */
+    struct HalfKernels
+    {
+        /** `out[i] = floatToHalf(src[i])`. */
+        void (*toHalf)(const float* src, std::uint16_t* out, std::size_t count) noexcept;
+        /** `out[i] = halfToFloat(src[i])`. */
+        void (*toFloat)(const std::uint16_t* src, float* out, std::size_t count) noexcept;
+    };
+
+
+    /**
+     * @brief Kernels quantizing contiguous arrays of `float` to compact integer encodings, and back.
+     * @details Encoding clamps, scales and rounds to nearest even exactly as @ref quantizeSnorm, @ref quantizeUnorm
+     *          and @ref toOctahedral do, so every tier writes the same integers. Decoding divides by the scale as
+     *          @ref dequantizeSnorm and @ref dequantizeUnorm do; only @ref fromOctahedral, which normalizes, may
+     *          differ from the scalar result in the last bit. Every kernel accepts unaligned pointers.
+     */
+    struct QuantizeKernels
+    {
+        /** `out[i] = quantizeSnorm(src[i], 127)` over `count` values. */
+        void (*toSnorm8)(const float* src, std::int8_t* out, std::size_t count) noexcept;
+        /** `out[i] = quantizeSnorm(src[i], 32767)` over `count` values. */
+        void (*toSnorm16)(const float* src, std::int16_t* out, std::size_t count) noexcept;
+        /** `out[i] = quantizeUnorm(src[i], 255)` over `count` values. */
+        void (*toUnorm8)(const float* src, std::uint8_t* out, std::size_t count) noexcept;
+        /** `out[i] = quantizeUnorm(src[i], 65535)` over `count` values. */
+        void (*toUnorm16)(const float* src, std::uint16_t* out, std::size_t count) noexcept;
+
+        /** `out[i] = dequantizeSnorm(src[i], 127)` over `count` values. */
+        void (*fromSnorm8)(const std::int8_t* src, float* out, std::size_t count) noexcept;
+        /** `out[i] = dequantizeSnorm(src[i], 32767)` over `count` values. */
+        void (*fromSnorm16)(const std::int16_t* src, float* out, std::size_t count) noexcept;
+        /** `out[i] = dequantizeUnorm(src[i], 255)` over `count` values. */
+        void (*fromUnorm8)(const std::uint8_t* src, float* out, std::size_t count) noexcept;
+        /** `out[i] = dequantizeUnorm(src[i], 65535)` over `count` values. */
+        void (*fromUnorm16)(const std::uint16_t* src, float* out, std::size_t count) noexcept;
+
+        /** Pack `count` `{x, y, z, w}` vectors of @p src as signed 10:10:10:2 values, scales 511 and 1. */
+        void (*toSnorm1010102)(const float* src, std::uint32_t* out, std::size_t count) noexcept;
+        /** Pack `count` `{x, y, z, w}` vectors of @p src as unsigned 10:10:10:2 values, scales 1023 and 3. */
+        void (*toUnorm1010102)(const float* src, std::uint32_t* out, std::size_t count) noexcept;
+        /** Unpack `count` signed 10:10:10:2 values to `{x, y, z, w}` vectors. */
+        void (*fromSnorm1010102)(const std::uint32_t* src, float* out, std::size_t count) noexcept;
+        /** Unpack `count` unsigned 10:10:10:2 values to `{x, y, z, w}` vectors. */
+        void (*fromUnorm1010102)(const std::uint32_t* src, float* out, std::size_t count) noexcept;
+
+        /** Map `count` `{x, y, z}` vectors of @p src to `{u, v}` octahedral pairs, each a 16-bit snorm. */
+        void (*toOctahedral)(const float* src, std::int16_t* out, std::size_t count) noexcept;
+        /** Unit `{x, y, z}` vectors of `count` 16-bit `{u, v}` octahedral pairs. */
+        void (*fromOctahedral)(const std::int16_t* src, float* out, std::size_t count) noexcept;
+    };
+
+
+    /** @brief Table of batch kernels compiled for one @ref ISA tier. */
+    struct BatchKernels
+    {
+        ISA isa;                      ///< Tier the kernels were compiled for.
+        TypedKernels<float> floats;   ///< Kernels over `float` data.
+        TypedKernels<double> doubles; ///< Kernels over `double` data.
+        HalfKernels half;             ///< Conversions between `float` and half precision.
+        QuantizeKernels quantize;     ///< Compact integer encodings of `float` data.
+
+        /** @brief Kernels for element type `T` (`float` or `double`). */
+        template <typename T>
+        [[nodiscard]] constexpr const TypedKernels<T>& get() const noexcept
+        {
+            static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "Batch kernels are float or double");
+            if constexpr (std::is_same_v<T, float>)
+                return floats;
+            else
+                return doubles;
+        }
+    };
+
+
+    /**
+     * @brief Read CPUID and the enabled register state to find the newest tier this machine can run.
+     *
+     * @return @ref ISA::Scalar on non-x86 targets.
+     */
+    [[nodiscard]] ISA detectISA() noexcept;
+
+
+    /**
+     * @brief Parse a `FALCON_FORCE_SIMD` value.
+     *
+     * @param[in] name Tier name, case-insensitive. Accepts `SCALAR`, `SSE`, `SSE4.2`, `AVX`, `AVX2`, `AVX512` and
+     *                 `AVX-512`; `AVX` maps to @ref ISA::SSE42 since there is no AVX-only tier.
+     *
+     * @return The requested tier, or `std::nullopt` if @p name is not recognized.
+     */
+    [[nodiscard]] std::optional<ISA> parseISA(std::string_view name) noexcept;
+
+
+    /**
+     * @brief Combine a detected tier with an optional override.
+     *
+     * @param[in] detected Tier the CPU supports.
+     * @param[in] override Value of `FALCON_FORCE_SIMD`, may be `nullptr`.
+     *
+     * @return The lower of @p detected and the parsed override, or @p detected if the override is absent or invalid.
+     */
+    [[nodiscard]] ISA resolveISA(ISA detected, const char* override) noexcept;
+
+
+    /**
+     * @brief Tier bound by @ref batchKernels.
+     * @details Resolved once from @ref detectISA and `FALCON_FORCE_SIMD`, then clamped to the tiers compiled in.
+     */
+    [[nodiscard]] ISA activeISA() noexcept;
+
+
+    /** @brief Display name of @p isa. */
+    [[nodiscard]] std::string_view toString(ISA isa) noexcept;
+
+
+    /**
+     * @brief Kernels compiled for exactly @p isa.
+     *
+     * @param[in] isa Requested tier.
+     *
+     * @return `nullptr` if the compiler could not build that tier.
+     * @note The table is returned even when the running CPU cannot execute it; check against @ref detectISA first.
+     */
+    [[nodiscard]] const BatchKernels* batchKernelsFor(ISA isa) noexcept;
+
+
+    /** @brief Kernels of @ref activeISA, bound on first use. */
+    [[nodiscard]] const BatchKernels& batchKernels() noexcept;
+
+    /** @} */
+} // namespace falcon::simd
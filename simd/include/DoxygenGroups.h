@@ -1 +1,56 @@
-#pragma once
\ No newline at end of file
+#pragma once
+/**
+ * @file DoxygenGroups.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: March 18, 2026
+ *
+ * @brief Definitions for doxygen groups used across the falcon SIMD library.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+// clang-format off
+/**
+ * @defgroup SIMD SIMD Library
+ * @brief Architecture-agnostic SIMD abstractions.
+ * @{
+ */
+
+    /**
+     * @defgroup SIMD_Register Registers
+     * @brief Register value type resolved to SSE, AVX, AVX2 or AVX-512 intrinsics at compile time.
+     * @ingroup SIMD
+     * @{
+     *   @defgroup SIMD_Register_Memory Load, Store and Initialization
+     *   @defgroup SIMD_Register_Arithmetic Arithmetic Operations
+     *   @defgroup SIMD_Register_Comparison Comparisons and Blending
+     * @}
+     */
+
+    /**
+     * @defgroup SIMD_Memory Aligned Memory
+     * @brief Register-aligned allocator and buffers with zeroed, whole-register tails.
+     * @ingroup SIMD
+     */
+
+    /**
+     * @defgroup SIMD_Half Half Precision
+     * @brief Correctly rounding scalar conversion between `float` and half precision bit patterns.
+     * @ingroup SIMD
+     */
+
+    /**
+     * @defgroup SIMD_Quantize Quantization
+     * @brief Scalar reference encodings of normalized integers, 10:10:10:2 fields and octahedral coordinates.
+     * @ingroup SIMD
+     */
+
+    /**
+     * @defgroup SIMD_Dispatch Runtime Dispatch
+     * @brief Batch kernels compiled once per instruction set and bound from CPUID at startup.
+     * @ingroup SIMD
+     */
+
+/** @} */
+// clang-format on
@@ -0,0 +1,105 @@
+#pragma once
+/**
+ * @file HalfFloat.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Scalar conversion between `float` and the bit patterns of IEEE 754 binary16 (half precision) numbers.
+ * @details The conversions use integer arithmetic only, so they are usable in constant expressions and give the same
+ *          bits on every target. They match the F16C instructions `vcvtps2ph` (rounding to nearest even) and
+ *          `vcvtph2ps` bit for bit, NaNs included, which lets the batch kernels finish their tails with them.
+ *
+ * @par ODR note
+ * Like SIMD.h, these functions live in the `FALCON_SIMD_ISA` inline namespace: the kernel tiers compile them with
+ * their own `-m` flags, and the linker must not merge those copies with the baseline ones.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMD.h"
+
+#include <bit>
+#include <cstdint>
+
+
+namespace falcon::simd::inline FALCON_SIMD_ISA
+{
+    /**
+     * @addtogroup SIMD_Half
+     * @{
+     */
+
+    /**
+     * @brief Round @p value to the nearest half precision number, ties to even.
+     * @details Magnitudes from `65520` up round to infinity and magnitudes up to `2^-25` to zero, both keeping the
+     *          sign. A NaN stays a NaN with its sign and the top 9 bits of its payload, and is made quiet.
+     *
+     * @return Bit pattern of the half precision result.
+     */
+    [[nodiscard]] constexpr std::uint16_t floatToHalf(const float value) noexcept
+    {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+        const std::uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+        if (magnitude > 0x7F800000u)
+            return static_cast<std::uint16_t>(sign | 0x7E00u | ((magnitude >> 13) & 0x3FFu));
+        if (magnitude >= 0x47800000u) // 2^16 and infinity
+            return static_cast<std::uint16_t>(sign | 0x7C00u);
+
+        if (magnitude >= 0x38800000u) // 2^-14, the smallest normal half
+        {
+            // Rebias the exponent from 127 to 15, then round the 13 dropped mantissa bits; a carry out of the
+            // mantissa steps the exponent, up to infinity.
+            const std::uint32_t rebiased = magnitude - 0x38000000u;
+            const std::uint32_t odd = (rebiased >> 13) & 1u;
+            return static_cast<std::uint16_t>(sign | ((rebiased + 0xFFFu + odd) >> 13));
+        }
+
+        const std::uint32_t exponent = magnitude >> 23;
+        if (exponent < 102) // Below 2^-25, half of the smallest subnormal half
+            return sign;
+
+        // The subnormal half counts units of 2^-24, so shift the full mantissa down to that unit and round.
+        const std::uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        const std::uint32_t shift = 126 - exponent;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        std::uint32_t units = mantissa >> shift;
+        if (remainder > halfway || (remainder == halfway && (units & 1u)))
+            ++units; // Rounding up from the largest subnormal gives the smallest normal, which is the right pattern.
+        return static_cast<std::uint16_t>(sign | units);
+    }
+
+
+    /**
+     * @brief Widen the half precision number of bit pattern @p bits to `float`, which holds every one exactly.
+     * @details A NaN keeps its sign and payload and is made quiet.
+     */
+    [[nodiscard]] constexpr float halfToFloat(const std::uint16_t bits) noexcept
+    {
+        const std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+        const std::uint32_t exponent = (bits >> 10) & 0x1Fu;
+        std::uint32_t mantissa = bits & 0x3FFu;
+
+        if (exponent == 0x1F)
+            return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13) | (mantissa ? 0x400000u : 0u));
+        if (exponent != 0)
+            return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+        if (mantissa == 0)
+            return std::bit_cast<float>(sign);
+
+        // Subnormal: shift the leading one up to the implicit bit, lowering the exponent once per step.
+        std::uint32_t floatExponent = 113;
+        while (!(mantissa & 0x400u))
+        {
+            mantissa <<= 1;
+            --floatExponent;
+        }
+        return std::bit_cast<float>(sign | (floatExponent << 23) | ((mantissa & 0x3FFu) << 13));
+    }
+
+    /** @} */
+
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
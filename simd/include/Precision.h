@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file Precision.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Accuracy tiers for operations that can trade exact rounding for throughput, and summation modes for
+ *        reductions that can trade throughput for accuracy.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <cstdint>
+#include <type_traits>
+
+
+namespace falcon::simd
+{
+    /**
+     * @addtogroup SIMD_Register_Arithmetic
+     * @{
+     */
+
+    /**
+     * @brief Accuracy of a reciprocal square root and of the normalizations built on it.
+     * @details The approximate tiers start from the hardware estimate (`rsqrtps`, or `rsqrt14ps` under AVX-512) and
+     *          multiply by it instead of dividing. `double` has no estimate below AVX-512, so its approximate tiers
+     *          take one correctly rounded $ 1 / \sqrt{a} $ and multiply by that, which already meets the
+     *          @ref Exact bound.
+     *
+     *          Maximum error of a normalized component against the exact result, in units in the last place of the
+     *          component type, as returned by @ref maxUlpError:
+     *
+     *          | Tier          | `float`  | `double` |
+     *          | ------------- | -------- | -------- |
+     *          | @ref Fast     | 6144     | 4        |
+     *          | @ref Refined  | 6        | 4        |
+     *          | @ref Exact    | 4        | 4        |
+     *
+     *          The @ref Fast bound is the $ 1.5 \cdot 2^{-12} $ relative error of `rsqrtps`; the others cover the
+     *          rounding of the dot product, the square root or Newton-Raphson step and the final scale. They hold for
+     *          vectors whose squared magnitude is a normal number, so the estimate is defined.
+     *
+     *          @ref Exact sums the squared magnitude as $ (x^2 + y^2) + (z^2 + w^2) $ without fused multiply-adds and
+     *          divides each component by its square root, so `Vector4D`, `constexpr` evaluation and the batch kernels
+     *          of every tier agree bit for bit. The one exception is a scalar build (`FORCE_SCALAR`) whose own code
+     *          is compiled with FMA and floating point contraction, where the compiler may fuse that sum.
+     */
+    enum class Precision : std::uint8_t
+    {
+        Fast,    ///< Hardware estimate, no refinement. About 12 correct bits for `float`.
+        Refined, ///< Estimate followed by one Newton-Raphson step.
+        Exact    ///< Correctly rounded square root and divide, giving the same bits on every path.
+    };
+
+
+    /**
+     * @brief How a reduction accumulates a long run of floating point terms.
+     * @details Every mode keeps several independent accumulators to hide the latency of the adds, so even
+     *          @ref Plain does not add the terms in index order. Its error grows with the number of terms, $ O(n) $
+     *          units of rounding in the worst case. @ref Pairwise adds blocks in a balanced tree, growing the error as
+     *          $ O(\log n) $ for the cost of some recursion, and @ref Compensated carries the rounding error of every
+     *          add (Kahan summation), keeping it independent of $ n $ at roughly four times the arithmetic.
+     */
+    enum class Summation : std::uint8_t
+    {
+        Plain,      ///< Independent running sums, fastest.
+        Pairwise,   ///< Running sums over blocks, blocks added in a balanced tree.
+        Compensated ///< Kahan summation in every accumulator.
+    };
+
+
+    /**
+     * @brief Documented maximum error of a component normalized at @p precision.
+     *
+     * @tparam T Component type, `float` or `double`.
+     *
+     * @param[in] precision Accuracy tier.
+     *
+     * @return The bound in units in the last place of `T`.
+     */
+    template <typename T>
+    [[nodiscard]] constexpr std::uint32_t maxUlpError(const Precision precision) noexcept
+    {
+        static_assert(std::is_floating_point_v<T>, "Normalization error is defined for floating point components");
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (precision == Precision::Fast)
+                return 6144;
+            if (precision == Precision::Refined)
+                return 6;
+        }
+        return 4;
+    }
+
+    /** @} */
+
+} // namespace falcon::simd
@@ -0,0 +1,197 @@
+#pragma once
+/**
+ * @file Quantize.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Scalar quantization of `float` values to normalized integers, 10:10:10:2 fields and octahedral coordinates.
+ * @details These are the reference operations of the quantize batch kernels: each kernel lane performs the same
+ *          floating point operations in the same order, so encoding gives identical integers on every tier.
+ *          Rounding is to nearest even and uses integer arithmetic only, independent of MXCSR.
+ *
+ * @par ODR note
+ * Like SIMD.h, these functions live in the `FALCON_SIMD_ISA` inline namespace: the kernel tiers compile them with
+ * their own `-m` flags, and the linker must not merge those copies with the baseline ones.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMD.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+
+namespace falcon::simd::inline FALCON_SIMD_ISA
+{
+    /**
+     * @addtogroup SIMD_Quantize
+     * @{
+     */
+
+    /** @brief Scale between `[-1, 1]` or `[0, 1]` and the normalized integer `Q`: its largest value. */
+    template <std::integral Q>
+    inline constexpr float normalizedScale = static_cast<float>(std::numeric_limits<Q>::max());
+
+    /** @brief Scale of the signed 10-bit fields of a 10:10:10:2 value. */
+    inline constexpr float snorm10Scale = 511.0f;
+
+    /** @brief Scale of the unsigned 10-bit fields of a 10:10:10:2 value. */
+    inline constexpr float unorm10Scale = 1023.0f;
+
+
+    /**
+     * @brief Round @p value to the nearest integer, ties to even.
+     * @warning @p value must be finite and below `2^23` in magnitude, as every scaled value here is.
+     */
+    [[nodiscard]] constexpr std::int32_t roundToNearestEven(const float value) noexcept
+    {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        const std::uint32_t exponent = (bits >> 23) & 0xFFu;
+        if (exponent < 126) // Below one half
+            return 0;
+
+        // value = mantissa * 2^(exponent - 150), so drop the (150 - exponent) fraction bits and round on them.
+        const std::uint32_t mantissa = (bits & 0x7FFFFFu) | 0x800000u;
+        const std::uint32_t shift = 150 - exponent;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        std::uint32_t units = mantissa >> shift;
+        if (remainder > halfway || (remainder == halfway && (units & 1u)))
+            ++units;
+
+        const auto magnitude = static_cast<std::int32_t>(units);
+        return bits >> 31 ? -magnitude : magnitude;
+    }
+
+
+    /**
+     * @brief Signed normalized integer of @p value: clamped to `[-1, 1]`, scaled by @p scale and rounded.
+     * @details NaN encodes to `0`.
+     */
+    [[nodiscard]] constexpr std::int32_t quantizeSnorm(const float value, const float scale) noexcept
+    {
+        const float ordered = value == value ? value : 0.0f;
+        const float clamped = ordered < -1.0f ? -1.0f : ordered > 1.0f ? 1.0f : ordered;
+        return roundToNearestEven(clamped * scale);
+    }
+
+
+    /**
+     * @brief Unsigned normalized integer of @p value: clamped to `[0, 1]`, scaled by @p scale and rounded.
+     * @details NaN encodes to `0`.
+     */
+    [[nodiscard]] constexpr std::int32_t quantizeUnorm(const float value, const float scale) noexcept
+    {
+        const float ordered = value == value ? value : 0.0f;
+        const float clamped = ordered < 0.0f ? 0.0f : ordered > 1.0f ? 1.0f : ordered;
+        return roundToNearestEven(clamped * scale);
+    }
+
+
+    /**
+     * @brief Value of the signed normalized integer @p quantized, `quantized / scale`.
+     * @details The most negative integer, one step past `-scale`, decodes to `-1` as well.
+     */
+    [[nodiscard]] constexpr float dequantizeSnorm(const std::int32_t quantized, const float scale) noexcept
+    {
+        const float value = static_cast<float>(quantized) / scale;
+        return value < -1.0f ? -1.0f : value;
+    }
+
+
+    /** @brief Value of the unsigned normalized integer @p quantized, `quantized / scale`. */
+    [[nodiscard]] constexpr float dequantizeUnorm(const std::int32_t quantized, const float scale) noexcept
+    {
+        return static_cast<float>(quantized) / scale;
+    }
+
+
+    /**
+     * @brief Pack four fields into a 10:10:10:2 value, @p x in the low bits and @p w in the top two.
+     * @details Each field keeps its low 10 (or 2) bits, so signed fields are stored in two's complement.
+     */
+    [[nodiscard]] constexpr std::uint32_t pack1010102(const std::int32_t x, const std::int32_t y, const std::int32_t z,
+                                                      const std::int32_t w) noexcept
+    {
+        return (static_cast<std::uint32_t>(x) & 0x3FFu) | (static_cast<std::uint32_t>(y) & 0x3FFu) << 10 |
+               (static_cast<std::uint32_t>(z) & 0x3FFu) << 20 | static_cast<std::uint32_t>(w) << 30;
+    }
+
+
+    /** @brief Unsigned fields `{x, y, z, w}` of the 10:10:10:2 value @p packed. */
+    [[nodiscard]] constexpr std::array<std::int32_t, 4> unpackUnsigned1010102(const std::uint32_t packed) noexcept
+    {
+        return { static_cast<std::int32_t>(packed & 0x3FFu), static_cast<std::int32_t>((packed >> 10) & 0x3FFu),
+                 static_cast<std::int32_t>((packed >> 20) & 0x3FFu), static_cast<std::int32_t>(packed >> 30) };
+    }
+
+
+    /** @brief Sign extended fields `{x, y, z, w}` of the 10:10:10:2 value @p packed. */
+    [[nodiscard]] constexpr std::array<std::int32_t, 4> unpackSigned1010102(const std::uint32_t packed) noexcept
+    {
+        // Move each field to the top bits, then shift it back down arithmetically.
+        return { static_cast<std::int32_t>(packed << 22) >> 22, static_cast<std::int32_t>(packed << 12) >> 22,
+                 static_cast<std::int32_t>(packed << 2) >> 22, static_cast<std::int32_t>(packed) >> 30 };
+    }
+
+
+    /** @brief @p value with its sign bit cleared. */
+    [[nodiscard]] constexpr float clearSign(const float value) noexcept
+    {
+        return std::bit_cast<float>(std::bit_cast<std::uint32_t>(value) & 0x7FFFFFFFu);
+    }
+
+
+    /**
+     * @brief Map the direction of `(x, y, z)` onto the octahedral square `[-1, 1]^2`.
+     * @details Projects onto the octahedron `|x| + |y| + |z| = 1`, then folds the lower half (`z < 0`) over the
+     *          diagonals of the square. A zero or NaN vector gives NaN coordinates, which quantize to `0`: the
+     *          `+z` axis.
+     *
+     * @param[out] u, v Octahedral coordinates, not yet quantized.
+     */
+    constexpr void toOctahedral(const float x, const float y, const float z, float& u, float& v) noexcept
+    {
+        const float sum = clearSign(x) + clearSign(y) + clearSign(z);
+        u = x / sum;
+        v = y / sum;
+        if (z < 0.0f)
+        {
+            const float foldedU = 1.0f - clearSign(v);
+            const float foldedV = 1.0f - clearSign(u);
+            u = u < 0.0f ? 0.0f - foldedU : foldedU;
+            v = v < 0.0f ? 0.0f - foldedV : foldedV;
+        }
+    }
+
+
+    /**
+     * @brief Unit vector of the octahedral coordinates `(u, v)`, inverting @ref toOctahedral.
+     *
+     * @param[out] x, y, z Components of the unit vector.
+     */
+    inline void fromOctahedral(float u, float v, float& x, float& y, float& z) noexcept
+    {
+        z = 1.0f - clearSign(u) - clearSign(v);
+
+        // Unfold the lower half: push u and v back towards the axes by how far z went below zero.
+        const float negated = 0.0f - z;
+        const float below = negated > 0.0f ? negated : 0.0f;
+        u = u < 0.0f ? u + below : u - below;
+        v = v < 0.0f ? v + below : v - below;
+
+        const float length = std::sqrt(u * u + v * v + z * z);
+        x = u / length;
+        y = v / length;
+        z = z / length;
+    }
+
+    /** @} */
+
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
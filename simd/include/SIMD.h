@@ -15,7 +15,14 @@
  * Make sure compiler flags are turned on:
  * -mavx2 (GCC/Clang) or /arch:AVX2(MSVC) for turning on AVX2 support
  * -mavx512 (GCC/Clang) or /arch:AVX512 (MSVC) for turning on AVX512 supported.
- * @note If you compile using the supplied CMakeList.txt, then, it will turn on the flag supported by the CPU.
+ * @note If you compile using the supplied CMakeList.txt, the instruction set is taken from `FALCON_SIMD_BASELINE`,
+ *       which should be the oldest CPU the binary ships to. Use Dispatch.h for kernels that should pick up newer
+ *       instruction sets at runtime.
+ *
+ * @par ODR note
+ * Everything here lives in an inline namespace named after the enabled instruction set (see `FALCON_SIMD_ISA`), so
+ * translation units compiled with different `-m` flags can be linked into one binary without the linker merging
+ * their inline functions.
  *
  * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
  */
@@ -25,7 +32,19 @@
 
 #include <concepts>
 #include <cstddef>
-#include <immintrin.h>
+#include <cstdint>
+#include <type_traits>
+
+// GCC 12 reports the self-initialized placeholders of the AVX-512 intrinsics as uninitialized once inlined.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ == 12
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    #include <immintrin.h>
+    #pragma GCC diagnostic pop
+#else
+    #include <immintrin.h>
+#endif
 
 
 /**************************************
@@ -75,14 +94,28 @@
     #endif
 #endif
 
+// Width in bytes of the widest register of the enabled instruction set, 0 without SIMD. Usable in `#if`.
 #ifdef FALCON_AVX512_SUPPORTED
-    #define MAX_HARDWARE_ALIGNMENT = 64;
+    #define MAX_HARDWARE_ALIGNMENT 64
 #elif defined(FALCON_AVX2_SUPPORTED) || defined(FALCON_AVX_SUPPORTED)
-    #define MAX_HARDWARE_ALIGNMENT = 32;
+    #define MAX_HARDWARE_ALIGNMENT 32
 #elif defined(FALCON_SSE_SUPPORTED)
-    #define MAX_HARDWARE_ALIGNMENT = 16;
+    #define MAX_HARDWARE_ALIGNMENT 16
+#else
+    #define MAX_HARDWARE_ALIGNMENT 0
+#endif
+
+// Name of the inline namespace holding the register abstractions for the enabled instruction set.
+#ifdef FALCON_AVX512_SUPPORTED
+    #define FALCON_SIMD_ISA avx512
+#elif defined(FALCON_AVX2_SUPPORTED)
+    #define FALCON_SIMD_ISA avx2
+#elif defined(FALCON_AVX_SUPPORTED)
+    #define FALCON_SIMD_ISA avx
+#elif defined(FALCON_SIMD_SUPPORTED)
+    #define FALCON_SIMD_ISA sse
 #else
-    #define MAX_HARDWARE_ALIGNMENT = 0;
+    #define FALCON_SIMD_ISA scalar
 #endif
 
 
@@ -92,8 +125,16 @@
  *           SIMD Registers           *
  *                                    *
  **************************************/
-namespace falcon::simd
+namespace falcon::simd::inline FALCON_SIMD_ISA
 {
+    /**
+     * @brief Width in bytes of the widest register of the enabled instruction set, `0` without SIMD.
+     * @details The `constexpr` counterpart of `MAX_HARDWARE_ALIGNMENT`. It changes with the `-m` and `FORCE_*` flags of
+     *          the translation unit, so it lives in the instruction set namespace like every register type.
+     */
+    inline constexpr std::size_t maxHardwareAlignment = MAX_HARDWARE_ALIGNMENT;
+
+
     template <typename T, std::size_t RegWidth>
     struct RegisterMap;
 
@@ -152,10 +193,480 @@ namespace falcon::simd
         using type = __m512i;
     };
 
+
+
+
+    /**************************************
+     *                                    *
+     *         REGISTER ABSTRACTION       *
+     *                                    *
+     **************************************/
+
+    /** @brief Lane types a @ref Register can hold: `float`, `double` and non-`bool` integers of 1, 2, 4 or 8 bytes. */
+    template <typename T>
+    concept RegisterLane = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+        (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
+
+
+    /**
+     * @brief True if a @ref Register of `T` and `Width` bytes is enabled for this translation unit.
+     * @details 16-byte registers need SSE4.1, 32-byte floating point registers need AVX and 32-byte integer
+     *          registers need AVX2. 64-byte registers need AVX-512F, plus AVX-512BW for 1 and 2 byte lanes.
+     *
+     * @tparam T     Lane type.
+     * @tparam Width Register width in bytes.
+     */
+    template <typename T, std::size_t Width>
+    inline constexpr bool isRegisterSupported = []
+    {
+        if constexpr (!RegisterLane<T>)
+            return false;
+        else if constexpr (Width == 16)
+        {
+#if defined(FALCON_SSE_SUPPORTED) && defined(__SSE4_1__)
+            return true;
+#else
+            return false;
+#endif
+        }
+        else if constexpr (Width == 32 && std::is_floating_point_v<T>)
+        {
+#ifdef FALCON_AVX_SUPPORTED
+            return true;
+#else
+            return false;
+#endif
+        }
+        else if constexpr (Width == 32)
+        {
+#ifdef FALCON_AVX2_SUPPORTED
+            return true;
+#else
+            return false;
+#endif
+        }
+        else if constexpr (Width == 64 && sizeof(T) < 4)
+        {
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512BW__)
+            return true;
+#else
+            return false;
+#endif
+        }
+        else if constexpr (Width == 64)
+        {
+#ifdef FALCON_AVX512_SUPPORTED
+            return true;
+#else
+            return false;
+#endif
+        }
+        else
+            return false;
+    }();
+
+
+    /** @brief Lane predicates evaluated by @ref Register::compare. Floating point predicates follow C++ `NaN` rules. */
+    enum class Comparison
+    {
+        Equal,
+        NotEqual,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual
+    };
+
+
+    /**
+     * @brief Maps a comparison of `Width`-byte registers of `T` onto its native mask type.
+     * @details Narrower registers keep a register of the same type with all bits of a lane set when the
+     *          predicate holds, as produced by `cmp` intrinsics.
+     *
+     * @tparam T     Lane type of the compared registers.
+     * @tparam Width Register width in bytes.
+     */
+    template <typename T, std::size_t Width>
+    struct MaskMap
+    {
+        using type = typename RegisterMap<T, Width>::type;
+    };
+
+
+    /** @brief 64-byte registers compare into an AVX-512 `__mmask` with one bit per lane. */
+    template <typename T>
+    struct MaskMap<T, 64>
+    {
+        static constexpr std::size_t lanes = 64 / sizeof(T);
+
+        using type = std::conditional_t<
+            lanes == 8, __mmask8,
+            std::conditional_t<lanes == 16, __mmask16, std::conditional_t<lanes == 32, __mmask32, __mmask64>>>;
+    };
+
+
+    /**
+     * @brief Per-lane result of a @ref Register comparison.
+     *
+     * @tparam T     Lane type of the compared registers.
+     * @tparam Width Register width in bytes.
+     */
+    template <RegisterLane T, std::size_t Width>
+    struct Mask
+    {
+        /** @brief Number of lanes covered by the mask. */
+        static constexpr std::size_t lanes = Width / sizeof(T);
+
+        /** @brief Native mask type. See @ref MaskMap. */
+        using native_type = typename MaskMap<T, Width>::type;
+
+        native_type native;
+
+
+        /**
+         * @brief Collapse the mask to one bit per lane.
+         *
+         * @return Bitmask with bit `i` set when lane `i` is set.
+         */
+        [[nodiscard]] std::uint64_t bits() const noexcept;
+
+
+        /** @return True if every lane is set. */
+        [[nodiscard]] bool all() const noexcept;
+
+
+        /** @return True if at least one lane is set. */
+        [[nodiscard]] bool any() const noexcept;
+
+
+        /** @return True if no lane is set. */
+        [[nodiscard]] bool none() const noexcept;
+
+
+        /**
+         * @brief Combine two masks lane-wise.
+         *
+         * @param[in] rhs Mask to combine with.
+         *
+         * @return Mask set where both masks are set.
+         */
+        [[nodiscard]] Mask operator&(const Mask& rhs) const noexcept;
+
+
+        /**
+         * @brief Combine two masks lane-wise.
+         *
+         * @param[in] rhs Mask to combine with.
+         *
+         * @return Mask set where either mask is set.
+         */
+        [[nodiscard]] Mask operator|(const Mask& rhs) const noexcept;
+
+
+        /**
+         * @brief Invert every lane.
+         *
+         * @return Mask set where this mask is clear.
+         */
+        [[nodiscard]] Mask operator~() const noexcept;
+    };
+
+
+    /**
+     * @brief SIMD register value type holding `Width / sizeof(T)` lanes of `T`.
+     * @details Every operation resolves at compile time to the SSE, AVX, AVX2 or AVX-512 intrinsic for `T` and `Width`,
+     *          so kernels written against @ref Register compile once per instruction set instead of being rewritten.
+     *          Operations without a native instruction (64-bit integer multiply, min, max and abs below AVX-512, 8-bit
+     *          multiply) are composed from the native ones.
+     *
+     * @tparam T     Lane type. Must satisfy @ref RegisterLane.
+     * @tparam Width Register width in bytes: 16, 32 or 64.
+     *
+     * @note Only usable when @ref isRegisterSupported holds. `FORCE_*` macros lower the widest usable `Width`.
+     */
+    template <RegisterLane T, std::size_t Width>
+    struct Register
+    {
+        static_assert(isRegisterSupported<T, Width>, "Register width is not enabled for this instruction set.");
+
+        using value_type = T;
+        using native_type = typename RegisterMap<T, Width>::type;
+        using mask_type = Mask<T, Width>;
+
+        /** @brief Register width in bytes. */
+        static constexpr std::size_t width = Width;
+
+        /** @brief Number of `T` lanes in the register. */
+        static constexpr std::size_t lanes = Width / sizeof(T);
+
+        native_type native;
+
+
+
+        /**
+         * @addtogroup SIMD_Register_Memory
+         * @{
+         */
+
+        /**
+         * @brief Load `lanes` values from `Width`-aligned memory.
+         *
+         * @param[in] src Source address. Must be aligned to `Width` bytes.
+         *
+         * @return Register holding `src[0 .. lanes)`.
+         */
+        [[nodiscard]] static Register load(const T* src) noexcept;
+
+
+        /**
+         * @brief Load `lanes` values from memory without alignment requirements.
+         *
+         * @param[in] src Source address.
+         *
+         * @return Register holding `src[0 .. lanes)`.
+         */
+        [[nodiscard]] static Register loadUnaligned(const T* src) noexcept;
+
+
+        /**
+         * @brief Load the first @p count values and zero the remaining lanes.
+         * @details Lanes past @p count are never read, so a tail shorter than a register can be loaded in place.
+         *
+         * @param[in] src   Source address. No alignment requirement.
+         * @param[in] count Number of lanes to load. Clamped to `lanes`.
+         *
+         * @return Register holding `src[0 .. count)` followed by zeros.
+         */
+        [[nodiscard]] static Register loadMasked(const T* src, std::size_t count) noexcept;
+
+
+        /**
+         * @brief Store every lane to `Width`-aligned memory.
+         *
+         * @param[out] dest Destination address. Must be aligned to `Width` bytes.
+         */
+        void store(T* dest) const noexcept;
+
+
+        /**
+         * @brief Store every lane to memory without alignment requirements.
+         *
+         * @param[out] dest Destination address.
+         */
+        void storeUnaligned(T* dest) const noexcept;
+
+
+        /**
+         * @brief Store the first @p count lanes, leaving the memory past them untouched.
+         *
+         * @param[out] dest  Destination address. No alignment requirement.
+         * @param[in]  count Number of lanes to store. Clamped to `lanes`.
+         */
+        void storeMasked(T* dest, std::size_t count) const noexcept;
+
+
+        /**
+         * @brief Store every lane to `Width`-aligned memory, bypassing the cache.
+         * @details Non-temporal stores avoid evicting useful lines when writing outputs larger than the cache that
+         *          will not be read back soon. Call @ref storeFence before other threads read the data.
+         *
+         * @param[out] dest Destination address. Must be aligned to `Width` bytes.
+         */
+        void storeStream(T* dest) const noexcept;
+
+
+        /**
+         * @brief Set every lane to @p value.
+         *
+         * @param[in] value Value to broadcast.
+         *
+         * @return Register with @p value in every lane.
+         */
+        [[nodiscard]] static Register broadcast(T value) noexcept;
+
+
+        /**
+         * @brief Create a register with every lane set to zero.
+         *
+         * @return Zeroed register.
+         */
+        [[nodiscard]] static Register setzero() noexcept;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup SIMD_Register_Arithmetic
+         * @{
+         */
+
+        /**
+         * @brief Add two registers lane-wise.
+         *
+         * @param[in] rhs Register to add.
+         *
+         * @return Lane-wise sum. Integer lanes wrap.
+         */
+        [[nodiscard]] Register operator+(const Register& rhs) const noexcept;
+
+
+        /**
+         * @brief Subtract two registers lane-wise.
+         *
+         * @param[in] rhs Register to subtract.
+         *
+         * @return Lane-wise difference. Integer lanes wrap.
+         */
+        [[nodiscard]] Register operator-(const Register& rhs) const noexcept;
+
+
+        /**
+         * @brief Multiply two registers lane-wise.
+         *
+         * @param[in] rhs Register to multiply by.
+         *
+         * @return Lane-wise product. Integer lanes keep the low bits of the product.
+         */
+        [[nodiscard]] Register operator*(const Register& rhs) const noexcept;
+
+
+        /**
+         * @brief Divide two registers lane-wise.
+         *
+         * @param[in] rhs Register to divide by.
+         *
+         * @return Lane-wise quotient.
+         *
+         * @note Only floating point lanes have a division instruction.
+         */
+        [[nodiscard]] Register operator/(const Register& rhs) const noexcept
+            requires std::is_floating_point_v<T>;
+
+
+        /**
+         * @brief Select the smaller lane of two registers.
+         *
+         * @param[in] lhs First register.
+         * @param[in] rhs Second register.
+         *
+         * @return Lane-wise minimum. For floating point lanes, @p rhs is returned where either lane is `NaN`.
+         */
+        [[nodiscard]] static Register min(const Register& lhs, const Register& rhs) noexcept;
+
+
+        /**
+         * @brief Select the larger lane of two registers.
+         *
+         * @param[in] lhs First register.
+         * @param[in] rhs Second register.
+         *
+         * @return Lane-wise maximum. For floating point lanes, @p rhs is returned where either lane is `NaN`.
+         */
+        [[nodiscard]] static Register max(const Register& lhs, const Register& rhs) noexcept;
+
+
+        /**
+         * @brief Compute the absolute value of every lane.
+         *
+         * @param[in] reg Register to take the absolute value of.
+         *
+         * @return Lane-wise $ |a| $. Unsigned lanes are returned unchanged and the most negative integer wraps.
+         */
+        [[nodiscard]] static Register abs(const Register& reg) noexcept;
+
+
+        /**
+         * @brief Compute $ a \cdot b + c $ lane-wise.
+         *
+         * @param[in] a First factor.
+         * @param[in] b Second factor.
+         * @param[in] c Addend.
+         *
+         * @return Lane-wise fused multiply-add. Rounds once when FMA is enabled, otherwise falls back to a multiply
+         *         followed by an add.
+         */
+        [[nodiscard]] static Register fma(const Register& a, const Register& b, const Register& c) noexcept;
+
+
+        /**
+         * @brief Compute the square root of every lane.
+         *
+         * @param[in] reg Register to take the square root of.
+         *
+         * @return Lane-wise $ \sqrt{a} $, correctly rounded. Negative lanes produce NaN.
+         */
+        [[nodiscard]] static Register sqrt(const Register& reg) noexcept
+            requires std::is_floating_point_v<T>;
+
+
+        /**
+         * @brief Estimate the reciprocal square root of every lane.
+         *
+         * @param[in] reg Register to take the reciprocal square root of.
+         *
+         * @return Lane-wise $ 1 / \sqrt{a} $. `float` lanes use the hardware estimate, with a relative error of at
+         *         most $ 1.5 \cdot 2^{-12} $ ($ 2^{-14} $ on 64-byte registers); refine it with a Newton-Raphson step
+         *         where that is not enough. `double` lanes have no estimate below AVX-512 and are computed as a
+         *         correctly rounded divide by @ref sqrt on every width.
+         */
+        [[nodiscard]] static Register rsqrt(const Register& reg) noexcept
+            requires std::is_floating_point_v<T>;
+
+        /** @} */
+
+
+
+        /**
+         * @addtogroup SIMD_Register_Comparison
+         * @{
+         */
+
+        /**
+         * @brief Evaluate @p Op lane-wise.
+         *
+         * @tparam Op Predicate to evaluate.
+         *
+         * @param[in] lhs Left operand.
+         * @param[in] rhs Right operand.
+         *
+         * @return Mask set where $ lhs \; Op \; rhs $ holds.
+         */
+        template <Comparison Op>
+        [[nodiscard]] static mask_type compare(const Register& lhs, const Register& rhs) noexcept;
+
+
+        /**
+         * @brief Pick lanes from two registers.
+         *
+         * @param[in] ifClear Register supplying lanes where @p mask is clear.
+         * @param[in] ifSet   Register supplying lanes where @p mask is set.
+         * @param[in] mask    Lane selector.
+         *
+         * @return Register with lane `i` taken from @p ifSet when lane `i` of @p mask is set.
+         */
+        [[nodiscard]] static Register blend(const Register& ifClear, const Register& ifSet,
+                                            const mask_type& mask) noexcept;
+
+        /** @} */
+    };
+
+
+    /** @brief Order every preceding @ref Register::storeStream before later stores. */
+    inline void storeFence() noexcept
+    {
+        _mm_sfence();
+    }
+
+
 #if defined(MAX_ALIGNMENT) && MAX_ALIGNMENT > 0
     const PackingParams packingParams = calculatePackedSize(TotalBytes, MAX_ALIGNMENT);
 #endif
 
 
 
-} // namespace falcon::simd
\ No newline at end of file
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
+
+
+#include "SIMD.tpp"
\ No newline at end of file
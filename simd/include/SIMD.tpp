@@ -0,0 +1,1384 @@
+#pragma once
+/**
+ * @file SIMD.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: March 07, 2026
+ *
+ * @brief @ref falcon::simd::Register and @ref falcon::simd::Mask template implementation.
+ * @details Every member selects its intrinsic with `if constexpr` on the lane type and width, so only the branch for
+ *          the instantiated register is compiled.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMD.h"
+
+#include <algorithm>
+
+
+namespace falcon::simd::inline FALCON_SIMD_ISA
+{
+
+    /*************************************
+     *                                   *
+     *              HELPERS              *
+     *                                   *
+     *************************************/
+
+    namespace detail
+    {
+
+#ifdef FALCON_AVX_SUPPORTED
+        inline constexpr bool avxEnabled = true;
+#else
+        inline constexpr bool avxEnabled = false;
+#endif
+
+#ifdef FALCON_AVX2_SUPPORTED
+        inline constexpr bool avx2Enabled = true;
+#else
+        inline constexpr bool avx2Enabled = false;
+#endif
+
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512VL__)
+        inline constexpr bool avx512VLEnabled = true;
+#else
+        inline constexpr bool avx512VLEnabled = false;
+#endif
+
+#if defined(FALCON_AVX512_SUPPORTED) && defined(__AVX512DQ__)
+        inline constexpr bool avx512DQEnabled = true;
+#else
+        inline constexpr bool avx512DQEnabled = false;
+#endif
+
+#if defined(FALCON_AVX_SUPPORTED) && defined(__FMA__)
+        inline constexpr bool fmaEnabled = true;
+#else
+        inline constexpr bool fmaEnabled = false;
+#endif
+
+
+        /** @brief Signed integer of `Size` bytes, used to pass integer lanes to `set1` intrinsics. */
+        template <std::size_t Size>
+        using LaneInt = std::conditional_t<
+            Size == 1, char,
+            std::conditional_t<Size == 2, short, std::conditional_t<Size == 4, int, long long>>>;
+
+
+        /**
+         * @brief Set the low @p count bits.
+         *
+         * @param[in] count Number of bits to set, up to 64.
+         *
+         * @return Bitmask with bits `[0, count)` set.
+         */
+        constexpr std::uint64_t lowBits(const std::size_t count) noexcept
+        {
+            return count >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+        }
+
+
+        /**
+         * @brief Build an AVX2 `maskload`/`maskstore` selector with the first @p count 4 or 8-byte lanes set.
+         *
+         * @tparam LaneSize Lane size in bytes, 4 or 8.
+         * @tparam Width    Register width in bytes, 16 or 32.
+         *
+         * @param[in] count Number of leading lanes to select.
+         *
+         * @return Integer register with every bit of lanes `[0, count)` set.
+         */
+        template <std::size_t LaneSize, std::size_t Width>
+        auto firstLanes(const std::size_t count) noexcept
+        {
+            if constexpr (LaneSize == 4 && Width == 16)
+                return _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(count)), _mm_setr_epi32(0, 1, 2, 3));
+            else if constexpr (LaneSize == 4)
+                return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)),
+                                          _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            else if constexpr (Width == 16)
+                return _mm_cmpgt_epi64(_mm_set1_epi64x(static_cast<long long>(count)), _mm_set_epi64x(1, 0));
+            else
+                return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(count)),
+                                          _mm256_setr_epi64x(0, 1, 2, 3));
+        }
+
+    } // namespace detail
+
+
+
+
+    /*************************************
+     *                                   *
+     *               MASK                *
+     *                                   *
+     *************************************/
+
+    template <RegisterLane T, std::size_t Width>
+    std::uint64_t Mask<T, Width>::bits() const noexcept
+    {
+        if constexpr (Width == 64)
+            return static_cast<std::uint64_t>(native);
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(_mm_movemask_ps(native));
+            else
+                return static_cast<std::uint64_t>(_mm256_movemask_ps(native));
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(_mm_movemask_pd(native));
+            else
+                return static_cast<std::uint64_t>(_mm256_movemask_pd(native));
+        }
+        else if constexpr (sizeof(T) == 8)
+        {
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(native)));
+            else
+                return static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(native)));
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(native)));
+            else
+                return static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(native)));
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            /** @note Saturating packs turn each all-ones 16-bit lane into an all-ones byte before the byte movemask. */
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_packs_epi16(native, _mm_setzero_si128())));
+            else
+            {
+                // Packing works per 128-bit half: bits [0, 8) hold lanes 0-7 and bits [16, 24) hold lanes 8-15.
+                const auto packed = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_packs_epi16(native, _mm256_setzero_si256())));
+                return static_cast<std::uint64_t>((packed & 0xFFu) | ((packed >> 8) & 0xFF00u));
+            }
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(native)));
+            else
+                return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(native)));
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    bool Mask<T, Width>::all() const noexcept
+    {
+        return bits() == detail::lowBits(lanes);
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    bool Mask<T, Width>::any() const noexcept
+    {
+        return bits() != 0;
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    bool Mask<T, Width>::none() const noexcept
+    {
+        return bits() == 0;
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Mask<T, Width> Mask<T, Width>::operator&(const Mask& rhs) const noexcept
+    {
+        if constexpr (Width == 64)
+            return { static_cast<native_type>(native & rhs.native) };
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_and_ps(native, rhs.native) };
+            else
+                return { _mm256_and_ps(native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_and_pd(native, rhs.native) };
+            else
+                return { _mm256_and_pd(native, rhs.native) };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_and_si128(native, rhs.native) };
+        else
+            return { _mm256_and_si256(native, rhs.native) };
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Mask<T, Width> Mask<T, Width>::operator|(const Mask& rhs) const noexcept
+    {
+        if constexpr (Width == 64)
+            return { static_cast<native_type>(native | rhs.native) };
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_or_ps(native, rhs.native) };
+            else
+                return { _mm256_or_ps(native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_or_pd(native, rhs.native) };
+            else
+                return { _mm256_or_pd(native, rhs.native) };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_or_si128(native, rhs.native) };
+        else
+            return { _mm256_or_si256(native, rhs.native) };
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Mask<T, Width> Mask<T, Width>::operator~() const noexcept
+    {
+        if constexpr (Width == 64)
+            return { static_cast<native_type>(~native) };
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_xor_ps(native, _mm_castsi128_ps(_mm_set1_epi32(-1))) };
+            else
+                return { _mm256_xor_ps(native, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_xor_pd(native, _mm_castsi128_pd(_mm_set1_epi32(-1))) };
+            else
+                return { _mm256_xor_pd(native, _mm256_castsi256_pd(_mm256_set1_epi32(-1))) };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_xor_si128(native, _mm_set1_epi32(-1)) };
+        else
+            return { _mm256_xor_si256(native, _mm256_set1_epi32(-1)) };
+    }
+
+
+
+
+    /*************************************
+     *                                   *
+     *     LOAD, STORE AND INITIALIZE    *
+     *                                   *
+     *************************************/
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::load(const T* src) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_load_ps(src) };
+            else if constexpr (Width == 32)
+                return { _mm256_load_ps(src) };
+            else
+                return { _mm512_load_ps(src) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_load_pd(src) };
+            else if constexpr (Width == 32)
+                return { _mm256_load_pd(src) };
+            else
+                return { _mm512_load_pd(src) };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_load_si128(reinterpret_cast<const __m128i*>(src)) };
+        else if constexpr (Width == 32)
+            return { _mm256_load_si256(reinterpret_cast<const __m256i*>(src)) };
+        else
+            return { _mm512_load_si512(src) };
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::loadUnaligned(const T* src) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_loadu_ps(src) };
+            else if constexpr (Width == 32)
+                return { _mm256_loadu_ps(src) };
+            else
+                return { _mm512_loadu_ps(src) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_loadu_pd(src) };
+            else if constexpr (Width == 32)
+                return { _mm256_loadu_pd(src) };
+            else
+                return { _mm512_loadu_pd(src) };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)) };
+        else if constexpr (Width == 32)
+            return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)) };
+        else
+            return { _mm512_loadu_si512(src) };
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::loadMasked(const T* src, std::size_t count) noexcept
+    {
+        count = std::min(count, lanes);
+
+        if constexpr (Width == 64)
+        {
+            const auto mask = static_cast<typename mask_type::native_type>(detail::lowBits(count));
+            if constexpr (std::is_same_v<T, float>)
+                return { _mm512_maskz_loadu_ps(mask, src) };
+            else if constexpr (std::is_same_v<T, double>)
+                return { _mm512_maskz_loadu_pd(mask, src) };
+            else if constexpr (sizeof(T) == 8)
+                return { _mm512_maskz_loadu_epi64(mask, src) };
+            else if constexpr (sizeof(T) == 4)
+                return { _mm512_maskz_loadu_epi32(mask, src) };
+            else if constexpr (sizeof(T) == 2)
+                return { _mm512_maskz_loadu_epi16(mask, src) };
+            else
+                return { _mm512_maskz_loadu_epi8(mask, src) };
+        }
+        else if constexpr (detail::avx2Enabled && sizeof(T) >= 4)
+        {
+            const auto selector = detail::firstLanes<sizeof(T), Width>(count);
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_maskload_ps(src, selector) };
+                else
+                    return { _mm256_maskload_ps(src, selector) };
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_maskload_pd(src, selector) };
+                else
+                    return { _mm256_maskload_pd(src, selector) };
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_maskload_epi32(reinterpret_cast<const int*>(src), selector) };
+                else
+                    return { _mm256_maskload_epi32(reinterpret_cast<const int*>(src), selector) };
+            }
+            else
+            {
+                if constexpr (Width == 16)
+                    return { _mm_maskload_epi64(reinterpret_cast<const long long*>(src), selector) };
+                else
+                    return { _mm256_maskload_epi64(reinterpret_cast<const long long*>(src), selector) };
+            }
+        }
+        else
+        {
+            /** @note Without a masked load instruction, stage the tail through an aligned, zeroed register image. */
+            alignas(Width) T staged[lanes] = {};
+            std::copy_n(src, count, staged);
+            return load(staged);
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    void Register<T, Width>::store(T* dest) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                _mm_store_ps(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_store_ps(dest, native);
+            else
+                _mm512_store_ps(dest, native);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                _mm_store_pd(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_store_pd(dest, native);
+            else
+                _mm512_store_pd(dest, native);
+        }
+        else if constexpr (Width == 16)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dest), native);
+        else if constexpr (Width == 32)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dest), native);
+        else
+            _mm512_store_si512(dest, native);
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    void Register<T, Width>::storeUnaligned(T* dest) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                _mm_storeu_ps(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_storeu_ps(dest, native);
+            else
+                _mm512_storeu_ps(dest, native);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                _mm_storeu_pd(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_storeu_pd(dest, native);
+            else
+                _mm512_storeu_pd(dest, native);
+        }
+        else if constexpr (Width == 16)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), native);
+        else if constexpr (Width == 32)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), native);
+        else
+            _mm512_storeu_si512(dest, native);
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    void Register<T, Width>::storeStream(T* dest) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                _mm_stream_ps(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_stream_ps(dest, native);
+            else
+                _mm512_stream_ps(dest, native);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                _mm_stream_pd(dest, native);
+            else if constexpr (Width == 32)
+                _mm256_stream_pd(dest, native);
+            else
+                _mm512_stream_pd(dest, native);
+        }
+        else if constexpr (Width == 16)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dest), native);
+        else if constexpr (Width == 32)
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dest), native);
+        else
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(dest), native);
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    void Register<T, Width>::storeMasked(T* dest, std::size_t count) const noexcept
+    {
+        count = std::min(count, lanes);
+
+        if constexpr (Width == 64)
+        {
+            const auto mask = static_cast<typename mask_type::native_type>(detail::lowBits(count));
+            if constexpr (std::is_same_v<T, float>)
+                _mm512_mask_storeu_ps(dest, mask, native);
+            else if constexpr (std::is_same_v<T, double>)
+                _mm512_mask_storeu_pd(dest, mask, native);
+            else if constexpr (sizeof(T) == 8)
+                _mm512_mask_storeu_epi64(dest, mask, native);
+            else if constexpr (sizeof(T) == 4)
+                _mm512_mask_storeu_epi32(dest, mask, native);
+            else if constexpr (sizeof(T) == 2)
+                _mm512_mask_storeu_epi16(dest, mask, native);
+            else
+                _mm512_mask_storeu_epi8(dest, mask, native);
+        }
+        else if constexpr (detail::avx2Enabled && sizeof(T) >= 4)
+        {
+            const auto selector = detail::firstLanes<sizeof(T), Width>(count);
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (Width == 16)
+                    _mm_maskstore_ps(dest, selector, native);
+                else
+                    _mm256_maskstore_ps(dest, selector, native);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                if constexpr (Width == 16)
+                    _mm_maskstore_pd(dest, selector, native);
+                else
+                    _mm256_maskstore_pd(dest, selector, native);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                if constexpr (Width == 16)
+                    _mm_maskstore_epi32(reinterpret_cast<int*>(dest), selector, native);
+                else
+                    _mm256_maskstore_epi32(reinterpret_cast<int*>(dest), selector, native);
+            }
+            else
+            {
+                if constexpr (Width == 16)
+                    _mm_maskstore_epi64(reinterpret_cast<long long*>(dest), selector, native);
+                else
+                    _mm256_maskstore_epi64(reinterpret_cast<long long*>(dest), selector, native);
+            }
+        }
+        else
+        {
+            alignas(Width) T staged[lanes];
+            store(staged);
+            std::copy_n(staged, count, dest);
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::broadcast(const T value) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_set1_ps(value) };
+            else if constexpr (Width == 32)
+                return { _mm256_set1_ps(value) };
+            else
+                return { _mm512_set1_ps(value) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_set1_pd(value) };
+            else if constexpr (Width == 32)
+                return { _mm256_set1_pd(value) };
+            else
+                return { _mm512_set1_pd(value) };
+        }
+        else
+        {
+            const auto lane = static_cast<detail::LaneInt<sizeof(T)>>(value);
+            if constexpr (sizeof(T) == 1)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_set1_epi8(lane) };
+                else if constexpr (Width == 32)
+                    return { _mm256_set1_epi8(lane) };
+                else
+                    return { _mm512_set1_epi8(lane) };
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_set1_epi16(lane) };
+                else if constexpr (Width == 32)
+                    return { _mm256_set1_epi16(lane) };
+                else
+                    return { _mm512_set1_epi16(lane) };
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_set1_epi32(lane) };
+                else if constexpr (Width == 32)
+                    return { _mm256_set1_epi32(lane) };
+                else
+                    return { _mm512_set1_epi32(lane) };
+            }
+            else
+            {
+                if constexpr (Width == 16)
+                    return { _mm_set1_epi64x(lane) };
+                else if constexpr (Width == 32)
+                    return { _mm256_set1_epi64x(lane) };
+                else
+                    return { _mm512_set1_epi64(lane) };
+            }
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::setzero() noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_setzero_ps() };
+            else if constexpr (Width == 32)
+                return { _mm256_setzero_ps() };
+            else
+                return { _mm512_setzero_ps() };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_setzero_pd() };
+            else if constexpr (Width == 32)
+                return { _mm256_setzero_pd() };
+            else
+                return { _mm512_setzero_pd() };
+        }
+        else if constexpr (Width == 16)
+            return { _mm_setzero_si128() };
+        else if constexpr (Width == 32)
+            return { _mm256_setzero_si256() };
+        else
+            return { _mm512_setzero_si512() };
+    }
+
+
+
+
+    /*************************************
+     *                                   *
+     *            ARITHMETIC             *
+     *                                   *
+     *************************************/
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::operator+(const Register& rhs) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_ps(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_ps(native, rhs.native) };
+            else
+                return { _mm512_add_ps(native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_pd(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_pd(native, rhs.native) };
+            else
+                return { _mm512_add_pd(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_epi8(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_epi8(native, rhs.native) };
+            else
+                return { _mm512_add_epi8(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_epi16(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_epi16(native, rhs.native) };
+            else
+                return { _mm512_add_epi16(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_epi32(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_epi32(native, rhs.native) };
+            else
+                return { _mm512_add_epi32(native, rhs.native) };
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return { _mm_add_epi64(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_add_epi64(native, rhs.native) };
+            else
+                return { _mm512_add_epi64(native, rhs.native) };
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::operator-(const Register& rhs) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_ps(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_ps(native, rhs.native) };
+            else
+                return { _mm512_sub_ps(native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_pd(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_pd(native, rhs.native) };
+            else
+                return { _mm512_sub_pd(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_epi8(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_epi8(native, rhs.native) };
+            else
+                return { _mm512_sub_epi8(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_epi16(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_epi16(native, rhs.native) };
+            else
+                return { _mm512_sub_epi16(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_epi32(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_epi32(native, rhs.native) };
+            else
+                return { _mm512_sub_epi32(native, rhs.native) };
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return { _mm_sub_epi64(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sub_epi64(native, rhs.native) };
+            else
+                return { _mm512_sub_epi64(native, rhs.native) };
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::operator*(const Register& rhs) const noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_mul_ps(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_mul_ps(native, rhs.native) };
+            else
+                return { _mm512_mul_ps(native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_mul_pd(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_mul_pd(native, rhs.native) };
+            else
+                return { _mm512_mul_pd(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            /** @note No 8-bit multiply exists: multiply even and odd bytes as 16-bit lanes and merge the low bytes. */
+            if constexpr (Width == 16)
+            {
+                const __m128i even = _mm_mullo_epi16(native, rhs.native);
+                const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(native, 8), _mm_srli_epi16(rhs.native, 8));
+                return { _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0x00FF))) };
+            }
+            else if constexpr (Width == 32)
+            {
+                const __m256i even = _mm256_mullo_epi16(native, rhs.native);
+                const __m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(native, 8), _mm256_srli_epi16(rhs.native, 8));
+                const __m256i low = _mm256_and_si256(even, _mm256_set1_epi16(0x00FF));
+                return { _mm256_or_si256(_mm256_slli_epi16(odd, 8), low) };
+            }
+            else
+            {
+                const __m512i even = _mm512_mullo_epi16(native, rhs.native);
+                const __m512i odd = _mm512_mullo_epi16(_mm512_srli_epi16(native, 8), _mm512_srli_epi16(rhs.native, 8));
+                const __m512i low = _mm512_and_si512(even, _mm512_set1_epi16(0x00FF));
+                return { _mm512_or_si512(_mm512_slli_epi16(odd, 8), low) };
+            }
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { _mm_mullo_epi16(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_mullo_epi16(native, rhs.native) };
+            else
+                return { _mm512_mullo_epi16(native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { _mm_mullo_epi32(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_mullo_epi32(native, rhs.native) };
+            else
+                return { _mm512_mullo_epi32(native, rhs.native) };
+        }
+        else if constexpr (Width == 64 && detail::avx512DQEnabled)
+            return { _mm512_mullo_epi64(native, rhs.native) };
+        else if constexpr (Width == 32 && detail::avx512DQEnabled && detail::avx512VLEnabled)
+            return { _mm256_mullo_epi64(native, rhs.native) };
+        else if constexpr (Width == 16 && detail::avx512DQEnabled && detail::avx512VLEnabled)
+            return { _mm_mullo_epi64(native, rhs.native) };
+        else
+        {
+            /**
+             * @note Without AVX-512DQ, the low 64 bits of the product are assembled from three 32x32 multiplies:
+             *       $ a_{lo} b_{lo} + ((a_{hi} b_{lo} + a_{lo} b_{hi}) \ll 32) $.
+             */
+            if constexpr (Width == 16)
+            {
+                const __m128i low = _mm_mul_epu32(native, rhs.native);
+                const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(native, 32), rhs.native),
+                                                    _mm_mul_epu32(native, _mm_srli_epi64(rhs.native, 32)));
+                return { _mm_add_epi64(low, _mm_slli_epi64(cross, 32)) };
+            }
+            else if constexpr (Width == 32)
+            {
+                const __m256i low = _mm256_mul_epu32(native, rhs.native);
+                const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(native, 32), rhs.native),
+                                                       _mm256_mul_epu32(native, _mm256_srli_epi64(rhs.native, 32)));
+                return { _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32)) };
+            }
+            else
+            {
+                const __m512i low = _mm512_mul_epu32(native, rhs.native);
+                const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(native, 32), rhs.native),
+                                                       _mm512_mul_epu32(native, _mm512_srli_epi64(rhs.native, 32)));
+                return { _mm512_add_epi64(low, _mm512_slli_epi64(cross, 32)) };
+            }
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::operator/(const Register& rhs) const noexcept
+        requires std::is_floating_point_v<T>
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_div_ps(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_div_ps(native, rhs.native) };
+            else
+                return { _mm512_div_ps(native, rhs.native) };
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return { _mm_div_pd(native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_div_pd(native, rhs.native) };
+            else
+                return { _mm512_div_pd(native, rhs.native) };
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::min(const Register& lhs, const Register& rhs) noexcept
+    {
+        constexpr bool isSigned = std::is_signed_v<T>;
+
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_min_ps(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_min_ps(lhs.native, rhs.native) };
+            else
+                return { _mm512_min_ps(lhs.native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_min_pd(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_min_pd(lhs.native, rhs.native) };
+            else
+                return { _mm512_min_pd(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_min_epi8(lhs.native, rhs.native) : _mm_min_epu8(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_min_epi8(lhs.native, rhs.native) : _mm256_min_epu8(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_min_epi8(lhs.native, rhs.native) : _mm512_min_epu8(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_min_epi16(lhs.native, rhs.native) : _mm_min_epu16(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_min_epi16(lhs.native, rhs.native)
+                                  : _mm256_min_epu16(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_min_epi16(lhs.native, rhs.native)
+                                  : _mm512_min_epu16(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_min_epi32(lhs.native, rhs.native) : _mm_min_epu32(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_min_epi32(lhs.native, rhs.native)
+                                  : _mm256_min_epu32(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_min_epi32(lhs.native, rhs.native)
+                                  : _mm512_min_epu32(lhs.native, rhs.native) };
+        }
+        else if constexpr (Width == 64)
+            return { isSigned ? _mm512_min_epi64(lhs.native, rhs.native) : _mm512_min_epu64(lhs.native, rhs.native) };
+        else
+            return blend(lhs, rhs, compare<Comparison::Greater>(lhs, rhs));
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::max(const Register& lhs, const Register& rhs) noexcept
+    {
+        constexpr bool isSigned = std::is_signed_v<T>;
+
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_max_ps(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_max_ps(lhs.native, rhs.native) };
+            else
+                return { _mm512_max_ps(lhs.native, rhs.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_max_pd(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_max_pd(lhs.native, rhs.native) };
+            else
+                return { _mm512_max_pd(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_max_epi8(lhs.native, rhs.native) : _mm_max_epu8(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_max_epi8(lhs.native, rhs.native) : _mm256_max_epu8(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_max_epi8(lhs.native, rhs.native) : _mm512_max_epu8(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_max_epi16(lhs.native, rhs.native) : _mm_max_epu16(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_max_epi16(lhs.native, rhs.native)
+                                  : _mm256_max_epu16(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_max_epi16(lhs.native, rhs.native)
+                                  : _mm512_max_epu16(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { isSigned ? _mm_max_epi32(lhs.native, rhs.native) : _mm_max_epu32(lhs.native, rhs.native) };
+            else if constexpr (Width == 32)
+                return { isSigned ? _mm256_max_epi32(lhs.native, rhs.native)
+                                  : _mm256_max_epu32(lhs.native, rhs.native) };
+            else
+                return { isSigned ? _mm512_max_epi32(lhs.native, rhs.native)
+                                  : _mm512_max_epu32(lhs.native, rhs.native) };
+        }
+        else if constexpr (Width == 64)
+            return { isSigned ? _mm512_max_epi64(lhs.native, rhs.native) : _mm512_max_epu64(lhs.native, rhs.native) };
+        else
+            return blend(lhs, rhs, compare<Comparison::Less>(lhs, rhs));
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::abs(const Register& reg) noexcept
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_andnot_ps(_mm_set1_ps(-0.0f), reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), reg.native) };
+            else
+                return { _mm512_abs_ps(reg.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_andnot_pd(_mm_set1_pd(-0.0), reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_andnot_pd(_mm256_set1_pd(-0.0), reg.native) };
+            else
+                return { _mm512_abs_pd(reg.native) };
+        }
+        else if constexpr (std::is_unsigned_v<T>)
+            return reg;
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { _mm_abs_epi8(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_abs_epi8(reg.native) };
+            else
+                return { _mm512_abs_epi8(reg.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { _mm_abs_epi16(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_abs_epi16(reg.native) };
+            else
+                return { _mm512_abs_epi16(reg.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { _mm_abs_epi32(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_abs_epi32(reg.native) };
+            else
+                return { _mm512_abs_epi32(reg.native) };
+        }
+        else if constexpr (Width == 64)
+            return { _mm512_abs_epi64(reg.native) };
+        else if constexpr (Width == 32 && detail::avx512VLEnabled)
+            return { _mm256_abs_epi64(reg.native) };
+        else if constexpr (Width == 16 && detail::avx512VLEnabled)
+            return { _mm_abs_epi64(reg.native) };
+        else
+        {
+            const Register zero = setzero();
+            return blend(reg, zero - reg, compare<Comparison::Less>(reg, zero));
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::fma(const Register& a, const Register& b, const Register& c) noexcept
+    {
+        if constexpr (std::is_same_v<T, float> && Width == 64)
+            return { _mm512_fmadd_ps(a.native, b.native, c.native) };
+        else if constexpr (std::is_same_v<T, double> && Width == 64)
+            return { _mm512_fmadd_pd(a.native, b.native, c.native) };
+        else if constexpr (std::is_floating_point_v<T> && detail::fmaEnabled)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_fmadd_ps(a.native, b.native, c.native) };
+                else
+                    return { _mm256_fmadd_ps(a.native, b.native, c.native) };
+            }
+            else
+            {
+                if constexpr (Width == 16)
+                    return { _mm_fmadd_pd(a.native, b.native, c.native) };
+                else
+                    return { _mm256_fmadd_pd(a.native, b.native, c.native) };
+            }
+        }
+        else
+            return a * b + c;
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::sqrt(const Register& reg) noexcept
+        requires std::is_floating_point_v<T>
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_sqrt_ps(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sqrt_ps(reg.native) };
+            else
+                return { _mm512_sqrt_ps(reg.native) };
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return { _mm_sqrt_pd(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_sqrt_pd(reg.native) };
+            else
+                return { _mm512_sqrt_pd(reg.native) };
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::rsqrt(const Register& reg) noexcept
+        requires std::is_floating_point_v<T>
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_rsqrt_ps(reg.native) };
+            else if constexpr (Width == 32)
+                return { _mm256_rsqrt_ps(reg.native) };
+            else
+                return { _mm512_rsqrt14_ps(reg.native) };
+        }
+        else
+            return broadcast(T(1)) / sqrt(reg);
+    }
+
+
+
+
+    /*************************************
+     *                                   *
+     *      COMPARISON AND BLENDING      *
+     *                                   *
+     *************************************/
+
+    template <RegisterLane T, std::size_t Width>
+    template <Comparison Op>
+    Mask<T, Width> Register<T, Width>::compare(const Register& lhs, const Register& rhs) noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            /** @note Ordered predicates are false for `NaN` and `NotEqual` is unordered, matching C++ operators. */
+            constexpr int predicate = Op == Comparison::Equal ? _CMP_EQ_OQ
+                : Op == Comparison::NotEqual                  ? _CMP_NEQ_UQ
+                : Op == Comparison::Less                      ? _CMP_LT_OQ
+                : Op == Comparison::LessEqual                 ? _CMP_LE_OQ
+                : Op == Comparison::Greater                   ? _CMP_GT_OQ
+                                                              : _CMP_GE_OQ;
+
+            if constexpr (Width == 64)
+            {
+                if constexpr (std::is_same_v<T, float>)
+                    return { _mm512_cmp_ps_mask(lhs.native, rhs.native, predicate) };
+                else
+                    return { _mm512_cmp_pd_mask(lhs.native, rhs.native, predicate) };
+            }
+            else if constexpr (Width == 32)
+            {
+                if constexpr (std::is_same_v<T, float>)
+                    return { _mm256_cmp_ps(lhs.native, rhs.native, predicate) };
+                else
+                    return { _mm256_cmp_pd(lhs.native, rhs.native, predicate) };
+            }
+            else if constexpr (detail::avxEnabled)
+            {
+                if constexpr (std::is_same_v<T, float>)
+                    return { _mm_cmp_ps(lhs.native, rhs.native, predicate) };
+                else
+                    return { _mm_cmp_pd(lhs.native, rhs.native, predicate) };
+            }
+            else if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (Op == Comparison::Equal)
+                    return { _mm_cmpeq_ps(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::NotEqual)
+                    return { _mm_cmpneq_ps(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::Less)
+                    return { _mm_cmplt_ps(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::LessEqual)
+                    return { _mm_cmple_ps(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::Greater)
+                    return { _mm_cmpgt_ps(lhs.native, rhs.native) };
+                else
+                    return { _mm_cmpge_ps(lhs.native, rhs.native) };
+            }
+            else
+            {
+                if constexpr (Op == Comparison::Equal)
+                    return { _mm_cmpeq_pd(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::NotEqual)
+                    return { _mm_cmpneq_pd(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::Less)
+                    return { _mm_cmplt_pd(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::LessEqual)
+                    return { _mm_cmple_pd(lhs.native, rhs.native) };
+                else if constexpr (Op == Comparison::Greater)
+                    return { _mm_cmpgt_pd(lhs.native, rhs.native) };
+                else
+                    return { _mm_cmpge_pd(lhs.native, rhs.native) };
+            }
+        }
+        else if constexpr (Width == 64)
+        {
+            constexpr int predicate = Op == Comparison::Equal ? _MM_CMPINT_EQ
+                : Op == Comparison::NotEqual                  ? _MM_CMPINT_NE
+                : Op == Comparison::Less                      ? _MM_CMPINT_LT
+                : Op == Comparison::LessEqual                 ? _MM_CMPINT_LE
+                : Op == Comparison::Greater                   ? _MM_CMPINT_NLE
+                                                              : _MM_CMPINT_NLT;
+            constexpr bool isSigned = std::is_signed_v<T>;
+
+            if constexpr (sizeof(T) == 1)
+                return { isSigned ? _mm512_cmp_epi8_mask(lhs.native, rhs.native, predicate)
+                                  : _mm512_cmp_epu8_mask(lhs.native, rhs.native, predicate) };
+            else if constexpr (sizeof(T) == 2)
+                return { isSigned ? _mm512_cmp_epi16_mask(lhs.native, rhs.native, predicate)
+                                  : _mm512_cmp_epu16_mask(lhs.native, rhs.native, predicate) };
+            else if constexpr (sizeof(T) == 4)
+                return { isSigned ? _mm512_cmp_epi32_mask(lhs.native, rhs.native, predicate)
+                                  : _mm512_cmp_epu32_mask(lhs.native, rhs.native, predicate) };
+            else
+                return { isSigned ? _mm512_cmp_epi64_mask(lhs.native, rhs.native, predicate)
+                                  : _mm512_cmp_epu64_mask(lhs.native, rhs.native, predicate) };
+        }
+        /** @note SSE and AVX2 integers only have `==` and signed `>`; the other predicates are derived from them. */
+        else if constexpr (Op == Comparison::NotEqual)
+            return ~compare<Comparison::Equal>(lhs, rhs);
+        else if constexpr (Op == Comparison::Less)
+            return compare<Comparison::Greater>(rhs, lhs);
+        else if constexpr (Op == Comparison::LessEqual)
+            return ~compare<Comparison::Greater>(lhs, rhs);
+        else if constexpr (Op == Comparison::GreaterEqual)
+            return ~compare<Comparison::Greater>(rhs, lhs);
+        else if constexpr (Op == Comparison::Equal)
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_cmpeq_epi8(lhs.native, rhs.native) };
+                else
+                    return { _mm256_cmpeq_epi8(lhs.native, rhs.native) };
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_cmpeq_epi16(lhs.native, rhs.native) };
+                else
+                    return { _mm256_cmpeq_epi16(lhs.native, rhs.native) };
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                if constexpr (Width == 16)
+                    return { _mm_cmpeq_epi32(lhs.native, rhs.native) };
+                else
+                    return { _mm256_cmpeq_epi32(lhs.native, rhs.native) };
+            }
+            else
+            {
+                if constexpr (Width == 16)
+                    return { _mm_cmpeq_epi64(lhs.native, rhs.native) };
+                else
+                    return { _mm256_cmpeq_epi64(lhs.native, rhs.native) };
+            }
+        }
+        else if constexpr (std::is_unsigned_v<T>)
+        {
+            /** @note Flipping the sign bit maps unsigned order onto signed order. */
+            const Register bias = broadcast(static_cast<T>(T(1) << (sizeof(T) * 8 - 1)));
+            const auto flip = [&bias](const Register& reg) -> Register<std::make_signed_t<T>, Width>
+            {
+                if constexpr (Width == 16)
+                    return { _mm_xor_si128(reg.native, bias.native) };
+                else
+                    return { _mm256_xor_si256(reg.native, bias.native) };
+            };
+            using Signed = Register<std::make_signed_t<T>, Width>;
+            return { Signed::template compare<Comparison::Greater>(flip(lhs), flip(rhs)).native };
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            if constexpr (Width == 16)
+                return { _mm_cmpgt_epi8(lhs.native, rhs.native) };
+            else
+                return { _mm256_cmpgt_epi8(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if constexpr (Width == 16)
+                return { _mm_cmpgt_epi16(lhs.native, rhs.native) };
+            else
+                return { _mm256_cmpgt_epi16(lhs.native, rhs.native) };
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if constexpr (Width == 16)
+                return { _mm_cmpgt_epi32(lhs.native, rhs.native) };
+            else
+                return { _mm256_cmpgt_epi32(lhs.native, rhs.native) };
+        }
+        else
+        {
+            if constexpr (Width == 16)
+                return { _mm_cmpgt_epi64(lhs.native, rhs.native) };
+            else
+                return { _mm256_cmpgt_epi64(lhs.native, rhs.native) };
+        }
+    }
+
+
+    template <RegisterLane T, std::size_t Width>
+    Register<T, Width> Register<T, Width>::blend(const Register& ifClear, const Register& ifSet,
+                                                 const mask_type& mask) noexcept
+    {
+        if constexpr (Width == 64)
+        {
+            if constexpr (std::is_same_v<T, float>)
+                return { _mm512_mask_blend_ps(mask.native, ifClear.native, ifSet.native) };
+            else if constexpr (std::is_same_v<T, double>)
+                return { _mm512_mask_blend_pd(mask.native, ifClear.native, ifSet.native) };
+            else if constexpr (sizeof(T) == 1)
+                return { _mm512_mask_blend_epi8(mask.native, ifClear.native, ifSet.native) };
+            else if constexpr (sizeof(T) == 2)
+                return { _mm512_mask_blend_epi16(mask.native, ifClear.native, ifSet.native) };
+            else if constexpr (sizeof(T) == 4)
+                return { _mm512_mask_blend_epi32(mask.native, ifClear.native, ifSet.native) };
+            else
+                return { _mm512_mask_blend_epi64(mask.native, ifClear.native, ifSet.native) };
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_blendv_ps(ifClear.native, ifSet.native, mask.native) };
+            else
+                return { _mm256_blendv_ps(ifClear.native, ifSet.native, mask.native) };
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if constexpr (Width == 16)
+                return { _mm_blendv_pd(ifClear.native, ifSet.native, mask.native) };
+            else
+                return { _mm256_blendv_pd(ifClear.native, ifSet.native, mask.native) };
+        }
+        /** @note Integer masks set every bit of a lane, so the byte blend selects whole lanes of any width. */
+        else if constexpr (Width == 16)
+            return { _mm_blendv_epi8(ifClear.native, ifSet.native, mask.native) };
+        else
+            return { _mm256_blendv_epi8(ifClear.native, ifSet.native, mask.native) };
+    }
+
+} // namespace falcon::simd::inline FALCON_SIMD_ISA
@@ -0,0 +1,49 @@
+#pragma once
+/**
+ * @file BatchKernels.h
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Entry points of the per-tier batch kernel tables.
+ * @details Each tier is a separate translation unit compiled with its own instruction set flags, so it is only
+ *          declared here when CMake managed to build it (`FALCON_DISPATCH_HAS_<TIER>`).
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Dispatch.h"
+
+
+namespace falcon::simd::dispatch
+{
+    namespace scalar
+    {
+        /** @brief Portable reference kernels, always available. */
+        [[nodiscard]] const BatchKernels& kernels() noexcept;
+    } // namespace scalar
+
+#ifdef FALCON_DISPATCH_HAS_SSE42
+    namespace sse42
+    {
+        /** @brief Kernels compiled with SSE4.2. */
+        [[nodiscard]] const BatchKernels& kernels() noexcept;
+    } // namespace sse42
+#endif
+
+#ifdef FALCON_DISPATCH_HAS_AVX2
+    namespace avx2
+    {
+        /** @brief Kernels compiled with AVX2, FMA and F16C. */
+        [[nodiscard]] const BatchKernels& kernels() noexcept;
+    } // namespace avx2
+#endif
+
+#ifdef FALCON_DISPATCH_HAS_AVX512
+    namespace avx512
+    {
+        /** @brief Kernels compiled with AVX-512 F, BW, DQ and VL. */
+        [[nodiscard]] const BatchKernels& kernels() noexcept;
+    } // namespace avx512
+#endif
+} // namespace falcon::simd::dispatch
@@ -0,0 +1,2003 @@
+#pragma once
+/**
+ * @file BatchKernels.tpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Batch kernel bodies shared by every instruction set tier.
+ * @details Included once per tier by a translation unit that defines `FALCON_DISPATCH_TARGET` (the tier namespace)
+ *          and `FALCON_DISPATCH_ISA` (its @ref falcon::simd::ISA value) and is compiled with that tier's flags. The
+ *          kernels loop over full @ref falcon::simd::Register "registers" of the widest width the tier enables and
+ *          finish the tail with one masked load and store, so no scalar remainder loop is needed. The scalar tier
+ *          runs the same bodies on one-lane @ref ScalarLanes.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "BatchKernels.h"
+#include "SIMD.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if !defined(FALCON_DISPATCH_TARGET) || !defined(FALCON_DISPATCH_ISA)
+    #error "Define FALCON_DISPATCH_TARGET and FALCON_DISPATCH_ISA before including BatchKernels.tpp"
+#endif
+
+
+namespace falcon::simd::dispatch::FALCON_DISPATCH_TARGET
+{
+    namespace
+    {
+        constexpr ISA tier = FALCON_DISPATCH_ISA;
+
+        /** @brief Register width in bytes used by this tier, 0 for the scalar tier. */
+        constexpr std::size_t width = tier == ISA::AVX512 ? 64 : tier == ISA::AVX2 ? 32 : tier == ISA::SSE42 ? 16 : 0;
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+        static_assert(width != 0 && isRegisterSupported<float, width> && isRegisterSupported<double, width>,
+                      "Batch kernel tier is compiled without the instruction set flags it targets.");
+
+        template <typename T>
+        using Lanes = Register<T, width>;
+#else
+        /** @brief One-lane stand-in for @ref falcon::simd::Register so the scalar tier shares the kernel bodies. */
+        template <typename T>
+        struct ScalarLanes
+        {
+            static constexpr std::size_t lanes = 1;
+
+            T value;
+
+            static ScalarLanes loadUnaligned(const T* src) noexcept
+            {
+                return { *src };
+            }
+
+            static ScalarLanes loadMasked(const T* src, const std::size_t count) noexcept
+            {
+                return { count ? *src : T(0) };
+            }
+
+            void storeUnaligned(T* dest) const noexcept
+            {
+                *dest = value;
+            }
+
+            void storeMasked(T* dest, const std::size_t count) const noexcept
+            {
+                if (count)
+                    *dest = value;
+            }
+
+            void storeStream(T* dest) const noexcept
+            {
+                *dest = value;
+            }
+
+            static ScalarLanes broadcast(const T scalar) noexcept
+            {
+                return { scalar };
+            }
+
+            static ScalarLanes setzero() noexcept
+            {
+                return { T(0) };
+            }
+
+            ScalarLanes operator+(const ScalarLanes& rhs) const noexcept
+            {
+                return { value + rhs.value };
+            }
+
+            ScalarLanes operator-(const ScalarLanes& rhs) const noexcept
+            {
+                return { value - rhs.value };
+            }
+
+            ScalarLanes operator*(const ScalarLanes& rhs) const noexcept
+            {
+                return { value * rhs.value };
+            }
+
+            ScalarLanes operator/(const ScalarLanes& rhs) const noexcept
+            {
+                return { value / rhs.value };
+            }
+
+            static ScalarLanes fma(const ScalarLanes& a, const ScalarLanes& b, const ScalarLanes& c) noexcept
+            {
+                return { a.value * b.value + c.value };
+            }
+
+            static ScalarLanes sqrt(const ScalarLanes& reg) noexcept
+            {
+                return { std::sqrt(reg.value) };
+            }
+
+            static ScalarLanes rsqrt(const ScalarLanes& reg) noexcept
+            {
+                return { T(1) / std::sqrt(reg.value) };
+            }
+
+            static ScalarLanes min(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept
+            {
+                return lhs.value < rhs.value ? lhs : rhs;
+            }
+
+            static ScalarLanes max(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept
+            {
+                return lhs.value > rhs.value ? lhs : rhs;
+            }
+
+            static ScalarLanes abs(const ScalarLanes& reg) noexcept
+            {
+                return { std::abs(reg.value) };
+            }
+
+            template <Comparison Op>
+            static bool compare(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept
+            {
+                static_assert(Op == Comparison::Less || Op == Comparison::LessEqual || Op == Comparison::Equal,
+                              "Only the comparisons used by the kernels are provided.");
+                if constexpr (Op == Comparison::Equal)
+                    return lhs.value == rhs.value;
+                else if constexpr (Op == Comparison::Less)
+                    return lhs.value < rhs.value;
+                else
+                    return lhs.value <= rhs.value;
+            }
+
+            static ScalarLanes blend(const ScalarLanes& ifClear, const ScalarLanes& ifSet, const bool mask) noexcept
+            {
+                return mask ? ifSet : ifClear;
+            }
+        };
+
+        template <typename T>
+        using Lanes = ScalarLanes<T>;
+#endif
+
+
+
+        /*************************************
+         *                                   *
+         *              HELPERS              *
+         *                                   *
+         *************************************/
+
+        /** @brief Load @p valid leading lanes from @p src, zeroing the rest. */
+        template <typename T>
+        Lanes<T> loadLanes(const T* src, const std::size_t valid) noexcept
+        {
+            return valid == Lanes<T>::lanes ? Lanes<T>::loadUnaligned(src) : Lanes<T>::loadMasked(src, valid);
+        }
+
+
+        /** @brief Store the @p valid leading lanes of @p reg to @p dest. */
+        template <typename T>
+        void storeLanes(const Lanes<T>& reg, T* dest, const std::size_t valid) noexcept
+        {
+            if (valid == Lanes<T>::lanes)
+                reg.storeUnaligned(dest);
+            else
+                reg.storeMasked(dest, valid);
+        }
+
+
+        /**
+         * @brief Call @p block once per register of lanes over `count` elements.
+         *
+         * @param[in] count Number of elements.
+         * @param[in] block Callable taking the first element index and the number of valid lanes.
+         */
+        template <typename T, typename Block>
+        void forEachBlock(const std::size_t count, Block block) noexcept
+        {
+            constexpr std::size_t lanes = Lanes<T>::lanes;
+            for (std::size_t i = 0; i < count; i += lanes)
+                block(i, count - i < lanes ? count - i : lanes);
+        }
+
+
+        /**
+         * @brief Apply @p op to `count` lanes of @p inputs and write the results to @p out.
+         *
+         * @param[in]  op     Callable taking one register per input.
+         * @param[out] out    Destination, may alias any input.
+         * @param[in]  count  Number of elements.
+         * @param[in]  inputs Source streams.
+         */
+        template <typename T, typename Op, typename... Inputs>
+        void forEachLane(Op op, T* out, const std::size_t count, const Inputs*... inputs) noexcept
+        {
+            forEachBlock<T>(count, [&](const std::size_t i, const std::size_t valid)
+                            { storeLanes<T>(op(loadLanes<T>(inputs + i, valid)...), out + i, valid); });
+        }
+
+
+        /** @brief Four registers holding the components of `lanes` vectors. */
+        template <typename T>
+        struct Vec4Lanes
+        {
+            Lanes<T> x, y, z, w;
+        };
+
+
+        template <typename T>
+        Vec4Lanes<T> loadVec4(const Vec4Streams<const T>& src, const std::size_t i, const std::size_t valid) noexcept
+        {
+            return { loadLanes<T>(src.x + i, valid), loadLanes<T>(src.y + i, valid), loadLanes<T>(src.z + i, valid),
+                     loadLanes<T>(src.w + i, valid) };
+        }
+
+
+        template <typename T>
+        void storeVec4(const Vec4Lanes<T>& vec, const Vec4Streams<T>& dest, const std::size_t i,
+                       const std::size_t valid) noexcept
+        {
+            storeLanes<T>(vec.x, dest.x + i, valid);
+            storeLanes<T>(vec.y, dest.y + i, valid);
+            storeLanes<T>(vec.z, dest.z + i, valid);
+            storeLanes<T>(vec.w, dest.w + i, valid);
+        }
+
+
+        template <typename T>
+        Lanes<T> dot4(const Vec4Lanes<T>& lhs, const Vec4Lanes<T>& rhs) noexcept
+        {
+            using L = Lanes<T>;
+            return L::fma(lhs.w, rhs.w, L::fma(lhs.z, rhs.z, L::fma(lhs.y, rhs.y, lhs.x * rhs.x)));
+        }
+
+
+        template <typename T>
+        Vec4Lanes<T> scale4(const Vec4Lanes<T>& vec, const Lanes<T>& factor) noexcept
+        {
+            return { vec.x * factor, vec.y * factor, vec.z * factor, vec.w * factor };
+        }
+
+
+        /** @brief One bit per lane of a comparison result, bit `i` set when lane `i` is. */
+        template <typename Mask>
+        std::uint64_t laneBits(const Mask& mask) noexcept
+        {
+            if constexpr (std::is_integral_v<Mask>) // The scalar tier compares into plain booleans
+                return static_cast<std::uint64_t>(mask) & 1u;
+            else
+                return mask.bits();
+        }
+
+
+        /**
+         * @brief Write the @p valid low bits of @p bits to the bitset @p out, bit `i % 64` of `out[i / 64]` onwards.
+         * @details Lanes divide 64, so a block never straddles two words; its first block overwrites the word.
+         */
+        inline void storeLaneBits(const std::uint64_t bits, std::uint64_t* out, const std::size_t i,
+                                  const std::size_t valid) noexcept
+        {
+            // Zeroed tail lanes may compare as set, so drop them before packing.
+            const std::uint64_t kept = bits & ((std::uint64_t(1) << valid) - 1);
+            const std::size_t shift = i % 64;
+            if (shift == 0)
+                out[i / 64] = kept;
+            else
+                out[i / 64] |= kept << shift;
+        }
+
+
+        /**
+         * @brief Call @p body with @p precision as a compile time constant.
+         *
+         * @param[in] precision Tier requested at run time.
+         * @param[in] body      Callable taking a `std::integral_constant<Precision, P>`.
+         */
+        template <typename Body>
+        void withPrecision(const Precision precision, Body body) noexcept
+        {
+            switch (precision)
+            {
+                case Precision::Fast:
+                    return body(std::integral_constant<Precision, Precision::Fast>{});
+                case Precision::Refined:
+                    return body(std::integral_constant<Precision, Precision::Refined>{});
+                case Precision::Exact:
+                default:
+                    return body(std::integral_constant<Precision, Precision::Exact>{});
+            }
+        }
+
+
+        /**
+         * @brief Lane-wise $ 1 / \sqrt{a} $ to the accuracy of @p P.
+         * @details @ref Precision::Refined applies one Newton-Raphson step, $ y' = y (1.5 - 0.5 a y^2) $, to the
+         *          estimate. `double` estimates are already correctly rounded divides and are returned as they are.
+         */
+        template <Precision P, typename T>
+        Lanes<T> reciprocalSqrt(const Lanes<T>& reg) noexcept
+        {
+            using L = Lanes<T>;
+            if constexpr (P == Precision::Exact)
+                return L::broadcast(T(1)) / L::sqrt(reg);
+            else if constexpr (P == Precision::Fast || std::is_same_v<T, double>)
+                return L::rsqrt(reg);
+            else
+            {
+                const L estimate = L::rsqrt(reg);
+                const L halfSquare = L::broadcast(T(0.5)) * reg * estimate;
+                return estimate * (L::broadcast(T(1.5)) - halfSquare * estimate);
+            }
+        }
+
+
+        /**
+         * @brief @p vec scaled to unit length, given its squared magnitude @p lengthSquared.
+         * @details @ref Precision::Exact divides every component by the square root, as `Vector4D::normalize` does,
+         *          and the other tiers multiply by @ref reciprocalSqrt.
+         */
+        template <Precision P, typename T>
+        Vec4Lanes<T> toUnit(const Vec4Lanes<T>& vec, const Lanes<T>& lengthSquared) noexcept
+        {
+            if constexpr (P == Precision::Exact)
+            {
+                const Lanes<T> length = Lanes<T>::sqrt(lengthSquared);
+                return { vec.x / length, vec.y / length, vec.z / length, vec.w / length };
+            }
+            else
+                return scale4(vec, reciprocalSqrt<P, T>(lengthSquared));
+        }
+
+
+        /**
+         * @brief Squared magnitude of @p vec summed as $ (x^2 + y^2) + (z^2 + w^2) $, like the `Vector4D` dot product.
+         * @details @ref Precision::Exact normalizes from it so that batch results match `Vector4D::normalize` bit for
+         *          bit; @ref dot4 is faster but rounds differently. The library is built without floating point
+         *          contraction, so the products are never fused into the adds.
+         */
+        template <typename T>
+        Lanes<T> unfusedLengthSquared(const Vec4Lanes<T>& vec) noexcept
+        {
+            return (vec.x * vec.x + vec.y * vec.y) + (vec.z * vec.z + vec.w * vec.w);
+        }
+
+
+        /** @brief Squared magnitude for normalizing to @p P: @ref unfusedLengthSquared when exact, else @ref dot4. */
+        template <Precision P, typename T>
+        Lanes<T> normalizingLengthSquared(const Vec4Lanes<T>& vec) noexcept
+        {
+            if constexpr (P == Precision::Exact)
+                return unfusedLengthSquared(vec);
+            else
+                return dot4(vec, vec);
+        }
+
+
+        /** @brief Scale of @p onto in the projection of @p src onto it. */
+        template <typename T>
+        Lanes<T> projectionScale(const Vec4Lanes<T>& src, const Vec4Lanes<T>& onto, const bool ontoNormalized) noexcept
+        {
+            const Lanes<T> along = dot4(src, onto);
+            return ontoNormalized ? along : along / dot4(onto, onto);
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *          STREAM KERNELS           *
+         *                                   *
+         *************************************/
+
+        template <typename T>
+        void add(const T* lhs, const T* rhs, T* out, const std::size_t count) noexcept
+        {
+            forEachLane([](const auto& a, const auto& b) { return a + b; }, out, count, lhs, rhs);
+        }
+
+
+        template <typename T>
+        void subtract(const T* lhs, const T* rhs, T* out, const std::size_t count) noexcept
+        {
+            forEachLane([](const auto& a, const auto& b) { return a - b; }, out, count, lhs, rhs);
+        }
+
+
+        template <typename T>
+        void multiply(const T* lhs, const T* rhs, T* out, const std::size_t count) noexcept
+        {
+            forEachLane([](const auto& a, const auto& b) { return a * b; }, out, count, lhs, rhs);
+        }
+
+
+        template <typename T>
+        void divide(const T* lhs, const T* rhs, T* out, const std::size_t count) noexcept
+        {
+            forEachLane([](const auto& a, const auto& b) { return a / b; }, out, count, lhs, rhs);
+        }
+
+
+        template <typename T>
+        void scale(const T* src, const T scalar, T* out, const std::size_t count) noexcept
+        {
+            const Lanes<T> factor = Lanes<T>::broadcast(scalar);
+            forEachLane([&factor](const auto& a) { return a * factor; }, out, count, src);
+        }
+
+
+        template <typename T>
+        void multiplyAdd(const T* a, const T* b, const T* c, T* out, const std::size_t count) noexcept
+        {
+            forEachLane([](const auto& x, const auto& y, const auto& z) { return Lanes<T>::fma(x, y, z); }, out, count,
+                        a, b, c);
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *           VEC4 KERNELS            *
+         *                                   *
+         *************************************/
+
+        template <typename T>
+        void dot(const Vec4Streams<const T> lhs, const Vec4Streams<const T> rhs, T* out,
+                 const std::size_t count) noexcept
+        {
+            forEachBlock<T>(count, [&](const std::size_t i, const std::size_t valid)
+                            { storeLanes<T>(dot4(loadVec4(lhs, i, valid), loadVec4(rhs, i, valid)), out + i, valid); });
+        }
+
+
+        template <typename T>
+        void mag(const Vec4Streams<const T> src, T* out, const std::size_t count) noexcept
+        {
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                storeLanes<T>(Lanes<T>::sqrt(dot4(vec, vec)), out + i, valid);
+                            });
+        }
+
+
+        template <typename T>
+        void normalize(const Vec4Streams<const T> src, const Precision precision, const Vec4Streams<T> out,
+                       const std::size_t count) noexcept
+        {
+            withPrecision(precision,
+                          [&](const auto tier)
+                          {
+                              forEachBlock<T>(count,
+                                              [&](const std::size_t i, const std::size_t valid)
+                                              {
+                                                  constexpr Precision P = decltype(tier)::value;
+                                                  const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                                  storeVec4(toUnit<P>(vec, normalizingLengthSquared<P>(vec)), out,
+                                                            i, valid);
+                                              });
+                          });
+        }
+
+
+        template <typename T>
+        void safeNormalize(const Vec4Streams<const T> src, const T thresholdSquared, const Precision precision,
+                           const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L limit = L::broadcast(thresholdSquared);
+            const L zero = L::setzero();
+
+            withPrecision(precision,
+                          [&](const auto tier)
+                          {
+                              forEachBlock<T>(
+                                  count,
+                                  [&](const std::size_t i, const std::size_t valid)
+                                  {
+                                      constexpr Precision P = decltype(tier)::value;
+                                      const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                      const L lengthSquared = normalizingLengthSquared<P>(vec);
+                                      const auto tooShort =
+                                          L::template compare<Comparison::LessEqual>(lengthSquared, limit);
+                                      const Vec4Lanes<T> unit = toUnit<P>(vec, lengthSquared);
+                                      storeVec4<T>({ L::blend(unit.x, zero, tooShort), L::blend(unit.y, zero, tooShort),
+                                                     L::blend(unit.z, zero, tooShort),
+                                                     L::blend(unit.w, zero, tooShort) },
+                                                   out, i, valid);
+                                  });
+                          });
+        }
+
+
+        template <typename T>
+        void project(const Vec4Streams<const T> src, const Vec4Streams<const T> onto, const bool ontoNormalized,
+                     const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                const Vec4Lanes<T> target = loadVec4(onto, i, valid);
+                                storeVec4(scale4(target, projectionScale(vec, target, ontoNormalized)), out, i, valid);
+                            });
+        }
+
+
+        template <typename T>
+        void reject(const Vec4Streams<const T> src, const Vec4Streams<const T> from, const bool fromNormalized,
+                    const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                const Vec4Lanes<T> target = loadVec4(from, i, valid);
+                                const Vec4Lanes<T> along = scale4(target, projectionScale(vec, target, fromNormalized));
+                                storeVec4<T>({ vec.x - along.x, vec.y - along.y, vec.z - along.z, vec.w - along.w },
+                                             out, i, valid);
+                            });
+        }
+
+
+
+        template <typename T>
+        void equal(const Vec4Streams<const T> lhs, const Vec4Streams<const T> rhs, const T epsilon, std::uint64_t* out,
+                   const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L tolerance = L::broadcast(epsilon);
+
+            // Exact equality keeps equal infinities, whose difference is NaN; NaN fails both comparisons.
+            const auto matches = [&tolerance](const L& a, const L& b)
+            {
+                return L::template compare<Comparison::Equal>(a, b) |
+                    L::template compare<Comparison::LessEqual>(L::abs(a - b), tolerance);
+            };
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> a = loadVec4(lhs, i, valid);
+                                const Vec4Lanes<T> b = loadVec4(rhs, i, valid);
+                                const auto equalLanes =
+                                    matches(a.x, b.x) & matches(a.y, b.y) & matches(a.z, b.z) & matches(a.w, b.w);
+                                storeLaneBits(laneBits(equalLanes), out, i, valid);
+                            });
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *       LAYOUT CONVERSION           *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Transpose 4x4 blocks of four vectors between packed and component streams.
+         * @details A 4x4 transpose is its own inverse, so the same shuffles serve both directions: @p rows holds four
+         *          pointers read as rows and @p columns four pointers written as rows.
+         *
+         * @return Number of vectors converted; the caller finishes the remainder element by element.
+         */
+        template <typename T>
+        std::size_t transposeBlocks([[maybe_unused]] const T* const (&rows)[4],
+                                    [[maybe_unused]] const std::size_t rowStride,
+                                    [[maybe_unused]] T* const (&columns)[4],
+                                    [[maybe_unused]] const std::size_t columnStride,
+                                    [[maybe_unused]] const std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (std::is_same_v<T, float>)
+            {
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 r0 = _mm_loadu_ps(rows[0] + i * rowStride);
+                    __m128 r1 = _mm_loadu_ps(rows[1] + i * rowStride);
+                    __m128 r2 = _mm_loadu_ps(rows[2] + i * rowStride);
+                    __m128 r3 = _mm_loadu_ps(rows[3] + i * rowStride);
+                    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                    _mm_storeu_ps(columns[0] + i * columnStride, r0);
+                    _mm_storeu_ps(columns[1] + i * columnStride, r1);
+                    _mm_storeu_ps(columns[2] + i * columnStride, r2);
+                    _mm_storeu_ps(columns[3] + i * columnStride, r3);
+                }
+            }
+    #ifdef FALCON_AVX_SUPPORTED
+            else
+            {
+                for (; i + 4 <= count; i += 4)
+                {
+                    const __m256d r0 = _mm256_loadu_pd(rows[0] + i * rowStride);
+                    const __m256d r1 = _mm256_loadu_pd(rows[1] + i * rowStride);
+                    const __m256d r2 = _mm256_loadu_pd(rows[2] + i * rowStride);
+                    const __m256d r3 = _mm256_loadu_pd(rows[3] + i * rowStride);
+
+                    const __m256d evens01 = _mm256_unpacklo_pd(r0, r1); // r0[0] r1[0] r0[2] r1[2]
+                    const __m256d odds01 = _mm256_unpackhi_pd(r0, r1);  // r0[1] r1[1] r0[3] r1[3]
+                    const __m256d evens23 = _mm256_unpacklo_pd(r2, r3);
+                    const __m256d odds23 = _mm256_unpackhi_pd(r2, r3);
+
+                    _mm256_storeu_pd(columns[0] + i * columnStride, _mm256_permute2f128_pd(evens01, evens23, 0x20));
+                    _mm256_storeu_pd(columns[1] + i * columnStride, _mm256_permute2f128_pd(odds01, odds23, 0x20));
+                    _mm256_storeu_pd(columns[2] + i * columnStride, _mm256_permute2f128_pd(evens01, evens23, 0x31));
+                    _mm256_storeu_pd(columns[3] + i * columnStride, _mm256_permute2f128_pd(odds01, odds23, 0x31));
+                }
+            }
+    #endif
+#endif
+            return i;
+        }
+
+
+        template <typename T>
+        void deinterleave(const T* aos, const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            // Rows are four consecutive vectors, columns are the component streams.
+            const T* const rows[4] = { aos, aos + 4, aos + 8, aos + 12 };
+            T* const columns[4] = { out.x, out.y, out.z, out.w };
+
+            for (std::size_t i = transposeBlocks<T>(rows, 4, columns, 1, count); i < count; ++i)
+            {
+                out.x[i] = aos[4 * i];
+                out.y[i] = aos[4 * i + 1];
+                out.z[i] = aos[4 * i + 2];
+                out.w[i] = aos[4 * i + 3];
+            }
+        }
+
+
+        template <typename T>
+        void interleave(const Vec4Streams<const T> soa, T* aos, const std::size_t count) noexcept
+        {
+            const T* const rows[4] = { soa.x, soa.y, soa.z, soa.w };
+            T* const columns[4] = { aos, aos + 4, aos + 8, aos + 12 };
+
+            for (std::size_t i = transposeBlocks<T>(rows, 1, columns, 4, count); i < count; ++i)
+            {
+                aos[4 * i] = soa.x[i];
+                aos[4 * i + 1] = soa.y[i];
+                aos[4 * i + 2] = soa.z[i];
+                aos[4 * i + 3] = soa.w[i];
+            }
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *           MAT4 KERNELS            *
+         *                                   *
+         *************************************/
+
+        /** @brief True if @p ptr is aligned to @p alignment bytes. */
+        template <typename T>
+        bool isAligned(const T* ptr, const std::size_t alignment) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+        }
+
+
+        /** @brief Divide `x`, `y` and `z` by `w` and set `w` to `1`. */
+        template <typename T>
+        Vec4Lanes<T> divideByW(const Vec4Lanes<T>& vec) noexcept
+        {
+            return { vec.x / vec.w, vec.y / vec.w, vec.z / vec.w, Lanes<T>::broadcast(T(1)) };
+        }
+
+
+        /**
+         * @brief Transform one packed vector element by element.
+         * @details Reads every component before writing, so @p out may be @p src.
+         */
+        template <typename T, bool Projective>
+        void transformOne(const T* matrix, const T* src, T* out) noexcept
+        {
+            const T x = src[0], y = src[1], z = src[2], w = src[3];
+
+            T result[4];
+            for (std::size_t row = 0; row < 4; ++row)
+                result[row] = matrix[row] * x + matrix[4 + row] * y + matrix[8 + row] * z + matrix[12 + row] * w;
+
+            if constexpr (Projective)
+            {
+                out[0] = result[0] / result[3];
+                out[1] = result[1] / result[3];
+                out[2] = result[2] / result[3];
+                out[3] = T(1);
+            }
+            else
+            {
+                for (std::size_t row = 0; row < 4; ++row)
+                    out[row] = result[row];
+            }
+        }
+
+
+#ifdef FALCON_SIMD_SUPPORTED
+        /** @brief Number of packed `{x, y, z, w}` vectors that fit side by side in one register. */
+        template <typename T>
+        constexpr std::size_t packedVectors = Lanes<T>::lanes / 4;
+
+
+        /** @brief Repeat the four elements at @p col once per packed vector of a register. */
+        template <typename T>
+        Lanes<T> repeatColumn(const T* col) noexcept
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (width == 16)
+                    return { _mm_loadu_ps(col) };
+                else if constexpr (width == 32)
+                    return { _mm256_broadcast_ps(reinterpret_cast<const __m128*>(col)) };
+                else
+                    return { _mm512_broadcast_f32x4(_mm_loadu_ps(col)) };
+            }
+            else if constexpr (width == 32)
+                return { _mm256_loadu_pd(col) };
+            else
+                return { _mm512_broadcast_f64x4(_mm256_loadu_pd(col)) };
+        }
+
+
+        /** @brief Copy component @p C of every packed vector across that vector's lanes. */
+        template <int C, typename T>
+        Lanes<T> splat(const Lanes<T>& reg) noexcept
+        {
+            constexpr int pattern = C * 0x55; // C in all four 2-bit selectors
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if constexpr (width == 16)
+                    return { _mm_shuffle_ps(reg.native, reg.native, pattern) };
+                else if constexpr (width == 32)
+                    return { _mm256_permute_ps(reg.native, pattern) };
+                else
+                    return { _mm512_permute_ps(reg.native, pattern) };
+            }
+            else if constexpr (width == 32)
+                return { _mm256_permute4x64_pd(reg.native, pattern) };
+            else
+                return { _mm512_permutex_pd(reg.native, pattern) };
+        }
+
+
+        /**
+         * @brief Transform whole registers of packed vectors, one splat and one multiply-add per column.
+         * @details With streaming stores, leading vectors are transformed one at a time until the output reaches a
+         *          register boundary.
+         *
+         * @return Number of vectors transformed; the caller finishes the remainder one vector at a time.
+         */
+        template <typename T, bool Projective>
+        std::size_t transformPackedBlocks(const T* matrix, const T* src, const bool streaming, T* out,
+                                          const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            constexpr std::size_t step = packedVectors<T>;
+
+            const L col0 = repeatColumn(matrix);
+            const L col1 = repeatColumn(matrix + 4);
+            const L col2 = repeatColumn(matrix + 8);
+            const L col3 = repeatColumn(matrix + 12);
+
+            const auto transformBlock = [&](const std::size_t i)
+            {
+                const L vec = L::loadUnaligned(src + 4 * i);
+                L result = col0 * splat<0, T>(vec);
+                result = L::fma(col1, splat<1, T>(vec), result);
+                result = L::fma(col2, splat<2, T>(vec), result);
+                result = L::fma(col3, splat<3, T>(vec), result);
+                if constexpr (Projective)
+                    result = result / splat<3, T>(result);
+                return result;
+            };
+
+            std::size_t i = 0;
+            if (streaming && isAligned(out, 4 * sizeof(T))) // Otherwise no number of vectors reaches alignment
+            {
+                for (; i < count && !isAligned(out + 4 * i, sizeof(L)); ++i)
+                    transformOne<T, Projective>(matrix, src + 4 * i, out + 4 * i);
+                for (; i + step <= count; i += step)
+                    transformBlock(i).storeStream(out + 4 * i);
+                storeFence();
+                return i;
+            }
+
+            for (; i + step <= count; i += step)
+                transformBlock(i).storeUnaligned(out + 4 * i);
+            return i;
+        }
+#endif
+
+
+        template <typename T, bool Projective>
+        void transform(const T* matrix, const T* src, [[maybe_unused]] const bool streaming, T* out,
+                       const std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#ifdef FALCON_SIMD_SUPPORTED
+            if constexpr (packedVectors<T> > 0)
+                i = transformPackedBlocks<T, Projective>(matrix, src, streaming, out, count);
+#endif
+            for (; i < count; ++i)
+                transformOne<T, Projective>(matrix, src + 4 * i, out + 4 * i);
+        }
+
+
+        /**
+         * @brief Map every block of structure-of-arrays vectors through @p map.
+         * @details Shared by the matrix kernels: full blocks use streaming stores when requested and every output
+         *          stream is register aligned, and the stores are fenced before returning.
+         */
+        template <typename T, typename Map>
+        void mapStreams(const Vec4Streams<const T> src, const bool streaming, const Vec4Streams<T> out,
+                        const std::size_t count, Map map) noexcept
+        {
+            using L = Lanes<T>;
+
+            constexpr std::size_t alignment = sizeof(L);
+            const bool stream = streaming && isAligned(out.x, alignment) && isAligned(out.y, alignment) &&
+                                isAligned(out.z, alignment) && isAligned(out.w, alignment);
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> result = map(loadVec4(src, i, valid));
+                                if (stream && valid == L::lanes)
+                                {
+                                    result.x.storeStream(out.x + i);
+                                    result.y.storeStream(out.y + i);
+                                    result.z.storeStream(out.z + i);
+                                    result.w.storeStream(out.w + i);
+                                }
+                                else
+                                    storeVec4(result, out, i, valid);
+                            });
+
+#ifdef FALCON_SIMD_SUPPORTED
+            if (stream)
+                storeFence();
+#endif
+        }
+
+
+        template <typename T, bool Projective>
+        void transformStreams(const T* matrix, const Vec4Streams<const T> src, const bool streaming,
+                              const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+
+            // Column-major, so element (row, col) is matrix[4 * col + row].
+            L m[16];
+            for (std::size_t k = 0; k < 16; ++k)
+                m[k] = L::broadcast(matrix[k]);
+
+            const auto row = [&m](const std::size_t r, const Vec4Lanes<T>& vec)
+            { return L::fma(m[12 + r], vec.w, L::fma(m[8 + r], vec.z, L::fma(m[4 + r], vec.y, m[r] * vec.x))); };
+
+            mapStreams<T>(src, streaming, out, count,
+                          [&row](const Vec4Lanes<T>& vec)
+                          {
+                              const Vec4Lanes<T> result = { row(0, vec), row(1, vec), row(2, vec), row(3, vec) };
+                              if constexpr (Projective)
+                                  return divideByW(result);
+                              else
+                                  return result;
+                          });
+        }
+
+
+        /** @brief @ref transformStreams for a 3x4 affine matrix: 9 multiply-adds per vector instead of 16. */
+        template <typename T>
+        void transformStreamsAffine(const T* affine, const Vec4Streams<const T> src, const bool streaming,
+                                    const Vec4Streams<T> out, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+
+            // Column-major, so element (row, col) is affine[3 * col + row].
+            L m[12];
+            for (std::size_t k = 0; k < 12; ++k)
+                m[k] = L::broadcast(affine[k]);
+
+            const auto row = [&m](const std::size_t r, const Vec4Lanes<T>& vec)
+            { return L::fma(m[9 + r], vec.w, L::fma(m[6 + r], vec.z, L::fma(m[3 + r], vec.y, m[r] * vec.x))); };
+
+            mapStreams<T>(src, streaming, out, count,
+                          [&row](const Vec4Lanes<T>& vec) -> Vec4Lanes<T>
+                          { return { row(0, vec), row(1, vec), row(2, vec), vec.w }; });
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *        QUATERNION KERNELS         *
+         *                                   *
+         *************************************/
+
+        /** @brief @p to, negated in the lanes where it lies on the far side of @p from. */
+        template <typename T>
+        Vec4Lanes<T> shorterArc(const Vec4Lanes<T>& from, const Vec4Lanes<T>& to) noexcept
+        {
+            using L = Lanes<T>;
+            const auto opposite = L::template compare<Comparison::Less>(dot4(from, to), L::setzero());
+            const L sign = L::blend(L::broadcast(T(1)), L::broadcast(T(-1)), opposite);
+            return scale4(to, sign);
+        }
+
+
+        /**
+         * @brief Slerp weight $ \sin(s\theta) / \sin\theta $ as a polynomial in $ \cos\theta - 1 $.
+         * @details The series $ \sum_i c_i (\cos\theta - 1)^i $ with $ c_0 = s $ and
+         *          $ c_i = c_{i-1} (s^2 - i^2) / (i (2i + 1)) $ converges for every angle, and over
+         *          $ \theta \le \pi / 4 $ (half of the largest shorter arc) the truncation error of the terms kept
+         *          here is below `2.5e-8` for `float` and `7e-16` for `double`.
+         */
+        template <typename T>
+        struct SlerpWeight
+        {
+            static constexpr std::size_t terms = std::is_same_v<T, float> ? 8 : 18;
+
+            Lanes<T> coefficients[terms];
+
+            explicit SlerpWeight(const T s) noexcept
+            {
+                T coefficient = s;
+                coefficients[0] = Lanes<T>::broadcast(coefficient);
+                for (std::size_t i = 1; i < terms; ++i)
+                {
+                    const T n = static_cast<T>(i);
+                    coefficient *= (s * s - n * n) / (n * (T(2) * n + T(1)));
+                    coefficients[i] = Lanes<T>::broadcast(coefficient);
+                }
+            }
+
+            /** @brief Evaluate the weight with Horner's rule, @p offset holding $ \cos\theta - 1 $. */
+            Lanes<T> operator()(const Lanes<T>& offset) const noexcept
+            {
+                Lanes<T> result = coefficients[terms - 1];
+                for (std::size_t i = terms - 1; i-- > 0;)
+                    result = Lanes<T>::fma(result, offset, coefficients[i]);
+                return result;
+            }
+        };
+
+
+        template <typename T>
+        void nlerp(const Vec4Streams<const T> from, const Vec4Streams<const T> to, const T t, const Vec4Streams<T> out,
+                   const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L factor = L::broadcast(t);
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> a = loadVec4(from, i, valid);
+                                const Vec4Lanes<T> b = shorterArc(a, loadVec4(to, i, valid));
+                                const Vec4Lanes<T> blended = { L::fma(b.x - a.x, factor, a.x),
+                                                               L::fma(b.y - a.y, factor, a.y),
+                                                               L::fma(b.z - a.z, factor, a.z),
+                                                               L::fma(b.w - a.w, factor, a.w) };
+                                const L inverseLength = reciprocalSqrt<Precision::Exact, T>(dot4(blended, blended));
+                                storeVec4(scale4(blended, inverseLength), out, i, valid);
+                            });
+        }
+
+
+        /**
+         * @brief Branch free slerp over whole registers of quaternions.
+         * @details Splits the arc from `from[i]` to `to[i]` at its midpoint `normalize(from[i] + to[i])`, whose
+         *          cosine with either end is $ \|from + to\| / 2 \ge \cos(\pi / 4) $ once the shorter arc is taken.
+         *          @p t picks the same half in every lane, so the weights of both ends are set up once per call and
+         *          each lane only evaluates two polynomials.
+         */
+        template <typename T>
+        void slerp(const Vec4Streams<const T> from, const Vec4Streams<const T> to, const T t, const Vec4Streams<T> out,
+                   const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const bool secondHalf = t > T(0.5);
+            const T s = secondHalf ? T(2) * t - T(1) : T(2) * t;
+            const SlerpWeight<T> startWeight(T(1) - s);
+            const SlerpWeight<T> endWeight(s);
+            const L half = L::broadcast(T(0.5));
+            const L one = L::broadcast(T(1));
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> a = loadVec4(from, i, valid);
+                                const Vec4Lanes<T> b = shorterArc(a, loadVec4(to, i, valid));
+                                const Vec4Lanes<T> sum = { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+                                const L lengthSquared = dot4(sum, sum);
+                                const L inverseLength = reciprocalSqrt<Precision::Exact, T>(lengthSquared);
+                                const Vec4Lanes<T> middle = scale4(sum, inverseLength);
+
+                                const L offset = lengthSquared * inverseLength * half - one;
+                                const Vec4Lanes<T> start = scale4(secondHalf ? middle : a, startWeight(offset));
+                                const Vec4Lanes<T>& end = secondHalf ? b : middle;
+                                const L weight = endWeight(offset);
+                                storeVec4<T>({ L::fma(end.x, weight, start.x), L::fma(end.y, weight, start.y),
+                                               L::fma(end.z, weight, start.z), L::fma(end.w, weight, start.w) },
+                                             out, i, valid);
+                            });
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *          REDUCE KERNELS           *
+         *                                   *
+         *************************************/
+
+        /** @brief Independent running sums, enough to cover the latency of a vector add. */
+        constexpr std::size_t accumulators = 4;
+
+        /** @brief Registers summed plainly per leaf of @ref pairwiseSum. */
+        constexpr std::size_t pairwiseLeafRegisters = 32;
+
+
+        /** @brief Scalar Kahan step, adding @p value to @p sum and carrying the lost low bits in @p carry. */
+        template <typename T>
+        void kahanAdd(T& sum, T& carry, const T value) noexcept
+        {
+            const T corrected = value - carry;
+            const T total = sum + corrected;
+            carry = (total - sum) - corrected;
+            sum = total;
+        }
+
+
+        /** @brief Sum of the lanes of @p reg, in lane order. */
+        template <typename T>
+        T sumOfLanes(const Lanes<T>& reg) noexcept
+        {
+            T lanes[Lanes<T>::lanes];
+            reg.storeUnaligned(lanes);
+
+            T total = T(0);
+            for (const T lane : lanes)
+                total += lane;
+            return total;
+        }
+
+
+        /**
+         * @brief Call @p step once per register of terms over `[begin, end)`, cycling through the accumulators.
+         *
+         * @param[in] step Callable taking the accumulator index, the first term index and the number of valid lanes.
+         */
+        template <typename T, typename Step>
+        void forEachAccumulated(const std::size_t begin, const std::size_t end, Step step) noexcept
+        {
+            constexpr std::size_t lanes = Lanes<T>::lanes;
+            constexpr std::size_t stride = accumulators * lanes;
+
+            std::size_t i = begin;
+            for (; end - i >= stride; i += stride)
+                for (std::size_t k = 0; k < accumulators; ++k)
+                    step(k, i + k * lanes, lanes);
+            for (std::size_t k = 0; i < end; i += lanes, ++k)
+                step(k, i, std::min(lanes, end - i));
+        }
+
+
+        /**
+         * @brief Sum the terms `[begin, end)` in @ref accumulators running sums.
+         *
+         * @param[in] term Callable taking the first term index and the number of valid lanes, returning a register
+         *                 of terms that is zero past the valid lanes.
+         */
+        template <typename T, typename Term>
+        T plainSum(const std::size_t begin, const std::size_t end, Term term) noexcept
+        {
+            using L = Lanes<T>;
+            L sums[accumulators] = { L::setzero(), L::setzero(), L::setzero(), L::setzero() };
+            forEachAccumulated<T>(begin, end, [&](const std::size_t k, const std::size_t i, const std::size_t valid)
+                                  { sums[k] = sums[k] + term(i, valid); });
+            return sumOfLanes<T>((sums[0] + sums[1]) + (sums[2] + sums[3]));
+        }
+
+
+        /** @brief As @ref plainSum, halving the range on register boundaries down to leaves of a few registers. */
+        template <typename T, typename Term>
+        T pairwiseSum(const std::size_t begin, const std::size_t end, Term term) noexcept
+        {
+            constexpr std::size_t lanes = Lanes<T>::lanes;
+            if (end - begin <= pairwiseLeafRegisters * lanes)
+                return plainSum<T>(begin, end, term);
+
+            const std::size_t middle = begin + (end - begin) / 2 / lanes * lanes;
+            return pairwiseSum<T>(begin, middle, term) + pairwiseSum<T>(middle, end, term);
+        }
+
+
+        /** @brief As @ref plainSum, with a Kahan compensation per running sum and in the final fold of the lanes. */
+        template <typename T, typename Term>
+        T compensatedSum(const std::size_t count, Term term) noexcept
+        {
+            using L = Lanes<T>;
+            L sums[accumulators] = { L::setzero(), L::setzero(), L::setzero(), L::setzero() };
+            L carries[accumulators] = { L::setzero(), L::setzero(), L::setzero(), L::setzero() };
+            forEachAccumulated<T>(0, count,
+                                  [&](const std::size_t k, const std::size_t i, const std::size_t valid)
+                                  {
+                                      const L corrected = term(i, valid) - carries[k];
+                                      const L total = sums[k] + corrected;
+                                      carries[k] = (total - sums[k]) - corrected;
+                                      sums[k] = total;
+                                  });
+
+            T total = T(0), carry = T(0);
+            for (std::size_t k = 0; k < accumulators; ++k)
+            {
+                T sumLanes[L::lanes], carryLanes[L::lanes];
+                sums[k].storeUnaligned(sumLanes);
+                carries[k].storeUnaligned(carryLanes);
+                for (std::size_t lane = 0; lane < L::lanes; ++lane)
+                {
+                    kahanAdd(total, carry, sumLanes[lane]);
+                    kahanAdd(total, carry, -carryLanes[lane]);
+                }
+            }
+            return total;
+        }
+
+
+        /** @brief Sum @p count terms with the accumulation selected by @p summation. */
+        template <typename T, typename Term>
+        T sumTerms(const Summation summation, const std::size_t count, Term term) noexcept
+        {
+            switch (summation)
+            {
+                case Summation::Pairwise:
+                    return pairwiseSum<T>(0, count, term);
+                case Summation::Compensated:
+                    return compensatedSum<T>(count, term);
+                case Summation::Plain:
+                default:
+                    return plainSum<T>(0, count, term);
+            }
+        }
+
+
+        template <typename T>
+        T sum(const T* src, const Summation summation, const std::size_t count) noexcept
+        {
+            return sumTerms<T>(summation, count, [src](const std::size_t i, const std::size_t valid)
+                               { return loadLanes<T>(src + i, valid); });
+        }
+
+
+        /**
+         * @brief Smallest and largest element, two running extremes each.
+         * @details Min and max ignore repeated elements, so a tail shorter than two registers is covered by full
+         *          registers ending at the last element instead of masked ones, whose zeroed lanes would count.
+         */
+        template <typename T>
+        void minMax(const T* src, T* min, T* max, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            constexpr std::size_t lanes = L::lanes;
+            T low = std::numeric_limits<T>::infinity();
+            T high = -std::numeric_limits<T>::infinity();
+
+            // Running extremes go second, so a NaN element leaves them as they are.
+            if (count < lanes)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    low = src[i] < low ? src[i] : low;
+                    high = src[i] > high ? src[i] : high;
+                }
+            }
+            else
+            {
+                L lows[2] = { L::broadcast(low), L::broadcast(low) };
+                L highs[2] = { L::broadcast(high), L::broadcast(high) };
+
+                std::size_t i = 0;
+                for (; count - i >= 2 * lanes; i += 2 * lanes)
+                {
+                    for (std::size_t k = 0; k < 2; ++k)
+                    {
+                        const L values = L::loadUnaligned(src + i + k * lanes);
+                        lows[k] = L::min(values, lows[k]);
+                        highs[k] = L::max(values, highs[k]);
+                    }
+                }
+                for (; i < count; i += lanes)
+                {
+                    const L values = L::loadUnaligned(src + std::min(i, count - lanes));
+                    lows[0] = L::min(values, lows[0]);
+                    highs[0] = L::max(values, highs[0]);
+                }
+
+                T lowLanes[lanes], highLanes[lanes];
+                L::min(lows[0], lows[1]).storeUnaligned(lowLanes);
+                L::max(highs[0], highs[1]).storeUnaligned(highLanes);
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    low = std::min(low, lowLanes[lane]);
+                    high = std::max(high, highLanes[lane]);
+                }
+            }
+
+            *min = low;
+            *max = high;
+        }
+
+
+        template <typename T>
+        T sumDot(const Vec4Streams<const T> lhs, const Vec4Streams<const T> rhs, const Summation summation,
+                 const std::size_t count) noexcept
+        {
+            return sumTerms<T>(summation, count, [&](const std::size_t i, const std::size_t valid)
+                               { return dot4(loadVec4(lhs, i, valid), loadVec4(rhs, i, valid)); });
+        }
+
+
+        template <typename T>
+        T sumMag(const Vec4Streams<const T> src, const Summation summation, const std::size_t count) noexcept
+        {
+            return sumTerms<T>(summation, count,
+                               [&](const std::size_t i, const std::size_t valid)
+                               {
+                                   const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                   return Lanes<T>::sqrt(dot4(vec, vec));
+                               });
+        }
+
+
+        /**
+         * @brief Nearest and farthest vector from a point.
+         * @details Each register of squared distances is compared against the best ones so far; only a register
+         *          holding a new best is stored and scanned lane by lane, which becomes rare once the extremes settle.
+         */
+        template <typename T>
+        void extremeDistances(const Vec4Streams<const T> src, const T* point, std::size_t* nearest,
+                              std::size_t* farthest, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const Vec4Lanes<T> origin = { L::broadcast(point[0]), L::broadcast(point[1]), L::broadcast(point[2]),
+                                          L::broadcast(point[3]) };
+
+            T closest = std::numeric_limits<T>::infinity();
+            T furthest = -std::numeric_limits<T>::infinity();
+            std::size_t closestIndex = count, furthestIndex = count;
+            L closestLanes = L::broadcast(closest), furthestLanes = L::broadcast(furthest);
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Vec4Lanes<T> vec = loadVec4(src, i, valid);
+                                const Vec4Lanes<T> offset = { vec.x - origin.x, vec.y - origin.y, vec.z - origin.z,
+                                                              vec.w - origin.w };
+                                const L distance = dot4(offset, offset);
+
+                                const std::uint64_t validBits = (std::uint64_t(1) << valid) - 1;
+                                const std::uint64_t improved =
+                                    laneBits(L::template compare<Comparison::Less>(distance, closestLanes)) |
+                                    laneBits(L::template compare<Comparison::Less>(furthestLanes, distance));
+                                if ((improved & validBits) == 0)
+                                    return;
+
+                                T distances[L::lanes];
+                                distance.storeUnaligned(distances);
+                                for (std::size_t lane = 0; lane < valid; ++lane)
+                                {
+                                    if (distances[lane] < closest)
+                                    {
+                                        closest = distances[lane];
+                                        closestIndex = i + lane;
+                                    }
+                                    if (distances[lane] > furthest)
+                                    {
+                                        furthest = distances[lane];
+                                        furthestIndex = i + lane;
+                                    }
+                                }
+                                closestLanes = L::broadcast(closest);
+                                furthestLanes = L::broadcast(furthest);
+                            });
+
+            *nearest = closestIndex;
+            *farthest = furthestIndex;
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *           CULL KERNELS            *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Keep every volume that reaches into the inside of each plane.
+         * @details @p slack returns how far a register of volumes reaches into the inside of one plane: the signed
+         *          distance of their centers plus their radius, or their extent along the normal. Only the smallest
+         *          slack over the planes is kept. `min` returns its second operand when the first is NaN, so NaN
+         *          slack leaves the running minimum, and with it the volume, as it was.
+         *
+         * @param[in] load  Callable taking the first volume index and the number of valid lanes.
+         * @param[in] slack Callable taking the loaded volumes and the 4 elements of one plane.
+         */
+        template <typename T, typename Load, typename Slack>
+        void cullVolumes(const T* planes, const std::size_t planeCount, std::uint64_t* out, const std::size_t count,
+                         Load load, Slack slack) noexcept
+        {
+            using L = Lanes<T>;
+            const L zero = L::setzero();
+            const L unbounded = L::broadcast(std::numeric_limits<T>::infinity());
+
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const auto volumes = load(i, valid);
+                                L nearest = unbounded;
+                                for (std::size_t p = 0; p < planeCount; ++p)
+                                    nearest = L::min(slack(volumes, planes + 4 * p), nearest);
+                                storeLaneBits(laneBits(L::template compare<Comparison::LessEqual>(zero, nearest)), out,
+                                              i, valid);
+                            });
+        }
+
+
+        /** @brief Signed distance of the points @p center from @p plane. */
+        template <typename T>
+        Lanes<T> planeDistance(const Vec4Lanes<T>& center, const T* plane) noexcept
+        {
+            using L = Lanes<T>;
+            return L::fma(L::broadcast(plane[2]), center.z,
+                          L::fma(L::broadcast(plane[1]), center.y,
+                                 L::fma(L::broadcast(plane[0]), center.x, L::broadcast(plane[3]))));
+        }
+
+
+        template <typename T>
+        void cullSpheres(const Vec4Streams<const T> spheres, const T* planes, const std::size_t planeCount,
+                         std::uint64_t* out, const std::size_t count) noexcept
+        {
+            cullVolumes<T>(
+                planes, planeCount, out, count,
+                [&](const std::size_t i, const std::size_t valid) { return loadVec4(spheres, i, valid); },
+                [](const Vec4Lanes<T>& sphere, const T* plane) { return planeDistance(sphere, plane) + sphere.w; });
+        }
+
+
+        /**
+         * @brief Boxes as center and half extent, whose reach along a normal `n` is
+         *        $ |n_x| e_x + |n_y| e_y + |n_z| e_z $.
+         */
+        template <typename T>
+        void cullBoxes(const Vec4Streams<const T> min, const Vec4Streams<const T> max, const T* planes,
+                       const std::size_t planeCount, std::uint64_t* out, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L half = L::broadcast(T(0.5));
+
+            cullVolumes<T>(
+                planes, planeCount, out, count,
+                [&](const std::size_t i, const std::size_t valid)
+                {
+                    const Vec4Lanes<T> low = loadVec4(min, i, valid);
+                    const Vec4Lanes<T> high = loadVec4(max, i, valid);
+                    const Vec4Lanes<T> center = { (low.x + high.x) * half, (low.y + high.y) * half,
+                                                  (low.z + high.z) * half, L::setzero() };
+                    const Vec4Lanes<T> extent = { (high.x - low.x) * half, (high.y - low.y) * half,
+                                                  (high.z - low.z) * half, L::setzero() };
+                    return std::pair{ center, extent };
+                },
+                [](const std::pair<Vec4Lanes<T>, Vec4Lanes<T>>& box, const T* plane)
+                {
+                    const L reach = L::fma(L::broadcast(std::abs(plane[2])), box.second.z,
+                                           L::fma(L::broadcast(std::abs(plane[1])), box.second.y,
+                                                  L::broadcast(std::abs(plane[0])) * box.second.x));
+                    return planeDistance(box.first, plane) + reach;
+                });
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *            RAY KERNELS            *
+         *                                   *
+         *************************************/
+
+        /**
+         * @brief Record the hits of every ray against one primitive.
+         * @details Missing rays keep their farthest accepted distance, so only hits shorten the rays.
+         *
+         * @param[in] hit Callable taking the origins, directions and farthest accepted distances of a register of rays,
+         *                returning the hit mask and writing the hit distances to its last argument.
+         */
+        template <typename T, typename Hit>
+        void traceRays(const Vec4Streams<const T>& origins, const Vec4Streams<const T>& directions, T* distances,
+                       std::uint64_t* hits, const std::size_t count, Hit hit) noexcept
+        {
+            forEachBlock<T>(count,
+                            [&](const std::size_t i, const std::size_t valid)
+                            {
+                                const Lanes<T> farthest = loadLanes<T>(distances + i, valid);
+                                Lanes<T> distance = farthest;
+                                const auto mask = hit(loadVec4(origins, i, valid), loadVec4(directions, i, valid),
+                                                      farthest, distance);
+                                storeLanes<T>(Lanes<T>::blend(farthest, distance, mask), distances + i, valid);
+                                storeLaneBits(laneBits(mask), hits, i, valid);
+                            });
+        }
+
+
+        /**
+         * @brief Möller–Trumbore: solve `origin + t * direction = v0 + u * e1 + v * e2` by Cramer's rule and hit where
+         *        `u`, `v` and `1 - u - v` are non-negative and `t` is in range.
+         * @details A zero determinant turns `u` into NaN or an infinity, which fails the barycentric tests, so rays
+         *          in the plane of the triangle miss without a branch.
+         */
+        template <typename T>
+        void rayTriangle(const Vec4Streams<const T> origins, const Vec4Streams<const T> directions, const T* triangle,
+                         T* distances, std::uint64_t* hits, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L zero = L::setzero();
+            const L one = L::broadcast(T(1));
+            const L v0[3] = { L::broadcast(triangle[0]), L::broadcast(triangle[1]), L::broadcast(triangle[2]) };
+            const L e1[3] = { L::broadcast(triangle[3] - triangle[0]), L::broadcast(triangle[4] - triangle[1]),
+                              L::broadcast(triangle[5] - triangle[2]) };
+            const L e2[3] = { L::broadcast(triangle[6] - triangle[0]), L::broadcast(triangle[7] - triangle[1]),
+                              L::broadcast(triangle[8] - triangle[2]) };
+
+            traceRays<T>(
+                origins, directions, distances, hits, count,
+                [&](const Vec4Lanes<T>& origin, const Vec4Lanes<T>& direction, const L& farthest, L& distance)
+                {
+                    const L p[3] = { direction.y * e2[2] - direction.z * e2[1],
+                                     direction.z * e2[0] - direction.x * e2[2],
+                                     direction.x * e2[1] - direction.y * e2[0] };
+                    const L inverseDeterminant = one / L::fma(e1[2], p[2], L::fma(e1[1], p[1], e1[0] * p[0]));
+
+                    const L s[3] = { origin.x - v0[0], origin.y - v0[1], origin.z - v0[2] };
+                    const L q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2],
+                                     s[0] * e1[1] - s[1] * e1[0] };
+
+                    const L u = L::fma(s[2], p[2], L::fma(s[1], p[1], s[0] * p[0])) * inverseDeterminant;
+                    const L v =
+                        L::fma(direction.z, q[2], L::fma(direction.y, q[1], direction.x * q[0])) * inverseDeterminant;
+                    distance = L::fma(e2[2], q[2], L::fma(e2[1], q[1], e2[0] * q[0])) * inverseDeterminant;
+
+                    return L::template compare<Comparison::LessEqual>(zero, u) &
+                           L::template compare<Comparison::LessEqual>(zero, v) &
+                           L::template compare<Comparison::LessEqual>(u + v, one) &
+                           L::template compare<Comparison::LessEqual>(zero, distance) &
+                           L::template compare<Comparison::LessEqual>(distance, farthest);
+                });
+        }
+
+
+        /**
+         * @brief Slab test: the ray is inside the box from the latest entry into a slab to the earliest exit.
+         * @details `min` and `max` return their second operand when either is NaN, so a slab whose second crossing
+         *          distance is NaN, as for a ray with NaN components, leaves the running range as it was.
+         */
+        template <typename T>
+        void rayBox(const Vec4Streams<const T> origins, const Vec4Streams<const T> directions, const T* box,
+                    T* distances, std::uint64_t* hits, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L one = L::broadcast(T(1));
+            const L low[3] = { L::broadcast(box[0]), L::broadcast(box[1]), L::broadcast(box[2]) };
+            const L high[3] = { L::broadcast(box[3]), L::broadcast(box[4]), L::broadcast(box[5]) };
+
+            traceRays<T>(origins, directions, distances, hits, count,
+                         [&](const Vec4Lanes<T>& origin, const Vec4Lanes<T>& direction, const L& farthest, L& distance)
+                         {
+                             const L start[3] = { origin.x, origin.y, origin.z };
+                             const L step[3] = { direction.x, direction.y, direction.z };
+
+                             L entry = L::setzero();
+                             L exit = farthest;
+                             for (std::size_t axis = 0; axis < 3; ++axis)
+                             {
+                                 const L inverse = one / step[axis];
+                                 const L first = (low[axis] - start[axis]) * inverse;
+                                 const L second = (high[axis] - start[axis]) * inverse;
+                                 entry = L::max(L::min(first, second), entry);
+                                 exit = L::min(L::max(first, second), exit);
+                             }
+
+                             distance = entry;
+                             return L::template compare<Comparison::LessEqual>(entry, exit);
+                         });
+        }
+
+
+        /**
+         * @brief Solve `|origin + t * direction - center| = radius` for the nearer root `t` that is not negative.
+         * @details A negative discriminant makes both roots NaN, which fails the range tests, so missing rays need
+         *          no branch.
+         */
+        template <typename T>
+        void raySphere(const Vec4Streams<const T> origins, const Vec4Streams<const T> directions, const T* sphere,
+                       T* distances, std::uint64_t* hits, const std::size_t count) noexcept
+        {
+            using L = Lanes<T>;
+            const L zero = L::setzero();
+            const L center[3] = { L::broadcast(sphere[0]), L::broadcast(sphere[1]), L::broadcast(sphere[2]) };
+            const L radiusSquared = L::broadcast(sphere[3] * sphere[3]);
+
+            traceRays<T>(
+                origins, directions, distances, hits, count,
+                [&](const Vec4Lanes<T>& origin, const Vec4Lanes<T>& direction, const L& farthest, L& distance)
+                {
+                    const L offset[3] = { origin.x - center[0], origin.y - center[1], origin.z - center[2] };
+                    const L a =
+                        L::fma(direction.z, direction.z, L::fma(direction.y, direction.y, direction.x * direction.x));
+                    const L b = L::fma(offset[2], direction.z, L::fma(offset[1], direction.y, offset[0] * direction.x));
+                    const L c = L::fma(offset[2], offset[2], L::fma(offset[1], offset[1], offset[0] * offset[0])) -
+                                radiusSquared;
+
+                    const L root = L::sqrt(b * b - a * c);
+                    const L entry = (zero - b - root) / a;
+                    const L exit = (root - b) / a;
+                    distance = L::blend(entry, exit, L::template compare<Comparison::Less>(entry, zero));
+
+                    return L::template compare<Comparison::LessEqual>(zero, distance) &
+                           L::template compare<Comparison::LessEqual>(distance, farthest);
+                });
+        }
+
+
+
+        /*************************************
+         *                                   *
+         *          HALF PRECISION           *
+         *                                   *
+         *************************************/
+
+#ifdef FALCON_SIMD_SUPPORTED
+        // An explicit rounding mode makes the F16C conversions (every AVX2 CPU has F16C) and the quantizing rounds
+        // ignore MXCSR, so they round to nearest even as floatToHalf and roundToNearestEven do.
+        constexpr int roundToNearest = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+#endif
+
+
+        void floatsToHalves(const float* src, std::uint16_t* out, const std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#ifdef FALCON_AVX512_SUPPORTED
+            for (; i + 16 <= count; i += 16)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                    _mm512_cvtps_ph(_mm512_loadu_ps(src + i), roundToNearest));
+            if (i < count)
+            {
+                const auto mask = static_cast<__mmask16>((1u << (count - i)) - 1u);
+                _mm256_mask_storeu_epi16(out + i, mask, _mm512_cvtps_ph(_mm512_maskz_loadu_ps(mask, src + i),
+                                                                        roundToNearest));
+                return;
+            }
+#elif defined(FALCON_AVX2_SUPPORTED)
+            for (; i + 8 <= count; i += 8)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                                 _mm256_cvtps_ph(_mm256_loadu_ps(src + i), roundToNearest));
+#endif
+            // Scalar tiers, and the tail below one AVX2 register: F16C has no 16-bit masked store.
+            for (; i < count; ++i)
+                out[i] = floatToHalf(src[i]);
+        }
+
+
+        void halvesToFloats(const std::uint16_t* src, float* out, const std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#ifdef FALCON_AVX512_SUPPORTED
+            for (; i + 16 <= count; i += 16)
+                _mm512_storeu_ps(out + i,
+                                 _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+            if (i < count)
+            {
+                const auto mask = static_cast<__mmask16>((1u << (count - i)) - 1u);
+                _mm512_mask_storeu_ps(out + i, mask, _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, src + i)));
+                return;
+            }
+#elif defined(FALCON_AVX2_SUPPORTED)
+            for (; i + 8 <= count; i += 8)
+                _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+#endif
+            for (; i < count; ++i)
+                out[i] = halfToFloat(src[i]);
+        }
+
+
+
+
+        /*************************************
+         *                                   *
+         *           QUANTIZATION            *
+         *                                   *
+         *************************************/
+
+        /** @brief Lanes of @p reg rounded to the nearest integer, ties to even, as @ref roundToNearestEven does. */
+        inline Lanes<float> roundLanes(const Lanes<float>& reg) noexcept
+        {
+#ifdef FALCON_AVX512_SUPPORTED
+            return { _mm512_roundscale_ps(reg.native, roundToNearest) };
+#elif defined(FALCON_AVX2_SUPPORTED)
+            return { _mm256_round_ps(reg.native, roundToNearest) };
+#elif defined(FALCON_SIMD_SUPPORTED)
+            return { _mm_round_ps(reg.native, roundToNearest) };
+#else
+            return { static_cast<float>(roundToNearestEven(reg.value)) };
+#endif
+        }
+
+
+        /**
+         * @brief Convert the whole number lanes of @p reg to `Q` and store the @p valid leading ones to @p out.
+         * @details Lanes must already lie in the range of `Q`, so the saturating packs below AVX-512 never clamp.
+         */
+        template <typename Q>
+        void storeNarrowed(const Lanes<float>& reg, Q* out, [[maybe_unused]] const std::size_t valid) noexcept
+        {
+#ifdef FALCON_AVX512_SUPPORTED
+            const __m512i ints = _mm512_cvttps_epi32(reg.native);
+            const auto mask = static_cast<__mmask16>((1u << valid) - 1u);
+            if constexpr (sizeof(Q) == 1)
+                _mm512_mask_cvtepi32_storeu_epi8(out, mask, ints);
+            else if constexpr (sizeof(Q) == 2)
+                _mm512_mask_cvtepi32_storeu_epi16(out, mask, ints);
+            else
+                _mm512_mask_storeu_epi32(out, mask, ints);
+#elif defined(FALCON_SIMD_SUPPORTED)
+            constexpr std::size_t lanes = Lanes<float>::lanes;
+            if (valid < lanes) // No narrow masked stores before AVX-512
+            {
+                Q staged[lanes];
+                storeNarrowed(reg, staged, lanes);
+                std::copy_n(staged, valid, out);
+                return;
+            }
+
+    #ifdef FALCON_AVX2_SUPPORTED
+            const __m256i ints = _mm256_cvttps_epi32(reg.native);
+            if constexpr (sizeof(Q) == 4)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), ints);
+            else
+            {
+                const __m128i low = _mm256_castsi256_si128(ints);
+                const __m128i high = _mm256_extracti128_si256(ints, 1);
+                const __m128i words = std::is_signed_v<Q> ? _mm_packs_epi32(low, high) : _mm_packus_epi32(low, high);
+                if constexpr (sizeof(Q) == 2)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), words);
+                else
+                {
+                    const __m128i bytes = std::is_signed_v<Q> ? _mm_packs_epi16(words, words)
+                                                              : _mm_packus_epi16(words, words);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), bytes);
+                }
+            }
+    #else
+            const __m128i ints = _mm_cvttps_epi32(reg.native);
+            if constexpr (sizeof(Q) == 4)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), ints);
+            else
+            {
+                const __m128i words = std::is_signed_v<Q> ? _mm_packs_epi32(ints, ints) : _mm_packus_epi32(ints, ints);
+                if constexpr (sizeof(Q) == 2)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), words);
+                else
+                    _mm_storeu_si32(out, std::is_signed_v<Q> ? _mm_packs_epi16(words, words)
+                                                             : _mm_packus_epi16(words, words));
+            }
+    #endif
+#else
+            *out = static_cast<Q>(reg.value);
+#endif
+        }
+
+
+        /** @brief `float` lanes of the @p valid leading integers of @p src, zero past them. */
+        template <typename Q>
+        Lanes<float> loadWidened(const Q* src, [[maybe_unused]] const std::size_t valid) noexcept
+        {
+#ifdef FALCON_AVX512_SUPPORTED
+            const auto mask = static_cast<__mmask16>((1u << valid) - 1u);
+            __m512i ints;
+            if constexpr (sizeof(Q) == 1)
+            {
+                const __m128i bytes = _mm_maskz_loadu_epi8(mask, src);
+                ints = std::is_signed_v<Q> ? _mm512_cvtepi8_epi32(bytes) : _mm512_cvtepu8_epi32(bytes);
+            }
+            else if constexpr (sizeof(Q) == 2)
+            {
+                const __m256i words = _mm256_maskz_loadu_epi16(mask, src);
+                ints = std::is_signed_v<Q> ? _mm512_cvtepi16_epi32(words) : _mm512_cvtepu16_epi32(words);
+            }
+            else
+                ints = _mm512_maskz_loadu_epi32(mask, src);
+            return { _mm512_cvtepi32_ps(ints) };
+#elif defined(FALCON_SIMD_SUPPORTED)
+            constexpr std::size_t lanes = Lanes<float>::lanes;
+            if (valid < lanes)
+            {
+                Q staged[lanes] = {};
+                std::copy_n(src, valid, staged);
+                return loadWidened(staged, lanes);
+            }
+
+    #ifdef FALCON_AVX2_SUPPORTED
+            __m256i ints;
+            if constexpr (sizeof(Q) == 1)
+            {
+                const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+                ints = std::is_signed_v<Q> ? _mm256_cvtepi8_epi32(bytes) : _mm256_cvtepu8_epi32(bytes);
+            }
+            else if constexpr (sizeof(Q) == 2)
+            {
+                const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+                ints = std::is_signed_v<Q> ? _mm256_cvtepi16_epi32(words) : _mm256_cvtepu16_epi32(words);
+            }
+            else
+                ints = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            return { _mm256_cvtepi32_ps(ints) };
+    #else
+            __m128i ints;
+            if constexpr (sizeof(Q) == 1)
+            {
+                const __m128i bytes = _mm_loadu_si32(src);
+                ints = std::is_signed_v<Q> ? _mm_cvtepi8_epi32(bytes) : _mm_cvtepu8_epi32(bytes);
+            }
+            else if constexpr (sizeof(Q) == 2)
+            {
+                const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+                ints = std::is_signed_v<Q> ? _mm_cvtepi16_epi32(words) : _mm_cvtepu16_epi32(words);
+            }
+            else
+                ints = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            return { _mm_cvtepi32_ps(ints) };
+    #endif
+#else
+            return { static_cast<float>(*src) };
+#endif
+        }
+
+
+        /** @brief Lanes of @p value quantized as @ref quantizeSnorm (`Signed`) or @ref quantizeUnorm do. */
+        template <bool Signed>
+        Lanes<float> quantizeLanes(const Lanes<float>& value, const Lanes<float>& scale) noexcept
+        {
+            using L = Lanes<float>;
+            const L ordered = L::blend(L::setzero(), value, L::template compare<Comparison::Equal>(value, value));
+            const L clamped = L::max(L::min(ordered, L::broadcast(1.0f)), L::broadcast(Signed ? -1.0f : 0.0f));
+            return roundLanes(clamped * scale);
+        }
+
+
+        /** @brief Lanes of @p quantized decoded as @ref dequantizeSnorm (`Signed`) or @ref dequantizeUnorm do. */
+        template <bool Signed>
+        Lanes<float> dequantizeLanes(const Lanes<float>& quantized, const Lanes<float>& scale) noexcept
+        {
+            using L = Lanes<float>;
+            if constexpr (Signed)
+                return L::max(quantized / scale, L::broadcast(-1.0f));
+            else
+                return quantized / scale;
+        }
+
+
+        template <typename Q>
+        void toNormalized(const float* src, Q* out, const std::size_t count) noexcept
+        {
+            const auto scale = Lanes<float>::broadcast(normalizedScale<Q>);
+            forEachBlock<float>(count,
+                                [&](const std::size_t i, const std::size_t valid)
+                                {
+                                    const Lanes<float> value = loadLanes<float>(src + i, valid);
+                                    storeNarrowed(quantizeLanes<std::is_signed_v<Q>>(value, scale), out + i, valid);
+                                });
+        }
+
+
+        template <typename Q>
+        void fromNormalized(const Q* src, float* out, const std::size_t count) noexcept
+        {
+            const auto scale = Lanes<float>::broadcast(normalizedScale<Q>);
+            forEachBlock<float>(count,
+                                [&](const std::size_t i, const std::size_t valid)
+                                {
+                                    const Lanes<float> quantized = loadWidened(src + i, valid);
+                                    storeLanes<float>(dequantizeLanes<std::is_signed_v<Q>>(quantized, scale), out + i,
+                                                      valid);
+                                });
+        }
+
+
+        /**
+         * @brief Scales of the fields of `{x, y, z, w}` vectors laid side by side.
+         * @details A register starting at component `j` reads them from `j % 4`, which also serves the one-lane tier.
+         */
+        template <bool Signed>
+        constexpr std::array<float, 19> fieldScales = []
+        {
+            std::array<float, 19> scales{};
+            for (std::size_t i = 0; i < scales.size(); ++i)
+                scales[i] = i % 4 == 3 ? (Signed ? 1.0f : 3.0f) : (Signed ? snorm10Scale : unorm10Scale);
+            return scales;
+        }();
+
+
+        /**
+         * @brief Pack @p count `{x, y, z, w}` vectors as 10:10:10:2 values.
+         * @details Quantizes the components of four vectors a register at a time, then packs their fields; 16 fields
+         *          fill one AVX-512 register exactly and are a whole number of registers on every other tier.
+         */
+        template <bool Signed>
+        void to1010102(const float* src, std::uint32_t* out, const std::size_t count) noexcept
+        {
+            constexpr std::size_t lanes = Lanes<float>::lanes;
+            for (std::size_t first = 0; first < count; first += 4)
+            {
+                const std::size_t components = 4 * std::min<std::size_t>(4, count - first);
+                std::int32_t fields[16];
+                for (std::size_t j = 0; j < components; j += lanes)
+                {
+                    const std::size_t valid = std::min(lanes, components - j);
+                    const auto scale = Lanes<float>::loadUnaligned(fieldScales<Signed>.data() + j % 4);
+                    const Lanes<float> value = loadLanes<float>(src + 4 * first + j, valid);
+                    storeNarrowed(quantizeLanes<Signed>(value, scale), fields + j, valid);
+                }
+                for (std::size_t j = 0; j < components; j += 4)
+                    out[first + j / 4] = pack1010102(fields[j], fields[j + 1], fields[j + 2], fields[j + 3]);
+            }
+        }
+
+
+        /** @brief Unpack @p count 10:10:10:2 values to `{x, y, z, w}` vectors, four at a time as @ref to1010102. */
+        template <bool Signed>
+        void from1010102(const std::uint32_t* src, float* out, const std::size_t count) noexcept
+        {
+            constexpr std::size_t lanes = Lanes<float>::lanes;
+            for (std::size_t first = 0; first < count; first += 4)
+            {
+                const std::size_t components = 4 * std::min<std::size_t>(4, count - first);
+                std::int32_t fields[16];
+                for (std::size_t j = 0; j < components; j += 4)
+                {
+                    const std::uint32_t packed = src[first + j / 4];
+                    const auto unpacked = Signed ? unpackSigned1010102(packed) : unpackUnsigned1010102(packed);
+                    std::copy(unpacked.begin(), unpacked.end(), fields + j);
+                }
+                for (std::size_t j = 0; j < components; j += lanes)
+                {
+                    const std::size_t valid = std::min(lanes, components - j);
+                    const auto scale = Lanes<float>::loadUnaligned(fieldScales<Signed>.data() + j % 4);
+                    storeLanes<float>(dequantizeLanes<Signed>(loadWidened(fields + j, valid), scale),
+                                      out + 4 * first + j, valid);
+                }
+            }
+        }
+
+
+        /**
+         * @brief Map @p count `{x, y, z}` vectors to 16-bit `{u, v}` octahedral pairs.
+         * @details Gathers a register of each component from the packed vectors, then runs @ref toOctahedral and
+         *          @ref quantizeSnorm on whole registers, with blends in place of the fold's branches.
+         */
+        void vectorsToOctahedral(const float* src, std::int16_t* out, const std::size_t count) noexcept
+        {
+            using L = Lanes<float>;
+            const L zero = L::setzero();
+            const L one = L::broadcast(1.0f);
+            const L scale = L::broadcast(normalizedScale<std::int16_t>);
+
+            forEachBlock<float>(
+                count,
+                [&](const std::size_t i, const std::size_t valid)
+                {
+                    float components[3][L::lanes];
+                    for (std::size_t k = 0; k < valid; ++k)
+                        for (std::size_t c = 0; c < 3; ++c)
+                            components[c][k] = src[3 * (i + k) + c];
+                    const L x = loadLanes<float>(components[0], valid);
+                    const L y = loadLanes<float>(components[1], valid);
+                    const L z = loadLanes<float>(components[2], valid);
+
+                    const L sum = L::abs(x) + L::abs(y) + L::abs(z);
+                    const L u = x / sum;
+                    const L v = y / sum;
+                    const L foldedU = one - L::abs(v);
+                    const L foldedV = one - L::abs(u);
+                    const auto below = L::template compare<Comparison::Less>(z, zero);
+                    const L signedU = L::blend(foldedU, zero - foldedU, L::template compare<Comparison::Less>(u, zero));
+                    const L signedV = L::blend(foldedV, zero - foldedV, L::template compare<Comparison::Less>(v, zero));
+
+                    std::int16_t pairs[2][L::lanes];
+                    storeNarrowed(quantizeLanes<true>(L::blend(u, signedU, below), scale), pairs[0], valid);
+                    storeNarrowed(quantizeLanes<true>(L::blend(v, signedV, below), scale), pairs[1], valid);
+                    for (std::size_t k = 0; k < valid; ++k)
+                    {
+                        out[2 * (i + k)] = pairs[0][k];
+                        out[2 * (i + k) + 1] = pairs[1][k];
+                    }
+                });
+        }
+
+
+        /** @brief Unit `{x, y, z}` vectors of @p count 16-bit octahedral pairs, as @ref fromOctahedral. */
+        void octahedralToVectors(const std::int16_t* src, float* out, const std::size_t count) noexcept
+        {
+            using L = Lanes<float>;
+            const L zero = L::setzero();
+            const L one = L::broadcast(1.0f);
+            const L scale = L::broadcast(normalizedScale<std::int16_t>);
+
+            forEachBlock<float>(
+                count,
+                [&](const std::size_t i, const std::size_t valid)
+                {
+                    std::int16_t pairs[2][L::lanes];
+                    for (std::size_t k = 0; k < valid; ++k)
+                    {
+                        pairs[0][k] = src[2 * (i + k)];
+                        pairs[1][k] = src[2 * (i + k) + 1];
+                    }
+                    const L u = dequantizeLanes<true>(loadWidened(pairs[0], valid), scale);
+                    const L v = dequantizeLanes<true>(loadWidened(pairs[1], valid), scale);
+
+                    const L z = one - L::abs(u) - L::abs(v);
+                    const L below = L::max(zero - z, zero);
+                    const L x = L::blend(u - below, u + below, L::template compare<Comparison::Less>(u, zero));
+                    const L y = L::blend(v - below, v + below, L::template compare<Comparison::Less>(v, zero));
+                    const L length = L::sqrt(x * x + y * y + z * z);
+
+                    float components[3][L::lanes];
+                    (x / length).storeUnaligned(components[0]);
+                    (y / length).storeUnaligned(components[1]);
+                    (z / length).storeUnaligned(components[2]);
+                    for (std::size_t k = 0; k < valid; ++k)
+                        for (std::size_t c = 0; c < 3; ++c)
+                            out[3 * (i + k) + c] = components[c][k];
+                });
+        }
+
+
+        constexpr QuantizeKernels quantizeKernels = {
+            &toNormalized<std::int8_t>, &toNormalized<std::int16_t>, &toNormalized<std::uint8_t>,
+            &toNormalized<std::uint16_t>, &fromNormalized<std::int8_t>, &fromNormalized<std::int16_t>,
+            &fromNormalized<std::uint8_t>, &fromNormalized<std::uint16_t>, &to1010102<true>, &to1010102<false>,
+            &from1010102<true>, &from1010102<false>, &vectorsToOctahedral, &octahedralToVectors
+        };
+
+        template <typename T>
+        constexpr TypedKernels<T> typedKernels = {
+            { &add<T>, &subtract<T>, &multiply<T>, &divide<T>, &scale<T>, &multiplyAdd<T> },
+            { &dot<T>, &mag<T>, &normalize<T>, &safeNormalize<T>, &project<T>, &reject<T>, &deinterleave<T>,
+              &interleave<T>, &equal<T> },
+            { &transform<T, false>, &transform<T, true>, &transformStreams<T, false>, &transformStreams<T, true>,
+              &transformStreamsAffine<T> },
+            { &nlerp<T>, &slerp<T> },
+            { &sum<T>, &minMax<T>, &sumDot<T>, &sumMag<T>, &extremeDistances<T> },
+            { &cullSpheres<T>, &cullBoxes<T> },
+            { &rayTriangle<T>, &rayBox<T>, &raySphere<T> }
+        };
+    } // namespace
+
+
+    const BatchKernels& kernels() noexcept
+    {
+        static constexpr BatchKernels table = { tier, typedKernels<float>, typedKernels<double>,
+                                                { &floatsToHalves, &halvesToFloats }, quantizeKernels };
+        return table;
+    }
+} // namespace falcon::simd::dispatch::FALCON_DISPATCH_TARGET
@@ -0,0 +1,15 @@
+/**
+ * @file BatchKernelsAVX2.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Batch kernels compiled with AVX2, FMA and F16C.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#define FALCON_DISPATCH_TARGET avx2
+#define FALCON_DISPATCH_ISA    ISA::AVX2
+
+#include "BatchKernels.tpp"
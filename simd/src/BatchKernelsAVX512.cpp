@@ -0,0 +1,15 @@
+/**
+ * @file BatchKernelsAVX512.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Batch kernels compiled with AVX-512 F, BW, DQ and VL.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#define FALCON_DISPATCH_TARGET avx512
+#define FALCON_DISPATCH_ISA    ISA::AVX512
+
+#include "BatchKernels.tpp"
@@ -0,0 +1,15 @@
+/**
+ * @file BatchKernelsSSE42.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Batch kernels compiled with SSE4.2.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#define FALCON_DISPATCH_TARGET sse42
+#define FALCON_DISPATCH_ISA    ISA::SSE42
+
+#include "BatchKernels.tpp"
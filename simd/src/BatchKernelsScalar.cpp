@@ -0,0 +1,16 @@
+/**
+ * @file BatchKernelsScalar.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Portable reference batch kernels, compiled with `FORCE_SCALAR`.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#define FORCE_SCALAR
+#define FALCON_DISPATCH_TARGET scalar
+#define FALCON_DISPATCH_ISA    ISA::Scalar
+
+#include "BatchKernels.tpp"
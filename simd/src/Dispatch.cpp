@@ -0,0 +1,223 @@
+/**
+ * @file Dispatch.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief CPUID based instruction set detection and batch kernel binding.
+ * @note Compiled with the baseline flags only; nothing here may execute an instruction newer than the baseline.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Dispatch.h"
+
+#include "BatchKernels.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define FALCON_DISPATCH_X86
+    #ifdef _MSC_VER
+        #include <immintrin.h>
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+
+namespace falcon::simd
+{
+    namespace
+    {
+#ifdef FALCON_DISPATCH_X86
+        struct CpuidResult
+        {
+            std::uint32_t eax, ebx, ecx, edx;
+        };
+
+
+        CpuidResult cpuid(const std::uint32_t leaf, const std::uint32_t subleaf) noexcept
+        {
+    #ifdef _MSC_VER
+            int regs[4];
+            __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+            return { static_cast<std::uint32_t>(regs[0]), static_cast<std::uint32_t>(regs[1]),
+                     static_cast<std::uint32_t>(regs[2]), static_cast<std::uint32_t>(regs[3]) };
+    #else
+            CpuidResult result{};
+            __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+            return result;
+    #endif
+        }
+
+
+        /** @brief Read XCR0, the register state the operating system saves on context switches. */
+        std::uint64_t enabledRegisterState() noexcept
+        {
+    #ifdef _MSC_VER
+            return _xgetbv(0);
+    #else
+            std::uint32_t eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<std::uint64_t>(edx) << 32) | eax;
+    #endif
+        }
+
+
+        constexpr bool hasBit(const std::uint32_t reg, const unsigned bit) noexcept
+        {
+            return (reg >> bit) & 1u;
+        }
+#endif
+
+
+        /** @brief Highest tier compiled into this library that does not exceed @p isa. */
+        ISA clampToCompiled(ISA isa) noexcept
+        {
+            while (isa != ISA::Scalar && !batchKernelsFor(isa))
+                isa = static_cast<ISA>(static_cast<std::uint8_t>(isa) - 1);
+            return isa;
+        }
+    } // namespace
+
+
+
+    /**************************************
+     *                                    *
+     *             DETECTION              *
+     *                                    *
+     **************************************/
+
+    ISA detectISA() noexcept
+    {
+#ifdef FALCON_DISPATCH_X86
+        if (cpuid(0, 0).eax < 7)
+            return ISA::Scalar;
+
+        const CpuidResult leaf1 = cpuid(1, 0);
+        const CpuidResult leaf7 = cpuid(7, 0);
+
+        const bool sse42 = hasBit(leaf1.ecx, 19) && hasBit(leaf1.ecx, 20);
+        if (!sse42)
+            return ISA::Scalar;
+
+        // AVX state is only usable when the OS has enabled XSAVE and saves the XMM and YMM registers.
+        const bool osxsave = hasBit(leaf1.ecx, 27);
+        const std::uint64_t xcr0 = osxsave ? enabledRegisterState() : 0;
+        const bool ymmEnabled = (xcr0 & 0x6) == 0x6;
+        const bool zmmEnabled = (xcr0 & 0xE6) == 0xE6; // Also the opmask and both halves of ZMM0-31.
+
+        // AVX, FMA, F16C and AVX2. F16C comes with every AVX2 CPU, but the tier converts half precision with it.
+        const bool avx2 = ymmEnabled && hasBit(leaf1.ecx, 28) && hasBit(leaf1.ecx, 12) && hasBit(leaf1.ecx, 29) &&
+                          hasBit(leaf7.ebx, 5);
+        if (!avx2)
+            return ISA::SSE42;
+
+        const bool avx512 = zmmEnabled && hasBit(leaf7.ebx, 16) && hasBit(leaf7.ebx, 17) && hasBit(leaf7.ebx, 30) &&
+                            hasBit(leaf7.ebx, 31);
+        return avx512 ? ISA::AVX512 : ISA::AVX2;
+#else
+        return ISA::Scalar;
+#endif
+    }
+
+
+    std::optional<ISA> parseISA(const std::string_view name) noexcept
+    {
+        constexpr std::size_t maxLength = 8;
+        if (name.empty() || name.size() > maxLength)
+            return std::nullopt;
+
+        std::array<char, maxLength> upper{};
+        std::transform(name.begin(), name.end(), upper.begin(),
+                       [](const char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+        const std::string_view normalized(upper.data(), name.size());
+
+        if (normalized == "SCALAR")
+            return ISA::Scalar;
+        if (normalized == "SSE" || normalized == "SSE4.2" || normalized == "AVX")
+            return ISA::SSE42;
+        if (normalized == "AVX2")
+            return ISA::AVX2;
+        if (normalized == "AVX512" || normalized == "AVX-512")
+            return ISA::AVX512;
+        return std::nullopt;
+    }
+
+
+    ISA resolveISA(const ISA detected, const char* override) noexcept
+    {
+        if (!override)
+            return detected;
+
+        const std::optional<ISA> requested = parseISA(override);
+        return requested ? std::min(*requested, detected) : detected;
+    }
+
+
+    ISA activeISA() noexcept
+    {
+        static const ISA active = clampToCompiled(resolveISA(detectISA(), std::getenv("FALCON_FORCE_SIMD")));
+        return active;
+    }
+
+
+    std::string_view toString(const ISA isa) noexcept
+    {
+        switch (isa)
+        {
+            case ISA::Scalar:
+                return "Scalar";
+            case ISA::SSE42:
+                return "SSE4.2";
+            case ISA::AVX2:
+                return "AVX2";
+            case ISA::AVX512:
+                return "AVX-512";
+        }
+        return "Unknown";
+    }
+
+
+
+    /**************************************
+     *                                    *
+     *              BINDING               *
+     *                                    *
+     **************************************/
+
+    const BatchKernels* batchKernelsFor(const ISA isa) noexcept
+    {
+        switch (isa)
+        {
+            case ISA::Scalar:
+                return &dispatch::scalar::kernels();
+#ifdef FALCON_DISPATCH_HAS_SSE42
+            case ISA::SSE42:
+                return &dispatch::sse42::kernels();
+#endif
+#ifdef FALCON_DISPATCH_HAS_AVX2
+            case ISA::AVX2:
+                return &dispatch::avx2::kernels();
+#endif
+#ifdef FALCON_DISPATCH_HAS_AVX512
+            case ISA::AVX512:
+                return &dispatch::avx512::kernels();
+#endif
+            default:
+                return nullptr;
+        }
+    }
+
+
+    const BatchKernels& batchKernels() noexcept
+    {
+        static const BatchKernels& bound = *batchKernelsFor(activeISA());
+        return bound;
+    }
+} // namespace falcon::simd
@@ -3,89 +3,189 @@ cmake_host_system_information(
     QUERY PROCESSOR_NAME
 )
 
+# Oldest instruction set every shipped binary may assume. Header-only code (Vector4D and friends) is compiled at this
+# level; kernels in FalconDispatch are additionally compiled for every newer tier and picked at runtime.
+# NATIVE probes the build machine and should only be used for binaries that never leave it.
+set(FALCON_SIMD_BASELINE "SSE4.2" CACHE STRING "Baseline instruction set: SCALAR, SSE4.2, AVX2, AVX-512 or NATIVE")
+set_property(CACHE FALCON_SIMD_BASELINE PROPERTY STRINGS SCALAR SSE4.2 AVX2 AVX-512 NATIVE)
+
+
+# Each program fails to compile unless the flags enable every extension its tier relies on.
 set(SIMD_AVX512_PROG "
     #include <immintrin.h>
 
+    #if !defined(__AVX512F__) || !defined(__AVX512BW__) || !defined(__AVX512DQ__) || !defined(__AVX512VL__)
+        #error AVX-512 F, BW, DQ and VL are required
+    #endif
+
     int main()
     {
-        float data[16] = {0};
-        __m512 a = _mm512_setzero_ps();
-        _mm512_storeu_ps(data, a);
-        return 0;
+        long long data[8] = {0};
+        __m512i a = _mm512_mullo_epi64(_mm512_loadu_si512(data), _mm512_abs_epi8(_mm512_setzero_si512()));
+        __mmask8 mask = _mm256_cmp_ps_mask(_mm256_setzero_ps(), _mm256_setzero_ps(), _CMP_EQ_OQ);
+        _mm512_mask_storeu_epi64(data, mask, a);
+        return static_cast<int>(data[0]);
     }
 ")
 
 set(SIMD_AVX2_PROG "
     #include <immintrin.h>
 
-    int main() {
-        __m256i data = _mm256_setzero_si256();
-        __m256i result = _mm256_abs_epi32(data); // AVX2 specific intrinsic for calculating absolute value of integers
-        (void)result;
-        return 0;
-    }
-")
-
-set(SIMD_AVX_PROG "
-    #include <immintrin.h>
+    #if !defined(__AVX2__) || !defined(__FMA__) || (!defined(__F16C__) && !defined(_MSC_VER))
+        #error AVX2, FMA and F16C are required
+    #endif
 
     int main()
     {
         float data[8] = {0};
-        __m256 a = _mm256_setzero_ps();
-        _mm256_storeu_ps(data, a);
-        return 0;
+        __m256i ints = _mm256_abs_epi32(_mm256_setzero_si256()); // AVX2 specific intrinsic
+        __m256 a = _mm256_fmadd_ps(_mm256_loadu_ps(data), _mm256_castsi256_ps(ints), _mm256_setzero_ps());
+        _mm256_storeu_ps(data, _mm256_cvtph_ps(_mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)));
+        return static_cast<int>(data[0]);
     }
 ")
 
-set(SIMD_SSE_PROG "
-    #include <xmmintrin.h>
+set(SIMD_SSE42_PROG "
+    #include <immintrin.h>
+
+    #if !defined(__SSE4_2__) && !defined(_MSC_VER)
+        #error SSE4.2 is required
+    #endif
 
     int main()
     {
-        float data[4] = {0};
-        __m128 a = _mm_setzero_ps();
-        _mm_storeu_ps(data, a);
-        return 0;
+        long long data[2] = {0};
+        __m128i a = _mm_cmpgt_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_setzero_si128());
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_blendv_epi8(a, a, a));
+        return static_cast<int>(data[0]);
     }
 ")
 
+include(CheckCXXSourceCompiles)
 include(CheckCXXSourceRuns)
-include(CheckCXXCompilerFlag)
 
-function(AddSIMDCompilerFlag Target)
-    message(CHECK_START "Running SIMD checks for ${CPU_NAME}")
 
-    set(ProgramNames "SIMD_AVX512_PROG;SIMD_AVX2_PROG;SIMD_AVX_PROG;SIMD_SSE_PROG")
-    set(Architectures "AVX-512;AVX2;AVX;SSE")
+# Tiers from newest to oldest. Ids name cache variables, names are what FALCON_SIMD_BASELINE accepts.
+set(FalconSIMDTierIds "AVX512;AVX2;SSE42")
+set(FalconSIMDTierNames "AVX-512;AVX2;SSE4.2")
 
+
+# Compiler flags enabling tier Id (AVX512, AVX2 or SSE42) in OutVar.
+function(FalconSIMDFlags Id OutVar)
     if (MSVC)
-        check_cxx_compiler_flag("/arch:SSE2" COMPILER_SUPPORTS_SSE)
-        set(CompilerFlags "/arch:AVX512;/arch:AVX2;/arch:AVX")
-        if (COMPILER_SUPPORTS_SSE)
-            list(APPEND CompilerFlags "/arch:SSE2")
+        set(Flags_AVX512 "/arch:AVX512")
+        set(Flags_AVX2 "/arch:AVX2")
+        set(Flags_SSE42 "/arch:SSE4.2")
+    else()
+        set(Flags_AVX512 "-mavx512f;-mavx512bw;-mavx512dq;-mavx512vl;-mavx2;-mfma;-mf16c")
+        set(Flags_AVX2 "-mavx2;-mfma;-mf16c")
+        set(Flags_SSE42 "-msse4.2")
+    endif()
+    set(${OutVar} "${Flags_${Id}}" PARENT_SCOPE)
+endfunction(FalconSIMDFlags)
+
+
+# Set OutVar to whether the compiler can build tier Id. Only compiles, so it works for any build machine.
+function(FalconCompilerSupportsSIMD Id OutVar)
+    FalconSIMDFlags(${Id} Flags)
+    list(JOIN Flags " " CMAKE_REQUIRED_FLAGS)
+    check_cxx_source_compiles("${SIMD_${Id}_PROG}" FALCON_COMPILER_HAS_${Id})
+    set(${OutVar} ${FALCON_COMPILER_HAS_${Id}} PARENT_SCOPE)
+endfunction(FalconCompilerSupportsSIMD)
+
+
+# Set OutVar to whether the build machine can run tier Id. Results are cached as HOST_RUNS_<Id>.
+function(FalconHostRunsSIMD Id OutVar)
+    FalconSIMDFlags(${Id} Flags)
+    list(JOIN Flags " " CMAKE_REQUIRED_FLAGS)
+    check_cxx_source_runs("${SIMD_${Id}_PROG}" HOST_RUNS_${Id})
+    set(${OutVar} ${HOST_RUNS_${Id}} PARENT_SCOPE)
+endfunction(FalconHostRunsSIMD)
+
+
+# Add the FALCON_SIMD_BASELINE flags to Target with the given Scope (PRIVATE, PUBLIC or INTERFACE).
+function(FalconApplySIMDBaseline Target Scope)
+    if (FALCON_SIMD_BASELINE STREQUAL "NATIVE")
+        AddSIMDCompilerFlag(${Target} ${Scope})
+        return()
+    endif()
+    if (FALCON_SIMD_BASELINE STREQUAL "SCALAR")
+        return()
+    endif()
+
+    list(FIND FalconSIMDTierNames "${FALCON_SIMD_BASELINE}" Index)
+    if (Index EQUAL -1)
+        message(FATAL_ERROR "Unknown FALCON_SIMD_BASELINE '${FALCON_SIMD_BASELINE}'")
+    endif()
+
+    list(GET FalconSIMDTierIds ${Index} Id)
+    FalconCompilerSupportsSIMD(${Id} Supported)
+    if (NOT Supported)
+        message(FATAL_ERROR "The compiler cannot build the ${FALCON_SIMD_BASELINE} baseline")
+    endif()
+
+    FalconSIMDFlags(${Id} Flags)
+    target_compile_options(${Target} ${Scope} ${Flags})
+endfunction(FalconApplySIMDBaseline)
+
+
+# Add one source per tier to Target, in FalconSIMDTierIds order, compiled with that tier's flags.
+# Tiers the compiler cannot build are left out; the ones added define FALCON_DISPATCH_HAS_<Id> on Target.
+function(FalconAddDispatchTiers Target)
+    set(Sources ${ARGN})
+    list(LENGTH FalconSIMDTierIds TierCount)
+    math(EXPR LastTier "${TierCount} - 1")
+
+    foreach(i RANGE ${LastTier})
+        list(GET FalconSIMDTierIds ${i} Id)
+        list(GET FalconSIMDTierNames ${i} Name)
+        list(GET Sources ${i} Source)
+
+        FalconCompilerSupportsSIMD(${Id} Supported)
+        if (Supported)
+            FalconSIMDFlags(${Id} Flags)
+            target_sources(${Target} PRIVATE ${Source})
+            set_source_files_properties(${Source} PROPERTIES COMPILE_OPTIONS "${Flags}")
+            target_compile_definitions(${Target} PRIVATE FALCON_DISPATCH_HAS_${Id})
+            message(STATUS "Runtime dispatch: building ${Name} kernels")
         else()
-            list(APPEND CompilerFlags " ")
+            message(STATUS "Runtime dispatch: compiler cannot build ${Name} kernels, skipping")
         endif()
-    else()
-        set(CompilerFlags "-mavx512f;-mavx2;-mavx;-msse4.2")
+    endforeach()
+endfunction(FalconAddDispatchTiers)
+
+
+# Enable the newest instruction set the build machine can run on Target.
+# Only use this for targets that run where they are built (tests, the playground); shipped code should rely on
+# FALCON_SIMD_BASELINE plus runtime dispatch instead.
+function(AddSIMDCompilerFlag Target)
+    set(Scope PRIVATE)
+    if (ARGC GREATER 1)
+        set(Scope ${ARGV1})
+    endif()
+
+    message(CHECK_START "Running SIMD checks for ${CPU_NAME}")
+
+    if (CMAKE_CROSSCOMPILING)
+        message(CHECK_FAIL "cross compiling, cannot probe the build machine")
+        return()
     endif()
 
+    list(LENGTH FalconSIMDTierIds TierCount)
+    math(EXPR LastTier "${TierCount} - 1")
+
     set(SIMDSupported False)
-    foreach(i RANGE 3)
-        list(GET CompilerFlags ${i} Flag)
-        list(GET ProgramNames ${i} ProgName)
-        list(GET Architectures ${i} Arch)
-        set(Program "${${ProgName}}")
-
-        set(CMAKE_REQUIRED_FLAGS ${Flag})
-            message(STATUS "Running checks for ${Arch}...")
-            check_cxx_source_runs("${Program}" HAS_${Arch})
-        unset(CMAKE_REQUIRED_FLAGS)
-
-        if(HAS_${Arch})
+    foreach(i RANGE ${LastTier})
+        list(GET FalconSIMDTierIds ${i} Id)
+        list(GET FalconSIMDTierNames ${i} Arch)
+
+        message(STATUS "Running checks for ${Arch}...")
+        FalconHostRunsSIMD(${Id} HostRuns)
+
+        if(HostRuns)
+            FalconSIMDFlags(${Id} Flags)
             target_compile_options(
-                ${Target} PRIVATE ${Flag}
+                ${Target} ${Scope} ${Flags}
             )
             message(CHECK_PASS "${CPU_NAME} supports ${Arch}. Enabling ${Arch}...")
             set(SIMDSupported True)
@@ -95,4 +195,4 @@ function(AddSIMDCompilerFlag Target)
     if(NOT(SIMDSupported))
         message(CHECK_FAIL "${CPU_NAME} doesn't support SIMD instruction set")
     endif()
-endfunction(AddSIMDCompilerFlag)
\ No newline at end of file
+endfunction(AddSIMDCompilerFlag)
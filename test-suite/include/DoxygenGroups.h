@@ -60,6 +60,46 @@
              *   @defgroup T_FGM_Vec4_String_Repr Formatted String Representation
              *   @defgroup T_FGM_Vec4_Type_Conv Conversion Constructor
              *   @defgroup T_FGM_Vec4_Inversion Unary Inversion(-)
+             *   @defgroup T_FGM_Vec4_Mask Lane Masks and Blending
+             *   @defgroup T_FGM_Vec4_Simd SIMD Storage and Kernels
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_Vec4Array_Tests Vec4Array Test Suite
+             * @brief Verification of structure-of-arrays 4D vector containers.
+             * @ingroup VectorTests
+             * @{
+             *   @defgroup T_FGM_Vec4Array_Container Storage, Growth and Layout Conversion
+             *   @defgroup T_FGM_Vec4Array_Batch Batch Arithmetic and Geometry
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_PaddedVector3D_Tests PaddedVector3D Test Suite
+             * @brief Verification of padded 3D vectors and the padded Matrix3D storage.
+             * @ingroup VectorTests
+             * @{
+             *   @defgroup T_FGM_PVec3 Layout, Arithmetic, Products and Packing
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_VectorReductions_Tests Vector Reductions Test Suite
+             * @brief Verification of bounds, sums, means and distance extremes over packed and structure-of-arrays
+             *        vectors.
+             * @ingroup VectorTests
+             * @{
+             *   @defgroup T_FGM_Vec_Reduce Reductions, Summation Modes and Thread Determinism
+             * @}
+             */
+
+            /**
+             * @defgroup FGM_Quantization_Tests Vector Quantization Test Suite
+             * @brief Verification of SNORM, UNORM, 10:10:10:2 and octahedral encodings, their error bounds and streams.
+             * @ingroup VectorTests
+             * @{
+             *   @defgroup T_FGM_Vec_Quantize Encodings, Error Bounds and Streams
              * @}
              */
 
@@ -67,6 +107,79 @@
 
     /** @} */ // End of VectorTests
 
+    /**
+     * @defgroup MatrixTests Matrices
+     * @brief Test suite for matrices.
+     * @ingroup MathTests
+     * @{
+     *   @defgroup T_FGM_Mat4_Batch Batch Vector Transforms
+     *   @defgroup T_FGM_Affine3 Affine Composition, Inversion and Batch Transforms
+     * @}
+     */
+
+    /**
+     * @defgroup QuaternionTests Quaternions
+     * @brief Test suite for quaternions.
+     * @ingroup MathTests
+     * @{
+     *   @defgroup T_FGM_Quat Composition, Rotation, Conversion and Interpolation
+     *   @defgroup T_FGM_Quat_Batch Batch Interpolation
+     * @}
+     */
+
+    /**
+     * @defgroup T_FGM_Math_Functions Constant-Evaluable Math Functions
+     * @brief Compile-time square roots and the vector and matrix math built on them, against run time results.
+     * @ingroup MathTests
+     */
+
+    /**
+     * @defgroup T_FGM_Half Half Precision
+     * @brief Half rounding, vectors and matrices of half computing in float, and bulk buffer conversion.
+     * @ingroup MathTests
+     */
+
+    /**
+     * @defgroup T_FGM_Expr Expression Templates
+     * @brief Lazy vector and matrix expressions against their eager results.
+     * @ingroup MathTests
+     */
+
+    /**
+     * @defgroup ParallelTests Parallel Batches
+     * @brief Test suite for the thread pool and chunked batch operations.
+     * @ingroup MathTests
+     * @{
+     *   @defgroup T_FGM_Parallel Thread Pool, Chunking and Chunked Batches
+     * @}
+     */
+
+    /**
+     * @defgroup GeometryTests Geometry
+     * @brief Test suite for planes, bounding volumes, frustums, rays, batch culling and bounding volume hierarchies.
+     * @ingroup MathTests
+     * @{
+     *   @defgroup T_FGM_Geometry Planes, Bounding Volumes, Frustums and Rays
+     *   @defgroup T_FGM_Culling Batch Culling and Compaction
+     *   @defgroup T_FGM_Ray_Packets Ray Packets
+     *   @defgroup T_FGM_BVH Bounding Volume Hierarchies
+     * @}
+     */
+
+    /**
+     * @defgroup SIMDTests SIMD
+     * @brief Test suite for the falcon SIMD library.
+     * @ingroup FGMTestSuite
+     * @{
+     *   @defgroup T_SIMD_Register_Init Register Initialization, Load and Store
+     *   @defgroup T_SIMD_Register_Addition Register Addition and Subtraction
+     *   @defgroup T_SIMD_Register_Arithmetic Register Arithmetic
+     *   @defgroup T_SIMD_Register_Comparison Register Comparison, Masks and Blending
+     *   @defgroup T_SIMD_Dispatch Runtime Dispatch and Batch Kernels
+     *   @defgroup T_SIMD_Memory Aligned Allocation and Buffers
+     * @}
+     */
+
     /**
      * @defgroup T_Utils Test Utilities
      * @brief Diagnostic and validation utilities for testing.
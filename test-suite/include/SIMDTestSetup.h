@@ -12,7 +12,130 @@
 
 #include <SIMD.h>
 
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
 
 using SupportedSIMDTypes =
     ::testing::Types<unsigned char, bool, int, unsigned int, float, double, std::size_t, long long>;
 using SupportedSIMDIntegralTypes = ::testing::Types<unsigned char, bool, int, unsigned int, std::size_t, long long>;
+
+
+/**
+ * @brief Lane type and width pair describing one @ref falcon::simd::Register under test.
+ *
+ * @tparam T     Lane type.
+ * @tparam Width Register width in bytes.
+ */
+template <typename T, std::size_t Width>
+struct RegisterConfig
+{
+    using value_type = T;
+    using register_type = falcon::simd::Register<T, Width>;
+
+    static constexpr std::size_t width = Width;
+    static constexpr std::size_t lanes = Width / sizeof(T);
+    static constexpr bool supported = falcon::simd::isRegisterSupported<T, Width>;
+};
+
+
+/** @brief True if `Config` is enabled for this build. */
+template <typename Config>
+struct IsSupportedConfig: std::bool_constant<Config::supported>
+{};
+
+/** @brief True if `Config` is enabled and holds floating point lanes. */
+template <typename Config>
+struct IsFloatingConfig
+    : std::bool_constant<Config::supported && std::is_floating_point_v<typename Config::value_type>>
+{};
+
+/** @brief True if `Config` is enabled and holds unsigned integer lanes. */
+template <typename Config>
+struct IsUnsignedConfig: std::bool_constant<Config::supported && std::is_unsigned_v<typename Config::value_type>>
+{};
+
+/** @brief True if `Config` is enabled and holds 64-bit integer lanes. */
+template <typename Config>
+struct IsWideIntegerConfig
+    : std::bool_constant<Config::supported && std::is_integral_v<typename Config::value_type> &&
+                         sizeof(typename Config::value_type) == 8>
+{};
+
+
+/** @brief Keep the configurations of a `std::tuple` satisfying `Keep`, so filtered-out widths are never built. */
+template <template <typename> class Keep, typename Tuple>
+struct FilterConfigs;
+
+template <template <typename> class Keep, typename... Configs>
+struct FilterConfigs<Keep, std::tuple<Configs...>>
+{
+    using type = decltype(std::tuple_cat(
+        std::declval<std::conditional_t<Keep<Configs>::value, std::tuple<Configs>, std::tuple<>>>()...));
+};
+
+
+/** @brief Convert a `std::tuple` of configurations into a `::testing::Types` list. */
+template <typename Tuple>
+struct ToTestingTypes;
+
+template <typename... Configs>
+struct ToTestingTypes<std::tuple<Configs...>>
+{
+    using type = ::testing::Types<Configs...>;
+};
+
+
+/** @brief Every lane type and width combination exercised by the register tests. */
+using AllRegisterConfigs =
+    std::tuple<RegisterConfig<float, 16>, RegisterConfig<float, 32>, RegisterConfig<float, 64>,
+               RegisterConfig<double, 16>, RegisterConfig<double, 32>, RegisterConfig<double, 64>,
+               RegisterConfig<int, 16>, RegisterConfig<int, 32>, RegisterConfig<int, 64>,
+               RegisterConfig<unsigned int, 16>, RegisterConfig<unsigned int, 32>, RegisterConfig<long long, 16>,
+               RegisterConfig<long long, 32>, RegisterConfig<long long, 64>, RegisterConfig<std::size_t, 16>,
+               RegisterConfig<std::size_t, 32>, RegisterConfig<std::size_t, 64>, RegisterConfig<short, 16>,
+               RegisterConfig<unsigned short, 32>, RegisterConfig<signed char, 16>,
+               RegisterConfig<unsigned char, 32>, RegisterConfig<unsigned char, 64>>;
+
+
+/** @brief `::testing::Types` list of the @ref AllRegisterConfigs satisfying `Keep`. */
+template <template <typename> class Keep>
+using RegisterConfigsWhere = typename ToTestingTypes<typename FilterConfigs<Keep, AllRegisterConfigs>::type>::type;
+
+using SupportedRegisterConfigs = RegisterConfigsWhere<IsSupportedConfig>;
+using FloatingRegisterConfigs = RegisterConfigsWhere<IsFloatingConfig>;
+using UnsignedRegisterConfigs = RegisterConfigsWhere<IsUnsignedConfig>;
+using WideIntegerRegisterConfigs = RegisterConfigsWhere<IsWideIntegerConfig>;
+
+
+/**
+ * @brief Test fixture providing aligned operand and output buffers for one @ref RegisterConfig.
+ *
+ * @tparam Config @ref RegisterConfig under test.
+ */
+template <typename Config>
+class RegisterTest: public ::testing::Test
+{
+    protected:
+    using T = typename Config::value_type;
+    using Reg = typename Config::register_type;
+    static constexpr std::size_t lanes = Config::lanes;
+
+    alignas(64) T _lhs[lanes];
+    alignas(64) T _rhs[lanes];
+    alignas(64) T _out[lanes];
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < lanes; ++i)
+        {
+            // Mix signs, magnitudes and equal lanes so every predicate has both outcomes.
+            const auto index = static_cast<long long>(i);
+            const long long value = i % 3 == 0 ? index + 1 : (std::is_signed_v<T> ? -index : index * 2);
+            _lhs[i] = static_cast<T>(value);
+            _rhs[i] = i % 4 == 0 ? _lhs[i] : static_cast<T>(index + 2);
+            _out[i] = static_cast<T>(0);
+        }
+    }
+};
@@ -10,7 +10,6 @@
  */
 
 
-#define FORCE_SCALAR
 #define ENABLE_FGM_SHADER_OPERATORS
 
 #include "./utils/VectorUtils.h"
@@ -25,3 +24,4 @@ using SupportedTypes = ::testing::Types<unsigned char, bool, int, unsigned int,
 using SupportedArithmeticTypes =
     ::testing::Types<unsigned char, int, unsigned int, float, double, std::size_t, long long>;
 using SupportedSignedArithmeticTypes = ::testing::Types<short, int, float, double, long long>;
+using BatchTypes = ::testing::Types<float, double>;
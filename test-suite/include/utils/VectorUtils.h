@@ -13,13 +13,18 @@
  */
 
 
-#include <common/MathTraits.h>
+#include <algorithm>
 #include <cmath>
+#include <common/MathTraits.h>
+#include <concepts>
 #include <gtest/gtest.h>
+#include <limits>
+#include <random>
 #include <type_traits>
 #include <vector/Vector2D.h>
 #include <vector/Vector3D.h>
 #include <vector/Vector4D.h>
+#include <vector>
 
 namespace testutils
 {
@@ -51,7 +56,11 @@ namespace testutils
         constexpr std::size_t elementCount = T::dimension;
 
         for (std::size_t i = 0; i < elementCount; ++i)
-            if constexpr (std::is_same_v<ValueType, double>)
+            /** @note Exact matches short-circuit so infinities pass on GoogleTest releases whose `EXPECT_NEAR`
+             *        computes `inf - inf`. */
+            if (expected[i] == static_cast<ValueType>(actual[i]))
+                continue;
+            else if constexpr (std::is_same_v<ValueType, double>)
                 EXPECT_NEAR(expected[i], static_cast<ValueType>(actual[i]), fgm::Config::DOUBLE_EPSILON);
             else if constexpr (std::is_floating_point_v<ValueType>)
                 EXPECT_NEAR(expected[i], static_cast<ValueType>(actual[i]), fgm::Config::FLOAT_EPSILON);
@@ -234,9 +243,11 @@ namespace testutils
     void EXPECT_VEC_INF(const T& vector)
     {
         constexpr std::size_t elementCount = T::dimension;
-        if (std::is_floating_point_v<T>)
+        if constexpr (std::is_floating_point_v<typename T::value_type>)
+        {
             for (std::size_t i = 0; i < elementCount; ++i)
                 EXPECT_TRUE(std::isinf(vector[i]));
+        }
     }
 
 
@@ -262,6 +273,63 @@ namespace testutils
     }
 
 
+    /**
+     * @brief Generate reproducible vectors whose components span many binades.
+     *
+     * @tparam T Floating point component type.
+     * @param count Number of vectors to generate.
+     *
+     * @return @p count vectors with components in $ [-2^{20}, 2^{20}] $, each vector scaled by its own power of two so
+     *         squared magnitudes stay normal numbers.
+     */
+    template <std::floating_point T>
+    std::vector<fgm::Vector4D<T>> scatteredVectors(const std::size_t count)
+    {
+        std::mt19937 engine(2026);
+        std::uniform_real_distribution<T> component(T(-1), T(1));
+        std::uniform_int_distribution<int> exponent(-20, 20);
+
+        std::vector<fgm::Vector4D<T>> vectors;
+        vectors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T scale = std::ldexp(T(1), exponent(engine));
+            vectors.emplace_back(component(engine) * scale, component(engine) * scale, component(engine) * scale,
+                                 component(engine) * scale);
+        }
+        return vectors;
+    }
+
+
+    /**
+     * @brief Measure how far a normalized vector is from the exact unit vector.
+     *
+     * @tparam T Floating point component type.
+     * @param source The vector that was normalized.
+     * @param unit The normalized vector being evaluated.
+     *
+     * @return Largest component error in units in the last place of `T`, against a `long double` reference.
+     */
+    template <std::floating_point T>
+    long double normalizeUlpError(const fgm::Vector4D<T>& source, const fgm::Vector4D<T>& unit)
+    {
+        using Wide = long double;
+        const Wide magnitude =
+            std::sqrt(Wide(source.x) * source.x + Wide(source.y) * source.y + Wide(source.z) * source.z +
+                      Wide(source.w) * source.w);
+
+        Wide worst = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            const Wide expected = Wide(source[i]) / magnitude;
+            const T rounded = std::abs(static_cast<T>(expected));
+            const Wide ulp = Wide(std::nextafter(rounded, std::numeric_limits<T>::infinity())) - rounded;
+            worst = std::max(worst, std::abs(Wide(unit[i]) - expected) / ulp);
+        }
+        return worst;
+    }
+
+
     // clang-format off
     /**
      * @brief Validates that a @ref fgm::Vector4D components are positive `INFINITY`.
@@ -0,0 +1,282 @@
+/**
+ * @file ConstexprMathTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::sqrt, @ref fgm::rsqrt, @ref fgm::abs and @ref fgm::isnan, and the vector and matrix math
+ *        evaluated at compile time against the same math at run time.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <common/ConstexprMath.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <matrix/Matrix2D.h>
+#include <matrix/Matrix3D.h>
+#include <matrix/Matrix4D.h>
+#include <random>
+#include <vector/Vector3D.h>
+#include <vector/Vector4D.h>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/** @brief `true` if @p lhs and @p rhs have the same bit pattern. */
+template <typename T>
+bool bitEqual(const T lhs, const T rhs)
+{
+    return std::bit_cast<fgm::detail::FloatBits<T>>(lhs) == std::bit_cast<fgm::detail::FloatBits<T>>(rhs);
+}
+
+
+/** @brief Table of the roots of `0` to `N - 1`, baked at compile time. */
+template <std::size_t N>
+constexpr std::array<float, N> makeRootTable()
+{
+    std::array<float, N> table{};
+    for (std::size_t i = 0; i < N; ++i)
+        table[i] = fgm::sqrt(static_cast<float>(i));
+    return table;
+}
+
+
+constexpr std::array<float, 256> rootTable = makeRootTable<256>();
+
+constexpr double bakedRootTwo = fgm::sqrt(2.0);
+constexpr float bakedRootThird = fgm::sqrt(1.0f / 3.0f);
+
+constexpr fgm::Matrix4D<double> bakedMat4(2.0, 0.0, 1.0, 3.0, 0.0, 1.0, 4.0, 0.0, 1.0, 0.0, 3.0, 2.0, 0.0, 5.0, 0.0,
+                                          1.0);
+constexpr fgm::Matrix4D<double> bakedMat4Inverse = bakedMat4.inverse();
+
+constexpr fgm::Matrix3D<double> bakedMat3(4.0, 7.0, 2.0, 3.0, 6.0, 1.0, 2.0, 5.0, 3.0);
+constexpr fgm::Matrix3D<double> bakedMat3Inverse = bakedMat3.inverse();
+
+
+/**
+ * @addtogroup T_FGM_Math_Functions
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *            SQUARE ROOT             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that known roots, integer radicands and special values are evaluated at compile time. */
+TEST(ConstexprMath_Sqrt, EvaluatesKnownRootsAndSpecialValuesAtCompileTime)
+{
+    static_assert(fgm::sqrt(4.0) == 2.0);
+    static_assert(fgm::sqrt(0.25f) == 0.5f);
+    static_assert(fgm::sqrt(16) == 4.0);
+    static_assert(std::is_same_v<decltype(fgm::sqrt(16)), double>);
+    static_assert(fgm::sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity());
+    static_assert(fgm::isnan(fgm::sqrt(-1.0f)));
+    static_assert(fgm::isnan(fgm::sqrt(std::numeric_limits<double>::quiet_NaN())));
+    static_assert(std::bit_cast<std::uint64_t>(fgm::sqrt(-0.0)) == std::bit_cast<std::uint64_t>(-0.0));
+
+    EXPECT_TRUE(std::isnan(fgm::sqrt(-1.0)));
+}
+
+
+/** @test Verify that a root baked at compile time is bit-identical to `std::sqrt` at run time. */
+TEST(ConstexprMath_Sqrt, CompileTimeRootMatchesRuntimeRootBitForBit)
+{
+    volatile double two = 2.0;
+    volatile float third = 1.0f / 3.0f;
+
+    EXPECT_TRUE(bitEqual(std::sqrt(two), bakedRootTwo));
+    EXPECT_TRUE(bitEqual(std::sqrt(third), bakedRootThird));
+
+    for (std::size_t i = 0; i < rootTable.size(); ++i)
+        EXPECT_TRUE(bitEqual(std::sqrt(static_cast<float>(i)), rootTable[i])) << "at " << i;
+}
+
+
+/** @test Verify that the integer root rounds like `std::sqrt` over spread out floats, subnormals included. */
+TEST(ConstexprMath_Sqrt, IntegerRootMatchesHardwareForFloats)
+{
+    // Stepping by a prime touches every exponent and many significand patterns of the positive finite floats.
+    for (std::uint32_t bits = 1; bits < 0x7F800000u; bits += 4099u)
+    {
+        const float value = std::bit_cast<float>(bits);
+        ASSERT_TRUE(bitEqual(std::sqrt(value), fgm::detail::sqrtBits(value))) << "at bits " << bits;
+    }
+
+    for (const float value : { std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min(),
+                               std::numeric_limits<float>::max(), 1.0f, 2.0f, 0.5f })
+        EXPECT_TRUE(bitEqual(std::sqrt(value), fgm::detail::sqrtBits(value))) << "at " << value;
+}
+
+
+/** @test Verify that the integer root rounds like `std::sqrt` over random doubles, subnormals included. */
+TEST(ConstexprMath_Sqrt, IntegerRootMatchesHardwareForDoubles)
+{
+    std::mt19937_64 engine(20261017u);
+    std::uniform_int_distribution<std::uint64_t> positiveFinite(1u, 0x7FEFFFFFFFFFFFFFull);
+    std::uniform_int_distribution<std::uint64_t> subnormal(1u, 0x000FFFFFFFFFFFFFull);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const double value = std::bit_cast<double>(positiveFinite(engine));
+        ASSERT_TRUE(bitEqual(std::sqrt(value), fgm::detail::sqrtBits(value))) << "at " << value;
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        const double value = std::bit_cast<double>(subnormal(engine));
+        ASSERT_TRUE(bitEqual(std::sqrt(value), fgm::detail::sqrtBits(value))) << "at " << value;
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *       RECIPROCAL SQUARE ROOT       *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every tier computes the exact reciprocal root at compile time. */
+TEST(ConstexprMath_Rsqrt, EveryTierIsExactAtCompileTime)
+{
+    static_assert(fgm::rsqrt(4.0) == 0.5);
+    static_assert(fgm::rsqrt<fgm::Precision::Fast>(0.25f) == 2.0f);
+    static_assert(fgm::rsqrt<fgm::Precision::Refined>(16.0f) == 0.25f);
+}
+
+
+/** @test Verify the accuracy of every tier at run time. */
+TEST(ConstexprMath_Rsqrt, RuntimeTiersStayWithinTheirErrorBounds)
+{
+    for (const float value : { 1e-6f, 0.1f, 1.0f, 2.0f, 3.0f, 1234.5f, 1e6f })
+    {
+        const float expected = 1.0f / std::sqrt(value);
+        EXPECT_EQ(expected, fgm::rsqrt(value));
+        EXPECT_NEAR(expected, fgm::rsqrt<fgm::Precision::Fast>(value), expected * 4e-4f);
+        EXPECT_NEAR(expected, fgm::rsqrt<fgm::Precision::Refined>(value), expected * 1e-6f);
+    }
+
+    EXPECT_EQ(1.0 / std::sqrt(3.0), fgm::rsqrt<fgm::Precision::Fast>(3.0));
+}
+
+
+
+/**************************************
+ *                                    *
+ *        ABSOLUTE VALUE AND NAN      *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the absolute value maps negative zero to positive zero at compile time and at run time. */
+TEST(ConstexprMath_Abs, HandlesSignedZeroAndIntegers)
+{
+    static_assert(fgm::abs(-2.5) == 2.5);
+    static_assert(fgm::abs(-3) == 3);
+    static_assert(fgm::abs(7u) == 7u);
+    static_assert(std::bit_cast<std::uint32_t>(fgm::abs(-0.0f)) == 0u);
+    static_assert(fgm::isnan(fgm::abs(std::numeric_limits<float>::quiet_NaN())));
+    static_assert(!fgm::isnan(std::numeric_limits<double>::infinity()));
+
+    volatile float negativeZero = -0.0f;
+    EXPECT_FALSE(std::signbit(fgm::abs(negativeZero)));
+    EXPECT_EQ(1.5f, fgm::abs(-1.5f));
+}
+
+
+
+/**************************************
+ *                                    *
+ *         VECTORS AND MATRICES       *
+ *                                    *
+ **************************************/
+
+/** @test Verify that magnitudes and normal vectors are baked at compile time and match the run time results. */
+TEST(ConstexprMath_Vectors, MagnitudeAndNormalizeEvaluateAtCompileTime)
+{
+    constexpr fgm::Vector4D<float> vec(1.0f, 2.0f, 2.0f, 4.0f);
+    constexpr float magnitude = vec.mag();
+    constexpr fgm::Vector4D<float> unit = vec.normalize();
+    static_assert(magnitude == 5.0f);
+    static_assert(unit.x == 0.2f && unit.w == 0.8f);
+
+    constexpr fgm::Vector3D<double> vec3(3.0, 4.0, 12.0);
+    static_assert(vec3.mag() == 13.0);
+    static_assert(vec3.cross(fgm::Vector3D<double>(0.0, 0.0, 1.0)).x == 4.0);
+
+    const fgm::Vector4D<float> runtimeUnit = fgm::Vector4D<float>(vec).normalize();
+    EXPECT_FLOAT_EQ(runtimeUnit.x, unit.x);
+    EXPECT_FLOAT_EQ(runtimeUnit.y, unit.y);
+    EXPECT_FLOAT_EQ(runtimeUnit.z, unit.z);
+    EXPECT_FLOAT_EQ(runtimeUnit.w, unit.w);
+}
+
+
+/** @test Verify that 2D matrix products, transposes and inverses evaluate at compile time. */
+TEST(ConstexprMath_Matrices, Matrix2DEvaluatesAtCompileTime)
+{
+    constexpr fgm::Matrix2D<float> mat(4.0f, 3.0f, 2.0f, 2.0f);
+    constexpr fgm::Matrix2D<float> product = mat * mat.inverse();
+    constexpr fgm::Matrix2D<float> transposed = mat.transpose();
+
+    static_assert(mat.determinant() == 2.0f);
+    static_assert(product(0, 0) == 1.0f && product(1, 1) == 1.0f);
+    static_assert(transposed(0, 1) == 2.0f && transposed(1, 0) == 3.0f);
+
+    const fgm::Matrix2D<float> runtimeInverse = fgm::Matrix2D<float>(mat).inverse();
+    constexpr fgm::Matrix2D<float> inverse = mat.inverse();
+    for (std::size_t r = 0; r < 2; ++r)
+        for (std::size_t c = 0; c < 2; ++c)
+            EXPECT_FLOAT_EQ(runtimeInverse(r, c), inverse(r, c));
+}
+
+
+/** @test Verify that a 3D inverse baked at compile time matches the run time inverse. */
+TEST(ConstexprMath_Matrices, Matrix3DInverseEvaluatesAtCompileTime)
+{
+    static_assert(bakedMat3.determinant() == 9.0);
+    static_assert(bakedMat3.transpose()(0, 1) == 3.0);
+    static_assert((bakedMat3 * fgm::Vector3D<double>(1.0, 0.0, 0.0)).y == 3.0);
+
+    const fgm::Matrix3D<double> runtimeInverse = fgm::Matrix3D<double>(bakedMat3).inverse();
+    const fgm::Matrix3D<double> product = bakedMat3 * bakedMat3Inverse;
+    for (std::size_t r = 0; r < 3; ++r)
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_DOUBLE_EQ(runtimeInverse(r, c), bakedMat3Inverse(r, c));
+            EXPECT_NEAR(r == c ? 1.0 : 0.0, product(r, c), 1e-12);
+        }
+}
+
+
+/** @test Verify that a 4D inverse and its status are evaluated at compile time and match the run time inverse. */
+TEST(ConstexprMath_Matrices, Matrix4DInverseEvaluatesAtCompileTime)
+{
+    static_assert(bakedMat4.transpose()(1, 3) == 5.0);
+    static_assert(bakedMat4(2, 1) == 0.0 && bakedMat4(0, 2) == 1.0);
+    static_assert([] {
+        fgm::Matrix4D<double> out;
+        return (bakedMat4 * 0.0).tryInverse(out) == OperationStatus::DIVISIONBYZERO;
+    }());
+
+    const fgm::Matrix4D<double> runtimeInverse = fgm::Matrix4D<double>(bakedMat4).inverse();
+    const fgm::Matrix4D<double> product = bakedMat4 * bakedMat4Inverse;
+    for (std::size_t r = 0; r < 4; ++r)
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            EXPECT_NEAR(runtimeInverse(r, c), bakedMat4Inverse(r, c), 1e-12);
+            EXPECT_NEAR(r == c ? 1.0 : 0.0, product(r, c), 1e-12);
+        }
+}
+
+/** @} */
@@ -0,0 +1,253 @@
+/**
+ * @file HalfTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the rounding of @ref fgm::half, vectors and matrices of it computing in `float`, and the bulk
+ *        conversions of buffers.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <bit>
+#include <cmath>
+#include <common/Half.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <matrix/Matrix4D.h>
+#include <type_traits>
+#include <vector/Vector2D.h>
+#include <vector/Vector3D.h>
+#include <vector/Vector4D.h>
+#include <vector>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+using fgm::half;
+
+/** @brief Float bit pattern @p bits. */
+constexpr float floatOf(const std::uint32_t bits)
+{
+    return std::bit_cast<float>(bits);
+}
+
+
+/**
+ * @addtogroup T_FGM_Half
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *             ROUNDING               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that widening every half and rounding it back gives the same half, NaNs staying NaN. */
+TEST(Half_Rounding, RoundTripsEveryHalf)
+{
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+    {
+        const half value = half::fromBits(static_cast<std::uint16_t>(bits));
+        const float widened = value;
+        if ((bits & 0x7C00) == 0x7C00 && (bits & 0x3FF) != 0)
+        {
+            ASSERT_TRUE(std::isnan(widened)) << std::hex << bits;
+            EXPECT_EQ(bits | 0x200, half(widened).bits()) << "NaNs are made quiet, 0x" << std::hex << bits;
+            continue;
+        }
+        ASSERT_EQ(bits, half(widened).bits()) << std::hex << bits;
+    }
+}
+
+
+/** @test Verify that floats round to the nearest half, ties to the even one, over every exponent. */
+TEST(Half_Rounding, RoundsToNearestEven)
+{
+    // Floats stepping through every finite half interval, against the two halves bracketing the result.
+    for (std::uint32_t bits = 0; bits < 0x477FF000u; bits += 4093)
+    {
+        const float value = floatOf(bits);
+        const half rounded(value);
+        const float nearest = rounded;
+        const float below = half::fromBits(static_cast<std::uint16_t>(rounded.bits() - (rounded.bits() != 0)));
+        const float above = half::fromBits(static_cast<std::uint16_t>(rounded.bits() + 1));
+
+        const float error = std::abs(value - nearest);
+        ASSERT_LE(error, std::abs(value - below)) << std::hex << bits;
+        ASSERT_LE(error, std::abs(value - above)) << std::hex << bits;
+        const bool tie = (nearest != below && error == std::abs(value - below)) || error == std::abs(value - above);
+        if (tie)
+        {
+            ASSERT_EQ(0, rounded.bits() & 1) << "ties go to the even half, 0x" << std::hex << bits;
+        }
+    }
+
+    EXPECT_EQ(0x3C00, half(1.0f + 0x1p-11f).bits());      // Tie, down to the even 1
+    EXPECT_EQ(0x3C02, half(1.0f + 0x3p-11f).bits());      // Tie, up to the even 1 + 2^-9
+    EXPECT_EQ(0x3C01, half(floatOf(0x3F801001u)).bits()); // Just past the tie
+    EXPECT_EQ(0x7BFF, half(65504.0f).bits());
+    EXPECT_EQ(0x7BFF, half(65519.99f).bits());
+    EXPECT_EQ(0x8400, half(-0x1p-14f).bits());
+}
+
+
+/** @test Verify the subnormal, overflow, infinity, NaN and signed zero cases. */
+TEST(Half_Rounding, HandlesSpecialValues)
+{
+    EXPECT_EQ(0x0001, half(0x1p-24f).bits());
+    EXPECT_EQ(0x0000, half(0x1p-25f).bits()); // Tie between 0 and the smallest subnormal
+    EXPECT_EQ(0x0001, half(0x1.000002p-25f).bits());
+    EXPECT_EQ(0x0002, half(0x3p-25f).bits()); // Tie, up to the even 2 * 2^-24
+    EXPECT_EQ(0x03FF, half(0x3FFp-24f).bits());
+    EXPECT_EQ(0x0400, half(0x7FFp-25f).bits()); // Largest subnormal plus half a unit rounds up to the smallest normal
+    EXPECT_EQ(0x8000, half(-0x1p-30f).bits());
+    EXPECT_EQ(0x8000, half(-0.0f).bits());
+
+    EXPECT_EQ(0x7C00, half(65520.0f).bits());
+    EXPECT_EQ(0xFC00, half(-1e10f).bits());
+    EXPECT_EQ(0x7C00, half(std::numeric_limits<float>::infinity()).bits());
+    EXPECT_EQ(0x7E00, half(std::numeric_limits<float>::quiet_NaN()).bits());
+    EXPECT_EQ(0xFE15, half(floatOf(0xFF82A000u)).bits()); // Sign and top payload bits kept, made quiet
+
+    EXPECT_TRUE(std::isinf(float(std::numeric_limits<half>::infinity())));
+    EXPECT_TRUE(std::isnan(float(std::numeric_limits<half>::quiet_NaN())));
+    EXPECT_EQ(65504.0f, float(std::numeric_limits<half>::max()));
+    EXPECT_EQ(-65504.0f, float(std::numeric_limits<half>::lowest()));
+    EXPECT_EQ(0x1p-14f, float(std::numeric_limits<half>::min()));
+    EXPECT_EQ(0x1p-24f, float(std::numeric_limits<half>::denorm_min()));
+    EXPECT_EQ(0x1p-10f, float(std::numeric_limits<half>::epsilon()));
+}
+
+
+/** @test Verify that conversion and compound assignment are evaluated at compile time. */
+TEST(Half_Rounding, EvaluatesAtCompileTime)
+{
+    constexpr half third = 1.0f / 3.0f;
+    static_assert(third.bits() == 0x3555);
+    static_assert(float(half(-2.5f)) == -2.5f);
+    static_assert(half(0x1p-24f).bits() == 0x0001);
+    static_assert(float(half::fromBits(0x0001)) == 0x1p-24f);
+
+    constexpr half accumulated = []
+    {
+        half value = 1.0f;
+        value += 0.5f;
+        value *= 4.0f;
+        value -= 1.0f;
+        value /= 2.0f;
+        return value;
+    }();
+    static_assert(float(accumulated) == 2.5f);
+    EXPECT_EQ(0x3555, third.bits());
+}
+
+
+
+/**************************************
+ *                                    *
+ *         VECTORS AND MATRICES       *
+ *                                    *
+ **************************************/
+
+/** @test Verify that vectors of half are tightly packed and compute in float, rounding each stored result. */
+TEST(Half_Vectors, ComputeInFloat)
+{
+    static_assert(sizeof(fgm::Vector4D<half>) == 8 && sizeof(fgm::Vector2D<half>) == 4);
+    static_assert(std::is_same_v<std::common_type_t<half, float>, float>);
+    static_assert(std::is_same_v<std::common_type_t<int, half>, float>);
+    static_assert(std::is_same_v<std::common_type_t<half, double>, double>);
+    static_assert(std::is_same_v<fgm::Magnitude<half>, float>);
+
+    const fgm::Vector4D<half> a(1.5f, -2.0f, 0.25f, 1000.0f);
+    const fgm::Vector4D<half> b(0.5f, 4.0f, 1.0f / 3.0f, 0.125f);
+
+    // Sums are rounded once, from the float result.
+    const fgm::Vector4D<half> sum = a + b;
+    EXPECT_EQ(half(2.0f).bits(), sum.x.bits());
+    EXPECT_EQ(half(0.25f + float(half(1.0f / 3.0f))).bits(), sum.z.bits());
+    EXPECT_EQ(half(1000.125f).bits(), sum.w.bits()); // Halves near 1000 are 0.5 apart, so the 0.125 is lost
+    EXPECT_EQ(1000.0f, float(sum.w));
+
+    const auto mixed = a * 2.0f + fgm::Vector4D<float>(b);
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(mixed)>, fgm::Vector4D<float>>);
+    EXPECT_EQ(float(half(1.0f / 3.0f)) + 0.5f, mixed.z);
+
+    // The dot product rounds its float sum to half, while the magnitude stays float past the half range.
+    EXPECT_EQ(half(1.5f * 0.5f + -2.0f * 4.0f + 0.25f * float(half(1.0f / 3.0f)) + 1000.0f * 0.125f).bits(),
+              a.dot(b).bits());
+    const fgm::Vector4D<half> big(200.0f, 200.0f, 200.0f, 200.0f);
+    EXPECT_TRUE(std::isinf(float(big.dot(big))));
+    EXPECT_FLOAT_EQ(400.0f, big.mag());
+
+    fgm::Vector4D<half> accumulated = a;
+    accumulated += b;
+    accumulated *= 2.0f;
+    accumulated -= b;
+    EXPECT_EQ(half(2.0f * 2.0f - 0.5f).bits(), accumulated.x.bits());
+    EXPECT_EQ(2.0f, float((-a).y));
+
+    const fgm::Vector2D<half> u(3.0f, 4.0f), v(1.0f, 2.0f);
+    EXPECT_FLOAT_EQ(5.0f, u.mag());
+    EXPECT_EQ(11.0f, float(u.dot(v)));
+    EXPECT_EQ(half(4.0f).bits(), (u + v).x.bits());
+
+    // Widening converts exactly and narrowing rounds each component.
+    const fgm::Vector4D<float> widened(a);
+    EXPECT_EQ(1000.0f, widened.w);
+    const fgm::Vector4D<half> narrowed(fgm::Vector4D<float>(0.1f, 0.2f, 0.3f, 70000.0f));
+    EXPECT_EQ(half(0.1f).bits(), narrowed.x.bits());
+    EXPECT_TRUE(std::isinf(float(narrowed.w)));
+}
+
+
+/** @test Verify that buffers of vectors and matrices convert as their components do, through the batch kernels. */
+TEST(Half_Vectors, ConvertBuffers)
+{
+    std::vector<fgm::Vector4D<float>> positions;
+    std::vector<float> components;
+    for (int i = 0; i < 37; ++i)
+    {
+        const float f = static_cast<float>(i);
+        positions.emplace_back(f * 0.1f, -f * 7.3f, 1.0f / (f + 1.0f), f * f * 41.0f);
+        for (int c = 0; c < 4; ++c)
+            components.push_back(positions.back()[c]);
+    }
+
+    std::vector<fgm::Vector4D<half>> packed(positions.size());
+    std::vector<half> packedComponents(components.size());
+    fgm::toHalf<fgm::Vector4D>(positions, packed);
+    fgm::toHalf(components, packedComponents);
+
+    std::vector<fgm::Vector4D<float>> unpacked(positions.size());
+    fgm::toFloat<fgm::Vector4D>(packed, unpacked);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            EXPECT_EQ(half(positions[i][c]).bits(), packed[i][c].bits()) << i << ", " << c;
+            EXPECT_EQ(packedComponents[4 * i + c].bits(), packed[i][c].bits()) << i << ", " << c;
+            EXPECT_EQ(float(packed[i][c]), unpacked[i][c]) << i << ", " << c;
+        }
+
+    std::vector<float> widened(components.size());
+    fgm::toFloat(packedComponents, widened);
+    for (std::size_t i = 0; i < components.size(); ++i)
+        EXPECT_EQ(float(packedComponents[i]), widened[i]);
+
+    const fgm::Matrix4D<float> matrix(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 0.1f,
+                                      0.2f, 0.3f, 0.4f);
+    fgm::Matrix4D<half> packedMatrix;
+    fgm::toHalf<fgm::Matrix4D>(std::span(&matrix, 1), std::span(&packedMatrix, 1));
+    for (std::size_t r = 0; r < 4; ++r)
+        for (std::size_t c = 0; c < 4; ++c)
+            EXPECT_EQ(half(matrix(r, c)).bits(), packedMatrix(r, c).bits()) << r << ", " << c;
+}
+
+/** @} */
@@ -0,0 +1,160 @@
+/**
+ * @file ExpressionTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies that @ref fgm::expr expressions evaluate to the same results as the eager operators.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "utils/VectorUtils.h"
+
+#include <cmath>
+#include <expr/Expression.h>
+#include <gtest/gtest.h>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class ExpressionTest: public ::testing::Test
+{
+    protected:
+    const fgm::Vector4D<T> _a{ T(1), T(-2), T(3), T(4) };
+    const fgm::Vector4D<T> _b{ T(5), T(6), T(-7), T(8) };
+    const fgm::Vector4D<T> _c{ T(-1), T(2), T(2), T(-3) };
+    const fgm::Matrix4D<T> _m{ T(2), T(0), T(1), T(0), T(-1), T(3), T(0), T(1),
+                               T(0),  T(1), T(4), T(2), T(5), T(-2), T(1), T(1) };
+    const fgm::Matrix4D<T> _n{ T(1), T(2), T(0), T(1), T(0), T(1), T(3), T(0),
+                               T(2),  T(0), T(1), T(1), T(1), T(1), T(0), T(2) };
+
+    /** @brief Expect equal vectors, allowing the rounding fused multiply-adds save on floating point types. */
+    static void expectVecNear(const fgm::Vector4D<T>& expected, const fgm::Vector4D<T>& actual)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            for (std::size_t i = 0; i < 4; ++i)
+                EXPECT_NEAR(expected[i], actual[i], fgm::Config::EPSILON<T> * (std::abs(expected[i]) + T(1)));
+        }
+        else
+            testutils::EXPECT_VEC_EQ(expected, actual);
+    }
+
+    /** @brief @ref expectVecNear on every column. */
+    static void expectMatNear(const fgm::Matrix4D<T>& expected, const fgm::Matrix4D<T>& actual)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            SCOPED_TRACE(j);
+            expectVecNear(expected[j], actual[j]);
+        }
+    }
+};
+/** @brief Register backed types (`float`, `double`, `long long`) and a type evaluated component by component. */
+using ExpressionTypes = ::testing::Types<float, double, long long, int>;
+TYPED_TEST_SUITE(ExpressionTest, ExpressionTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Expr
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *         VECTOR EXPRESSIONS         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that chained sums, differences and scaling match the eager operators. */
+TYPED_TEST(ExpressionTest, VectorChain_MatchesEagerResult)
+{
+    using T = TypeParam;
+    using fgm::expr::lazy;
+
+    const fgm::Vector4D<T> lazyResult = lazy(this->_a) * T(2) + this->_b * T(3) - this->_c;
+    this->expectVecNear(this->_a * T(2) + this->_b * T(3) - this->_c, lazyResult);
+
+    const fgm::Vector4D<T> negated = -(lazy(this->_a) - this->_b) + T(4) * lazy(this->_c);
+    this->expectVecNear(-(this->_a - this->_b) + this->_c * T(4), negated);
+
+    // A product subtracted from a product contracts with a negated scalar.
+    const fgm::Vector4D<T> difference = lazy(this->_a) * T(3) - lazy(this->_b) * T(2);
+    this->expectVecNear(this->_a * T(3) - this->_b * T(2), difference);
+}
+
+
+/** @test Verify that assigning into an operand reads every operand first. */
+TYPED_TEST(ExpressionTest, Assign_AllowsDestinationAsOperand)
+{
+    using T = TypeParam;
+
+    fgm::Vector4D<T> vec = this->_a;
+    fgm::expr::assign(vec, fgm::expr::lazy(vec) * T(2) + this->_b - vec);
+    this->expectVecNear(this->_a + this->_b, vec);
+
+    fgm::Matrix4D<T> mat = this->_m;
+    fgm::expr::assign(mat, fgm::expr::lazy(mat) * mat);
+    this->expectMatNear(this->_m * this->_m, mat);
+}
+
+
+/** @test Verify that vector expressions evaluate in constant expressions. */
+TEST(ConstexprExpression, VectorChain_Evaluates)
+{
+    constexpr fgm::Vector4D<float> a(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr fgm::Vector4D<float> b(0.5f, 0.5f, 0.5f, 0.5f);
+    constexpr fgm::Vector4D<float> result = fgm::expr::lazy(a) * 2.0f - b;
+
+    static_assert(result.x == 1.5f && result.y == 3.5f && result.z == 5.5f && result.w == 7.5f);
+}
+
+
+
+/**************************************
+ *                                    *
+ *         MATRIX EXPRESSIONS         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that lazy matrix-vector products, with and without an addend, match the eager operators. */
+TYPED_TEST(ExpressionTest, Transform_MatchesEagerResult)
+{
+    using T = TypeParam;
+    using fgm::expr::lazy;
+
+    const fgm::Vector4D<T> transformed = lazy(this->_m) * this->_a;
+    this->expectVecNear(this->_m * this->_a, transformed);
+
+    const fgm::Vector4D<T> offset = this->_m * (lazy(this->_a) * T(2)) + this->_b;
+    this->expectVecNear(this->_m * (this->_a * T(2)) + this->_b, offset);
+
+    const fgm::Vector4D<T> subtracted = this->_c - lazy(this->_m) * this->_a;
+    this->expectVecNear(this->_c - this->_m * this->_a, subtracted);
+}
+
+
+/** @test Verify that matrix sums, differences, scaling and products match the eager operators. */
+TYPED_TEST(ExpressionTest, MatrixChain_MatchesEagerResult)
+{
+    using T = TypeParam;
+    using fgm::expr::lazy;
+
+    const fgm::Matrix4D<T> combined = lazy(this->_m) * T(2) + this->_n - lazy(this->_n) * T(3);
+    this->expectMatNear(this->_m * T(2) + this->_n - this->_n * T(3), combined);
+
+    const fgm::Matrix4D<T> product = lazy(this->_m) * this->_n * this->_m;
+    this->expectMatNear(this->_m * this->_n * this->_m, product);
+
+    const fgm::Vector4D<T> chained = (lazy(this->_m) * this->_n) * this->_a - this->_b;
+    this->expectVecNear(this->_m * this->_n * this->_a - this->_b, chained);
+}
+
+/** @} */
@@ -0,0 +1,291 @@
+/**
+ * @file BVHTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the structure of @ref fgm::BVH builds and refits, and its ray queries against testing every
+ *        primitive.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <algorithm>
+#include <cmath>
+#include <geometry/BVH.h>
+#include <limits>
+#include <parallel/ThreadPool.h>
+#include <random>
+#include <vector>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class BVHTest: public ::testing::Test
+{
+    protected:
+    static constexpr std::size_t triangleCount = 2000;
+    static constexpr std::size_t rayCount = 500;
+    static constexpr T infinity = std::numeric_limits<T>::infinity();
+
+    std::vector<fgm::Vector3D<T>> _vertices;
+    std::vector<fgm::Ray<T>> _rays;
+
+    void SetUp() override
+    {
+        // Small triangles scattered through a cube, and rays from outside it towards points inside.
+        std::mt19937 engine(20261017u);
+        std::uniform_real_distribution<T> position(T(-10), T(10));
+        std::uniform_real_distribution<T> offset(T(-0.75), T(0.75));
+        for (std::size_t i = 0; i < triangleCount; ++i)
+        {
+            const fgm::Vector3D<T> center(position(engine), position(engine), position(engine));
+            for (int v = 0; v < 3; ++v)
+                _vertices.push_back(center + fgm::Vector3D<T>(offset(engine), offset(engine), offset(engine)));
+        }
+        for (std::size_t i = 0; i < rayCount; ++i)
+        {
+            const fgm::Vector3D<T> origin(position(engine), position(engine), T(-15));
+            const fgm::Vector3D<T> target(position(engine), position(engine), position(engine));
+            _rays.emplace_back(origin, target - origin);
+        }
+    }
+
+    /** @brief Closest hit of @p ray over every triangle of @p vertices, testing them all. */
+    static bool bruteForce(const fgm::Ray<T>& ray, const std::vector<fgm::Vector3D<T>>& vertices, T& distance,
+                           std::uint32_t& primitive)
+    {
+        bool hit = false;
+        for (std::size_t v = 0; v < vertices.size(); v += 3)
+            if (ray.intersects(vertices[v], vertices[v + 1], vertices[v + 2], distance))
+            {
+                hit = true;
+                primitive = static_cast<std::uint32_t>(v / 3);
+            }
+        return hit;
+    }
+
+    /** @brief Expect every primitive in exactly one leaf of at most @p leafSize, inside the boxes above it. */
+    static void expectWellFormed(const fgm::BVH<T>& bvh, const std::vector<fgm::AABB<T>>& bounds,
+                                 const std::size_t leafSize)
+    {
+        const auto contains = [](const fgm::AABB<T>& outer, const fgm::AABB<T>& inner)
+        { return outer.contains(inner.min) && outer.contains(inner.max); };
+
+        std::vector<int> seen(bounds.size(), 0);
+        const auto nodes = bvh.nodes();
+        for (std::size_t n = 0; n < nodes.size(); ++n)
+        {
+            const auto& node = nodes[n];
+            ASSERT_GE(node.childCount, 1u);
+            ASSERT_LE(node.childCount, fgm::BVH<T>::width);
+            for (std::size_t lane = 0; lane < node.childCount; ++lane)
+            {
+                if (node.count[lane] == 0)
+                {
+                    ASSERT_GT(node.child[lane], n) << "children must follow their parent";
+                    ASSERT_LT(node.child[lane], nodes.size());
+                    EXPECT_TRUE(contains(node.bounds(lane), nodes[node.child[lane]].bounds())) << "node " << n;
+                    continue;
+                }
+
+                EXPECT_LE(node.count[lane], leafSize);
+                for (std::uint32_t i = node.child[lane]; i < node.child[lane] + node.count[lane]; ++i)
+                {
+                    const std::uint32_t primitive = bvh.primitiveIndices()[i];
+                    ++seen[primitive];
+                    EXPECT_TRUE(contains(node.bounds(lane), bounds[primitive])) << "primitive " << primitive;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < seen.size(); ++i)
+            EXPECT_EQ(1, seen[i]) << "primitive " << i;
+    }
+
+    /** @brief Expect closest and any hits of the rays against @p bvh to match testing every triangle. */
+    void expectQueriesMatchBruteForce(const fgm::BVH<T>& bvh, const std::vector<fgm::Vector3D<T>>& vertices) const
+    {
+        const fgm::TriangleIntersector<T> triangles{ vertices };
+        std::size_t hitCount = 0;
+        for (std::size_t r = 0; r < _rays.size(); ++r)
+        {
+            T expected = infinity, distance = infinity;
+            std::uint32_t expectedPrimitive = 0, primitive = 0;
+            const bool expectedHit = bruteForce(_rays[r], vertices, expected, expectedPrimitive);
+            ASSERT_EQ(expectedHit, bvh.closestHit(_rays[r], triangles, distance, primitive)) << "ray " << r;
+            EXPECT_EQ(expected, distance) << "ray " << r;
+            if (!expectedHit)
+                continue;
+
+            ++hitCount;
+            T primitiveDistance = infinity;
+            EXPECT_TRUE(triangles(primitive, _rays[r], primitiveDistance));
+            EXPECT_EQ(expected, primitiveDistance) << "ray " << r << " reported a farther triangle";
+
+            // Occlusion just short of and just past the closest hit.
+            EXPECT_FALSE(bvh.anyHit(_rays[r], triangles, expected * T(0.999))) << "ray " << r;
+            EXPECT_TRUE(bvh.anyHit(_rays[r], triangles, expected * T(1.001))) << "ray " << r;
+        }
+        EXPECT_GT(hitCount, rayCount / 4);
+        EXPECT_LT(hitCount, rayCount);
+    }
+};
+
+TYPED_TEST_SUITE(BVHTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_BVH
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *               BUILD                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a built hierarchy holds every primitive once, in leaves no larger than asked for. */
+TYPED_TEST(BVHTest, Build_CoversEveryPrimitiveOnce)
+{
+    using T = TypeParam;
+    const std::vector<fgm::AABB<T>> bounds = fgm::triangleBounds<T>(this->_vertices);
+    for (const std::size_t leafSize : { std::size_t(1), std::size_t(4), std::size_t(16) })
+    {
+        SCOPED_TRACE(leafSize);
+        const fgm::BVH<T> bvh(bounds, { .leafSize = leafSize });
+        EXPECT_EQ(this->triangleCount, bvh.size());
+        this->expectWellFormed(bvh, bounds, leafSize);
+
+        const fgm::AABB<T> root = bvh.bounds();
+        for (const fgm::AABB<T>& box : bounds)
+            EXPECT_TRUE(root.contains(box.min) && root.contains(box.max));
+    }
+}
+
+
+/** @test Verify that primitives the heuristic cannot separate still end up in leaves of the requested size. */
+TYPED_TEST(BVHTest, Build_SplitsCoincidentPrimitivesAtTheMedian)
+{
+    using T = TypeParam;
+    const std::vector<fgm::AABB<T>> bounds(100, fgm::AABB<T>({ T(-1), T(-1), T(-1) }, { T(1), T(1), T(1) }));
+    const fgm::BVH<T> bvh(bounds);
+    this->expectWellFormed(bvh, bounds, 4);
+}
+
+
+/** @test Verify that building across threads gives the same nodes as building on one. */
+TYPED_TEST(BVHTest, Build_DoesNotDependOnTheThreadCount)
+{
+    using T = TypeParam;
+    const std::vector<fgm::AABB<T>> bounds = fgm::triangleBounds<T>(this->_vertices);
+    fgm::parallel::ThreadPool serial(1), threads(4);
+    const fgm::BVH<T> reference(bounds, { .parallelThreshold = 16, .pool = &serial });
+    const fgm::BVH<T> parallel(bounds, { .parallelThreshold = 16, .pool = &threads });
+
+    ASSERT_EQ(reference.nodes().size(), parallel.nodes().size());
+    for (std::size_t n = 0; n < reference.nodes().size(); ++n)
+    {
+        const auto& expected = reference.nodes()[n];
+        const auto& actual = parallel.nodes()[n];
+        ASSERT_EQ(expected.childCount, actual.childCount) << "node " << n;
+        for (std::size_t lane = 0; lane < expected.childCount; ++lane)
+        {
+            EXPECT_EQ(expected.child[lane], actual.child[lane]) << "node " << n;
+            EXPECT_EQ(expected.count[lane], actual.count[lane]) << "node " << n;
+            EXPECT_EQ(expected.bounds(lane).min.x, actual.bounds(lane).min.x) << "node " << n;
+            EXPECT_EQ(expected.bounds(lane).max.z, actual.bounds(lane).max.z) << "node " << n;
+        }
+    }
+    EXPECT_TRUE(std::equal(reference.primitiveIndices().begin(), reference.primitiveIndices().end(),
+                           parallel.primitiveIndices().begin(), parallel.primitiveIndices().end()));
+}
+
+
+
+/**************************************
+ *                                    *
+ *              QUERIES               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that an empty hierarchy, and one over a single triangle, answer as testing every triangle does. */
+TYPED_TEST(BVHTest, Queries_HandleEmptyAndSingleTriangleHierarchies)
+{
+    using T = TypeParam;
+    const std::vector<fgm::Vector3D<T>> triangle = { { T(-1), T(-1), T(0) }, { T(1), T(-1), T(0) },
+                                                     { T(0), T(1), T(0) } };
+    const fgm::Ray<T> ray({ T(0), T(0), T(-2) }, { T(0), T(0), T(1) });
+    const fgm::TriangleIntersector<T> intersector{ triangle };
+
+    const fgm::BVH<T> empty;
+    T distance = this->infinity;
+    std::uint32_t primitive = 7;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(empty.closestHit(ray, intersector, distance, primitive));
+    EXPECT_FALSE(empty.anyHit(ray, intersector, distance));
+    EXPECT_EQ(this->infinity, distance);
+    EXPECT_EQ(7u, primitive);
+
+    const fgm::BVH<T> single(fgm::triangleBounds<T>(triangle));
+    ASSERT_EQ(1u, single.nodes().size());
+    EXPECT_TRUE(single.closestHit(ray, intersector, distance, primitive));
+    EXPECT_EQ(T(2), distance);
+    EXPECT_EQ(0u, primitive);
+    EXPECT_TRUE(single.anyHit(ray, intersector, T(2)));
+    EXPECT_FALSE(single.anyHit(ray, intersector, T(1.5)));
+}
+
+
+/** @test Verify that closest and any hits match testing every triangle. */
+TYPED_TEST(BVHTest, Queries_MatchTestingEveryTriangle)
+{
+    using T = TypeParam;
+    for (const std::size_t leafSize : { std::size_t(1), std::size_t(4) })
+    {
+        SCOPED_TRACE(leafSize);
+        const fgm::BVH<T> bvh(fgm::triangleBounds<T>(this->_vertices), { .leafSize = leafSize });
+        this->expectQueriesMatchBruteForce(bvh, this->_vertices);
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *               REFIT                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a refit hierarchy bounds the moved triangles and still answers exactly. */
+TYPED_TEST(BVHTest, Refit_TracksMovedTriangles)
+{
+    using T = TypeParam;
+    fgm::BVH<T> bvh(fgm::triangleBounds<T>(this->_vertices));
+
+    // Swirl the triangles around the z axis by an angle growing with their height, as a skinned mesh deforms.
+    std::vector<fgm::Vector3D<T>> moved(this->_vertices);
+    for (std::size_t v = 0; v < moved.size(); v += 3)
+    {
+        const T angle = moved[v].z * T(0.1);
+        const T cosine = std::cos(angle), sine = std::sin(angle);
+        for (std::size_t k = v; k < v + 3; ++k)
+            moved[k] = { moved[k].x * cosine - moved[k].y * sine, moved[k].x * sine + moved[k].y * cosine,
+                         moved[k].z };
+    }
+
+    const std::vector<fgm::AABB<T>> bounds = fgm::triangleBounds<T>(moved);
+    bvh.refit(bounds);
+    this->expectWellFormed(bvh, bounds, 4);
+    this->expectQueriesMatchBruteForce(bvh, moved);
+}
+
+/** @} */
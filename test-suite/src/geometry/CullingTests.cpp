@@ -0,0 +1,228 @@
+/**
+ * @file CullingTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the batch sphere and box culling of @ref Culling.h against the per volume tests of
+ *        @ref fgm::Frustum, and the compaction of visibility bitsets.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <algorithm>
+#include <cmath>
+#include <geometry/Culling.h>
+#include <limits>
+#include <vector>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class CullingTest: public ::testing::Test
+{
+    protected:
+    /** @note Not a multiple of 64, so the last bitset word is partial, and several chunks long when forced parallel. */
+    static constexpr std::size_t count = 5003;
+
+    /** @brief Results within this distance of a plane may differ between the fused and the scalar tests. */
+    static constexpr T tolerance = T(1e-3);
+
+    fgm::Frustum<T> _frustum;
+    fgm::Vec4Array<T> _spheres;
+    fgm::Vec4Array<T> _boxMin;
+    fgm::Vec4Array<T> _boxMax;
+
+    void SetUp() override
+    {
+        // Right-handed 90 degree perspective looking down -z, near 1 and far 50.
+        const T zNear = T(1), zFar = T(50);
+        _frustum = fgm::Frustum<T>::fromMatrix(fgm::Matrix4D<T>(T(1), T(0), T(0), T(0), T(0), T(1), T(0), T(0), T(0),
+                                                                T(0), (zFar + zNear) / (zNear - zFar),
+                                                                T(2) * zFar * zNear / (zNear - zFar), T(0), T(0),
+                                                                T(-1), T(0)));
+
+        // Volumes on a skewed lattice around the frustum, from well inside to well outside every plane.
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T x = static_cast<T>(static_cast<int>(i * 7 % 61) - 30);
+            const T y = static_cast<T>(static_cast<int>(i * 13 % 47) - 23);
+            const T z = T(5) - static_cast<T>(i % 67);
+            const T reach = T(0.5) * static_cast<T>(i % 9);
+
+            _spheres.push_back({ x, y, z, reach });
+            _boxMin.push_back({ x - reach, y - T(0.5) * reach, z - T(2) * reach, T(0) });
+            _boxMax.push_back({ x + reach, y + T(0.5) * reach, z + reach, T(0) });
+        }
+    }
+
+    /** @brief Expect @p visible to hold the results of @p intersects except for volumes at @p slack of a plane. */
+    template <typename Intersects, typename Slack>
+    void expectMatchesScalar(const std::vector<std::uint64_t>& visible, Intersects&& intersects, Slack&& slack) const
+    {
+        ASSERT_EQ((count + 63) / 64, visible.size());
+        std::size_t checked = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T nearest = std::numeric_limits<T>::infinity();
+            for (const fgm::Plane<T>& plane : _frustum.planes)
+                nearest = std::min(nearest, std::abs(slack(plane, i)));
+            if (nearest < tolerance)
+                continue;
+
+            ++checked;
+            EXPECT_EQ(intersects(i), ((visible[i / 64] >> (i % 64)) & 1) != 0) << "volume " << i;
+        }
+        EXPECT_GT(checked, count / 2);
+        EXPECT_EQ(0u, visible.back() >> (count % 64)) << "bits past the last volume must be clear";
+    }
+
+    /** @brief Expect the spheres culled with @p options to match @ref fgm::Frustum::intersects. */
+    void expectSpheresMatch(const fgm::parallel::ChunkOptions& options) const
+    {
+        expectMatchesScalar(
+            fgm::cullSpheres(_frustum, _spheres, options),
+            [&](const std::size_t i)
+            {
+                const fgm::Vector4D<T> sphere = _spheres[i];
+                return _frustum.intersects(fgm::Sphere<T>({ sphere.x, sphere.y, sphere.z }, sphere.w));
+            },
+            [&](const fgm::Plane<T>& plane, const std::size_t i)
+            {
+                const fgm::Vector4D<T> sphere = _spheres[i];
+                return plane.signedDistance({ sphere.x, sphere.y, sphere.z }) + sphere.w;
+            });
+    }
+
+    /** @brief Expect the boxes culled with @p options to match @ref fgm::Frustum::intersects. */
+    void expectBoxesMatch(const fgm::parallel::ChunkOptions& options) const
+    {
+        const auto box = [&](const std::size_t i)
+        {
+            const fgm::Vector4D<T> low = _boxMin[i], high = _boxMax[i];
+            return fgm::AABB<T>({ low.x, low.y, low.z }, { high.x, high.y, high.z });
+        };
+
+        expectMatchesScalar(
+            fgm::cullBoxes(_frustum, _boxMin, _boxMax, options),
+            [&](const std::size_t i) { return _frustum.intersects(box(i)); },
+            [&](const fgm::Plane<T>& plane, const std::size_t i)
+            {
+                const fgm::AABB<T> volume = box(i);
+                const fgm::Vector3D<T> extents = volume.extents();
+                return plane.signedDistance(volume.center()) + std::abs(plane.normal.x) * extents.x +
+                       std::abs(plane.normal.y) * extents.y + std::abs(plane.normal.z) * extents.z;
+            });
+    }
+};
+
+TYPED_TEST_SUITE(CullingTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Culling
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *          BATCH CULLING             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that batch sphere culling keeps exactly the spheres the frustum intersects. */
+TYPED_TEST(CullingTest, CullSpheres_MatchFrustumIntersects)
+{
+    this->expectSpheresMatch({});
+}
+
+
+/** @test Verify that batch box culling keeps exactly the boxes the frustum intersects. */
+TYPED_TEST(CullingTest, CullBoxes_MatchFrustumIntersects)
+{
+    this->expectBoxesMatch({});
+}
+
+
+/** @test Verify that culling split into chunks of whole words across a pool matches culling on one thread. */
+TYPED_TEST(CullingTest, ParallelCulling_MatchesSerial)
+{
+    fgm::parallel::ThreadPool pool(4);
+    fgm::parallel::ChunkOptions options;
+    options.pool = &pool;
+    options.parallelThreshold = 0;
+    options.chunkBytes = 1024;
+
+    EXPECT_EQ(fgm::cullSpheres(this->_frustum, this->_spheres),
+              fgm::cullSpheres(this->_frustum, this->_spheres, options));
+    EXPECT_EQ(fgm::cullBoxes(this->_frustum, this->_boxMin, this->_boxMax),
+              fgm::cullBoxes(this->_frustum, this->_boxMin, this->_boxMax, options));
+    this->expectSpheresMatch(options);
+    this->expectBoxesMatch(options);
+}
+
+
+/** @test Verify that volumes with NaN components are kept and that empty buffers give empty bitsets. */
+TYPED_TEST(CullingTest, CullVolumes_KeepNaNAndAcceptEmptyInputs)
+{
+    using T = TypeParam;
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+    const fgm::Vec4Array<T> spheres = { { T(0), T(0), T(1000), T(1) }, { nan, T(0), T(-5), T(1) } };
+    EXPECT_EQ(std::vector<std::uint64_t>{ 0b10 }, fgm::cullSpheres(this->_frustum, spheres));
+
+    const fgm::Vec4Array<T> low = { { T(-1), T(-1), T(-6), T(0) }, { T(100), T(100), nan, T(0) } };
+    const fgm::Vec4Array<T> high = { { T(1), T(1), T(-4), T(0) }, { T(101), T(101), T(-4), T(0) } };
+    EXPECT_EQ(std::vector<std::uint64_t>{ 0b11 }, fgm::cullBoxes(this->_frustum, low, high));
+
+    EXPECT_TRUE(fgm::cullSpheres(this->_frustum, fgm::Vec4Array<T>()).empty());
+    EXPECT_TRUE(fgm::cullBoxes(this->_frustum, fgm::Vec4Array<T>(), fgm::Vec4Array<T>()).empty());
+}
+
+
+/**************************************
+ *                                    *
+ *            COMPACTION              *
+ *                                    *
+ **************************************/
+
+/** @test Verify that visible indices list every set bit in increasing order, across word boundaries. */
+TEST(Culling_VisibleIndices, ListsSetBitsInOrder)
+{
+    const std::vector<std::uint64_t> visible = { 0b1001, 0, (std::uint64_t(1) << 63) | 1, 0b110 };
+    const std::vector<std::size_t> expected = { 0, 3, 128, 191, 193, 194 };
+    EXPECT_EQ(expected, fgm::visibleIndices(visible));
+
+    std::vector<std::size_t> out(8, 99);
+    EXPECT_EQ(expected.size(), fgm::visibleIndices(visible, out));
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+    EXPECT_EQ(99u, out[expected.size()]) << "entries past the written indices must be untouched";
+
+    EXPECT_TRUE(fgm::visibleIndices(std::vector<std::uint64_t>(3, 0)).empty());
+    EXPECT_TRUE(fgm::visibleIndices(std::vector<std::uint64_t>()).empty());
+}
+
+
+/** @test Verify that the indices compacted from a culling bitset are the kept volumes. */
+TYPED_TEST(CullingTest, VisibleIndices_RoundTripCullingBitset)
+{
+    const std::vector<std::uint64_t> visible = fgm::cullSpheres(this->_frustum, this->_spheres);
+    const std::vector<std::size_t> indices = fgm::visibleIndices(visible);
+
+    std::vector<std::uint64_t> rebuilt(visible.size());
+    for (const std::size_t i : indices)
+        rebuilt[i / 64] |= std::uint64_t(1) << (i % 64);
+    EXPECT_EQ(visible, rebuilt);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_FALSE(indices.empty());
+}
+
+/** @} */
@@ -0,0 +1,253 @@
+/**
+ * @file GeometryTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::Plane, @ref fgm::AABB, @ref fgm::Sphere and the extraction and volume tests of
+ *        @ref fgm::Frustum.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <cmath>
+#include <common/ConstexprMath.h>
+#include <geometry/BoundingVolumes.h>
+#include <geometry/Frustum.h>
+#include <geometry/Plane.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <matrix/Matrix4D.h>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/**
+ * @brief Right-handed perspective projection looking down `-z`, 90 degrees vertically with a square aspect.
+ *
+ * @param[in] zNear Distance to the near plane.
+ * @param[in] zFar  Distance to the far plane, or infinity for an infinite far plane.
+ * @param[in] depth Depth range the projection maps to.
+ */
+template <typename T>
+constexpr fgm::Matrix4D<T> perspective(const T zNear, const T zFar, const fgm::ClipDepth depth)
+{
+    const bool zeroToOne = depth == fgm::ClipDepth::ZeroToOne;
+
+    // Limits of the depth row as the far plane recedes to infinity.
+    T depthScale = T(-1);
+    T depthOffset = zeroToOne ? -zNear : T(-2) * zNear;
+    if (zFar != std::numeric_limits<T>::infinity())
+    {
+        depthScale = zeroToOne ? zFar / (zNear - zFar) : (zFar + zNear) / (zNear - zFar);
+        depthOffset = (zeroToOne ? T(1) : T(2)) * zFar * zNear / (zNear - zFar);
+    }
+
+    return fgm::Matrix4D<T>(T(1), T(0), T(0), T(0), T(0), T(1), T(0), T(0), T(0), T(0), depthScale, depthOffset, T(0),
+                            T(0), T(-1), T(0));
+}
+
+
+constexpr fgm::Frustum<double> glFrustum =
+    fgm::Frustum<double>::fromMatrix(perspective(1.0, 100.0, fgm::ClipDepth::NegativeOneToOne));
+
+
+/**
+ * @addtogroup T_FGM_Geometry
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *               PLANE                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a plane through a point measures signed distances along its normal. */
+TEST(Geometry_Plane, FromPointNormalMeasuresSignedDistance)
+{
+    // Given the plane y = 2 facing up
+    const fgm::Plane<float> plane = fgm::Plane<float>::fromPointNormal({ 5.0f, 2.0f, -3.0f }, { 0.0f, 1.0f, 0.0f });
+
+    // Then, points above are inside and points below outside
+    EXPECT_FLOAT_EQ(-2.0f, plane.offset);
+    EXPECT_FLOAT_EQ(3.0f, plane.signedDistance({ 1.0f, 5.0f, 1.0f }));
+    EXPECT_FLOAT_EQ(-2.0f, plane.signedDistance({ -4.0f, 0.0f, 8.0f }));
+}
+
+
+/** @test Verify that a plane through three points faces the side they wind counter-clockwise around. */
+TEST(Geometry_Plane, FromPointsFacesCounterClockwiseSide)
+{
+    // Given three points on z = 1, counter-clockwise seen from +z
+    const fgm::Plane<double> plane =
+        fgm::Plane<double>::fromPoints({ 0.0, 0.0, 1.0 }, { 2.0, 0.0, 1.0 }, { 0.0, 3.0, 1.0 });
+
+    // Then, the normal is the unit +z axis and the offset places the plane at z = 1
+    EXPECT_DOUBLE_EQ(0.0, plane.normal.x);
+    EXPECT_DOUBLE_EQ(0.0, plane.normal.y);
+    EXPECT_DOUBLE_EQ(1.0, plane.normal.z);
+    EXPECT_DOUBLE_EQ(-1.0, plane.offset);
+}
+
+
+/** @test Verify that normalizing scales the whole plane and leaves a plane without normal as it is. */
+TEST(Geometry_Plane, NormalizeScalesCoefficients)
+{
+    // Given a plane with a normal of length 5, and one with a zero normal
+    constexpr fgm::Plane<double> plane(fgm::Vector4D<double>(0.0, 3.0, 4.0, 10.0));
+    constexpr fgm::Plane<double> unit = plane.normalize();
+    constexpr fgm::Plane<double> degenerate = fgm::Plane<double>({ 0.0, 0.0, 0.0 }, 2.0).normalize();
+
+    // Then, every coefficient is divided by 5, at compile time as well
+    static_assert(fgm::abs(unit.normal.y - 0.6) < 1e-15 && fgm::abs(unit.normal.z - 0.8) < 1e-15);
+    static_assert(fgm::abs(unit.offset - 2.0) < 1e-15);
+    static_assert(degenerate.offset == 2.0);
+    EXPECT_DOUBLE_EQ(1.0, unit.normal.mag());
+}
+
+
+
+/**************************************
+ *                                    *
+ *          BOUNDING VOLUMES          *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a default box is empty and merging grows it to hold points and boxes. */
+TEST(Geometry_AABB, DefaultIsEmptyAndMergeGrows)
+{
+    // Given an empty box
+    constexpr fgm::AABB<float> empty;
+    static_assert(!empty.contains({ 0.0f, 0.0f, 0.0f }));
+
+    // When points and a box are merged into it
+    const fgm::AABB<float> box = empty.merge(fgm::Vector3D<float>(1.0f, -2.0f, 3.0f))
+                                     .merge(fgm::AABB<float>({ 0.0f, 0.0f, 0.0f }, { 2.0f, 1.0f, 1.0f }));
+
+    // Then, it spans both, with its center and extents in between
+    EXPECT_FLOAT_EQ(0.0f, box.min.x);
+    EXPECT_FLOAT_EQ(-2.0f, box.min.y);
+    EXPECT_FLOAT_EQ(3.0f, box.max.z);
+    EXPECT_FLOAT_EQ(1.5f, box.center().z);
+    EXPECT_FLOAT_EQ(1.5f, box.extents().y);
+    EXPECT_TRUE(box.contains({ 2.0f, 1.0f, 0.0f }));
+    EXPECT_FALSE(box.contains({ 2.0f, 1.5f, 0.0f }));
+}
+
+
+/** @test Verify box and sphere overlap tests, touching volumes included. */
+TEST(Geometry_Volumes, IntersectionsCountTouchingVolumes)
+{
+    constexpr fgm::AABB<double> box = fgm::AABB<double>::fromCenterExtents({ 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 });
+    constexpr fgm::Sphere<double> sphere({ 3.0, 0.0, 0.0 }, 2.0);
+
+    static_assert(box.intersects(fgm::AABB<double>({ 1.0, -5.0, -5.0 }, { 2.0, 5.0, 5.0 })));
+    static_assert(!box.intersects(fgm::AABB<double>({ 1.5, -5.0, -5.0 }, { 2.0, 5.0, 5.0 })));
+    static_assert(sphere.intersects(box));
+    static_assert(!fgm::Sphere<double>({ 2.0, 2.0, 0.0 }, 1.0).intersects(box)); // Nearest corner is sqrt(2) away
+    static_assert(sphere.intersects(fgm::Sphere<double>({ -1.0, 0.0, 0.0 }, 2.0)));
+    static_assert(!sphere.intersects(fgm::Sphere<double>({ -1.5, 0.0, 0.0 }, 2.0)));
+    static_assert(sphere.contains({ 1.0, 0.0, 0.0 }) && !sphere.contains({ 0.9, 0.0, 0.0 }));
+
+    // The bounding sphere of a box passes through its corners
+    const fgm::Sphere<double> bounding(box);
+    EXPECT_DOUBLE_EQ(std::sqrt(3.0), bounding.radius);
+    EXPECT_TRUE(bounding.contains({ 1.0, -1.0, 1.0 }));
+    EXPECT_TRUE(bounding.contains({ -1.0, 1.0, -1.0 }));
+}
+
+
+
+/**************************************
+ *                                    *
+ *              FRUSTUM               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the planes of an OpenGL projection are unit length and face the inside. */
+TEST(Geometry_Frustum, ExtractsUnitPlanesFromOpenGLProjection)
+{
+    // Near and far sit at z = -1 and z = -100, and the side planes at 45 degrees
+    const double diagonal = 1.0 / std::sqrt(2.0);
+    const fgm::Plane<double>& left = glFrustum.plane(fgm::FrustumPlane::Left);
+    const fgm::Plane<double>& nearPlane = glFrustum.plane(fgm::FrustumPlane::Near);
+    const fgm::Plane<double>& farPlane = glFrustum.plane(fgm::FrustumPlane::Far);
+
+    EXPECT_NEAR(diagonal, left.normal.x, 1e-12);
+    EXPECT_NEAR(-diagonal, left.normal.z, 1e-12);
+    EXPECT_NEAR(0.0, left.offset, 1e-12);
+    EXPECT_NEAR(-1.0, nearPlane.normal.z, 1e-12);
+    EXPECT_NEAR(-1.0, nearPlane.offset, 1e-12);
+    EXPECT_NEAR(1.0, farPlane.normal.z, 1e-12);
+    EXPECT_NEAR(100.0, farPlane.offset, 1e-9);
+
+    for (const fgm::Plane<double>& plane : glFrustum.planes)
+        EXPECT_NEAR(1.0, plane.normal.mag(), 1e-12);
+}
+
+
+/** @test Verify that OpenGL and zero-to-one depth projections of the same view give the same frustum. */
+TEST(Geometry_Frustum, ZeroToOneDepthMatchesOpenGLFrustum)
+{
+    const fgm::Frustum<double> zeroToOne = fgm::Frustum<double>::fromMatrix(
+        perspective(1.0, 100.0, fgm::ClipDepth::ZeroToOne), fgm::ClipDepth::ZeroToOne);
+
+    for (std::size_t p = 0; p < fgm::Frustum<double>::planeCount; ++p)
+    {
+        SCOPED_TRACE(p);
+        EXPECT_NEAR(glFrustum.planes[p].normal.x, zeroToOne.planes[p].normal.x, 1e-12);
+        EXPECT_NEAR(glFrustum.planes[p].normal.y, zeroToOne.planes[p].normal.y, 1e-12);
+        EXPECT_NEAR(glFrustum.planes[p].normal.z, zeroToOne.planes[p].normal.z, 1e-12);
+        EXPECT_NEAR(glFrustum.planes[p].offset, zeroToOne.planes[p].offset, 1e-9);
+    }
+}
+
+
+/** @test Verify point containment, evaluated at compile time. */
+TEST(Geometry_Frustum, ContainsPointsBetweenNearAndFar)
+{
+    static_assert(glFrustum.contains({ 0.0, 0.0, -10.0 }));
+    static_assert(glFrustum.contains({ 9.0, -9.0, -10.0 }));
+    static_assert(!glFrustum.contains({ 11.0, 0.0, -10.0 }));
+    static_assert(!glFrustum.contains({ 0.0, 0.0, -0.5 }));
+    static_assert(!glFrustum.contains({ 0.0, 0.0, -101.0 }));
+    static_assert(!glFrustum.contains({ 0.0, 0.0, 10.0 }));
+}
+
+
+/** @test Verify that spheres and boxes are culled only when entirely outside one plane. */
+TEST(Geometry_Frustum, CullsVolumesOutsideOnePlane)
+{
+    const fgm::Frustum<float> frustum =
+        fgm::Frustum<float>::fromMatrix(perspective(1.0f, 100.0f, fgm::ClipDepth::NegativeOneToOne));
+
+    // Straddling the right plane x = -z is kept, beyond it is culled
+    EXPECT_TRUE(frustum.intersects(fgm::Sphere<float>({ 11.0f, 0.0f, -10.0f }, 1.0f)));
+    EXPECT_FALSE(frustum.intersects(fgm::Sphere<float>({ 12.0f, 0.0f, -10.0f }, 1.0f)));
+    EXPECT_TRUE(frustum.intersects(fgm::Sphere<float>({ 0.0f, 0.0f, 0.0f }, 1.5f)));
+    EXPECT_FALSE(frustum.intersects(fgm::Sphere<float>({ 0.0f, 0.0f, 0.0f }, 0.5f)));
+
+    EXPECT_TRUE(frustum.intersects(fgm::AABB<float>({ 10.5f, -1.0f, -11.0f }, { 30.0f, 1.0f, -10.0f })));
+    EXPECT_FALSE(frustum.intersects(fgm::AABB<float>({ 11.5f, -1.0f, -11.0f }, { 30.0f, 1.0f, -10.0f })));
+    EXPECT_FALSE(frustum.intersects(fgm::AABB<float>({ -1.0f, -1.0f, -300.0f }, { 1.0f, 1.0f, -200.0f })));
+    EXPECT_TRUE(frustum.intersects(fgm::AABB<float>({ -1.0f, -1.0f, -300.0f }, { 1.0f, 1.0f, -50.0f })));
+}
+
+
+/** @test Verify that an infinite far plane keeps arbitrarily distant volumes. */
+TEST(Geometry_Frustum, InfiniteFarPlaneContainsEverythingAhead)
+{
+    const fgm::Frustum<double> frustum = fgm::Frustum<double>::fromMatrix(
+        perspective(0.1, std::numeric_limits<double>::infinity(), fgm::ClipDepth::NegativeOneToOne));
+
+    EXPECT_TRUE(frustum.contains({ 0.0, 0.0, -1e30 }));
+    EXPECT_TRUE(frustum.intersects(fgm::Sphere<double>({ 0.0, 0.0, -1e12 }, 1.0)));
+    EXPECT_FALSE(frustum.contains({ 0.0, 0.0, -0.05 }));
+}
+
+/** @} */
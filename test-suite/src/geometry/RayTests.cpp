@@ -0,0 +1,356 @@
+/**
+ * @file RayTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the intersection tests of @ref fgm::Ray and the packet tests of @ref fgm::RayPacket against them.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cmath>
+#include <geometry/Culling.h>
+#include <geometry/Ray.h>
+#include <geometry/RayPacket.h>
+#include <limits>
+#include <vector>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class RayPacketTest: public ::testing::Test
+{
+    protected:
+    /** @note Not a multiple of 64 or of any register width. */
+    static constexpr std::size_t count = 1001;
+
+    /** @brief Hits this close to an edge, a face or a tangent may differ between the fused and the scalar tests. */
+    static constexpr T tolerance = T(1e-3);
+
+    std::vector<fgm::Ray<T>> _rays;
+    fgm::RayPacket<T> _packet;
+
+    void SetUp() override
+    {
+        // Rays fanning out from a lattice in front of the origin, through the primitives below and past them.
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const fgm::Vector3D<T> origin(static_cast<T>(static_cast<int>(i % 13) - 6) * T(0.5),
+                                          static_cast<T>(static_cast<int>(i % 11) - 5) * T(0.5), T(6));
+            const fgm::Vector3D<T> direction(static_cast<T>(static_cast<int>(i % 7) - 3) * T(0.125),
+                                             static_cast<T>(static_cast<int>(i % 5) - 2) * T(0.125),
+                                             T(-1) - static_cast<T>(i % 3) * T(0.5));
+            _rays.emplace_back(origin, direction);
+        }
+        _packet = fgm::RayPacket<T>(_rays);
+    }
+
+    /**
+     * @brief Expect the packet test @p packetTest to agree with the scalar test @p rayTest for every ray, except those
+     *        whose scalar hit distance moves by more than the tolerance when the primitive is nudged.
+     */
+    template <typename PacketTest, typename RayTest>
+    void expectMatchesScalar(PacketTest&& packetTest, RayTest&& rayTest) const
+    {
+        std::vector<T> distances(count, T(20));
+        for (std::size_t i = 0; i < count; i += 4)
+            distances[i] = T(5); // Rays that accept only nearer hits
+        std::vector<T> expected(distances);
+        std::vector<std::uint64_t> hits(_packet.bitsetWords());
+        packetTest(distances, hits);
+
+        std::size_t checked = 0, hitCount = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const int ambiguity = rayTest(_rays[i], expected[i]);
+            if (ambiguity < 0)
+                continue;
+
+            ++checked;
+            const bool hit = ambiguity == 1;
+            hitCount += hit;
+            EXPECT_EQ(hit, ((hits[i / 64] >> (i % 64)) & 1u) != 0) << "ray " << i;
+            EXPECT_NEAR(expected[i], distances[i], tolerance) << "ray " << i;
+        }
+        EXPECT_GT(checked, count * 3 / 4);
+        EXPECT_GT(hitCount, 0u);
+        EXPECT_LT(hitCount, checked);
+        EXPECT_EQ(0u, hits.back() >> (count % 64)) << "bits past the last ray must be clear";
+    }
+
+    /**
+     * @brief Scalar reference: `1` for a hit, `0` for a miss and `-1` when growing or shrinking the primitive by the
+     *        tolerance changes the outcome.
+     */
+    template <typename Test>
+    static int classify(Test&& test, T& distance)
+    {
+        T smaller = distance, larger = distance;
+        const bool hit = test(T(0), distance);
+        if (test(-tolerance, smaller) != hit || test(tolerance, larger) != hit)
+            return -1;
+        return hit ? 1 : 0;
+    }
+};
+
+TYPED_TEST_SUITE(RayPacketTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Geometry
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *             SCALAR RAY             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a ray hits both faces of a triangle inside its edges, and only in range. */
+TEST(Geometry_Ray, TriangleHitsInsideEdgesOnly)
+{
+    static constexpr fgm::Vector3D<double> a(0.0, 0.0, 0.0), b(2.0, 0.0, 0.0), c(0.0, 2.0, 0.0);
+    static constexpr fgm::Ray<double> down({ 0.5, 0.5, 4.0 }, { 0.0, 0.0, -2.0 });
+    static constexpr fgm::Ray<double> up({ 0.5, 0.5, -4.0 }, { 0.0, 0.0, 1.0 });
+
+    // Distances count in units of the direction, and a hit overwrites the farthest accepted distance
+    static_assert(
+        []
+        {
+            double distance = 10.0;
+            return down.intersects(a, b, c, distance) && distance == 2.0 && down.at(distance).z == 0.0;
+        }());
+    static_assert(
+        []
+        {
+            double distance = 10.0;
+            return up.intersects(a, b, c, distance) && distance == 4.0;
+        }());
+
+    // Rays past the hypotenuse, too short, pointing away or lying in the plane miss and leave the distance alone
+    double distance = 10.0;
+    EXPECT_FALSE(fgm::Ray<double>({ 1.5, 1.5, 4.0 }, { 0.0, 0.0, -1.0 }).intersects(a, b, c, distance));
+    EXPECT_FALSE(fgm::Ray<double>({ 0.5, 0.5, 4.0 }, { 0.0, 0.0, 1.0 }).intersects(a, b, c, distance));
+    EXPECT_FALSE(fgm::Ray<double>({ -1.0, 0.5, 0.0 }, { 1.0, 0.0, 0.0 }).intersects(a, b, c, distance));
+    EXPECT_EQ(10.0, distance);
+    distance = 3.5;
+    EXPECT_FALSE(up.intersects(a, b, c, distance));
+    EXPECT_EQ(3.5, distance);
+}
+
+
+/** @test Verify that a ray enters boxes at the latest slab, hits from inside at zero and passes beside them. */
+TEST(Geometry_Ray, BoxHitsAtEntryDistance)
+{
+    static constexpr fgm::AABB<double> box({ -1.0, -1.0, -1.0 }, { 1.0, 1.0, 1.0 });
+
+    static_assert(
+        []
+        {
+            double distance = 100.0;
+            return fgm::Ray<double>({ -5.0, 0.5, 0.0 }, { 1.0, 0.0, 0.0 }).intersects(box, distance) &&
+                   distance == 4.0;
+        }());
+    static_assert(
+        []
+        {
+            // Diagonal rays enter where the last slab is crossed
+            double distance = 100.0;
+            return fgm::Ray<double>({ -3.0, -5.0, 0.0 }, { 1.0, 1.0, 0.0 }).intersects(box, distance) &&
+                   distance == 4.0;
+        }());
+
+    double distance = 100.0;
+    EXPECT_TRUE(fgm::Ray<double>({ 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }).intersects(box, distance));
+    EXPECT_EQ(0.0, distance);
+
+    distance = 100.0;
+    EXPECT_FALSE(fgm::Ray<double>({ -5.0, 2.0, 0.0 }, { 1.0, 0.0, 0.0 }).intersects(box, distance));
+    EXPECT_FALSE(fgm::Ray<double>({ -5.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 }).intersects(box, distance));
+    EXPECT_FALSE(fgm::Ray<double>({ -5.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }).intersects(box, (distance = 3.0)));
+    EXPECT_EQ(3.0, distance);
+
+    // A ray with NaN components errs towards hitting
+    distance = 100.0;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(fgm::Ray<double>({ nan, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }).intersects(box, distance));
+    EXPECT_EQ(0.0, distance);
+}
+
+
+/** @test Verify that a ray hits the near side of a sphere, the far side from inside, and misses beside it. */
+TEST(Geometry_Ray, SphereHitsNearestSurface)
+{
+    static constexpr fgm::Sphere<double> sphere({ 0.0, 0.0, -10.0 }, 2.0);
+
+    static_assert(
+        []
+        {
+            double distance = 100.0;
+            return fgm::Ray<double>({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, -1.0 }).intersects(sphere, distance) &&
+                   distance == 8.0;
+        }());
+    static_assert(
+        []
+        {
+            double distance = 100.0;
+            return fgm::Ray<double>({ 0.0, 0.0, -10.0 }, { 0.0, 0.5, 0.0 }).intersects(sphere, distance) &&
+                   distance == 4.0;
+        }());
+
+    double distance = 100.0;
+    EXPECT_FALSE(fgm::Ray<double>({ 0.0, 2.5, 0.0 }, { 0.0, 0.0, -1.0 }).intersects(sphere, distance));
+    EXPECT_FALSE(fgm::Ray<double>({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }).intersects(sphere, distance));
+    EXPECT_EQ(100.0, distance);
+
+    // A tangent ray grazes the sphere
+    EXPECT_TRUE(fgm::Ray<double>({ 0.0, 2.0, 0.0 }, { 0.0, 0.0, -1.0 }).intersects(sphere, distance));
+    EXPECT_DOUBLE_EQ(10.0, distance);
+}
+
+/** @} */
+
+
+
+/**
+ * @addtogroup T_FGM_Ray_Packets
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *            RAY PACKETS             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a packet keeps its rays in order. */
+TYPED_TEST(RayPacketTest, StoresRaysInOrder)
+{
+    ASSERT_EQ(this->count, this->_packet.size());
+    EXPECT_EQ((this->count + 63) / 64, this->_packet.bitsetWords());
+    for (const std::size_t i : { std::size_t(0), std::size_t(17), this->count - 1 })
+    {
+        const fgm::Ray<TypeParam> ray = this->_packet[i];
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ(this->_rays[i].origin[c], ray.origin[c]) << "ray " << i;
+            EXPECT_EQ(this->_rays[i].direction[c], ray.direction[c]) << "ray " << i;
+        }
+    }
+}
+
+
+/** @test Verify that packet triangle tests agree with the scalar ray. */
+TYPED_TEST(RayPacketTest, Triangle_MatchesScalarRay)
+{
+    using T = TypeParam;
+    const fgm::Vector3D<T> a(T(-2), T(-1), T(0)), b(T(2), T(-1.5), T(-0.5)), c(T(0), T(2.5), T(0.5));
+
+    this->expectMatchesScalar([&](std::span<T> distances, std::span<std::uint64_t> hits)
+                              { this->_packet.intersect(a, b, c, distances, hits); },
+                              [&](const fgm::Ray<T>& ray, T& distance)
+                              {
+                                  // Nudging the vertices away from the centroid grows the triangle
+                                  const fgm::Vector3D<T> centroid = (a + b + c) / T(3);
+                                  return TestFixture::classify(
+                                      [&](const T grow, T& d)
+                                      {
+                                          return ray.intersects(a + (a - centroid) * grow, b + (b - centroid) * grow,
+                                                                c + (c - centroid) * grow, d);
+                                      },
+                                      distance);
+                              });
+}
+
+
+/** @test Verify that packet box tests agree with the scalar ray. */
+TYPED_TEST(RayPacketTest, Box_MatchesScalarRay)
+{
+    using T = TypeParam;
+    const fgm::AABB<T> box({ T(-1.75), T(-1.25), T(-1.5) }, { T(1.25), T(0.75), T(1.5) });
+
+    this->expectMatchesScalar([&](std::span<T> distances, std::span<std::uint64_t> hits)
+                              { this->_packet.intersect(box, distances, hits); },
+                              [&](const fgm::Ray<T>& ray, T& distance)
+                              {
+                                  const fgm::Vector3D<T> one(T(1), T(1), T(1));
+                                  return TestFixture::classify(
+                                      [&](const T grow, T& d)
+                                      {
+                                          const fgm::AABB<T> grown(box.min - one * grow, box.max + one * grow);
+                                          return ray.intersects(grown, d);
+                                      },
+                                      distance);
+                              });
+}
+
+
+/** @test Verify that packet sphere tests agree with the scalar ray. */
+TYPED_TEST(RayPacketTest, Sphere_MatchesScalarRay)
+{
+    using T = TypeParam;
+    const fgm::Sphere<T> sphere({ T(0.5), T(-0.25), T(0) }, T(2));
+
+    this->expectMatchesScalar([&](std::span<T> distances, std::span<std::uint64_t> hits)
+                              { this->_packet.intersect(sphere, distances, hits); },
+                              [&](const fgm::Ray<T>& ray, T& distance)
+                              {
+                                  return TestFixture::classify(
+                                      [&](const T grow, T& d)
+                                      {
+                                          const fgm::Sphere<T> grown(sphere.center, sphere.radius + grow);
+                                          return ray.intersects(grown, d);
+                                      },
+                                      distance);
+                              });
+}
+
+
+/** @test Verify that tracing a packet through several triangles leaves the closest hit of every ray. */
+TYPED_TEST(RayPacketTest, ClosestHitAcrossTriangles)
+{
+    using T = TypeParam;
+    std::vector<fgm::Vector3D<T>> vertices;
+    for (int layer = 0; layer < 3; ++layer) // Stacked triangles, the first the farthest from the rays
+    {
+        const T z = static_cast<T>(layer) - T(2);
+        vertices.insert(vertices.end(), { { T(-9), T(-9), z }, { T(9), T(-9), z }, { T(0), T(9), z } });
+    }
+
+    std::vector<T> distances(this->count, std::numeric_limits<T>::infinity());
+    std::vector<std::size_t> nearest(this->count, 99);
+    std::vector<std::uint64_t> hits(this->_packet.bitsetWords());
+    for (std::size_t t = 0; t < vertices.size(); t += 3)
+    {
+        this->_packet.intersect(vertices[t], vertices[t + 1], vertices[t + 2], distances, hits);
+        for (const std::size_t i : fgm::visibleIndices(hits))
+            nearest[i] = t / 3;
+    }
+
+    for (std::size_t i = 0; i < this->count; ++i)
+    {
+        T expected = std::numeric_limits<T>::infinity();
+        std::size_t expectedTriangle = 99;
+        for (std::size_t t = 0; t < vertices.size(); t += 3)
+            if (this->_rays[i].intersects(vertices[t], vertices[t + 1], vertices[t + 2], expected))
+                expectedTriangle = t / 3;
+
+        EXPECT_EQ(expectedTriangle, nearest[i]) << "ray " << i;
+        if (expectedTriangle == 99)
+            EXPECT_EQ(expected, distances[i]) << "ray " << i;
+        else
+            EXPECT_NEAR(expected, distances[i], T(1e-4)) << "ray " << i;
+    }
+}
+
+/** @} */
@@ -0,0 +1,305 @@
+/**
+ * @file Affine3DTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::Affine3D against the equivalent @ref fgm::Matrix4D: composition, point and direction
+ *        transforms, both inverses and the batch transforms.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cmath>
+#include <matrix/Affine3DBatch.h>
+#include <vector>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class Affine3DTest: public ::testing::Test
+{
+    protected:
+    /** @note 35 vectors leave a tail after every register width. */
+    static constexpr std::size_t count = 35;
+
+    fgm::Affine3D<T> _rigid;
+    fgm::Affine3D<T> _general;
+    std::vector<fgm::Vector4D<T>> _vectors;
+
+    void SetUp() override
+    {
+        const T invSqrt3 = T(1) / std::sqrt(T(3));
+        const auto rotation = fgm::Quaternion<T>::fromAxisAngle(fgm::Vector3D<T>(invSqrt3, invSqrt3, invSqrt3), T(1.1));
+
+        _rigid = fgm::Affine3D<T>::fromTRS(fgm::Vector3D<T>(T(4), T(-3), T(2)), rotation);
+        _general = fgm::Affine3D<T>(fgm::Vector3D<T>(T(2), T(0.5), T(-1)), fgm::Vector3D<T>(T(-0.5), T(3), T(0.75)),
+                                    fgm::Vector3D<T>(T(1), T(-2), T(1.5)), fgm::Vector3D<T>(T(-1), T(5), T(0.25)));
+
+        // Alternate points and directions so the translation is both applied and skipped.
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T t = static_cast<T>(i);
+            _vectors.emplace_back(t * T(0.5) - T(3), T(2) - t * T(0.25), t * T(0.125) + T(1), T(i % 2));
+        }
+    }
+
+    /** @brief Expect every element of @p actual to match @p expected within a relative tolerance. */
+    static void expectNear(const fgm::Matrix4D<T>& expected, const fgm::Matrix4D<T>& actual)
+    {
+        const T tolerance = fgm::Config::EPSILON<T>;
+        for (std::size_t col = 0; col < 4; ++col)
+            for (std::size_t row = 0; row < 4; ++row)
+                EXPECT_NEAR(expected(row, col), actual(row, col), tolerance * (std::abs(expected(row, col)) + T(1)))
+                    << "element (" << row << ", " << col << ")";
+    }
+
+    /** @brief Expect @p actual to hold `affine * vectors[i]` for every vector. */
+    void expectTransformed(const fgm::Affine3D<T>& affine, const std::vector<fgm::Vector4D<T>>& actual) const
+    {
+        const fgm::Matrix4D<T> matrix = affine.toMatrix4D();
+        const T tolerance = fgm::Config::EPSILON<T>;
+
+        ASSERT_EQ(count, actual.size());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SCOPED_TRACE(i);
+            const fgm::Vector4D<T> expected = matrix * _vectors[i];
+            for (std::size_t c = 0; c < 4; ++c)
+                EXPECT_NEAR(expected[c], actual[i][c], tolerance * (std::abs(expected[c]) + T(1)));
+        }
+    }
+
+    /** @brief Unpack @p array for @ref expectTransformed. */
+    [[nodiscard]] static std::vector<fgm::Vector4D<T>> unpack(const fgm::Vec4Array<T>& array)
+    {
+        std::vector<fgm::Vector4D<T>> vectors;
+        for (std::size_t i = 0; i < array.size(); ++i)
+            vectors.push_back(array[i]);
+        return vectors;
+    }
+};
+/** @brief Test fixture for @ref fgm::Affine3D, parameterized by `float` and `double`. */
+TYPED_TEST_SUITE(Affine3DTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Affine3
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *      STORAGE AND CONVERSIONS       *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the transformation is stored as 12 column-major elements with an identity default. */
+TYPED_TEST(Affine3DTest, Storage_IsTwelveElementsWithIdentityDefault)
+{
+    using T = TypeParam;
+    static_assert(sizeof(fgm::Affine3D<T>) == 12 * sizeof(T));
+
+    const fgm::Affine3D<T> identity;
+    for (std::size_t col = 0; col < 4; ++col)
+        for (std::size_t row = 0; row < 3; ++row)
+            EXPECT_EQ(row == col ? T(1) : T(0), identity(row, col));
+
+    EXPECT_EQ(T(-2), this->_general.elements[2][1]);
+    EXPECT_EQ(T(5), this->_general.translation().y);
+}
+
+
+/** @test Verify that converting to a @ref fgm::Matrix4D and back keeps every element and adds a `(0, 0, 0, 1)` row. */
+TYPED_TEST(Affine3DTest, Matrix4DConversion_RoundTrips)
+{
+    using T = TypeParam;
+    const fgm::Matrix4D<T> matrix = static_cast<fgm::Matrix4D<T>>(this->_general);
+
+    for (std::size_t col = 0; col < 4; ++col)
+    {
+        for (std::size_t row = 0; row < 3; ++row)
+            EXPECT_EQ(this->_general(row, col), matrix(row, col));
+        EXPECT_EQ(col == 3 ? T(1) : T(0), matrix(3, col));
+    }
+
+    const fgm::Affine3D<T> back(matrix);
+    this->expectNear(matrix, back.toMatrix4D());
+}
+
+
+/** @test Verify that building from a linear block and a translation keeps both. */
+TYPED_TEST(Affine3DTest, LinearAndTranslation_RoundTrip)
+{
+    const fgm::Affine3D<TypeParam> rebuilt(this->_general.linear(), this->_general.translation());
+    this->expectNear(this->_general.toMatrix4D(), rebuilt.toMatrix4D());
+}
+
+
+/** @test Verify that translation, rotation and scale compose in that order. */
+TYPED_TEST(Affine3DTest, FromTRS_MatchesMatrixProduct)
+{
+    using T = TypeParam;
+    const auto rotation = fgm::Quaternion<T>::fromAxisAngle(fgm::Vector3D<T>(T(0), T(0.6), T(0.8)), T(0.7));
+    const fgm::Vector3D<T> translation(T(1), T(2), T(3));
+    const fgm::Vector3D<T> scale(T(2), T(0.5), T(3));
+
+    const fgm::Matrix4D<T> expected = fgm::Matrix4D<T>(T(1), T(0), T(0), T(1), //
+                                                       T(0), T(1), T(0), T(2), //
+                                                       T(0), T(0), T(1), T(3), //
+                                                       T(0), T(0), T(0), T(1)) *
+                                      rotation.toMatrix4D() *
+                                      fgm::Matrix4D<T>(T(2), T(0), T(0), T(0), //
+                                                       T(0), T(0.5), T(0), T(0), //
+                                                       T(0), T(0), T(3), T(0), //
+                                                       T(0), T(0), T(0), T(1));
+
+    this->expectNear(expected, fgm::Affine3D<T>::fromTRS(translation, rotation, scale).toMatrix4D());
+}
+
+
+
+/**************************************
+ *                                    *
+ *   COMPOSITION AND TRANSFORMATION   *
+ *                                    *
+ **************************************/
+
+/** @test Verify that composing two transformations matches the product of their matrices. */
+TYPED_TEST(Affine3DTest, Compose_MatchesMatrix4DProduct)
+{
+    using T = TypeParam;
+    this->expectNear(this->_general.toMatrix4D() * this->_rigid.toMatrix4D(),
+                     (this->_general * this->_rigid).toMatrix4D());
+
+    fgm::Affine3D<T> composed = this->_rigid;
+    composed *= this->_general;
+    this->expectNear(this->_rigid.toMatrix4D() * this->_general.toMatrix4D(), composed.toMatrix4D());
+}
+
+
+/** @test Verify that points pick up the translation, directions do not, and homogeneous vectors keep `w`. */
+TYPED_TEST(Affine3DTest, PointAndDirection_MatchMatrix4D)
+{
+    using T = TypeParam;
+    const fgm::Matrix4D<T> matrix = this->_general.toMatrix4D();
+    const fgm::Vector3D<T> v(T(1.5), T(-2), T(0.5));
+
+    const fgm::Vector4D<T> point = matrix * fgm::Vector4D<T>(v, T(1));
+    const fgm::Vector4D<T> direction = matrix * fgm::Vector4D<T>(v, T(0));
+    const fgm::Vector4D<T> homogeneous = matrix * fgm::Vector4D<T>(v, T(2));
+    const fgm::Vector3D<T> transformedPoint = this->_general.transformPoint(v);
+    const fgm::Vector3D<T> transformedDirection = this->_general.transformDirection(v);
+    const fgm::Vector4D<T> transformedHomogeneous = this->_general * fgm::Vector4D<T>(v, T(2));
+
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+        EXPECT_NEAR(point[c], transformedPoint[c], fgm::Config::EPSILON<T>);
+        EXPECT_NEAR(direction[c], transformedDirection[c], fgm::Config::EPSILON<T>);
+        EXPECT_NEAR(homogeneous[c], transformedHomogeneous[c], fgm::Config::EPSILON<T>);
+    }
+    EXPECT_EQ(T(2), transformedHomogeneous.w);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             INVERSION              *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the general inverse matches the @ref fgm::Matrix4D inverse and undoes the transformation. */
+TYPED_TEST(Affine3DTest, Inverse_MatchesMatrix4DInverse)
+{
+    using T = TypeParam;
+    fgm::Affine3D<T> inverse;
+    ASSERT_EQ(OperationStatus::SUCCESS, this->_general.tryInverse(inverse));
+
+    this->expectNear(this->_general.toMatrix4D().inverse(), inverse.toMatrix4D());
+    this->expectNear(fgm::Matrix4D<T>(), (inverse * this->_general).toMatrix4D());
+    EXPECT_NEAR(this->_general.toMatrix4D().determinant(), this->_general.determinant(),
+                fgm::Config::EPSILON<T> * T(16));
+}
+
+
+/** @test Verify that the rigid inverse transposes the rotation and matches the general inverse. */
+TYPED_TEST(Affine3DTest, InverseRigid_MatchesGeneralInverse)
+{
+    using T = TypeParam;
+    const fgm::Affine3D<T> rigidInverse = this->_rigid.inverseRigid();
+
+    this->expectNear(this->_rigid.inverse().toMatrix4D(), rigidInverse.toMatrix4D());
+    this->expectNear(fgm::Matrix4D<T>(), (this->_rigid * rigidInverse).toMatrix4D());
+}
+
+
+/** @test Verify that singular and NaN transformations report why and fall back to the identity. */
+TYPED_TEST(Affine3DTest, TryInverse_ReportsFailures)
+{
+    using T = TypeParam;
+    const fgm::Affine3D<T> untouched = this->_general;
+    fgm::Affine3D<T> out = untouched;
+
+    const fgm::Affine3D<T> flat(fgm::Vector3D<T>(T(1), T(0), T(0)), fgm::Vector3D<T>(T(0), T(1), T(0)),
+                                fgm::Vector3D<T>(T(1), T(1), T(0)), fgm::Vector3D<T>(T(1), T(2), T(3)));
+    EXPECT_EQ(OperationStatus::DIVISIONBYZERO, flat.tryInverse(out));
+    this->expectNear(fgm::Matrix4D<T>(), flat.inverse().toMatrix4D());
+
+    fgm::Affine3D<T> nan = this->_general;
+    nan(1, 1) = std::numeric_limits<T>::quiet_NaN();
+    EXPECT_EQ(OperationStatus::NANOPERAND, nan.tryInverse(out));
+
+    this->expectNear(untouched.toMatrix4D(), out.toMatrix4D());
+}
+
+
+
+/**************************************
+ *                                    *
+ *          BATCH TRANSFORMS          *
+ *                                    *
+ **************************************/
+
+/** @test Verify that transforming packed vectors matches per-vector products, out of and in place. */
+TYPED_TEST(Affine3DTest, TransformPacked_MatchesMatrix4D)
+{
+    std::vector<fgm::Vector4D<TypeParam>> out(this->count);
+    fgm::transform(this->_general, this->_vectors, out);
+    this->expectTransformed(this->_general, out);
+
+    std::vector<fgm::Vector4D<TypeParam>> inPlace = this->_vectors;
+    fgm::transform(this->_rigid, inPlace);
+    this->expectTransformed(this->_rigid, inPlace);
+}
+
+
+/** @test Verify that transforming a @ref fgm::Vec4Array matches per-vector products under every store mode. */
+TYPED_TEST(Affine3DTest, TransformVec4Array_MatchesMatrix4D)
+{
+    const fgm::Vec4Array<TypeParam> src(this->_vectors);
+
+    for (const fgm::StoreMode mode : {fgm::StoreMode::Auto, fgm::StoreMode::Cached, fgm::StoreMode::Streaming})
+    {
+        fgm::Vec4Array<TypeParam> out;
+        fgm::transform(this->_general, src, out, mode);
+        this->expectTransformed(this->_general, this->unpack(out));
+
+        fgm::Vec4Array<TypeParam> inPlace = src;
+        fgm::transform(this->_rigid, inPlace, mode);
+        this->expectTransformed(this->_rigid, this->unpack(inPlace));
+    }
+}
+
+/** @} */
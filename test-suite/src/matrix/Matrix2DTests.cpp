@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include <matrix/Matrix2D.h>
 #include <vector/Vector2D.h>
+#include <vector>
 
 using namespace testutils::Matrix2D;
 
@@ -804,3 +805,74 @@ TEST(Matrix2D_Inverse, InversionOfRotationOnlyMatrixReturnsTranspose)
     // Assert
     EXPECT_MAT_EQ(transpose, actualInverse);
 }
+
+
+/******************************
+ *                            *
+ *  REGISTER AND BATCH TESTS  *
+ *                            *
+ ******************************/
+
+TEST(Matrix2D_Simd, FloatAndDoubleMatricesAreAlignedToOneRegister)
+{
+    static_assert(sizeof(fgm::Matrix2D<float>) == 16 && alignof(fgm::Matrix2D<float>) == 16);
+    static_assert(sizeof(fgm::Matrix2D<double>) == 32 && alignof(fgm::Matrix2D<double>) == 32);
+}
+
+TEST(Matrix2D_Simd, DoubleOperationsMatchElementWiseResults)
+{
+    // Arrange
+    const fgm::Matrix2D<double> a(2.0, -1.5, 0.25, 3.0);
+    const fgm::Matrix2D<double> b(-1.0, 4.0, 2.5, 0.5);
+    const fgm::Matrix2D<double> expectedProduct(2.0 * -1.0 + -1.5 * 2.5, 2.0 * 4.0 + -1.5 * 0.5,
+                                                0.25 * -1.0 + 3.0 * 2.5, 0.25 * 4.0 + 3.0 * 0.5);
+    const double det = 2.0 * 3.0 - -1.5 * 0.25;
+    const fgm::Matrix2D<double> expectedInverse(3.0 / det, 1.5 / det, -0.25 / det, 2.0 / det);
+
+    // Act
+    const fgm::Matrix2D<double> product = a * b;
+    const fgm::Matrix2D<double> sum = a + b;
+    const fgm::Matrix2D<double> inverse = a.inverse();
+    const fgm::Vector2D<double> transformed = a * fgm::Vector2D<double>(2.0, -4.0);
+
+    // Assert
+    EXPECT_MAT_EQ(expectedProduct, product);
+    EXPECT_MAT_EQ(fgm::Matrix2D<double>(1.0, 2.5, 2.75, 3.5), sum);
+    EXPECT_MAT_EQ(fgm::Matrix2D<double>(2.0, 0.25, -1.5, 3.0), a.transpose());
+    EXPECT_DOUBLE_EQ(det, a.determinant());
+    EXPECT_MAT_EQ(expectedInverse, inverse);
+    EXPECT_DOUBLE_EQ(2.0 * 2.0 + -1.5 * -4.0, transformed.x);
+    EXPECT_DOUBLE_EQ(0.25 * 2.0 + 3.0 * -4.0, transformed.y);
+}
+
+template <typename T>
+static void expectBatchTransformMatchesMatrixVectorProduct()
+{
+    // Arrange: an odd count leaves one vector for the scalar tail.
+    const fgm::Matrix2D<T> mat(T(2), T(-1), T(0.5), T(3));
+    std::vector<fgm::Vector2D<T>> vectors;
+    for (int i = 0; i < 7; ++i)
+        vectors.emplace_back(T(i) - T(3), T(0.5) * T(i));
+    std::vector<fgm::Vector2D<T>> out(vectors.size());
+    std::vector<fgm::Vector2D<T>> inPlace = vectors;
+
+    // Act
+    fgm::transform(mat, vectors, out);
+    fgm::transform(mat, inPlace);
+
+    // Assert
+    for (std::size_t i = 0; i < vectors.size(); ++i)
+    {
+        const fgm::Vector2D<T> expected = mat * vectors[i];
+        EXPECT_EQ(expected.x, out[i].x) << "vector " << i;
+        EXPECT_EQ(expected.y, out[i].y) << "vector " << i;
+        EXPECT_EQ(expected.x, inPlace[i].x) << "vector " << i;
+        EXPECT_EQ(expected.y, inPlace[i].y) << "vector " << i;
+    }
+}
+
+TEST(Matrix2D_Simd, BatchTransformMatchesMatrixVectorProduct)
+{
+    expectBatchTransformMatchesMatrixVectorProduct<float>();
+    expectBatchTransformMatchesMatrixVectorProduct<double>();
+}
@@ -0,0 +1,166 @@
+/**
+ * @file Matrix4DBatchTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies that batch @ref fgm::Matrix4D transforms match `matrix * vector` element by element.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <matrix/Matrix4DBatch.h>
+#include <span>
+#include <vector>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class Matrix4DBatch: public ::testing::Test
+{
+    protected:
+    /** @note 35 vectors leave a tail after every 1, 2 and 4 vector block. */
+    static constexpr std::size_t count = 35;
+
+    fgm::Matrix4D<T> _matrix;
+    std::vector<fgm::Vector4D<T>> _vectors;
+
+    void SetUp() override
+    {
+        // A perspective-like matrix so `w` varies across the batch.
+        _matrix = fgm::Matrix4D<T>(fgm::Vector4D<T>(T(2), T(0.5), T(-1), T(0.25)),
+                                   fgm::Vector4D<T>(T(-0.5), T(3), T(0.75), T(0.125)),
+                                   fgm::Vector4D<T>(T(1), T(-2), T(1.5), T(0.5)),
+                                   fgm::Vector4D<T>(T(4), T(-3), T(2), T(1)));
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T t = static_cast<T>(i);
+            _vectors.emplace_back(t * T(0.5) - T(3), T(2) - t * T(0.25), t * T(0.125) + T(1), T(1));
+        }
+    }
+
+    /** @brief Expect @p actual to match `matrix * vectors[i]`, divided by `w` when @p projective. */
+    void expectTransformed(const std::span<const fgm::Vector4D<T>> actual, const bool projective) const
+    {
+        const T tolerance = fgm::Config::EPSILON<T>;
+
+        ASSERT_EQ(count, actual.size());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SCOPED_TRACE(i);
+            fgm::Vector4D<T> expected = _matrix * _vectors[i];
+            if (projective)
+                expected = fgm::Vector4D<T>(expected.x / expected.w, expected.y / expected.w,
+                                            expected.z / expected.w, T(1));
+
+            EXPECT_NEAR(expected.x, actual[i].x, tolerance * (std::abs(expected.x) + T(1)));
+            EXPECT_NEAR(expected.y, actual[i].y, tolerance * (std::abs(expected.y) + T(1)));
+            EXPECT_NEAR(expected.z, actual[i].z, tolerance * (std::abs(expected.z) + T(1)));
+            EXPECT_NEAR(expected.w, actual[i].w, tolerance * (std::abs(expected.w) + T(1)));
+        }
+    }
+
+    /** @brief Unpack @p array for @ref expectTransformed. */
+    [[nodiscard]] static std::vector<fgm::Vector4D<T>> unpack(const fgm::Vec4Array<T>& array)
+    {
+        std::vector<fgm::Vector4D<T>> vectors;
+        for (std::size_t i = 0; i < array.size(); ++i)
+            vectors.push_back(array[i]);
+        return vectors;
+    }
+};
+/** @brief Test fixture for @ref fgm::transform batches, parameterized by `float` and `double`. */
+TYPED_TEST_SUITE(Matrix4DBatch, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Mat4_Batch
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *          PACKED VECTORS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that transforming packed vectors matches per-vector products, out of and in place. */
+TYPED_TEST(Matrix4DBatch, Transform_MatchesMatrixVectorProduct)
+{
+    std::vector<fgm::Vector4D<TypeParam>> out(this->count);
+    fgm::transform(this->_matrix, this->_vectors, out);
+    this->expectTransformed(out, false);
+
+    std::vector<fgm::Vector4D<TypeParam>> inPlace = this->_vectors;
+    fgm::transform(this->_matrix, inPlace);
+    this->expectTransformed(inPlace, false);
+}
+
+
+/** @test Verify that projective transforms divide by `w` and leave `w` at one. */
+TYPED_TEST(Matrix4DBatch, TransformProjective_DividesByW)
+{
+    std::vector<fgm::Vector4D<TypeParam>> out(this->count);
+    fgm::transformProjective(this->_matrix, this->_vectors, out);
+    this->expectTransformed(out, true);
+
+    std::vector<fgm::Vector4D<TypeParam>> inPlace = this->_vectors;
+    fgm::transformProjective(this->_matrix, inPlace);
+    this->expectTransformed(inPlace, true);
+}
+
+
+/** @test Verify that streaming stores write every vector, even into a destination not aligned to a register. */
+TYPED_TEST(Matrix4DBatch, StreamingStores_WriteEveryVector)
+{
+    // One extra vector so the output can start one vector past the allocation's alignment.
+    std::vector<fgm::Vector4D<TypeParam>> buffer(this->count + 1);
+    const std::span<fgm::Vector4D<TypeParam>> out(buffer.data() + 1, this->count);
+
+    fgm::transform(this->_matrix, this->_vectors, out, fgm::StoreMode::Streaming);
+    this->expectTransformed(out, false);
+
+    fgm::transformProjective(this->_matrix, this->_vectors, out, fgm::StoreMode::Streaming);
+    this->expectTransformed(out, true);
+}
+
+
+
+/**************************************
+ *                                    *
+ *     STRUCTURE-OF-ARRAYS VECTORS    *
+ *                                    *
+ **************************************/
+
+/** @test Verify that transforming a @ref fgm::Vec4Array matches per-vector products under every store mode. */
+TYPED_TEST(Matrix4DBatch, TransformVec4Array_MatchesMatrixVectorProduct)
+{
+    const fgm::Vec4Array<TypeParam> src(this->_vectors);
+
+    for (const fgm::StoreMode mode : {fgm::StoreMode::Auto, fgm::StoreMode::Cached, fgm::StoreMode::Streaming})
+    {
+        fgm::Vec4Array<TypeParam> out;
+        fgm::transform(this->_matrix, src, out, mode);
+        this->expectTransformed(this->unpack(out), false);
+
+        fgm::transformProjective(this->_matrix, src, out, mode);
+        this->expectTransformed(this->unpack(out), true);
+
+        fgm::Vec4Array<TypeParam> inPlace = src;
+        fgm::transform(this->_matrix, inPlace, mode);
+        this->expectTransformed(this->unpack(inPlace), false);
+    }
+}
+
+/** @} */
@@ -3,6 +3,7 @@
 #include "utils/VectorUtils.h"
 
 #include <cstddef>
+#include <limits>
 #include <gtest/gtest.h>
 #include <matrix/Matrix4D.h>
 #include <vector/Vector3D.h>
@@ -290,1138 +291,585 @@ TEST(Matrix4D_Addition, PlusEqualsMatrixWithAnotherMatrixOfDifferentTypeReturnsS
     EXPECT_MAT_EQ(expected, a);
 }
 
-// TEST(Matrix4D_Difference, DifferenceOfTwoMatricesReturnsAnotherMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		3.0f, 2.0f, 255.0f,
-//		-8.0f, 24.0f, 6.0f,
-//		2.0f, 16.0f, -98.0f };
-//	const fgm::Matrix4D c = {
-//		-2.0f, 0.0f, -252.0f,
-//		12.0f, -19.0f, 0.0f,
-//		5.0f, -24.0f, 107.0f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> res = a - b;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(c, res);
-// }
-
-// TEST(Matrix4D_Difference, DifferenceOfTwoMatricesOfDifferentTypeReturnsAnotherMatrixPromotedType)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		3.0, 2.0, 255.0,
-//		-8.0, 24.0, 6.0,
-//		2.0, 16.0, -98.0 };
-//	const fgm::Matrix4D c = {
-//		-2.0, 0.0, -252.0,
-//		12.0, -19.0, 0.0,
-//		5.0, -24.0, 107.0 };
-//
-//	// Act
-//	const auto res = a - b;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(res)::value_type, double>, "Assertion Failed (Matrix4D): Float -
-// Double = Double"); 	EXPECT_MAT_EQ(c, res);
-// }
-//
-// TEST(Matrix4D_Addition, PlusEqualsMatrixWithMatrixOfAnotherTypeReturnsSameMatrixWithoutTypePromotion)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		3.0, 2.0, 255.0,
-//		-8.0, 24.0, 6.0,
-//		7.0, 16.0, -98.0 };
-//	const fgm::Matrix4D c = {
-//		4.0f, 4.0f, 258.0f,
-//		-4.0f, 29.0f, 12.0f,
-//		14.0f, 8.0f, -89.0f };
-//
-//	// Act
-//	a += b;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(a)::value_type, float>, "Assertion Failed (Matrix4D): Float += Double
-//= Float"); 	EXPECT_MAT_EQ(c, a);
-// }
-//
-// TEST(Matrix4D_Difference, MinusEqualsMatrixWithAnotherMatrixOfDifferentTypeReturnsSameMatrixWithoutTypePromotion)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		3.0, 2.0, 255.0,
-//		-8.0, 24.0, 6.0,
-//		2.0, 16.0, -98.0 };
-//	const fgm::Matrix4D c = {
-//		-2.0f, 0.0f, -252.0f,
-//		12.0f, -19.0f, 0.0f,
-//		5.0f, -24.0f, 107.0f };
-//
-//	// Act
-//	a -= b;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(a)::value_type, float>, "Assertion Failed (Matrix4D): Float -= Double
-//= Float"); 	EXPECT_MAT_EQ(c, a);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesAIntegerScalarReturnsCorrectMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		2.0f, 4.0f, 6.0f,
-//		8.0f, 10.0f, 12.0f,
-//		14.0f, -16.0f, 18.0f };
-//	constexpr int scalar = 2;
-//
-//	// Act
-//	const fgm::Matrix4D actual = a * scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, IntegerScalarTimesAMatrixReturnsCorrectMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		2.0f, 4.0f, 6.0f,
-//		8.0f, 10.0f, 12.0f,
-//		14.0f, -16.0f, 18.0f };
-//	constexpr int scalar = 2;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = scalar * a;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesEqualIntegerScalarIsTheSameMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		2.0f, 4.0f, 6.0f,
-//		8.0f, 10.0f, 12.0f,
-//		14.0f, -16.0f, 18.0f };
-//	constexpr int scalar = 2;
-//
-//	// Act
-//	a *= scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(a, b);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesOneReturnANewMatrixWithOriginalMatrixValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a * 1;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(a, b);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesZeroScalarReturnsZeroMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a * 0;
-//
-//	// Assert
-//	EXPECT_MAT_ZERO(b);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesAFloatScalarReturnsCorrectMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	constexpr float scalar = 2.5f;
-//
-//	const fgm::Matrix4D expected = {
-//		2.5f, 5.0f, 7.5f,
-//		10.0f, 12.5f, 15.0f,
-//		17.5f, -20.0f, 22.5f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a * scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, b);
-// }
-//
-// TEST(Matrix4D_Product, IntegerMatrixTimesEqualAFloatScalarReturnsCorrectMatrixWithMinimalPrecisionLoss)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1, 2, 3,
-//		4, 5, 6,
-//		7, -8, 9 };
-//	constexpr float scalar = 2.5f;
-//
-//	const fgm::Matrix4D expected = {
-//		2, 5, 7,
-//		10, 12, 15,
-//		17, -20, 22 };
-//
-//	// Act
-//	a *= scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, a);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesNegativeFloatScalarFlipsSigns)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, -2.0f, 0.0f,
-//		-4.0f, 5.0f, -6.0f,
-//		0.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		-2.0f, 4.0f, 0.0f,
-//		8.0f, -10.0f, 12.0f,
-//		0.0f, -16.0f, -18.0f };
-//	constexpr float scalar = -2.0f;
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a * scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, b);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesVectorReturnsANewMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::vec3 vec(2.0f, 1.0f, 3.0f);
-//	const fgm::vec3 expected(13.0f, 31.0f, 49.0f);
-//
-//	// Act
-//	const fgm::vec3 actual = mat * vec;
-//
-//	// Assert
-//	testutils::EXPECT_VEC_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, IdentityMatrixTimesAVectorReturnsTheSameMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D<float> mat;
-//	const fgm::vec3 vec(2.0f, 1.0f, 3.0f);
-//
-//	// Act
-//	const fgm::vec3 actual = mat * vec;
-//
-//	// Assert
-//	testutils::EXPECT_VEC_EQ(vec, actual);
-// }
-//
-// TEST(Matrix4D_Product, VectorTimesAMatrixReturnsANewVectorWithCorrectValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	fgm::Vector3D vec(2.0f, 1.0f, 3.0f);
-//	const fgm::Vector3D expected(27.0f, 33.0f, 39.0f);
-//
-//	// Act
-//	const auto actual = vec * mat;
-//
-//	// Assert
-//	testutils::EXPECT_VEC_EQ(expected, actual);
-// }
-//
-//
-// TEST(Matrix4D_Product, VectorTimesIdentityMatrixReturnsTheSameMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D<float> mat;
-//	fgm::vec3 vec(2.0f, 1.0f, 3.0f);
-//
-//	// Act
-//	const fgm::vec3 actual = vec * mat;
-//
-//	// Assert
-//	testutils::EXPECT_VEC_EQ(vec, actual);
-// }
-//
-// TEST(Matrix4D_Product, VectorTimesEqualMatrixReturnTheSameVectorWithNewValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	fgm::vec3 vec(2.0f, 1.0f, 3.0f);
-//	const fgm::vec3 expected(27.0f, 33.0f, 39.0f);
-//
-//	// Act
-//	vec *= mat;
-//
-//	// Assert
-//	testutils::EXPECT_VEC_EQ(expected, vec);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesMatrixGivesAnotherMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = {
-//		2.0, 4.0, 6.0,
-//		8.0, 10.0, 12.0,
-//		14.0, 16.0, 18.0 };
-//	const fgm::Matrix4D expected = {
-//		60.0f, 72.0f, 84.0f,
-//		132.0f, 162.0f, 192.0f,
-//		204.0f, 252.0f, 300.0f };
-//
-//	// Act
-//	const fgm::Matrix4D actual = mat1 * mat2;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesIdentityMatrixReturnsSameMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D<float> eye;
-//
-//	// Act
-//	const fgm::Matrix4D actual = mat * eye;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(mat, actual);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesEqualAnotherMatrixReturnsSameMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = {
-//		2.0f, 4.0f, 6.0f,
-//		8.0f, 10.0f, 12.0f,
-//		14.0f, 16.0f, 18.0f };
-//	const fgm::Matrix4D expected = {
-//		60.0f, 72.0f, 84.0f,
-//		132.0f, 162.0f, 192.0f,
-//		204.0f, 252.0f, 300.0f };
-//
-//	// Act
-//	mat1 *= mat2;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, mat1);
-// }
-//
-//
-// TEST(Matrix4D_Product, Matrix4DProductIsAntiCommutative)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = {
-//		3.0f, 6.0f, 3.0f,
-//		12.0f, 0.0f, 2.0f,
-//		15.0f, 11.0f, 6.0f };
-//
-//	// Act
-//	const fgm::Matrix4D result1 = mat1 * mat2;
-//	const fgm::Matrix4D result2 = mat2 * mat1;
-//
-//	// Assert
-//	bool commutative = true;
-//	for (std::size_t i = 0; i < size; i++)
-//	{
-//		commutative &= floatEquals(result1(i / rowSize, i % rowSize), result2(i / rowSize, i % rowSize));
-//	}
-//	EXPECT_FALSE(commutative);
-// }
-//
-// TEST(Matrix4D_Product, Matrix4DProductWithScalarMultiplesAreCommutative)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = mat1 * 5.0f;
-//
-//	// Act
-//	const fgm::Matrix4D result1 = mat1 * mat2;
-//	const fgm::Matrix4D result2 = mat2 * mat1;
-//
-//	// Assert
-//	bool commutative = true;
-//	for (std::size_t i = 0; i < size; i++)
-//	{
-//		commutative &= floatEquals(result1(i / rowSize, i % rowSize), result2(i / rowSize, i % rowSize));
-//	}
-//	EXPECT_TRUE(commutative);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesADoubleScalarReturnsMatrixWithPromotedType)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	constexpr double scalar = 2.5;
-//
-//	const fgm::Matrix4D expected = {
-//		2.5, 5.0, 7.5,
-//		10.0, 12.5, 15.0,
-//		17.5, -20.0, 22.5 };
-//
-//	// Act
-//	const auto b = a * scalar;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(b)::value_type, double>, "Assertion Failed (Matrix4D): Float *
-// Double(Scalar) = Double"); 	EXPECT_MAT_EQ(expected, b);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesEqualDoubleScalarReturnsMatrixWithoutTypePromotion)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	constexpr double scalar = 2.5;
-//
-//	const fgm::Matrix4D expected = {
-//		2.5, 5.0, 7.5,
-//		10.0, 12.5, 15.0,
-//		17.5, -20.0, 22.5 };
-//
-//	// Act
-//	a *= scalar;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(a)::value_type, float>, "Assertion Failed (Matrix4D): Float *
-// Double(Scalar) = Double"); 	EXPECT_MAT_EQ(expected, a);
-// }
-//
-// TEST(Matrix4D_Product, DoubleVectorTimesAMatrixReturnsANewVectorWithPromotedType)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//
-//	fgm::dvec3 vec(2.0, 1.0, 3.0);
-//	const fgm::dvec3 expected(27.0, 33.0, 39.0);
-//
-//	// Act
-//	const fgm::dvec3 actual = vec * mat;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(actual)::value_type, double>, "Assertion Failed (Matrix4D): Float *
-// Double(vec) = Double"); 	testutils::EXPECT_VEC_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, DoubleVectorTimesEqualAMatrixReturnsANewVectorWithPromotedType)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//
-//	fgm::vec3 vec(2.0f, 1.0f, 3.0f);
-//	const fgm::dvec3 expected(27.0, 33.0, 39.0);
-//
-//	// Act
-//	vec *= mat;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(vec)::value_type, float>, "Assertion Failed (Matrix4D): Float(vec) *
-// Double = Float"); 	testutils::EXPECT_VEC_EQ(expected, vec);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesMatrixGivesAnotherMatrixWithTypePromotion)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = {
-//		2.0, 4.0, 6.0,
-//		8.0, 10.0, 12.0,
-//		14.0, 16.0, 18.0 };
-//	const fgm::Matrix4D expected = {
-//		60.0, 72.0, 84.0,
-//		132.0, 162.0, 192.0,
-//		204.0, 252.0, 300.0 };
-//
-//	// Act
-//	const fgm::Matrix4D actual = mat1 * mat2;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(actual)::value_type, double>, "Assertion Failed (Matrix4D): Float *
-// Double = Double"); 	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Product, MatrixTimesEqualAnotherMatrixReturnsSameMatrixWithoutTypePromotion)
-//{
-//	// Arrange
-//	fgm::Matrix4D mat1 = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D mat2 = {
-//		2.0, 4.0, 6.0,
-//		8.0, 10.0, 12.0,
-//		14.0, 16.0, 18.0 };
-//	const fgm::Matrix4D expected = {
-//		60.0, 72.0, 84.0,
-//		132.0, 162.0, 192.0,
-//		204.0, 252.0, 300.0 };
-//
-//	// Act
-//	mat1 *= mat2;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(mat1)::value_type, float>, "Assertion Failed (Matrix4D): Float *=
-// Double = Float"); 	EXPECT_MAT_EQ(expected, mat1);
-// }
-//
-//
-// TEST(Matrix4D_Division, MatrixDividedByAIntegerScalarReturnsCorrectMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		0.5f, 1.0f, 1.5f,
-//		2.0f, 2.5f, 3.0f,
-//		3.5f, -4.0f, 4.5f };
-//	constexpr int scalar = 2;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = a / scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividesEqualIntegerScalarIsTheSameMatrixWithCorrectValues)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		0.5f, 1.0f, 1.5f,
-//		2.0f, 2.5f, 3.0f,
-//		3.5f, -4.0f, 4.5f };
-//	constexpr int scalar = 2;
-//
-//	// Act
-//	a /= scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(b, a);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividedByOneReturnANewMatrixWithOriginalMatrixValues)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a / 1;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(a, b);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividedByZeroScalarReturnsInfinityMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//
-//	// Act
-//	const fgm::Matrix4D<float> b = a / 0;
-//
-//	// Assert
-//	EXPECT_MAT_INF(b);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividedByAFloatScalarReturnsCorrectMatrix)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//
-//	const fgm::Matrix4D expected = {
-//		0.4f, 0.8f, 1.2f,
-//		1.6f, 2.0f, 2.4f,
-//		2.8f, -3.2f, 3.6f };
-//
-//	constexpr float scalar = 2.5f;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = a / scalar;
-//
-//	// Assert
-//	EXPECT_MAT_NEAR(expected, actual);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividedNegativeFloatScalarFlipsSigns)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, -2.0f, 22.0f,
-//		-4.0f, 5.0f, -6.0f,
-//		4.0f, 8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		-0.5f, 1.0f, -11.0f,
-//		2.0f, -2.5f, 3.0f,
-//		-2.0f, -4.0f, -4.5f };
-//	constexpr float scalar = -2.0f;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = a / scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividedByDoubleScalarReturnsMatrixWithTypePromotion)
-//{
-//	// Arrange
-//	const fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D expected = {
-//		0.5, 1.0, 1.5,
-//		2.0, 2.5, 3.0,
-//		3.5, -4.0, 4.5 };
-//	constexpr double scalar = 2.0;
-//
-//	// Act
-//	const auto actual = a / scalar;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(actual)::value_type, double>, "Assertion Failed (Matrix4D): Float /
-// Double = Double"); 	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Division, MatrixDividesEqualDoubleScalarIsTheSameMatrixWithoutTypePromotion)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, -8.0f, 9.0f };
-//	const fgm::Matrix4D b = {
-//		0.5f, 1.0f, 1.5f,
-//		2.0f, 2.5f, 3.0f,
-//		3.5f, -4.0f, 4.5f };
-//	constexpr double scalar = 2.0;
-//
-//	// Act
-//	a /= scalar;
-//
-//	// Assert
-//	static_assert(std::is_same_v<typename decltype(a)::value_type, float>, "Assertion Failed (Matrix4D): Float /= Double
-//= Float"); 	EXPECT_MAT_EQ(b, a);
-// }
-//
-// TEST(Matrix4D_Division, IntegerMatrixDivideEqualFloatScalarIsTheSameMatrixWithMinimalPrecisionLoss)
-//{
-//	// Arrange
-//	fgm::Matrix4D a = {
-//		1, 2, 3,
-//		4, 5, 6,
-//		7, -8, 9 };
-//	const fgm::Matrix4D b = {
-//		4, 8, 12,
-//		16, 20, 24,
-//		28, -32, 36 };
-//	constexpr float scalar = 0.25f;
-//
-//	// Act
-//	a /= scalar;
-//
-//	// Assert
-//	EXPECT_MAT_EQ(b, a);
-// }
-//
-//
-///***********************
-// *                     *
-// *  DETERMINANT TESTS  *
-// *                     *
-// ***********************/
-//
-// TEST(Matrix4D_Determinant, IdentityMatrixReturnsDeterminantOfOne)
-//{
-//	// Arrange
-//	const fgm::Matrix4D<float> mat;
-//	constexpr float expectedDeterminant = 1.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, DiagonalMatrixReturnsProductOfDiagonalEntriesAsDeterminant)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat(
-//		2.0f, 0.0f, 0.0f,
-//		0.0f, 3.0f, 0.0f,
-//		0.0f, 0.0f, 4.0f);
-//	constexpr float expectedDeterminant = 24.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, MatrixWithScalarMultipleColumnsReturnsDeterminantOfZero)
-//{
-//	const fgm::Matrix4D mat(
-//		2.0f, 1.0f, 3.0f,
-//		4.0f, 2.0f, 6.0f,
-//		1.0f, 5.0f, 4.0f);
-//
-//	constexpr float expectedDeterminant = 0.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, MatrixWithScalarMultipleRowsReturnsDeterminantOfZero)
-//{
-//	const fgm::Matrix4D mat(
-//		2.0f, 4.0f, 3.0f,
-//		4.0f, 8.0f, 6.0f,
-//		1.0f, 2.0f, 4.0f);
-//
-//	constexpr float expectedDeterminant = 0.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, IdentityMatrixWithSwappedRowsReturnsDeterminantOfNegativeOne)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 1.0f,
-//		0.0f, 1.0f, 0.0f);
-//
-//	constexpr float expectedDeterminant = -1.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, IdentityMatrixWithSwappedColumnsReturnsDeterminantOfNegativeOne)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 1.0f,
-//		0.0f, 1.0f, 0.0f);
-//
-//	constexpr float expectedDeterminant = -1.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, IdentityMatrixWithShearAppliedsReturnsDeterminantOfOne)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 1.0f, 0.0f,
-//		0.0f, 1.0f, 0.0f,
-//		0.0f, 0.0f, 1.0f);
-//
-//	constexpr float expectedDeterminant = 1.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, MatrixDeterminantReturnsCorrectValue)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//
-//	constexpr float expectedDeterminant = -56.0f;
-//
-//	// Act
-//	const float actualDeterminant = mat.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, MatrixDeterminantWithStaticWrapperReturnsCorrectValue)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//
-//	constexpr float expectedDeterminant = -56.0f;
-//
-//	// Act
-//	const float actualDeterminant = fgm::Matrix4D<float>::determinant(mat);
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(expectedDeterminant, actualDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, DeterminantOfTransposedMatrixIsEqualToDeterminantOfTheMatrix)
-//{
-//	const fgm::Matrix4D a(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//
-//	// Act
-//	const float detA = a.determinant();
-//	const float detAT = a.transpose().determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(detA, detAT);
-//}
-//
-// TEST(Matrix4D_Determinant, DeterminantOfProductOfMatricesIsSameAsProductOfDeterminantOfMatrix)
-//{
-//	// det(A*B) = det(A) * det(B)
-//	const fgm::Matrix4D a(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//	const fgm::Matrix4D b(
-//		1.0f, 2.0f, 3.0f,
-//		4.0f, 5.0f, 6.0f,
-//		7.0f, 8.0f, 9.0f);
-//
-//	// Act
-//	const float determinantOfProduct = fgm::Matrix4D<float>::determinant(a * b);
-//	const float productOfDeterminant = a.determinant() * b.determinant();
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(determinantOfProduct, productOfDeterminant);
-//}
-//
-// TEST(Matrix4D_Determinant, DeterminantOfAMatrixMultipliedByScalarIsScalarPowNTimesTheDeterminantOfOriginalMatrix)
-//{
-//	// det(t*A) = (t^n)det(A)
-//	const fgm::Matrix4D a(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//	constexpr float scalar = 5.0f;
-//
-//	// Act
-//	const float determinantOfProduct = fgm::Matrix4D<float>::determinant(scalar * a);
-//	const float productOfDeterminant = (scalar * scalar * scalar) * a.determinant(); // n = 3 for 3x3 matrix
-//
-//	// Assert
-//	EXPECT_FLOAT_EQ(determinantOfProduct, productOfDeterminant);
-//}
-
-
-///*********************
-// *                   *
-// *  TRANSPOSE TESTS  *
-// *                   *
-// *********************/
-
-// TEST(Matrix4D_Transpose, TransposeOfIdentityMatrixIsItself)
-//{
-//	// Arrange
-//	const fgm::Matrix4D<float> mat;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = mat.transpose();
-//
-//	// Assert
-//	EXPECT_MAT_EQ(mat, actual);
-// }
-//
-// TEST(Matrix4D_Transpose, TransposeOfAMatrixReturnsMatrixWithRowsAndColumnsSwapped)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//	const fgm::Matrix4D expected(
-//		1.0f, 0.0f, 5.0f,
-//		2.0f, 4.0f, 6.0f,
-//		3.0f, 1.0f, 0.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = mat.transpose();
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-//
-// TEST(Matrix4D_Transpose, TransposeOfAMatrixUsingStaticWrapperReturnsMatrixWithRowsAndColumnsSwapped)
-//{
-//	// Arrange
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 4.0f, 1.0f,
-//		5.0f, 6.0f, 0.0f);
-//	const fgm::Matrix4D expected(
-//		1.0f, 0.0f, 5.0f,
-//		2.0f, 4.0f, 6.0f,
-//		3.0f, 1.0f, 0.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actual = fgm::Matrix4D<float>::transpose(mat);
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expected, actual);
-// }
-
-
-///*******************
-// *                 *
-// *  INVERSE TESTS  *
-// *                 *
-// *******************/
-
-// TEST(Matrix4D_Inverse, InverseReturnsAnotherMatrixWithCorrectValues)
-//{
-//	// Given
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 1.0f, 4.0f,
-//		5.0f, 6.0f, 0.0f);
-//	const fgm::Matrix4D expectedInverse(
-//		-24.0f, 18.0f, 5.0f,
-//		20.0f, -15.0f, -4.0f,
-//		-5.0f, 4.0f, 1.0f);
-//
-//	// Act
-//	const fgm::Matrix4D actualInverse = mat.inverse();
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expectedInverse, actualInverse);
-// }
-//
-// TEST(Matrix4D_Inverse, StaticWrapperForInverseReturnsAnotherMatrixWithCorrectValues)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 1.0f, 4.0f,
-//		5.0f, 6.0f, 0.0f);
-//	const fgm::Matrix4D expectedInverse(
-//		-24.0f, 18.0f, 5.0f,
-//		20.0f, -15.0f, -4.0f,
-//		-5.0f, 4.0f, 1.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actualInverse = fgm::Matrix4D<float>::inverse(mat);
-//
-//	// Assert
-//	EXPECT_MAT_EQ(expectedInverse, actualInverse);
-// }
-//
-// TEST(Matrix4D_Inverse, IdentityMatrixInverseReturnsAnotherIdentityMatrix)
-//{
-//	// Given
-//	const fgm::Matrix4D<float> identity;
-//
-//	// Act
-//	const fgm::Matrix4D<float> actualInverse = identity.inverse();
-//
-//	// Assert
-//	EXPECT_MAT_IDENTITY(actualInverse);
-// }
-//
-// TEST(Matrix4D_Inverse, MatrixTimeInverseReturnsIdentityMatrix)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 1.0f, 4.0f,
-//		5.0f, 6.0f, 0.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> inverse = fgm::Matrix4D<float>::inverse(mat);
-//	const fgm::Matrix4D<float> product = mat * inverse;
-//
-//	// Assert
-//	EXPECT_MAT_IDENTITY(product);
-// }
-//
-// TEST(Matrix4D_Inverse, InverseTimesMatrixReturnsIdentityMatrix)
-//{
-//	const fgm::Matrix4D mat(
-//		1.0f, 2.0f, 3.0f,
-//		0.0f, 1.0f, 4.0f,
-//		5.0f, 6.0f, 0.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> inverse = fgm::Matrix4D<float>::inverse(mat);
-//	const fgm::Matrix4D<float> product = inverse * mat;
-//
-//	// Assert
-//	EXPECT_MAT_IDENTITY(product);
-// }
-//
-// TEST(Matrix4D_Inverse, SingularMatrixProducesIdentityMatrix)
-//{
-//	const fgm::Matrix4D singularMatrix(
-//		0.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 0.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actualInverse = fgm::Matrix4D<float>::inverse(singularMatrix);
-//
-//	// Assert
-//	EXPECT_MAT_IDENTITY(actualInverse);
-// }
-//
-// TEST(Matrix4D_Inverse, NearSingularMatrixProducesNonIdentityMatrix)
-//{
-//	const fgm::Matrix4D nearSingularMatrix(
-//		1.0f, 0.0f, 0.0f,
-//		0.0f, 0.1f, 0.0f,
-//		0.0f, 0.0f, 0.1f
-//	);
-//
-//	const fgm::Matrix4D expectedInverse(
-//		1.0f, 0.0f, 0.0f,
-//		0.0f, 10.0f, 0.0f,
-//		0.0f, 0.0f, 10.0f
-//	);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actualInverse = fgm::Matrix4D<float>::inverse(nearSingularMatrix);
-//
-//	// Assert
-//	EXPECT_MAT_NEAR(expectedInverse, actualInverse);
-// }
-//
-// TEST(Matrix4D_Inverse, InversionOfRotationOnlyMatrixReturnsTranspose)
-//{
-//	const fgm::Matrix4D mat(
-//		0.0f, -1.0f, 0.0f,
-//		1.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 1.0f);
-//	const fgm::Matrix4D transpose(
-//		0.0f, 1.0f, 0.0f,
-//		-1.0f, 0.0f, 0.0f,
-//		0.0f, 0.0f, 1.0f);
-//
-//	// Act
-//	const fgm::Matrix4D<float> actualInverse = fgm::Matrix4D<float>::inverse(mat);
-//
-//	// Assert
-//	EXPECT_MAT_EQ(transpose, actualInverse);
-// }
\ No newline at end of file
+TEST(Matrix4D_Difference, DifferenceOfTwoMatricesReturnsAnotherMatrixWithCorrectValues)
+{
+    // Given two matrices with arbitrary values
+    const fgm::Matrix4D a = { 1.0f, 2.0f,  3.0f, 5.0f, 4.0f,  5.0f,  6.0f,  2.0f,
+                              7.0f, -8.0f, 9.0f, 8.0f, 12.0f, -3.0f, -20.f, 2.0f };
+    const fgm::Matrix4D b = { 3.0f, 2.0f,  255.0f, 55.0f, -8.0f, 24.0f, 6.0f,  -23.0f,
+                              7.0f, 16.0f, -98.0f, 11.0f, 1.0f,  55.0f, 11.0f, -316.0f };
+
+    const fgm::Matrix4D expected = { -2.0f, 0.0f,   -252.0f, -50.0f, 12.0f, -19.0f, 0.0f,   25.0f,
+                                     0.0f,  -24.0f, 107.0f,  -3.0f,  11.0f, -58.0f, -31.0f, 318.0f };
+
+    // When one is subtracted from the other
+    const fgm::Matrix4D result = a - b;
+
+    // Then, the result is the difference of individual elements
+    EXPECT_MAT_EQ(expected, result);
+}
+
+TEST(Matrix4D_Difference, DifferenceOfTwoMatricesOfDifferentTypeReturnsAnotherMatrixPromotedType)
+{
+    // Given two matrices with arbitrary values and different types
+    const fgm::Matrix4D a = { 1.0f, 2.0f,  3.0f, 5.0f, 4.0f,  5.0f,  6.0f,  2.0f,
+                              7.0f, -8.0f, 9.0f, 8.0f, 12.0f, -3.0f, -20.f, 2.0f };
+    const fgm::Matrix4D b = { 3.0, 2.0,  255.0, 55.0, -8.0, 24.0, 6.0,  -23.0,
+                              7.0, 16.0, -98.0, 11.0, 1.0,  55.0, 11.0, -316.0 };
+
+    const fgm::Matrix4D expected = { -2.0, 0.0,   -252.0, -50.0, 12.0, -19.0, 0.0,   25.0,
+                                     0.0,  -24.0, 107.0,  -3.0,  11.0, -58.0, -31.0, 318.0 };
+
+    // When one is subtracted from the other
+    const auto result = a - b;
+
+    // Then, the type of the resultant matrix is of the larger of the two type
+    static_assert(std::is_same_v<typename decltype(result)::value_type, double>);
+    // And, the result is the difference of individual elements
+    EXPECT_MAT_EQ(expected, result);
+}
+
+TEST(Matrix4D_Difference, MinusEqualsMatrixWithAnotherMatrixOfDifferentTypeReturnsSameMatrixWithoutTypePromotion)
+{
+    // Given two matrices with arbitrary values with different types
+    fgm::Matrix4D a = { 1.0f, 2.0f,  3.0f, 5.0f, 4.0f,  5.0f,  6.0f,  2.0f,
+                        7.0f, -8.0f, 9.0f, 8.0f, 12.0f, -3.0f, -20.f, 2.0f };
+    const fgm::Matrix4D b = { 3.0, 2.0,  255.0, 55.0, -8.0, 24.0, 6.0,  -23.0,
+                              7.0, 16.0, -98.0, 11.0, 1.0,  55.0, 11.0, -316.0 };
+
+    const fgm::Matrix4D expected = { -2.0f, 0.0f,   -252.0f, -50.0f, 12.0f, -19.0f, 0.0f,   25.0f,
+                                     0.0f,  -24.0f, 107.0f,  -3.0f,  11.0f, -58.0f, -31.0f, 318.0f };
+
+    // When one matrix is subtracted from the other(-=)
+    a -= b;
+
+    // Then, the type of the original matrix is preserved
+    static_assert(std::is_same_v<typename decltype(a)::value_type, float>);
+    // And, the original matrix contains the difference of the elements
+    EXPECT_MAT_EQ(expected, a);
+}
+
+
+/*********************************
+ *                               *
+ *     SCALAR PRODUCT TESTS      *
+ *                               *
+ *********************************/
+
+static const fgm::Matrix4D<float> arbitraryMat = { 1.0f, 2.0f,  3.0f,   4.0f,  5.0f,  -6.0f, 7.0f,  8.0f,
+                                                   9.0f, 10.0f, -11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f };
+
+TEST(Matrix4D_Product, MatrixTimesAScalarReturnsCorrectMatrix)
+{
+    // Given an arbitrary matrix
+    const fgm::Matrix4D expected = { 2.5f,  5.0f,  7.5f,   10.0f, 12.5f, -15.0f, 17.5f, 20.0f,
+                                     22.5f, 25.0f, -27.5f, 30.0f, 32.5f, 35.0f,  37.5f, 40.0f };
+
+    // When multiplied by a scalar from either side
+    const fgm::Matrix4D<float> right = arbitraryMat * 2.5f;
+    const fgm::Matrix4D<float> left = 2.5f * arbitraryMat;
+
+    // Then, every element is scaled
+    EXPECT_MAT_EQ(expected, right);
+    EXPECT_MAT_EQ(expected, left);
+}
+
+TEST(Matrix4D_Product, MatrixTimesEqualScalarIsTheSameMatrixWithCorrectValues)
+{
+    // Given an arbitrary matrix
+    fgm::Matrix4D<float> mat = arbitraryMat;
+    const fgm::Matrix4D expected = { -2.0f,  -4.0f,  -6.0f, -8.0f,  -10.0f, 12.0f,  -14.0f, -16.0f,
+                                     -18.0f, -20.0f, 22.0f, -24.0f, -26.0f, -28.0f, -30.0f, -32.0f };
+
+    // When multiplied by a negative scalar in place
+    mat *= -2;
+
+    // Then, every element is scaled and the signs flip
+    EXPECT_MAT_EQ(expected, mat);
+}
+
+TEST(Matrix4D_Product, MatrixTimesZeroScalarReturnsZeroMatrix)
+{
+    // When an arbitrary matrix is multiplied by zero
+    const fgm::Matrix4D<float> result = arbitraryMat * 0.0f;
+
+    // Then, every element is zero
+    EXPECT_MAT_ZERO(result);
+}
+
+TEST(Matrix4D_Product, MatrixTimesADoubleScalarReturnsMatrixWithPromotedType)
+{
+    // When a float matrix is multiplied by a double
+    const auto result = arbitraryMat * 0.5;
+
+    // Then, the result is promoted to double and scaled
+    static_assert(std::is_same_v<typename decltype(result)::value_type, double>);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            EXPECT_DOUBLE_EQ(static_cast<double>(arbitraryMat(i, j)) * 0.5, result(i, j));
+}
+
+TEST(Matrix4D_Product, IntegerMatrixTimesEqualAFloatScalarKeepsIntegerType)
+{
+    // Given an integer matrix
+    fgm::Matrix4D<int> mat(2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32);
+
+    // When multiplied by a float in place
+    mat *= 0.5f;
+
+    // Then, the matrix keeps its type and holds the halved values
+    static_assert(std::is_same_v<typename decltype(mat)::value_type, int>);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            EXPECT_EQ(static_cast<int>(i * rows + j + 1), mat(i, j));
+}
+
+
+/*********************************
+ *                               *
+ *     VECTOR PRODUCT TESTS      *
+ *                               *
+ *********************************/
+
+TEST(Matrix4D_Product, MatrixTimesVectorReturnsANewVectorWithCorrectValues)
+{
+    // Given a matrix and a vector
+    const fgm::Vector4D vec(2.0f, 1.0f, 3.0f, -1.0f);
+
+    // When the matrix transforms the vector
+    const fgm::vec4 actual = arbitraryMat * vec;
+
+    // Then, each component is the dot product of a row with the vector
+    EXPECT_VEC_EQ(fgm::vec4(9.0f, 17.0f, -17.0f, 69.0f), actual);
+}
+
+TEST(Matrix4D_Product, IdentityMatrixTimesAVectorReturnsTheSameVector)
+{
+    // Given an identity matrix and a vector
+    const fgm::Matrix4D<double> mat;
+    const fgm::Vector4D vec(2.0, 1.0, 3.0, -7.5);
+
+    // When the matrix transforms the vector
+    const fgm::dVec4 actual = mat * vec;
+
+    // Then, the vector is unchanged
+    EXPECT_VEC_EQ(vec, actual);
+}
+
+TEST(Matrix4D_Product, MatrixTimesVectorSupportsIntegerAndMixedTypes)
+{
+    // Given integer matrices and vectors
+    const fgm::Matrix4D<long long> longMat(1, 2, 3, 4, 5, -6, 7, 8, 9, 10, -11, 12, 13, 14, 15, 16);
+    const fgm::Matrix4D<int> intMat(longMat);
+
+    // When they transform integer and double vectors
+    const auto longResult = longMat * fgm::Vector4D<long long>(2, 1, 3, -1);
+    const auto intResult = intMat * fgm::Vector4D<int>(2, 1, 3, -1);
+    const auto mixedResult = intMat * fgm::Vector4D<double>(2.0, 1.0, 3.0, -1.0);
+
+    // Then, all produce the same values in the expected type
+    static_assert(std::is_same_v<typename decltype(mixedResult)::value_type, double>);
+    EXPECT_VEC_EQ(fgm::Vector4D<long long>(9, 17, -17, 69), longResult);
+    EXPECT_VEC_EQ(fgm::Vector4D<int>(9, 17, -17, 69), intResult);
+    EXPECT_VEC_EQ(fgm::Vector4D<double>(9.0, 17.0, -17.0, 69.0), mixedResult);
+}
+
+TEST(Matrix4D_Product, VectorTimesAMatrixReturnsANewVectorWithCorrectValues)
+{
+    // Given a row vector
+    const fgm::Vector4D vec(2.0f, 1.0f, 3.0f, -1.0f);
+
+    // When it is multiplied by a matrix
+    const fgm::vec4 actual = vec * arbitraryMat;
+
+    // Then, each component is the dot product of the vector with a column
+    EXPECT_VEC_EQ(fgm::vec4(21.0f, 14.0f, -35.0f, 36.0f), actual);
+}
+
+TEST(Matrix4D_Product, VectorTimesEqualMatrixReturnTheSameVectorWithNewValues)
+{
+    // Given a row vector
+    fgm::Vector4D vec(2.0f, 1.0f, 3.0f, -1.0f);
+
+    // When it is multiplied by a matrix in place
+    vec *= arbitraryMat;
+
+    // Then, it holds the product
+    EXPECT_VEC_EQ(fgm::vec4(21.0f, 14.0f, -35.0f, 36.0f), vec);
+}
+
+
+/*********************************
+ *                               *
+ *     MATRIX PRODUCT TESTS      *
+ *                               *
+ *********************************/
+
+static const fgm::Matrix4D<float> otherMat = { 2.0f, 0.0f, 1.0f,  3.0f, -1.0f, 4.0f, 0.0f, 2.0f,
+                                               5.0f, 1.0f, -2.0f, 0.0f, 0.0f,  3.0f, 1.0f, 1.0f };
+
+TEST(Matrix4D_Product, MatrixTimesMatrixGivesAnotherMatrixWithCorrectValues)
+{
+    // Given two matrices
+    const fgm::Matrix4D expected = { 15.0f,  23.0f, -1.0f, 11.0f, 51.0f, 7.0f,   -1.0f, 11.0f,
+                                     -47.0f, 65.0f, 43.0f, 59.0f, 87.0f, 119.0f, -1.0f, 83.0f };
+
+    // When they are multiplied
+    const fgm::Matrix4D<float> result = arbitraryMat * otherMat;
+
+    // Then, each element is the dot product of a row of the first with a column of the second
+    EXPECT_MAT_EQ(expected, result);
+}
+
+TEST(Matrix4D_Product, MatrixTimesIdentityMatrixReturnsSameMatrix)
+{
+    // Given an identity matrix
+    const fgm::Matrix4D<float> identity;
+
+    // When an arbitrary matrix is multiplied by it on either side
+    // Then, the arbitrary matrix is unchanged
+    EXPECT_MAT_EQ(arbitraryMat, arbitraryMat * identity);
+    EXPECT_MAT_EQ(arbitraryMat, identity * arbitraryMat);
+}
+
+TEST(Matrix4D_Product, MatrixTimesEqualAnotherMatrixReturnsSameMatrixWithCorrectValues)
+{
+    // Given two matrices, the first of which is multiplied in place
+    fgm::Matrix4D<float> mat = arbitraryMat;
+    const fgm::Matrix4D expected = { 15.0f,  23.0f, -1.0f, 11.0f, 51.0f, 7.0f,   -1.0f, 11.0f,
+                                     -47.0f, 65.0f, 43.0f, 59.0f, 87.0f, 119.0f, -1.0f, 83.0f };
+
+    // When it is multiplied by the second(*=)
+    mat *= otherMat;
+
+    // Then, it holds the product even though the product reads its own columns
+    EXPECT_MAT_EQ(expected, mat);
+}
+
+TEST(Matrix4D_Product, Matrix4DProductIsNotCommutative)
+{
+    // Given two matrices
+    const fgm::Matrix4D expected = { 50.0f, 56.0f,  40.0f, 68.0f, 45.0f, 2.0f, 55.0f, 60.0f,
+                                     -8.0f, -16.0f, 44.0f, 4.0f,  37.0f, 6.0f, 25.0f, 52.0f };
+
+    // When multiplied in the opposite order
+    const fgm::Matrix4D<float> result = otherMat * arbitraryMat;
+
+    // Then, the product differs from A * B and matches B * A
+    EXPECT_MAT_EQ(expected, result);
+    EXPECT_NE(result(0, 0), (arbitraryMat * otherMat)(0, 0));
+}
+
+TEST(Matrix4D_Product, MatrixTimesMatrixGivesAnotherMatrixWithTypePromotion)
+{
+    // Given a float and a double matrix
+    const fgm::Matrix4D<double> other(otherMat);
+
+    // When they are multiplied
+    const auto result = arbitraryMat * other;
+
+    // Then, the product is promoted to double
+    static_assert(std::is_same_v<typename decltype(result)::value_type, double>);
+    const fgm::Matrix4D expected = { 15.0,  23.0, -1.0, 11.0, 51.0, 7.0,   -1.0, 11.0,
+                                     -47.0, 65.0, 43.0, 59.0, 87.0, 119.0, -1.0, 83.0 };
+    EXPECT_MAT_EQ(expected, result);
+}
+
+
+/*********************************
+ *                               *
+ *        DIVISION TESTS         *
+ *                               *
+ *********************************/
+
+TEST(Matrix4D_Division, MatrixDividedByAScalarReturnsCorrectMatrix)
+{
+    // Given an arbitrary matrix
+    const fgm::Matrix4D expected = { 0.5f, 1.0f, 1.5f,  2.0f, 2.5f, -3.0f, 3.5f, 4.0f,
+                                     4.5f, 5.0f, -5.5f, 6.0f, 6.5f, 7.0f,  7.5f, 8.0f };
+
+    // When divided by a scalar
+    const fgm::Matrix4D<float> result = arbitraryMat / 2.0f;
+
+    // Then, every element is divided
+    EXPECT_MAT_EQ(expected, result);
+}
+
+TEST(Matrix4D_Division, MatrixDividesEqualScalarIsTheSameMatrixWithCorrectValues)
+{
+    // Given an arbitrary matrix
+    fgm::Matrix4D<float> mat = arbitraryMat;
+
+    // When divided in place by a scalar and scaled back
+    mat /= -4.0f;
+    mat *= -4.0f;
+
+    // Then, the original values are restored
+    EXPECT_MAT_EQ(arbitraryMat, mat);
+}
+
+TEST(Matrix4D_Division, MatrixDividedByZeroScalarReturnsInfinityMatrix)
+{
+    // Given a matrix with no zero elements
+    const fgm::Matrix4D<float> mat = arbitraryMat + fgm::Matrix4D<float>() * 100.0f;
+
+    // When divided by zero
+    const fgm::Matrix4D<float> result = mat / 0.0f;
+
+    // Then, every element is infinite
+    EXPECT_MAT_INF(result);
+}
+
+TEST(Matrix4D_Division, MatrixDividedByDoubleScalarReturnsMatrixWithTypePromotion)
+{
+    // When a float matrix is divided by a double
+    const auto result = arbitraryMat / 4.0;
+
+    // Then, the result is promoted to double
+    static_assert(std::is_same_v<typename decltype(result)::value_type, double>);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            EXPECT_DOUBLE_EQ(static_cast<double>(arbitraryMat(i, j)) / 4.0, result(i, j));
+}
+
+
+/*********************************
+ *                               *
+ *       DETERMINANT TESTS       *
+ *                               *
+ *********************************/
+
+TEST(Matrix4D_Determinant, IdentityMatrixReturnsDeterminantOfOne)
+{
+    EXPECT_FLOAT_EQ(1.0f, fgm::Matrix4D<float>().determinant());
+    EXPECT_DOUBLE_EQ(1.0, fgm::Matrix4D<double>().determinant());
+    EXPECT_EQ(1, fgm::Matrix4D<int>().determinant());
+}
+
+TEST(Matrix4D_Determinant, DiagonalMatrixReturnsProductOfDiagonalEntriesAsDeterminant)
+{
+    // Given a diagonal matrix
+    const fgm::Matrix4D mat(2.0f, 0.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, -4.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                            0.5f);
+
+    // Then, its determinant is the product of the diagonal
+    EXPECT_FLOAT_EQ(-12.0f, mat.determinant());
+}
+
+TEST(Matrix4D_Determinant, MatrixWithScalarMultipleColumnsReturnsDeterminantOfZero)
+{
+    // Given a matrix whose last column is twice its first
+    const fgm::Matrix4D mat(1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 5.0f, 6.0f, 8.0f, 7.0f, 8.0f, 10.0f, 14.0f, 3.0f, 1.0f, 0.0f,
+                            6.0f);
+
+    // Then, its determinant is zero
+    EXPECT_FLOAT_EQ(0.0f, mat.determinant());
+}
+
+TEST(Matrix4D_Determinant, IdentityMatrixWithSwappedRowsReturnsDeterminantOfNegativeOne)
+{
+    // Given an identity matrix with its first and third rows swapped
+    const fgm::Matrix4D mat(0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+
+    // Then, its determinant is negative one
+    EXPECT_DOUBLE_EQ(-1.0, mat.determinant());
+}
+
+TEST(Matrix4D_Determinant, IdentityMatrixWithShearAppliedReturnsDeterminantOfOne)
+{
+    // Given an identity matrix with shear and translation terms
+    const fgm::Matrix4D mat(1.0f, 3.0f, 0.0f, 7.0f, 0.0f, 1.0f, -2.0f, 1.0f, 0.0f, 0.0f, 1.0f, 5.0f, 0.0f, 0.0f, 0.0f,
+                            1.0f);
+
+    // Then, its determinant is one
+    EXPECT_FLOAT_EQ(1.0f, mat.determinant());
+}
+
+TEST(Matrix4D_Determinant, MatrixDeterminantReturnsCorrectValue)
+{
+    // Given arbitrary matrices of every supported kind
+    const fgm::Matrix4D<double> doubleMat(arbitraryMat);
+    const fgm::Matrix4D<long long> longMat(arbitraryMat);
+
+    // Then, each determinant matches the cofactor expansion
+    EXPECT_FLOAT_EQ(-9504.0f, arbitraryMat.determinant());
+    EXPECT_FLOAT_EQ(102.0f, fgm::Matrix4D<float>::determinant(otherMat));
+    EXPECT_DOUBLE_EQ(-9504.0, doubleMat.determinant());
+    EXPECT_EQ(-9504, longMat.determinant());
+}
+
+TEST(Matrix4D_Determinant, DeterminantOfTransposedMatrixIsEqualToDeterminantOfTheMatrix)
+{
+    EXPECT_FLOAT_EQ(arbitraryMat.determinant(), arbitraryMat.transpose().determinant());
+}
+
+TEST(Matrix4D_Determinant, DeterminantOfProductOfMatricesIsSameAsProductOfDeterminantOfMatrix)
+{
+    EXPECT_FLOAT_EQ(arbitraryMat.determinant() * otherMat.determinant(), (arbitraryMat * otherMat).determinant());
+}
+
+TEST(Matrix4D_Determinant, DeterminantOfAMatrixMultipliedByScalarIsScalarPowNTimesTheDeterminantOfOriginalMatrix)
+{
+    EXPECT_FLOAT_EQ(16.0f * arbitraryMat.determinant(), (arbitraryMat * 2.0f).determinant());
+}
+
+
+/*********************************
+ *                               *
+ *        TRANSPOSE TESTS        *
+ *                               *
+ *********************************/
+
+TEST(Matrix4D_Transpose, TransposeOfIdentityMatrixIsItself)
+{
+    EXPECT_MAT_IDENTITY(fgm::Matrix4D<float>().transpose());
+}
+
+TEST(Matrix4D_Transpose, TransposeOfAMatrixReturnsMatrixWithRowsAndColumnsSwapped)
+{
+    // Given matrices of every element type
+    const fgm::Matrix4D<double> doubleMat(arbitraryMat);
+    const fgm::Matrix4D<int> intMat(arbitraryMat);
+
+    // When they are transposed
+    const fgm::Matrix4D<float> floatResult = arbitraryMat.transpose();
+    const fgm::Matrix4D<double> doubleResult = fgm::Matrix4D<double>::transpose(doubleMat);
+    const fgm::Matrix4D<int> intResult = intMat.transpose();
+
+    // Then, element (i, j) moves to (j, i)
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            EXPECT_FLOAT_EQ(arbitraryMat(i, j), floatResult(j, i));
+            EXPECT_DOUBLE_EQ(doubleMat(i, j), doubleResult(j, i));
+            EXPECT_EQ(intMat(i, j), intResult(j, i));
+        }
+}
+
+
+/*********************************
+ *                               *
+ *         INVERSE TESTS         *
+ *                               *
+ *********************************/
+
+TEST(Matrix4D_Inverse, InverseReturnsAnotherMatrixWithCorrectValues)
+{
+    // Given an affine matrix with a known inverse
+    const fgm::Matrix4D mat(2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                            1.0f);
+    const fgm::Matrix4D expected(0.5f, 0.0f, 0.0f, -0.5f, 0.0f, 1.0f, 0.0f, -2.0f, -0.5f, 0.0f, 1.0f, 0.5f, 0.0f,
+                                 0.0f, 0.0f, 1.0f);
+
+    // When it is inverted through the member and the static wrapper
+    // Then, both match the known inverse
+    EXPECT_MAT_NEAR(expected, mat.inverse());
+    EXPECT_MAT_NEAR(expected, fgm::Matrix4D<float>::inverse(mat));
+}
+
+TEST(Matrix4D_Inverse, GeneralMatrixInverseMatchesCofactorsForFloatAndDouble)
+{
+    // Given a general matrix whose inverse has no simple structure
+    const fgm::Matrix4D<double> doubleMat(otherMat);
+    const fgm::Matrix4D<double> expected = fgm::Matrix4D<double>(6.0, -20.0, 14.0, 22.0, -12.0, 6.0, 6.0, 24.0, 9.0,
+                                                                 -47.0, -13.0, 67.0, 27.0, 29.0, -5.0, -37.0) /
+                                           102.0;
+
+    // When it is inverted as float and as double
+    // Then, both match the adjugate divided by the determinant
+    EXPECT_MAT_NEAR(expected, fgm::Matrix4D<double>(otherMat.inverse()), 1e-6);
+    EXPECT_MAT_NEAR(expected, doubleMat.inverse(), 1e-12);
+}
+
+TEST(Matrix4D_Inverse, IdentityMatrixInverseReturnsAnotherIdentityMatrix)
+{
+    EXPECT_MAT_IDENTITY(fgm::Matrix4D<float>().inverse());
+}
+
+TEST(Matrix4D_Inverse, MatrixTimesInverseReturnsIdentityMatrix)
+{
+    // Given an invertible matrix
+    const fgm::Matrix4D<float> inverse = arbitraryMat.inverse();
+
+    // When multiplied by its inverse on either side
+    // Then, the result is the identity
+    EXPECT_MAT_NEAR(fgm::Matrix4D<float>(), arbitraryMat * inverse);
+    EXPECT_MAT_NEAR(fgm::Matrix4D<float>(), inverse * arbitraryMat);
+}
+
+TEST(Matrix4D_Inverse, SingularMatrixProducesIdentityMatrix)
+{
+    // Given a matrix with two equal rows
+    const fgm::Matrix4D mat(1.0f, 2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 1.0f, 0.0f, 2.0f, 7.0f, 3.0f, 9.0f,
+                            1.0f);
+
+    // When it is inverted
+    // Then, the identity matrix is returned as a fallback
+    EXPECT_MAT_IDENTITY(mat.inverse());
+}
+
+TEST(Matrix4D_Inverse, NearSingularMatrixProducesNonIdentityMatrix)
+{
+    // Given a matrix with a small but non-zero determinant
+    const fgm::Matrix4D mat(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.1f, 0.0f, 0.0f, 0.0f, 0.0f,
+                            1.0f);
+    const fgm::Matrix4D expected(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 0.0f,
+                                 0.0f, 1.0f);
+
+    // When it is inverted
+    // Then, the true inverse is returned
+    EXPECT_MAT_NEAR(expected, mat.inverse());
+}
+
+TEST(Matrix4D_Inverse, InversionOfRotationOnlyMatrixReturnsTranspose)
+{
+    // Given a rotation of 90 degrees about z
+    const fgm::Matrix4D mat(0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                            1.0f);
+
+    // When it is inverted
+    // Then, the inverse is the transpose
+    EXPECT_MAT_EQ(mat.transpose(), mat.inverse());
+}
+
+TEST(Matrix4D_Inverse, TryInverseReportsSuccessAndWritesInverse)
+{
+    // Given an invertible matrix and a destination
+    fgm::Matrix4D<double> out = fgm::Matrix4D<double>() * 3.0;
+
+    // When it is inverted with tryInverse
+    const OperationStatus status = fgm::Matrix4D<double>(arbitraryMat).tryInverse(out);
+
+    // Then, the inverse is written
+    EXPECT_EQ(OperationStatus::SUCCESS, status);
+    EXPECT_MAT_NEAR(fgm::Matrix4D<double>(), fgm::Matrix4D<double>(arbitraryMat) * out, 1e-12);
+}
+
+TEST(Matrix4D_Inverse, TryInverseOfSingularMatrixReportsDivisionByZero)
+{
+    // Given a singular matrix and a destination
+    const fgm::Matrix4D<float> singular = arbitraryMat * 0.0f;
+    fgm::Matrix4D<float> out = otherMat;
+
+    // When it is inverted with tryInverse
+    const OperationStatus status = singular.tryInverse(out);
+
+    // Then, division by zero is reported and the destination is untouched
+    EXPECT_EQ(OperationStatus::DIVISIONBYZERO, status);
+    EXPECT_MAT_EQ(otherMat, out);
+}
+
+TEST(Matrix4D_Inverse, TryInverseOfMatrixWithNaNReportsNaNOperand)
+{
+    // Given a matrix containing NaN
+    fgm::Matrix4D<float> mat;
+    mat(2, 1) = std::numeric_limits<float>::quiet_NaN();
+    fgm::Matrix4D<float> out = otherMat;
+
+    // When it is inverted with tryInverse
+    const OperationStatus status = mat.tryInverse(out);
+
+    // Then, the NaN operand is reported and the destination is untouched
+    EXPECT_EQ(OperationStatus::NANOPERAND, status);
+    EXPECT_MAT_EQ(otherMat, out);
+}
@@ -0,0 +1,228 @@
+/**
+ * @file ParallelTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the work-stealing @ref fgm::parallel::ThreadPool and the chunking of
+ *        @ref fgm::parallel::for_each_chunk over packed and structure-of-arrays vectors.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <AlignedMemory.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <matrix/Matrix4DBatch.h>
+#include <parallel/Parallel.h>
+#include <stdexcept>
+#include <vector/Vec4Array.h>
+#include <vector>
+
+
+using fgm::parallel::ChunkMode;
+using fgm::parallel::ChunkOptions;
+using fgm::parallel::ChunkRange;
+using fgm::parallel::ThreadPool;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/** @brief Options running on @p pool for any input size. */
+inline ChunkOptions alwaysParallel(ThreadPool& pool, const ChunkMode mode = ChunkMode::Balanced)
+{
+    ChunkOptions options;
+    options.pool = &pool;
+    options.mode = mode;
+    options.parallelThreshold = 0;
+    return options;
+}
+
+
+
+/**
+ * @addtogroup T_FGM_Parallel
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *            THREAD POOL             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every index runs exactly once, also with more threads than cores. */
+TEST(Parallel_ThreadPool, RunCallsEveryIndexOnce)
+{
+    for (const std::size_t threads : { 1, 2, 4, 7 })
+    {
+        ThreadPool pool(threads);
+        EXPECT_EQ(threads, pool.size());
+
+        std::vector<std::atomic<int>> calls(1000);
+        pool.run(calls.size(), [&](const std::size_t i) { calls[i].fetch_add(1); });
+        for (const std::atomic<int>& count : calls)
+            EXPECT_EQ(1, count.load());
+    }
+}
+
+
+/** @test Verify that a task can run a nested job on the same pool without deadlocking. */
+TEST(Parallel_ThreadPool, NestedRunCompletes)
+{
+    ThreadPool pool(3);
+    std::atomic<int> total{ 0 };
+    pool.run(8, [&](std::size_t) { pool.run(8, [&](std::size_t) { total.fetch_add(1); }); });
+    EXPECT_EQ(64, total.load());
+}
+
+
+/** @test Verify that an exception thrown by a task reaches the caller and leaves the pool usable. */
+TEST(Parallel_ThreadPool, RethrowsTaskException)
+{
+    ThreadPool pool(4);
+    EXPECT_THROW(pool.run(100,
+                          [](const std::size_t i)
+                          {
+                              if (i == 37)
+                                  throw std::runtime_error("chunk failed");
+                          }),
+                 std::runtime_error);
+
+    std::atomic<int> calls{ 0 };
+    pool.run(10, [&](std::size_t) { calls.fetch_add(1); });
+    EXPECT_EQ(10, calls.load());
+}
+
+
+
+/**************************************
+ *                                    *
+ *             CHUNKING               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that chunks cover every element once, in order, starting on register boundaries. */
+TEST(Parallel_Chunking, ChunksCoverInputOnRegisterBoundaries)
+{
+    ThreadPool pool(4);
+    constexpr std::size_t count = 100003;
+
+    for (const ChunkMode mode : { ChunkMode::Balanced, ChunkMode::Deterministic })
+    {
+        const fgm::parallel::ChunkPlan plan =
+            fgm::parallel::planChunks(count, sizeof(float), alwaysParallel(pool, mode));
+        EXPECT_TRUE(plan.parallel);
+        EXPECT_EQ(0u, plan.chunkSize * sizeof(float) % falcon::simd::defaultAlignment);
+
+        std::vector<std::atomic<int>> covered(count);
+        std::vector<ChunkRange> ranges(plan.chunkCount);
+        fgm::parallel::for_each_chunk(
+            count, sizeof(float),
+            [&](const ChunkRange& range)
+            {
+                ranges[range.index] = range;
+                for (std::size_t i = range.begin; i < range.end; ++i)
+                    covered[i].fetch_add(1);
+            },
+            alwaysParallel(pool, mode));
+
+        for (const std::atomic<int>& hits : covered)
+            ASSERT_EQ(1, hits.load());
+        for (std::size_t c = 1; c < ranges.size(); ++c)
+            EXPECT_EQ(ranges[c - 1].end, ranges[c].begin);
+    }
+}
+
+
+/** @test Verify that deterministic chunks depend on neither the thread count nor the input size. */
+TEST(Parallel_Chunking, DeterministicChunksIgnoreThreadCount)
+{
+    ThreadPool one(1);
+    ThreadPool many(6);
+
+    const auto small = fgm::parallel::planChunks(1 << 20, 16, alwaysParallel(one, ChunkMode::Deterministic));
+    const auto large = fgm::parallel::planChunks(1 << 24, 16, alwaysParallel(many, ChunkMode::Deterministic));
+    EXPECT_EQ(small.chunkSize, large.chunkSize);
+    EXPECT_EQ(fgm::Config::PARALLEL_CHUNK_BYTES / 16, small.chunkSize);
+    EXPECT_FALSE(small.parallel);
+
+    // Balanced chunks shrink to give every thread several.
+    const auto balanced = fgm::parallel::planChunks(1 << 14, 16, alwaysParallel(many));
+    EXPECT_GE(balanced.chunkCount, many.size());
+}
+
+
+/** @test Verify that small inputs run on the calling thread. */
+TEST(Parallel_Chunking, SmallInputRunsInline)
+{
+    ChunkOptions options;
+    const auto plan = fgm::parallel::planChunks(100, sizeof(float), options);
+    EXPECT_FALSE(plan.parallel);
+    EXPECT_EQ(1u, plan.chunkCount);
+}
+
+
+
+/**************************************
+ *                                    *
+ *           BATCH OPERATIONS         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a chunked packed transform matches the single-threaded one exactly. */
+TEST(Parallel_Batch, PackedTransformMatchesSerial)
+{
+    ThreadPool pool(4);
+    const fgm::Matrix4D<float> matrix(fgm::vec4(1, 2, 0, 0), fgm::vec4(0, 1, 3, 0), fgm::vec4(-1, 0, 1, 0),
+                                      fgm::vec4(5, 6, 7, 1));
+
+    std::vector<fgm::vec4> vectors(50001);
+    for (std::size_t i = 0; i < vectors.size(); ++i)
+        vectors[i] = fgm::vec4(float(i % 97), float(i % 13) - 6.0f, 0.5f * float(i % 7), 1.0f);
+
+    std::vector<fgm::vec4> expected(vectors.size());
+    fgm::transform(matrix, vectors, expected);
+
+    std::vector<fgm::vec4> actual(vectors.size());
+    fgm::parallel::for_each_chunk(
+        std::span<const fgm::vec4>(vectors),
+        [&](const std::span<const fgm::vec4> chunk, const ChunkRange& range)
+        { fgm::transform(matrix, chunk, std::span(actual).subspan(range.begin, range.size())); },
+        alwaysParallel(pool));
+
+    for (std::size_t i = 0; i < vectors.size(); ++i)
+        ASSERT_EQ(expected[i], actual[i]);
+}
+
+
+/** @test Verify that chunked structure-of-arrays streams see offset views of every stream. */
+TEST(Parallel_Batch, StreamChunksOffsetEveryStream)
+{
+    ThreadPool pool(3);
+    fgm::Vec4Array<float> array(20000, fgm::vec4(1, 2, 3, 4));
+
+    fgm::parallel::for_each_chunk(
+        array.streams(), array.size(),
+        [](const falcon::simd::Vec4Streams<float> chunk, const ChunkRange& range)
+        {
+            for (std::size_t i = 0; i < range.size(); ++i)
+            {
+                chunk.x[i] += float(range.begin + i);
+                chunk.w[i] = -chunk.w[i];
+            }
+        },
+        alwaysParallel(pool));
+
+    for (std::size_t i = 0; i < array.size(); ++i)
+    {
+        ASSERT_EQ(1.0f + float(i), array[i].x);
+        ASSERT_EQ(-4.0f, array[i].w);
+    }
+}
+
+/** @} */
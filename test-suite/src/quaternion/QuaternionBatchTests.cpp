@@ -0,0 +1,136 @@
+/**
+ * @file QuaternionBatchTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies that batch quaternion interpolation matches @ref fgm::Quaternion::nlerp and
+ *        @ref fgm::Quaternion::slerp rotation by rotation.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cmath>
+#include <quaternion/QuaternionBatch.h>
+#include <vector>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class QuaternionBatch: public ::testing::Test
+{
+    protected:
+    /** @note 37 rotations leave a tail after every register width. */
+    static constexpr std::size_t count = 37;
+
+    fgm::Vec4Array<T> _from;
+    fgm::Vec4Array<T> _to;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T k = static_cast<T>(i);
+            const fgm::Vector3D<T> axisA(std::cos(k), std::sin(k), T(0.5));
+            const fgm::Vector3D<T> axisB(T(0.25), std::cos(k * T(1.7)), std::sin(k * T(1.7)));
+            const auto from = fgm::Quaternion<T>::fromAxisAngle(normalized(axisA), k * T(0.4));
+            auto to = fgm::Quaternion<T>::fromAxisAngle(normalized(axisB), T(3) - k * T(0.15));
+            if (i % 3 == 0)
+                to = -to; // Same rotation in the opposite hemisphere
+            if (i % 7 == 0)
+                to = fgm::Quaternion<T>(from.toVector4D() + fgm::Vector4D<T>(T(0), T(1e-4), T(0), T(0))).normalize();
+
+            _from.push_back(from.toVector4D());
+            _to.push_back(to.toVector4D());
+        }
+    }
+
+    static fgm::Vector3D<T> normalized(const fgm::Vector3D<T>& vec)
+    {
+        const T length = std::sqrt(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z);
+        return fgm::Vector3D<T>(vec.x / length, vec.y / length, vec.z / length);
+    }
+
+    /** @brief Expect @p actual to hold `interpolate(from[i], to[i], t)` for every rotation. */
+    template <typename Interpolate>
+    void expectInterpolated(const fgm::Vec4Array<T>& actual, const T t, Interpolate interpolate) const
+    {
+        const T tolerance = T(16) * std::numeric_limits<T>::epsilon();
+
+        ASSERT_EQ(count, actual.size());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SCOPED_TRACE(i);
+            const auto expected =
+                interpolate(fgm::Quaternion<T>(_from[i]), fgm::Quaternion<T>(_to[i]), t).toVector4D();
+            const fgm::Vector4D<T> result = actual[i];
+            for (std::size_t c = 0; c < 4; ++c)
+                EXPECT_NEAR(expected[c], result[c], tolerance) << "component " << c;
+        }
+    }
+};
+TYPED_TEST_SUITE(QuaternionBatch, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Quat_Batch
+ * @{
+ */
+
+/** @test Verify that batch nlerp matches the scalar nlerp of every pair. */
+TYPED_TEST(QuaternionBatch, Nlerp_MatchesScalar)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> out;
+
+    for (const T t : { T(0), T(0.3), T(0.5), T(0.8), T(1) })
+    {
+        SCOPED_TRACE(t);
+        fgm::nlerp(this->_from, this->_to, t, out);
+        this->expectInterpolated(out, t, &fgm::Quaternion<T>::nlerp);
+    }
+}
+
+
+/** @test Verify that batch slerp matches the scalar slerp of every pair on both halves of the arc. */
+TYPED_TEST(QuaternionBatch, Slerp_MatchesScalar)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> out;
+
+    for (const T t : { T(0), T(0.1), T(0.45), T(0.5), T(0.55), T(0.9), T(1) })
+    {
+        SCOPED_TRACE(t);
+        fgm::slerp(this->_from, this->_to, t, out);
+        this->expectInterpolated(out, t, &fgm::Quaternion<T>::slerp);
+    }
+}
+
+
+/** @test Verify that interpolating into one of the inputs gives the same result as a separate output. */
+TYPED_TEST(QuaternionBatch, Slerp_InPlaceMatchesSeparateOutput)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> expected;
+    fgm::slerp(this->_from, this->_to, T(0.35), expected);
+
+    fgm::Vec4Array<T> blended = this->_from;
+    fgm::slerp(blended, this->_to, T(0.35), blended);
+
+    ASSERT_EQ(expected.size(), blended.size());
+    for (std::size_t i = 0; i < blended.size(); ++i)
+        EXPECT_VEC_EQ(expected[i], blended[i]);
+}
+
+/** @} */
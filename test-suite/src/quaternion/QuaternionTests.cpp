@@ -0,0 +1,338 @@
+/**
+ * @file QuaternionTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::Quaternion composition, rotation, matrix conversions and interpolation against the
+ *        matching matrices and scalar formulas.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cmath>
+#include <numbers>
+#include <quaternion/Quaternion.h>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+/** @brief Test fixture holding two unit rotations about unrelated axes. */
+template <typename T>
+class QuaternionTest: public ::testing::Test
+{
+    protected:
+    fgm::Quaternion<T> _quatA;
+    fgm::Quaternion<T> _quatB;
+    fgm::Vector3D<T> _vec;
+
+    void SetUp() override
+    {
+        _quatA = fgm::Quaternion<T>::fromAxisAngle(axis(T(1), T(2), T(3)), T(0.75));
+        _quatB = fgm::Quaternion<T>::fromAxisAngle(axis(T(-2), T(0.5), T(1)), T(2.5));
+        _vec = fgm::Vector3D<T>(T(3), T(-1), T(2));
+    }
+
+    /** @brief Unit axis along `(x, y, z)`. */
+    static fgm::Vector3D<T> axis(const T x, const T y, const T z)
+    {
+        const T length = std::sqrt(x * x + y * y + z * z);
+        return fgm::Vector3D<T>(x / length, y / length, z / length);
+    }
+
+    /** @brief Tolerance for a handful of operations on values of magnitude up to `4`. */
+    static T tolerance()
+    {
+        return T(64) * std::numeric_limits<T>::epsilon();
+    }
+
+    /** @brief Expect every component of @p actual within @ref tolerance of @p expected. */
+    static void expectQuatNear(const fgm::Quaternion<T>& expected, const fgm::Quaternion<T>& actual)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+            EXPECT_NEAR(expected[i], actual[i], tolerance()) << "component " << i;
+    }
+
+    /** @brief Expect @p expected and @p actual to be the same rotation, allowing opposite signs. */
+    static void expectSameRotation(const fgm::Quaternion<T>& expected, const fgm::Quaternion<T>& actual)
+    {
+        expectQuatNear(expected.dot(actual) < T(0) ? -expected : expected, actual);
+    }
+
+    /** @brief Expect every component of @p actual within @ref tolerance of @p expected. */
+    static void expectVecNear(const fgm::Vector3D<T>& expected, const fgm::Vector3D<T>& actual)
+    {
+        EXPECT_NEAR(expected.x, actual.x, tolerance());
+        EXPECT_NEAR(expected.y, actual.y, tolerance());
+        EXPECT_NEAR(expected.z, actual.z, tolerance());
+    }
+};
+using QuaternionTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(QuaternionTest, QuaternionTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Quat
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *           INITIALIZATION           *
+ *                                    *
+ **************************************/
+
+/** @test Verify that quaternions share the size and alignment of @ref fgm::Vector4D and default to identity. */
+TYPED_TEST(QuaternionTest, Layout_MatchesVector4D)
+{
+    using T = TypeParam;
+    static_assert(sizeof(fgm::Quaternion<T>) == sizeof(fgm::Vector4D<T>));
+    static_assert(alignof(fgm::Quaternion<T>) == alignof(fgm::Vector4D<T>));
+
+    constexpr fgm::Quaternion<T> identity;
+    static_assert(identity.x == T(0) && identity.y == T(0) && identity.z == T(0) && identity.w == T(1));
+
+    const fgm::Quaternion<T> quat(fgm::Vector3D<T>(T(1), T(2), T(3)), T(4));
+    EXPECT_VEC_EQ(fgm::Vector4D<T>(T(1), T(2), T(3), T(4)), quat.toVector4D());
+    EXPECT_EQ(quat, fgm::Quaternion<T>(quat.toVector4D()));
+    EXPECT_VEC_EQ(fgm::Vector3D<T>(T(1), T(2), T(3)), quat.vector());
+    EXPECT_EQ(T(4), quat.scalar());
+}
+
+
+/** @test Verify that @ref fgm::Quaternion::fromAxisAngle stores the half angle. */
+TYPED_TEST(QuaternionTest, FromAxisAngle_StoresHalfAngle)
+{
+    using T = TypeParam;
+    const auto quat = fgm::Quaternion<T>::fromAxisAngle(fgm::Vector3D<T>(T(0), T(0), T(1)), std::numbers::pi_v<T>);
+
+    this->expectQuatNear(fgm::Quaternion<T>(T(0), T(0), T(1), T(0)), quat);
+    EXPECT_NEAR(T(1), quat.mag(), this->tolerance());
+}
+
+
+
+/**************************************
+ *                                    *
+ *             ARITHMETIC             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the Hamilton product matches the scalar formula and its constant evaluation. */
+TYPED_TEST(QuaternionTest, Multiply_MatchesHamiltonProduct)
+{
+    using T = TypeParam;
+    const fgm::Quaternion<T> a(T(1), T(-2), T(3), T(0.5));
+    const fgm::Quaternion<T> b(T(-0.25), T(4), T(1.5), T(-2));
+
+    const fgm::Quaternion<T> expected(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                                      a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                                      a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                                      a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+    this->expectQuatNear(expected, a * b);
+
+    fgm::Quaternion<T> compound = a;
+    compound *= b;
+    this->expectQuatNear(expected, compound);
+
+    constexpr fgm::Quaternion<T> i(T(1), T(0), T(0), T(0));
+    constexpr fgm::Quaternion<T> j(T(0), T(1), T(0), T(0));
+    static_assert(i * j == fgm::Quaternion<T>(T(0), T(0), T(1), T(0)), "i * j must be k");
+    static_assert(j * i == fgm::Quaternion<T>(T(0), T(0), T(-1), T(0)), "j * i must be -k");
+}
+
+
+/** @test Verify that the conjugate and inverse undo a rotation. */
+TYPED_TEST(QuaternionTest, ConjugateAndInverse_UndoRotation)
+{
+    using T = TypeParam;
+    const fgm::Quaternion<T> identity;
+    const fgm::Quaternion<T> scaled = this->_quatA * T(3);
+
+    this->expectQuatNear(identity, this->_quatA * this->_quatA.conjugate());
+    this->expectQuatNear(identity, scaled * scaled.inverse());
+    this->expectQuatNear(identity, scaled.inverse() * scaled);
+    EXPECT_EQ(fgm::Quaternion<T>(T(-1), T(-2), T(-3), T(4)), fgm::Quaternion<T>(T(1), T(2), T(3), T(4)).conjugate());
+}
+
+
+/** @test Verify the component-wise operators. */
+TYPED_TEST(QuaternionTest, ComponentwiseOperators_MatchVector4D)
+{
+    using T = TypeParam;
+    const fgm::Quaternion<T> a(T(1), T(2), T(3), T(4));
+    const fgm::Quaternion<T> b(T(-1), T(0.5), T(2), T(-3));
+
+    EXPECT_EQ(fgm::Quaternion<T>(a.toVector4D() + b.toVector4D()), a + b);
+    EXPECT_EQ(fgm::Quaternion<T>(a.toVector4D() - b.toVector4D()), a - b);
+    EXPECT_EQ(fgm::Quaternion<T>(-a.toVector4D()), -a);
+    EXPECT_EQ(fgm::Quaternion<T>(a.toVector4D() * T(2)), a * T(2));
+    EXPECT_EQ(a * T(2), T(2) * a);
+    EXPECT_EQ(a.toVector4D().dot(b.toVector4D()), a.dot(b));
+    this->expectQuatNear(fgm::Quaternion<T>(a.toVector4D().normalize()), a.normalize());
+}
+
+
+
+/**************************************
+ *                                    *
+ *              ROTATION              *
+ *                                    *
+ **************************************/
+
+/** @test Verify that rotating a vector matches multiplying it by the rotation matrix. */
+TYPED_TEST(QuaternionTest, Rotate_MatchesRotationMatrix)
+{
+    using T = TypeParam;
+    const fgm::Vector3D<T>& vec = this->_vec;
+
+    for (const auto& quat : { this->_quatA, this->_quatB, this->_quatA * this->_quatB })
+    {
+        this->expectVecNear(quat.toMatrix3D() * vec, quat.rotate(vec));
+
+        const fgm::Vector4D<T> point(vec, T(1));
+        const fgm::Vector4D<T> rotated = quat.rotate(point);
+        const fgm::Vector4D<T> expected = quat.toMatrix4D() * point;
+        this->expectVecNear(fgm::Vector3D<T>(expected.x, expected.y, expected.z),
+                            fgm::Vector3D<T>(rotated.x, rotated.y, rotated.z));
+        EXPECT_EQ(T(1), rotated.w) << "Rotation must keep the w component";
+    }
+}
+
+
+/** @test Verify that rotating by a product applies the right-hand rotation first. */
+TYPED_TEST(QuaternionTest, Rotate_ComposesRightToLeft)
+{
+    const auto& a = this->_quatA;
+    const auto& b = this->_quatB;
+
+    this->expectVecNear(a.rotate(b.rotate(this->_vec)), (a * b).rotate(this->_vec));
+}
+
+
+/** @test Verify a quarter turn about z against the counter-clockwise convention, also in constant expressions. */
+TEST(QuaternionRotation, QuarterTurn_IsCounterClockwise)
+{
+    const double half = std::numbers::sqrt2 / 2;
+    const fgm::dQuat quat(0.0, 0.0, half, half);
+    const fgm::dvec3 rotated = quat.rotate(fgm::dvec3(1.0, 0.0, 0.0));
+
+    EXPECT_NEAR(0.0, rotated.x, 1e-15);
+    EXPECT_NEAR(1.0, rotated.y, 1e-15);
+    EXPECT_NEAR(0.0, rotated.z, 1e-15);
+
+    constexpr fgm::dQuat halfTurn(0.0, 0.0, 1.0, 0.0);
+    constexpr fgm::dVec4 flipped = halfTurn.rotate(fgm::dVec4(1.0, 2.0, 3.0, 0.0));
+    static_assert(flipped.x == -1.0 && flipped.y == -2.0 && flipped.z == 3.0 && flipped.w == 0.0);
+}
+
+
+
+/**************************************
+ *                                    *
+ *         MATRIX CONVERSIONS         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that converting to a matrix and back gives the same rotation for every branch of the conversion. */
+TYPED_TEST(QuaternionTest, FromMatrix_RoundTripsEveryBranch)
+{
+    using T = TypeParam;
+    const fgm::Vector3D<T> axes[] = { this->axis(T(1), T(2), T(3)), this->axis(T(1), T(0.1), T(0.2)),
+                                      this->axis(T(0.1), T(1), T(0.2)), this->axis(T(0.1), T(0.2), T(1)) };
+
+    // A small angle takes the trace branch; a near half turn selects the dominant axis component.
+    for (const auto& axis : axes)
+    {
+        for (const T angle : { T(0.5), T(3) })
+        {
+            const auto quat = fgm::Quaternion<T>::fromAxisAngle(axis, angle);
+            this->expectSameRotation(quat, fgm::Quaternion<T>::fromMatrix(quat.toMatrix3D()));
+            this->expectSameRotation(quat, fgm::Quaternion<T>::fromMatrix(quat.toMatrix4D()));
+        }
+    }
+}
+
+
+/** @test Verify that the rotation matrix of a quaternion is orthonormal with a positive determinant. */
+TYPED_TEST(QuaternionTest, ToMatrix_IsProperRotation)
+{
+    using T = TypeParam;
+    const fgm::Matrix3D<T> matrix = (this->_quatA * this->_quatB).toMatrix3D();
+
+    EXPECT_NEAR(T(1), matrix.determinant(), this->tolerance());
+    const fgm::Matrix3D<T> product = matrix * matrix.transpose();
+    for (std::size_t row = 0; row < 3; ++row)
+        for (std::size_t col = 0; col < 3; ++col)
+            EXPECT_NEAR(row == col ? T(1) : T(0), product(row, col), this->tolerance());
+}
+
+
+
+/**************************************
+ *                                    *
+ *           INTERPOLATION            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that slerp sweeps the angle linearly and both interpolations hit their endpoints. */
+TYPED_TEST(QuaternionTest, Slerp_SweepsAngleLinearly)
+{
+    using T = TypeParam;
+    const fgm::Vector3D<T> axis = this->axis(T(1), T(-1), T(2));
+    const auto from = fgm::Quaternion<T>::fromAxisAngle(axis, T(0.25));
+    const auto to = fgm::Quaternion<T>::fromAxisAngle(axis, T(2.25));
+
+    for (const T t : { T(0), T(0.2), T(0.5), T(0.9), T(1) })
+    {
+        SCOPED_TRACE(t);
+        this->expectQuatNear(fgm::Quaternion<T>::fromAxisAngle(axis, T(0.25) + T(2) * t),
+                             fgm::Quaternion<T>::slerp(from, to, t));
+
+        const auto blended = fgm::Quaternion<T>::nlerp(from, to, t);
+        EXPECT_NEAR(T(1), blended.mag(), this->tolerance());
+    }
+    this->expectQuatNear(from, fgm::Quaternion<T>::nlerp(from, to, T(0)));
+    this->expectQuatNear(to, fgm::Quaternion<T>::nlerp(from, to, T(1)));
+}
+
+
+/** @test Verify that both interpolations take the shorter arc when the quaternions lie in opposite hemispheres. */
+TYPED_TEST(QuaternionTest, Interpolation_TakesShorterArc)
+{
+    using T = TypeParam;
+    const fgm::Quaternion<T>& from = this->_quatA;
+    const fgm::Quaternion<T> to = -this->_quatB;
+
+    for (const T t : { T(0.3), T(0.6) })
+    {
+        this->expectSameRotation(fgm::Quaternion<T>::slerp(from, this->_quatB, t),
+                                 fgm::Quaternion<T>::slerp(from, to, t));
+        this->expectSameRotation(fgm::Quaternion<T>::nlerp(from, this->_quatB, t),
+                                 fgm::Quaternion<T>::nlerp(from, to, t));
+    }
+}
+
+
+/** @test Verify that slerp between nearly equal rotations stays finite and unit length. */
+TYPED_TEST(QuaternionTest, Slerp_HandlesNearlyEqualRotations)
+{
+    using T = TypeParam;
+    const auto next = fgm::Quaternion<T>(this->_quatA.toVector4D() + fgm::Vector4D<T>(T(1e-7), T(0), T(0), T(0)));
+    const auto blended = fgm::Quaternion<T>::slerp(this->_quatA, next.normalize(), T(0.5));
+
+    EXPECT_TRUE(std::isfinite(blended.x) && std::isfinite(blended.w));
+    EXPECT_NEAR(T(1), blended.mag(), this->tolerance());
+}
+
+/** @} */
@@ -0,0 +1,87 @@
+/**
+ * @file AdditionTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: March 10, 2026
+ *
+ * @brief @ref falcon::simd::Register addition and subtraction tests.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMDTestSetup.h"
+
+#if defined(FALCON_SIMD_SUPPORTED) && defined(__SSE4_1__)
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+template <typename Config>
+class RegisterAddition: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterAddition, SupportedRegisterConfigs);
+
+
+template <typename Config>
+class RegisterUnsignedAddition: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterUnsignedAddition, UnsignedRegisterConfigs);
+
+
+
+/**
+ * @addtogroup T_SIMD_Register_Addition
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *                TESTS               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that register addition matches lane-wise scalar addition. */
+TYPED_TEST(RegisterAddition, OperatorPlus_ReturnsLaneWiseSum)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    (Reg::load(this->_lhs) + Reg::load(this->_rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(static_cast<T>(this->_lhs[i] + this->_rhs[i]), this->_out[i]);
+}
+
+
+/** @test Verify that register subtraction matches lane-wise scalar subtraction. */
+TYPED_TEST(RegisterAddition, OperatorMinus_ReturnsLaneWiseDifference)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    (Reg::load(this->_lhs) - Reg::load(this->_rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(static_cast<T>(this->_lhs[i] - this->_rhs[i]), this->_out[i]);
+}
+
+
+/** @test Verify that unsigned lanes wrap on overflow like scalar arithmetic. */
+TYPED_TEST(RegisterUnsignedAddition, OperatorPlus_WrapsOnOverflow)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    (Reg::broadcast(std::numeric_limits<T>::max()) + Reg::broadcast(T(2))).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(T(1), this->_out[i]);
+}
+
+/** @} */
+
+#endif
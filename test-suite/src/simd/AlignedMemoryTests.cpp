@@ -0,0 +1,170 @@
+/**
+ * @file AlignedMemoryTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Alignment, capacity rounding and zeroed tail tests for the aligned allocator and buffer.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <AlignedMemory.h>
+#include <bit>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <span>
+#include <utility>
+#include <vector>
+#include <vector/Vector3D.h>
+#include <vector/Vector4D.h>
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+using falcon::simd::AlignedAllocator;
+using falcon::simd::Buffer;
+
+/** @brief True if @p ptr is a multiple of @p alignment. */
+inline bool isAligned(const void* ptr, const std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+
+
+/**
+ * @addtogroup T_SIMD_Memory
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *              ALIGNMENT             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the maximum hardware alignment is a constant expression matching the macro. */
+TEST(AlignedMemory, MaxHardwareAlignment_IsConstexpr)
+{
+    static_assert(falcon::simd::maxHardwareAlignment == MAX_HARDWARE_ALIGNMENT);
+    static_assert(falcon::simd::defaultAlignment >= falcon::simd::maxHardwareAlignment);
+    static_assert(std::has_single_bit(falcon::simd::defaultAlignment));
+
+#if MAX_HARDWARE_ALIGNMENT > 0
+    EXPECT_TRUE(falcon::simd::maxHardwareAlignment >= 16);
+#endif
+}
+
+
+/** @test Verify that standard containers using the allocator start on the requested boundary. */
+TEST(AlignedMemory, Allocator_AlignsStandardContainers)
+{
+    for (std::size_t count : { 1, 3, 17, 1000 })
+    {
+        std::vector<float, AlignedAllocator<float>> floats(count);
+        std::vector<float, AlignedAllocator<float, 64>> cacheLines(count);
+        std::vector<fgm::vec4, AlignedAllocator<fgm::vec4>> vectors(count);
+
+        EXPECT_TRUE(isAligned(floats.data(), falcon::simd::defaultAlignment));
+        EXPECT_TRUE(isAligned(cacheLines.data(), 64));
+        EXPECT_TRUE(isAligned(vectors.data(), falcon::simd::defaultAlignment));
+    }
+
+    // Over-aligned element types raise the default alignment.
+    static_assert(AlignedAllocator<fgm::dVec4>::alignment >= alignof(fgm::dVec4));
+    static_assert(AlignedAllocator<float>() == AlignedAllocator<double>());
+}
+
+
+
+/**************************************
+ *                                    *
+ *               BUFFER               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that capacities end on a register boundary and the tail past the size is zeroed. */
+TEST(AlignedMemory, Buffer_RoundsCapacityToWholeRegisters)
+{
+    Buffer<float, 32> floats(13);
+    EXPECT_EQ(13u, floats.size());
+    EXPECT_EQ(16u, floats.capacity());
+    EXPECT_TRUE(isAligned(floats.data(), 32));
+
+    // 12-byte elements fill whole 16-byte registers four at a time.
+    Buffer<fgm::vec3, 16> tight(5);
+    EXPECT_EQ(4u, tight.granularity);
+    EXPECT_EQ(8u, tight.capacity());
+    EXPECT_EQ(0u, tight.capacity() * sizeof(fgm::vec3) % 16);
+
+    for (const float value : floats.padded())
+        EXPECT_EQ(0.0f, value);
+}
+
+
+/** @test Verify that growing keeps the elements and shrinking resets the dropped ones to zero. */
+TEST(AlignedMemory, Buffer_GrowsAndShrinksWithZeroedTail)
+{
+    Buffer<double> buffer;
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(nullptr, buffer.data());
+
+    for (int i = 0; i < 37; ++i)
+        buffer.push_back(double(i) + 0.5);
+
+    ASSERT_EQ(37u, buffer.size());
+    EXPECT_EQ(0u, buffer.capacity() % buffer.granularity);
+    EXPECT_TRUE(isAligned(buffer.data(), falcon::simd::defaultAlignment));
+    for (std::size_t i = 0; i < buffer.size(); ++i)
+        EXPECT_EQ(double(i) + 0.5, buffer[i]);
+
+    buffer.resize(10);
+    const std::span<const double> padded = std::as_const(buffer).padded();
+    for (std::size_t i = 10; i < padded.size(); ++i)
+        EXPECT_EQ(0.0, padded[i]);
+    EXPECT_EQ(9.5, buffer[9]);
+}
+
+
+/** @test Verify that appending one of the buffer's own elements at full capacity appends its value. */
+TEST(AlignedMemory, Buffer_PushBackOfOwnElementSurvivesGrowth)
+{
+    Buffer<fgm::vec4> buffer;
+    buffer.push_back(fgm::vec4(1, 2, 3, 4));
+    while (buffer.size() < buffer.capacity())
+        buffer.push_back(fgm::vec4(5, 6, 7, 8));
+
+    const std::size_t full = buffer.size();
+    buffer.push_back(buffer[0]);
+
+    ASSERT_EQ(full + 1, buffer.size());
+    EXPECT_GT(buffer.capacity(), full);
+    EXPECT_EQ(1.0f, buffer[full].x);
+    EXPECT_EQ(4.0f, buffer[full].w);
+}
+
+
+/** @test Verify that copies are deep and moves transfer the storage. */
+TEST(AlignedMemory, Buffer_CopiesAndMoves)
+{
+    const std::vector<fgm::vec4> values{ fgm::vec4(1, 2, 3, 4), fgm::vec4(5, 6, 7, 8), fgm::vec4(9, 10, 11, 12) };
+    Buffer<fgm::vec4> original{ std::span<const fgm::vec4>(values) };
+
+    Buffer<fgm::vec4> copy = original;
+    copy[0].x = 100.0f;
+    EXPECT_EQ(1.0f, original[0].x);
+    EXPECT_EQ(3u, copy.size());
+
+    const fgm::vec4* storage = original.data();
+    Buffer<fgm::vec4> moved = std::move(original);
+    EXPECT_EQ(storage, moved.data());
+    EXPECT_EQ(12.0f, moved[2].w);
+    EXPECT_EQ(0u, original.size());
+}
+
+/** @} */
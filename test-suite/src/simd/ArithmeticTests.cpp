@@ -0,0 +1,184 @@
+/**
+ * @file ArithmeticTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: April 08, 2026
+ *
+ * @brief @ref falcon::simd::Register multiplication, division, min, max, abs, FMA, square root and reciprocal square
+ *        root tests.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMDTestSetup.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(FALCON_SIMD_SUPPORTED) && defined(__SSE4_1__)
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+template <typename Config>
+class RegisterArithmetic: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterArithmetic, SupportedRegisterConfigs);
+
+
+template <typename Config>
+class RegisterFloatingArithmetic: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterFloatingArithmetic, FloatingRegisterConfigs);
+
+
+template <typename Config>
+class RegisterWideIntegerArithmetic: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterWideIntegerArithmetic, WideIntegerRegisterConfigs);
+
+
+
+/**
+ * @addtogroup T_SIMD_Register_Arithmetic
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *                TESTS               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that register multiplication keeps the low bits of every lane-wise product. */
+TYPED_TEST(RegisterArithmetic, OperatorMultiply_ReturnsLaneWiseProduct)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    (Reg::load(this->_lhs) * Reg::load(this->_rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(static_cast<T>(this->_lhs[i] * this->_rhs[i]), this->_out[i]);
+}
+
+
+/** @test Verify that 64-bit integer multiplication carries across the 32-bit halves. */
+TYPED_TEST(RegisterWideIntegerArithmetic, OperatorMultiply_CarriesAcrossHalves)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    constexpr T lhs = static_cast<T>(0x1'0000'0003LL);
+    constexpr T rhs = static_cast<T>(-0x2'0000'0005LL);
+    (Reg::broadcast(lhs) * Reg::broadcast(rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(static_cast<T>(static_cast<unsigned long long>(lhs) * static_cast<unsigned long long>(rhs)),
+                  this->_out[i]);
+}
+
+
+/** @test Verify that register division matches lane-wise scalar division. */
+TYPED_TEST(RegisterFloatingArithmetic, OperatorDivide_ReturnsLaneWiseQuotient)
+{
+    using Reg = typename TestFixture::Reg;
+
+    (Reg::load(this->_lhs) / Reg::load(this->_rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(this->_lhs[i] / this->_rhs[i], this->_out[i]);
+}
+
+
+/** @test Verify that register square root matches `std::sqrt` lane-wise and yields NaN for negative lanes. */
+TYPED_TEST(RegisterFloatingArithmetic, Sqrt_MatchesStdSqrt)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    Reg::sqrt(Reg::abs(Reg::load(this->_lhs))).store(this->_out);
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(std::sqrt(std::abs(this->_lhs[i])), this->_out[i]);
+
+    Reg::sqrt(Reg::broadcast(T(-1))).store(this->_out);
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_TRUE(std::isnan(this->_out[i]));
+}
+
+
+/** @test Verify that the reciprocal square root estimate stays within its documented relative error. */
+TYPED_TEST(RegisterFloatingArithmetic, Rsqrt_StaysWithinEstimateError)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    // 1.5 * 2^-12 for the float estimate, a correctly rounded divide for double.
+    const T tolerance = std::is_same_v<T, float> ? T(1.5) / T(4096) : T(2) * std::numeric_limits<T>::epsilon();
+
+    Reg::rsqrt(Reg::abs(Reg::load(this->_lhs))).store(this->_out);
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+    {
+        const T expected = T(1) / std::sqrt(std::abs(this->_lhs[i]));
+        EXPECT_NEAR(expected, this->_out[i], tolerance * expected);
+    }
+}
+
+
+/** @test Verify that @ref falcon::simd::Register::min and @ref falcon::simd::Register::max pick the correct lanes. */
+TYPED_TEST(RegisterArithmetic, MinMax_SelectLaneWiseExtremes)
+{
+    using Reg = typename TestFixture::Reg;
+    alignas(64) typename TestFixture::T maxOut[TestFixture::lanes];
+
+    Reg::min(Reg::load(this->_lhs), Reg::load(this->_rhs)).store(this->_out);
+    Reg::max(Reg::load(this->_lhs), Reg::load(this->_rhs)).store(maxOut);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+    {
+        EXPECT_EQ(std::min(this->_lhs[i], this->_rhs[i]), this->_out[i]);
+        EXPECT_EQ(std::max(this->_lhs[i], this->_rhs[i]), maxOut[i]);
+    }
+}
+
+
+/** @test Verify that @ref falcon::simd::Register::abs clears the sign of every lane. */
+TYPED_TEST(RegisterArithmetic, Abs_ReturnsLaneWiseMagnitude)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    Reg::abs(Reg::load(this->_lhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+    {
+        if constexpr (std::is_signed_v<T>)
+            EXPECT_EQ(static_cast<T>(this->_lhs[i] < T(0) ? -this->_lhs[i] : this->_lhs[i]), this->_out[i]);
+        else
+            EXPECT_EQ(this->_lhs[i], this->_out[i]);
+    }
+}
+
+
+/** @test Verify that @ref falcon::simd::Register::fma computes $ a \cdot b + c $ lane-wise. */
+TYPED_TEST(RegisterArithmetic, Fma_ReturnsProductPlusAddend)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg result = Reg::fma(Reg::load(this->_lhs), Reg::load(this->_rhs), Reg::broadcast(T(3)));
+    result.store(this->_out);
+
+    // Operands are small integers, so the fused and unfused results are exact and identical.
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(static_cast<T>(this->_lhs[i] * this->_rhs[i] + T(3)), this->_out[i]);
+}
+
+/** @} */
+
+#endif
@@ -0,0 +1,167 @@
+/**
+ * @file ComparisonTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: April 08, 2026
+ *
+ * @brief @ref falcon::simd::Register comparison, @ref falcon::simd::Mask and blending tests.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMDTestSetup.h"
+
+#include <limits>
+
+#if defined(FALCON_SIMD_SUPPORTED) && defined(__SSE4_1__)
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+template <typename Config>
+class RegisterComparison: public RegisterTest<Config>
+{
+    protected:
+    /**
+     * @brief Build the expected lane bitmask for a scalar predicate.
+     *
+     * @param[in] predicate Callable evaluated on each `(lhs, rhs)` lane pair.
+     *
+     * @return Bitmask with bit `i` set where the predicate holds.
+     */
+    template <typename Predicate>
+    std::uint64_t expectedBits(Predicate predicate) const
+    {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < this->lanes; ++i)
+            if (predicate(this->_lhs[i], this->_rhs[i]))
+                bits |= std::uint64_t(1) << i;
+        return bits;
+    }
+};
+TYPED_TEST_SUITE(RegisterComparison, SupportedRegisterConfigs);
+
+
+template <typename Config>
+class RegisterUnsignedComparison: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterUnsignedComparison, UnsignedRegisterConfigs);
+
+
+template <typename Config>
+class RegisterFloatingComparison: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterFloatingComparison, FloatingRegisterConfigs);
+
+
+
+/**
+ * @addtogroup T_SIMD_Register_Comparison
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *                TESTS               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every comparison predicate matches the scalar operator lane by lane. */
+TYPED_TEST(RegisterComparison, Compare_MatchesScalarOperators)
+{
+    using falcon::simd::Comparison;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg lhs = Reg::load(this->_lhs);
+    const Reg rhs = Reg::load(this->_rhs);
+
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a == b; }),
+              Reg::template compare<Comparison::Equal>(lhs, rhs).bits());
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a != b; }),
+              Reg::template compare<Comparison::NotEqual>(lhs, rhs).bits());
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a < b; }),
+              Reg::template compare<Comparison::Less>(lhs, rhs).bits());
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a <= b; }),
+              Reg::template compare<Comparison::LessEqual>(lhs, rhs).bits());
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a > b; }),
+              Reg::template compare<Comparison::Greater>(lhs, rhs).bits());
+    EXPECT_EQ(this->expectedBits([](auto a, auto b) { return a >= b; }),
+              Reg::template compare<Comparison::GreaterEqual>(lhs, rhs).bits());
+}
+
+
+/** @test Verify that unsigned lanes compare by unsigned order, including values with the top bit set. */
+TYPED_TEST(RegisterUnsignedComparison, Compare_UsesUnsignedOrder)
+{
+    using falcon::simd::Comparison;
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg large = Reg::broadcast(std::numeric_limits<T>::max());
+    const Reg small = Reg::broadcast(T(1));
+
+    EXPECT_TRUE(Reg::template compare<Comparison::Greater>(large, small).all());
+    EXPECT_TRUE(Reg::template compare<Comparison::Less>(large, small).none());
+}
+
+
+/** @test Verify that `NaN` lanes fail every ordered predicate and pass `NotEqual`. */
+TYPED_TEST(RegisterFloatingComparison, Compare_HandlesNaN)
+{
+    using falcon::simd::Comparison;
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg nan = Reg::broadcast(std::numeric_limits<T>::quiet_NaN());
+    const Reg one = Reg::broadcast(T(1));
+
+    EXPECT_TRUE(Reg::template compare<Comparison::Equal>(nan, nan).none());
+    EXPECT_TRUE(Reg::template compare<Comparison::NotEqual>(nan, nan).all());
+    EXPECT_TRUE(Reg::template compare<Comparison::Less>(nan, one).none());
+    EXPECT_TRUE(Reg::template compare<Comparison::GreaterEqual>(nan, one).none());
+}
+
+
+/** @test Verify that mask combinators and queries agree with their bitmasks. */
+TYPED_TEST(RegisterComparison, Mask_CombinesAndQueriesLanes)
+{
+    using falcon::simd::Comparison;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg lhs = Reg::load(this->_lhs);
+    const Reg rhs = Reg::load(this->_rhs);
+    const auto less = Reg::template compare<Comparison::Less>(lhs, rhs);
+    const auto equal = Reg::template compare<Comparison::Equal>(lhs, rhs);
+    const std::uint64_t allBits = TestFixture::lanes == 64 ? ~std::uint64_t(0)
+                                                            : (std::uint64_t(1) << TestFixture::lanes) - 1;
+
+    EXPECT_EQ(less.bits() | equal.bits(), (less | equal).bits());
+    EXPECT_EQ(less.bits() & equal.bits(), (less & equal).bits());
+    EXPECT_EQ(~less.bits() & allBits, (~less).bits());
+    EXPECT_TRUE((less | ~less).all());
+    EXPECT_TRUE((less & equal).none());
+    EXPECT_TRUE(equal.any());
+}
+
+
+/** @test Verify that @ref falcon::simd::Register::blend takes set lanes from the second register. */
+TYPED_TEST(RegisterComparison, Blend_SelectsLanesByMask)
+{
+    using falcon::simd::Comparison;
+    using Reg = typename TestFixture::Reg;
+
+    const Reg lhs = Reg::load(this->_lhs);
+    const Reg rhs = Reg::load(this->_rhs);
+    Reg::blend(lhs, rhs, Reg::template compare<Comparison::Greater>(lhs, rhs)).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(this->_lhs[i] > this->_rhs[i] ? this->_rhs[i] : this->_lhs[i], this->_out[i]);
+}
+
+/** @} */
+
+#endif
@@ -0,0 +1,1027 @@
+/**
+ * @file DispatchTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Runtime instruction set detection, override parsing and batch kernel tests.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "utils/VectorUtils.h"
+
+#include <Dispatch.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <vector/Vector4D.h>
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+using falcon::simd::ISA;
+
+/** @brief Element counts covering empty input, tails shorter than every register and multi-register runs. */
+inline constexpr std::size_t kernelCounts[] = { 0, 1, 3, 7, 15, 16, 17, 33, 100 };
+
+
+/**
+ * @brief Every tier compiled into the library that the running CPU can execute.
+ *
+ * @return Tables ordered from @ref ISA::Scalar upward.
+ */
+std::vector<const falcon::simd::BatchKernels*> runnableKernels()
+{
+    std::vector<const falcon::simd::BatchKernels*> tables;
+    for (const ISA isa : { ISA::Scalar, ISA::SSE42, ISA::AVX2, ISA::AVX512 })
+    {
+        const falcon::simd::BatchKernels* kernels = falcon::simd::batchKernelsFor(isa);
+        if (kernels && isa <= falcon::simd::detectISA())
+            tables.push_back(kernels);
+    }
+    return tables;
+}
+
+
+template <typename T>
+class BatchKernelTest: public ::testing::Test
+{
+    protected:
+    std::vector<T> _a, _b, _c, _out;
+
+    void SetUp() override
+    {
+        constexpr std::size_t maxCount = 100;
+        for (std::size_t i = 0; i < maxCount; ++i)
+        {
+            _a.push_back(static_cast<T>(i) * T(0.5) - T(7));
+            _b.push_back(static_cast<T>(i % 9) + T(1.25));
+            _c.push_back(T(3) - static_cast<T>(i) * T(0.25));
+        }
+        _out.assign(maxCount + 1, T(-999));
+    }
+
+    /** @brief Select the stream kernels for `T` from @p kernels. */
+    static const falcon::simd::StreamKernels<T>& streams(const falcon::simd::BatchKernels& kernels)
+    {
+        return kernels.get<T>().stream;
+    }
+
+    /** @brief Check that the sentinel past the last written element is untouched. */
+    void expectSentinel(const std::size_t count) const
+    {
+        EXPECT_EQ(T(-999), _out[count]) << "kernel wrote past " << count << " elements";
+    }
+};
+
+using KernelTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(BatchKernelTest, KernelTypes);
+
+
+
+/**
+ * @addtogroup T_SIMD_Dispatch
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *          DETECTION TESTS           *
+ *                                    *
+ **************************************/
+
+/** @test Verify that override names parse case-insensitively and unknown names are rejected. */
+TEST(Dispatch, ParseISA_AcceptsForceNames)
+{
+    EXPECT_EQ(ISA::Scalar, falcon::simd::parseISA("scalar"));
+    EXPECT_EQ(ISA::SSE42, falcon::simd::parseISA("SSE"));
+    EXPECT_EQ(ISA::SSE42, falcon::simd::parseISA("sse4.2"));
+    EXPECT_EQ(ISA::SSE42, falcon::simd::parseISA("AVX"));
+    EXPECT_EQ(ISA::AVX2, falcon::simd::parseISA("Avx2"));
+    EXPECT_EQ(ISA::AVX512, falcon::simd::parseISA("AVX512"));
+    EXPECT_EQ(ISA::AVX512, falcon::simd::parseISA("avx-512"));
+
+    EXPECT_FALSE(falcon::simd::parseISA(""));
+    EXPECT_FALSE(falcon::simd::parseISA("NEON"));
+    EXPECT_FALSE(falcon::simd::parseISA("AVX512-EXTENDED"));
+}
+
+
+/** @test Verify that an override can lower the detected tier but never raise it. */
+TEST(Dispatch, ResolveISA_OnlyLowersDetectedTier)
+{
+    EXPECT_EQ(ISA::AVX2, falcon::simd::resolveISA(ISA::AVX2, nullptr));
+    EXPECT_EQ(ISA::SSE42, falcon::simd::resolveISA(ISA::AVX512, "SSE"));
+    EXPECT_EQ(ISA::Scalar, falcon::simd::resolveISA(ISA::AVX2, "SCALAR"));
+    EXPECT_EQ(ISA::SSE42, falcon::simd::resolveISA(ISA::SSE42, "AVX512"));
+    EXPECT_EQ(ISA::AVX2, falcon::simd::resolveISA(ISA::AVX2, "bogus"));
+}
+
+
+/** @test Verify that the bound tier is compiled in and runnable on this machine. */
+TEST(Dispatch, BatchKernels_BindsRunnableCompiledTier)
+{
+    const ISA active = falcon::simd::activeISA();
+
+    EXPECT_LE(active, falcon::simd::detectISA());
+    ASSERT_NE(nullptr, falcon::simd::batchKernelsFor(active));
+    EXPECT_EQ(active, falcon::simd::batchKernels().isa);
+    EXPECT_EQ(&falcon::simd::batchKernels(), falcon::simd::batchKernelsFor(active));
+}
+
+
+/** @test Verify that the scalar tier is always compiled in and every table reports its own tier. */
+TEST(Dispatch, BatchKernelsFor_ReportsOwnTier)
+{
+    ASSERT_NE(nullptr, falcon::simd::batchKernelsFor(ISA::Scalar));
+
+    for (const ISA isa : { ISA::Scalar, ISA::SSE42, ISA::AVX2, ISA::AVX512 })
+    {
+        if (const falcon::simd::BatchKernels* kernels = falcon::simd::batchKernelsFor(isa))
+        {
+            EXPECT_EQ(isa, kernels->isa) << falcon::simd::toString(isa);
+        }
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *            KERNEL TESTS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every runnable tier matches scalar arithmetic for all counts, including tails. */
+TYPED_TEST(BatchKernelTest, StreamKernels_MatchScalarArithmetic)
+{
+    using T = TypeParam;
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = TestFixture::streams(*kernels);
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::fill(this->_out.begin(), this->_out.end(), T(-999));
+            const T* a = this->_a.data();
+            const T* b = this->_b.data();
+
+            ops.add(a, b, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(a[i] + b[i], this->_out[i]);
+            this->expectSentinel(count);
+
+            ops.subtract(a, b, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(a[i] - b[i], this->_out[i]);
+
+            ops.multiply(a, b, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(a[i] * b[i], this->_out[i]);
+
+            ops.divide(a, b, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(a[i] / b[i], this->_out[i]);
+
+            ops.scale(a, T(-2.5), this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(a[i] * T(-2.5), this->_out[i]);
+
+            ops.multiplyAdd(a, b, this->_c.data(), this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_NEAR(a[i] * b[i] + this->_c[i], this->_out[i], std::abs(a[i] * b[i]) * T(1e-6) + T(1e-6));
+            this->expectSentinel(count);
+        }
+    }
+}
+
+
+/** @test Verify that kernels accept unaligned pointers and an output aliasing an input. */
+TYPED_TEST(BatchKernelTest, StreamKernels_HandleUnalignedInPlace)
+{
+    using T = TypeParam;
+    constexpr std::size_t count = 37;
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+        std::vector<T> data(this->_a.begin(), this->_a.begin() + count + 1);
+
+        TestFixture::streams(*kernels).add(data.data() + 1, this->_b.data(), data.data() + 1, count);
+
+        EXPECT_EQ(this->_a[0], data[0]);
+        for (std::size_t i = 0; i < count; ++i)
+            EXPECT_EQ(this->_a[i + 1] + this->_b[i], data[i + 1]);
+    }
+}
+
+
+/** @test Verify that every runnable tier's vector kernels match scalar geometry for all counts, including tails. */
+TYPED_TEST(BatchKernelTest, Vec4Kernels_MatchScalarGeometry)
+{
+    using T = TypeParam;
+    const T tolerance = std::is_same_v<T, float> ? T(1e-5) : T(1e-12);
+    const auto near = [&](const T expected, const T actual)
+    { EXPECT_NEAR(expected, actual, tolerance * std::abs(expected) + tolerance); };
+
+    // Vector i of the first operand is (a, b, c, a) and of the second (c, a, b, b).
+    const falcon::simd::Vec4Streams<const T> lhs{ this->_a.data(), this->_b.data(), this->_c.data(), this->_a.data() };
+    const falcon::simd::Vec4Streams<const T> rhs{ this->_c.data(), this->_a.data(), this->_b.data(), this->_b.data() };
+    const auto dot = [](const std::size_t i, const falcon::simd::Vec4Streams<const T>& u,
+                        const falcon::simd::Vec4Streams<const T>& v)
+    { return u.x[i] * v.x[i] + u.y[i] * v.y[i] + u.z[i] * v.z[i] + u.w[i] * v.w[i]; };
+
+    std::vector<T> x(this->_out.size()), y(x.size()), z(x.size()), w(x.size());
+    const falcon::simd::Vec4Streams<T> out{ x.data(), y.data(), z.data(), w.data() };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().vec4;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::fill(this->_out.begin(), this->_out.end(), T(-999));
+
+            ops.dot(lhs, rhs, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                near(dot(i, lhs, rhs), this->_out[i]);
+            this->expectSentinel(count);
+
+            ops.mag(lhs, this->_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+                near(std::sqrt(dot(i, lhs, lhs)), this->_out[i]);
+            this->expectSentinel(count);
+
+            ops.normalize(lhs, falcon::simd::Precision::Exact, out, count);
+            for (std::size_t i = 0; i < count; ++i)
+                near(lhs.y[i] / std::sqrt(dot(i, lhs, lhs)), y[i]);
+
+            // A threshold between the smallest and largest squared magnitudes zeroes only part of each block.
+            const T thresholdSquared = T(64);
+            ops.safeNormalize(lhs, thresholdSquared, falcon::simd::Precision::Exact, out, count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const T lengthSquared = dot(i, lhs, lhs);
+                near(lengthSquared <= thresholdSquared ? T(0) : lhs.z[i] / std::sqrt(lengthSquared), z[i]);
+            }
+
+            ops.project(lhs, rhs, false, out, count);
+            for (std::size_t i = 0; i < count; ++i)
+                near(dot(i, lhs, rhs) / dot(i, rhs, rhs) * rhs.x[i], x[i]);
+
+            ops.reject(lhs, rhs, true, out, count);
+            for (std::size_t i = 0; i < count; ++i)
+                near(lhs.w[i] - dot(i, lhs, rhs) * rhs.w[i], w[i]);
+        }
+    }
+}
+
+
+/** @test Verify that every runnable tier normalizes within the documented error of each precision tier. */
+TYPED_TEST(BatchKernelTest, Vec4Kernels_NormalizeWithinDocumentedUlpError)
+{
+    using T = TypeParam;
+    using falcon::simd::Precision;
+    using Wide = long double;
+    constexpr std::size_t count = 100;
+
+    const falcon::simd::Vec4Streams<const T> src{ this->_a.data(), this->_b.data(), this->_c.data(), this->_a.data() };
+    std::vector<T> x(count), y(count), z(count), w(count);
+    const falcon::simd::Vec4Streams<T> out{ x.data(), y.data(), z.data(), w.data() };
+
+    const auto ulpError = [](const Wide expected, const T actual)
+    {
+        const T rounded = std::abs(static_cast<T>(expected));
+        const Wide ulp = Wide(std::nextafter(rounded, std::numeric_limits<T>::infinity())) - rounded;
+        return std::abs(Wide(actual) - expected) / ulp;
+    };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().vec4;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const Precision precision : { Precision::Fast, Precision::Refined, Precision::Exact })
+        {
+            SCOPED_TRACE(static_cast<int>(precision));
+            ops.normalize(src, precision, out, count);
+
+            Wide worst = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Wide magnitude = std::sqrt(Wide(src.x[i]) * src.x[i] + Wide(src.y[i]) * src.y[i] +
+                                                 Wide(src.z[i]) * src.z[i] + Wide(src.w[i]) * src.w[i]);
+                worst = std::max({ worst, ulpError(src.x[i] / magnitude, x[i]), ulpError(src.y[i] / magnitude, y[i]),
+                                   ulpError(src.z[i] / magnitude, z[i]), ulpError(src.w[i] / magnitude, w[i]) });
+            }
+            EXPECT_LE(worst, Wide(falcon::simd::maxUlpError<T>(precision)));
+        }
+    }
+}
+
+
+/** @test Verify that every runnable tier normalizes exactly as @ref fgm::Vector4D does, bit for bit. */
+TYPED_TEST(BatchKernelTest, Vec4Kernels_ExactNormalizeMatchesVector4D)
+{
+    using T = TypeParam;
+    std::vector<fgm::Vector4D<T>> vectors = testutils::scatteredVectors<T>(99);
+    vectors[5] = fgm::Vector4D<T>{}; // Zeroed by safeNormalize
+
+    std::vector<T> sx, sy, sz, sw;
+    for (const fgm::Vector4D<T>& vec : vectors)
+    {
+        sx.push_back(vec.x);
+        sy.push_back(vec.y);
+        sz.push_back(vec.z);
+        sw.push_back(vec.w);
+    }
+    const falcon::simd::Vec4Streams<const T> src{ sx.data(), sy.data(), sz.data(), sw.data() };
+    std::vector<T> x(vectors.size()), y(x.size()), z(x.size()), w(x.size());
+    const falcon::simd::Vec4Streams<T> out{ x.data(), y.data(), z.data(), w.data() };
+
+    const auto expectBitwise = [&](const std::size_t i, const fgm::Vector4D<T>& expected)
+    {
+        EXPECT_EQ(expected.x, x[i]) << i;
+        EXPECT_EQ(expected.y, y[i]) << i;
+        EXPECT_EQ(expected.z, z[i]) << i;
+        EXPECT_EQ(expected.w, w[i]) << i;
+    };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().vec4;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        ops.normalize(src, falcon::simd::Precision::Exact, out, vectors.size());
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            if (i != 5)
+                expectBitwise(i, vectors[i].normalize());
+        }
+
+        ops.safeNormalize(src, fgm::Config::EPSILON_SQUARE<T>, falcon::simd::Precision::Exact, out, vectors.size());
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+            expectBitwise(i, vectors[i].safeNormalize());
+    }
+}
+
+
+/** @test Verify that packed vectors survive a deinterleave and interleave round trip on every runnable tier. */
+TYPED_TEST(BatchKernelTest, Vec4Kernels_InterleaveRoundTrips)
+{
+    using T = TypeParam;
+    constexpr std::size_t maxVectors = 25;
+
+    std::vector<T> packed(4 * maxVectors);
+    for (std::size_t i = 0; i < packed.size(); ++i)
+        packed[i] = static_cast<T>(i) - T(0.5);
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().vec4;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (std::size_t count = 0; count <= maxVectors; ++count)
+        {
+            SCOPED_TRACE(count);
+            std::vector<T> x(count), y(count), z(count), w(count);
+            std::vector<T> repacked(4 * count + 1, T(-999));
+
+            ops.deinterleave(packed.data(), { x.data(), y.data(), z.data(), w.data() }, count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(packed[4 * i], x[i]);
+                EXPECT_EQ(packed[4 * i + 3], w[i]);
+            }
+
+            ops.interleave({ x.data(), y.data(), z.data(), w.data() }, repacked.data(), count);
+            for (std::size_t i = 0; i < 4 * count; ++i)
+                EXPECT_EQ(packed[i], repacked[i]);
+            EXPECT_EQ(T(-999), repacked[4 * count]) << "interleave wrote past " << count << " vectors";
+        }
+    }
+}
+
+
+/** @test Verify that the equality kernel packs one bit per vector on every runnable tier and clears unused bits. */
+TYPED_TEST(BatchKernelTest, Vec4Kernels_EqualPacksMatchingVectors)
+{
+    using T = TypeParam;
+    constexpr std::size_t maxVectors = 100;
+    constexpr T epsilon = T(0.25); // Exact in binary, so the boundary case lands on the tolerance
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    // Vector i of lhs differs from rhs in one component according to i % 6.
+    std::vector<T> x(this->_a), y(this->_b), z(this->_c), w(maxVectors, inf);
+    std::vector<T> lx(x), ly(y), lz(z), lw(w);
+    const auto expectedEqual = [](const std::size_t i) { return i % 6 < 3; };
+    for (std::size_t i = 0; i < maxVectors; ++i)
+    {
+        switch (i % 6)
+        {
+            case 1: // Within tolerance
+                lx[i] += epsilon / T(2);
+                break;
+            case 2: // On the tolerance
+                lz[i] -= epsilon;
+                break;
+            case 3: // Beyond tolerance
+                ly[i] += epsilon * T(4);
+                break;
+            case 4: // Opposite infinities
+                lw[i] = -inf;
+                break;
+            case 5: // NaN never matches, even itself
+                lx[i] = x[i] = std::numeric_limits<T>::quiet_NaN();
+                break;
+            default: // Identical, including the infinite w
+                break;
+        }
+    }
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().vec4;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::vector<std::uint64_t> bits((count + 63) / 64, ~std::uint64_t(0));
+            ops.equal({ lx.data(), ly.data(), lz.data(), lw.data() }, { x.data(), y.data(), z.data(), w.data() },
+                      epsilon, bits.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+                EXPECT_EQ(expectedEqual(i), ((bits[i / 64] >> (i % 64)) & 1u) != 0) << "vector " << i;
+            if (count % 64 != 0)
+            {
+                EXPECT_EQ(0u, bits.back() >> (count % 64)) << "bits past count must be cleared";
+            }
+        }
+    }
+}
+
+
+/** @test Verify that every runnable tier interpolates quaternions along the shorter arc like the scalar formulas. */
+TYPED_TEST(BatchKernelTest, QuatKernels_MatchScalarInterpolation)
+{
+    using T = TypeParam;
+    using Wide = long double;
+    constexpr std::size_t count = 41;
+
+    // Unit quaternion pairs from angles spread over the sphere; every third pair lies in opposite hemispheres and
+    // every fifth is nearly identical.
+    std::vector<T> fx(count), fy(count), fz(count), fw(count), tx(count), ty(count), tz(count), tw(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Wide a = Wide(i) * 0.7L, b = Wide(i) * 1.3L + 0.4L;
+        const Wide sign = i % 3 == 0 ? -1 : 1;
+        fx[i] = T(std::sin(a) * std::cos(b)), fy[i] = T(std::sin(a) * std::sin(b));
+        fz[i] = T(std::cos(a) * std::sin(b)), fw[i] = T(std::cos(a) * std::cos(b));
+        const Wide c = i % 5 == 0 ? a + 1e-4L : a * 1.1L + 0.9L, d = i % 5 == 0 ? b : b * 0.8L - 0.3L;
+        tx[i] = T(sign * std::sin(c) * std::cos(d)), ty[i] = T(sign * std::sin(c) * std::sin(d));
+        tz[i] = T(sign * std::cos(c) * std::sin(d)), tw[i] = T(sign * std::cos(c) * std::cos(d));
+    }
+    const falcon::simd::Vec4Streams<const T> from{ fx.data(), fy.data(), fz.data(), fw.data() };
+    const falcon::simd::Vec4Streams<const T> to{ tx.data(), ty.data(), tz.data(), tw.data() };
+
+    std::vector<T> x(count), y(count), z(count), w(count);
+    const falcon::simd::Vec4Streams<T> out{ x.data(), y.data(), z.data(), w.data() };
+
+    // Reference interpolation of pair i in extended precision, normalized for nlerp.
+    const auto expected = [&](const std::size_t i, const Wide t, const bool spherical)
+    {
+        const Wide p[] = { fx[i], fy[i], fz[i], fw[i] };
+        Wide q[] = { tx[i], ty[i], tz[i], tw[i] };
+        Wide cosine = p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3];
+        if (cosine < 0)
+        {
+            cosine = -cosine;
+            for (Wide& c : q)
+                c = -c;
+        }
+
+        Wide wp = 1 - t, wq = t;
+        if (spherical && cosine < 1)
+        {
+            const Wide angle = std::acos(std::min(cosine, Wide(1)));
+            wp = std::sin((1 - t) * angle) / std::sin(angle);
+            wq = std::sin(t * angle) / std::sin(angle);
+        }
+
+        std::vector<Wide> result(4);
+        Wide lengthSquared = 0;
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            result[c] = wp * p[c] + wq * q[c];
+            lengthSquared += result[c] * result[c];
+        }
+        if (!spherical)
+            for (Wide& c : result)
+                c /= std::sqrt(lengthSquared);
+        return result;
+    };
+
+    const T tolerance = T(8) * std::numeric_limits<T>::epsilon();
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().quat;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const bool spherical : { false, true })
+        {
+            for (const T t : { T(0), T(0.2), T(0.5), T(0.65), T(1) })
+            {
+                SCOPED_TRACE(::testing::Message() << (spherical ? "slerp" : "nlerp") << " t = " << t);
+                (spherical ? ops.slerp : ops.nlerp)(from, to, t, out, count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::vector<Wide> reference = expected(i, t, spherical);
+                    EXPECT_NEAR(reference[0], x[i], tolerance) << "pair " << i;
+                    EXPECT_NEAR(reference[1], y[i], tolerance) << "pair " << i;
+                    EXPECT_NEAR(reference[2], z[i], tolerance) << "pair " << i;
+                    EXPECT_NEAR(reference[3], w[i], tolerance) << "pair " << i;
+                }
+            }
+        }
+    }
+}
+
+
+/** @test Verify that every runnable tier reduces streams and vectors like a scalar loop, for every tail length. */
+TYPED_TEST(BatchKernelTest, ReduceKernels_MatchScalarLoops)
+{
+    using T = TypeParam;
+    using falcon::simd::Summation;
+    using Wide = long double;
+    const Wide tolerance = std::is_same_v<T, float> ? 1e-5L : 1e-13L;
+
+    // Vector i is (a, b, c, a); the point sits inside the cloud so both extremes move while scanning.
+    const falcon::simd::Vec4Streams<const T> src{ this->_a.data(), this->_b.data(), this->_c.data(), this->_a.data() };
+    const T point[] = { T(1), T(4), T(-2), T(1) };
+    const auto squaredDistance = [&](const std::size_t i)
+    {
+        const Wide d[] = { Wide(src.x[i]) - point[0], Wide(src.y[i]) - point[1], Wide(src.z[i]) - point[2],
+                           Wide(src.w[i]) - point[3] };
+        return d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3];
+    };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().reduce;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            Wide sum = 0, sumDot = 0, sumMag = 0;
+            T low = std::numeric_limits<T>::infinity(), high = -low;
+            std::size_t nearest = count, farthest = count;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Wide lengthSquared = Wide(src.x[i]) * src.x[i] + Wide(src.y[i]) * src.y[i] +
+                    Wide(src.z[i]) * src.z[i] + Wide(src.w[i]) * src.w[i];
+                sum += this->_c[i];
+                sumDot += lengthSquared;
+                sumMag += std::sqrt(lengthSquared);
+                low = std::min(low, this->_c[i]);
+                high = std::max(high, this->_c[i]);
+                if (nearest == count || squaredDistance(i) < squaredDistance(nearest))
+                    nearest = i;
+                if (farthest == count || squaredDistance(i) > squaredDistance(farthest))
+                    farthest = i;
+            }
+
+            for (const Summation summation : { Summation::Plain, Summation::Pairwise, Summation::Compensated })
+            {
+                EXPECT_NEAR(sum, ops.sum(this->_c.data(), summation, count), tolerance * (std::abs(sum) + 1));
+                EXPECT_NEAR(sumDot, ops.sumDot(src, src, summation, count), tolerance * (sumDot + 1));
+                EXPECT_NEAR(sumMag, ops.sumMag(src, summation, count), tolerance * (sumMag + 1));
+            }
+
+            T min = 0, max = 0;
+            ops.minMax(this->_c.data(), &min, &max, count);
+            EXPECT_EQ(low, min);
+            EXPECT_EQ(high, max);
+
+            std::size_t foundNearest = 0, foundFarthest = 0;
+            ops.extremeDistances(src, point, &foundNearest, &foundFarthest, count);
+            EXPECT_EQ(nearest, foundNearest);
+            EXPECT_EQ(farthest, foundFarthest);
+        }
+    }
+}
+
+
+/** @test Verify that min and max skip NaN in every lane position and that sums ignore lanes past the count. */
+TYPED_TEST(BatchKernelTest, ReduceKernels_SkipNaNAndIgnoreTail)
+{
+    using T = TypeParam;
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().reduce;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (std::size_t position = 0; position < 33; ++position)
+        {
+            std::vector<T> values(33, T(2));
+            values[position] = nan;
+            values[(position + 7) % values.size()] = T(-5);
+            T min = 0, max = 0;
+            ops.minMax(values.data(), &min, &max, values.size());
+            EXPECT_EQ(T(-5), min) << "NaN at " << position;
+            EXPECT_EQ(T(2), max) << "NaN at " << position;
+        }
+
+        // Elements past the count are poison; the masked tail must not read them into the sum.
+        const std::vector<T> poisoned = { T(1), T(2), T(3), nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan };
+        EXPECT_EQ(T(6), ops.sum(poisoned.data(), falcon::simd::Summation::Plain, 3));
+        EXPECT_EQ(T(6), ops.sum(poisoned.data(), falcon::simd::Summation::Compensated, 3));
+    }
+}
+
+
+/**
+ * @test Verify that every runnable tier keeps exactly the volumes the scalar plane tests keep, NaN volumes
+ *       included.
+ */
+TYPED_TEST(BatchKernelTest, CullKernels_MatchScalarPlaneTests)
+{
+    using T = TypeParam;
+    constexpr std::size_t maxVolumes = 100;
+
+    // The unit cube around the origin, as six inward facing planes {a, b, c, d}.
+    const T planes[] = { 1, 0, 0, 1, -1, 0, 0, 1, 0, 1, 0, 1, 0, -1, 0, 1, 0, 0, 1, 1, 0, 0, -1, 1 };
+
+    // Centers spread from -7 to 7 along x and reach 0.25 to 2.25, so volumes land inside, straddling and outside.
+    std::vector<T> x(this->_a), y(this->_c), z(maxVolumes, T(0.5)), reach(maxVolumes);
+    for (std::size_t i = 0; i < maxVolumes; ++i)
+    {
+        y[i] = y[i] * T(0.25);
+        reach[i] = static_cast<T>(i % 5) * T(0.5) + T(0.25);
+    }
+    x[11] = std::numeric_limits<T>::quiet_NaN();
+
+    std::vector<T> lowX(maxVolumes), lowY(maxVolumes), lowZ(maxVolumes), highX(maxVolumes), highY(maxVolumes),
+        highZ(maxVolumes);
+    for (std::size_t i = 0; i < maxVolumes; ++i)
+    {
+        lowX[i] = x[i] - reach[i], highX[i] = x[i] + reach[i];
+        lowY[i] = y[i] - reach[i] * T(0.5), highY[i] = y[i] + reach[i] * T(0.5);
+        lowZ[i] = z[i] - reach[i], highZ[i] = z[i] + reach[i];
+    }
+
+    // A volume is culled only when it lies entirely outside one plane; comparisons with NaN never cull.
+    const auto sphereKept = [&](const std::size_t i)
+    {
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+            const T* plane = planes + 4 * p;
+            if (plane[0] * x[i] + plane[1] * y[i] + plane[2] * z[i] + plane[3] + reach[i] < T(0))
+                return false;
+        }
+        return true;
+    };
+    const auto boxKept = [&](const std::size_t i)
+    {
+        // The axis planes cull a box exactly when its span misses the cube along that axis.
+        return !(highX[i] < T(-1) || lowX[i] > T(1) || highY[i] < T(-1) || lowY[i] > T(1) || highZ[i] < T(-1) ||
+                 lowZ[i] > T(1));
+    };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().cull;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::vector<std::uint64_t> spheres((count + 63) / 64, ~std::uint64_t(0));
+            std::vector<std::uint64_t> boxes((count + 63) / 64, ~std::uint64_t(0));
+            std::vector<std::uint64_t> unbounded((count + 63) / 64, 0);
+            ops.spheres({ x.data(), y.data(), z.data(), reach.data() }, planes, 6, spheres.data(), count);
+            ops.boxes({ lowX.data(), lowY.data(), lowZ.data(), lowZ.data() },
+                      { highX.data(), highY.data(), highZ.data(), highZ.data() }, planes, 6, boxes.data(), count);
+            ops.spheres({ x.data(), y.data(), z.data(), reach.data() }, planes, 0, unbounded.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(sphereKept(i), ((spheres[i / 64] >> (i % 64)) & 1u) != 0) << "sphere " << i;
+                EXPECT_EQ(boxKept(i), ((boxes[i / 64] >> (i % 64)) & 1u) != 0) << "box " << i;
+                EXPECT_NE(0u, (unbounded[i / 64] >> (i % 64)) & 1u) << "no planes must keep volume " << i;
+            }
+            if (count % 64 != 0)
+            {
+                EXPECT_EQ(0u, spheres.back() >> (count % 64)) << "bits past count must be cleared";
+                EXPECT_EQ(0u, boxes.back() >> (count % 64)) << "bits past count must be cleared";
+            }
+        }
+    }
+}
+
+
+/** @test Verify that every runnable tier finds the hits and distances of rays cast straight down at each primitive. */
+TYPED_TEST(BatchKernelTest, RayKernels_HitPrimitivesBelowTheRays)
+{
+    using T = TypeParam;
+    constexpr std::size_t maxRays = 100;
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+    // Rays start at z = 5 on a grid from -7 to 7 along x and look down -z; every fourth accepts hits up to 4.5 only.
+    std::vector<T> x(this->_a), y(this->_c), z(maxRays, T(5)), zero(maxRays, T(0)), down(maxRays, T(-1));
+    std::vector<T> farthest(maxRays, T(10));
+    for (std::size_t i = 0; i < maxRays; ++i)
+    {
+        y[i] = y[i] * T(0.25);
+        if (i % 4 == 0)
+            farthest[i] = T(4.5);
+    }
+    x[11] = nan;
+
+    // The triangle (0, 0, 0), (2, 0, 0), (0, 2, 0), a box around the origin whose sides no ray lies in, and the unit
+    // sphere around the origin.
+    constexpr T side = T(1.2);
+    const T triangle[] = { 0, 0, 0, 2, 0, 0, 0, 2, 0 };
+    const T box[] = { -side, -side, -1, side, side, 1 };
+    const T sphere[] = { 0, 0, 0, 1 };
+
+    const auto triangleHit = [&](const std::size_t i)
+    { return x[i] >= T(0) && y[i] >= T(0) && x[i] + y[i] <= T(2) && farthest[i] >= T(5); };
+    // A NaN origin component drops its slab from the test, so ray 11 hits whatever its y and z allow.
+    const auto boxHit = [&](const std::size_t i)
+    { return (std::isnan(x[i]) || std::abs(x[i]) <= side) && std::abs(y[i]) <= side; };
+    const auto sphereHit = [&](const std::size_t i)
+    { return x[i] * x[i] + y[i] * y[i] <= T(1) && T(5) - std::sqrt(T(1) - x[i] * x[i] - y[i] * y[i]) <= farthest[i]; };
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        const auto& ops = kernels->get<T>().ray;
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            const falcon::simd::Vec4Streams<const T> origins = { x.data(), y.data(), z.data(), zero.data() };
+            const falcon::simd::Vec4Streams<const T> directions = { zero.data(), zero.data(), down.data(),
+                                                                    zero.data() };
+
+            std::vector<T> triangleDistances(farthest), boxDistances(farthest), sphereDistances(farthest);
+            std::vector<std::uint64_t> triangleHits((count + 63) / 64, ~std::uint64_t(0));
+            std::vector<std::uint64_t> boxHits(triangleHits), sphereHits(triangleHits);
+            ops.triangle(origins, directions, triangle, triangleDistances.data(), triangleHits.data(), count);
+            ops.box(origins, directions, box, boxDistances.data(), boxHits.data(), count);
+            ops.sphere(origins, directions, sphere, sphereDistances.data(), sphereHits.data(), count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const bool hitsTriangle = ((triangleHits[i / 64] >> (i % 64)) & 1u) != 0;
+                const bool hitsBox = ((boxHits[i / 64] >> (i % 64)) & 1u) != 0;
+                const bool hitsSphere = ((sphereHits[i / 64] >> (i % 64)) & 1u) != 0;
+                EXPECT_EQ(triangleHit(i), hitsTriangle) << "triangle, ray " << i;
+                EXPECT_EQ(boxHit(i), hitsBox) << "box, ray " << i;
+                EXPECT_EQ(sphereHit(i), hitsSphere) << "sphere, ray " << i;
+
+                // Hits write their distance, misses leave the farthest accepted one.
+                EXPECT_EQ(hitsTriangle ? T(5) : farthest[i], triangleDistances[i]) << "triangle, ray " << i;
+                EXPECT_EQ(hitsBox ? T(4) : farthest[i], boxDistances[i]) << "box, ray " << i;
+                if (hitsSphere)
+                    EXPECT_NEAR(T(5) - std::sqrt(T(1) - x[i] * x[i] - y[i] * y[i]), sphereDistances[i], T(1e-5));
+                else
+                    EXPECT_EQ(farthest[i], sphereDistances[i]) << "sphere, ray " << i;
+            }
+            for (std::size_t i = count; i < maxRays; ++i)
+                EXPECT_EQ(farthest[i], boxDistances[i]) << "kernel wrote past " << count << " rays";
+            if (count % 64 != 0)
+            {
+                EXPECT_EQ(0u, triangleHits.back() >> (count % 64)) << "bits past count must be cleared";
+                EXPECT_EQ(0u, boxHits.back() >> (count % 64)) << "bits past count must be cleared";
+                EXPECT_EQ(0u, sphereHits.back() >> (count % 64)) << "bits past count must be cleared";
+            }
+        }
+    }
+}
+
+
+
+/** @test Verify that every runnable tier converts to and from half precision with the bits of the scalar conversion. */
+TEST(Dispatch, HalfKernels_MatchScalarConversion)
+{
+    // Every half pattern, and floats spread over every exponent, both signs, NaN payloads and the rounding ties.
+    std::vector<std::uint16_t> halves(std::size_t(1) << 16);
+    for (std::size_t i = 0; i < halves.size(); ++i)
+        halves[i] = static_cast<std::uint16_t>(i);
+
+    std::vector<float> floats;
+    for (std::uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 65521)
+        floats.push_back(std::bit_cast<float>(static_cast<std::uint32_t>(bits)));
+    for (const std::uint16_t h : halves)
+    {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(falcon::simd::halfToFloat(h));
+        floats.push_back(std::bit_cast<float>(bits + 0x1000u)); // Halfway to the next half, for normal halves
+        floats.push_back(std::bit_cast<float>(bits + 0x0FFFu));
+    }
+
+    for (const falcon::simd::BatchKernels* kernels : runnableKernels())
+    {
+        SCOPED_TRACE(falcon::simd::toString(kernels->isa));
+
+        std::vector<float> widened(halves.size());
+        kernels->half.toFloat(halves.data(), widened.data(), halves.size());
+        for (std::size_t i = 0; i < halves.size(); ++i)
+            ASSERT_EQ(std::bit_cast<std::uint32_t>(falcon::simd::halfToFloat(halves[i])),
+                      std::bit_cast<std::uint32_t>(widened[i]))
+                << "half 0x" << std::hex << halves[i];
+
+        std::vector<std::uint16_t> rounded(floats.size());
+        kernels->half.toHalf(floats.data(), rounded.data(), floats.size());
+        for (std::size_t i = 0; i < floats.size(); ++i)
+            ASSERT_EQ(falcon::simd::floatToHalf(floats[i]), rounded[i])
+                << "float 0x" << std::hex << std::bit_cast<std::uint32_t>(floats[i]);
+
+        // Tails stop at count, from unaligned starts.
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::vector<float> wide(count + 2, -999.0f);
+            std::vector<std::uint16_t> narrow(count + 2, 0xABCD);
+            kernels->half.toFloat(halves.data() + 0x3C01, wide.data() + 1, count);
+            kernels->half.toHalf(floats.data() + 3, narrow.data() + 1, count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(falcon::simd::halfToFloat(halves[0x3C01 + i]), wide[i + 1]);
+                EXPECT_EQ(falcon::simd::floatToHalf(floats[3 + i]), narrow[i + 1]);
+            }
+            EXPECT_EQ(-999.0f, wide.front());
+            EXPECT_EQ(-999.0f, wide.back()) << "kernel wrote past " << count << " elements";
+            EXPECT_EQ(0xABCD, narrow.front());
+            EXPECT_EQ(0xABCD, narrow.back()) << "kernel wrote past " << count << " elements";
+        }
+    }
+}
+
+
+
+/** @test Verify that every runnable tier quantizes to the integers of the scalar reference, and decodes as it does. */
+TEST(Dispatch, QuantizeKernels_MatchScalarQuantization)
+{
+    using namespace falcon::simd;
+
+    // Values across and beyond [-1, 1], with the quantization ties, signed zeros and non-finite values.
+    std::vector<float> values;
+    for (int i = -1100; i <= 1100; ++i)
+        values.push_back(static_cast<float>(i) * 0.001f);
+    for (int q = -128; q <= 128; ++q)
+        for (const float scale : { 127.0f, 255.0f, 511.0f, 1023.0f })
+            values.push_back((static_cast<float>(q) + 0.5f) / scale);
+    values.insert(values.end(), { -0.0f, std::numeric_limits<float>::quiet_NaN(),
+                                  std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() });
+    const std::size_t vectorCount = values.size() / 4, normalCount = values.size() / 3;
+
+    std::vector<std::uint32_t> packedCodes;
+    for (std::uint32_t i = 0; i < 4096; ++i)
+        packedCodes.push_back(i * 0x9E3779B9u);
+    std::vector<std::int16_t> octahedralCodes;
+    for (int i = -32768; i <= 32767; i += 97)
+        octahedralCodes.push_back(static_cast<std::int16_t>(i));
+
+    for (const BatchKernels* kernels : runnableKernels())
+    {
+        SCOPED_TRACE(toString(kernels->isa));
+        const QuantizeKernels& quantize = kernels->quantize;
+
+        std::vector<std::int8_t> snorm8(values.size());
+        std::vector<std::int16_t> snorm16(values.size());
+        std::vector<std::uint8_t> unorm8(values.size());
+        std::vector<std::uint16_t> unorm16(values.size());
+        quantize.toSnorm8(values.data(), snorm8.data(), values.size());
+        quantize.toSnorm16(values.data(), snorm16.data(), values.size());
+        quantize.toUnorm8(values.data(), unorm8.data(), values.size());
+        quantize.toUnorm16(values.data(), unorm16.data(), values.size());
+
+        std::vector<float> decoded(4 * values.size());
+        quantize.fromSnorm8(snorm8.data(), decoded.data(), values.size());
+        quantize.fromSnorm16(snorm16.data(), decoded.data() + values.size(), values.size());
+        quantize.fromUnorm8(unorm8.data(), decoded.data() + 2 * values.size(), values.size());
+        quantize.fromUnorm16(unorm16.data(), decoded.data() + 3 * values.size(), values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            ASSERT_EQ(quantizeSnorm(values[i], 127.0f), snorm8[i]) << values[i];
+            ASSERT_EQ(quantizeSnorm(values[i], 32767.0f), snorm16[i]) << values[i];
+            ASSERT_EQ(quantizeUnorm(values[i], 255.0f), unorm8[i]) << values[i];
+            ASSERT_EQ(quantizeUnorm(values[i], 65535.0f), unorm16[i]) << values[i];
+            ASSERT_EQ(dequantizeSnorm(snorm8[i], 127.0f), decoded[i]);
+            ASSERT_EQ(dequantizeSnorm(snorm16[i], 32767.0f), decoded[values.size() + i]);
+            ASSERT_EQ(dequantizeUnorm(unorm8[i], 255.0f), decoded[2 * values.size() + i]);
+            ASSERT_EQ(dequantizeUnorm(unorm16[i], 65535.0f), decoded[3 * values.size() + i]);
+        }
+
+        // 10:10:10:2, both ways, against packing the scalar fields.
+        std::vector<std::uint32_t> snormPacked(vectorCount), unormPacked(vectorCount);
+        quantize.toSnorm1010102(values.data(), snormPacked.data(), vectorCount);
+        quantize.toUnorm1010102(values.data(), unormPacked.data(), vectorCount);
+        for (std::size_t i = 0; i < vectorCount; ++i)
+        {
+            const float* v = values.data() + 4 * i;
+            ASSERT_EQ(pack1010102(quantizeSnorm(v[0], 511.0f), quantizeSnorm(v[1], 511.0f),
+                                  quantizeSnorm(v[2], 511.0f), quantizeSnorm(v[3], 1.0f)),
+                      snormPacked[i])
+                << "vector " << i;
+            ASSERT_EQ(pack1010102(quantizeUnorm(v[0], 1023.0f), quantizeUnorm(v[1], 1023.0f),
+                                  quantizeUnorm(v[2], 1023.0f), quantizeUnorm(v[3], 3.0f)),
+                      unormPacked[i])
+                << "vector " << i;
+        }
+
+        std::vector<float> snormFields(4 * packedCodes.size()), unormFields(4 * packedCodes.size());
+        quantize.fromSnorm1010102(packedCodes.data(), snormFields.data(), packedCodes.size());
+        quantize.fromUnorm1010102(packedCodes.data(), unormFields.data(), packedCodes.size());
+        for (std::size_t i = 0; i < packedCodes.size(); ++i)
+        {
+            const auto signedFields = unpackSigned1010102(packedCodes[i]);
+            const auto unsignedFields = unpackUnsigned1010102(packedCodes[i]);
+            for (std::size_t c = 0; c < 4; ++c)
+            {
+                ASSERT_EQ(dequantizeSnorm(signedFields[c], c == 3 ? 1.0f : 511.0f), snormFields[4 * i + c]);
+                ASSERT_EQ(dequantizeUnorm(unsignedFields[c], c == 3 ? 3.0f : 1023.0f), unormFields[4 * i + c]);
+            }
+        }
+
+        // Octahedral: exact encoding; decoding only normalizes differently where multiply-adds are fused.
+        std::vector<std::int16_t> pairs(2 * normalCount);
+        quantize.toOctahedral(values.data(), pairs.data(), normalCount);
+        for (std::size_t i = 0; i < normalCount; ++i)
+        {
+            float u = 0.0f, v = 0.0f;
+            toOctahedral(values[3 * i], values[3 * i + 1], values[3 * i + 2], u, v);
+            ASSERT_EQ(quantizeSnorm(u, 32767.0f), pairs[2 * i]) << "vector " << i;
+            ASSERT_EQ(quantizeSnorm(v, 32767.0f), pairs[2 * i + 1]) << "vector " << i;
+        }
+
+        const std::size_t pairCount = octahedralCodes.size() / 2;
+        std::vector<float> normals(3 * pairCount);
+        quantize.fromOctahedral(octahedralCodes.data(), normals.data(), pairCount);
+        for (std::size_t i = 0; i < pairCount; ++i)
+        {
+            float expected[3];
+            fromOctahedral(dequantizeSnorm(octahedralCodes[2 * i], 32767.0f),
+                           dequantizeSnorm(octahedralCodes[2 * i + 1], 32767.0f), expected[0], expected[1],
+                           expected[2]);
+            for (std::size_t c = 0; c < 3; ++c)
+                ASSERT_NEAR(expected[c], normals[3 * i + c], 2e-7f) << "pair " << i;
+        }
+
+        // Tails stop at count, from unaligned starts.
+        for (const std::size_t count : kernelCounts)
+        {
+            SCOPED_TRACE(count);
+            std::vector<std::int8_t> narrow(count + 2, 99);
+            std::vector<std::uint32_t> packed(count + 2, 0xABCDu);
+            std::vector<std::int16_t> octahedral(2 * count + 2, 99);
+            std::vector<float> wide(4 * count + 2, -999.0f), normalsOut(3 * count + 2, -999.0f);
+            quantize.toSnorm8(values.data() + 3, narrow.data() + 1, count);
+            quantize.toUnorm1010102(values.data() + 3, packed.data() + 1, count);
+            quantize.toOctahedral(values.data() + 3, octahedral.data() + 1, count);
+            quantize.fromUnorm1010102(packedCodes.data() + 1, wide.data() + 1, count);
+            quantize.fromOctahedral(octahedralCodes.data() + 1, normalsOut.data() + 1, count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(quantizeSnorm(values[3 + i], 127.0f), narrow[i + 1]);
+                const float* v = values.data() + 3 + 4 * i;
+                EXPECT_EQ(pack1010102(quantizeUnorm(v[0], 1023.0f), quantizeUnorm(v[1], 1023.0f),
+                                      quantizeUnorm(v[2], 1023.0f), quantizeUnorm(v[3], 3.0f)),
+                          packed[i + 1]);
+                EXPECT_EQ(dequantizeUnorm(unpackUnsigned1010102(packedCodes[1 + i])[3], 3.0f), wide[4 * i + 4]);
+            }
+            EXPECT_EQ(99, narrow.front());
+            EXPECT_EQ(99, narrow.back()) << "kernel wrote past " << count << " elements";
+            EXPECT_EQ(0xABCDu, packed.front());
+            EXPECT_EQ(0xABCDu, packed.back()) << "kernel wrote past " << count << " elements";
+            EXPECT_EQ(99, octahedral.front());
+            EXPECT_EQ(99, octahedral.back()) << "kernel wrote past " << count << " elements";
+            EXPECT_EQ(-999.0f, wide.front());
+            EXPECT_EQ(-999.0f, wide.back()) << "kernel wrote past " << count << " elements";
+            EXPECT_EQ(-999.0f, normalsOut.front());
+            EXPECT_EQ(-999.0f, normalsOut.back()) << "kernel wrote past " << count << " elements";
+        }
+    }
+}
+/** @} */
@@ -1,96 +1,253 @@
-// #include <SIMD.h>
-// #include <gtest/gtest.h>
-//
-// struct ScalarBackend
-//{
-// };
-// struct SSEBackend
-//{
-// };
-// struct AVXBackend
-//{
-// };
-// struct AVX2Backend
-//{
-// };
-// struct AVX512Backend
-//{
-// };
-//
-//// 2. A mock version of what your SIMD.h wrapper functions might look like.
-//// You specialize these templates so the test can call them uniformly.
-// template <typename Backend>
-// void SimdSetZero(float* out);
-// template <typename Backend>
-// void SimdBroadcast(float* out, float val);
-//
-//// --- SCALAR IMPLEMENTATIONS ---
-// template <>
-// void SimdSetZero<ScalarBackend>(float* out)
-//{
-//     for (int i = 0; i < 8; ++i)
-//         out[i] = 0.0f;
-// }
-// template <>
-// void SimdBroadcast<ScalarBackend>(float* out, float val)
-//{
-//     for (int i = 0; i < 8; ++i)
-//         out[i] = val;
-// }
-//
-//// --- AVX2 IMPLEMENTATIONS ---
-// template <>
-// void SimdSetZero<AVX2Backend>(float* out)
-//{
-//     __m256 vec = _mm256_setzero_ps();
-//     _mm256_storeu_ps(out, vec); // storeu = unaligned store (safe for testing)
-// }
-// template <>
-// void SimdBroadcast<AVX2Backend>(float* out, float val)
-//{
-//     __m256 vec = _mm256_set1_ps(val);
-//     _mm256_storeu_ps(out, vec);
-// }
-//
-//// 3. The Test Fixture
-// template <typename BackendType>
-// class SimdInitTest: public ::testing::Test
-//{
-//     protected:
-//     // 32-byte aligned array to hold 8 floats safely
-//     alignas(32) float data[8];
-//
-//     void SetUp() override
-//     {
-//         // Fill with garbage data before each test to ensure our SIMD actually overwrites it
-//         for (int i = 0; i < 8; ++i)
-//             data[i] = -999.0f;
-//     }
-// };
-//
-//// 4. Register the types you want to test
-// using SimdBackends = ::testing::Types<ScalarBackend, AVX2Backend>;
-// TYPED_TEST_SUITE(SimdInitTest, SimdBackends);
-//
-//// 5. The Tests!
-// TYPED_TEST(SimdInitTest, SetsAllLanesToZero)
-//{
-//     // Call the function using the current backend type
-//     SimdSetZero<TypeParam>(this->data);
-//
-//     for (int i = 0; i < 8; ++i)
-//     {
-//         EXPECT_FLOAT_EQ(this->data[i], 0.0f);
-//     }
-// }
-//
-// TYPED_TEST(SimdInitTest, BroadcastsSingleValueToAllLanes)
-//{
-//     float test_val = 42.5f;
-//     SimdBroadcast<TypeParam>(this->data, test_val);
-//
-//     for (int i = 0; i < 8; ++i)
-//     {
-//         EXPECT_FLOAT_EQ(this->data[i], test_val);
-//     }
-// }
\ No newline at end of file
+/**
+ * @file InitializationTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: March 10, 2026
+ *
+ * @brief @ref falcon::simd::Register initialization, load and store tests.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "SIMDTestSetup.h"
+
+#if defined(FALCON_SIMD_SUPPORTED) && defined(__SSE4_1__)
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+/** @brief Reference backend writing lanes one at a time. */
+struct ScalarBackend
+{
+    static constexpr bool supported = true;
+};
+
+/** @brief Backend writing lanes through a `float` @ref falcon::simd::Register of `Width` bytes. */
+template <std::size_t Width>
+struct RegisterBackend
+{
+    using register_type = falcon::simd::Register<float, Width>;
+    static constexpr bool supported = falcon::simd::isRegisterSupported<float, Width>;
+};
+
+using SSEBackend = RegisterBackend<16>;
+using AVXBackend = RegisterBackend<32>;
+using AVX512Backend = RegisterBackend<64>;
+
+
+/** @brief Number of floats written by each backend, one full AVX-512 register. */
+inline constexpr std::size_t backendLanes = 16;
+
+
+/**
+ * @brief Zero `backendLanes` floats using @p Backend.
+ *
+ * @param[out] out Destination aligned to 64 bytes.
+ */
+template <typename Backend>
+void SimdSetZero(float* out)
+{
+    if constexpr (std::is_same_v<Backend, ScalarBackend>)
+    {
+        for (std::size_t i = 0; i < backendLanes; ++i)
+            out[i] = 0.0f;
+    }
+    else
+    {
+        using Reg = typename Backend::register_type;
+        for (std::size_t i = 0; i < backendLanes; i += Reg::lanes)
+            Reg::setzero().store(out + i);
+    }
+}
+
+
+/**
+ * @brief Broadcast @p val to `backendLanes` floats using @p Backend.
+ *
+ * @param[out] out Destination aligned to 64 bytes.
+ * @param[in]  val Value to broadcast.
+ */
+template <typename Backend>
+void SimdBroadcast(float* out, const float val)
+{
+    if constexpr (std::is_same_v<Backend, ScalarBackend>)
+    {
+        for (std::size_t i = 0; i < backendLanes; ++i)
+            out[i] = val;
+    }
+    else
+    {
+        using Reg = typename Backend::register_type;
+        for (std::size_t i = 0; i < backendLanes; i += Reg::lanes)
+            Reg::broadcast(val).store(out + i);
+    }
+}
+
+
+template <typename BackendType>
+class SimdInitTest: public ::testing::Test
+{
+    protected:
+    alignas(64) float data[backendLanes];
+
+    void SetUp() override
+    {
+        // Fill with garbage data before each test to ensure the backend actually overwrites it
+        for (float& lane : data)
+            lane = -999.0f;
+    }
+};
+
+using SimdBackends = typename ToTestingTypes<typename FilterConfigs<
+    IsSupportedConfig, std::tuple<ScalarBackend, SSEBackend, AVXBackend, AVX512Backend>>::type>::type;
+TYPED_TEST_SUITE(SimdInitTest, SimdBackends);
+
+
+template <typename Config>
+class RegisterInitialization: public RegisterTest<Config>
+{};
+TYPED_TEST_SUITE(RegisterInitialization, SupportedRegisterConfigs);
+
+
+
+/**
+ * @addtogroup T_SIMD_Register_Init
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *           BACKEND TESTS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every backend zeroes all lanes. */
+TYPED_TEST(SimdInitTest, SetsAllLanesToZero)
+{
+    SimdSetZero<TypeParam>(this->data);
+
+    for (std::size_t i = 0; i < backendLanes; ++i)
+        EXPECT_FLOAT_EQ(this->data[i], 0.0f);
+}
+
+
+/** @test Verify that every backend broadcasts a single value to all lanes. */
+TYPED_TEST(SimdInitTest, BroadcastsSingleValueToAllLanes)
+{
+    constexpr float testVal = 42.5f;
+    SimdBroadcast<TypeParam>(this->data, testVal);
+
+    for (std::size_t i = 0; i < backendLanes; ++i)
+        EXPECT_FLOAT_EQ(this->data[i], testVal);
+}
+
+
+
+/**************************************
+ *                                    *
+ *         LOAD / STORE TESTS         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that an aligned load followed by an aligned store round-trips every lane. */
+TYPED_TEST(RegisterInitialization, AlignedLoadStore_RoundTripsLanes)
+{
+    using Reg = typename TestFixture::Reg;
+
+    Reg::load(this->_lhs).store(this->_out);
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(this->_lhs[i], this->_out[i]);
+}
+
+
+/** @test Verify that unaligned loads and stores round-trip every lane at an odd offset. */
+TYPED_TEST(RegisterInitialization, UnalignedLoadStore_RoundTripsLanes)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+    constexpr std::size_t lanes = TestFixture::lanes;
+
+    alignas(64) T source[lanes + 1] = {};
+    alignas(64) T dest[lanes + 1] = {};
+    std::copy_n(this->_lhs, lanes, source + 1);
+
+    Reg::loadUnaligned(source + 1).storeUnaligned(dest + 1);
+
+    EXPECT_EQ(T(0), dest[0]);
+    for (std::size_t i = 0; i < lanes; ++i)
+        EXPECT_EQ(this->_lhs[i], dest[i + 1]);
+}
+
+
+/** @test Verify that a masked load reads only the leading lanes and zeroes the rest. */
+TYPED_TEST(RegisterInitialization, MaskedLoad_ZeroesTail)
+{
+    using Reg = typename TestFixture::Reg;
+    constexpr std::size_t lanes = TestFixture::lanes;
+    constexpr std::size_t count = lanes / 2 + 1;
+
+    Reg::loadMasked(this->_lhs, count).store(this->_out);
+
+    for (std::size_t i = 0; i < lanes; ++i)
+        EXPECT_EQ(i < count ? this->_lhs[i] : typename TestFixture::T(0), this->_out[i]);
+}
+
+
+/** @test Verify that a masked store writes only the leading lanes and leaves the rest untouched. */
+TYPED_TEST(RegisterInitialization, MaskedStore_LeavesTailUntouched)
+{
+    using Reg = typename TestFixture::Reg;
+    constexpr std::size_t lanes = TestFixture::lanes;
+    constexpr std::size_t count = lanes / 2 + 1;
+
+    typename TestFixture::T original[lanes];
+    std::copy_n(this->_rhs, lanes, original);
+
+    Reg::load(this->_lhs).storeMasked(this->_rhs, count);
+
+    for (std::size_t i = 0; i < lanes; ++i)
+        EXPECT_EQ(i < count ? this->_lhs[i] : original[i], this->_rhs[i]);
+
+    // Counts past the register width are clamped instead of writing out of bounds.
+    Reg::load(this->_lhs).storeMasked(this->_out, lanes * 2);
+    for (std::size_t i = 0; i < lanes; ++i)
+        EXPECT_EQ(this->_lhs[i], this->_out[i]);
+}
+
+
+/** @test Verify that a non-temporal store writes every lane once fenced. */
+TYPED_TEST(RegisterInitialization, StreamStore_WritesLanes)
+{
+    using Reg = typename TestFixture::Reg;
+
+    Reg::load(this->_lhs).storeStream(this->_out);
+    falcon::simd::storeFence();
+
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(this->_lhs[i], this->_out[i]);
+}
+
+
+/** @test Verify that `setzero` and `broadcast` fill every lane. */
+TYPED_TEST(RegisterInitialization, SetzeroAndBroadcast_FillAllLanes)
+{
+    using T = typename TestFixture::T;
+    using Reg = typename TestFixture::Reg;
+
+    Reg::setzero().store(this->_out);
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(T(0), this->_out[i]);
+
+    Reg::broadcast(T(7)).store(this->_out);
+    for (std::size_t i = 0; i < TestFixture::lanes; ++i)
+        EXPECT_EQ(T(7), this->_out[i]);
+}
+
+/** @} */
+
+#endif
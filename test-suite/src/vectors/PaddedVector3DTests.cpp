@@ -0,0 +1,205 @@
+/**
+ * @file PaddedVector3DTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::PaddedVector3D against @ref fgm::Vector3D: layout, arithmetic, products, pack and unpack,
+ *        and the padded column storage of @ref fgm::Matrix3D.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <matrix/Matrix3D.h>
+#include <vector/PaddedVector3D.h>
+#include <vector>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class PaddedVector3DTest: public ::testing::Test
+{
+    protected:
+    /** @note An odd count leaves a last vector for the component-wise path of pack and unpack. */
+    static constexpr std::size_t count = 13;
+
+    std::vector<fgm::Vector3D<T>> _tight;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T t = static_cast<T>(i);
+            _tight.emplace_back(t * T(0.5) - T(3), T(2) - t * T(0.25), t * T(0.125) + T(1));
+        }
+    }
+
+    /** @brief Expect @p actual to hold exactly the components of @p expected. */
+    static void expectSame(const fgm::Vector3D<T>& expected, const fgm::Vector3D<T>& actual)
+    {
+        EXPECT_EQ(expected.x, actual.x);
+        EXPECT_EQ(expected.y, actual.y);
+        EXPECT_EQ(expected.z, actual.z);
+    }
+
+    /** @brief Matrix with no zero, unit or repeated elements, invertible with determinant 14.75. */
+    static fgm::Matrix3D<T> general()
+    {
+        return fgm::Matrix3D<T>(T(2), T(-0.5), T(1), T(0.5), T(3), T(-2), T(-1), T(0.75), T(1.5));
+    }
+};
+TYPED_TEST_SUITE(PaddedVector3DTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_PVec3
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *              LAYOUT                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a padded vector shares the size and alignment of a @ref fgm::Vector4D and zeroes its padding. */
+TYPED_TEST(PaddedVector3DTest, Layout_MatchesVector4DWithZeroPadding)
+{
+    using T = TypeParam;
+    static_assert(sizeof(fgm::PaddedVector3D<T>) == sizeof(fgm::Vector4D<T>));
+    static_assert(alignof(fgm::PaddedVector3D<T>) == alignof(fgm::Vector4D<T>));
+
+    const fgm::PaddedVector3D<T> vec(T(1), T(2), T(3));
+    EXPECT_EQ(T(0), vec.w);
+    EXPECT_EQ(T(2), vec[1]);
+    this->expectSame(fgm::Vector3D<T>(T(1), T(2), T(3)), vec.toVector3D());
+    EXPECT_EQ(&vec.x, &vec.xyz.x);
+}
+
+
+/** @test Verify that @ref fgm::Matrix3D stores each column in its own register-aligned padded vector. */
+TYPED_TEST(PaddedVector3DTest, Matrix3D_StoresAlignedPaddedColumns)
+{
+    using T = TypeParam;
+    static_assert(sizeof(fgm::Matrix3D<T>) == 3 * sizeof(fgm::PaddedVector3D<T>));
+    static_assert(alignof(fgm::Matrix3D<T>) == alignof(fgm::PaddedVector3D<T>));
+
+    const fgm::Matrix3D<T> mat = this->general();
+    this->expectSame(fgm::Vector3D<T>(T(2), T(0.5), T(-1)), mat[0]);
+    EXPECT_EQ(T(-2), mat(1, 2));
+}
+
+
+
+/**************************************
+ *                                    *
+ *        ARITHMETIC, PRODUCTS        *
+ *                                    *
+ **************************************/
+
+/** @test Verify that arithmetic, dot and cross match @ref fgm::Vector3D exactly. */
+TYPED_TEST(PaddedVector3DTest, Operations_MatchVector3D)
+{
+    using T = TypeParam;
+    for (std::size_t i = 0; i + 1 < this->count; ++i)
+    {
+        const fgm::Vector3D<T>& a = this->_tight[i];
+        const fgm::Vector3D<T>& b = this->_tight[i + 1];
+        const fgm::PaddedVector3D<T> pa(a);
+        const fgm::PaddedVector3D<T> pb(b);
+
+        this->expectSame(a + b, (pa + pb).toVector3D());
+        this->expectSame(a - b, (pa - pb).toVector3D());
+        this->expectSame(a * T(1.5), (pa * T(1.5)).toVector3D());
+        this->expectSame(a * T(-1), (-pa).toVector3D());
+        EXPECT_EQ(a.dot(b), pa.dot(pb));
+        this->expectSame(a.cross(b), pa.cross(pb).toVector3D());
+        EXPECT_EQ(T(0), pa.cross(pb).w);
+    }
+}
+
+
+/** @test Verify that products are also available in constant evaluation. */
+TYPED_TEST(PaddedVector3DTest, Products_AreConstexpr)
+{
+    using T = TypeParam;
+    constexpr fgm::PaddedVector3D<T> x(T(1), T(0), T(0));
+    constexpr fgm::PaddedVector3D<T> y(T(0), T(1), T(0));
+    static_assert(x.cross(y) == fgm::PaddedVector3D<T>(T(0), T(0), T(1)));
+    static_assert(x.dot(y) == T(0));
+}
+
+
+/** @test Verify that the register paths of @ref fgm::Matrix3D agree with the column definitions of its products. */
+TYPED_TEST(PaddedVector3DTest, Matrix3D_ProductsAndInverse)
+{
+    using T = TypeParam;
+    const fgm::Matrix3D<T> mat = this->general();
+
+    for (const fgm::Vector3D<T>& vec : this->_tight)
+    {
+        const fgm::Vector3D<T> expected = mat[0] * vec.x + mat[1] * vec.y + mat[2] * vec.z;
+        this->expectSame(expected, mat * vec);
+        this->expectSame(expected, (mat * fgm::PaddedVector3D<T>(vec)).toVector3D());
+    }
+
+    EXPECT_NEAR(T(14.75), mat.determinant(), fgm::Config::EPSILON<T>);
+
+    const fgm::Matrix3D<T> identity = mat * mat.inverse();
+    for (std::size_t row = 0; row < 3; ++row)
+        for (std::size_t col = 0; col < 3; ++col)
+            EXPECT_NEAR(row == col ? T(1) : T(0), identity(row, col), fgm::Config::EPSILON<T>);
+}
+
+
+
+/**************************************
+ *                                    *
+ *           PACK / UNPACK            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that unpacking and packing a tight stream round trips every vector and zeroes the padding. */
+TYPED_TEST(PaddedVector3DTest, PackUnpack_RoundTrips)
+{
+    using T = TypeParam;
+    std::vector<fgm::PaddedVector3D<T>> padded(this->count, fgm::PaddedVector3D<T>(T(9), T(9), T(9)));
+    fgm::unpack<T>(this->_tight, padded);
+
+    for (std::size_t i = 0; i < this->count; ++i)
+    {
+        this->expectSame(this->_tight[i], padded[i].toVector3D());
+        EXPECT_EQ(T(0), padded[i].w);
+    }
+
+    std::vector<fgm::Vector3D<T>> repacked(this->count);
+    fgm::pack<T>(padded, repacked);
+    for (std::size_t i = 0; i < this->count; ++i)
+        this->expectSame(this->_tight[i], repacked[i]);
+}
+
+
+/** @test Verify that pack writes nothing past the end of its destination. */
+TYPED_TEST(PaddedVector3DTest, Pack_StaysInsideDestination)
+{
+    using T = TypeParam;
+    std::vector<fgm::PaddedVector3D<T>> padded(this->count);
+    fgm::unpack<T>(this->_tight, padded);
+
+    std::vector<fgm::Vector3D<T>> out(this->count + 1, fgm::Vector3D<T>(T(7), T(7), T(7)));
+    fgm::pack<T>(padded, std::span(out).first(this->count));
+    this->expectSame(fgm::Vector3D<T>(T(7), T(7), T(7)), out.back());
+}
+
+/** @} */
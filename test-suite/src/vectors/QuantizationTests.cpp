@@ -0,0 +1,362 @@
+/**
+ * @file QuantizationTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the SNORM, UNORM, 10:10:10:2 and octahedral encodings of vectors: their rounding and layout, the
+ *        documented error bounds, and that streams encode as single vectors do.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector/Quantization.h>
+#include <vector>
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+using Vec3 = fgm::Vector3D<float>;
+using Vec4 = fgm::Vector4D<float>;
+
+
+/** @brief Angle in degrees between @p a and @p b, computed in `double`. */
+double angleDegrees(const Vec3& a, const Vec3& b)
+{
+    const double ax = a.x, ay = a.y, az = a.z, bx = b.x, by = b.y, bz = b.z;
+    const double cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+    return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz) * 180.0 /
+           std::numbers::pi;
+}
+
+
+/** @brief Expect every component of @p actual to equal that of @p expected exactly. */
+template <typename V>
+void expectComponentsEqual(const V& expected, const V& actual)
+{
+    for (std::size_t c = 0; c < V::dimension; ++c)
+        EXPECT_EQ(expected[c], actual[c]) << "component " << c;
+}
+
+
+/** @brief Direction part of @p vec. */
+Vec3 xyz(const Vec4& vec)
+{
+    return { vec.x, vec.y, vec.z };
+}
+
+
+/** @brief Unit vectors spread evenly over the sphere, then the axes and the octahedral seams. */
+std::vector<Vec3> unitVectors(const std::size_t count)
+{
+    std::mt19937 engine(20261017u);
+    std::normal_distribution<double> normal;
+    std::vector<Vec3> vectors;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double x = normal(engine), y = normal(engine), z = normal(engine);
+        const double length = std::sqrt(x * x + y * y + z * z);
+        vectors.emplace_back(static_cast<float>(x / length), static_cast<float>(y / length),
+                             static_cast<float>(z / length));
+    }
+
+    const float diagonal = 1.0f / std::sqrt(3.0f), edge = 1.0f / std::sqrt(2.0f);
+    for (const float sign : { 1.0f, -1.0f })
+    {
+        vectors.emplace_back(sign, 0.0f, 0.0f);
+        vectors.emplace_back(0.0f, sign, 0.0f);
+        vectors.emplace_back(0.0f, 0.0f, sign);
+        vectors.emplace_back(diagonal, -diagonal, sign * diagonal);
+        vectors.emplace_back(edge, 0.0f, sign * edge);
+        vectors.emplace_back(edge * sign, edge, 0.0f);
+    }
+    return vectors;
+}
+
+
+/**
+ * @addtogroup T_FGM_Vec_Quantize
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *        NORMALIZED COMPONENTS       *
+ *                                    *
+ **************************************/
+
+/** @test Verify that components clamp, scale and round to the nearest step, ties to even, NaN to zero. */
+TEST(Quantize_Normalized, EncodesToTheNearestStep)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    // 0.5 scales to 63.5 and 127.5, which round to the even 64 and 128.
+    expectComponentsEqual(fgm::Vector4D<std::int8_t>(127, -127, 64, -32),
+                          fgm::encodeSnorm8({ 1.0f, -1.0f, 0.5f, -0.25f }));
+    expectComponentsEqual(fgm::Vector4D<std::int8_t>(127, -127, 0, 127),
+                          fgm::encodeSnorm8({ 2.0f, -7.0f, nan, infinity }));
+    expectComponentsEqual(fgm::Vector4D<std::uint8_t>(255, 0, 128, 0), fgm::encodeUnorm8({ 1.0f, 0.0f, 0.5f, -0.5f }));
+    expectComponentsEqual(fgm::Vector4D<std::int16_t>(32767, -32767, 16384, 0),
+                          fgm::encodeSnorm16({ 3.0f, -1.0f, 0.5f, -0.0f }));
+    expectComponentsEqual(fgm::Vector4D<std::uint16_t>(65535, 32768, 0, 0),
+                          fgm::encodeUnorm16({ 1.0f, 0.5f, nan, -infinity }));
+}
+
+
+/** @test Verify that every code decodes to a value encoding back to it, the extremes to exactly -1, 0 and 1. */
+TEST(Quantize_Normalized, RoundTripsEveryCode)
+{
+    for (int code = -32768; code <= 32767; ++code)
+    {
+        const auto signed16 = static_cast<std::int16_t>(code);
+        const fgm::Vector4D<std::int16_t> encoded(signed16, 0, 0, 0);
+        ASSERT_EQ(code == -32768 ? -32767 : code, fgm::encodeSnorm16(fgm::decodeSnorm16(encoded)).x) << code;
+
+        const auto unsigned16 = static_cast<std::uint16_t>(code + 32768);
+        const fgm::Vector4D<std::uint16_t> unsignedEncoded(unsigned16, 0, 0, 0);
+        ASSERT_EQ(unsigned16, fgm::encodeUnorm16(fgm::decodeUnorm16(unsignedEncoded)).x) << code;
+    }
+    for (int code = -128; code <= 127; ++code)
+    {
+        const fgm::Vector4D<std::int8_t> encoded(static_cast<std::int8_t>(code), 0, 0, 0);
+        ASSERT_EQ(code == -128 ? -127 : code, fgm::encodeSnorm8(fgm::decodeSnorm8(encoded)).x) << code;
+
+        const fgm::Vector4D<std::uint8_t> unsignedEncoded(static_cast<std::uint8_t>(code + 128), 0, 0, 0);
+        ASSERT_EQ(code + 128, fgm::encodeUnorm8(fgm::decodeUnorm8(unsignedEncoded)).x) << code;
+    }
+
+    expectComponentsEqual(Vec4(1.0f, -1.0f, 0.0f, -1.0f), fgm::decodeSnorm8({ 127, -127, 0, -128 }));
+    expectComponentsEqual(Vec4(1.0f, -1.0f, 0.0f, -1.0f), fgm::decodeSnorm16({ 32767, -32767, 0, -32768 }));
+    expectComponentsEqual(Vec4(1.0f, 0.0f, 1.0f, 0.0f), fgm::decodeUnorm8({ 255, 0, 255, 0 }));
+    expectComponentsEqual(Vec4(1.0f, 0.0f, 0.0f, 1.0f), fgm::decodeUnorm16({ 65535, 0, 0, 65535 }));
+}
+
+
+/** @test Verify that decoded components lie within half a step of the clamped input. */
+TEST(Quantize_Normalized, StaysWithinHalfAStep)
+{
+    std::mt19937 engine(7u);
+    std::uniform_real_distribution<float> value(-1.25f, 1.25f);
+    const auto expectWithin = [](const Vec4& input, const Vec4& decoded,
+                                 const float low, const float scale)
+    {
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            const float clamped = std::clamp(input[c], low, 1.0f);
+            ASSERT_LE(std::abs(decoded[c] - clamped), 0.5f / scale + 1e-7f) << input[c] << " at scale " << scale;
+        }
+    };
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const Vec4 input(value(engine), value(engine), value(engine), value(engine));
+        expectWithin(input, fgm::decodeSnorm8(fgm::encodeSnorm8(input)), -1.0f, 127.0f);
+        expectWithin(input, fgm::decodeSnorm16(fgm::encodeSnorm16(input)), -1.0f, 32767.0f);
+        expectWithin(input, fgm::decodeUnorm8(fgm::encodeUnorm8(input)), 0.0f, 255.0f);
+        expectWithin(input, fgm::decodeUnorm16(fgm::encodeUnorm16(input)), 0.0f, 65535.0f);
+    }
+}
+
+
+/** @test Verify that encoding and decoding are evaluated at compile time. */
+TEST(Quantize_Normalized, EvaluatesAtCompileTime)
+{
+    constexpr fgm::Vector4D<std::int8_t> encoded = fgm::encodeSnorm8({ 1.0f, -0.5f, 0.25f, 0.0f });
+    static_assert(encoded.x == 127 && encoded.y == -64 && encoded.z == 32 && encoded.w == 0);
+    static_assert(fgm::decodeUnorm8(fgm::encodeUnorm8({ 1.0f, 0.0f, 2.0f, -1.0f })).z == 1.0f);
+    static_assert(fgm::encodeUnorm1010102({ 1.0f, 0.0f, 0.0f, 1.0f }) == 0xC00003FFu);
+    static_assert(fgm::encodeOctahedral({ 0.0f, 0.0f, -1.0f }).x == 32767);
+    EXPECT_EQ(127, encoded.x);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             10:10:10:2             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the fields are packed from x in the low bits to w in the top two, signed in two's complement. */
+TEST(Quantize_Packed, PacksTheFieldLayout)
+{
+    EXPECT_EQ(0x000003FFu, fgm::encodeUnorm1010102({ 1.0f, 0.0f, 0.0f, 0.0f }));
+    EXPECT_EQ(0x000FFC00u, fgm::encodeUnorm1010102({ 0.0f, 1.0f, 0.0f, 0.0f }));
+    EXPECT_EQ(0x3FF00000u, fgm::encodeUnorm1010102({ 0.0f, 0.0f, 1.0f, 0.0f }));
+    EXPECT_EQ(0x80000000u, fgm::encodeUnorm1010102({ 0.0f, 0.0f, 0.0f, 0.6f })); // 1.8 rounds to 2
+    EXPECT_EQ(0xC007FE01u, fgm::encodeSnorm1010102({ -1.0f, 1.0f, 0.0f, -1.0f }));
+    EXPECT_EQ(0x40000000u, fgm::encodeSnorm1010102({ 0.0f, 0.0f, 0.0f, 0.7f }));
+
+    expectComponentsEqual(Vec4(-1.0f, 1.0f, 0.0f, -1.0f), fgm::decodeSnorm1010102(0xC007FE01u));
+    expectComponentsEqual(Vec4(-1.0f, 0.0f, 0.0f, -1.0f), fgm::decodeSnorm1010102(0x80000200u)); // -512, -2
+    expectComponentsEqual(Vec4(1.0f, 0.0f, 1.0f, 1.0f), fgm::decodeUnorm1010102(0xFFF003FFu));
+    EXPECT_FLOAT_EQ(2.0f / 3.0f, fgm::decodeUnorm1010102(0x80000000u).w);
+}
+
+
+/** @test Verify that packed fields decode within half a step of the clamped input. */
+TEST(Quantize_Packed, StaysWithinHalfAStep)
+{
+    std::mt19937 engine(11u);
+    std::uniform_real_distribution<float> value(-1.25f, 1.25f);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const Vec4 input(value(engine), value(engine), value(engine), value(engine));
+        const Vec4 snorm = fgm::decodeSnorm1010102(fgm::encodeSnorm1010102(input));
+        const Vec4 unorm = fgm::decodeUnorm1010102(fgm::encodeUnorm1010102(input));
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            const float signedScale = c == 3 ? 1.0f : 511.0f, unsignedScale = c == 3 ? 3.0f : 1023.0f;
+            ASSERT_LE(std::abs(snorm[c] - std::clamp(input[c], -1.0f, 1.0f)), 0.5f / signedScale + 1e-7f);
+            ASSERT_LE(std::abs(unorm[c] - std::clamp(input[c], 0.0f, 1.0f)), 0.5f / unsignedScale + 1e-7f);
+        }
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *             OCTAHEDRAL             *
+ *                                    *
+ **************************************/
+
+/** @test Verify the axes, the folded lower half, and that degenerate input decodes to +z. */
+TEST(Quantize_Octahedral, HandlesAxesAndDegenerateInput)
+{
+    expectComponentsEqual(fgm::Vector2D<std::int16_t>(32767, 0), fgm::encodeOctahedral({ 1.0f, 0.0f, 0.0f }));
+    expectComponentsEqual(fgm::Vector2D<std::int16_t>(32767, 0), fgm::encodeOctahedral({ 3.0f, 0.0f, 0.0f }));
+    expectComponentsEqual(fgm::Vector2D<std::int16_t>(0, -32767), fgm::encodeOctahedral({ 0.0f, -1.0f, 0.0f }));
+    expectComponentsEqual(fgm::Vector2D<std::int16_t>(0, 0), fgm::encodeOctahedral({ 0.0f, 0.0f, 1.0f }));
+    expectComponentsEqual(fgm::Vector2D<std::int16_t>(32767, 32767), fgm::encodeOctahedral({ 0.0f, 0.0f, -1.0f }));
+
+    for (const Vec3& axis : { Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, -1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f),
+                              Vec3(0.0f, 0.0f, -1.0f) })
+        expectComponentsEqual(axis, fgm::decodeOctahedral(fgm::encodeOctahedral(axis)));
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    expectComponentsEqual(Vec3(0.0f, 0.0f, 1.0f), fgm::decodeOctahedral(fgm::encodeOctahedral({ 0.0f, 0.0f, 0.0f })));
+    expectComponentsEqual(Vec3(0.0f, 0.0f, 1.0f), fgm::decodeOctahedral(fgm::encodeOctahedral({ nan, 1.0f, 0.0f })));
+
+    // Every code decodes to a unit vector, including the corners of the square.
+    for (const fgm::Vector2D<std::int16_t> code : { fgm::Vector2D<std::int16_t>(-32768, -32768),
+                                                    fgm::Vector2D<std::int16_t>(32767, -32767),
+                                                    fgm::Vector2D<std::int16_t>(12345, -23456) })
+        EXPECT_NEAR(1.0f, fgm::decodeOctahedral(code).mag(), 1e-6f);
+}
+
+
+
+/**************************************
+ *                                    *
+ *            ERROR BOUNDS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that unit vectors come back within the documented maximum angular error of every encoding. */
+TEST(Quantize_Error, UnitVectorsStayWithinTheDocumentedAngles)
+{
+    double snorm8 = 0.0, snorm16 = 0.0, packed = 0.0, octahedral = 0.0;
+    for (const Vec3& unit : unitVectors(200000))
+    {
+        const Vec4 tangent(unit, -1.0f);
+        snorm8 = std::max(snorm8, angleDegrees(unit, xyz(fgm::decodeSnorm8(fgm::encodeSnorm8(tangent)))));
+        snorm16 = std::max(snorm16, angleDegrees(unit, xyz(fgm::decodeSnorm16(fgm::encodeSnorm16(tangent)))));
+        packed = std::max(packed, angleDegrees(unit, xyz(fgm::decodeSnorm1010102(fgm::encodeSnorm1010102(tangent)))));
+        octahedral = std::max(octahedral, angleDegrees(unit, fgm::decodeOctahedral(fgm::encodeOctahedral(unit))));
+    }
+
+    EXPECT_LE(snorm8, 0.391);
+    EXPECT_LE(packed, 0.0972);
+    EXPECT_LE(snorm16, 0.00152);
+    EXPECT_LE(octahedral, 0.005);
+
+    // The bounds are tight: the worst sampled direction comes close to them.
+    EXPECT_GT(snorm8, 0.3);
+    EXPECT_GT(octahedral, 0.003);
+}
+
+
+
+/**************************************
+ *                                    *
+ *              STREAMS               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that streams encode to the integers of the single-vector functions, and decode to their values. */
+TEST(Quantize_Streams, MatchSingleVectors)
+{
+    std::mt19937 engine(3u);
+    std::uniform_real_distribution<float> value(-1.1f, 1.1f);
+    std::vector<Vec4> vectors;
+    for (int i = 0; i < 37; ++i)
+        vectors.emplace_back(value(engine), value(engine), value(engine), value(engine));
+    vectors.emplace_back(std::numeric_limits<float>::quiet_NaN(), 0.5f, -0.5f, 1.0f);
+
+    std::vector<fgm::Vector4D<std::int8_t>> snorm8(vectors.size());
+    std::vector<fgm::Vector4D<std::uint16_t>> unorm16(vectors.size());
+    std::vector<std::uint32_t> packed(vectors.size());
+    fgm::encodeSnorm8(vectors, snorm8);
+    fgm::encodeUnorm16(vectors, unorm16);
+    fgm::encodeSnorm1010102(vectors, packed);
+
+    std::vector<Vec4> decoded8(vectors.size()), decoded16(vectors.size());
+    std::vector<Vec4> decodedPacked(vectors.size());
+    fgm::decodeSnorm8(snorm8, decoded8);
+    fgm::decodeUnorm16(unorm16, decoded16);
+    fgm::decodeSnorm1010102(packed, decodedPacked);
+    for (std::size_t i = 0; i < vectors.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+        expectComponentsEqual(fgm::encodeSnorm8(vectors[i]), snorm8[i]);
+        expectComponentsEqual(fgm::encodeUnorm16(vectors[i]), unorm16[i]);
+        EXPECT_EQ(fgm::encodeSnorm1010102(vectors[i]), packed[i]) << i;
+        expectComponentsEqual(fgm::decodeSnorm8(snorm8[i]), decoded8[i]);
+        expectComponentsEqual(fgm::decodeUnorm16(unorm16[i]), decoded16[i]);
+        expectComponentsEqual(fgm::decodeSnorm1010102(packed[i]), decodedPacked[i]);
+    }
+
+    // Flat component streams of any length.
+    std::vector<float> components;
+    for (const Vec4& vec : vectors)
+        components.insert(components.end(), { vec.x, vec.y, vec.z });
+    std::vector<std::uint8_t> unorm8(components.size());
+    std::vector<float> widened(components.size());
+    fgm::encodeUnorm8(components, unorm8);
+    fgm::decodeUnorm8(unorm8, widened);
+    for (std::size_t i = 0; i < components.size(); ++i)
+    {
+        const fgm::Vector4D<std::uint8_t> single = fgm::encodeUnorm8({ components[i], 0.0f, 0.0f, 0.0f });
+        EXPECT_EQ(single.x, unorm8[i]) << i;
+        EXPECT_EQ(fgm::decodeUnorm8(single).x, widened[i]) << i;
+    }
+
+    const std::vector<Vec3> normals = unitVectors(61);
+    std::vector<fgm::Vector2D<std::int16_t>> encodedNormals(normals.size());
+    std::vector<Vec3> decodedNormals(normals.size());
+    fgm::encodeOctahedral(normals, encodedNormals);
+    fgm::decodeOctahedral(encodedNormals, decodedNormals);
+    for (std::size_t i = 0; i < normals.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+        expectComponentsEqual(fgm::encodeOctahedral(normals[i]), encodedNormals[i]);
+        const Vec3 expected = fgm::decodeOctahedral(encodedNormals[i]);
+        for (std::size_t c = 0; c < 3; ++c)
+            EXPECT_NEAR(expected[c], decodedNormals[i][c], 2e-7f) << "component " << c;
+    }
+}
+
+/** @} */
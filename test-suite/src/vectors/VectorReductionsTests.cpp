@@ -0,0 +1,326 @@
+/**
+ * @file VectorReductionsTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies the vector reductions against scalar loops, over packed spans and @ref fgm::Vec4Array, on one
+ *        thread and split across a pool.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cmath>
+#include <limits>
+#include <vector/VectorReductions.h>
+#include <vector>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class VectorReductionsTest: public ::testing::Test
+{
+    protected:
+    /** @note Not a multiple of any register width, and several deterministic chunks long when forced parallel. */
+    static constexpr std::size_t count = 40003;
+
+    std::vector<fgm::Vector4D<T>> _packed;
+    fgm::Vec4Array<T> _soa;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T t = static_cast<T>(i % 1000) * T(0.01);
+            _packed.emplace_back(t - T(3), T(2) - t * T(0.5), static_cast<T>(i % 7), T(0.25) * static_cast<T>(i % 5));
+        }
+        _soa = fgm::Vec4Array<T>(std::span<const fgm::Vector4D<T>>(_packed));
+    }
+
+    /** @brief Options splitting any input across @p pool. */
+    static fgm::ReduceOptions onPool(fgm::parallel::ThreadPool& pool,
+                                     const fgm::Summation summation = fgm::Summation::Plain)
+    {
+        fgm::ReduceOptions options;
+        options.summation = summation;
+        options.chunking.pool = &pool;
+        options.chunking.parallelThreshold = 0;
+        return options;
+    }
+
+    /** @brief Expect every component of @p actual within a relative @p tolerance of @p expected. */
+    static void expectNear(const fgm::Vector4D<long double>& expected, const fgm::Vector4D<T>& actual,
+                           const long double tolerance)
+    {
+        for (std::size_t c = 0; c < 4; ++c)
+            EXPECT_NEAR(expected[c], actual[c], tolerance * (std::abs(expected[c]) + 1)) << "component " << c;
+    }
+
+    /** @brief Sum of @ref _packed in `long double`. */
+    fgm::Vector4D<long double> referenceSum() const
+    {
+        fgm::Vector4D<long double> total;
+        for (const fgm::Vector4D<T>& vec : _packed)
+            total += fgm::Vector4D<long double>(vec);
+        return total;
+    }
+};
+
+TYPED_TEST_SUITE(VectorReductionsTest, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Vec_Reduce
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *              BOUNDS                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that packed and structure-of-arrays bounds match a scalar loop, serially and across threads. */
+TYPED_TEST(VectorReductionsTest, Bounds_MatchScalarLoop)
+{
+    using T = TypeParam;
+    using V = fgm::Vector4D<T>;
+
+    V low = this->_packed[0], high = this->_packed[0];
+    for (const V& vec : this->_packed)
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            low[c] = std::min(low[c], vec[c]);
+            high[c] = std::max(high[c], vec[c]);
+        }
+
+    fgm::parallel::ThreadPool pool(4);
+    for (const fgm::ReduceOptions& options : { fgm::ReduceOptions{}, TestFixture::onPool(pool) })
+    {
+        const fgm::Bounds<V> packed = fgm::bounds<V>(this->_packed, options);
+        const fgm::Bounds<V> soa = fgm::bounds(this->_soa, options);
+        EXPECT_EQ(low, packed.min);
+        EXPECT_EQ(high, packed.max);
+        EXPECT_EQ(low, soa.min);
+        EXPECT_EQ(high, soa.max);
+    }
+}
+
+
+/** @test Verify that NaN components are skipped and that empty inputs give inverted bounds. */
+TYPED_TEST(VectorReductionsTest, Bounds_SkipNaNAndInvertWhenEmpty)
+{
+    using T = TypeParam;
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+    constexpr T infinity = std::numeric_limits<T>::infinity();
+
+    const std::vector<fgm::Vector3D<T>> points = { { nan, T(1), T(-2) }, { T(4), nan, T(3) }, { T(-1), T(5), nan } };
+    const fgm::Bounds<fgm::Vector3D<T>> box = fgm::bounds<fgm::Vector3D<T>>(points);
+    EXPECT_EQ(T(-1), box.min.x);
+    EXPECT_EQ(T(4), box.max.x);
+    EXPECT_EQ(T(1), box.min.y);
+    EXPECT_EQ(T(5), box.max.y);
+    EXPECT_EQ(T(-2), box.min.z);
+    EXPECT_EQ(T(3), box.max.z);
+
+    const fgm::Bounds<fgm::Vector2D<T>> empty = fgm::bounds<fgm::Vector2D<T>>({});
+    EXPECT_EQ(infinity, empty.min.x);
+    EXPECT_EQ(-infinity, empty.max.y);
+
+    const fgm::Bounds<fgm::Vector4D<T>> emptySoa = fgm::bounds(fgm::Vec4Array<T>());
+    EXPECT_EQ(fgm::Vector4D<T>(infinity, infinity, infinity, infinity), emptySoa.min);
+}
+
+
+
+/**************************************
+ *                                    *
+ *            SUM AND MEAN            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every summation mode matches a wide reference, on packed and structure-of-arrays vectors. */
+TYPED_TEST(VectorReductionsTest, Sum_MatchesWideReferenceInEveryMode)
+{
+    using T = TypeParam;
+    using V = fgm::Vector4D<T>;
+    const long double tolerance = std::is_same_v<T, float> ? 1e-4L : 1e-12L;
+    const fgm::Vector4D<long double> expected = this->referenceSum();
+
+    fgm::parallel::ThreadPool pool(3);
+    for (const fgm::Summation summation :
+         { fgm::Summation::Plain, fgm::Summation::Pairwise, fgm::Summation::Compensated })
+    {
+        SCOPED_TRACE(static_cast<int>(summation));
+        fgm::ReduceOptions serial;
+        serial.summation = summation;
+
+        for (const fgm::ReduceOptions& options : { serial, TestFixture::onPool(pool, summation) })
+        {
+            TestFixture::expectNear(expected, fgm::sum<V>(this->_packed, options), tolerance);
+            TestFixture::expectNear(expected, fgm::sum(this->_soa, options), tolerance);
+        }
+    }
+
+    const fgm::Vector4D<long double> centroid = expected / static_cast<long double>(TestFixture::count);
+    TestFixture::expectNear(centroid, fgm::mean<V>(this->_packed), tolerance);
+    TestFixture::expectNear(centroid, fgm::mean(this->_soa), tolerance);
+}
+
+
+/** @test Verify that compensated and pairwise sums lose less than plain running sums over many small terms. */
+TYPED_TEST(VectorReductionsTest, Sum_CompensatedBeatsPlainOnLongRuns)
+{
+    using T = TypeParam;
+    constexpr std::size_t terms = std::size_t(1) << 21;
+    const std::vector<fgm::Vector2D<T>> steps(terms, fgm::Vector2D<T>(T(0.1), T(1) / T(3)));
+    const long double exactX = static_cast<long double>(T(0.1)) * terms;
+
+    const auto error = [&](const fgm::Summation summation)
+    {
+        fgm::ReduceOptions options;
+        options.summation = summation;
+        return std::abs(static_cast<long double>(fgm::sum<fgm::Vector2D<T>>(steps, options).x) - exactX);
+    };
+
+    const long double plain = error(fgm::Summation::Plain);
+    EXPECT_LE(error(fgm::Summation::Pairwise), plain);
+    EXPECT_LE(error(fgm::Summation::Compensated), plain);
+    EXPECT_LE(error(fgm::Summation::Compensated), exactX * std::numeric_limits<T>::epsilon());
+}
+
+
+/** @test Verify that deterministic chunking gives bit-identical sums for every thread count. */
+TYPED_TEST(VectorReductionsTest, Sum_DeterministicAcrossThreadCounts)
+{
+    using T = TypeParam;
+    using V = fgm::Vector4D<T>;
+
+    fgm::parallel::ThreadPool single(1);
+    const V packed = fgm::sum<V>(this->_packed, TestFixture::onPool(single));
+    const V soa = fgm::sum(this->_soa, TestFixture::onPool(single));
+    const T squares = fgm::sumDot(this->_soa, this->_soa, TestFixture::onPool(single));
+
+    for (const std::size_t threads : { 2, 5 })
+    {
+        fgm::parallel::ThreadPool pool(threads);
+        EXPECT_EQ(packed, fgm::sum<V>(this->_packed, TestFixture::onPool(pool)));
+        EXPECT_EQ(soa, fgm::sum(this->_soa, TestFixture::onPool(pool)));
+        EXPECT_EQ(squares, fgm::sumDot(this->_soa, this->_soa, TestFixture::onPool(pool)));
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *        PRODUCTS AND LENGTHS        *
+ *                                    *
+ **************************************/
+
+/** @test Verify that summed dot products and magnitudes match a scalar loop for packed and structure-of-arrays data. */
+TYPED_TEST(VectorReductionsTest, SumDotAndMag_MatchScalarLoop)
+{
+    using T = TypeParam;
+    using V = fgm::Vector4D<T>;
+    const long double tolerance = std::is_same_v<T, float> ? 1e-4L : 1e-12L;
+
+    long double dot = 0, mag = 0;
+    std::vector<fgm::Vector3D<T>> points;
+    long double dot3 = 0;
+    for (const V& vec : this->_packed)
+    {
+        const fgm::Vector4D<long double> wide(vec);
+        dot += wide.dot(wide);
+        mag += std::sqrt(wide.dot(wide));
+        points.emplace_back(vec.x, vec.y, vec.z);
+        dot3 += wide.x * wide.x + wide.y * wide.y + wide.z * wide.z;
+    }
+
+    fgm::parallel::ThreadPool pool(4);
+    for (const fgm::ReduceOptions& options :
+         { fgm::ReduceOptions{}, TestFixture::onPool(pool, fgm::Summation::Compensated) })
+    {
+        EXPECT_NEAR(dot, fgm::sumDot<V>(this->_packed, this->_packed, options), tolerance * dot);
+        EXPECT_NEAR(dot, fgm::sumDot(this->_soa, this->_soa, options), tolerance * dot);
+        EXPECT_NEAR(mag, fgm::sumMag<V>(this->_packed, options), tolerance * mag);
+        EXPECT_NEAR(mag, fgm::sumMag(this->_soa, options), tolerance * mag);
+        EXPECT_NEAR(dot3, fgm::sumDot<fgm::Vector3D<T>>(points, points, options), tolerance * dot3);
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *         DISTANCE EXTREMES          *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the nearest and farthest vectors match a scalar search, taking the lowest index on ties. */
+TYPED_TEST(VectorReductionsTest, DistanceExtremes_MatchScalarSearch)
+{
+    using T = TypeParam;
+    using V = fgm::Vector4D<T>;
+    const V point(T(1.5), T(-0.5), T(2), T(0.5));
+
+    std::size_t nearest = 0, farthest = 0;
+    T closest = std::numeric_limits<T>::infinity(), furthest = -closest;
+    for (std::size_t i = 0; i < this->_packed.size(); ++i)
+    {
+        const V offset = this->_packed[i] - point;
+        const T distance = offset.dot(offset);
+        if (distance < closest)
+        {
+            closest = distance;
+            nearest = i;
+        }
+        if (distance > furthest)
+        {
+            furthest = distance;
+            farthest = i;
+        }
+    }
+
+    fgm::parallel::ThreadPool pool(4);
+    for (const fgm::ReduceOptions& options : { fgm::ReduceOptions{}, TestFixture::onPool(pool) })
+    {
+        const fgm::DistanceExtremes packed = fgm::distanceExtremes<V>(this->_packed, point, options);
+        const fgm::DistanceExtremes soa = fgm::distanceExtremes(this->_soa, point, options);
+        EXPECT_EQ(nearest, packed.nearest);
+        EXPECT_EQ(farthest, packed.farthest);
+        EXPECT_EQ(nearest, soa.nearest);
+        EXPECT_EQ(farthest, soa.farthest);
+    }
+}
+
+
+/** @test Verify that vectors at a NaN distance are skipped and that no candidate yields the element count. */
+TYPED_TEST(VectorReductionsTest, DistanceExtremes_SkipNaNAndReportNone)
+{
+    using T = TypeParam;
+    constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+    const std::vector<fgm::Vector2D<T>> points = { { nan, T(0) }, { T(3), T(4) }, { T(1), T(0) }, { T(0), T(1) } };
+    const fgm::DistanceExtremes found = fgm::distanceExtremes<fgm::Vector2D<T>>(points, fgm::Vector2D<T>());
+    EXPECT_EQ(2u, found.nearest);
+    EXPECT_EQ(1u, found.farthest);
+
+    const fgm::Vec4Array<T> unreachable(3, fgm::Vector4D<T>(nan, T(0), T(0), T(0)));
+    const fgm::DistanceExtremes none = fgm::distanceExtremes(unreachable, fgm::Vector4D<T>());
+    EXPECT_EQ(3u, none.nearest);
+    EXPECT_EQ(3u, none.farthest);
+}
+
+/** @} */
@@ -0,0 +1,225 @@
+/**
+ * @file BatchOperationTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies that @ref fgm::Vec4Array batch operations match @ref fgm::Vector4D element by element.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <vector/Vec4Array.h>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class Vec4ArrayBatch: public ::testing::Test
+{
+    protected:
+    /** @note 35 vectors leave a tail after every 4, 8 and 16 lane block. */
+    static constexpr std::size_t count = 35;
+
+    std::vector<fgm::Vector4D<T>> _lhs;
+    std::vector<fgm::Vector4D<T>> _rhs;
+    fgm::Vec4Array<T> _lhsArray;
+    fgm::Vec4Array<T> _rhsArray;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T t = static_cast<T>(i);
+            _lhs.emplace_back(t * T(0.5) - T(3), T(2) - t * T(0.25), t * T(0.125) + T(1), T(4) - t * T(0.375));
+            _rhs.emplace_back(T(1) + t * T(0.25), t * T(0.5) - T(2), T(3), T(-1) - t * T(0.125));
+        }
+        _lhsArray.assign(_lhs);
+        _rhsArray.assign(_rhs);
+    }
+
+    /** @brief Expect @p actual to hold `expected(i)` at every index. */
+    template <typename Expected>
+    static void expectEach(const fgm::Vec4Array<T>& actual, Expected expected)
+    {
+        ASSERT_EQ(count, actual.size());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SCOPED_TRACE(i);
+            EXPECT_VEC_EQ(expected(i), actual[i]);
+        }
+    }
+};
+/** @brief Test fixture for @ref fgm::Vec4Array batch operations, parameterized by `float` and `double`. */
+TYPED_TEST_SUITE(Vec4ArrayBatch, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Vec4Array_Batch
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *          ARITHMETIC TESTS          *
+ *                                    *
+ **************************************/
+
+/** @test Verify that batch addition and subtraction match per-vector results. */
+TYPED_TEST(Vec4ArrayBatch, AddSubtract_MatchVector4D)
+{
+    this->expectEach(this->_lhsArray + this->_rhsArray, [&](std::size_t i) { return this->_lhs[i] + this->_rhs[i]; });
+    this->expectEach(this->_lhsArray - this->_rhsArray, [&](std::size_t i) { return this->_lhs[i] - this->_rhs[i]; });
+
+    fgm::Vec4Array<TypeParam> accumulated = this->_lhsArray;
+    accumulated += this->_rhsArray;
+    accumulated -= this->_lhsArray;
+    this->expectEach(accumulated, [&](std::size_t i) { return this->_rhs[i]; });
+}
+
+
+/** @test Verify that scalar multiplication, division and negation match per-vector results. */
+TYPED_TEST(Vec4ArrayBatch, ScalarOperations_MatchVector4D)
+{
+    using T = TypeParam;
+
+    this->expectEach(this->_lhsArray * T(2.5), [&](std::size_t i) { return this->_lhs[i] * T(2.5); });
+    this->expectEach(T(-3) * this->_lhsArray, [&](std::size_t i) { return this->_lhs[i] * T(-3); });
+    this->expectEach(this->_lhsArray / T(4), [&](std::size_t i) { return this->_lhs[i] / T(4); });
+    this->expectEach(-this->_lhsArray, [&](std::size_t i) { return -this->_lhs[i]; });
+}
+
+
+
+/**************************************
+ *                                    *
+ *          GEOMETRY TESTS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that batch dot products and magnitudes match per-vector results. */
+TYPED_TEST(Vec4ArrayBatch, DotAndMag_MatchVector4D)
+{
+    using T = TypeParam;
+    const T tolerance = fgm::Config::EPSILON<T>;
+
+    const std::vector<T> dots = this->_lhsArray.dot(this->_rhsArray);
+    const std::vector<T> mags = this->_lhsArray.mag();
+
+    ASSERT_EQ(this->count, dots.size());
+    ASSERT_EQ(this->count, mags.size());
+    for (std::size_t i = 0; i < this->count; ++i)
+    {
+        EXPECT_NEAR(this->_lhs[i].dot(this->_rhs[i]), dots[i], tolerance * std::abs(dots[i]) + tolerance);
+        EXPECT_NEAR(this->_lhs[i].mag(), mags[i], tolerance * mags[i]);
+    }
+}
+
+
+/** @test Verify that batch normalization matches per-vector results. */
+TYPED_TEST(Vec4ArrayBatch, Normalize_MatchVector4D)
+{
+    this->expectEach(this->_lhsArray.normalize(), [&](std::size_t i) { return this->_lhs[i].normalize(); });
+}
+
+
+/** @test Verify that every @ref fgm::Precision tier stays within its documented error on scattered vectors. */
+TYPED_TEST(Vec4ArrayBatch, NormalizeTiers_StayWithinDocumentedUlpError)
+{
+    using T = TypeParam;
+    const std::vector<fgm::Vector4D<T>> vectors = scatteredVectors<T>(1000);
+    const fgm::Vec4Array<T> array(std::span<const fgm::Vector4D<T>>(vectors.data(), vectors.size()));
+
+    const auto expectWithin = [&](const fgm::Vec4Array<T>& unit, const fgm::Precision precision)
+    {
+        long double worst = 0;
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+            worst = std::max(worst, normalizeUlpError(vectors[i], unit[i]));
+        EXPECT_LE(worst, falcon::simd::maxUlpError<T>(precision)) << "tier " << static_cast<int>(precision);
+    };
+
+    expectWithin(array.template normalize<fgm::Precision::Fast>(), fgm::Precision::Fast);
+    expectWithin(array.template normalize<fgm::Precision::Refined>(), fgm::Precision::Refined);
+    expectWithin(array.template normalize<fgm::Precision::Exact>(), fgm::Precision::Exact);
+}
+
+
+/** @test Verify that safe normalization writes zero vectors where @ref fgm::Vector4D::safeNormalize does. */
+TYPED_TEST(Vec4ArrayBatch, SafeNormalize_ZeroesDegenerateVectors)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> array = this->_lhsArray;
+    array.set(3, fgm::Vector4D<T>{});
+    array.set(17, { T(0), fgm::Config::EPSILON_SQUARE<T> / T(2), T(0), T(0) });
+
+    this->expectEach(array.safeNormalize(), [&](std::size_t i) { return array[i].safeNormalize(); });
+    EXPECT_VEC_EQ(fgm::Vector4D<T>{}, array.safeNormalize()[3]);
+}
+
+
+/** @test Verify that batch projection and rejection match per-vector results for both onto flags. */
+TYPED_TEST(Vec4ArrayBatch, ProjectReject_MatchVector4D)
+{
+    const auto& lhs = this->_lhs;
+    const auto& rhs = this->_rhs;
+
+    this->expectEach(this->_lhsArray.project(this->_rhsArray), [&](std::size_t i) { return lhs[i].project(rhs[i]); });
+    this->expectEach(this->_lhsArray.reject(this->_rhsArray), [&](std::size_t i) { return lhs[i].reject(rhs[i]); });
+
+    const fgm::Vec4Array<TypeParam> unit = this->_rhsArray.normalize();
+    this->expectEach(this->_lhsArray.project(unit, true),
+                     [&](std::size_t i) { return lhs[i].project(rhs[i].normalize(), true); });
+    this->expectEach(this->_lhsArray.reject(unit, true),
+                     [&](std::size_t i) { return lhs[i].reject(rhs[i].normalize(), true); });
+}
+
+
+
+
+/**************************************
+ *                                    *
+ *          EQUALITY TESTS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that batch equality sets one bit per vector exactly where @ref fgm::Vector4D::allEq holds. */
+TYPED_TEST(Vec4ArrayBatch, AllEq_PacksVector4DResults)
+{
+    using T = TypeParam;
+    constexpr T epsilon = fgm::Config::EPSILON<T>;
+
+    // Every third vector drifts within epsilon, every fifth by more, and every seventh holds a NaN.
+    std::vector<fgm::Vector4D<T>> other = this->_lhs;
+    for (std::size_t i = 0; i < this->count; ++i)
+    {
+        if (i % 3 == 0)
+            other[i].y += epsilon / T(2);
+        if (i % 5 == 0)
+            other[i].w += T(1);
+        if (i % 7 == 0)
+            other[i].z = std::numeric_limits<T>::quiet_NaN();
+    }
+    fgm::Vec4Array<T> otherArray;
+    otherArray.assign(other);
+
+    const std::vector<std::uint64_t> bits = this->_lhsArray.allEq(otherArray);
+    ASSERT_EQ(this->_lhsArray.bitsetWords(), bits.size());
+    for (std::size_t i = 0; i < this->count; ++i)
+    {
+        SCOPED_TRACE(i);
+        EXPECT_EQ(this->_lhs[i].allEq(other[i], epsilon), ((bits[i / 64] >> (i % 64)) & 1u) != 0);
+    }
+    EXPECT_EQ(0u, bits.back() >> (this->count % 64)) << "bits past size() must be cleared";
+}
+
+/** @} */
@@ -0,0 +1,251 @@
+/**
+ * @file ContainerTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::Vec4Array storage, growth and layout conversion.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+#include <cstdint>
+#include <vector/Vec4Array.h>
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+template <typename T>
+class Vec4ArrayContainer: public ::testing::Test
+{
+    protected:
+    std::vector<fgm::Vector4D<T>> _vectors;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0; i < 37; ++i)
+        {
+            const T base = static_cast<T>(i);
+            _vectors.emplace_back(base, base + T(0.25), -base, base * T(2));
+        }
+    }
+};
+/** @brief Test fixture for @ref fgm::Vec4Array containers, parameterized by `float` and `double`. */
+TYPED_TEST_SUITE(Vec4ArrayContainer, BatchTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Vec4Array_Container
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *        INITIALIZATION TESTS        *
+ *                                    *
+ **************************************/
+
+/** @test Verify that a default constructed array is empty and does not allocate. */
+TYPED_TEST(Vec4ArrayContainer, DefaultConstructor_IsEmpty)
+{
+    const fgm::Vec4Array<TypeParam> array;
+
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(0u, array.size());
+    EXPECT_EQ(0u, array.capacity());
+    EXPECT_TRUE(array.toVectors().empty());
+}
+
+
+/** @test Verify that the count constructor fills every vector with zero. */
+TYPED_TEST(Vec4ArrayContainer, CountConstructor_InitializesZeroVectors)
+{
+    const fgm::Vec4Array<TypeParam> array(5);
+
+    ASSERT_EQ(5u, array.size());
+    for (std::size_t i = 0; i < array.size(); ++i)
+        EXPECT_VEC_EQ(fgm::Vector4D<TypeParam>{}, array[i]);
+}
+
+
+/** @test Verify that the fill constructor replicates the given vector. */
+TYPED_TEST(Vec4ArrayContainer, FillConstructor_ReplicatesValue)
+{
+    using T = TypeParam;
+    const fgm::Vector4D<T> value{ T(1), T(-2), T(3), T(-4) };
+
+    const fgm::Vec4Array<T> array(9, value);
+
+    ASSERT_EQ(9u, array.size());
+    for (std::size_t i = 0; i < array.size(); ++i)
+        EXPECT_VEC_EQ(value, array[i]);
+}
+
+
+/** @test Verify that constructing from packed vectors splits every component into its own stream. */
+TYPED_TEST(Vec4ArrayContainer, SpanConstructor_SplitsComponentsIntoStreams)
+{
+    const fgm::Vec4Array<TypeParam> array{ std::span<const fgm::Vector4D<TypeParam>>(this->_vectors) };
+
+    ASSERT_EQ(this->_vectors.size(), array.size());
+    for (std::size_t i = 0; i < array.size(); ++i)
+    {
+        EXPECT_EQ(this->_vectors[i].x, array.x()[i]);
+        EXPECT_EQ(this->_vectors[i].y, array.y()[i]);
+        EXPECT_EQ(this->_vectors[i].z, array.z()[i]);
+        EXPECT_EQ(this->_vectors[i].w, array.w()[i]);
+    }
+}
+
+
+/** @test Verify that packed vectors survive a round trip through the streams for every tail length. */
+TYPED_TEST(Vec4ArrayContainer, ToVectors_RoundTripsPackedVectors)
+{
+    using T = TypeParam;
+
+    for (std::size_t count = 0; count <= this->_vectors.size(); ++count)
+    {
+        SCOPED_TRACE(count);
+        const std::span<const fgm::Vector4D<T>> source(this->_vectors.data(), count);
+
+        const fgm::Vec4Array<T> array(source);
+        const std::vector<fgm::Vector4D<T>> packed = array.toVectors();
+
+        ASSERT_EQ(count, packed.size());
+        for (std::size_t i = 0; i < count; ++i)
+            EXPECT_VEC_EQ(this->_vectors[i], packed[i]);
+    }
+}
+
+
+
+/**************************************
+ *                                    *
+ *         STORAGE AND GROWTH         *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every component stream starts on a 64-byte boundary. */
+TYPED_TEST(Vec4ArrayContainer, Streams_AreCacheLineAligned)
+{
+    const fgm::Vec4Array<TypeParam> array{ std::span<const fgm::Vector4D<TypeParam>>(this->_vectors) };
+    const auto streams = array.streams();
+
+    for (const void* stream : { static_cast<const void*>(streams.x), static_cast<const void*>(streams.y),
+                                static_cast<const void*>(streams.z), static_cast<const void*>(streams.w) })
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(stream) % fgm::Vec4Array<TypeParam>::alignment);
+}
+
+
+/** @test Verify that appending past the capacity keeps every vector already stored. */
+TYPED_TEST(Vec4ArrayContainer, PushBack_PreservesContentsAcrossGrowth)
+{
+    fgm::Vec4Array<TypeParam> array;
+
+    for (const auto& vec : this->_vectors)
+        array.push_back(vec);
+
+    ASSERT_EQ(this->_vectors.size(), array.size());
+    EXPECT_GE(array.capacity(), array.size());
+    for (std::size_t i = 0; i < array.size(); ++i)
+        EXPECT_VEC_EQ(this->_vectors[i], array[i]);
+}
+
+
+/** @test Verify that reserve rounds each stream up to whole cache lines rather than to a power of two. */
+TYPED_TEST(Vec4ArrayContainer, Reserve_RoundsToWholeCacheLines)
+{
+    constexpr std::size_t perLine = fgm::Vec4Array<TypeParam>::alignment / sizeof(TypeParam);
+    fgm::Vec4Array<TypeParam> array;
+
+    array.reserve(5 * perLine + 1);
+    EXPECT_EQ(6 * perLine, array.capacity());
+    array.reserve(10); // Never shrinks
+    EXPECT_EQ(6 * perLine, array.capacity());
+
+    array.reserve(1000);
+    EXPECT_EQ((1000 + perLine - 1) / perLine * perLine, array.capacity());
+}
+
+
+/** @test Verify that push_back at least doubles the capacity whenever it has to grow. */
+TYPED_TEST(Vec4ArrayContainer, PushBack_GrowsGeometrically)
+{
+    fgm::Vec4Array<TypeParam> array;
+    std::size_t reallocations = 0;
+
+    for (std::size_t i = 0; i < 4096; ++i)
+    {
+        const std::size_t before = array.capacity();
+        array.push_back(this->_vectors[i % this->_vectors.size()]);
+        if (array.capacity() != before)
+        {
+            ++reallocations;
+            EXPECT_GE(array.capacity(), 2 * before) << "at size " << i;
+        }
+    }
+
+    EXPECT_LE(reallocations, 12u);
+}
+
+
+/** @test Verify that growing with resize zero-fills the new vectors and shrinking keeps the prefix. */
+TYPED_TEST(Vec4ArrayContainer, Resize_ZeroFillsNewVectors)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> array{ fgm::Vector4D<T>{ T(1), T(2), T(3), T(4) } };
+
+    array.resize(20);
+    ASSERT_EQ(20u, array.size());
+    EXPECT_VEC_EQ(fgm::Vector4D<T>(T(1), T(2), T(3), T(4)), array[0]);
+    for (std::size_t i = 1; i < array.size(); ++i)
+        EXPECT_VEC_EQ(fgm::Vector4D<T>{}, array[i]);
+
+    array.resize(1);
+    ASSERT_EQ(1u, array.size());
+    EXPECT_VEC_EQ(fgm::Vector4D<T>(T(1), T(2), T(3), T(4)), array[0]);
+}
+
+
+/** @test Verify that set writes all four streams at one index only. */
+TYPED_TEST(Vec4ArrayContainer, Set_WritesSingleVector)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> array(3);
+
+    array.set(1, { T(5), T(6), T(7), T(8) });
+
+    EXPECT_VEC_EQ(fgm::Vector4D<T>{}, array[0]);
+    EXPECT_VEC_EQ(fgm::Vector4D<T>(T(5), T(6), T(7), T(8)), array[1]);
+    EXPECT_VEC_EQ(fgm::Vector4D<T>{}, array[2]);
+}
+
+
+/** @test Verify that copies are deep and moves leave the source empty. */
+TYPED_TEST(Vec4ArrayContainer, CopyAndMove_HaveValueSemantics)
+{
+    using T = TypeParam;
+    fgm::Vec4Array<T> original{ std::span<const fgm::Vector4D<T>>(this->_vectors) };
+
+    fgm::Vec4Array<T> copy;
+    copy = original;
+    original.set(0, { T(-1), T(-1), T(-1), T(-1) });
+    EXPECT_VEC_EQ(this->_vectors[0], copy[0]);
+
+    const fgm::Vec4Array<T> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    ASSERT_EQ(this->_vectors.size(), moved.size());
+    EXPECT_VEC_EQ(this->_vectors.back(), moved[moved.size() - 1]);
+}
+
+/** @} */
@@ -91,7 +91,7 @@ TEST_F(BooleanVectorBitOperations, CompoundBitwiseOR_PerformInPlaceDisjunction)
 {
     this->_vecA |= this->_vecB;
 
-    EXPECT_VEC_EQ(this->_expectedConjunctionVector, this->_vecA);
+    EXPECT_VEC_EQ(this->_expectedDisjunctionVec, this->_vecA);
 }
 
 
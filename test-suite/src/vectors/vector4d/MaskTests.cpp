@@ -0,0 +1,220 @@
+/**
+ * @file MaskTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: October 17, 2026
+ *
+ * @brief Verifies @ref fgm::Mask4 reductions and operators, and that the packed comparison masks agree with the
+ *        component-wise @ref fgm::bVec4 results.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+
+using namespace testutils;
+
+
+/**************************************
+ *                                    *
+ *                SETUP               *
+ *                                    *
+ **************************************/
+
+/** @brief Test fixture comparing the packed comparison masks with their @ref fgm::bVec4 counterparts. */
+template <typename T>
+class Vector4DMask: public ::testing::Test
+{
+    protected:
+    fgm::Vector4D<T> _vecA;
+    fgm::Vector4D<T> _vecB;
+
+    void SetUp() override
+    {
+        _vecA = { T(1), T(5), T(-3), T(7) };
+        _vecB = { T(1), T(2), T(4), T(9) };
+    }
+
+    /** @brief Expect @p mask to set exactly the lanes set in @p expected. */
+    static void expectMaskMatches(const fgm::bVec4& expected, const fgm::Mask4 mask)
+    {
+        EXPECT_VEC_EQ(expected, fgm::bVec4(mask));
+        EXPECT_EQ(expected.mask(), mask);
+    }
+};
+/** @brief Register backed types (`float`, `double`, `long long`) and a type compared component by component. */
+using MaskTypes = ::testing::Types<float, double, long long, int>;
+TYPED_TEST_SUITE(Vector4DMask, MaskTypes);
+
+
+
+/**
+ * @addtogroup T_FGM_Vec4_Mask
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *               MASK4                *
+ *                                    *
+ **************************************/
+
+/** @test Verify that the lane constructor, bit constructor and accessors agree on the bit layout. */
+TEST(Mask4, Construction_PacksLaneIntoMatchingBit)
+{
+    constexpr fgm::Mask4 mask(true, false, true, true);
+
+    static_assert(mask.bits() == 0b1101);
+    static_assert(mask == fgm::Mask4(0b1101u));
+    static_assert(mask[0] && !mask[1] && mask[2] && mask[3]);
+    EXPECT_EQ(fgm::Mask4(0xF5u).bits(), 0b0101) << "Bits above the fourth lane must be dropped";
+}
+
+
+/** @test Verify that @ref fgm::Mask4::all, any, none and count reduce the mask. */
+TEST(Mask4, Reductions_SummarizeLanes)
+{
+    constexpr fgm::Mask4 none;
+    constexpr fgm::Mask4 some(0b0110u);
+    constexpr fgm::Mask4 every(0b1111u);
+
+    static_assert(none.none() && !none.any() && !none.all() && none.count() == 0);
+    static_assert(!some.none() && some.any() && !some.all() && some.count() == 2);
+    static_assert(!every.none() && every.any() && every.all() && every.count() == 4);
+}
+
+
+/** @test Verify that the bitwise operators combine masks lane by lane and stay within four lanes. */
+TEST(Mask4, BitwiseOperators_CombineLanes)
+{
+    fgm::Mask4 a(0b1010u);
+    const fgm::Mask4 b(0b0110u);
+
+    EXPECT_EQ((a & b).bits(), 0b0010);
+    EXPECT_EQ((a | b).bits(), 0b1110);
+    EXPECT_EQ((a ^ b).bits(), 0b1100);
+    EXPECT_EQ((~a).bits(), 0b0101);
+    EXPECT_EQ(!a, ~a);
+
+    a |= b;
+    EXPECT_EQ(a.bits(), 0b1110);
+    a &= b;
+    EXPECT_EQ(a.bits(), 0b0110);
+    a ^= b;
+    EXPECT_TRUE(a.none());
+}
+
+
+/** @test Verify that a @ref fgm::bVec4 packs into a mask and expands back unchanged. */
+TEST(Mask4, BoolVector_RoundTrips)
+{
+    constexpr fgm::bVec4 vec(false, true, true, false);
+    constexpr fgm::bVec4 expanded = vec.mask();
+
+    static_assert(vec.mask().bits() == 0b0110);
+    static_assert(expanded.x == vec.x && expanded.y == vec.y && expanded.z == vec.z && expanded.w == vec.w);
+    EXPECT_TRUE(vec.any());
+    EXPECT_FALSE(vec.all());
+    EXPECT_FALSE(vec.none());
+    EXPECT_EQ(vec.count(), 2);
+}
+
+
+
+/**************************************
+ *                                    *
+ *         COMPARISON MASKS           *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every packed comparison sets the same lanes as its @ref fgm::bVec4 counterpart. */
+TYPED_TEST(Vector4DMask, ComparisonMasks_MatchComponentwiseResults)
+{
+    const auto& a = this->_vecA;
+    const auto& b = this->_vecB;
+
+    this->expectMaskMatches(a.eq(b), a.eqMask(b));
+    this->expectMaskMatches(a.neq(b), a.neqMask(b));
+    this->expectMaskMatches(a.gt(b), a.gtMask(b));
+    this->expectMaskMatches(a.gte(b), a.gteMask(b));
+    this->expectMaskMatches(a.lt(b), a.ltMask(b));
+    this->expectMaskMatches(a.lte(b), a.lteMask(b));
+
+    EXPECT_EQ(a.gtMask(b).bits(), 0b0010);
+    EXPECT_EQ(a.lteMask(b).bits(), 0b1101);
+}
+
+
+/** @test Verify that NaN lanes are never equal, greater or less, and are always unequal. */
+TYPED_TEST(Vector4DMask, ComparisonMasks_TreatNaNAsUnordered)
+{
+    using T = TypeParam;
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        const T nan = std::numeric_limits<T>::quiet_NaN();
+        const fgm::Vector4D<T> a(nan, T(1), nan, T(2));
+        const fgm::Vector4D<T> b(T(0), T(1), nan, T(3));
+
+        EXPECT_EQ(a.eqMask(b).bits(), 0b0010);
+        EXPECT_EQ(a.neqMask(b).bits(), 0b1101);
+        EXPECT_EQ(a.gteMask(b).bits(), 0b0010);
+        EXPECT_EQ(a.ltMask(b).bits(), 0b1000);
+    }
+    else
+        GTEST_SKIP() << "NaN only exists for floating point types";
+}
+
+
+/** @test Verify that comparison masks evaluate in constant expressions. */
+TEST(Vector4DMaskConstexpr, ComparisonMasks_Evaluate)
+{
+    constexpr fgm::vec4 a(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr fgm::vec4 b(4.0f, 2.0f, 2.0f, 1.0f);
+
+    static_assert(a.ltMask(b).bits() == 0b0001);
+    static_assert(a.eqMask(b).bits() == 0b0010);
+    static_assert(a.gtMask(b).count() == 2);
+}
+
+
+
+/**************************************
+ *                                    *
+ *             BLENDING               *
+ *                                    *
+ **************************************/
+
+/** @test Verify that @ref fgm::select takes set lanes from the first vector and cleared lanes from the second. */
+TYPED_TEST(Vector4DMask, Select_BlendsByLane)
+{
+    const auto& a = this->_vecA;
+    const auto& b = this->_vecB;
+
+    for (unsigned int bits = 0; bits < 16; ++bits)
+    {
+        SCOPED_TRACE(bits);
+        const fgm::Mask4 mask(bits);
+        const auto blended = fgm::select(mask, a, b);
+
+        for (std::size_t i = 0; i < 4; ++i)
+            EXPECT_EQ(blended[i], mask[i] ? a[i] : b[i]);
+    }
+
+    // The classic use: clamp each component to an upper bound.
+    EXPECT_VEC_EQ(fgm::Vector4D<TypeParam>(TypeParam(1), TypeParam(2), TypeParam(-3), TypeParam(7)),
+                  fgm::select(a.gtMask(b), b, a));
+}
+
+
+/** @test Verify that @ref fgm::select evaluates in constant expressions. */
+TEST(Vector4DMaskConstexpr, Select_Evaluates)
+{
+    constexpr fgm::vec4 a(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr fgm::vec4 b(-1.0f, -2.0f, -3.0f, -4.0f);
+    constexpr fgm::vec4 blended = fgm::select(fgm::Mask4(0b1001u), a, b);
+
+    static_assert(blended.x == 1.0f && blended.y == -2.0f && blended.z == -3.0f && blended.w == 4.0f);
+}
+
+/** @} */
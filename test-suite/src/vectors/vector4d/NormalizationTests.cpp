@@ -57,6 +57,33 @@ class Vector4DZeroNormalization: public ::testing::Test
 TYPED_TEST_SUITE(Vector4DZeroNormalization, SupportedArithmeticTypes);
 
 
+template <typename T>
+class Vector4DNormalizationPrecision: public ::testing::Test
+{
+    protected:
+    std::vector<fgm::Vector4D<T>> _vectors = scatteredVectors<T>(4096);
+
+    /** @brief Expect every tier @p P normalization of @ref _vectors to stay within the documented error. */
+    template <fgm::Precision P>
+    void expectWithinDocumentedError() const
+    {
+        const long double bound = falcon::simd::maxUlpError<T>(P);
+        long double worst = 0;
+        long double worstSafe = 0;
+        for (const fgm::Vector4D<T>& vec : _vectors)
+        {
+            worst = std::max(worst, normalizeUlpError(vec, vec.template normalize<P>()));
+            if (vec.dot(vec) > fgm::Config::EPSILON_SQUARE<T>) // Shorter vectors are zeroed on purpose
+                worstSafe = std::max(worstSafe, normalizeUlpError(vec, vec.template safeNormalize<P>()));
+        }
+        EXPECT_LE(worst, bound);
+        EXPECT_LE(worstSafe, bound);
+    }
+};
+/** @brief Test fixture for @ref fgm::Precision tiers, parameterized by `float` and `double`. */
+TYPED_TEST_SUITE(Vector4DNormalizationPrecision, BatchTypes);
+
+
 
 /**
  * @addtogroup T_FGM_Vec4_Normalize
@@ -169,4 +196,49 @@ TYPED_TEST(Vector4DNormalization, StaticWrapper_SafeNormalize_NormalizedVectorIs
     static_assert(std::is_floating_point_v<typename decltype(normalized)::value_type>);
 }
 
+
+/**
+ * @test Verify that @ref fgm::Vector4D::safeNormalize compares the squared magnitude against
+ *       @ref fgm::Config::EPSILON_SQUARE, so vectors shorter than @ref fgm::Config::EPSILON become zero.
+ */
+TYPED_TEST(Vector4DNormalizationPrecision, SafeNormalize_ZeroesBelowSquaredEpsilon)
+{
+    using T = TypeParam;
+    const T epsilon = fgm::Config::EPSILON<T>;
+
+    EXPECT_VEC_ZERO(fgm::Vector4D<T>(epsilon / T(2), T(0), T(0), T(0)).safeNormalize());
+    EXPECT_VEC_ZERO(fgm::Vector4D<T>(T(0), epsilon / T(2), T(0), T(0)).template safeNormalize<fgm::Precision::Fast>());
+    EXPECT_VEC_EQ(fgm::Vector4D<T>(T(0), T(0), T(1), T(0)),
+                  fgm::Vector4D<T>(T(0), T(0), epsilon * T(2), T(0)).safeNormalize());
+}
+
+
+
+/**************************************
+ *                                    *
+ *          PRECISION TIERS           *
+ *                                    *
+ **************************************/
+
+/** @test Verify that every @ref fgm::Precision tier stays within the error documented by its bound. */
+TYPED_TEST(Vector4DNormalizationPrecision, Tiers_StayWithinDocumentedUlpError)
+{
+    this->template expectWithinDocumentedError<fgm::Precision::Fast>();
+    this->template expectWithinDocumentedError<fgm::Precision::Refined>();
+    this->template expectWithinDocumentedError<fgm::Precision::Exact>();
+}
+
+
+/** @test Verify that @ref fgm::Precision::Exact is the default tier and that tiers evaluate in constant expressions. */
+TEST(Vector4DNormalizationPrecision, Tiers_EvaluateInConstantExpressions)
+{
+    constexpr fgm::vec4 vec(0.0f, 3.0f, 0.0f, 4.0f);
+    constexpr fgm::vec4 fast = vec.normalize<fgm::Precision::Fast>();
+    constexpr fgm::vec4 refined = fgm::vec4::safeNormalize<fgm::Precision::Refined>(vec);
+
+    static_assert(fast.y == 0.6f && fast.w == 0.8f);
+    static_assert(refined.y == 0.6f && refined.w == 0.8f);
+    EXPECT_VEC_EQ(vec.normalize<fgm::Precision::Exact>(), vec.normalize());
+}
+
 /** @} */
\ No newline at end of file
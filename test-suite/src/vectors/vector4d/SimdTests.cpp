@@ -0,0 +1,355 @@
+/**
+ * @file SimdTests.cpp
+ * @author Alan Abraham P Kochumon
+ * @date Created on: April 02, 2026
+ *
+ * @brief Verifies @ref fgm::Vector4D SIMD storage and that runtime SIMD results match constant-evaluated results.
+ *
+ * @copyright Copyright (c) 2026 Alan Abraham P Kochumon
+ */
+
+
+#include "Vector4DTestSetup.h"
+
+
+using namespace testutils;
+using namespace fgm::constants;
+
+
+/**************************************
+ *                                    *
+ *               SETUP                *
+ *                                    *
+ **************************************/
+
+/** @brief Test fixture for @ref fgm::vec4 SIMD kernels, comparing runtime results to the constexpr scalar path. */
+class Vector4DSimd: public ::testing::Test
+{
+    protected:
+    static constexpr fgm::vec4 _vecA = { 3.5f, -1.25f, 6.0f, 2.0f };
+    static constexpr fgm::vec4 _vecB = { -8.0f, 5.5f, 0.75f, 4.0f };
+    static constexpr float _scalar = 2.5f;
+
+    fgm::vec4 _runtimeA;
+    fgm::vec4 _runtimeB;
+    float _runtimeScalar = 0.0f;
+
+    void SetUp() override
+    {
+        _runtimeA = _vecA;
+        _runtimeB = _vecB;
+        _runtimeScalar = _scalar;
+    }
+};
+
+
+/** @brief Test fixture for @ref fgm::dVec4 SIMD kernels, comparing runtime results to the constexpr scalar path. */
+class Vector4DSimdDouble: public ::testing::Test
+{
+    protected:
+    static constexpr fgm::dVec4 _vecA = { 3.5, -1.25, 6.0, 2.0 };
+    static constexpr fgm::dVec4 _vecB = { -8.0, 5.5, 6.0, 4.0 };
+    static constexpr double _scalar = 2.5;
+
+    fgm::dVec4 _runtimeA;
+    fgm::dVec4 _runtimeB;
+    double _runtimeScalar = 0.0;
+
+    void SetUp() override
+    {
+        _runtimeA = _vecA;
+        _runtimeB = _vecB;
+        _runtimeScalar = _scalar;
+    }
+};
+
+
+/** @brief Test fixture for @ref fgm::lVec4 SIMD kernels, comparing runtime results to the constexpr scalar path. */
+class Vector4DSimdLong: public ::testing::Test
+{
+    protected:
+    static constexpr fgm::lVec4 _vecA = { 3, -12, 3'000'000'000LL, 2 };
+    static constexpr fgm::lVec4 _vecB = { -8, 5, 2'000'000'000LL, -4'000'000'000LL };
+    static constexpr long long _scalar = -3;
+
+    fgm::lVec4 _runtimeA;
+    fgm::lVec4 _runtimeB;
+    long long _runtimeScalar = 0;
+
+    void SetUp() override
+    {
+        _runtimeA = _vecA;
+        _runtimeB = _vecB;
+        _runtimeScalar = _scalar;
+    }
+};
+
+
+
+/**
+ * @addtogroup T_FGM_Vec4_Simd
+ * @{
+ */
+
+/**************************************
+ *                                    *
+ *            LAYOUT TESTS            *
+ *                                    *
+ **************************************/
+
+/** @test Verify that register-sized vectors are aligned to their size without changing their footprint. */
+TEST(Vector4DSimdLayout, RegisterSizedVectorsAreAligned)
+{
+    static_assert(sizeof(fgm::vec4) == 16 && alignof(fgm::vec4) == 16);
+    static_assert(sizeof(fgm::iVec4) == 16 && alignof(fgm::iVec4) == 16);
+    static_assert(sizeof(fgm::dVec4) == 32 && alignof(fgm::dVec4) == 32);
+    static_assert(sizeof(fgm::lVec4) == 32 && alignof(fgm::lVec4) == 32);
+    static_assert(sizeof(fgm::bVec4) == 4 && alignof(fgm::bVec4) == alignof(bool));
+}
+
+
+/** @test Verify that spatial aliases still address the lanes written by a SIMD operation. */
+TEST(Vector4DSimdLayout, AliasesReadSimdLanes)
+{
+    fgm::vec4 vec(1.0f, 2.0f, 3.0f, 4.0f);
+    vec += fgm::vec4(10.0f, 20.0f, 30.0f, 40.0f);
+
+    EXPECT_FLOAT_EQ(11.0f, vec.x);
+    EXPECT_FLOAT_EQ(22.0f, vec.g);
+    EXPECT_FLOAT_EQ(33.0f, vec.p);
+    EXPECT_FLOAT_EQ(44.0f, vec.elements[3]);
+}
+
+
+
+/**************************************
+ *                                    *
+ *           KERNEL TESTS             *
+ *                                    *
+ **************************************/
+
+/** @test Verify that SIMD addition and subtraction match the scalar path. */
+TEST_F(Vector4DSimd, AddSubtract_MatchesScalarPath)
+{
+    constexpr fgm::vec4 expectedSum = _vecA + _vecB;
+    constexpr fgm::vec4 expectedDifference = _vecA - _vecB;
+
+    EXPECT_VEC_EQ(expectedSum, _runtimeA + _runtimeB);
+    EXPECT_VEC_EQ(expectedDifference, _runtimeA - _runtimeB);
+    EXPECT_VEC_EQ(expectedSum, _runtimeA += _runtimeB);
+    EXPECT_VEC_EQ(_vecA, _runtimeA -= _runtimeB);
+}
+
+
+/** @test Verify that SIMD scaling, division, and negation match the scalar path. */
+TEST_F(Vector4DSimd, ScaleDivideNegate_MatchesScalarPath)
+{
+    constexpr fgm::vec4 expectedScaled = _vecA * _scalar;
+    constexpr fgm::vec4 expectedDivided = _vecA / _scalar;
+    constexpr fgm::vec4 expectedNegated = -_vecA;
+
+    EXPECT_VEC_EQ(expectedScaled, _runtimeA * _runtimeScalar);
+    EXPECT_VEC_EQ(expectedScaled, _runtimeScalar * _runtimeA);
+    EXPECT_VEC_EQ(expectedDivided, _runtimeA / _runtimeScalar);
+    EXPECT_VEC_EQ(expectedNegated, -_runtimeA);
+
+    fgm::vec4 inPlace = _runtimeA;
+    EXPECT_VEC_EQ(expectedScaled, inPlace *= _runtimeScalar);
+    EXPECT_VEC_EQ(_vecA, inPlace /= _runtimeScalar);
+}
+
+
+/** @test Verify that SIMD dot product and magnitude match the scalar path. */
+TEST_F(Vector4DSimd, DotAndMagnitude_MatchScalarPath)
+{
+    constexpr float expectedDot = _vecA.dot(_vecB);
+    const float expectedMag = std::sqrt(_vecA.dot(_vecA));
+
+    EXPECT_FLOAT_EQ(expectedDot, _runtimeA.dot(_runtimeB));
+    EXPECT_FLOAT_EQ(expectedMag, _runtimeA.mag());
+}
+
+
+/** @test Verify that SIMD @ref fgm::Vector4D::normalize and @ref fgm::Vector4D::safeNormalize return unit vectors. */
+TEST_F(Vector4DSimd, Normalize_ReturnsUnitVector)
+{
+    EXPECT_NEAR(1.0f, _runtimeA.normalize().mag(), fgm::Config::FLOAT_EPSILON);
+    EXPECT_NEAR(1.0f, _runtimeA.safeNormalize().mag(), fgm::Config::FLOAT_EPSILON);
+    EXPECT_VEC_ZERO(fgm::vec4().safeNormalize());
+}
+
+
+/** @test Verify that SIMD projection and rejection decompose the vector into parallel and orthogonal parts. */
+TEST_F(Vector4DSimd, ProjectReject_DecomposeVector)
+{
+    const fgm::vec4 projected = _runtimeA.project(_runtimeB);
+    const fgm::vec4 rejected = _runtimeA.reject(_runtimeB);
+
+    EXPECT_VEC_EQ(_vecA, projected + rejected);
+    EXPECT_NEAR(0.0f, rejected.dot(_runtimeB), fgm::Config::FLOAT_EPSILON * 10);
+}
+
+
+/** @test Verify that SIMD ordered comparisons match the scalar path. */
+TEST_F(Vector4DSimd, Comparisons_MatchScalarPath)
+{
+    constexpr fgm::bVec4 expectedGt = _vecA.gt(_vecB);
+    constexpr fgm::bVec4 expectedLte = _vecA.lte(_vecB);
+
+    EXPECT_VEC_EQ(expectedGt, _runtimeA.gt(_runtimeB));
+    EXPECT_VEC_EQ(expectedLte, _runtimeA.lte(_runtimeB));
+    EXPECT_VEC_EQ(fgm::bVec4(false, false, false, false), fgm::vec4(NaN, NaN, NaN, NaN).gte(_runtimeB));
+}
+
+
+/** @test Verify that SIMD epsilon equality matches the scalar path on tolerance, infinity and `NaN` lanes. */
+TEST_F(Vector4DSimd, EpsilonEquality_MatchesScalarPath)
+{
+    constexpr fgm::vec4 lhs(1.0f, INFINITY_F, NaN, -INFINITY_F);
+    constexpr fgm::vec4 rhs(1.000004f, INFINITY_F, NaN, INFINITY_F);
+    constexpr fgm::Mask4 expected = lhs.eqMask(rhs);
+
+    const fgm::vec4 runtimeLhs = lhs;
+    EXPECT_EQ(expected, runtimeLhs.eqMask(rhs));
+    EXPECT_EQ(fgm::Mask4(true, true, false, false), runtimeLhs.eqMask(rhs));
+    EXPECT_EQ(~expected, runtimeLhs.neqMask(rhs));
+    EXPECT_FALSE(runtimeLhs.allEq(rhs));
+    EXPECT_TRUE(runtimeLhs.allNeq(rhs));
+    EXPECT_TRUE(_runtimeA.allEq(_runtimeA + fgm::vec4(5e-6f, -5e-6f, 0.0f, 0.0f), 1e-5));
+    EXPECT_FALSE(_runtimeA.allEq(_runtimeA + fgm::vec4(0.0f, 0.0f, 1e-3f, 0.0f)));
+}
+
+
+
+/**************************************
+ *                                    *
+ *       DOUBLE KERNEL TESTS          *
+ *                                    *
+ **************************************/
+
+/** @test Verify that SIMD addition, subtraction, scaling, division and negation match the scalar path. */
+TEST_F(Vector4DSimdDouble, Arithmetic_MatchesScalarPath)
+{
+    constexpr fgm::dVec4 expectedSum = _vecA + _vecB;
+    constexpr fgm::dVec4 expectedDifference = _vecA - _vecB;
+    constexpr fgm::dVec4 expectedScaled = _vecA * _scalar;
+    constexpr fgm::dVec4 expectedDivided = _vecA / _scalar;
+
+    EXPECT_VEC_EQ(expectedSum, _runtimeA + _runtimeB);
+    EXPECT_VEC_EQ(expectedDifference, _runtimeA - _runtimeB);
+    EXPECT_VEC_EQ(expectedScaled, _runtimeA * _runtimeScalar);
+    EXPECT_VEC_EQ(expectedDivided, _runtimeA / _runtimeScalar);
+    EXPECT_VEC_EQ(-_vecA, -_runtimeA);
+
+    fgm::dVec4 inPlace = _runtimeA;
+    EXPECT_VEC_EQ(expectedSum, inPlace += _runtimeB);
+    EXPECT_VEC_EQ(_vecA, inPlace -= _runtimeB);
+    EXPECT_VEC_EQ(expectedScaled, inPlace *= _runtimeScalar);
+    EXPECT_VEC_EQ(_vecA, inPlace /= _runtimeScalar);
+}
+
+
+/** @test Verify that SIMD ordered comparisons match the scalar path, including `NaN` lanes. */
+TEST_F(Vector4DSimdDouble, Comparisons_MatchScalarPath)
+{
+    constexpr fgm::bVec4 expectedGt = _vecA.gt(_vecB);
+    constexpr fgm::bVec4 expectedGte = _vecA.gte(_vecB);
+    constexpr fgm::bVec4 expectedLt = _vecA.lt(_vecB);
+    constexpr fgm::bVec4 expectedLte = _vecA.lte(_vecB);
+
+    EXPECT_VEC_EQ(expectedGt, _runtimeA.gt(_runtimeB));
+    EXPECT_VEC_EQ(expectedGte, _runtimeA.gte(_runtimeB));
+    EXPECT_VEC_EQ(expectedLt, _runtimeA.lt(_runtimeB));
+    EXPECT_VEC_EQ(expectedLte, _runtimeA.lte(_runtimeB));
+    EXPECT_VEC_EQ(fgm::bVec4(false, false, false, false), fgm::dVec4(NaN_D, NaN_D, NaN_D, NaN_D).lte(_runtimeB));
+}
+
+
+/** @test Verify that SIMD epsilon equality matches the scalar path on tolerance, infinity and `NaN` lanes. */
+TEST_F(Vector4DSimdDouble, EpsilonEquality_MatchesScalarPath)
+{
+    constexpr fgm::dVec4 lhs(1.0, INFINITY_D, NaN_D, -INFINITY_D);
+    constexpr fgm::dVec4 rhs(1.0 + 1e-13, INFINITY_D, NaN_D, INFINITY_D);
+    constexpr fgm::Mask4 expected = lhs.eqMask(rhs);
+
+    const fgm::dVec4 runtimeLhs = lhs;
+    EXPECT_EQ(expected, runtimeLhs.eqMask(rhs));
+    EXPECT_EQ(fgm::Mask4(true, true, false, false), runtimeLhs.eqMask(rhs));
+    EXPECT_EQ(~expected, runtimeLhs.neqMask(rhs));
+    EXPECT_TRUE(_runtimeA.allEq(_runtimeA + fgm::dVec4(0.0, 0.0, 0.0, 0.5), 0.5));
+    EXPECT_FALSE(_runtimeA.allEq(_runtimeA + fgm::dVec4(0.0, 0.0, 0.0, 0.5), 0.25));
+}
+
+
+/** @test Verify that SIMD dot product, magnitude and normalization match the scalar path. */
+TEST_F(Vector4DSimdDouble, DotMagnitudeNormalize_MatchScalarPath)
+{
+    constexpr double expectedDot = _vecA.dot(_vecB);
+    const double expectedMag = std::sqrt(_vecA.dot(_vecA));
+
+    EXPECT_DOUBLE_EQ(expectedDot, _runtimeA.dot(_runtimeB));
+    EXPECT_DOUBLE_EQ(expectedMag, _runtimeA.mag());
+    EXPECT_NEAR(1.0, _runtimeA.normalize().mag(), fgm::Config::DOUBLE_EPSILON);
+    EXPECT_NEAR(1.0, _runtimeA.safeNormalize().mag(), fgm::Config::DOUBLE_EPSILON);
+    EXPECT_VEC_ZERO(fgm::dVec4().safeNormalize());
+}
+
+
+
+/**************************************
+ *                                    *
+ *        LONG KERNEL TESTS           *
+ *                                    *
+ **************************************/
+
+/** @test Verify that SIMD 64-bit integer addition, subtraction, scaling and negation match the scalar path. */
+TEST_F(Vector4DSimdLong, Arithmetic_MatchesScalarPath)
+{
+    constexpr fgm::lVec4 expectedSum = _vecA + _vecB;
+    constexpr fgm::lVec4 expectedDifference = _vecA - _vecB;
+    constexpr fgm::lVec4 expectedScaled = _vecA * _scalar;
+
+    EXPECT_VEC_EQ(expectedSum, _runtimeA + _runtimeB);
+    EXPECT_VEC_EQ(expectedDifference, _runtimeA - _runtimeB);
+    EXPECT_VEC_EQ(expectedScaled, _runtimeA * _runtimeScalar);
+    EXPECT_VEC_EQ(expectedScaled, _runtimeScalar * _runtimeA);
+    EXPECT_VEC_EQ(-_vecA, -_runtimeA);
+
+    fgm::lVec4 inPlace = _runtimeA;
+    EXPECT_VEC_EQ(expectedScaled, inPlace *= _runtimeScalar);
+}
+
+
+/** @test Verify that SIMD 64-bit integer comparisons and exact equality match the scalar path. */
+TEST_F(Vector4DSimdLong, Comparisons_MatchScalarPath)
+{
+    constexpr fgm::bVec4 expectedGt = _vecA.gt(_vecB);
+    constexpr fgm::bVec4 expectedGte = _vecA.gte(_vecB);
+    constexpr fgm::bVec4 expectedLt = _vecA.lt(_vecB);
+    constexpr fgm::bVec4 expectedLte = _vecA.lte(_vecB);
+    constexpr fgm::bVec4 expectedEq = _vecA.eq(_vecB);
+
+    EXPECT_VEC_EQ(expectedGt, _runtimeA.gt(_runtimeB));
+    EXPECT_VEC_EQ(expectedGte, _runtimeA.gte(_runtimeB));
+    EXPECT_VEC_EQ(expectedLt, _runtimeA.lt(_runtimeB));
+    EXPECT_VEC_EQ(expectedLte, _runtimeA.lte(_runtimeB));
+    EXPECT_VEC_EQ(expectedEq, _runtimeA.eq(_runtimeB));
+    EXPECT_VEC_EQ(!expectedEq, _runtimeA.neq(_runtimeB));
+    EXPECT_TRUE(_runtimeA == _vecA);
+    EXPECT_TRUE(_runtimeA != _runtimeB);
+}
+
+
+/** @test Verify that SIMD 64-bit dot product, magnitude and safe normalization match the scalar path. */
+TEST_F(Vector4DSimdLong, DotMagnitudeNormalize_MatchScalarPath)
+{
+    constexpr long long expectedDot = _vecA.dot(_vecB);
+    const double expectedMag = _vecA.mag();
+
+    EXPECT_EQ(expectedDot, _runtimeA.dot(_runtimeB));
+    EXPECT_DOUBLE_EQ(expectedMag, _runtimeA.mag());
+    EXPECT_NEAR(1.0, _runtimeA.safeNormalize().mag(), fgm::Config::DOUBLE_EPSILON);
+    EXPECT_VEC_ZERO(fgm::lVec4().safeNormalize());
+}
+
+/** @} */